@@ -113,6 +113,69 @@ namespace
 		stopwatch.Stop();
 	}
 
+
+	// Visits the set bits of a sparse bitset by testing each bit, as std::bitset offers no scan.
+	template <typename Bitset>
+	void TestScanByTest(EA::StdC::Stopwatch& stopwatch, Bitset& b)
+	{
+		size_t temp = 0;
+		stopwatch.Restart();
+		for(int i = 0; i < 100; i++)
+		{
+			for(size_t j = 0, jEnd = b.size(); j < jEnd; j++)
+			{
+				if(b.test(j))
+					temp += j;
+			}
+			Benchmark::DoNothing(&temp);
+		}
+		stopwatch.Stop();
+	}
+
+
+	template <typename Bitset>
+	void TestFindNext(EA::StdC::Stopwatch& stopwatch, Bitset& b)
+	{
+		size_t temp = 0;
+		stopwatch.Restart();
+		for(int i = 0; i < 100; i++)
+		{
+			for(size_t j = b.find_first(); j != b.kSize; j = b.find_next(j))
+				temp += j;
+			Benchmark::DoNothing(&temp);
+		}
+		stopwatch.Stop();
+	}
+
+
+	template <typename Bitset>
+	void TestFindPrev(EA::StdC::Stopwatch& stopwatch, Bitset& b)
+	{
+		size_t temp = 0;
+		stopwatch.Restart();
+		for(int i = 0; i < 100; i++)
+		{
+			for(size_t j = b.find_last(); j != b.kSize; j = b.find_prev(j))
+				temp += j;
+			Benchmark::DoNothing(&temp);
+		}
+		stopwatch.Stop();
+	}
+
+
+	template <typename Bitset>
+	void TestForEachSetBit(EA::StdC::Stopwatch& stopwatch, Bitset& b)
+	{
+		size_t temp = 0;
+		stopwatch.Restart();
+		for(int i = 0; i < 100; i++)
+		{
+			b.for_each_set_bit([&temp](size_t j) { temp += j; });
+			Benchmark::DoNothing(&temp);
+		}
+		stopwatch.Stop();
+	}
+
 } // namespace
 
 
@@ -347,6 +410,44 @@ void BenchmarkBitset()
 										GetStdSTLType() == kSTLPort ? "STLPort is broken, neglects wraparound check." : NULL);
 		}
 	}
+
+	{
+		// Scanning a sparse 64k bit mask, as an entity-component system does with its component
+		// masks: 48 set bits in four clusters, so most of the 1024 words are zero.
+		std::bitset<65536>     stdBitset65536;
+		eastl::bitset<65536>   eaBitset65536;
+
+		for(size_t c = 0; c < 4; c++)
+		{
+			for(size_t j = 0; j < 12; j++)
+			{
+				stdBitset65536.set((c * 16411 + j * 37) % 65536);
+				eaBitset65536.set((c * 16411 + j * 37) % 65536);
+			}
+		}
+
+		for(int i = 0; i < 2; i++)
+		{
+			TestScanByTest(stopwatch1, stdBitset65536);
+			TestFindNext(stopwatch2, eaBitset65536);
+
+			if(i == 1)
+				Benchmark::AddResult("bitset<65536>/find_next sparse", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+			TestScanByTest(stopwatch1, stdBitset65536);
+			TestFindPrev(stopwatch2, eaBitset65536);
+
+			if(i == 1)
+				Benchmark::AddResult("bitset<65536>/find_prev sparse", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+			// Both sides are EASTL here: the find_next loop vs. the visitor.
+			TestFindNext(stopwatch1, eaBitset65536);
+			TestForEachSetBit(stopwatch2, eaBitset65536);
+
+			if(i == 1)
+				Benchmark::AddResult("bitset<65536>/for_each_set_bit sparse", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), "Compares find_next with for_each_set_bit");
+		}
+	}
 }
 
 
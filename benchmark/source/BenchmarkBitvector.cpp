@@ -0,0 +1,300 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+
+#ifdef _MSC_VER
+	// Microsoft STL generates warnings.
+	#pragma warning(disable: 4267) // 'initializing' : conversion from 'size_t' to 'const int', possible loss of data
+#endif
+
+#include "EASTLBenchmark.h"
+#include "EASTLTest.h"
+#include <EAStdC/EAStopwatch.h>
+#include <EASTL/bitvector.h>
+#include <EASTL/rank_select.h>
+#include <EASTL/roaring_bitmap.h>
+
+
+EA_DISABLE_ALL_VC_WARNINGS()
+#include <algorithm>
+#include <iterator>
+#include <vector>
+EA_RESTORE_ALL_VC_WARNINGS()
+
+
+using namespace EA;
+
+
+namespace
+{
+	typedef std::vector<bool> StdVectorBool;
+	typedef eastl::bitvector<> EaBitvector;
+
+
+	void TestCountStd(EA::StdC::Stopwatch& stopwatch, const StdVectorBool& v)
+	{
+		stopwatch.Restart();
+		for(int i = 0; i < 4; i++)
+		{
+			size_t temp = (size_t)std::count(v.begin(), v.end(), true);
+			Benchmark::DoNothing(&temp);
+		}
+		stopwatch.Stop();
+	}
+
+
+	void TestCountEa(EA::StdC::Stopwatch& stopwatch, const EaBitvector& v)
+	{
+		stopwatch.Restart();
+		for(int i = 0; i < 4; i++)
+		{
+			size_t temp = (size_t)v.count();
+			Benchmark::DoNothing(&temp);
+		}
+		stopwatch.Stop();
+	}
+
+
+	void TestFindNextStd(EA::StdC::Stopwatch& stopwatch, const StdVectorBool& v)
+	{
+		size_t temp = 0;
+		stopwatch.Restart();
+		for(int i = 0; i < 4; i++)
+		{
+			for(StdVectorBool::const_iterator it = std::find(v.begin(), v.end(), true); it != v.end(); it = std::find(it + 1, v.end(), true))
+				temp += (size_t)(it - v.begin());
+			Benchmark::DoNothing(&temp);
+		}
+		stopwatch.Stop();
+	}
+
+
+	void TestFindNextEa(EA::StdC::Stopwatch& stopwatch, const EaBitvector& v)
+	{
+		size_t temp = 0;
+		stopwatch.Restart();
+		for(int i = 0; i < 4; i++)
+		{
+			for(EaBitvector::const_iterator it = v.find_first(); it != v.end(); it = v.find_next(it))
+				temp += (size_t)(it - v.begin());
+			Benchmark::DoNothing(&temp);
+		}
+		stopwatch.Stop();
+	}
+
+
+	void TestAndStd(EA::StdC::Stopwatch& stopwatch, StdVectorBool& v, const StdVectorBool& mask)
+	{
+		stopwatch.Restart();
+		for(int i = 0; i < 4; i++)
+		{
+			for(size_t j = 0, jEnd = v.size(); j < jEnd; j++)
+				v[j] = v[j] && mask[j];
+			Benchmark::DoNothing(&v);
+		}
+		stopwatch.Stop();
+	}
+
+
+	void TestAndEa(EA::StdC::Stopwatch& stopwatch, EaBitvector& v, const EaBitvector& mask)
+	{
+		stopwatch.Restart();
+		for(int i = 0; i < 4; i++)
+		{
+			v &= mask;
+			Benchmark::DoNothing(&v);
+		}
+		stopwatch.Stop();
+	}
+
+
+	void TestRankStd(EA::StdC::Stopwatch& stopwatch, const StdVectorBool& v, const size_t* pPositions, size_t positionCount)
+	{
+		size_t temp = 0;
+		stopwatch.Restart();
+		for(size_t i = 0; i < positionCount; i++)
+			temp += (size_t)std::count(v.begin(), v.begin() + (ptrdiff_t)pPositions[i], true);
+		Benchmark::DoNothing(&temp);
+		stopwatch.Stop();
+	}
+
+
+	void TestRankEa(EA::StdC::Stopwatch& stopwatch, const eastl::rank_select<EaBitvector>& rs, const size_t* pPositions, size_t positionCount)
+	{
+		size_t temp = 0;
+		stopwatch.Restart();
+		for(size_t i = 0; i < positionCount; i++)
+			temp += (size_t)rs.rank(pPositions[i]);
+		Benchmark::DoNothing(&temp);
+		stopwatch.Stop();
+	}
+
+
+	void TestIntersectionStd(EA::StdC::Stopwatch& stopwatch, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b)
+	{
+		std::vector<uint32_t> result;
+		stopwatch.Restart();
+		for(int i = 0; i < 4; i++)
+		{
+			result.clear();
+			std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(result));
+			Benchmark::DoNothing(&result);
+		}
+		stopwatch.Stop();
+	}
+
+
+	void TestIntersectionEa(EA::StdC::Stopwatch& stopwatch, const eastl::roaring_bitmap<>& a, const eastl::roaring_bitmap<>& b)
+	{
+		stopwatch.Restart();
+		for(int i = 0; i < 4; i++)
+		{
+			eastl::roaring_bitmap<> result(a);
+			result &= b;
+			Benchmark::DoNothing(&result);
+		}
+		stopwatch.Stop();
+	}
+
+
+	template <typename Container>
+	void TestEqual(EA::StdC::Stopwatch& stopwatch, const Container& v1, const Container& v2)
+	{
+		stopwatch.Restart();
+		for(int i = 0; i < 4; i++)
+		{
+			bool temp = (v1 == v2);
+			Benchmark::DoNothing(&temp);
+		}
+		stopwatch.Stop();
+	}
+
+} // namespace
+
+
+
+void BenchmarkBitvector()
+{
+	EASTLTest_Printf("Bitvector\n");
+
+	EA::UnitTest::RandGenT<uint32_t> rng(EA::UnitTest::GetRandSeed());
+	EA::StdC::Stopwatch              stopwatch1(EA::StdC::Stopwatch::kUnitsCPUCycles);
+	EA::StdC::Stopwatch              stopwatch2(EA::StdC::Stopwatch::kUnitsCPUCycles);
+
+	{
+		// A 16M bit visibility mask with about one bit in 4096 set, and a dense mask to combine it with.
+		const size_t  kBitCount = 16 * 1024 * 1024;
+		StdVectorBool stdSparse(kBitCount), stdDense(kBitCount);
+		EaBitvector   eaSparse(kBitCount),  eaDense(kBitCount);
+
+		for(size_t i = 0; i < kBitCount; i++)
+		{
+			const bool bSparse = (rng() % 4096) == 0;
+			const bool bDense  = (rng() % 4) != 0;
+
+			stdSparse[i] = bSparse;
+			eaSparse[i]  = bSparse;
+			stdDense[i]  = bDense;
+			eaDense[i]   = bDense;
+		}
+
+		for(int i = 0; i < 2; i++)
+		{
+			///////////////////////////////
+			// Test count()
+			///////////////////////////////
+
+			TestCountStd(stopwatch1, stdDense);
+			TestCountEa(stopwatch2, eaDense);
+
+			if(i == 1)
+				Benchmark::AddResult("bitvector<16M>/count", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+
+			///////////////////////////////
+			// Test find_first / find_next
+			///////////////////////////////
+
+			TestFindNextStd(stopwatch1, stdSparse);
+			TestFindNextEa(stopwatch2, eaSparse);
+
+			if(i == 1)
+				Benchmark::AddResult("bitvector<16M>/find_next sparse", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+
+			///////////////////////////////
+			// Test operator&=
+			///////////////////////////////
+
+			StdVectorBool stdTemp(stdDense);
+			EaBitvector   eaTemp(eaDense);
+
+			TestAndStd(stopwatch1, stdTemp, stdSparse);
+			TestAndEa(stopwatch2, eaTemp, eaSparse);
+
+			if(i == 1)
+				Benchmark::AddResult("bitvector<16M>/operator&=", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+
+			///////////////////////////////
+			// Test operator==
+			///////////////////////////////
+
+			stdTemp = stdDense;
+			eaTemp  = eaDense;
+
+			TestEqual(stopwatch1, stdDense, stdTemp);
+			TestEqual(stopwatch2, eaDense, eaTemp);
+
+			if(i == 1)
+				Benchmark::AddResult("bitvector<16M>/operator==", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+
+			///////////////////////////////
+			// Test rank_select::rank
+			///////////////////////////////
+
+			size_t positions[32];
+			for(size_t j = 0; j < EAArrayCount(positions); j++)
+				positions[j] = rng() % kBitCount;
+
+			const eastl::rank_select<EaBitvector> rs(eaSparse);
+
+			TestRankStd(stopwatch1, stdSparse, positions, EAArrayCount(positions));
+			TestRankEa(stopwatch2, rs, positions, EAArrayCount(positions));
+
+			if(i == 1)
+				Benchmark::AddResult("bitvector<16M>/rank", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), "Compares std::count of the prefix with rank_select");
+		}
+	}
+	{
+		// Two posting lists over the 32-bit ID space: a dense one, and a sparse one which
+		// overlaps half of it.
+		std::vector<uint32_t> stdA, stdB;
+
+		for(uint32_t id = 0; id < (1u << 22); id++)
+		{
+			if((rng() % 4) != 0)
+				stdA.push_back(id);
+			if((rng() % 64) == 0)
+				stdB.push_back(id + (1u << 21));
+		}
+
+		const eastl::roaring_bitmap<> eaA(stdA.begin(), stdA.end());
+		const eastl::roaring_bitmap<> eaB(stdB.begin(), stdB.end());
+
+		for(int i = 0; i < 2; i++)
+		{
+			///////////////////////////////
+			// Test roaring_bitmap::operator&=
+			///////////////////////////////
+
+			TestIntersectionStd(stopwatch1, stdA, stdB);
+			TestIntersectionEa(stopwatch2, eaA, eaB);
+
+			if(i == 1)
+				Benchmark::AddResult("roaring_bitmap/operator&=", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), "Compares std::set_intersection of sorted vectors");
+		}
+	}
+}
@@ -285,6 +285,256 @@ namespace
 	}
 
 
+	typedef eastl::hash_map<uint32_t, uint32_t>                                                           EaMapUint32PrimePolicy;
+	typedef eastl::hash_map<uint32_t, uint32_t, eastl::hash<uint32_t>, eastl::equal_to<uint32_t>,
+							EASTLAllocatorType, false, eastl::power_of_two_rehash_policy>                 EaMapUint32PowerOfTwoPolicy;
+
+	// BenchmarkHashRehashPolicy
+	//
+	// Compares prime_rehash_policy (reported as the std column) against 
+	// power_of_two_rehash_policy (reported as the EASTL column). Both tables use
+	// the identity eastl::hash<uint32_t>, so the difference is the cost of the
+	// modulo versus the multiply/mask in the lookup path, plus any difference in 
+	// bucket distribution. We test both random keys and keys which are all 
+	// multiples of 4096. The latter would all land in one bucket with a plain 
+	// mask, and are spread perfectly (and in key order) by a prime modulus.
+	//
+	void BenchmarkHashRehashPolicy()
+	{
+		EASTLTest_Printf("HashMap RehashPolicy\n");
+
+		EA::UnitTest::Rand  rng(EA::UnitTest::GetRandSeed());
+		EA::StdC::Stopwatch stopwatch1(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		EA::StdC::Stopwatch stopwatch2(EA::StdC::Stopwatch::kUnitsCPUCycles);
+
+		eastl::vector< eastl::pair<uint32_t, uint32_t> > randomKeys(100000);
+		eastl::vector< eastl::pair<uint32_t, uint32_t> > strideKeys(100000);
+		eastl::vector< eastl::pair<uint32_t, uint32_t> > missingKeys(100000);
+
+		for(eastl_size_t i = 0, iEnd = randomKeys.size(); i < iEnd; i++)
+		{
+			const uint32_t n = rng.RandValue();
+
+			randomKeys[i]  = eastl::pair<uint32_t, uint32_t>(n | 1, (uint32_t)i);   // Odd keys only, so that missingKeys never match.
+			strideKeys[i]  = eastl::pair<uint32_t, uint32_t>((uint32_t)i * 4096, (uint32_t)i);
+			missingKeys[i] = eastl::pair<uint32_t, uint32_t>(n & ~1u, (uint32_t)i);
+		}
+
+		for(int i = 0; i < 2; i++)
+		{
+			EaMapUint32PrimePolicy      primeMap;
+			EaMapUint32PowerOfTwoPolicy powerOfTwoMap;
+
+			///////////////////////////////
+			// Test insert(first, last)
+			///////////////////////////////
+
+			TestInsert(stopwatch1, primeMap,      randomKeys.data(), randomKeys.data() + randomKeys.size());
+			TestInsert(stopwatch2, powerOfTwoMap, randomKeys.data(), randomKeys.data() + randomKeys.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, uint32_t>/prime vs pow2/insert", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+
+			///////////////////////////////
+			// Test find (hits and misses)
+			///////////////////////////////
+
+			TestFind(stopwatch1, primeMap,      randomKeys.data(), randomKeys.data() + randomKeys.size());
+			TestFind(stopwatch2, powerOfTwoMap, randomKeys.data(), randomKeys.data() + randomKeys.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, uint32_t>/prime vs pow2/find", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+			TestFind(stopwatch1, primeMap,      missingKeys.data(), missingKeys.data() + missingKeys.size());
+			TestFind(stopwatch2, powerOfTwoMap, missingKeys.data(), missingKeys.data() + missingKeys.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, uint32_t>/prime vs pow2/find miss", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+
+			///////////////////////////////
+			// Test erase(const key_type& key)
+			///////////////////////////////
+
+			TestEraseValue(stopwatch1, primeMap,      randomKeys.data(), randomKeys.data() + randomKeys.size());
+			TestEraseValue(stopwatch2, powerOfTwoMap, randomKeys.data(), randomKeys.data() + randomKeys.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, uint32_t>/prime vs pow2/erase val", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+
+			///////////////////////////////
+			// Test strided keys
+			///////////////////////////////
+
+			TestInsert(stopwatch1, primeMap,      strideKeys.data(), strideKeys.data() + strideKeys.size());
+			TestInsert(stopwatch2, powerOfTwoMap, strideKeys.data(), strideKeys.data() + strideKeys.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, uint32_t>/prime vs pow2/insert stride", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+			TestFind(stopwatch1, primeMap,      strideKeys.data(), strideKeys.data() + strideKeys.size());
+			TestFind(stopwatch2, powerOfTwoMap, strideKeys.data(), strideKeys.data() + strideKeys.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, uint32_t>/prime vs pow2/find stride", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+		}
+	}
+
+
+	// BenchmarkHashString
+	//
+	// Compares the byte-at-a-time FNV-1 string hash (HashString8, which is what 
+	// eastl::hash<string> is with EASTL_STRING_HASH_LEGACY) against the default
+	// eastl::hash<string>, reported as the std and EASTL columns respectively. 
+	// The keys resemble asset paths, which are typically 40-100 characters.
+	//
+	void BenchmarkHashString()
+	{
+		EASTLTest_Printf("HashMap String Hash\n");
+
+		EA::UnitTest::Rand  rng(EA::UnitTest::GetRandSeed());
+		EA::StdC::Stopwatch stopwatch1(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		EA::StdC::Stopwatch stopwatch2(EA::StdC::Stopwatch::kUnitsCPUCycles);
+
+		eastl::vector< eastl::pair<eastl::string, uint32_t> > pathKeys(10000);
+
+		for(eastl_size_t i = 0, iEnd = pathKeys.size(); i < iEnd; i++)
+		{
+			pathKeys[i].first.sprintf("data/assets/characters/npc_%u/textures/diffuse_%u_%u.dds", 
+									  (unsigned)rng.RandLimit(100), (unsigned)i, (unsigned)rng.RandValue());
+			pathKeys[i].second = (uint32_t)i;
+		}
+
+		for(int i = 0; i < 2; i++)
+		{
+			eastl::hash_map<eastl::string, uint32_t, HashString8<eastl::string> > fnvMap;
+			eastl::hash_map<eastl::string, uint32_t>                              defaultMap;
+
+			///////////////////////////////
+			// Test hash function alone
+			///////////////////////////////
+
+			size_t sum1 = 0, sum2 = 0;
+			HashString8<eastl::string> fnvHash;
+			eastl::hash<eastl::string> defaultHash;
+
+			stopwatch1.Restart();
+			for(eastl_size_t j = 0; j < pathKeys.size(); j++)
+				sum1 += fnvHash(pathKeys[j].first);
+			stopwatch1.Stop();
+
+			stopwatch2.Restart();
+			for(eastl_size_t j = 0; j < pathKeys.size(); j++)
+				sum2 += defaultHash(pathKeys[j].first);
+			stopwatch2.Stop();
+
+			sprintf(Benchmark::gScratchBuffer, "%u %u", (unsigned)sum1, (unsigned)sum2);
+
+			if(i == 1)
+				Benchmark::AddResult("hash<string>/FNV vs default/path", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+
+			///////////////////////////////
+			// Test insert and find
+			///////////////////////////////
+
+			TestInsert(stopwatch1, fnvMap,     pathKeys.data(), pathKeys.data() + pathKeys.size());
+			TestInsert(stopwatch2, defaultMap, pathKeys.data(), pathKeys.data() + pathKeys.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<string, uint32_t>/FNV vs default/insert path", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+			TestFind(stopwatch1, fnvMap,     pathKeys.data(), pathKeys.data() + pathKeys.size());
+			TestFind(stopwatch2, defaultMap, pathKeys.data(), pathKeys.data() + pathKeys.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<string, uint32_t>/FNV vs default/find path", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+		}
+	}
+
+
+	// BenchmarkHashFindBatch
+	//
+	// Compares a loop of find or contains calls (reported as the std column) 
+	// against find_batch and contains_batch (reported as the EASTL column), 
+	// on a table which is much larger than the cache, so that nearly every 
+	// lookup misses on both the bucket and the node.
+	//
+	void BenchmarkHashFindBatch()
+	{
+		EASTLTest_Printf("HashMap FindBatch\n");
+
+		EA::UnitTest::Rand  rng(EA::UnitTest::GetRandSeed());
+		EA::StdC::Stopwatch stopwatch1(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		EA::StdC::Stopwatch stopwatch2(EA::StdC::Stopwatch::kUnitsCPUCycles);
+
+		eastl::vector< eastl::pair<uint32_t, uint32_t> > values(2000000);
+		eastl::vector<uint32_t>                          keys(200000);
+
+		// rng.RandValue has too short a period to generate this many distinct keys, so we
+		// scramble the indexes instead. Multiplying by an odd constant is a bijection, so 
+		// keys made from indexes beyond values.size() are never present.
+		const uint32_t nValueCount = (uint32_t)values.size();
+
+		for(uint32_t i = 0; i < nValueCount; i++)
+			values[i] = eastl::pair<uint32_t, uint32_t>(i * 2654435761u, i);
+
+		for(eastl_size_t i = 0, iEnd = keys.size(); i < iEnd; i++) // Half hits, half misses.
+			keys[i] = (rng.RandLimit(nValueCount) + ((i & 1) ? 0 : nValueCount)) * 2654435761u;
+
+		EaMapUint32PrimePolicy hashMap(values.begin(), values.end());
+
+		eastl::vector<EaMapUint32PrimePolicy::iterator> results(keys.size());
+		eastl::vector<bool>                             found(keys.size()); // eastl::vector<bool> is not a bit vector.
+
+		for(int i = 0; i < 2; i++)
+		{
+			///////////////////////////////
+			// Test find vs find_batch
+			///////////////////////////////
+
+			stopwatch1.Restart();
+			for(eastl_size_t j = 0; j < keys.size(); j++)
+				results[j] = hashMap.find(keys[j]);
+			stopwatch1.Stop();
+			Benchmark::DoNothing(results.data());
+
+			stopwatch2.Restart();
+			hashMap.find_batch(eastl::span<const uint32_t>(keys.data(), keys.size()),
+			                   eastl::span<EaMapUint32PrimePolicy::iterator>(results.data(), results.size()));
+			stopwatch2.Stop();
+			Benchmark::DoNothing(results.data());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, uint32_t>/find vs find_batch", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+
+			///////////////////////////////
+			// Test contains vs contains_batch
+			///////////////////////////////
+
+			eastl_size_t count1 = 0, count2 = 0;
+
+			stopwatch1.Restart();
+			for(eastl_size_t j = 0; j < keys.size(); j++)
+				count1 += hashMap.contains(keys[j]);
+			stopwatch1.Stop();
+
+			stopwatch2.Restart();
+			count2 = hashMap.contains_batch(eastl::span<const uint32_t>(keys.data(), keys.size()),
+			                                eastl::span<bool>(found.data(), found.size()));
+			stopwatch2.Stop();
+
+			sprintf(Benchmark::gScratchBuffer, "%u %u", (unsigned)count1, (unsigned)count2);
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, uint32_t>/contains vs contains_batch", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+		}
+	}
+
+
 } // namespace
 
 
@@ -510,6 +760,10 @@ void BenchmarkHash()
 	#else
 		EASTLTest_Printf("HashMap...Unsupported by the tested std STL.\n");
 	#endif
+
+	BenchmarkHashRehashPolicy();
+	BenchmarkHashString();
+	BenchmarkHashFindBatch();
 }
 
 
@@ -7,6 +7,11 @@
 #include "EASTLTest.h"
 #include <EAStdC/EAStopwatch.h>
 #include <EASTL/map.h>
+#include <EASTL/btree_map.h>
+#include <EASTL/vector_map.h>
+#include <EASTL/frozen_vector_map.h>
+#include <EASTL/pool_allocator.h>
+#include <EASTL/arena_allocator.h>
 #include <EASTL/vector.h>
 #include <EASTL/algorithm.h>
 
@@ -21,6 +26,10 @@ using namespace EA;
 
 typedef std::map<TestObject, uint32_t>     StdMapTOUint32;
 typedef eastl::map<TestObject, uint32_t>   EaMapTOUint32;
+typedef eastl::map<TestObject, uint32_t, eastl::less<TestObject>, eastl::pool_allocator> EaPoolMapTOUint32;
+typedef eastl::map<TestObject, uint32_t, eastl::less<TestObject>, eastl::arena_allocator> EaArenaMapTOUint32;
+typedef eastl::map<uint64_t, uint64_t>       EaMapUint64;
+typedef eastl::btree_map<uint64_t, uint64_t> EaBTreeMapUint64;
 
 
 namespace
@@ -35,6 +44,16 @@ namespace
 	}
 
 
+	template <typename Container, typename Value>
+	void TestConstructSorted(EA::StdC::Stopwatch& stopwatch, const Value* pArrayBegin, const Value* pArrayEnd)
+	{
+		stopwatch.Restart();
+		Container c(pArrayBegin, pArrayEnd);
+		stopwatch.Stop();
+		sprintf(Benchmark::gScratchBuffer, "%u", (unsigned)c.size());
+	}
+
+
 	template <typename Container, typename Value>
 	void TestIteration(EA::StdC::Stopwatch& stopwatch, const Container& c, const Value& findValue)
 	{
@@ -197,6 +216,74 @@ namespace
 	}
 
 
+	// Repeatedly fills and drains a map, which is dominated by node allocation and deallocation.
+	// If an arena is given, it is reset whenever the map has been cleared.
+	template <typename Container, typename Value>
+	void TestChurn(EA::StdC::Stopwatch& stopwatch, Container& c, const Value* pArrayBegin, const Value* pArrayEnd, eastl::monotonic_arena* pArena = NULL)
+	{
+		stopwatch.Restart();
+		for(int j = 0; j < 10; j++)
+		{
+			c.insert(pArrayBegin, pArrayEnd);
+			for(const Value* p = pArrayBegin; p < pArrayEnd; p += 2)
+				c.erase(p->first);
+			c.insert(pArrayBegin, pArrayEnd);
+			c.clear();
+
+			if(pArena)
+				pArena->reset();
+		}
+		stopwatch.Stop();
+		sprintf(Benchmark::gScratchBuffer, "%u", (unsigned)c.size());
+	}
+
+
+	// vector_map vs. frozen_vector_map, for a table of small keys which is too big for the
+	// L2 cache. The keys are spread over the range by multiplication, as we want them to be
+	// distinct, and we look them up in random order.
+	template <typename Key>
+	void BenchmarkFrozenVectorMap(EA::UnitTest::Rand& rng, EA::StdC::Stopwatch& stopwatch1, EA::StdC::Stopwatch& stopwatch2, const char* pTypeName)
+	{
+		typedef eastl::vector_map<Key, Key>        EaVectorMap;
+		typedef eastl::frozen_vector_map<Key, Key> EaFrozenVectorMap;
+
+		eastl::vector< eastl::pair<Key, Key> > eaVector(1000000);
+
+		for(eastl_size_t i = 0, iEnd = eaVector.size(); i < iEnd; i++)
+			eaVector[i] = eastl::pair<Key, Key>((Key)((uint64_t)i * UINT64_C(11400714819323198485)), (Key)i);
+
+		eastl::vector< eastl::pair<Key, Key> > eaLookupVector(eaVector);
+		eastl::random_shuffle(eaLookupVector.begin(), eaLookupVector.end(), rng);
+
+		eastl::sort(eaVector.begin(), eaVector.end()); // So that vector_map's construction appends.
+
+		const EaVectorMap       eaVectorMap(eaVector.begin(), eaVector.end());
+		const EaFrozenVectorMap eaFrozenVectorMap(eaVector.begin(), eaVector.end());
+		const char* const       pNote = "Compares eastl::vector_map to eastl::frozen_vector_map.";
+		char                    name[64];
+
+		for(int i = 0; i < 2; i++)
+		{
+			TestFind(stopwatch1, eaVectorMap,       eaLookupVector.data(), eaLookupVector.data() + eaLookupVector.size());
+			TestFind(stopwatch2, eaFrozenVectorMap, eaLookupVector.data(), eaLookupVector.data() + eaLookupVector.size());
+
+			if(i == 1)
+			{
+				sprintf(name, "frozen_vector_map<%s, %s>/find", pTypeName, pTypeName);
+				Benchmark::AddResult(name, stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+			}
+
+			TestLowerBound(stopwatch1, eaVectorMap,       eaLookupVector.data(), eaLookupVector.data() + eaLookupVector.size());
+			TestLowerBound(stopwatch2, eaFrozenVectorMap, eaLookupVector.data(), eaLookupVector.data() + eaLookupVector.size());
+
+			if(i == 1)
+			{
+				sprintf(name, "frozen_vector_map<%s, %s>/lower_bound", pTypeName, pTypeName);
+				Benchmark::AddResult(name, stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+			}
+		}
+	}
+
 } // namespace
 
 
@@ -363,20 +450,120 @@ void BenchmarkMap()
 				Benchmark::AddResult("map<TestObject, uint32_t>/clear", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
 
 		}
+
+		for(int i = 0; i < 2; i++)
+		{
+			EaMapTOUint32     eaMapTOUint32;
+			EaPoolMapTOUint32 eaPoolMapTOUint32;
+
+			///////////////////////////////
+			// Test allocator churn: eastl::allocator vs. eastl::pool_allocator
+			///////////////////////////////
+
+			TestChurn(stopwatch1, eaMapTOUint32,     eaVector.data(), eaVector.data() + eaVector.size());
+			TestChurn(stopwatch2, eaPoolMapTOUint32, eaVector.data(), eaVector.data() + eaVector.size());
+
+			if(i == 1)
+				Benchmark::AddResult("map<TestObject, uint32_t>/churn/pool_allocator", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), "Compares eastl::allocator to eastl::pool_allocator.");
+
+
+			///////////////////////////////
+			// Test allocator churn: eastl::allocator vs. eastl::arena_allocator
+			///////////////////////////////
+
+			eastl::monotonic_arena arena;
+			EaArenaMapTOUint32     eaArenaMapTOUint32((eastl::arena_allocator(&arena)));
+
+			TestChurn(stopwatch1, eaMapTOUint32,      eaVector.data(), eaVector.data() + eaVector.size());
+			TestChurn(stopwatch2, eaArenaMapTOUint32, eaVector.data(), eaVector.data() + eaVector.size(), &arena);
+
+			if(i == 1)
+				Benchmark::AddResult("map<TestObject, uint32_t>/churn/arena_allocator", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), "Compares eastl::allocator to eastl::arena_allocator.");
+		}
 	}
-}
 
+	{
+		// map vs. btree_map, for a large index of small keys. The keys are spread over the
+		// whole range by multiplication, as we want them to be distinct. We look them up in a
+		// different order than we insert them, as otherwise map's nodes are visited in the
+		// order they were allocated, which flatters it.
+		eastl::vector< eastl::pair<uint64_t, uint64_t> > eaVector(100000);
+
+		for(eastl_size_t i = 0, iEnd = eaVector.size(); i < iEnd; i++)
+			eaVector[i] = eastl::pair<uint64_t, uint64_t>((uint64_t)i * UINT64_C(11400714819323198485), i);
+
+		eastl::vector< eastl::pair<uint64_t, uint64_t> > eaLookupVector(eaVector);
+		eastl::random_shuffle(eaLookupVector.begin(), eaLookupVector.end(), rng);
+
+		const eastl::pair<uint64_t, uint64_t> eaHighValue(UINT64_C(0xffffffffffffffff), 0);
+		const char* const pNote = "Compares eastl::map to eastl::btree_map.";
+
+		for(int i = 0; i < 2; i++)
+		{
+			EaMapUint64      eaMapUint64;
+			EaBTreeMapUint64 eaBTreeMapUint64;
+
+			TestInsert(stopwatch1, eaMapUint64,      eaVector.data(), eaVector.data() + eaVector.size(), eaHighValue);
+			TestInsert(stopwatch2, eaBTreeMapUint64, eaVector.data(), eaVector.data() + eaVector.size(), eaHighValue);
+
+			if(i == 1)
+				Benchmark::AddResult("btree_map<uint64_t, uint64_t>/insert", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
 
+			TestIteration(stopwatch1, eaMapUint64,      EaMapUint64::value_type(1, 1));
+			TestIteration(stopwatch2, eaBTreeMapUint64, EaBTreeMapUint64::value_type(1, 1));
+
+			if(i == 1)
+				Benchmark::AddResult("btree_map<uint64_t, uint64_t>/iteration", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
 
+			TestFind(stopwatch1, eaMapUint64,      eaLookupVector.data(), eaLookupVector.data() + eaLookupVector.size());
+			TestFind(stopwatch2, eaBTreeMapUint64, eaLookupVector.data(), eaLookupVector.data() + eaLookupVector.size());
 
+			if(i == 1)
+				Benchmark::AddResult("btree_map<uint64_t, uint64_t>/find", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
 
+			TestLowerBound(stopwatch1, eaMapUint64,      eaLookupVector.data(), eaLookupVector.data() + eaLookupVector.size());
+			TestLowerBound(stopwatch2, eaBTreeMapUint64, eaLookupVector.data(), eaLookupVector.data() + eaLookupVector.size());
 
+			if(i == 1)
+				Benchmark::AddResult("btree_map<uint64_t, uint64_t>/lower_bound", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
 
+			TestEraseValue(stopwatch1, eaMapUint64,      eaLookupVector.data(), eaLookupVector.data() + (eaLookupVector.size() / 2));
+			TestEraseValue(stopwatch2, eaBTreeMapUint64, eaLookupVector.data(), eaLookupVector.data() + (eaLookupVector.size() / 2));
 
+			if(i == 1)
+				Benchmark::AddResult("btree_map<uint64_t, uint64_t>/erase/key", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
 
+			TestClear(stopwatch1, eaMapUint64);
+			TestClear(stopwatch2, eaBTreeMapUint64);
 
+			if(i == 1)
+				Benchmark::AddResult("btree_map<uint64_t, uint64_t>/clear", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+		}
+	}
 
+	{
+		// Construction from a sorted range, as when loading a snapshot. eastl::map detects
+		// that the range is sorted and builds the tree directly, while std::map inserts 
+		// each value at the end.
+		eastl::vector< std::pair<uint64_t, uint64_t> >   stdVector(100000);
+		eastl::vector< eastl::pair<uint64_t, uint64_t> > eaVector(100000);
 
+		for(eastl_size_t i = 0, iEnd = eaVector.size(); i < iEnd; i++)
+		{
+			stdVector[i] = std::pair<uint64_t, uint64_t>((uint64_t)i * 3, i);
+			eaVector[i]  = eastl::pair<uint64_t, uint64_t>((uint64_t)i * 3, i);
+		}
 
+		for(int i = 0; i < 2; i++)
+		{
+			TestConstructSorted< std::map<uint64_t, uint64_t> >(stopwatch1, stdVector.data(), stdVector.data() + stdVector.size());
+			TestConstructSorted<EaMapUint64>(stopwatch2, eaVector.data(), eaVector.data() + eaVector.size());
 
+			if(i == 1)
+				Benchmark::AddResult("map<uint64_t, uint64_t>/ctor/sorted range", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+		}
+	}
 
+	BenchmarkFrozenVectorMap<uint32_t>(rng, stopwatch1, stopwatch2, "uint32_t");
+	BenchmarkFrozenVectorMap<uint64_t>(rng, stopwatch1, stopwatch2, "uint64_t");
+}
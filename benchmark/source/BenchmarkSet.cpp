@@ -7,6 +7,8 @@
 #include "EASTLTest.h"
 #include <EAStdC/EAStopwatch.h>
 #include <EASTL/set.h>
+#include <EASTL/btree_set.h>
+#include <EASTL/vector_set.h>
 #include <EASTL/vector.h>
 #include <EASTL/algorithm.h>
 
@@ -19,8 +21,10 @@ EA_RESTORE_ALL_VC_WARNINGS()
 using namespace EA;
 
 
-typedef std::set<uint32_t>     StdSetUint32;
-typedef eastl::set<uint32_t>   EaSetUint32;
+typedef std::set<uint32_t>         StdSetUint32;
+typedef eastl::set<uint32_t>       EaSetUint32;
+typedef eastl::btree_set<uint32_t> EaBTreeSetUint32;
+typedef eastl::vector_set<uint32_t> EaVectorSetUint32;
 
 
 namespace
@@ -335,6 +339,105 @@ void BenchmarkSet()
 
 		}
 	}
+
+	{
+		// set vs. btree_set, for a large set of distinct values. We look them up in a different
+		// order than we insert them, as otherwise set's nodes are visited in the order they were
+		// allocated, which flatters it.
+		eastl::vector<uint32_t> intVector(100000);
+		for(eastl_size_t i = 0, iEnd = intVector.size(); i < iEnd; i++)
+			intVector[i] = (uint32_t)i * 2654435761u;
+
+		eastl::vector<uint32_t> lookupVector(intVector);
+		eastl::random_shuffle(lookupVector.begin(), lookupVector.end(), rng);
+
+		const char* const pNote = "Compares eastl::set to eastl::btree_set.";
+
+		for(int i = 0; i < 2; i++)
+		{
+			EaSetUint32      eaSetUint32;
+			EaBTreeSetUint32 eaBTreeSetUint32;
+
+			TestInsert(stopwatch1, eaSetUint32,      intVector.data(), intVector.data() + intVector.size());
+			TestInsert(stopwatch2, eaBTreeSetUint32, intVector.data(), intVector.data() + intVector.size());
+
+			if(i == 1)
+				Benchmark::AddResult("btree_set<uint32_t>/insert", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+
+			TestIteration(stopwatch1, eaSetUint32);
+			TestIteration(stopwatch2, eaBTreeSetUint32);
+
+			if(i == 1)
+				Benchmark::AddResult("btree_set<uint32_t>/iteration", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+
+			TestFind(stopwatch1, eaSetUint32,      lookupVector.data(), lookupVector.data() + lookupVector.size());
+			TestFind(stopwatch2, eaBTreeSetUint32, lookupVector.data(), lookupVector.data() + lookupVector.size());
+
+			if(i == 1)
+				Benchmark::AddResult("btree_set<uint32_t>/find", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+
+			TestLowerBound(stopwatch1, eaSetUint32,      lookupVector.data(), lookupVector.data() + lookupVector.size());
+			TestLowerBound(stopwatch2, eaBTreeSetUint32, lookupVector.data(), lookupVector.data() + lookupVector.size());
+
+			if(i == 1)
+				Benchmark::AddResult("btree_set<uint32_t>/lower_bound", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+
+			TestEqualRange(stopwatch1, eaSetUint32,      lookupVector.data(), lookupVector.data() + lookupVector.size());
+			TestEqualRange(stopwatch2, eaBTreeSetUint32, lookupVector.data(), lookupVector.data() + lookupVector.size());
+
+			if(i == 1)
+				Benchmark::AddResult("btree_set<uint32_t>/equal_range", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+
+			TestEraseValue(stopwatch1, eaSetUint32,      lookupVector.data(), lookupVector.data() + (lookupVector.size() / 2));
+			TestEraseValue(stopwatch2, eaBTreeSetUint32, lookupVector.data(), lookupVector.data() + (lookupVector.size() / 2));
+
+			if(i == 1)
+				Benchmark::AddResult("btree_set<uint32_t>/erase/key", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+
+			TestClear(stopwatch1, eaSetUint32);
+			TestClear(stopwatch2, eaBTreeSetUint32);
+
+			if(i == 1)
+				Benchmark::AddResult("btree_set<uint32_t>/clear", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNote);
+		}
+	}
+
+	{
+		// vector_set range insertion, which sorts the batch and merges it in, vs. inserting
+		// the batch one value at a time, as an index update would without it. The values
+		// are spread over the whole range by multiplication, as we want them to be distinct.
+		eastl::vector<uint32_t> initialVector(100000);
+		eastl::vector<uint32_t> batchVector(10000);
+
+		for(eastl_size_t i = 0; i < initialVector.size(); i++)
+			initialVector[i] = (uint32_t)i * 2654435761u;
+
+		for(eastl_size_t i = 0; i < batchVector.size(); i++)
+			batchVector[i] = (uint32_t)(initialVector.size() + i) * 2654435761u;
+
+		const EaVectorSetUint32 eaVectorSetInitial(initialVector.begin(), initialVector.end());
+
+		for(int i = 0; i < 2; i++)
+		{
+			EaVectorSetUint32 eaVectorSetUint32A(eaVectorSetInitial);
+			EaVectorSetUint32 eaVectorSetUint32B(eaVectorSetInitial);
+
+			stopwatch1.Restart();
+			for(eastl_size_t j = 0; j < batchVector.size(); j++)
+				eaVectorSetUint32A.insert(batchVector[j]);
+			stopwatch1.Stop();
+
+			stopwatch2.Restart();
+			eaVectorSetUint32B.insert(batchVector.begin(), batchVector.end());
+			stopwatch2.Stop();
+
+			if(i == 1)
+				Benchmark::AddResult("vector_set<uint32_t>/insert/range", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(),
+									 "Compares inserting one value at a time to inserting the range.");
+
+			sprintf(Benchmark::gScratchBuffer, "%u", (unsigned)(eaVectorSetUint32A.size() + eaVectorSetUint32B.size()));
+		}
+	}
 }
 
 
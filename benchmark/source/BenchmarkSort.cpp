@@ -1093,6 +1093,29 @@ void BenchmarkSort()
 			if(i == 1)
 				Benchmark::AddResult("sort/q_sort/vector<uint32>/sorted", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
 
+			// Benchmark the sorting of something that is reverse sorted.
+			std::reverse(stdVectorInt.begin(), stdVectorInt.end());
+			eastl::reverse(eaVectorInt.begin(), eaVectorInt.end());
+
+			TestQuickSortStdInt(stopwatch1, stdVectorInt);
+			TestQuickSortEaInt (stopwatch2,  eaVectorInt);
+
+			if(i == 1)
+				Benchmark::AddResult("sort/q_sort/vector<uint32>/reversed", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+			// Benchmark the sorting of something with many duplicate values.
+			for(eastl_size_t j = 0, jEnd = intVector.size(); j < jEnd; j++)
+			{
+				stdVectorInt[j] = intVector[j] % 16;
+				eaVectorInt[j]  = intVector[j] % 16;
+			}
+
+			TestQuickSortStdInt(stopwatch1, stdVectorInt);
+			TestQuickSortEaInt (stopwatch2,  eaVectorInt);
+
+			if(i == 1)
+				Benchmark::AddResult("sort/q_sort/vector<uint32>/few unique", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
 
 
 			///////////////////////////////
@@ -1148,6 +1171,67 @@ void BenchmarkSort()
 				Benchmark::AddResult("sort/q_sort/TestObject[]/sorted", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
 		}
 	}
+
+	{
+		///////////////////////////////
+		// Test the task_scheduler overloads against the serial versions, on the default task scheduler.
+		// Here the first column is the serial eastl version and the second column is the parallel version.
+		///////////////////////////////
+
+		eastl::task_scheduler&  scheduler = eastl::GetDefaultTaskScheduler();
+		eastl::vector<uint32_t> intVector(2000000);
+		eastl::vector<uint32_t> v1, v2;
+		eastl::vector<uint32_t> buffer(intVector.size());
+
+		eastl::generate(intVector.begin(), intVector.end(), rng);
+
+		for (int i = 0; i < 2; i++)
+		{
+			v1 = intVector; v2 = intVector;
+			stopwatch1.Restart();
+			eastl::sort(v1.begin(), v1.end());
+			stopwatch1.Stop();
+			stopwatch2.Restart();
+			eastl::sort(scheduler, v2.begin(), v2.end());
+			stopwatch2.Stop();
+
+			if(i == 1)
+				Benchmark::AddResult("sort/parallel/sort/vector<uint32>", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+			v1 = intVector; v2 = intVector;
+			stopwatch1.Restart();
+			eastl::merge_sort_buffer(v1.begin(), v1.end(), buffer.data());
+			stopwatch1.Stop();
+			stopwatch2.Restart();
+			eastl::stable_sort(scheduler, v2.begin(), v2.end(), buffer.data());
+			stopwatch2.Stop();
+
+			if(i == 1)
+				Benchmark::AddResult("sort/parallel/stable_sort/vector<uint32>", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+			v1 = intVector; v2 = intVector;
+			stopwatch1.Restart();
+			eastl::radix_sort<uint32_t*, identity_extract_radix_key<uint32_t>>(v1.begin(), v1.end(), buffer.data());
+			stopwatch1.Stop();
+			stopwatch2.Restart();
+			eastl::radix_sort<uint32_t*, identity_extract_radix_key<uint32_t>>(scheduler, v2.begin(), v2.end(), buffer.data());
+			stopwatch2.Stop();
+
+			if(i == 1)
+				Benchmark::AddResult("sort/parallel/radix_sort/vector<uint32>", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+			v1 = intVector; v2 = intVector;
+			stopwatch1.Restart();
+			eastl::nth_element(v1.begin(), v1.begin() + v1.size() / 2, v1.end());
+			stopwatch1.Stop();
+			stopwatch2.Restart();
+			eastl::nth_element(scheduler, v2.begin(), v2.begin() + v2.size() / 2, v2.end());
+			stopwatch2.Stop();
+
+			if(i == 1)
+				Benchmark::AddResult("sort/parallel/nth_element/vector<uint32>", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+		}
+	}
 }
 
 
@@ -119,6 +119,16 @@ namespace
 	}
 
 
+	template <typename Container, typename T> 
+	void TestFindChar(EA::StdC::Stopwatch& stopwatch, Container& c, T ch)
+	{
+		stopwatch.Restart();
+		for(int i = 0; i < 1000; i++)
+			Benchmark::DoNothing(&c, c.find(ch));
+		stopwatch.Stop();
+	}
+
+
 	template <typename Container, typename T> 
 	void TestRfind1(EA::StdC::Stopwatch& stopwatch, Container& c, T* p, int pos, int n)
 	{
@@ -477,6 +487,48 @@ void BenchmarkString()
 
 		#endif
 
+			///////////////////////////////
+			// Test find(value_type c), find_first_of with a large set, and find with a
+			// pattern whose first and last characters match at every position.
+			///////////////////////////////
+
+			{
+				std::basic_string<char8_t>    ssA(4096, 'a');
+				eastl::basic_string<char8_t>  esA(4096, 'a');
+				std::basic_string<char32_t>   ss32A(4096, 'a');
+				eastl::basic_string<char32_t> es32A(4096, 'a');
+
+				TestFindChar(stopwatch1, ssA, (char8_t)'b');
+				TestFindChar(stopwatch2, esA, (char8_t)'b');
+
+				if(i == 1)
+					Benchmark::AddResult("string<char8_t>/find/c", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+				TestFindChar(stopwatch1, ss32A, (char32_t)'b');
+				TestFindChar(stopwatch2, es32A, (char32_t)'b');
+
+				if(i == 1)
+					Benchmark::AddResult("string<char32_t>/find/c", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+				const int kFindSetSize = 16;
+				const char8_t pFindSet_8[kFindSetSize] = { 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q' };
+
+				TestFirstOf1(stopwatch1, ssA, pFindSet_8, 0, kFindSetSize);
+				TestFirstOf1(stopwatch2, esA, pFindSet_8, 0, kFindSetSize);
+
+				if(i == 1)
+					Benchmark::AddResult("string<char8_t>/find_first_of/large set", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+
+				const int kFindPeriodicSize = 16;
+				const char8_t pFindPeriodic_8[kFindPeriodicSize] = { 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'b', 'a', 'a', 'a', 'a', 'a', 'a', 'a' };
+
+				TestFind1(stopwatch1, ssA, pFindPeriodic_8, 0, kFindPeriodicSize);
+				TestFind1(stopwatch2, esA, pFindPeriodic_8, 0, kFindPeriodicSize);
+
+				if(i == 1)
+					Benchmark::AddResult("string<char8_t>/find/worst case", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime());
+			}
+
 			///////////////////////////////
 			// Test compare()
 			///////////////////////////////
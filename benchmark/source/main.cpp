@@ -155,6 +155,7 @@ int EAMain(int argc, char* argv[])
 	BenchmarkHash();
 	BenchmarkHeap();
 	BenchmarkBitset();
+	BenchmarkBitvector();
 	BenchmarkSort();
 
 	stopwatch.Stop();
@@ -0,0 +1,471 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements monotonic_arena, a linear (bump pointer) allocator
+// whose memory is released all at once, and arena_allocator, an EASTL
+// allocator which allocates from a monotonic_arena.
+//
+// Allocation from an arena is a pointer increment, and deallocation is a
+// no-op. The arena grows by chaining additional blocks obtained from its
+// backing allocator, each larger than the previous one. reset() makes all of
+// the arena's memory available again without returning it to the backing
+// allocator, which is what makes arenas a good fit for temporary containers
+// which are built up, used and thrown away as a group (e.g. per frame or per
+// request): the containers' memory is reclaimed in one step and no longer
+// touches the global heap once the arena has reached its working size.
+//
+// Example usage:
+//     eastl::monotonic_arena arena(16384);
+//
+//     for(;;)  // Per frame
+//     {
+//         eastl::vector<Widget, eastl::arena_allocator> widgets(eastl::arena_allocator(&arena));
+//         eastl::map<int, Widget*, eastl::less<int>, eastl::arena_allocator> widgetMap(eastl::arena_allocator(&arena));
+//         ...
+//
+//         // The containers must be destroyed (or simply never be used again) before resetting the arena.
+//     }
+//     arena.reset();
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_ARENA_ALLOCATOR_H
+#define EASTL_ARENA_ALLOCATOR_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/allocator.h>
+#include <stddef.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_ARENA_ALLOCATOR_DEFAULT_NAME
+//
+// Defines a default allocator name in the absence of a user-provided name.
+//
+#ifndef EASTL_ARENA_ALLOCATOR_DEFAULT_NAME
+	#define EASTL_ARENA_ALLOCATOR_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " arena_allocator" // Unless the user overrides something, this is "EASTL arena_allocator".
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_MONOTONIC_ARENA_DEFAULT_BLOCK_SIZE
+//
+// The size, in bytes, of the first block that a monotonic_arena allocates
+// when it isn't given one. Each subsequent block is twice as large as the
+// previous one, up to EASTL_MONOTONIC_ARENA_MAX_BLOCK_SIZE (though a single
+// large allocation can result in a larger block).
+//
+#ifndef EASTL_MONOTONIC_ARENA_DEFAULT_BLOCK_SIZE
+	#define EASTL_MONOTONIC_ARENA_DEFAULT_BLOCK_SIZE 4096
+#endif
+
+#ifndef EASTL_MONOTONIC_ARENA_MAX_BLOCK_SIZE
+	#define EASTL_MONOTONIC_ARENA_MAX_BLOCK_SIZE (1024 * 1024)
+#endif
+
+
+
+namespace eastl
+{
+
+	/// monotonic_arena
+	///
+	/// A chain of memory blocks which are handed out front to back. Memory
+	/// can't be freed individually; reset rewinds the arena to its first block
+	/// in constant time, keeping all of its blocks for reuse, while release
+	/// returns all blocks to the backing allocator.
+	///
+	/// The arena can start out with a user-supplied buffer (e.g. on the stack),
+	/// which it uses before allocating any blocks of its own. The buffer must
+	/// be large enough to hold the arena's small block header.
+	///
+	/// A monotonic_arena is not thread-safe.
+	///
+	class monotonic_arena
+	{
+	public:
+		typedef EASTLAllocatorType allocator_type;
+
+		explicit monotonic_arena(size_t initialBlockSize = EASTL_MONOTONIC_ARENA_DEFAULT_BLOCK_SIZE, const allocator_type& allocator = allocator_type(EASTL_NAME_VAL(EASTL_ARENA_ALLOCATOR_DEFAULT_NAME)));
+		monotonic_arena(void* pBuffer, size_t bufferSize, const allocator_type& allocator = allocator_type(EASTL_NAME_VAL(EASTL_ARENA_ALLOCATOR_DEFAULT_NAME)));
+	   ~monotonic_arena();
+
+		/// Returns memory for n bytes, such that (returned pointer + offset) is aligned to
+		/// alignment, which must be a power of two. Returns NULL if the backing allocator fails.
+		void* allocate(size_t n, size_t alignment = EASTL_ALLOCATOR_MIN_ALIGNMENT, size_t offset = 0);
+
+		/// Makes all of the arena's memory available again. Runs in constant time.
+		/// All memory previously allocated from the arena becomes invalid.
+		void reset();
+
+		/// Returns all blocks (other than the user-supplied buffer) to the backing allocator.
+		/// All memory previously allocated from the arena becomes invalid.
+		void release();
+
+		/// Returns the total size of the arena's blocks, including the user-supplied buffer.
+		size_t capacity() const;
+
+		/// Returns the number of bytes handed out since construction or the last reset/release, including alignment padding.
+		size_t size() const;
+
+		allocator_type&       get_allocator()       { return mAllocator; }
+		const allocator_type& get_allocator() const { return mAllocator; }
+
+	protected:
+		struct Block
+		{
+			Block* mpNext;  // Next block in the chain. Blocks after the current one are unused, left over from before the last reset.
+			size_t mnSize;  // Size of the block, including this header.
+			bool   mbOwned; // False for the user-supplied buffer.
+		};
+
+		enum { kBlockHeaderSize = (sizeof(Block) + EASTL_ALLOCATOR_MIN_ALIGNMENT - 1) & ~(EASTL_ALLOCATOR_MIN_ALIGNMENT - 1) };
+
+		char* BlockBegin(Block* pBlock) const
+			{ return (char*)pBlock + kBlockHeaderSize; }
+
+		char* BlockEnd(Block* pBlock) const
+			{ return (char*)pBlock + pBlock->mnSize; }
+
+		void* AllocateSlow(size_t n, size_t alignment, size_t offset);
+
+		Block*         mpFirstBlock;
+		Block*         mpCurrentBlock;
+		char*          mpCurrent;         // Next free byte in the current block.
+		char*          mpEnd;             // End of the current block.
+		size_t         mnSizeBeforeCurrent; // Bytes handed out from blocks before the current one.
+		size_t         mnNextBlockSize;
+		allocator_type mAllocator;
+
+	private:
+		monotonic_arena(const monotonic_arena&) = delete;
+		monotonic_arena& operator=(const monotonic_arena&) = delete;
+	};
+
+
+
+	/// arena_allocator
+	///
+	/// An EASTL allocator which allocates from a monotonic_arena. Deallocation
+	/// is a no-op; the memory is reclaimed when the arena is reset or released.
+	/// Copies of an arena_allocator share the same arena, and two arena_allocators
+	/// compare equal if they use the same arena.
+	///
+	/// A default-constructed arena_allocator has no arena; one must be assigned
+	/// via set_arena before the allocator is used to allocate.
+	///
+	class arena_allocator
+	{
+	public:
+		EASTL_ALLOCATOR_EXPLICIT arena_allocator(const char* pName = EASTL_NAME_VAL(EASTL_ARENA_ALLOCATOR_DEFAULT_NAME))
+			: mpArena(NULL)
+		{
+			#if EASTL_NAME_ENABLED
+				mpName = pName ? pName : EASTL_ARENA_ALLOCATOR_DEFAULT_NAME;
+			#else
+				EA_UNUSED(pName);
+			#endif
+		}
+
+		explicit arena_allocator(monotonic_arena* pArena, const char* pName = EASTL_NAME_VAL(EASTL_ARENA_ALLOCATOR_DEFAULT_NAME))
+			: mpArena(pArena)
+		{
+			#if EASTL_NAME_ENABLED
+				mpName = pName ? pName : EASTL_ARENA_ALLOCATOR_DEFAULT_NAME;
+			#else
+				EA_UNUSED(pName);
+			#endif
+		}
+
+		arena_allocator(const arena_allocator& x)
+			: mpArena(x.mpArena)
+		{
+			#if EASTL_NAME_ENABLED
+				mpName = x.mpName;
+			#endif
+		}
+
+		arena_allocator(const arena_allocator& x, const char* pName)
+			: mpArena(x.mpArena)
+		{
+			#if EASTL_NAME_ENABLED
+				mpName = pName ? pName : EASTL_ARENA_ALLOCATOR_DEFAULT_NAME;
+			#else
+				EA_UNUSED(pName);
+			#endif
+		}
+
+		arena_allocator& operator=(const arena_allocator& x)
+		{
+			mpArena = x.mpArena;
+			#if EASTL_NAME_ENABLED
+				mpName = x.mpName;
+			#endif
+			return *this;
+		}
+
+		void* allocate(size_t n, int /*flags*/ = 0)
+		{
+			EASTL_ASSERT(mpArena != NULL);
+			return mpArena->allocate(n);
+		}
+
+		void* allocate(size_t n, size_t alignment, size_t offset, int /*flags*/ = 0)
+		{
+			EASTL_ASSERT(mpArena != NULL);
+			return mpArena->allocate(n, alignment, offset);
+		}
+
+		void deallocate(void* /*p*/, size_t /*n*/)
+			{ }
+
+		monotonic_arena* get_arena() const
+			{ return mpArena; }
+
+		void set_arena(monotonic_arena* pArena)
+			{ mpArena = pArena; }
+
+		const char* get_name() const
+		{
+			#if EASTL_NAME_ENABLED
+				return mpName;
+			#else
+				return EASTL_ARENA_ALLOCATOR_DEFAULT_NAME;
+			#endif
+		}
+
+		void set_name(const char* pName)
+		{
+			#if EASTL_NAME_ENABLED
+				mpName = pName;
+			#else
+				EA_UNUSED(pName);
+			#endif
+		}
+
+	protected:
+		monotonic_arena* mpArena;
+
+		#if EASTL_NAME_ENABLED
+			const char* mpName; // Debug name, used to track memory.
+		#endif
+	};
+
+	inline bool operator==(const arena_allocator& a, const arena_allocator& b)
+		{ return (a.get_arena() == b.get_arena()); }
+
+	inline bool operator!=(const arena_allocator& a, const arena_allocator& b)
+		{ return (a.get_arena() != b.get_arena()); }
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// monotonic_arena
+	///////////////////////////////////////////////////////////////////////
+
+	inline monotonic_arena::monotonic_arena(size_t initialBlockSize, const allocator_type& allocator)
+		: mpFirstBlock(NULL),
+		  mpCurrentBlock(NULL),
+		  mpCurrent(NULL),
+		  mpEnd(NULL),
+		  mnSizeBeforeCurrent(0),
+		  mnNextBlockSize(initialBlockSize ? initialBlockSize : EASTL_MONOTONIC_ARENA_DEFAULT_BLOCK_SIZE),
+		  mAllocator(allocator)
+	{
+	}
+
+
+	inline monotonic_arena::monotonic_arena(void* pBuffer, size_t bufferSize, const allocator_type& allocator)
+		: mpFirstBlock(NULL),
+		  mpCurrentBlock(NULL),
+		  mpCurrent(NULL),
+		  mpEnd(NULL),
+		  mnSizeBeforeCurrent(0),
+		  mnNextBlockSize(EASTL_MONOTONIC_ARENA_DEFAULT_BLOCK_SIZE),
+		  mAllocator(allocator)
+	{
+		// Align the buffer so that the header and the data after it are aligned.
+		char* const pAligned = (char*)(((uintptr_t)pBuffer + EASTL_ALLOCATOR_MIN_ALIGNMENT - 1) & ~(uintptr_t)(EASTL_ALLOCATOR_MIN_ALIGNMENT - 1));
+		const size_t alignedSize = bufferSize - (size_t)(pAligned - (char*)pBuffer);
+
+		EASTL_ASSERT((bufferSize >= (size_t)(pAligned - (char*)pBuffer)) && (alignedSize >= (size_t)kBlockHeaderSize));
+
+		Block* const pBlock = (Block*)pAligned;
+		pBlock->mpNext  = NULL;
+		pBlock->mnSize  = alignedSize;
+		pBlock->mbOwned = false;
+
+		mpFirstBlock = mpCurrentBlock = pBlock;
+		mpCurrent    = BlockBegin(pBlock);
+		mpEnd        = BlockEnd(pBlock);
+
+		if(mnNextBlockSize < bufferSize)
+			mnNextBlockSize = bufferSize;
+	}
+
+
+	inline monotonic_arena::~monotonic_arena()
+	{
+		release();
+	}
+
+
+	inline void* monotonic_arena::allocate(size_t n, size_t alignment, size_t offset)
+	{
+		EASTL_ASSERT((alignment & (alignment - 1)) == 0);
+
+		char* const p = (char*)((((uintptr_t)mpCurrent + offset + alignment - 1) & ~(uintptr_t)(alignment - 1)) - offset);
+
+		if(EASTL_LIKELY(mpCurrent && (p >= mpCurrent) && (p <= mpEnd) && ((size_t)(mpEnd - p) >= n)))
+		{
+			mpCurrent = p + n;
+			return p;
+		}
+
+		return AllocateSlow(n, alignment, offset);
+	}
+
+
+	inline void* monotonic_arena::AllocateSlow(size_t n, size_t alignment, size_t offset)
+	{
+		if(mpCurrentBlock)
+			mnSizeBeforeCurrent += (size_t)(mpCurrent - BlockBegin(mpCurrentBlock));
+
+		// The worst case space that the request needs in a fresh block.
+		const size_t required = n + offset + alignment + (size_t)kBlockHeaderSize;
+
+		// Reuse a block left over from before the last reset, if one is large enough.
+		// Blocks which are too small are skipped but kept in the chain.
+		Block* pBlock = mpCurrentBlock ? mpCurrentBlock->mpNext : mpFirstBlock;
+
+		while(pBlock && (pBlock->mnSize < required))
+			pBlock = pBlock->mpNext;
+
+		if(!pBlock)
+		{
+			size_t blockSize = mnNextBlockSize;
+
+			if(blockSize < required)
+				blockSize = required;
+
+			pBlock = (Block*)EASTLAlloc(mAllocator, blockSize)
+
+			if(!pBlock)
+				return NULL;
+
+			pBlock->mnSize  = blockSize;
+			pBlock->mbOwned = true;
+
+			// Insert the new block after the current one, ahead of any unused blocks.
+			if(mpCurrentBlock)
+			{
+				pBlock->mpNext = mpCurrentBlock->mpNext;
+				mpCurrentBlock->mpNext = pBlock;
+			}
+			else
+			{
+				pBlock->mpNext = mpFirstBlock;
+				mpFirstBlock = pBlock;
+			}
+
+			if(mnNextBlockSize < EASTL_MONOTONIC_ARENA_MAX_BLOCK_SIZE)
+			{
+				mnNextBlockSize *= 2;
+				if(mnNextBlockSize > EASTL_MONOTONIC_ARENA_MAX_BLOCK_SIZE)
+					mnNextBlockSize = EASTL_MONOTONIC_ARENA_MAX_BLOCK_SIZE;
+			}
+		}
+		else if(mpCurrentBlock && (mpCurrentBlock->mpNext != pBlock))
+		{
+			// Move the reused block up to directly after the current one, so that the blocks
+			// which were skipped remain available after it.
+			Block* pPrev = mpCurrentBlock;
+			while(pPrev->mpNext != pBlock)
+				pPrev = pPrev->mpNext;
+
+			pPrev->mpNext = pBlock->mpNext;
+			pBlock->mpNext = mpCurrentBlock->mpNext;
+			mpCurrentBlock->mpNext = pBlock;
+		}
+		else if(!mpCurrentBlock && (mpFirstBlock != pBlock))
+		{
+			Block* pPrev = mpFirstBlock;
+			while(pPrev->mpNext != pBlock)
+				pPrev = pPrev->mpNext;
+
+			pPrev->mpNext = pBlock->mpNext;
+			pBlock->mpNext = mpFirstBlock;
+			mpFirstBlock = pBlock;
+		}
+
+		mpCurrentBlock = pBlock;
+		mpEnd          = BlockEnd(pBlock);
+
+		char* const p = (char*)((((uintptr_t)BlockBegin(pBlock) + offset + alignment - 1) & ~(uintptr_t)(alignment - 1)) - offset);
+		mpCurrent = p + n;
+		return p;
+	}
+
+
+	inline void monotonic_arena::reset()
+	{
+		// mpCurrentBlock is set to NULL rather than to the first block so that the next
+		// allocation starts with the first block via AllocateSlow, which reuses the chain.
+		mpCurrentBlock      = NULL;
+		mpCurrent           = NULL;
+		mpEnd               = NULL;
+		mnSizeBeforeCurrent = 0;
+	}
+
+
+	inline void monotonic_arena::release()
+	{
+		Block* pUserBlock = NULL;
+
+		for(Block* pBlock = mpFirstBlock; pBlock; )
+		{
+			Block* const pNext = pBlock->mpNext;
+
+			if(pBlock->mbOwned)
+				EASTLFree(mAllocator, pBlock, pBlock->mnSize);
+			else
+				pUserBlock = pBlock;
+
+			pBlock = pNext;
+		}
+
+		if(pUserBlock)
+			pUserBlock->mpNext = NULL;
+
+		mpFirstBlock = pUserBlock;
+		reset();
+	}
+
+
+	inline size_t monotonic_arena::capacity() const
+	{
+		size_t result = 0;
+
+		for(Block* pBlock = mpFirstBlock; pBlock; pBlock = pBlock->mpNext)
+			result += pBlock->mnSize - (size_t)kBlockHeaderSize;
+
+		return result;
+	}
+
+
+	inline size_t monotonic_arena::size() const
+	{
+		return mnSizeBeforeCurrent + (mpCurrentBlock ? (size_t)(mpCurrent - BlockBegin(mpCurrentBlock)) : 0);
+	}
+
+} // namespace eastl
+
+
+#endif // Header include guard
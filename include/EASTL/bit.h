@@ -0,0 +1,260 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements bit scanning and counting functions that are similar
+// to the C++20 <bit> header functions (countl_zero, countr_zero, popcount,
+// has_single_bit, bit_ceil, bit_floor, bit_width). They are implemented via
+// compiler intrinsics where available (which compile to single tzcnt/lzcnt/
+// bsf/bsr/popcnt instructions on most modern hardware) and portable fallbacks
+// otherwise. These are the primitives that EASTL containers such as bitset,
+// bitvector and the flat hash tables use for their word-at-a-time scanning.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_BIT_H
+#define EASTL_BIT_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/type_traits.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <intrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+	namespace Internal
+	{
+		// countr_zero64 / countl_zero64 / popcount64
+		//
+		// Implementations for non-zero (where noted) 32 and 64 bit words. The public
+		// templated functions below handle zero input and narrower integer types.
+		//
+		inline int countr_zero32_nonzero(uint32_t x)
+		{
+			#if defined(__GNUC__) || defined(__clang__)
+				return __builtin_ctz(x);
+			#elif defined(_MSC_VER)
+				unsigned long index;
+				_BitScanForward(&index, x);
+				return (int)index;
+			#else
+				int n = 1;
+				if((x & 0x0000FFFF) == 0) { n += 16; x >>= 16; }
+				if((x & 0x000000FF) == 0) { n +=  8; x >>=  8; }
+				if((x & 0x0000000F) == 0) { n +=  4; x >>=  4; }
+				if((x & 0x00000003) == 0) { n +=  2; x >>=  2; }
+				return n - (int)(x & 1);
+			#endif
+		}
+
+		inline int countr_zero64_nonzero(uint64_t x)
+		{
+			#if defined(__GNUC__) || defined(__clang__)
+				return __builtin_ctzll(x);
+			#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+				unsigned long index;
+				_BitScanForward64(&index, x);
+				return (int)index;
+			#else
+				const uint32_t lo = (uint32_t)x;
+				return lo ? countr_zero32_nonzero(lo) : (32 + countr_zero32_nonzero((uint32_t)(x >> 32)));
+			#endif
+		}
+
+		inline int countl_zero32_nonzero(uint32_t x)
+		{
+			#if defined(__GNUC__) || defined(__clang__)
+				return __builtin_clz(x);
+			#elif defined(_MSC_VER)
+				unsigned long index;
+				_BitScanReverse(&index, x);
+				return 31 - (int)index;
+			#else
+				int n = 0;
+				if(x <= 0x0000FFFF) { n += 16; x <<= 16; }
+				if(x <= 0x00FFFFFF) { n +=  8; x <<=  8; }
+				if(x <= 0x0FFFFFFF) { n +=  4; x <<=  4; }
+				if(x <= 0x3FFFFFFF) { n +=  2; x <<=  2; }
+				if(x <= 0x7FFFFFFF) { n +=  1;           }
+				return n;
+			#endif
+		}
+
+		inline int countl_zero64_nonzero(uint64_t x)
+		{
+			#if defined(__GNUC__) || defined(__clang__)
+				return __builtin_clzll(x);
+			#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+				unsigned long index;
+				_BitScanReverse64(&index, x);
+				return 63 - (int)index;
+			#else
+				const uint32_t hi = (uint32_t)(x >> 32);
+				return hi ? countl_zero32_nonzero(hi) : (32 + countl_zero32_nonzero((uint32_t)x));
+			#endif
+		}
+
+		inline int popcount32(uint32_t x)
+		{
+			#if defined(__GNUC__) || defined(__clang__)
+				return __builtin_popcount(x);
+			#else
+				x = x - ((x >> 1) & 0x55555555u);
+				x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+				x = (x + (x >> 4)) & 0x0F0F0F0Fu;
+				return (int)((x * 0x01010101u) >> 24);
+			#endif
+		}
+
+		inline int popcount64(uint64_t x)
+		{
+			#if defined(__GNUC__) || defined(__clang__)
+				return __builtin_popcountll(x);
+			#else
+				x = x - ((x >> 1) & UINT64_C(0x5555555555555555));
+				x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+				x = (x + (x >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+				return (int)((x * UINT64_C(0x0101010101010101)) >> 56);
+			#endif
+		}
+
+		template <typename T>
+		struct is_bit_scannable : public eastl::integral_constant<bool, eastl::is_unsigned<T>::value && !eastl::is_same<T, bool>::value && (sizeof(T) <= 8)> {};
+	}
+
+
+	/// countr_zero
+	///
+	/// Returns the number of consecutive 0 bits in x, starting from the least
+	/// significant bit. Returns the bit width of T if x is zero.
+	///
+	/// Example usage:
+	///     countr_zero(uint32_t(0x00000008)); // returns 3
+	///
+	template <typename T>
+	inline typename eastl::enable_if<Internal::is_bit_scannable<T>::value, int>::type
+	countr_zero(T x) EA_NOEXCEPT
+	{
+		if(x == 0)
+			return (int)(sizeof(T) * 8);
+		return (sizeof(T) <= 4) ? Internal::countr_zero32_nonzero((uint32_t)x) : Internal::countr_zero64_nonzero((uint64_t)x);
+	}
+
+
+	/// countl_zero
+	///
+	/// Returns the number of consecutive 0 bits in x, starting from the most
+	/// significant bit. Returns the bit width of T if x is zero.
+	///
+	/// Example usage:
+	///     countl_zero(uint32_t(0x00F00000)); // returns 8
+	///
+	template <typename T>
+	inline typename eastl::enable_if<Internal::is_bit_scannable<T>::value, int>::type
+	countl_zero(T x) EA_NOEXCEPT
+	{
+		if(x == 0)
+			return (int)(sizeof(T) * 8);
+		if(sizeof(T) <= 4)
+			return Internal::countl_zero32_nonzero((uint32_t)x) - (int)((4 - sizeof(T)) * 8);
+		return Internal::countl_zero64_nonzero((uint64_t)x);
+	}
+
+
+	/// countr_one / countl_one
+	///
+	/// Returns the number of consecutive 1 bits in x, starting from the least
+	/// (countr_one) or most (countl_one) significant bit.
+	///
+	template <typename T>
+	inline typename eastl::enable_if<Internal::is_bit_scannable<T>::value, int>::type
+	countr_one(T x) EA_NOEXCEPT
+		{ return eastl::countr_zero((T)~x); }
+
+	template <typename T>
+	inline typename eastl::enable_if<Internal::is_bit_scannable<T>::value, int>::type
+	countl_one(T x) EA_NOEXCEPT
+		{ return eastl::countl_zero((T)~x); }
+
+
+	/// popcount
+	///
+	/// Returns the number of 1 bits in x.
+	///
+	template <typename T>
+	inline typename eastl::enable_if<Internal::is_bit_scannable<T>::value, int>::type
+	popcount(T x) EA_NOEXCEPT
+	{
+		return (sizeof(T) <= 4) ? Internal::popcount32((uint32_t)x) : Internal::popcount64((uint64_t)x);
+	}
+
+
+	/// has_single_bit
+	///
+	/// Returns true if x is an integral power of two.
+	///
+	template <typename T>
+	inline EA_CONSTEXPR typename eastl::enable_if<Internal::is_bit_scannable<T>::value, bool>::type
+	has_single_bit(T x) EA_NOEXCEPT
+	{
+		return (x != 0) && ((x & (x - 1)) == 0);
+	}
+
+
+	/// bit_width
+	///
+	/// Returns the number of bits needed to represent x; zero if x is zero.
+	///
+	template <typename T>
+	inline typename eastl::enable_if<Internal::is_bit_scannable<T>::value, T>::type
+	bit_width(T x) EA_NOEXCEPT
+	{
+		return (T)((sizeof(T) * 8) - (size_t)eastl::countl_zero(x));
+	}
+
+
+	/// bit_ceil
+	///
+	/// Returns the smallest integral power of two that is not smaller than x.
+	/// The result is undefined if it is not representable in T.
+	///
+	template <typename T>
+	inline typename eastl::enable_if<Internal::is_bit_scannable<T>::value, T>::type
+	bit_ceil(T x) EA_NOEXCEPT
+	{
+		if(x <= 1)
+			return T(1);
+		return (T)(T(1) << eastl::bit_width((T)(x - 1)));
+	}
+
+
+	/// bit_floor
+	///
+	/// Returns the largest integral power of two that is not greater than x,
+	/// or zero if x is zero.
+	///
+	template <typename T>
+	inline typename eastl::enable_if<Internal::is_bit_scannable<T>::value, T>::type
+	bit_floor(T x) EA_NOEXCEPT
+	{
+		if(x == 0)
+			return T(0);
+		return (T)(T(1) << (eastl::bit_width(x) - 1));
+	}
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -25,7 +25,9 @@
 
 
 #include <EASTL/internal/config.h>
+#include <EASTL/internal/bit_words.h>
 #include <EASTL/algorithm.h>
+#include <EASTL/bit.h>
 
 #ifdef _MSC_VER
 	#pragma warning(push, 0)
@@ -434,6 +436,11 @@ namespace eastl
 		// Finds the index of the last "on" bit before last_find, returns kSize if none are set.
 		size_type find_prev(size_type last_find) const;
 
+		// Calls f(i) with the index of each "on" bit, in increasing order. This is faster than
+		// a find_first/find_next loop, as it visits each word once and skips runs of zero words.
+		template <typename Function>
+		void for_each_set_bit(Function f) const;
+
 	}; // bitset
 
 
@@ -488,186 +495,74 @@ namespace eastl
 	#define EASTL_BITSET_COUNT_STRING "\0\1\1\2\1\2\2\3\1\2\2\3\2\3\3\4"
 
 
+	/// GetFirstBit
+	///
+	/// Returns the index of the lowest set bit in x, or the bit width of x if x is zero.
+	///
 	inline uint32_t GetFirstBit(uint8_t x)
 	{
-		if(x)
-		{
-			uint32_t n = 1;
-
-			if((x & 0x0000000F) == 0) { n +=  4; x >>=  4; }
-			if((x & 0x00000003) == 0) { n +=  2; x >>=  2; }
-
-			return (uint32_t)(n - (x & 1));
-		}
-
-		return 8;
+		return (uint32_t)eastl::countr_zero(x);
 	}
 
-	inline uint32_t GetFirstBit(uint16_t x) // To do: Update this to use VC++ _BitScanForward, _BitScanForward64; GCC __builtin_ctz, __builtin_ctzl. VC++ __lzcnt16, __lzcnt, __lzcnt64 requires recent CPUs (2013+) and probably can't be used. http://en.wikipedia.org/wiki/Haswell_%28microarchitecture%29#New_features
+	inline uint32_t GetFirstBit(uint16_t x)
 	{
-		if(x)
-		{
-			uint32_t n = 1;
-
-			if((x & 0x000000FF) == 0) { n +=  8; x >>=  8; }
-			if((x & 0x0000000F) == 0) { n +=  4; x >>=  4; }
-			if((x & 0x00000003) == 0) { n +=  2; x >>=  2; }
-
-			return (uint32_t)(n - (x & 1));
-		}
-
-		return 16;
+		return (uint32_t)eastl::countr_zero(x);
 	}
 
 	inline uint32_t GetFirstBit(uint32_t x)
 	{
-		if(x)
-		{
-			uint32_t n = 1;
-
-			if((x & 0x0000FFFF) == 0) { n += 16; x >>= 16; }
-			if((x & 0x000000FF) == 0) { n +=  8; x >>=  8; }
-			if((x & 0x0000000F) == 0) { n +=  4; x >>=  4; }
-			if((x & 0x00000003) == 0) { n +=  2; x >>=  2; }
-
-			return (n - (x & 1));
-		}
-
-		return 32;
+		return (uint32_t)eastl::countr_zero(x);
 	}
 
 	inline uint32_t GetFirstBit(uint64_t x)
 	{
-		if(x)
-		{
-			uint32_t n = 1;
-
-			if((x & 0xFFFFFFFF) == 0) { n += 32; x >>= 32; }
-			if((x & 0x0000FFFF) == 0) { n += 16; x >>= 16; }
-			if((x & 0x000000FF) == 0) { n +=  8; x >>=  8; }
-			if((x & 0x0000000F) == 0) { n +=  4; x >>=  4; }
-			if((x & 0x00000003) == 0) { n +=  2; x >>=  2; }
-
-			return (n - ((uint32_t)x & 1));
-		}
-
-		return 64;
+		return (uint32_t)eastl::countr_zero(x);
 	}
 
-
 	#if EASTL_INT128_SUPPORTED
 		inline uint32_t GetFirstBit(eastl_uint128_t x)
 		{
-			if(x)
-			{
-				uint32_t n = 1;
-
-				if((x & UINT64_C(0xFFFFFFFFFFFFFFFF)) == 0) { n += 64; x >>= 64; }
-				if((x & 0xFFFFFFFF) == 0)                   { n += 32; x >>= 32; }
-				if((x & 0x0000FFFF) == 0)                   { n += 16; x >>= 16; }
-				if((x & 0x000000FF) == 0)                   { n +=  8; x >>=  8; }
-				if((x & 0x0000000F) == 0)                   { n +=  4; x >>=  4; }
-				if((x & 0x00000003) == 0)                   { n +=  2; x >>=  2; }
+			const uint64_t lo = (uint64_t)x;
 
-				return (n - ((uint32_t)x & 1));
-			}
-
-			return 128;
+			if(lo)
+				return (uint32_t)eastl::countr_zero(lo);
+			return 64 + (uint32_t)eastl::countr_zero((uint64_t)(x >> 64)); // Returns 128 if x is zero.
 		}
 	#endif
 
+
+	/// GetLastBit
+	///
+	/// Returns the index of the highest set bit in x, or the bit width of x if x is zero.
+	///
 	inline uint32_t GetLastBit(uint8_t x)
 	{
-		if(x)
-		{
-			uint32_t n = 0;
-
-			if(x & 0xFFF0) { n +=  4; x >>=  4; }
-			if(x & 0xFFFC) { n +=  2; x >>=  2; }
-			if(x & 0xFFFE) { n +=  1;           }
-
-			return n;
-		}
-
-		return 8;
+		return x ? (uint32_t)(7 - eastl::countl_zero(x)) : 8;
 	}
 
 	inline uint32_t GetLastBit(uint16_t x)
 	{
-		if(x)
-		{
-			uint32_t n = 0;
-
-			if(x & 0xFF00) { n +=  8; x >>=  8; }
-			if(x & 0xFFF0) { n +=  4; x >>=  4; }
-			if(x & 0xFFFC) { n +=  2; x >>=  2; }
-			if(x & 0xFFFE) { n +=  1;           }
-
-			return n;
-		}
-
-		return 16;
+		return x ? (uint32_t)(15 - eastl::countl_zero(x)) : 16;
 	}
 
 	inline uint32_t GetLastBit(uint32_t x)
 	{
-		if(x)
-		{
-			uint32_t n = 0;
-
-			if(x & 0xFFFF0000) { n += 16; x >>= 16; }
-			if(x & 0xFFFFFF00) { n +=  8; x >>=  8; }
-			if(x & 0xFFFFFFF0) { n +=  4; x >>=  4; }
-			if(x & 0xFFFFFFFC) { n +=  2; x >>=  2; }
-			if(x & 0xFFFFFFFE) { n +=  1;           }
-
-			return n;
-		}
-
-		return 32;
+		return x ? (uint32_t)(31 - eastl::countl_zero(x)) : 32;
 	}
 
 	inline uint32_t GetLastBit(uint64_t x)
 	{
-		if(x)
-		{
-			uint32_t n = 0;
-
-			if(x & UINT64_C(0xFFFFFFFF00000000)) { n += 32; x >>= 32; }
-			if(x & 0xFFFF0000)                   { n += 16; x >>= 16; }
-			if(x & 0xFFFFFF00)                   { n +=  8; x >>=  8; }
-			if(x & 0xFFFFFFF0)                   { n +=  4; x >>=  4; }
-			if(x & 0xFFFFFFFC)                   { n +=  2; x >>=  2; }
-			if(x & 0xFFFFFFFE)                   { n +=  1;           }
-
-			return n;
-		}
-
-		return 64;
+		return x ? (uint32_t)(63 - eastl::countl_zero(x)) : 64;
 	}
 
 	#if EASTL_INT128_SUPPORTED
 		inline uint32_t GetLastBit(eastl_uint128_t x)
 		{
-			if(x)
-			{
-				uint32_t n = 0;
-				
-				eastl_uint128_t mask(UINT64_C(0xFFFFFFFF00000000)); // There doesn't seem to exist compiler support for INT128_C() by any compiler. EAStdC's int128_t supports it though.
-				mask <<= 64;
-
-				if(x & mask)                         { n += 64; x >>= 64; }
-				if(x & UINT64_C(0xFFFFFFFF00000000)) { n += 32; x >>= 32; }
-				if(x & UINT64_C(0x00000000FFFF0000)) { n += 16; x >>= 16; }
-				if(x & UINT64_C(0x00000000FFFFFF00)) { n +=  8; x >>=  8; }
-				if(x & UINT64_C(0x00000000FFFFFFF0)) { n +=  4; x >>=  4; }
-				if(x & UINT64_C(0x00000000FFFFFFFC)) { n +=  2; x >>=  2; }
-				if(x & UINT64_C(0x00000000FFFFFFFE)) { n +=  1;           }
-
-				return n;
-			}
+			const uint64_t hi = (uint64_t)(x >> 64);
 
-			return 128;
+			if(hi)
+				return 64 + GetLastBit(hi);
+			return x ? GetLastBit((uint64_t)x) : 128;
 		}
 	#endif
 
@@ -862,30 +757,7 @@ namespace eastl
 	inline typename BitsetBase<NW, WordType>::size_type
 	BitsetBase<NW, WordType>::count() const
 	{
-		size_type n = 0;
-
-		for(size_t i = 0; i < NW; i++)
-		{
-			#if defined(__GNUC__) && (((__GNUC__ * 100) + __GNUC_MINOR__) >= 304) && !defined(EA_PLATFORM_ANDROID) // GCC 3.4 or later
-				#if(EA_PLATFORM_WORD_SIZE == 4)
-					n += (size_type)__builtin_popcountl(mWord[i]);
-				#else
-					n += (size_type)__builtin_popcountll(mWord[i]);
-				#endif
-			#elif defined(__GNUC__) && (__GNUC__ < 3)
-				n +=  BitsetCountBits(mWord[i]); // GCC 2.x compiler inexplicably blows up on the code below.
-			#else
-				// todo: use __popcnt16, __popcnt, __popcnt64 for msvc builds
-				// https://msdn.microsoft.com/en-us/library/bb385231(v=vs.140).aspx
-				for(word_type w = mWord[i]; w; w >>= 4)
-					n += EASTL_BITSET_COUNT_STRING[w & 0xF];
-
-				// Version which seems to run slower in benchmarks:
-				// n +=  BitsetCountBits(mWord[i]);
-			#endif
-
-		}
-		return n;
+		return (size_type)Internal::BitWordsCount(mWord, NW);
 	}
 
 
@@ -992,13 +864,10 @@ namespace eastl
 	inline typename BitsetBase<NW, WordType>::size_type 
 	BitsetBase<NW, WordType>::DoFindFirst() const
 	{
-		for(size_type word_index = 0; word_index < NW; ++word_index)
-		{
-			const size_type fbiw = GetFirstBit(mWord[word_index]);
+		const size_type word_index = (size_type)Internal::BitWordsFind<true>(mWord, 0, NW);
 
-			if(fbiw != kBitsPerWord)
-				return (word_index * kBitsPerWord) + fbiw;
-		}
+		if(word_index < NW)
+			return (word_index * kBitsPerWord) + GetFirstBit(mWord[word_index]);
 
 		return (size_type)NW * kBitsPerWord;
 	}
@@ -1019,24 +888,18 @@ EA_DISABLE_GCC_WARNING(-Warray-bounds)
 		size_type word_index = static_cast<size_type>(last_find >> kBitsPerWordShift);
 		size_type bit_index  = static_cast<size_type>(last_find  & kBitsPerWordMask);
 
-		// To do: There probably is a more elegant way to write looping below.
 		if(word_index < NW)
 		{
 			// Mask off previous bits of the word so our search becomes a "find first".
-			word_type this_word = mWord[word_index] & (~static_cast<word_type>(0) << bit_index);
+			const word_type this_word = mWord[word_index] & (static_cast<word_type>(~static_cast<word_type>(0)) << bit_index);
 
-			for(;;)
-			{
-				const size_type fbiw = GetFirstBit(this_word);
+			if(this_word)
+				return (word_index * kBitsPerWord) + GetFirstBit(this_word);
 
-				if(fbiw != kBitsPerWord)
-					return (word_index * kBitsPerWord) + fbiw;
+			word_index = (size_type)Internal::BitWordsFind<true>(mWord, word_index + 1, NW);
 
-				if(++word_index < NW)
-					this_word = mWord[word_index];
-				else
-					break;
-			}
+			if(word_index < NW)
+				return (word_index * kBitsPerWord) + GetFirstBit(mWord[word_index]);
 		}
 
 		return (size_type)NW * kBitsPerWord;
@@ -1052,13 +915,10 @@ EA_RESTORE_GCC_WARNING()
 	inline typename BitsetBase<NW, WordType>::size_type 
 	BitsetBase<NW, WordType>::DoFindLast() const
 	{
-		for(size_type word_index = (size_type)NW; word_index > 0; --word_index)
-		{
-			const size_type lbiw = GetLastBit(mWord[word_index - 1]);
+		const size_type word_end = (size_type)Internal::BitWordsFindReverse<true>(mWord, 0, NW);
 
-			if(lbiw != kBitsPerWord)
-				return ((word_index - 1) * kBitsPerWord) + lbiw;
-		}
+		if(word_end > 0)
+			return ((word_end - 1) * kBitsPerWord) + GetLastBit(mWord[word_end - 1]);
 
 		return (size_type)NW * kBitsPerWord;
 	}
@@ -1075,21 +935,16 @@ EA_RESTORE_GCC_WARNING()
 			size_type bit_index  = static_cast<size_type>(last_find  & kBitsPerWordMask);
 
 			// Mask off subsequent bits of the word so our search becomes a "find last".
-			word_type mask      = (~static_cast<word_type>(0) >> (kBitsPerWord - 1 - bit_index)) >> 1; // We do two shifts here because many CPUs ignore requests to shift 32 bit integers by 32 bits, which could be the case above.
-			word_type this_word = mWord[word_index] & mask;
+			const word_type mask      = (static_cast<word_type>(~static_cast<word_type>(0)) >> (kBitsPerWord - 1 - bit_index)) >> 1; // We do two shifts here because many CPUs ignore requests to shift 32 bit integers by 32 bits, which could be the case above.
+			const word_type this_word = mWord[word_index] & mask;
 
-			for(;;)
-			{
-				const size_type lbiw = GetLastBit(this_word);
+			if(this_word)
+				return (word_index * kBitsPerWord) + GetLastBit(this_word);
 
-				if(lbiw != kBitsPerWord)
-					return (word_index * kBitsPerWord) + lbiw;
+			const size_type word_end = (size_type)Internal::BitWordsFindReverse<true>(mWord, 0, word_index);
 
-				if(word_index > 0)
-					this_word = mWord[--word_index];
-				else
-					break;
-			}
+			if(word_end > 0)
+				return ((word_end - 1) * kBitsPerWord) + GetLastBit(mWord[word_end - 1]);
 		}
 
 		return (size_type)NW * kBitsPerWord;
@@ -1219,20 +1074,7 @@ EA_RESTORE_GCC_WARNING()
 	inline typename BitsetBase<1, WordType>::size_type
 	BitsetBase<1, WordType>::count() const
 	{
-		#if defined(__GNUC__) && (((__GNUC__ * 100) + __GNUC_MINOR__) >= 304) && !defined(EA_PLATFORM_ANDROID) // GCC 3.4 or later
-			#if(EA_PLATFORM_WORD_SIZE == 4)
-				return (size_type)__builtin_popcountl(mWord[0]);
-			#else
-				return (size_type)__builtin_popcountll(mWord[0]);
-			#endif
-		#elif defined(__GNUC__) && (__GNUC__ < 3)
-			return BitsetCountBits(mWord[0]); // GCC 2.x compiler inexplicably blows up on the code below.
-		#else
-			size_type n = 0;
-			for(word_type w = mWord[0]; w; w >>= 4)
-				n += EASTL_BITSET_COUNT_STRING[w & 0xF];
-			return n;
-		#endif
+		return (size_type)GetBitCount(mWord[0]);
 	}
 
 
@@ -1348,7 +1190,7 @@ EA_RESTORE_GCC_WARNING()
 		if(last_find > 0)
 		{
 			// Mask off previous bits of word so our search becomes a "find first".
-			const word_type this_word = mWord[0] & ((~static_cast<word_type>(0)) >> (kBitsPerWord - last_find));
+			const word_type this_word = mWord[0] & (static_cast<word_type>(~static_cast<word_type>(0)) >> (kBitsPerWord - last_find));
 
 			return GetLastBit(this_word);
 		}
@@ -1512,16 +1354,7 @@ EA_RESTORE_GCC_WARNING()
 	inline typename BitsetBase<2, WordType>::size_type
 	BitsetBase<2, WordType>::count() const
 	{
-		#if defined(__GNUC__) && (((__GNUC__ * 100) + __GNUC_MINOR__) >= 304) // GCC 3.4 or later
-			#if(EA_PLATFORM_WORD_SIZE == 4)
-				return (size_type)__builtin_popcountl(mWord[0])  + (size_type)__builtin_popcountl(mWord[1]);
-			#else
-				return (size_type)__builtin_popcountll(mWord[0]) + (size_type)__builtin_popcountll(mWord[1]);
-			#endif
-
-		#else
-			return BitsetCountBits(mWord[0]) + BitsetCountBits(mWord[1]);
-		#endif
+		return (size_type)GetBitCount(mWord[0]) + (size_type)GetBitCount(mWord[1]);
 	}
 
 
@@ -1696,7 +1529,7 @@ EA_RESTORE_GCC_WARNING()
 			last_find -= kBitsPerWord;
 
 			// Mask off previous bits of word so our search becomes a "find first".
-			word_type this_word = mWord[1] & ((~static_cast<word_type>(0)) >> (kBitsPerWord - last_find));
+			word_type this_word = mWord[1] & (static_cast<word_type>(~static_cast<word_type>(0)) >> (kBitsPerWord - last_find));
 
 			// Step through words.
 			size_type lbiw = GetLastBit(this_word);
@@ -1712,7 +1545,7 @@ EA_RESTORE_GCC_WARNING()
 		else if(last_find != 0)
 		{
 			// Mask off previous bits of word so our search becomes a "find first".
-			word_type this_word = mWord[0] & ((~static_cast<word_type>(0)) >> (kBitsPerWord - last_find));
+			word_type this_word = mWord[0] & (static_cast<word_type>(~static_cast<word_type>(0)) >> (kBitsPerWord - last_find));
 
 			const size_type lbiw = GetLastBit(this_word);
 
@@ -2205,6 +2038,22 @@ EA_RESTORE_GCC_WARNING()
 
 
 
+	template <size_t N, typename WordType>
+	template <typename Function>
+	inline void bitset<N, WordType>::for_each_set_bit(Function f) const
+	{
+		for(size_type word_index = (size_type)Internal::BitWordsFind<true>(mWord, 0, kWordCount); word_index < kWordCount;
+		    word_index = (size_type)Internal::BitWordsFind<true>(mWord, word_index + 1, kWordCount))
+		{
+			const size_type word_bit_index = word_index * kBitsPerWord;
+
+			for(word_type w = mWord[word_index]; w; w &= (word_type)(w - 1)) // w & (w - 1) clears the lowest "on" bit.
+				f(word_bit_index + GetFirstBit(w));
+		}
+	}
+
+
+
 	///////////////////////////////////////////////////////////////////////////
 	// global operators
 	///////////////////////////////////////////////////////////////////////////
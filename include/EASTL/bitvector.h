@@ -21,6 +21,7 @@
 #include <EASTL/vector.h>
 #include <EASTL/algorithm.h>
 #include <EASTL/bitset.h>
+#include <EASTL/internal/bit_words.h>
 
 #ifdef _MSC_VER
 	#pragma warning(push)
@@ -297,18 +298,28 @@ namespace eastl
 		reference       operator[](size_type n);            // behavior is undefined if n is invalid.
 		const_reference operator[](size_type n) const;
 
-		/*
-		Work in progress:
+		// The find functions return end() if there is no such bit. They search a word at a time, 
+		// skipping whole blocks of words which have no bit equal to value (see internal/bit_words.h).
 		template <bool value = true> iterator find_first();                                 // Finds the lowest "on" bit.
 		template <bool value = true> iterator find_next(const_iterator it);                 // Finds the next lowest "on" bit after it.
-		template <bool value = true> iterator find_last();                                  // Finds the index of the last "on" bit, returns size if none are set.
-		template <bool value = true> iterator find_prev(const_iterator it);                 // Finds the index of the last "on" bit before last_find, returns size if none are set.
+		template <bool value = true> iterator find_last();                                  // Finds the last "on" bit.
+		template <bool value = true> iterator find_prev(const_iterator it);                 // Finds the last "on" bit before it.
 
 		template <bool value = true> const_iterator find_first() const;                     // Finds the lowest "on" bit.
 		template <bool value = true> const_iterator find_next(const_iterator it) const;     // Finds the next lowest "on" bit after it.
-		template <bool value = true> const_iterator find_last() const;                      // Finds the index of the last "on" bit, returns size if none are set.
-		template <bool value = true> const_iterator find_prev(const_iterator it) const;     // Finds the index of the last "on" bit before last_find, returns size if none are set.
-		*/
+		template <bool value = true> const_iterator find_last() const;                      // Finds the last "on" bit.
+		template <bool value = true> const_iterator find_prev(const_iterator it) const;     // Finds the last "on" bit before it.
+
+		size_type count() const;    // Returns the number of "on" bits.
+		bool      any() const;      // Returns true if any bit is "on".
+		bool      all() const;      // Returns true if every bit is "on". Returns true if the bitvector is empty.
+		bool      none() const;     // Returns true if no bit is "on".
+
+		// These require x to be the same size as this bitvector.
+		bitvector& operator&=(const bitvector& x);
+		bitvector& operator|=(const bitvector& x);
+		bitvector& operator^=(const bitvector& x);
+		bitvector& and_not(const bitvector& x);             // Turns off each bit which is "on" in x, i.e. *this &= ~x.
 
 		element_type*       data() EA_NOEXCEPT;
 		const element_type* data() const EA_NOEXCEPT;
@@ -333,6 +344,17 @@ namespace eastl
 
 		bool validate() const;
 		int  validate_iterator(const_iterator i) const;
+
+	protected:
+		typedef typename eastl::make_unsigned<element_type>::type word_type; // The word kernels and bit functions want an unsigned type.
+
+		const word_type* GetWords() const { return reinterpret_cast<const word_type*>(mContainer.data()); }
+
+		template <bool value> size_type DoFindNext(size_type i) const;  // Returns the index of the first bit equal to value at or after i, or size() if there is none.
+		template <bool value> size_type DoFindPrev(size_type i) const;  // Returns the index of the last bit equal to value before i, or npos if there is none.
+
+		iterator       IndexToIterator(size_type i);                    // Returns end() if i >= size().
+		const_iterator IndexToIterator(size_type i) const;
 	};
 
 
@@ -1085,24 +1107,244 @@ namespace eastl
 	}
 
 
-/*
 	template <typename Allocator, typename Element, typename Container>
 	template <bool value>
-	typename bitvector<Allocator, Element, Container>::iterator 
+	typename bitvector<Allocator, Element, Container>::size_type
+	bitvector<Allocator, Element, Container>::DoFindNext(size_type i) const
+	{
+		const size_type n = size();
+
+		if(i < n)
+		{
+			const word_type* const pWords    = GetWords();
+			const size_type        wordCount = (size_type)mContainer.size();
+			size_type              wordIndex = i / kBitCount;
+			word_type              word      = value ? pWords[wordIndex] : (word_type)~pWords[wordIndex];
+
+			word &= static_cast<word_type>(static_cast<word_type>(~word_type(0)) << (i % kBitCount)); // Ignore the bits before i.
+
+			if(!word)
+			{
+				wordIndex = (size_type)Internal::BitWordsFind<value>(pWords, wordIndex + 1, wordCount);
+
+				if(wordIndex == wordCount)
+					return n;
+
+				word = value ? pWords[wordIndex] : (word_type)~pWords[wordIndex];
+			}
+
+			// The bit we found may be one of the unused bits at the end of the last word.
+			i = (wordIndex * kBitCount) + GetFirstBit(word);
+
+			if(i < n)
+				return i;
+		}
+
+		return n;
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	template <bool value>
+	typename bitvector<Allocator, Element, Container>::size_type
+	bitvector<Allocator, Element, Container>::DoFindPrev(size_type i) const
+	{
+		if(i > size())
+			i = size();
+
+		if(i)
+		{
+			const word_type* const pWords    = GetWords();
+			size_type              wordIndex = --i / kBitCount;
+			word_type              word      = value ? pWords[wordIndex] : (word_type)~pWords[wordIndex];
+
+			word &= static_cast<word_type>(static_cast<word_type>(~word_type(0)) >> (kBitCount - 1 - (i % kBitCount))); // Ignore the bits after i.
+
+			if(!word)
+			{
+				wordIndex = (size_type)Internal::BitWordsFindReverse<value>(pWords, 0, wordIndex);
+
+				if(!wordIndex)
+					return npos;
+
+				--wordIndex;
+				word = value ? pWords[wordIndex] : (word_type)~pWords[wordIndex];
+			}
+
+			return (wordIndex * kBitCount) + GetLastBit(word);
+		}
+
+		return npos;
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	typename bitvector<Allocator, Element, Container>::iterator
+	bitvector<Allocator, Element, Container>::IndexToIterator(size_type i)
+	{
+		if(i < size())
+			return iterator(mContainer.data() + (i / kBitCount), i % kBitCount);
+		return end();
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	typename bitvector<Allocator, Element, Container>::const_iterator
+	bitvector<Allocator, Element, Container>::IndexToIterator(size_type i) const
+	{
+		if(i < size())
+			return const_iterator(mContainer.data() + (i / kBitCount), i % kBitCount);
+		return end();
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	template <bool value>
+	typename bitvector<Allocator, Element, Container>::iterator
 	bitvector<Allocator, Element, Container>::find_first()
 	{
-		return begin();
+		return IndexToIterator(DoFindNext<value>(0));
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	template <bool value>
+	typename bitvector<Allocator, Element, Container>::const_iterator
+	bitvector<Allocator, Element, Container>::find_first() const
+	{
+		return IndexToIterator(DoFindNext<value>(0));
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	template <bool value>
+	typename bitvector<Allocator, Element, Container>::iterator
+	bitvector<Allocator, Element, Container>::find_next(const_iterator it)
+	{
+		return IndexToIterator(DoFindNext<value>((size_type)(it - cbegin()) + 1));
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	template <bool value>
+	typename bitvector<Allocator, Element, Container>::const_iterator
+	bitvector<Allocator, Element, Container>::find_next(const_iterator it) const
+	{
+		return IndexToIterator(DoFindNext<value>((size_type)(it - cbegin()) + 1));
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	template <bool value>
+	typename bitvector<Allocator, Element, Container>::iterator
+	bitvector<Allocator, Element, Container>::find_last()
+	{
+		return IndexToIterator(DoFindPrev<value>(size()));
 	}
 
-	template <bool value> iterator find_next(const_iterator it);
-	template <bool value> iterator find_last();
-	template <bool value> iterator find_prev(const_iterator it);
-						
-	template <bool value> const_iterator find_first() const;
-	template <bool value> const_iterator find_next(const_iterator it) const;
-	template <bool value> const_iterator find_last() const;
-	template <bool value> const_iterator find_prev(const_iterator it) const;
-*/
+
+	template <typename Allocator, typename Element, typename Container>
+	template <bool value>
+	typename bitvector<Allocator, Element, Container>::const_iterator
+	bitvector<Allocator, Element, Container>::find_last() const
+	{
+		return IndexToIterator(DoFindPrev<value>(size()));
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	template <bool value>
+	typename bitvector<Allocator, Element, Container>::iterator
+	bitvector<Allocator, Element, Container>::find_prev(const_iterator it)
+	{
+		return IndexToIterator(DoFindPrev<value>((size_type)(it - cbegin())));
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	template <bool value>
+	typename bitvector<Allocator, Element, Container>::const_iterator
+	bitvector<Allocator, Element, Container>::find_prev(const_iterator it) const
+	{
+		return IndexToIterator(DoFindPrev<value>((size_type)(it - cbegin())));
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	typename bitvector<Allocator, Element, Container>::size_type
+	bitvector<Allocator, Element, Container>::count() const
+	{
+		const size_type n         = size();
+		const size_type wordCount = n / kBitCount;
+		const size_type extra     = n % kBitCount;
+		size_type       result    = (size_type)Internal::BitWordsCount(GetWords(), wordCount);
+
+		if(extra) // Count the used bits of the last word.
+			result += (size_type)GetBitCount(static_cast<word_type>(GetWords()[wordCount] & static_cast<word_type>(static_cast<word_type>(~word_type(0)) >> (kBitCount - extra))));
+
+		return result;
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	bool bitvector<Allocator, Element, Container>::any() const
+	{
+		return DoFindNext<true>(0) != size();
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	bool bitvector<Allocator, Element, Container>::all() const
+	{
+		return DoFindNext<false>(0) == size();
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	bool bitvector<Allocator, Element, Container>::none() const
+	{
+		return !any();
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	bitvector<Allocator, Element, Container>&
+	bitvector<Allocator, Element, Container>::operator&=(const bitvector& x)
+	{
+		EASTL_ASSERT(size() == x.size());
+		Internal::BitWordsTransform(mContainer.data(), x.mContainer.data(), eastl::min_alt(mContainer.size(), x.mContainer.size()), Internal::BitWordsAndOp());
+		return *this;
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	bitvector<Allocator, Element, Container>&
+	bitvector<Allocator, Element, Container>::operator|=(const bitvector& x)
+	{
+		EASTL_ASSERT(size() == x.size());
+		Internal::BitWordsTransform(mContainer.data(), x.mContainer.data(), eastl::min_alt(mContainer.size(), x.mContainer.size()), Internal::BitWordsOrOp());
+		return *this;
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	bitvector<Allocator, Element, Container>&
+	bitvector<Allocator, Element, Container>::operator^=(const bitvector& x)
+	{
+		EASTL_ASSERT(size() == x.size());
+		Internal::BitWordsTransform(mContainer.data(), x.mContainer.data(), eastl::min_alt(mContainer.size(), x.mContainer.size()), Internal::BitWordsXorOp());
+		return *this;
+	}
+
+
+	template <typename Allocator, typename Element, typename Container>
+	bitvector<Allocator, Element, Container>&
+	bitvector<Allocator, Element, Container>::and_not(const bitvector& x)
+	{
+		EASTL_ASSERT(size() == x.size());
+		Internal::BitWordsTransform(mContainer.data(), x.mContainer.data(), eastl::min_alt(mContainer.size(), x.mContainer.size()), Internal::BitWordsAndNotOp());
+		return *this;
+	}
 
 
 
@@ -1408,6 +1650,38 @@ namespace eastl
 
 
 
+	namespace Internal
+	{
+		/// BitvectorMismatch
+		///
+		/// Returns the index of the first of the n bits at pWords1 and pWords2 which 
+		/// differs between the two, or n if there is none. This compares a word at a time.
+		///
+		template <typename Element>
+		eastl_size_t BitvectorMismatch(const Element* pWords1, const Element* pWords2, eastl_size_t n)
+		{
+			typedef typename eastl::make_unsigned<Element>::type word_type;
+
+			const eastl_size_t kBitCount = 8 * sizeof(Element);
+			const eastl_size_t wordCount = (n + kBitCount - 1) / kBitCount;
+
+			for(eastl_size_t i = 0; i < wordCount; i++)
+			{
+				const word_type difference = (word_type)((word_type)pWords1[i] ^ (word_type)pWords2[i]);
+
+				if(difference)
+				{
+					const eastl_size_t bitIndex = (i * kBitCount) + GetFirstBit(difference);
+					return (bitIndex < n) ? bitIndex : n; // The difference may be in the unused bits of the last word.
+				}
+			}
+
+			return n;
+		}
+	}
+
+
+
 	///////////////////////////////////////////////////////////////////////
 	// global operators
 	///////////////////////////////////////////////////////////////////////
@@ -1416,8 +1690,7 @@ namespace eastl
 	inline bool operator==(const bitvector<Allocator, Element, Container>& a, 
 						   const bitvector<Allocator, Element, Container>& b)
 	{
-		// To do: Replace this with a smart compare implementation. This is much slower than it needs to be.
-		return ((a.size() == b.size()) && equal(a.begin(), a.end(), b.begin()));
+		return ((a.size() == b.size()) && (Internal::BitvectorMismatch(a.data(), b.data(), a.size()) == a.size()));
 	}
 
 
@@ -1433,8 +1706,12 @@ namespace eastl
 	inline bool operator<(const bitvector<Allocator, Element, Container>& a, 
 						  const bitvector<Allocator, Element, Container>& b)
 	{
-		// To do: Replace this with a smart compare implementation. This is much slower than it needs to be.
-		return lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+		const eastl_size_t n = eastl::min_alt(a.size(), b.size());
+		const eastl_size_t i = Internal::BitvectorMismatch(a.data(), b.data(), n);
+
+		if(i < n)
+			return !a[i]; // a[i] and b[i] differ, so a < b if a[i] is false.
+		return a.size() < b.size();
 	}
 
 
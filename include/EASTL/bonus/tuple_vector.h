@@ -0,0 +1,1314 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements tuple_vector, a structure-of-arrays alternative to a
+// vector of structs. tuple_vector<Ts...> stores each of its element types in
+// its own contiguous array, and all of the arrays share a single allocation.
+// A loop which touches only one or two of the fields of each element then
+// reads only the memory for those fields, and each field array can be fed to
+// SIMD code directly.
+//
+// Elements are accessed as tuples of references, so:
+//     tuple_vector<Vec3, Vec3, float> particles;   // position, velocity, mass
+//     particles.push_back(position, velocity, 1.f);
+//
+//     Vec3* pPositions = particles.get<0>().data(); // Or get<Vec3>() if the types are distinct.
+//
+//     for(auto p : particles)                       // p is a tuple<Vec3&, Vec3&, float&>.
+//         get<0>(p) += get<1>(p) * dt;
+//
+// The iterator is a random access iterator whose reference type is a tuple of
+// references to the fields of an element, so eastl::sort and most of the rest
+// of algorithm.h work with it. Algorithms which call swap directly on
+// dereferenced iterators rather than through iter_swap, such as partition,
+// don't, as a tuple of references is not an lvalue.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_TUPLE_VECTOR_H
+#define EASTL_TUPLE_VECTOR_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/allocator.h>
+#include <EASTL/initializer_list.h>
+#include <EASTL/iterator.h>
+#include <EASTL/memory.h>
+#include <EASTL/span.h>
+#include <EASTL/tuple.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/utility.h>
+#include <stddef.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+	/// EASTL_TUPLE_VECTOR_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_TUPLE_VECTOR_DEFAULT_NAME
+		#define EASTL_TUPLE_VECTOR_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " tuple_vector" // Unless the user overrides something, this is "EASTL tuple_vector".
+	#endif
+
+
+	/// EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR
+		#define EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR allocator_type(EASTL_TUPLE_VECTOR_DEFAULT_NAME)
+	#endif
+
+
+
+	namespace TupleVecInternal
+	{
+		// Evaluates an operation once per column, in column order. Braced initialization
+		// guarantees the left to right order, which a function call's arguments don't.
+		struct ForEachColumn
+		{
+			template <typename... Ts>
+			ForEachColumn(Ts&&...) {}
+		};
+
+	} // namespace TupleVecInternal
+
+
+
+	/// tuple_vector_iterator
+	///
+	/// A random access iterator over the elements of a tuple_vector. It holds the
+	/// column pointers of the container and an element index. Dereferencing it
+	/// yields a tuple of references to the element's fields; its value_type is the
+	/// corresponding tuple of values, so that algorithms can copy elements out.
+	///
+	template <bool bConst, typename... Ts>
+	struct tuple_vector_iterator
+	{
+		typedef tuple_vector_iterator<bConst, Ts...>                                       this_type;
+		typedef tuple_vector_iterator<false, Ts...>                                        iterator;
+		typedef EASTL_ITC_NS::random_access_iterator_tag                                   iterator_category;
+		typedef tuple<Ts...>                                                               value_type;
+		typedef eastl_size_t                                                               size_type;
+		typedef ptrdiff_t                                                                  difference_type;
+		typedef typename type_select<bConst, tuple<const Ts&...>, tuple<Ts&...> >::type  reference;
+		typedef typename type_select<bConst, tuple<const Ts*...>, tuple<Ts*...> >::type  pointer;
+
+	public:
+		tuple<Ts*...> mColumns;
+		size_type     mnIndex;
+
+	public:
+		tuple_vector_iterator()
+			: mColumns(), mnIndex(0) { }
+
+		tuple_vector_iterator(const tuple<Ts*...>& columns, size_type nIndex)
+			: mColumns(columns), mnIndex(nIndex) { }
+
+		tuple_vector_iterator(const iterator& x)
+			: mColumns(x.mColumns), mnIndex(x.mnIndex) { }
+
+		tuple_vector_iterator& operator=(const iterator& x)
+		{
+			mColumns = x.mColumns;
+			mnIndex  = x.mnIndex;
+			return *this;
+		}
+
+		reference operator*() const
+			{ return DoGetReference(mnIndex, make_index_sequence<sizeof...(Ts)>()); }
+
+		reference operator[](difference_type n) const
+			{ return DoGetReference(mnIndex + (size_type)n, make_index_sequence<sizeof...(Ts)>()); }
+
+		this_type& operator++()
+			{ ++mnIndex; return *this; }
+
+		this_type operator++(int)
+			{ this_type temp(*this); ++mnIndex; return temp; }
+
+		this_type& operator--()
+			{ --mnIndex; return *this; }
+
+		this_type operator--(int)
+			{ this_type temp(*this); --mnIndex; return temp; }
+
+		this_type& operator+=(difference_type n)
+			{ mnIndex += (size_type)n; return *this; }
+
+		this_type& operator-=(difference_type n)
+			{ mnIndex -= (size_type)n; return *this; }
+
+		this_type operator+(difference_type n) const
+			{ return this_type(mColumns, mnIndex + (size_type)n); }
+
+		this_type operator-(difference_type n) const
+			{ return this_type(mColumns, mnIndex - (size_type)n); }
+
+	protected:
+		template <size_t... Is>
+		reference DoGetReference(size_type nIndex, index_sequence<Is...>) const
+			{ return reference(eastl::get<Is>(mColumns)[nIndex]...); }
+
+	}; // tuple_vector_iterator
+
+
+	template <bool bConst, typename... Ts>
+	inline tuple_vector_iterator<bConst, Ts...> operator+(ptrdiff_t n, const tuple_vector_iterator<bConst, Ts...>& x)
+		{ return x + n; }
+
+	template <bool bConstA, bool bConstB, typename... Ts>
+	inline ptrdiff_t operator-(const tuple_vector_iterator<bConstA, Ts...>& a, const tuple_vector_iterator<bConstB, Ts...>& b)
+		{ return (ptrdiff_t)a.mnIndex - (ptrdiff_t)b.mnIndex; }
+
+	// Iterators are compared by index alone; comparing iterators of different containers is undefined.
+	template <bool bConstA, bool bConstB, typename... Ts>
+	inline bool operator==(const tuple_vector_iterator<bConstA, Ts...>& a, const tuple_vector_iterator<bConstB, Ts...>& b)
+		{ return a.mnIndex == b.mnIndex; }
+
+	template <bool bConstA, bool bConstB, typename... Ts>
+	inline bool operator!=(const tuple_vector_iterator<bConstA, Ts...>& a, const tuple_vector_iterator<bConstB, Ts...>& b)
+		{ return a.mnIndex != b.mnIndex; }
+
+	template <bool bConstA, bool bConstB, typename... Ts>
+	inline bool operator<(const tuple_vector_iterator<bConstA, Ts...>& a, const tuple_vector_iterator<bConstB, Ts...>& b)
+		{ return a.mnIndex < b.mnIndex; }
+
+	template <bool bConstA, bool bConstB, typename... Ts>
+	inline bool operator>(const tuple_vector_iterator<bConstA, Ts...>& a, const tuple_vector_iterator<bConstB, Ts...>& b)
+		{ return a.mnIndex > b.mnIndex; }
+
+	template <bool bConstA, bool bConstB, typename... Ts>
+	inline bool operator<=(const tuple_vector_iterator<bConstA, Ts...>& a, const tuple_vector_iterator<bConstB, Ts...>& b)
+		{ return a.mnIndex <= b.mnIndex; }
+
+	template <bool bConstA, bool bConstB, typename... Ts>
+	inline bool operator>=(const tuple_vector_iterator<bConstA, Ts...>& a, const tuple_vector_iterator<bConstB, Ts...>& b)
+		{ return a.mnIndex >= b.mnIndex; }
+
+
+
+	/// tuple_vector_alloc
+	///
+	/// Implements a vector of tuple<Ts...> in structure-of-arrays layout: one array
+	/// per element type, all carved out of a single allocation made with Allocator.
+	/// The arrays are laid out in template argument order and each is aligned for
+	/// its type. Use tuple_vector<Ts...> unless a specific allocator is needed.
+	///
+	/// The interface follows eastl::vector, except that:
+	///     - Functions which take an element take one argument per column, such as
+	///       push_back(const Ts&...), rather than a value_type.
+	///     - reference is tuple<Ts&...> and const_reference is tuple<const Ts&...>.
+	///       They are returned by value.
+	///     - get<I>() and get<T>() return a span over the Ith column or the column of
+	///       type T, and there's no data().
+	///
+	/// Iterators, references and spans are invalidated by reallocation, as with vector.
+	///
+	template <typename Allocator, typename... Ts>
+	class tuple_vector_alloc
+	{
+	public:
+		typedef tuple_vector_alloc<Allocator, Ts...>              this_type;
+		typedef tuple<Ts...>                                      value_type;
+		typedef tuple<Ts&...>                                     reference;
+		typedef tuple<const Ts&...>                               const_reference;
+		typedef tuple_vector_iterator<false, Ts...>               iterator;
+		typedef tuple_vector_iterator<true, Ts...>                const_iterator;
+		typedef eastl::reverse_iterator<iterator>                 reverse_iterator;
+		typedef eastl::reverse_iterator<const_iterator>           const_reverse_iterator;
+		typedef eastl_size_t                                      size_type;
+		typedef ptrdiff_t                                         difference_type;
+		typedef Allocator                                         allocator_type;
+
+		static const size_type kColumnCount = (size_type)sizeof...(Ts);
+
+		static_assert(sizeof...(Ts) > 0, "tuple_vector requires at least one element type");
+
+	protected:
+		typedef make_index_sequence<sizeof...(Ts)> column_indices;
+
+		tuple<Ts*...>  mColumns;    // Column i holds the tuple_element_t<i, value_type> fields. The first column begins the allocation.
+		size_type      mnSize;
+		size_type      mnCapacity;
+		allocator_type mAllocator;
+
+	public:
+		tuple_vector_alloc();
+		explicit tuple_vector_alloc(const allocator_type& allocator);
+		explicit tuple_vector_alloc(size_type n, const allocator_type& allocator = EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR);
+		tuple_vector_alloc(size_type n, const Ts&... values);
+		tuple_vector_alloc(std::initializer_list<value_type> ilist, const allocator_type& allocator = EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR);
+		tuple_vector_alloc(const this_type& x);
+		tuple_vector_alloc(this_type&& x);
+	   ~tuple_vector_alloc();
+
+		this_type& operator=(const this_type& x);
+		this_type& operator=(this_type&& x);
+
+		void swap(this_type& x);
+
+		const allocator_type& get_allocator() const EA_NOEXCEPT;
+		allocator_type&       get_allocator() EA_NOEXCEPT;
+		void                  set_allocator(const allocator_type& allocator);
+
+		iterator       begin() EA_NOEXCEPT;
+		const_iterator begin() const EA_NOEXCEPT;
+		const_iterator cbegin() const EA_NOEXCEPT;
+
+		iterator       end() EA_NOEXCEPT;
+		const_iterator end() const EA_NOEXCEPT;
+		const_iterator cend() const EA_NOEXCEPT;
+
+		reverse_iterator       rbegin() EA_NOEXCEPT;
+		const_reverse_iterator rbegin() const EA_NOEXCEPT;
+		const_reverse_iterator crbegin() const EA_NOEXCEPT;
+
+		reverse_iterator       rend() EA_NOEXCEPT;
+		const_reverse_iterator rend() const EA_NOEXCEPT;
+		const_reverse_iterator crend() const EA_NOEXCEPT;
+
+		bool      empty() const EA_NOEXCEPT;
+		size_type size() const EA_NOEXCEPT;
+		size_type capacity() const EA_NOEXCEPT;
+
+		void resize(size_type n);
+		void resize(size_type n, const Ts&... values);
+		void reserve(size_type n);
+		void shrink_to_fit();
+
+		reference       operator[](size_type n);
+		const_reference operator[](size_type n) const;
+
+		reference       front();
+		const_reference front() const;
+
+		reference       back();
+		const_reference back() const;
+
+		template <size_t I>
+		span<tuple_element_t<I, value_type> > get() EA_NOEXCEPT;
+
+		template <size_t I>
+		span<const tuple_element_t<I, value_type> > get() const EA_NOEXCEPT;
+
+		template <typename T>
+		span<T> get() EA_NOEXCEPT;
+
+		template <typename T>
+		span<const T> get() const EA_NOEXCEPT;
+
+		reference push_back();
+		void      push_back(const Ts&... values);
+		void      push_back(const value_type& value);
+		void      push_back(value_type&& value);
+
+		template <typename... Args>
+		reference emplace_back(Args&&... args);
+
+		void pop_back();
+
+		iterator insert(const_iterator position, const Ts&... values);
+		iterator insert(const_iterator position, size_type n, const Ts&... values);
+
+		iterator erase(const_iterator position);
+		iterator erase(const_iterator first, const_iterator last);
+		iterator erase_unsorted(const_iterator position);
+
+		void clear() EA_NOEXCEPT;
+
+		bool validate() const EA_NOEXCEPT;
+		int  validate_iterator(const_iterator i) const EA_NOEXCEPT;
+
+	protected:
+		static size_type GetNewCapacity(size_type currentCapacity);
+		static size_type GetAllocationSize(size_type n, size_t* pOffsets);
+
+		tuple<Ts*...> DoAllocate(size_type n);
+		void          DoFree(const tuple<Ts*...>& columns, size_type n);
+		void          DoRelocate(const tuple<Ts*...>& newColumns, size_type nNewCapacity);
+		void          DoGrow(size_type n);
+
+		template <size_t... Is>
+		static tuple<Ts*...> DoGetColumns(void* pBuffer, const size_t* pOffsets, index_sequence<Is...>);
+
+		template <size_t... Is, typename... Args>
+		static void DoConstruct(const tuple<Ts*...>& columns, size_type i, index_sequence<Is...>, Args&&... args);
+
+		template <size_t... Is, typename Tuple>
+		static void DoConstructFromTuple(const tuple<Ts*...>& columns, size_type i, index_sequence<Is...>, Tuple&& t);
+
+		template <size_t... Is>
+		static void DoMoveColumns(const tuple<Ts*...>& dest, const tuple<Ts*...>& source, size_type nSize, index_sequence<Is...>);
+
+		template <size_t... Is>
+		static void DoCopyColumns(const tuple<Ts*...>& dest, const tuple<Ts*...>& source, size_type nSize, index_sequence<Is...>);
+
+		template <size_t... Is>
+		static void DoDestroy(const tuple<Ts*...>& columns, size_type first, size_type last, index_sequence<Is...>);
+
+		template <size_t... Is>
+		static void DoDefaultConstruct(const tuple<Ts*...>& columns, size_type first, size_type last, index_sequence<Is...>);
+
+		template <size_t... Is>
+		void DoInsertValues(size_type nPosition, size_type n, index_sequence<Is...>, const Ts&... values);
+
+		template <size_t... Is>
+		void DoErase(size_type first, size_type last, index_sequence<Is...>);
+
+		template <size_t... Is>
+		void DoEraseUnsorted(size_type nPosition, index_sequence<Is...>);
+
+		template <size_t... Is>
+		reference DoGetReference(size_type n, index_sequence<Is...>);
+
+		template <size_t... Is>
+		const_reference DoGetReference(size_type n, index_sequence<Is...>) const;
+
+		template <typename T>
+		static void DoInsertValuesInPlace(T* p, size_type nSize, size_type nPosition, size_type n, const T& value);
+
+		template <typename T>
+		static void DoInsertValuesRelocate(T* pDest, T* pSource, size_type nSize, size_type nPosition, size_type n, const T& value);
+
+		template <typename T>
+		static void DoEraseColumn(T* p, size_type nSize, size_type first, size_type last);
+
+	}; // class tuple_vector_alloc
+
+
+
+	/// tuple_vector
+	///
+	/// tuple_vector_alloc with the default allocator. The template alias lets the
+	/// element types remain a trailing parameter pack.
+	///
+	/// Example usage:
+	///     tuple_vector<int, float, bool> tv;
+	///     tv.push_back(1, 2.f, true);
+	///     int sum = eastl::accumulate(tv.get<0>().begin(), tv.get<0>().end(), 0);
+	///
+	template <typename... Ts>
+	using tuple_vector = tuple_vector_alloc<EASTLAllocatorType, Ts...>;
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// tuple_vector_alloc
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Allocator, typename... Ts>
+	inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc()
+		: mColumns(), mnSize(0), mnCapacity(0), mAllocator(EASTL_TUPLE_VECTOR_DEFAULT_NAME)
+	{
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(const allocator_type& allocator)
+		: mColumns(), mnSize(0), mnCapacity(0), mAllocator(allocator)
+	{
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(size_type n, const allocator_type& allocator)
+		: mColumns(), mnSize(0), mnCapacity(0), mAllocator(allocator)
+	{
+		resize(n);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(size_type n, const Ts&... values)
+		: mColumns(), mnSize(0), mnCapacity(0), mAllocator(EASTL_TUPLE_VECTOR_DEFAULT_NAME)
+	{
+		resize(n, values...);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(std::initializer_list<value_type> ilist, const allocator_type& allocator)
+		: mColumns(), mnSize(0), mnCapacity(0), mAllocator(allocator)
+	{
+		reserve((size_type)ilist.size());
+
+		for(const value_type& value : ilist)
+			push_back(value);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(const this_type& x)
+		: mColumns(), mnSize(0), mnCapacity(0), mAllocator(x.mAllocator)
+	{
+		if(x.mnSize)
+		{
+			mColumns   = DoAllocate(x.mnSize);
+			mnCapacity = x.mnSize;
+			DoCopyColumns(mColumns, x.mColumns, x.mnSize, column_indices());
+			mnSize     = x.mnSize;
+		}
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(this_type&& x)
+		: mColumns(), mnSize(0), mnCapacity(0), mAllocator(x.mAllocator)
+	{
+		swap(x);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline tuple_vector_alloc<Allocator, Ts...>::~tuple_vector_alloc()
+	{
+		DoDestroy(mColumns, 0, mnSize, column_indices());
+		DoFree(mColumns, mnCapacity);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	typename tuple_vector_alloc<Allocator, Ts...>::this_type&
+	tuple_vector_alloc<Allocator, Ts...>::operator=(const this_type& x)
+	{
+		if(this != &x)
+		{
+			clear();
+
+			if(mnCapacity < x.mnSize)
+			{
+				DoFree(mColumns, mnCapacity);
+				mColumns   = DoAllocate(x.mnSize);
+				mnCapacity = x.mnSize;
+			}
+
+			DoCopyColumns(mColumns, x.mColumns, x.mnSize, column_indices());
+			mnSize = x.mnSize;
+		}
+
+		return *this;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	typename tuple_vector_alloc<Allocator, Ts...>::this_type&
+	tuple_vector_alloc<Allocator, Ts...>::operator=(this_type&& x)
+	{
+		if(this != &x)
+		{
+			clear();
+			swap(x);
+		}
+
+		return *this;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::swap(this_type& x)
+	{
+		// As with vector, we swap allocators along with the contents.
+		eastl::swap(mColumns,    x.mColumns);
+		eastl::swap(mnSize,      x.mnSize);
+		eastl::swap(mnCapacity,  x.mnCapacity);
+		eastl::swap(mAllocator,  x.mAllocator);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline const typename tuple_vector_alloc<Allocator, Ts...>::allocator_type&
+	tuple_vector_alloc<Allocator, Ts...>::get_allocator() const EA_NOEXCEPT
+	{
+		return mAllocator;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::allocator_type&
+	tuple_vector_alloc<Allocator, Ts...>::get_allocator() EA_NOEXCEPT
+	{
+		return mAllocator;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::set_allocator(const allocator_type& allocator)
+	{
+		mAllocator = allocator;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+	tuple_vector_alloc<Allocator, Ts...>::begin() EA_NOEXCEPT
+	{
+		return iterator(mColumns, 0);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_iterator
+	tuple_vector_alloc<Allocator, Ts...>::begin() const EA_NOEXCEPT
+	{
+		return const_iterator(mColumns, 0);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_iterator
+	tuple_vector_alloc<Allocator, Ts...>::cbegin() const EA_NOEXCEPT
+	{
+		return const_iterator(mColumns, 0);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+	tuple_vector_alloc<Allocator, Ts...>::end() EA_NOEXCEPT
+	{
+		return iterator(mColumns, mnSize);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_iterator
+	tuple_vector_alloc<Allocator, Ts...>::end() const EA_NOEXCEPT
+	{
+		return const_iterator(mColumns, mnSize);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_iterator
+	tuple_vector_alloc<Allocator, Ts...>::cend() const EA_NOEXCEPT
+	{
+		return const_iterator(mColumns, mnSize);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::reverse_iterator
+	tuple_vector_alloc<Allocator, Ts...>::rbegin() EA_NOEXCEPT
+	{
+		return reverse_iterator(end());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_reverse_iterator
+	tuple_vector_alloc<Allocator, Ts...>::rbegin() const EA_NOEXCEPT
+	{
+		return const_reverse_iterator(end());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_reverse_iterator
+	tuple_vector_alloc<Allocator, Ts...>::crbegin() const EA_NOEXCEPT
+	{
+		return const_reverse_iterator(end());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::reverse_iterator
+	tuple_vector_alloc<Allocator, Ts...>::rend() EA_NOEXCEPT
+	{
+		return reverse_iterator(begin());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_reverse_iterator
+	tuple_vector_alloc<Allocator, Ts...>::rend() const EA_NOEXCEPT
+	{
+		return const_reverse_iterator(begin());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_reverse_iterator
+	tuple_vector_alloc<Allocator, Ts...>::crend() const EA_NOEXCEPT
+	{
+		return const_reverse_iterator(begin());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline bool tuple_vector_alloc<Allocator, Ts...>::empty() const EA_NOEXCEPT
+	{
+		return (mnSize == 0);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::size_type
+	tuple_vector_alloc<Allocator, Ts...>::size() const EA_NOEXCEPT
+	{
+		return mnSize;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::size_type
+	tuple_vector_alloc<Allocator, Ts...>::capacity() const EA_NOEXCEPT
+	{
+		return mnCapacity;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	void tuple_vector_alloc<Allocator, Ts...>::resize(size_type n)
+	{
+		if(n > mnSize)
+		{
+			if(n > mnCapacity)
+				DoGrow(n);
+
+			DoDefaultConstruct(mColumns, mnSize, n, column_indices());
+			mnSize = n;
+		}
+		else
+			erase(begin() + (difference_type)n, end());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	void tuple_vector_alloc<Allocator, Ts...>::resize(size_type n, const Ts&... values)
+	{
+		if(n > mnSize)
+			DoInsertValues(mnSize, n - mnSize, column_indices(), values...);
+		else
+			erase(begin() + (difference_type)n, end());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::reserve(size_type n)
+	{
+		if(n > mnCapacity)
+			DoRelocate(DoAllocate(n), n);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::shrink_to_fit()
+	{
+		if(mnCapacity > mnSize)
+			DoRelocate(DoAllocate(mnSize), mnSize);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+	tuple_vector_alloc<Allocator, Ts...>::operator[](size_type n)
+	{
+		#if EASTL_ASSERT_ENABLED && EASTL_EMPTY_REFERENCE_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(n >= mnSize))
+				EASTL_FAIL_MSG("tuple_vector::operator[] -- out of range");
+		#elif EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY((n != 0) && (n >= mnSize)))
+				EASTL_FAIL_MSG("tuple_vector::operator[] -- out of range");
+		#endif
+
+		return DoGetReference(n, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_reference
+	tuple_vector_alloc<Allocator, Ts...>::operator[](size_type n) const
+	{
+		#if EASTL_ASSERT_ENABLED && EASTL_EMPTY_REFERENCE_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(n >= mnSize))
+				EASTL_FAIL_MSG("tuple_vector::operator[] -- out of range");
+		#elif EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY((n != 0) && (n >= mnSize)))
+				EASTL_FAIL_MSG("tuple_vector::operator[] -- out of range");
+		#endif
+
+		return DoGetReference(n, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+	tuple_vector_alloc<Allocator, Ts...>::front()
+	{
+		#if EASTL_ASSERT_ENABLED && EASTL_EMPTY_REFERENCE_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(mnSize == 0)) // We don't allow the user to reference an empty container.
+				EASTL_FAIL_MSG("tuple_vector::front -- empty vector");
+		#endif
+
+		return DoGetReference(0, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_reference
+	tuple_vector_alloc<Allocator, Ts...>::front() const
+	{
+		#if EASTL_ASSERT_ENABLED && EASTL_EMPTY_REFERENCE_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(mnSize == 0)) // We don't allow the user to reference an empty container.
+				EASTL_FAIL_MSG("tuple_vector::front -- empty vector");
+		#endif
+
+		return DoGetReference(0, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+	tuple_vector_alloc<Allocator, Ts...>::back()
+	{
+		#if EASTL_ASSERT_ENABLED && EASTL_EMPTY_REFERENCE_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(mnSize == 0)) // We don't allow the user to reference an empty container.
+				EASTL_FAIL_MSG("tuple_vector::back -- empty vector");
+		#endif
+
+		return DoGetReference(mnSize - 1, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_reference
+	tuple_vector_alloc<Allocator, Ts...>::back() const
+	{
+		#if EASTL_ASSERT_ENABLED && EASTL_EMPTY_REFERENCE_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(mnSize == 0)) // We don't allow the user to reference an empty container.
+				EASTL_FAIL_MSG("tuple_vector::back -- empty vector");
+		#endif
+
+		return DoGetReference(mnSize - 1, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t I>
+	inline span<tuple_element_t<I, typename tuple_vector_alloc<Allocator, Ts...>::value_type> >
+	tuple_vector_alloc<Allocator, Ts...>::get() EA_NOEXCEPT
+	{
+		typedef tuple_element_t<I, value_type> T;
+		return span<T>(eastl::get<I>(mColumns), (typename span<T>::index_type)mnSize);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t I>
+	inline span<const tuple_element_t<I, typename tuple_vector_alloc<Allocator, Ts...>::value_type> >
+	tuple_vector_alloc<Allocator, Ts...>::get() const EA_NOEXCEPT
+	{
+		typedef const tuple_element_t<I, value_type> T;
+		return span<T>(eastl::get<I>(mColumns), (typename span<T>::index_type)mnSize);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <typename T>
+	inline span<T> tuple_vector_alloc<Allocator, Ts...>::get() EA_NOEXCEPT
+	{
+		return get<tuple_index<T, TupleTypes<Ts...> >::index>();
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <typename T>
+	inline span<const T> tuple_vector_alloc<Allocator, Ts...>::get() const EA_NOEXCEPT
+	{
+		return get<tuple_index<T, TupleTypes<Ts...> >::index>();
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+	tuple_vector_alloc<Allocator, Ts...>::push_back()
+	{
+		if(mnSize == mnCapacity)
+			DoGrow(mnSize + 1);
+
+		DoDefaultConstruct(mColumns, mnSize, mnSize + 1, column_indices());
+		return DoGetReference(mnSize++, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::push_back(const Ts&... values)
+	{
+		emplace_back(values...);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::push_back(const value_type& value)
+	{
+		if(mnSize == mnCapacity)
+		{
+			const size_type     nNewCapacity = eastl::max(GetNewCapacity(mnCapacity), mnSize + 1);
+			const tuple<Ts*...> newColumns   = DoAllocate(nNewCapacity);
+
+			DoConstructFromTuple(newColumns, mnSize, column_indices(), value); // Before relocating, as value may be one of our elements.
+			DoRelocate(newColumns, nNewCapacity);
+		}
+		else
+			DoConstructFromTuple(mColumns, mnSize, column_indices(), value);
+
+		++mnSize;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::push_back(value_type&& value)
+	{
+		if(mnSize == mnCapacity)
+		{
+			const size_type     nNewCapacity = eastl::max(GetNewCapacity(mnCapacity), mnSize + 1);
+			const tuple<Ts*...> newColumns   = DoAllocate(nNewCapacity);
+
+			DoConstructFromTuple(newColumns, mnSize, column_indices(), eastl::move(value));
+			DoRelocate(newColumns, nNewCapacity);
+		}
+		else
+			DoConstructFromTuple(mColumns, mnSize, column_indices(), eastl::move(value));
+
+		++mnSize;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <typename... Args>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+	tuple_vector_alloc<Allocator, Ts...>::emplace_back(Args&&... args)
+	{
+		static_assert(sizeof...(Args) == sizeof...(Ts), "tuple_vector::emplace_back takes one argument per column");
+
+		if(mnSize == mnCapacity)
+		{
+			const size_type     nNewCapacity = eastl::max(GetNewCapacity(mnCapacity), mnSize + 1);
+			const tuple<Ts*...> newColumns   = DoAllocate(nNewCapacity);
+
+			DoConstruct(newColumns, mnSize, column_indices(), eastl::forward<Args>(args)...); // Before relocating, as args may refer to our elements.
+			DoRelocate(newColumns, nNewCapacity);
+		}
+		else
+			DoConstruct(mColumns, mnSize, column_indices(), eastl::forward<Args>(args)...);
+
+		return DoGetReference(mnSize++, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::pop_back()
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(mnSize == 0))
+				EASTL_FAIL_MSG("tuple_vector::pop_back -- empty vector");
+		#endif
+
+		--mnSize;
+		DoDestroy(mColumns, mnSize, mnSize + 1, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+	tuple_vector_alloc<Allocator, Ts...>::insert(const_iterator position, const Ts&... values)
+	{
+		return insert(position, 1, values...);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+	tuple_vector_alloc<Allocator, Ts...>::insert(const_iterator position, size_type n, const Ts&... values)
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(position.mnIndex > mnSize))
+				EASTL_FAIL_MSG("tuple_vector::insert -- invalid position");
+		#endif
+
+		const size_type nPosition = position.mnIndex;
+
+		if(n)
+			DoInsertValues(nPosition, n, column_indices(), values...);
+
+		return iterator(mColumns, nPosition);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+	tuple_vector_alloc<Allocator, Ts...>::erase(const_iterator position)
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(position.mnIndex >= mnSize))
+				EASTL_FAIL_MSG("tuple_vector::erase -- invalid position");
+		#endif
+
+		DoErase(position.mnIndex, position.mnIndex + 1, column_indices());
+		return iterator(mColumns, position.mnIndex);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+	tuple_vector_alloc<Allocator, Ts...>::erase(const_iterator first, const_iterator last)
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY((first.mnIndex > last.mnIndex) || (last.mnIndex > mnSize)))
+				EASTL_FAIL_MSG("tuple_vector::erase -- invalid position");
+		#endif
+
+		if(first.mnIndex != last.mnIndex)
+			DoErase(first.mnIndex, last.mnIndex, column_indices());
+
+		return iterator(mColumns, first.mnIndex);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+	tuple_vector_alloc<Allocator, Ts...>::erase_unsorted(const_iterator position)
+	{
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(position.mnIndex >= mnSize))
+				EASTL_FAIL_MSG("tuple_vector::erase_unsorted -- invalid position");
+		#endif
+
+		DoEraseUnsorted(position.mnIndex, column_indices());
+		return iterator(mColumns, position.mnIndex);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::clear() EA_NOEXCEPT
+	{
+		DoDestroy(mColumns, 0, mnSize, column_indices());
+		mnSize = 0;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline bool tuple_vector_alloc<Allocator, Ts...>::validate() const EA_NOEXCEPT
+	{
+		if(mnSize > mnCapacity)
+			return false;
+		if((mnCapacity != 0) && (eastl::get<0>(mColumns) == NULL))
+			return false;
+		return true;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline int tuple_vector_alloc<Allocator, Ts...>::validate_iterator(const_iterator i) const EA_NOEXCEPT
+	{
+		if(i.mColumns == mColumns)
+		{
+			if(i.mnIndex < mnSize)
+				return (isf_valid | isf_current | isf_can_dereference);
+
+			if(i.mnIndex == mnSize)
+				return (isf_valid | isf_current);
+		}
+
+		return isf_none;
+	}
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// tuple_vector_alloc protected functions
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::size_type
+	tuple_vector_alloc<Allocator, Ts...>::GetNewCapacity(size_type currentCapacity)
+	{
+		// This needs to return a value of at least currentCapacity and at least 1.
+		return (currentCapacity > 0) ? (2 * currentCapacity) : 1;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::size_type
+	tuple_vector_alloc<Allocator, Ts...>::GetAllocationSize(size_type n, size_t* pOffsets)
+	{
+		// Each column begins at the first offset past the previous one that is aligned for its type.
+		// The first column is at offset 0, which the allocation itself is aligned for.
+		const size_t kSizes[]      = { sizeof(Ts)... };
+		const size_t kAlignments[] = { EASTL_ALIGN_OF(Ts)... };
+
+		size_t nOffset = 0;
+
+		for(size_t i = 0; i < sizeof...(Ts); ++i)
+		{
+			nOffset     = (nOffset + (kAlignments[i] - 1)) & ~(kAlignments[i] - 1);
+			pOffsets[i] = nOffset;
+			nOffset    += kSizes[i] * n;
+		}
+
+		return (size_type)nOffset;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	inline tuple<Ts*...> tuple_vector_alloc<Allocator, Ts...>::DoGetColumns(void* pBuffer, const size_t* pOffsets, index_sequence<Is...>)
+	{
+		return tuple<Ts*...>(reinterpret_cast<Ts*>(static_cast<char*>(pBuffer) + pOffsets[Is])...);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	tuple<Ts*...> tuple_vector_alloc<Allocator, Ts...>::DoAllocate(size_type n)
+	{
+		if(n == 0)
+			return tuple<Ts*...>();
+
+		const size_t kAlignments[] = { EASTL_ALIGN_OF(Ts)... };
+		size_t       nAlignment    = 1;
+
+		for(size_t i = 0; i < sizeof...(Ts); ++i)
+			nAlignment = eastl::max_alt(nAlignment, kAlignments[i]);
+
+		size_t          offsets[sizeof...(Ts)];
+		const size_type nAllocationSize = GetAllocationSize(n, offsets);
+
+		#if EASTL_ASSERT_ENABLED
+			if(EASTL_UNLIKELY(n >= 0x80000000))
+				EASTL_FAIL_MSG("tuple_vector::DoAllocate -- improbably large request.");
+		#endif
+
+		void* const pBuffer = allocate_memory(mAllocator, nAllocationSize, nAlignment, 0);
+		return DoGetColumns(pBuffer, offsets, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoFree(const tuple<Ts*...>& columns, size_type n)
+	{
+		if(eastl::get<0>(columns))
+		{
+			size_t offsets[sizeof...(Ts)];
+			EASTLFree(mAllocator, eastl::get<0>(columns), GetAllocationSize(n, offsets));
+		}
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	void tuple_vector_alloc<Allocator, Ts...>::DoRelocate(const tuple<Ts*...>& newColumns, size_type nNewCapacity)
+	{
+		// Moves our elements to newColumns, which has room for nNewCapacity elements, and frees our old allocation.
+		DoMoveColumns(newColumns, mColumns, mnSize, column_indices());
+		DoDestroy(mColumns, 0, mnSize, column_indices());
+		DoFree(mColumns, mnCapacity);
+
+		mColumns   = newColumns;
+		mnCapacity = nNewCapacity;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoGrow(size_type n)
+	{
+		const size_type nNewCapacity = eastl::max(GetNewCapacity(mnCapacity), n);
+		DoRelocate(DoAllocate(nNewCapacity), nNewCapacity);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is, typename... Args>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoConstruct(const tuple<Ts*...>& columns, size_type i, index_sequence<Is...>, Args&&... args)
+	{
+		TupleVecInternal::ForEachColumn{ (::new((void*)(eastl::get<Is>(columns) + i)) Ts(eastl::forward<Args>(args)), 0)... };
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is, typename Tuple>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoConstructFromTuple(const tuple<Ts*...>& columns, size_type i, index_sequence<Is...>, Tuple&& t)
+	{
+		TupleVecInternal::ForEachColumn{ (::new((void*)(eastl::get<Is>(columns) + i)) Ts(eastl::get<Is>(eastl::forward<Tuple>(t))), 0)... };
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoMoveColumns(const tuple<Ts*...>& dest, const tuple<Ts*...>& source, size_type nSize, index_sequence<Is...>)
+	{
+		TupleVecInternal::ForEachColumn{ (eastl::uninitialized_move_ptr_if_noexcept(eastl::get<Is>(source), eastl::get<Is>(source) + nSize, eastl::get<Is>(dest)), 0)... };
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoCopyColumns(const tuple<Ts*...>& dest, const tuple<Ts*...>& source, size_type nSize, index_sequence<Is...>)
+	{
+		TupleVecInternal::ForEachColumn{ (eastl::uninitialized_copy_ptr(eastl::get<Is>(source), eastl::get<Is>(source) + nSize, eastl::get<Is>(dest)), 0)... };
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoDestroy(const tuple<Ts*...>& columns, size_type first, size_type last, index_sequence<Is...>)
+	{
+		TupleVecInternal::ForEachColumn{ (eastl::destruct(eastl::get<Is>(columns) + first, eastl::get<Is>(columns) + last), 0)... };
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoDefaultConstruct(const tuple<Ts*...>& columns, size_type first, size_type last, index_sequence<Is...>)
+	{
+		TupleVecInternal::ForEachColumn{ (eastl::uninitialized_default_fill_n(eastl::get<Is>(columns) + first, last - first), 0)... };
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	void tuple_vector_alloc<Allocator, Ts...>::DoInsertValues(size_type nPosition, size_type n, index_sequence<Is...>, const Ts&... values)
+	{
+		if((mnSize + n) > mnCapacity)
+		{
+			// The old elements, to which values may refer, stay alive until the new ones are constructed.
+			const size_type     nNewCapacity = eastl::max(GetNewCapacity(mnCapacity), mnSize + n);
+			const tuple<Ts*...> newColumns   = DoAllocate(nNewCapacity);
+
+			TupleVecInternal::ForEachColumn{ (DoInsertValuesRelocate(eastl::get<Is>(newColumns), eastl::get<Is>(mColumns), mnSize, nPosition, n, values), 0)... };
+
+			DoDestroy(mColumns, 0, mnSize, column_indices());
+			DoFree(mColumns, mnCapacity);
+
+			mColumns   = newColumns;
+			mnCapacity = nNewCapacity;
+		}
+		else
+		{
+			// Shifting the elements would change what values refers to if it refers to one of them.
+			const value_type temp(values...);
+
+			TupleVecInternal::ForEachColumn{ (DoInsertValuesInPlace(eastl::get<Is>(mColumns), mnSize, nPosition, n, eastl::get<Is>(temp)), 0)... };
+		}
+
+		mnSize += n;
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <typename T>
+	void tuple_vector_alloc<Allocator, Ts...>::DoInsertValuesInPlace(T* p, size_type nSize, size_type nPosition, size_type n, const T& value)
+	{
+		// This is the same shuffle as vector::DoInsertValues, applied to one column.
+		T* const        pPosition = p + nPosition;
+		T* const        pEnd      = p + nSize;
+		const size_type nExtra    = nSize - nPosition;
+
+		if(n < nExtra)
+		{
+			eastl::uninitialized_move_ptr(pEnd - n, pEnd, pEnd);
+			eastl::move_backward(pPosition, pEnd - n, pEnd);
+			eastl::fill(pPosition, pPosition + n, value);
+		}
+		else
+		{
+			eastl::uninitialized_fill_n_ptr(pEnd, n - nExtra, value);
+			eastl::uninitialized_move_ptr(pPosition, pEnd, pEnd + (n - nExtra));
+			eastl::fill(pPosition, pEnd, value);
+		}
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <typename T>
+	void tuple_vector_alloc<Allocator, Ts...>::DoInsertValuesRelocate(T* pDest, T* pSource, size_type nSize, size_type nPosition, size_type n, const T& value)
+	{
+		eastl::uninitialized_fill_n_ptr(pDest + nPosition, n, value);
+		eastl::uninitialized_move_ptr_if_noexcept(pSource, pSource + nPosition, pDest);
+		eastl::uninitialized_move_ptr_if_noexcept(pSource + nPosition, pSource + nSize, pDest + nPosition + n);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoErase(size_type first, size_type last, index_sequence<Is...>)
+	{
+		TupleVecInternal::ForEachColumn{ (DoEraseColumn(eastl::get<Is>(mColumns), mnSize, first, last), 0)... };
+		mnSize -= (last - first);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <typename T>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoEraseColumn(T* p, size_type nSize, size_type first, size_type last)
+	{
+		T* const pNewEnd = eastl::move(p + last, p + nSize, p + first);
+		eastl::destruct(pNewEnd, p + nSize);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	inline void tuple_vector_alloc<Allocator, Ts...>::DoEraseUnsorted(size_type nPosition, index_sequence<Is...>)
+	{
+		--mnSize;
+		TupleVecInternal::ForEachColumn{ ((eastl::get<Is>(mColumns)[nPosition] = eastl::move(eastl::get<Is>(mColumns)[mnSize])), 0)... };
+		DoDestroy(mColumns, mnSize, mnSize + 1, column_indices());
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+	tuple_vector_alloc<Allocator, Ts...>::DoGetReference(size_type n, index_sequence<Is...>)
+	{
+		return reference(eastl::get<Is>(mColumns)[n]...);
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	template <size_t... Is>
+	inline typename tuple_vector_alloc<Allocator, Ts...>::const_reference
+	tuple_vector_alloc<Allocator, Ts...>::DoGetReference(size_type n, index_sequence<Is...>) const
+	{
+		return const_reference(eastl::get<Is>(mColumns)[n]...);
+	}
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Allocator, typename... Ts>
+	inline bool operator==(const tuple_vector_alloc<Allocator, Ts...>& a, const tuple_vector_alloc<Allocator, Ts...>& b)
+	{
+		return ((a.size() == b.size()) && eastl::equal(a.begin(), a.end(), b.begin()));
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline bool operator!=(const tuple_vector_alloc<Allocator, Ts...>& a, const tuple_vector_alloc<Allocator, Ts...>& b)
+	{
+		return ((a.size() != b.size()) || !eastl::equal(a.begin(), a.end(), b.begin()));
+	}
+
+
+	template <typename Allocator, typename... Ts>
+	inline void swap(tuple_vector_alloc<Allocator, Ts...>& a, tuple_vector_alloc<Allocator, Ts...>& b)
+	{
+		a.swap(b);
+	}
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,442 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements btree_map and btree_multimap, B-tree based alternatives
+// to map and multimap. See internal/btree.h for a description of the design.
+//
+// btree_map and btree_multimap have the same interface as map and multimap,
+// with the following differences:
+//     - An additional nodeSize template parameter sets the target size in bytes
+//       of the tree's nodes.
+//     - Insertions and erasures invalidate all iterators, pointers and references
+//       to elements, as elements move between and within nodes.
+//     - There are no node handles, extract or merge, and no node_type suitable
+//       for pool allocation (nodes are of two different sizes).
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_BTREE_MAP_H
+#define EASTL_BTREE_MAP_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/btree.h>
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+
+#if EASTL_EXCEPTIONS_ENABLED
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <stdexcept> // std::out_of_range
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+
+	/// EASTL_BTREE_MAP_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_BTREE_MAP_DEFAULT_NAME
+		#define EASTL_BTREE_MAP_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " btree_map" // Unless the user overrides something, this is "EASTL btree_map".
+	#endif
+
+
+	/// EASTL_BTREE_MULTIMAP_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_BTREE_MULTIMAP_DEFAULT_NAME
+		#define EASTL_BTREE_MULTIMAP_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " btree_multimap" // Unless the user overrides something, this is "EASTL btree_multimap".
+	#endif
+
+
+	/// EASTL_BTREE_MAP_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_BTREE_MAP_DEFAULT_ALLOCATOR
+		#define EASTL_BTREE_MAP_DEFAULT_ALLOCATOR allocator_type(EASTL_BTREE_MAP_DEFAULT_NAME)
+	#endif
+
+	/// EASTL_BTREE_MULTIMAP_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_BTREE_MULTIMAP_DEFAULT_ALLOCATOR
+		#define EASTL_BTREE_MULTIMAP_DEFAULT_ALLOCATOR allocator_type(EASTL_BTREE_MULTIMAP_DEFAULT_NAME)
+	#endif
+
+
+
+	/// btree_map
+	///
+	/// Implements a map as a B-tree, which stores many elements per node. In
+	/// comparison to map, lookups and iteration touch far less memory and the
+	/// container uses far less of it, at the cost of moving elements on insertion
+	/// and erasure. btree_map is a good fit for large maps of small elements which
+	/// are looked up or iterated more often than they are modified.
+	///
+	/// Example usage:
+	///     eastl::btree_map<uint64_t, uint32_t> index;
+	///
+	///     for(uint64_t key : sortedKeys)
+	///         index.insert(index.end(), eastl::make_pair(key, value)); // Appending is cheap and leaves nodes full.
+	///
+	///     auto it = index.lower_bound(key);
+	///
+	template <typename Key, typename T, typename Compare = eastl::less<Key>, typename Allocator = EASTLAllocatorType,
+			  size_t nodeSize = EASTL_BTREE_DEFAULT_NODE_SIZE>
+	class btree_map
+		: public btree<Key, eastl::pair<const Key, T>, Compare, Allocator, eastl::use_first<eastl::pair<const Key, T> >, true, true, nodeSize>
+	{
+	public:
+		typedef btree<Key, eastl::pair<const Key, T>, Compare, Allocator,
+					  eastl::use_first<eastl::pair<const Key, T> >, true, true, nodeSize>  base_type;
+		typedef btree_map<Key, T, Compare, Allocator, nodeSize>                        this_type;
+		typedef typename base_type::size_type                                          size_type;
+		typedef typename base_type::key_type                                           key_type;
+		typedef T                                                                      mapped_type;
+		typedef typename base_type::value_type                                         value_type;
+		typedef typename base_type::iterator                                           iterator;
+		typedef typename base_type::const_iterator                                     const_iterator;
+		typedef typename base_type::allocator_type                                     allocator_type;
+		typedef typename base_type::insert_return_type                                 insert_return_type;
+		typedef typename base_type::extract_key                                        extract_key;
+		// Other types are inherited from the base class.
+
+		using base_type::begin;
+		using base_type::end;
+		using base_type::find;
+		using base_type::lower_bound;
+		using base_type::upper_bound;
+		using base_type::mCompare;
+		using base_type::insert;
+		using base_type::erase;
+		using base_type::try_emplace;
+
+		class value_compare
+		{
+		protected:
+			friend class btree_map;
+			Compare compare;
+			value_compare(Compare c) : compare(c) {}
+
+		public:
+			typedef bool       result_type;
+			typedef value_type first_argument_type;
+			typedef value_type second_argument_type;
+
+			bool operator()(const value_type& x, const value_type& y) const
+				{ return compare(x.first, y.first); }
+		};
+
+	public:
+		btree_map(const allocator_type& allocator = EASTL_BTREE_MAP_DEFAULT_ALLOCATOR)
+			: base_type(allocator) { }
+
+		btree_map(const Compare& compare, const allocator_type& allocator = EASTL_BTREE_MAP_DEFAULT_ALLOCATOR)
+			: base_type(compare, allocator) { }
+
+		btree_map(const this_type& x)
+			: base_type(x) { }
+
+		btree_map(this_type&& x)
+			: base_type(eastl::move(x)) { }
+
+		btree_map(this_type&& x, const allocator_type& allocator)
+			: base_type(eastl::move(x), allocator) { }
+
+		btree_map(std::initializer_list<value_type> ilist, const Compare& compare = Compare(), const allocator_type& allocator = EASTL_BTREE_MAP_DEFAULT_ALLOCATOR)
+			: base_type(ilist.begin(), ilist.end(), compare, allocator) { }
+
+		template <typename Iterator>
+		btree_map(Iterator itBegin, Iterator itEnd)
+			: base_type(itBegin, itEnd, Compare(), EASTL_BTREE_MAP_DEFAULT_ALLOCATOR) { }
+
+		this_type& operator=(const this_type& x) { return (this_type&)base_type::operator=(x); }
+		this_type& operator=(std::initializer_list<value_type> ilist) { return (this_type&)base_type::operator=(ilist); }
+		this_type& operator=(this_type&& x) { return (this_type&)base_type::operator=(eastl::move(x)); }
+
+	public:
+		/// This is an extension to the C++ standard. We insert a default-constructed
+		/// element with the given key, as map::insert(key) does.
+		insert_return_type insert(const Key& key)
+			{ return base_type::DoInsertKey(true_type(), key); }
+
+		value_compare value_comp() const
+			{ return value_compare(mCompare); }
+
+		size_type erase(const Key& key)
+		{
+			const iterator it(find(key));
+
+			if(it != end())
+			{
+				base_type::erase(it);
+				return 1;
+			}
+			return 0;
+		}
+
+		size_type count(const Key& key) const
+			{ return (find(key) != end()) ? (size_type)1 : (size_type)0; }
+
+		eastl::pair<iterator, iterator> equal_range(const Key& key)
+		{
+			const iterator itLower(lower_bound(key));
+
+			if((itLower == end()) || mCompare(key, itLower->first))
+				return eastl::pair<iterator, iterator>(itLower, itLower);
+
+			iterator itUpper(itLower);
+			return eastl::pair<iterator, iterator>(itLower, ++itUpper);
+		}
+
+		eastl::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+		{
+			const const_iterator itLower(lower_bound(key));
+
+			if((itLower == end()) || mCompare(key, itLower->first))
+				return eastl::pair<const_iterator, const_iterator>(itLower, itLower);
+
+			const_iterator itUpper(itLower);
+			return eastl::pair<const_iterator, const_iterator>(itLower, ++itUpper);
+		}
+
+		template <class M>
+		eastl::pair<iterator, bool> insert_or_assign(const key_type& k, M&& obj)
+		{
+			const iterator it(find(k));
+
+			if(it == end())
+				return insert(value_type(piecewise_construct, eastl::forward_as_tuple(k), eastl::forward_as_tuple(eastl::forward<M>(obj))));
+
+			it->second = eastl::forward<M>(obj);
+			return eastl::pair<iterator, bool>(it, false);
+		}
+
+		template <class M>
+		eastl::pair<iterator, bool> insert_or_assign(key_type&& k, M&& obj)
+		{
+			const iterator it(find(k));
+
+			if(it == end())
+				return insert(value_type(piecewise_construct, eastl::forward_as_tuple(eastl::move(k)), eastl::forward_as_tuple(eastl::forward<M>(obj))));
+
+			it->second = eastl::forward<M>(obj);
+			return eastl::pair<iterator, bool>(it, false);
+		}
+
+		template <class M>
+		iterator insert_or_assign(const_iterator hint, const key_type& k, M&& obj)
+		{
+			const iterator it(find(k));
+
+			if(it == end())
+				return insert(hint, value_type(piecewise_construct, eastl::forward_as_tuple(k), eastl::forward_as_tuple(eastl::forward<M>(obj))));
+
+			it->second = eastl::forward<M>(obj);
+			return it;
+		}
+
+		template <class M>
+		iterator insert_or_assign(const_iterator hint, key_type&& k, M&& obj)
+		{
+			const iterator it(find(k));
+
+			if(it == end())
+				return insert(hint, value_type(piecewise_construct, eastl::forward_as_tuple(eastl::move(k)), eastl::forward_as_tuple(eastl::forward<M>(obj))));
+
+			it->second = eastl::forward<M>(obj);
+			return it;
+		}
+
+		T& operator[](const Key& key) // Of the btree containers, only btree_map has operator[].
+			{ return try_emplace(key).first->second; }
+
+		T& operator[](Key&& key)
+			{ return try_emplace(eastl::move(key)).first->second; }
+
+		T& at(const Key& key)
+		{
+			const iterator it(find(key));
+
+			if(it == end())
+			{
+				#if EASTL_EXCEPTIONS_ENABLED
+					throw std::out_of_range("btree_map::at key does not exist");
+				#else
+					EASTL_FAIL_MSG("btree_map::at key does not exist");
+				#endif
+			}
+
+			return it->second;
+		}
+
+		const T& at(const Key& key) const
+		{
+			const const_iterator it(find(key));
+
+			if(it == end())
+			{
+				#if EASTL_EXCEPTIONS_ENABLED
+					throw std::out_of_range("btree_map::at key does not exist");
+				#else
+					EASTL_FAIL_MSG("btree_map::at key does not exist");
+				#endif
+			}
+
+			return it->second;
+		}
+
+	}; // btree_map
+
+
+
+
+	/// btree_multimap
+	///
+	/// Implements a multimap as a B-tree. See btree_map.
+	///
+	template <typename Key, typename T, typename Compare = eastl::less<Key>, typename Allocator = EASTLAllocatorType,
+			  size_t nodeSize = EASTL_BTREE_DEFAULT_NODE_SIZE>
+	class btree_multimap
+		: public btree<Key, eastl::pair<const Key, T>, Compare, Allocator, eastl::use_first<eastl::pair<const Key, T> >, true, false, nodeSize>
+	{
+	public:
+		typedef btree<Key, eastl::pair<const Key, T>, Compare, Allocator,
+					  eastl::use_first<eastl::pair<const Key, T> >, true, false, nodeSize> base_type;
+		typedef btree_multimap<Key, T, Compare, Allocator, nodeSize>                   this_type;
+		typedef typename base_type::size_type                                          size_type;
+		typedef typename base_type::key_type                                           key_type;
+		typedef T                                                                      mapped_type;
+		typedef typename base_type::value_type                                         value_type;
+		typedef typename base_type::iterator                                           iterator;
+		typedef typename base_type::const_iterator                                     const_iterator;
+		typedef typename base_type::allocator_type                                     allocator_type;
+		typedef typename base_type::insert_return_type                                 insert_return_type;
+		typedef typename base_type::extract_key                                        extract_key;
+		// Other types are inherited from the base class.
+
+		using base_type::begin;
+		using base_type::end;
+		using base_type::find;
+		using base_type::lower_bound;
+		using base_type::upper_bound;
+		using base_type::mCompare;
+		using base_type::insert;
+		using base_type::erase;
+
+		class value_compare
+		{
+		protected:
+			friend class btree_multimap;
+			Compare compare;
+			value_compare(Compare c) : compare(c) {}
+
+		public:
+			typedef bool       result_type;
+			typedef value_type first_argument_type;
+			typedef value_type second_argument_type;
+
+			bool operator()(const value_type& x, const value_type& y) const
+				{ return compare(x.first, y.first); }
+		};
+
+	public:
+		btree_multimap(const allocator_type& allocator = EASTL_BTREE_MULTIMAP_DEFAULT_ALLOCATOR)
+			: base_type(allocator) { }
+
+		btree_multimap(const Compare& compare, const allocator_type& allocator = EASTL_BTREE_MULTIMAP_DEFAULT_ALLOCATOR)
+			: base_type(compare, allocator) { }
+
+		btree_multimap(const this_type& x)
+			: base_type(x) { }
+
+		btree_multimap(this_type&& x)
+			: base_type(eastl::move(x)) { }
+
+		btree_multimap(this_type&& x, const allocator_type& allocator)
+			: base_type(eastl::move(x), allocator) { }
+
+		btree_multimap(std::initializer_list<value_type> ilist, const Compare& compare = Compare(), const allocator_type& allocator = EASTL_BTREE_MULTIMAP_DEFAULT_ALLOCATOR)
+			: base_type(ilist.begin(), ilist.end(), compare, allocator) { }
+
+		template <typename Iterator>
+		btree_multimap(Iterator itBegin, Iterator itEnd)
+			: base_type(itBegin, itEnd, Compare(), EASTL_BTREE_MULTIMAP_DEFAULT_ALLOCATOR) { }
+
+		this_type& operator=(const this_type& x) { return (this_type&)base_type::operator=(x); }
+		this_type& operator=(std::initializer_list<value_type> ilist) { return (this_type&)base_type::operator=(ilist); }
+		this_type& operator=(this_type&& x) { return (this_type&)base_type::operator=(eastl::move(x)); }
+
+	public:
+		/// This is an extension to the C++ standard. We insert a default-constructed
+		/// element with the given key, as multimap::insert(key) does.
+		insert_return_type insert(const Key& key)
+			{ return base_type::DoInsertKey(false_type(), key); }
+
+		value_compare value_comp() const
+			{ return value_compare(mCompare); }
+
+		size_type erase(const Key& key)
+		{
+			const eastl::pair<iterator, iterator> range(equal_range(key));
+			const size_type n = (size_type)eastl::distance(range.first, range.second);
+			base_type::erase(range.first, range.second);
+			return n;
+		}
+
+		size_type count(const Key& key) const
+		{
+			const eastl::pair<const_iterator, const_iterator> range(equal_range(key));
+			return (size_type)eastl::distance(range.first, range.second);
+		}
+
+		eastl::pair<iterator, iterator> equal_range(const Key& key)
+			{ return eastl::pair<iterator, iterator>(lower_bound(key), upper_bound(key)); }
+
+		eastl::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+			{ return eastl::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key)); }
+
+		/// equal_range_small
+		/// This is a special version of equal_range which is optimized for the
+		/// case of there being few or no duplicated keys in the tree.
+		eastl::pair<iterator, iterator> equal_range_small(const Key& key)
+		{
+			const iterator itLower(lower_bound(key));
+			iterator       itUpper(itLower);
+
+			while((itUpper != end()) && !mCompare(key, itUpper->first))
+				++itUpper;
+
+			return eastl::pair<iterator, iterator>(itLower, itUpper);
+		}
+
+		eastl::pair<const_iterator, const_iterator> equal_range_small(const Key& key) const
+		{
+			const const_iterator itLower(lower_bound(key));
+			const_iterator       itUpper(itLower);
+
+			while((itUpper != end()) && !mCompare(key, itUpper->first))
+				++itUpper;
+
+			return eastl::pair<const_iterator, const_iterator>(itLower, itUpper);
+		}
+
+
+	private:
+		// these base member functions are not included in multimaps
+		using base_type::try_emplace;
+	}; // btree_multimap
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,281 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements btree_set and btree_multiset, B-tree based alternatives
+// to set and multiset. See internal/btree.h for a description of the design,
+// and btree_map.h for how these containers differ from their rbtree-based
+// counterparts.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_BTREE_SET_H
+#define EASTL_BTREE_SET_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/btree.h>
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+
+	/// EASTL_BTREE_SET_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_BTREE_SET_DEFAULT_NAME
+		#define EASTL_BTREE_SET_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " btree_set" // Unless the user overrides something, this is "EASTL btree_set".
+	#endif
+
+
+	/// EASTL_BTREE_MULTISET_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_BTREE_MULTISET_DEFAULT_NAME
+		#define EASTL_BTREE_MULTISET_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " btree_multiset" // Unless the user overrides something, this is "EASTL btree_multiset".
+	#endif
+
+
+	/// EASTL_BTREE_SET_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_BTREE_SET_DEFAULT_ALLOCATOR
+		#define EASTL_BTREE_SET_DEFAULT_ALLOCATOR allocator_type(EASTL_BTREE_SET_DEFAULT_NAME)
+	#endif
+
+	/// EASTL_BTREE_MULTISET_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_BTREE_MULTISET_DEFAULT_ALLOCATOR
+		#define EASTL_BTREE_MULTISET_DEFAULT_ALLOCATOR allocator_type(EASTL_BTREE_MULTISET_DEFAULT_NAME)
+	#endif
+
+
+
+	/// btree_set
+	///
+	/// Implements a set as a B-tree. See btree_map.
+	///
+	/// As with set, iterator and const_iterator are both const iterators, as
+	/// modifying a value could change its position in the tree.
+	///
+	template <typename Key, typename Compare = eastl::less<Key>, typename Allocator = EASTLAllocatorType,
+			  size_t nodeSize = EASTL_BTREE_DEFAULT_NODE_SIZE>
+	class btree_set
+		: public btree<Key, Key, Compare, Allocator, eastl::use_self<Key>, false, true, nodeSize>
+	{
+	public:
+		typedef btree<Key, Key, Compare, Allocator, eastl::use_self<Key>, false, true, nodeSize> base_type;
+		typedef btree_set<Key, Compare, Allocator, nodeSize>                                  this_type;
+		typedef typename base_type::size_type                                                 size_type;
+		typedef typename base_type::value_type                                                value_type;
+		typedef typename base_type::iterator                                                  iterator;
+		typedef typename base_type::const_iterator                                            const_iterator;
+		typedef typename base_type::reverse_iterator                                          reverse_iterator;
+		typedef typename base_type::const_reverse_iterator                                    const_reverse_iterator;
+		typedef typename base_type::allocator_type                                            allocator_type;
+		typedef Compare                                                                       value_compare;
+		// Other types are inherited from the base class.
+
+		using base_type::begin;
+		using base_type::end;
+		using base_type::find;
+		using base_type::lower_bound;
+		using base_type::upper_bound;
+		using base_type::mCompare;
+		using base_type::erase;
+
+	public:
+		btree_set(const allocator_type& allocator = EASTL_BTREE_SET_DEFAULT_ALLOCATOR)
+			: base_type(allocator) { }
+
+		btree_set(const Compare& compare, const allocator_type& allocator = EASTL_BTREE_SET_DEFAULT_ALLOCATOR)
+			: base_type(compare, allocator) { }
+
+		btree_set(const this_type& x)
+			: base_type(x) { }
+
+		btree_set(this_type&& x)
+			: base_type(eastl::move(x)) { }
+
+		btree_set(this_type&& x, const allocator_type& allocator)
+			: base_type(eastl::move(x), allocator) { }
+
+		btree_set(std::initializer_list<value_type> ilist, const Compare& compare = Compare(), const allocator_type& allocator = EASTL_BTREE_SET_DEFAULT_ALLOCATOR)
+			: base_type(ilist.begin(), ilist.end(), compare, allocator) { }
+
+		template <typename Iterator>
+		btree_set(Iterator itBegin, Iterator itEnd)
+			: base_type(itBegin, itEnd, Compare(), EASTL_BTREE_SET_DEFAULT_ALLOCATOR) { }
+
+		this_type& operator=(const this_type& x) { return (this_type&)base_type::operator=(x); }
+		this_type& operator=(std::initializer_list<value_type> ilist) { return (this_type&)base_type::operator=(ilist); }
+		this_type& operator=(this_type&& x) { return (this_type&)base_type::operator=(eastl::move(x)); }
+
+	public:
+		value_compare value_comp() const
+			{ return mCompare; }
+
+		size_type erase(const Key& k)
+		{
+			const iterator it(find(k));
+
+			if(it != end())
+			{
+				base_type::erase(it);
+				return 1;
+			}
+			return 0;
+		}
+
+		size_type count(const Key& k) const
+			{ return (find(k) != end()) ? (size_type)1 : (size_type)0; }
+
+		eastl::pair<iterator, iterator> equal_range(const Key& k)
+		{
+			const iterator itLower(lower_bound(k));
+
+			if((itLower == end()) || mCompare(k, *itLower))
+				return eastl::pair<iterator, iterator>(itLower, itLower);
+
+			iterator itUpper(itLower);
+			return eastl::pair<iterator, iterator>(itLower, ++itUpper);
+		}
+
+		eastl::pair<const_iterator, const_iterator> equal_range(const Key& k) const
+		{
+			const const_iterator itLower(lower_bound(k));
+
+			if((itLower == end()) || mCompare(k, *itLower))
+				return eastl::pair<const_iterator, const_iterator>(itLower, itLower);
+
+			const_iterator itUpper(itLower);
+			return eastl::pair<const_iterator, const_iterator>(itLower, ++itUpper);
+		}
+
+	}; // btree_set
+
+
+
+
+	/// btree_multiset
+	///
+	/// Implements a multiset as a B-tree. See btree_map.
+	///
+	template <typename Key, typename Compare = eastl::less<Key>, typename Allocator = EASTLAllocatorType,
+			  size_t nodeSize = EASTL_BTREE_DEFAULT_NODE_SIZE>
+	class btree_multiset
+		: public btree<Key, Key, Compare, Allocator, eastl::use_self<Key>, false, false, nodeSize>
+	{
+	public:
+		typedef btree<Key, Key, Compare, Allocator, eastl::use_self<Key>, false, false, nodeSize> base_type;
+		typedef btree_multiset<Key, Compare, Allocator, nodeSize>                              this_type;
+		typedef typename base_type::size_type                                                  size_type;
+		typedef typename base_type::value_type                                                 value_type;
+		typedef typename base_type::iterator                                                   iterator;
+		typedef typename base_type::const_iterator                                             const_iterator;
+		typedef typename base_type::reverse_iterator                                           reverse_iterator;
+		typedef typename base_type::const_reverse_iterator                                     const_reverse_iterator;
+		typedef typename base_type::allocator_type                                             allocator_type;
+		typedef Compare                                                                        value_compare;
+		// Other types are inherited from the base class.
+
+		using base_type::begin;
+		using base_type::end;
+		using base_type::find;
+		using base_type::lower_bound;
+		using base_type::upper_bound;
+		using base_type::mCompare;
+		using base_type::erase;
+
+	public:
+		btree_multiset(const allocator_type& allocator = EASTL_BTREE_MULTISET_DEFAULT_ALLOCATOR)
+			: base_type(allocator) { }
+
+		btree_multiset(const Compare& compare, const allocator_type& allocator = EASTL_BTREE_MULTISET_DEFAULT_ALLOCATOR)
+			: base_type(compare, allocator) { }
+
+		btree_multiset(const this_type& x)
+			: base_type(x) { }
+
+		btree_multiset(this_type&& x)
+			: base_type(eastl::move(x)) { }
+
+		btree_multiset(this_type&& x, const allocator_type& allocator)
+			: base_type(eastl::move(x), allocator) { }
+
+		btree_multiset(std::initializer_list<value_type> ilist, const Compare& compare = Compare(), const allocator_type& allocator = EASTL_BTREE_MULTISET_DEFAULT_ALLOCATOR)
+			: base_type(ilist.begin(), ilist.end(), compare, allocator) { }
+
+		template <typename Iterator>
+		btree_multiset(Iterator itBegin, Iterator itEnd)
+			: base_type(itBegin, itEnd, Compare(), EASTL_BTREE_MULTISET_DEFAULT_ALLOCATOR) { }
+
+		this_type& operator=(const this_type& x) { return (this_type&)base_type::operator=(x); }
+		this_type& operator=(std::initializer_list<value_type> ilist) { return (this_type&)base_type::operator=(ilist); }
+		this_type& operator=(this_type&& x) { return (this_type&)base_type::operator=(eastl::move(x)); }
+
+	public:
+		value_compare value_comp() const
+			{ return mCompare; }
+
+		size_type erase(const Key& k)
+		{
+			const eastl::pair<iterator, iterator> range(equal_range(k));
+			const size_type n = (size_type)eastl::distance(range.first, range.second);
+			base_type::erase(range.first, range.second);
+			return n;
+		}
+
+		size_type count(const Key& k) const
+		{
+			const eastl::pair<const_iterator, const_iterator> range(equal_range(k));
+			return (size_type)eastl::distance(range.first, range.second);
+		}
+
+		eastl::pair<iterator, iterator> equal_range(const Key& k)
+			{ return eastl::pair<iterator, iterator>(lower_bound(k), upper_bound(k)); }
+
+		eastl::pair<const_iterator, const_iterator> equal_range(const Key& k) const
+			{ return eastl::pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)); }
+
+		/// equal_range_small
+		/// This is a special version of equal_range which is optimized for the
+		/// case of there being few or no duplicated keys in the tree.
+		eastl::pair<iterator, iterator> equal_range_small(const Key& k)
+		{
+			const iterator itLower(lower_bound(k));
+			iterator       itUpper(itLower);
+
+			while((itUpper != end()) && !mCompare(k, *itUpper))
+				++itUpper;
+
+			return eastl::pair<iterator, iterator>(itLower, itUpper);
+		}
+
+		eastl::pair<const_iterator, const_iterator> equal_range_small(const Key& k) const
+		{
+			const const_iterator itLower(lower_bound(k));
+			const_iterator       itUpper(itLower);
+
+			while((itUpper != end()) && !mCompare(k, *itUpper))
+				++itUpper;
+
+			return eastl::pair<const_iterator, const_iterator>(itLower, itUpper);
+		}
+
+	}; // btree_multiset
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
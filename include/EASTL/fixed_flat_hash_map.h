@@ -0,0 +1,384 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements a flat_hash_map which uses a fixed size memory buffer
+// for its control bytes and element slots.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_FIXED_FLAT_HASH_MAP_H
+#define EASTL_FIXED_FLAT_HASH_MAP_H
+
+
+#include <EASTL/flat_hash_map.h>
+#include <EASTL/internal/fixed_pool.h>
+
+EA_DISABLE_VC_WARNING(4127) // Conditional expression is constant
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+namespace eastl
+{
+	/// EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	/// In the case of fixed-size containers, the allocator name always refers
+	/// to overflow allocations.
+	///
+	#ifndef EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_NAME
+		#define EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " fixed_flat_hash_map" // Unless the user overrides something, this is "EASTL fixed_flat_hash_map".
+	#endif
+
+
+	/// EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_ALLOCATOR
+		#define EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_ALLOCATOR overflow_allocator_type(EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_NAME)
+	#endif
+
+
+
+	/// fixed_flat_hash_map
+	///
+	/// Implements a flat_hash_map with a fixed block of memory sized to hold nodeCount elements.
+	/// The control bytes and slots of the table live within the container itself, so
+	/// a fixed_flat_hash_map which never exceeds nodeCount elements does no heap allocation.
+	/// When bEnableOverflow is true and more than nodeCount elements are inserted, the
+	/// table moves to a larger block from the overflow allocator, just like flat_hash_map does.
+	///
+	/// Template parameters:
+	///     Key                    The key type for the map. This is a map of Key to T (value).
+	///     T                      The value type for the map.
+	///     nodeCount              The max number of objects to contain. This value must be >= 1.
+	///     bEnableOverflow        Whether or not we should use the global heap if our buffer is exhausted.
+	///     Hash                   flat_hash_map hash function. See flat_hash_map.
+	///     Predicate              flat_hash_map equality testing function. See flat_hash_map.
+	///
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow = true, typename Hash = eastl::hash<Key>,
+			  typename Predicate = eastl::equal_to<Key>, typename OverflowAllocator = EASTLAllocatorType>
+	class fixed_flat_hash_map : public flat_hash_map<Key, T,
+	                                   Hash,
+	                                   Predicate,
+	                                   fixed_flat_table_allocator<
+	                                        Internal::flat_table_layout<nodeCount, sizeof(eastl::pair<const Key, T>), EASTL_ALIGN_OF(eastl::pair<const Key, T>)>::kAllocSize,
+	                                        EASTL_ALIGN_OF(eastl::pair<const Key, T>),
+	                                        bEnableOverflow,
+	                                        OverflowAllocator> >
+	{
+	public:
+		typedef fixed_flat_table_allocator<Internal::flat_table_layout<nodeCount, sizeof(eastl::pair<const Key, T>), EASTL_ALIGN_OF(eastl::pair<const Key, T>)>::kAllocSize,
+		                                   EASTL_ALIGN_OF(eastl::pair<const Key, T>), bEnableOverflow, OverflowAllocator>               fixed_allocator_type;
+		typedef typename fixed_allocator_type::overflow_allocator_type                                                  overflow_allocator_type;
+		typedef flat_hash_map<Key, T, Hash, Predicate, fixed_allocator_type>                                                   base_type;
+		typedef fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>                    this_type;
+		typedef typename base_type::value_type                                                                          value_type;
+		typedef typename base_type::size_type                                                                           size_type;
+
+		enum { kMaxSize = nodeCount };
+
+		using base_type::mAllocator;
+		using base_type::clear;
+
+	protected:
+		char mBuffer[fixed_allocator_type::kBufferSize]; // kBufferSize will take into account alignment requirements.
+
+	public:
+		explicit fixed_flat_hash_map(const overflow_allocator_type& overflowAllocator);
+
+		explicit fixed_flat_hash_map(const Hash& hashFunction = Hash(),
+		                      const Predicate& predicate = Predicate());
+
+		fixed_flat_hash_map(const Hash& hashFunction,
+		             const Predicate& predicate,
+		             const overflow_allocator_type& overflowAllocator);
+
+		template <typename InputIterator>
+		fixed_flat_hash_map(InputIterator first, InputIterator last,
+		             const Hash& hashFunction = Hash(),
+		             const Predicate& predicate = Predicate());
+
+		fixed_flat_hash_map(const this_type& x);
+		fixed_flat_hash_map(this_type&& x);
+		fixed_flat_hash_map(this_type&& x, const overflow_allocator_type& overflowAllocator);
+		fixed_flat_hash_map(std::initializer_list<value_type> ilist, const overflow_allocator_type& overflowAllocator = EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_ALLOCATOR);
+
+		this_type& operator=(const this_type& x);
+		this_type& operator=(std::initializer_list<value_type> ilist);
+		this_type& operator=(this_type&& x);
+
+		void swap(this_type& x);
+
+		void reset_lose_memory(); // This is a unilateral reset to an initially empty state. No destructors are called, no deallocation occurs.
+
+		size_type max_size() const;
+
+		const overflow_allocator_type& get_overflow_allocator() const EA_NOEXCEPT;
+		overflow_allocator_type&       get_overflow_allocator() EA_NOEXCEPT;
+		void                           set_overflow_allocator(const overflow_allocator_type& allocator);
+
+		void clear(bool clearBuckets);
+
+	protected:
+		void DoInitBuffer();
+	}; // fixed_flat_hash_map
+
+
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// fixed_flat_hash_map
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	fixed_flat_hash_map(const overflow_allocator_type& overflowAllocator)
+		: base_type(0, Hash(), Predicate(), fixed_allocator_type(NULL, overflowAllocator))
+	{
+		#if EASTL_NAME_ENABLED
+			mAllocator.set_name(EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_NAME);
+		#endif
+
+		DoInitBuffer();
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	fixed_flat_hash_map(const Hash& hashFunction,
+	             const Predicate& predicate)
+		: base_type(0, hashFunction, predicate, fixed_allocator_type(NULL))
+	{
+		#if EASTL_NAME_ENABLED
+			mAllocator.set_name(EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_NAME);
+		#endif
+
+		DoInitBuffer();
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	fixed_flat_hash_map(const Hash& hashFunction,
+	             const Predicate& predicate,
+	             const overflow_allocator_type& overflowAllocator)
+		: base_type(0, hashFunction, predicate, fixed_allocator_type(NULL, overflowAllocator))
+	{
+		#if EASTL_NAME_ENABLED
+			mAllocator.set_name(EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_NAME);
+		#endif
+
+		DoInitBuffer();
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	template <typename InputIterator>
+	fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	fixed_flat_hash_map(InputIterator first, InputIterator last,
+	             const Hash& hashFunction,
+	             const Predicate& predicate)
+		: base_type(0, hashFunction, predicate, fixed_allocator_type(NULL))
+	{
+		#if EASTL_NAME_ENABLED
+			mAllocator.set_name(EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_NAME);
+		#endif
+
+		DoInitBuffer();
+		base_type::insert(first, last);
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	fixed_flat_hash_map(const this_type& x)
+		: base_type(0, x.hash_function(), x.key_eq(), fixed_allocator_type(NULL))
+	{
+		mAllocator.copy_overflow_allocator(x.mAllocator);
+
+		#if EASTL_NAME_ENABLED
+			mAllocator.set_name(x.mAllocator.get_name());
+		#endif
+
+		DoInitBuffer();
+		base_type::insert(x.begin(), x.end());
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	fixed_flat_hash_map(this_type&& x)
+		: base_type(0, x.hash_function(), x.key_eq(), fixed_allocator_type(NULL))
+	{
+		// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
+		mAllocator.copy_overflow_allocator(x.mAllocator);
+
+		#if EASTL_NAME_ENABLED
+			mAllocator.set_name(x.mAllocator.get_name());
+		#endif
+
+		DoInitBuffer();
+		base_type::insert(x.begin(), x.end());
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	fixed_flat_hash_map(this_type&& x, const overflow_allocator_type& overflowAllocator)
+		: base_type(0, x.hash_function(), x.key_eq(), fixed_allocator_type(NULL, overflowAllocator))
+	{
+		// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
+		mAllocator.copy_overflow_allocator(x.mAllocator);
+
+		#if EASTL_NAME_ENABLED
+			mAllocator.set_name(x.mAllocator.get_name());
+		#endif
+
+		DoInitBuffer();
+		base_type::insert(x.begin(), x.end());
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	fixed_flat_hash_map(std::initializer_list<value_type> ilist, const overflow_allocator_type& overflowAllocator)
+		: base_type(0, Hash(), Predicate(), fixed_allocator_type(NULL, overflowAllocator))
+	{
+		#if EASTL_NAME_ENABLED
+			mAllocator.set_name(EASTL_FIXED_FLAT_HASH_MAP_DEFAULT_NAME);
+		#endif
+
+		DoInitBuffer();
+		base_type::insert(ilist.begin(), ilist.end());
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline typename fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::this_type&
+	fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::operator=(const this_type& x)
+	{
+		base_type::operator=(x);
+		return *this;
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline typename fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::this_type&
+	fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::operator=(this_type&& x)
+	{
+		base_type::operator=(x); // We copy instead of move, as our buffer can't be given to x.
+		return *this;
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline typename fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::this_type&
+	fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::operator=(std::initializer_list<value_type> ilist)
+	{
+		base_type::clear();
+		base_type::insert(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline void fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	swap(this_type& x)
+	{
+		// Fixed containers use a special swap that can deal with excessively large buffers.
+		eastl::fixed_swap(*this, x);
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline void fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	reset_lose_memory()
+	{
+		base_type::reset_lose_memory();
+		DoInitBuffer();
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline typename fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::size_type
+	fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::max_size() const
+	{
+		return kMaxSize;
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline const typename fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::overflow_allocator_type&
+	fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::get_overflow_allocator() const EA_NOEXCEPT
+	{
+		return mAllocator.get_overflow_allocator();
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline typename fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::overflow_allocator_type&
+	fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::get_overflow_allocator() EA_NOEXCEPT
+	{
+		return mAllocator.get_overflow_allocator();
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline void fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	set_overflow_allocator(const overflow_allocator_type& allocator)
+	{
+		mAllocator.set_overflow_allocator(allocator);
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline void fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	clear(bool clearBuckets)
+	{
+		if(clearBuckets)
+		{
+			// Free any overflow memory and go back to using our buffer.
+			base_type::clear(true);
+			DoInitBuffer();
+		}
+		else
+			base_type::clear();
+	}
+
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline void fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>::
+	DoInitBuffer()
+	{
+		EASTL_CT_ASSERT(nodeCount >= 1);
+
+		mAllocator.reset(mBuffer);
+		base_type::reserve((size_type)nodeCount); // This allocates exactly our buffer, as it was sized by the same computation.
+		EASTL_ASSERT(!mAllocator.can_allocate());
+	}
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Key, typename T, size_t nodeCount, bool bEnableOverflow, typename Hash, typename Predicate, typename OverflowAllocator>
+	inline void swap(fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>& a,
+	                 fixed_flat_hash_map<Key, T, nodeCount, bEnableOverflow, Hash, Predicate, OverflowAllocator>& b)
+	{
+		// Fixed containers use a special swap that can deal with excessively large buffers.
+		eastl::fixed_swap(a, b);
+	}
+
+
+} // namespace eastl
+
+EA_RESTORE_VC_WARNING()
+
+#endif // Header include guard
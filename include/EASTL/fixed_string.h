@@ -812,6 +812,31 @@ namespace eastl
 	}
 
 
+	/// hash<fixed_string>
+	///
+	/// Hashes the same as the equivalent basic_string, string_view or character 
+	/// pointer, so that (for example) find_as can be used across them.
+	///
+	/// Example usage:
+	///    #include <EASTL/hash_set.h>
+	///    hash_set<fixed_string<char, 64> > stringHashSet;
+	///
+	template <typename T> struct hash;
+
+	template <typename T, int nodeCount, bool bEnableOverflow, typename OverflowAllocator>
+	struct hash< fixed_string<T, nodeCount, bEnableOverflow, OverflowAllocator> >
+	{
+		size_t operator()(const fixed_string<T, nodeCount, bEnableOverflow, OverflowAllocator>& x) const
+		{
+			#if EASTL_STRING_HASH_LEGACY
+				return eastl::string_hash< fixed_string<T, nodeCount, bEnableOverflow, OverflowAllocator> >()(x);
+			#else
+				return Internal::HashString(x.data(), x.size());
+			#endif
+		}
+	};
+
+
 } // namespace eastl
 
 #endif // Header include guard
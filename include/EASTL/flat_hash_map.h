@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements flat_hash_map, an open-addressing alternative to
+// hash_map. See internal/flat_hashtable.h for a description of the design.
+//
+// flat_hash_map has the same interface as hash_map (including find_as,
+// try_emplace, insert_or_assign, the insert(key) extension and validate),
+// with the following differences:
+//     - There is no bCacheHashCode template parameter. The table stores seven
+//       bits of each element's hash in its control bytes, which removes
+//       nearly all redundant key comparisons without caching the full hash.
+//     - Element addresses are not stable. Iterators and references to elements
+//       are invalidated by any insertion which grows the table and by rehash.
+//     - There is no load factor to configure; the table grows at 7/8 full.
+//     - There is no flat_hash_multimap.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_FLAT_HASH_MAP_H
+#define EASTL_FLAT_HASH_MAP_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/flat_hashtable.h>
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+
+	/// EASTL_FLAT_HASH_MAP_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_FLAT_HASH_MAP_DEFAULT_NAME
+		#define EASTL_FLAT_HASH_MAP_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " flat_hash_map" // Unless the user overrides something, this is "EASTL flat_hash_map".
+	#endif
+
+
+	/// EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR
+		#define EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR allocator_type(EASTL_FLAT_HASH_MAP_DEFAULT_NAME)
+	#endif
+
+
+
+	/// flat_hash_map
+	///
+	/// Implements a flat_hash_map, which is a hashed associative container
+	/// which stores its elements directly in an open-addressed slot array.
+	/// Lookups are O(1) and, in comparison to hash_map, usually involve one
+	/// less cache miss and no division.
+	///
+	/// find_as
+	/// In order to support the ability to have a hashtable of strings but
+	/// be able to do efficiently lookups via char pointers (i.e. so they
+	/// aren't converted to string objects), we provide the find_as
+	/// function. This function allows you to do a find with a key of a
+	/// type other than the hashtable key type.
+	///
+	/// Example find_as usage:
+	///     flat_hash_map<string, int> hashMap;
+	///     i = hashMap.find_as("hello");    // Use default hash and compare.
+	///
+	/// Example find_as usage (namespaces omitted for brevity):
+	///     flat_hash_map<string, int> hashMap;
+	///     i = hashMap.find_as("hello", hash<char*>(), equal_to_2<string, char*>());
+	///
+	template <typename Key, typename T, typename Hash = eastl::hash<Key>, typename Predicate = eastl::equal_to<Key>,
+			  typename Allocator = EASTLAllocatorType>
+	class flat_hash_map
+		: public flat_hashtable<Key, eastl::pair<const Key, T>, Allocator, eastl::use_first<eastl::pair<const Key, T> >, Predicate, Hash, true>
+	{
+	public:
+		typedef flat_hashtable<Key, eastl::pair<const Key, T>, Allocator,
+		                       eastl::use_first<eastl::pair<const Key, T> >,
+		                       Predicate, Hash, true>                           base_type;
+		typedef flat_hash_map<Key, T, Hash, Predicate, Allocator>               this_type;
+		typedef typename base_type::size_type                                   size_type;
+		typedef typename base_type::key_type                                    key_type;
+		typedef T                                                               mapped_type;
+		typedef typename base_type::value_type                                  value_type;     // Note that this is pair<const key_type, mapped_type>.
+		typedef typename base_type::allocator_type                              allocator_type;
+		typedef typename base_type::insert_return_type                          insert_return_type;
+		typedef typename base_type::iterator                                    iterator;
+		typedef typename base_type::const_iterator                              const_iterator;
+
+		using base_type::insert;
+
+	public:
+		/// flat_hash_map
+		///
+		/// Default constructor.
+		///
+		explicit flat_hash_map(const allocator_type& allocator = EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR)
+			: base_type(0, Hash(), Predicate(), allocator)
+		{
+			// Empty
+		}
+
+
+		/// flat_hash_map
+		///
+		/// Constructor which creates an empty container with at least nBucketCount slots.
+		/// Use reserve() instead if what you know is the number of elements to be inserted.
+		///
+		explicit flat_hash_map(size_type nBucketCount, const Hash& hashFunction = Hash(),
+							   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR)
+			: base_type(nBucketCount, hashFunction, predicate, allocator)
+		{
+			// Empty
+		}
+
+
+		flat_hash_map(const this_type& x)
+		  : base_type(x)
+		{
+		}
+
+
+		flat_hash_map(this_type&& x)
+		  : base_type(eastl::move(x))
+		{
+		}
+
+
+		flat_hash_map(this_type&& x, const allocator_type& allocator)
+		  : base_type(eastl::move(x), allocator)
+		{
+		}
+
+
+		/// flat_hash_map
+		///
+		/// initializer_list-based constructor.
+		/// Allows for initializing with brace values (e.g. flat_hash_map<int, char*> hm = { {3,"c"}, {4,"d"}, {5,"e"} }; )
+		///
+		flat_hash_map(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(),
+					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR)
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, predicate, allocator)
+		{
+			// Empty
+		}
+
+
+		/// flat_hash_map
+		///
+		/// An input bucket count of <= 1 causes the table to be sized for the
+		/// number of elements in the input range.
+		///
+		template <typename ForwardIterator>
+		flat_hash_map(ForwardIterator first, ForwardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(),
+					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR)
+			: base_type(first, last, nBucketCount, hashFunction, predicate, allocator)
+		{
+			// Empty
+		}
+
+
+		this_type& operator=(const this_type& x)
+		{
+			return static_cast<this_type&>(base_type::operator=(x));
+		}
+
+
+		this_type& operator=(std::initializer_list<value_type> ilist)
+		{
+			return static_cast<this_type&>(base_type::operator=(ilist));
+		}
+
+
+		this_type& operator=(this_type&& x)
+		{
+			return static_cast<this_type&>(base_type::operator=(eastl::move(x)));
+		}
+
+
+		/// insert
+		///
+		/// This is an extension to the C++ standard. We insert a default-constructed
+		/// element with the given key. The reason for this is that we can avoid the
+		/// potentially expensive operation of creating and/or copying a mapped_type
+		/// object on the stack.
+		insert_return_type insert(const key_type& key)
+		{
+			return base_type::DoTryEmplace(key);
+		}
+
+
+		insert_return_type insert(key_type&& key)
+		{
+			return base_type::DoTryEmplace(eastl::move(key));
+		}
+
+
+		T& at(const key_type& k)
+		{
+			iterator it = base_type::find(k);
+
+			if (it == base_type::end())
+			{
+				#if EASTL_EXCEPTIONS_ENABLED
+					// throw exeption if exceptions enabled
+					throw std::out_of_range("invalid flat_hash_map<K, T> key");
+				#else
+					// assert false if asserts enabled
+					EASTL_ASSERT_MSG(false, "invalid flat_hash_map<K, T> key");
+				#endif
+			}
+			// undefined behaviour if exceptions and asserts are disabled and it == end()
+			return it->second;
+		}
+
+
+		const T& at(const key_type& k) const
+		{
+			const_iterator it = base_type::find(k);
+
+			if (it == base_type::end())
+			{
+				#if EASTL_EXCEPTIONS_ENABLED
+					// throw exeption if exceptions enabled
+					throw std::out_of_range("invalid flat_hash_map<K, T> key");
+				#else
+					// assert false if asserts enabled
+					EASTL_ASSERT_MSG(false, "invalid flat_hash_map<K, T> key");
+				#endif
+			}
+			// undefined behaviour if exceptions and asserts are disabled and it == end()
+			return it->second;
+		}
+
+
+		mapped_type& operator[](const key_type& key)
+		{
+			return base_type::DoTryEmplace(key).first->second;
+		}
+
+
+		mapped_type& operator[](key_type&& key)
+		{
+			// The Standard states that this function "inserts the value value_type(std::move(key), mapped_type())"
+			return base_type::DoTryEmplace(eastl::move(key)).first->second;
+		}
+
+
+	}; // flat_hash_map
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+	inline bool operator==(const flat_hash_map<Key, T, Hash, Predicate, Allocator>& a,
+						   const flat_hash_map<Key, T, Hash, Predicate, Allocator>& b)
+	{
+		typedef typename flat_hash_map<Key, T, Hash, Predicate, Allocator>::const_iterator const_iterator;
+
+		// We implement branching with the assumption that the return value is usually false.
+		if(a.size() != b.size())
+			return false;
+
+		// For map (with its unique keys), we need only test that each element in a can be found in b,
+		// as there can be only one such pairing per element.
+		for(const_iterator ai = a.begin(), aiEnd = a.end(), biEnd = b.end(); ai != aiEnd; ++ai)
+		{
+			const_iterator bi = b.find(ai->first);
+
+			if((bi == biEnd) || !(*ai == *bi))  // We have to compare the values, because lookups are done by keys alone but the full value_type of a map is a key/value pair.
+				return false;                   // It's possible that two elements in the two containers have identical keys but different values.
+		}
+
+		return true;
+	}
+
+	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+	inline bool operator!=(const flat_hash_map<Key, T, Hash, Predicate, Allocator>& a,
+						   const flat_hash_map<Key, T, Hash, Predicate, Allocator>& b)
+	{
+		return !(a == b);
+	}
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
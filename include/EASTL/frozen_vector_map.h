@@ -0,0 +1,429 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements frozen_vector_map, a read-only alternative to vector_map
+// for maps which are built once and then searched many times. It stores its
+// elements in Eytzinger order (see internal/eytzinger.h) instead of in sorted
+// order, which makes lookups substantially faster for large maps.
+//
+// frozen_vector_map has the lookup and iteration interface of vector_map, with
+// the following differences:
+//     - The set of keys is fixed by the constructors and assign(), and there is
+//       no insert, erase or operator[]. Mapped values can be modified in place.
+//       Elements with equivalent keys in the input are removed, keeping the
+//       first, as inserting them one at a time into a map would.
+//     - Iterators are bidirectional rather than random access.
+//     - value_type is pair<const Key, T>, as with map, rather than pair<Key, T>.
+//     - The keys are stored twice: with the elements, and on their own in a
+//       second vector which lookups search. This keeps the mapped values out
+//       of the cache lines a lookup touches.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_FROZEN_VECTOR_MAP_H
+#define EASTL_FROZEN_VECTOR_MAP_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/eytzinger.h>
+#include <EASTL/allocator.h>
+#include <EASTL/functional.h>
+#include <EASTL/vector.h>
+#include <EASTL/utility.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/initializer_list.h>
+#include <stddef.h>
+
+#if EASTL_EXCEPTIONS_ENABLED
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <stdexcept> // std::out_of_range
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+
+	/// EASTL_FROZEN_VECTOR_MAP_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_FROZEN_VECTOR_MAP_DEFAULT_NAME
+		#define EASTL_FROZEN_VECTOR_MAP_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " frozen_vector_map" // Unless the user overrides something, this is "EASTL frozen_vector_map".
+	#endif
+
+
+	/// EASTL_FROZEN_VECTOR_MAP_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_FROZEN_VECTOR_MAP_DEFAULT_ALLOCATOR
+		#define EASTL_FROZEN_VECTOR_MAP_DEFAULT_ALLOCATOR allocator_type(EASTL_FROZEN_VECTOR_MAP_DEFAULT_NAME)
+	#endif
+
+
+
+	/// frozen_vector_map
+	///
+	/// Implements a read-only map as a vector of elements in Eytzinger order, with
+	/// a parallel vector of their keys for searching. See frozen_vector_set for the
+	/// performance characteristics. frozen_vector_map suits lookup tables which
+	/// are loaded once, such as string IDs to assets or opcodes to handlers.
+	///
+	/// Example usage:
+	///     eastl::vector<eastl::pair<uint32_t, Asset*> > assets = LoadAssetTable();
+	///     eastl::frozen_vector_map<uint32_t, Asset*> assetMap(assets.begin(), assets.end());
+	///
+	///     Asset* pAsset = assetMap.at(assetId);
+	///
+	template <typename Key, typename T, typename Compare = eastl::less<Key>, typename Allocator = EASTLAllocatorType>
+	class frozen_vector_map
+	{
+	public:
+		typedef frozen_vector_map<Key, T, Compare, Allocator>                     this_type;
+		typedef Allocator                                                         allocator_type;
+		typedef Key                                                               key_type;
+		typedef T                                                                 mapped_type;
+		typedef eastl::pair<const Key, T>                                         value_type;
+		typedef Compare                                                           key_compare;
+		typedef value_type*                                                       pointer;
+		typedef const value_type*                                                 const_pointer;
+		typedef value_type&                                                       reference;
+		typedef const value_type&                                                 const_reference;
+		typedef eastl::vector<Key, Allocator>                                     key_container_type;
+		typedef eastl::vector<value_type, Allocator>                              container_type;
+		typedef typename container_type::size_type                                size_type;
+		typedef typename container_type::difference_type                          difference_type;
+		typedef eytzinger_iterator<value_type, value_type*, value_type&>          iterator;
+		typedef eytzinger_iterator<value_type, const value_type*, const value_type&> const_iterator;
+		typedef eastl::reverse_iterator<iterator>                                 reverse_iterator;
+		typedef eastl::reverse_iterator<const_iterator>                           const_reverse_iterator;
+
+		class value_compare
+		{
+		protected:
+			friend class frozen_vector_map;
+			Compare compare;
+			value_compare(Compare c) : compare(c) {}
+
+		public:
+			typedef bool       result_type;
+			typedef value_type first_argument_type;
+			typedef value_type second_argument_type;
+
+			bool operator()(const value_type& x, const value_type& y) const
+				{ return compare(x.first, y.first); }
+		};
+
+	protected:
+		typedef eastl::pair<Key, T>                        build_value_type; // Unlike value_type, this is assignable, so we can sort it.
+		typedef eastl::vector<build_value_type, Allocator> build_container_type;
+
+		struct build_compare
+		{
+			const Compare& mCompare;
+
+			build_compare(const Compare& compare) : mCompare(compare) { }
+
+			bool operator()(const build_value_type& x, const build_value_type& y) const
+				{ return mCompare(x.first, y.first); }
+		};
+
+		key_container_type mKeys;    // The keys in Eytzinger order, for searching.
+		container_type     mValues;  // The elements in the same order as mKeys.
+		key_compare        mCompare;
+
+	public:
+		frozen_vector_map()
+			: mKeys(EASTL_FROZEN_VECTOR_MAP_DEFAULT_ALLOCATOR), mValues(EASTL_FROZEN_VECTOR_MAP_DEFAULT_ALLOCATOR), mCompare() { }
+
+		explicit frozen_vector_map(const allocator_type& allocator)
+			: mKeys(allocator), mValues(allocator), mCompare() { }
+
+		explicit frozen_vector_map(const key_compare& compare, const allocator_type& allocator = EASTL_FROZEN_VECTOR_MAP_DEFAULT_ALLOCATOR)
+			: mKeys(allocator), mValues(allocator), mCompare(compare) { }
+
+		frozen_vector_map(const this_type& x)
+			: mKeys(x.mKeys), mValues(x.mValues), mCompare(x.mCompare) { }
+
+		frozen_vector_map(this_type&& x)
+			: mKeys(eastl::move(x.mKeys)), mValues(eastl::move(x.mValues)), mCompare(x.mCompare) { }
+
+		frozen_vector_map(std::initializer_list<value_type> ilist, const key_compare& compare = key_compare(), const allocator_type& allocator = EASTL_FROZEN_VECTOR_MAP_DEFAULT_ALLOCATOR)
+			: mKeys(allocator), mValues(allocator), mCompare(compare)
+		{
+			assign(ilist.begin(), ilist.end());
+		}
+
+		template <typename InputIterator>
+		frozen_vector_map(InputIterator first, InputIterator last, const key_compare& compare = key_compare(), const allocator_type& allocator = EASTL_FROZEN_VECTOR_MAP_DEFAULT_ALLOCATOR)
+			: mKeys(allocator), mValues(allocator), mCompare(compare)
+		{
+			assign(first, last);
+		}
+
+		// The elements' keys are const, so vector's element-wise assignment doesn't apply.
+		this_type& operator=(const this_type& x)
+		{
+			if(this != &x)
+			{
+				this_type temp(x);
+				swap(temp);
+			}
+			return *this;
+		}
+
+		this_type& operator=(this_type&& x)
+		{
+			swap(x);
+			return *this;
+		}
+
+		/// assign
+		/// Replaces the contents with the elements in [first, last), which needn't be sorted.
+		template <typename InputIterator>
+		void assign(InputIterator first, InputIterator last)
+		{
+			build_container_type values(first, last, mValues.get_allocator());
+			Internal::EytzingerSortAndLayOut(values, build_compare(mCompare));
+
+			key_container_type keys(mKeys.get_allocator());
+			container_type     elements(mValues.get_allocator());
+
+			keys.reserve(values.size());
+			elements.reserve(values.size());
+
+			for(typename build_container_type::iterator it = values.begin(); it != values.end(); ++it)
+			{
+				keys.push_back(it->first);
+				elements.push_back(value_type(eastl::move(it->first), eastl::move(it->second)));
+			}
+
+			mKeys.swap(keys);
+			mValues.swap(elements);
+		}
+
+		void assign(std::initializer_list<value_type> ilist)
+			{ assign(ilist.begin(), ilist.end()); }
+
+		void clear()
+		{
+			mKeys.clear();
+			mValues.clear();
+		}
+
+		void swap(this_type& x)
+		{
+			mKeys.swap(x.mKeys);
+			mValues.swap(x.mValues);
+			eastl::swap(mCompare, x.mCompare);
+		}
+
+		const allocator_type& get_allocator() const EA_NOEXCEPT
+			{ return mValues.get_allocator(); }
+
+		void set_allocator(const allocator_type& allocator)
+		{
+			mKeys.set_allocator(allocator);
+			mValues.set_allocator(allocator);
+		}
+
+		const key_compare& key_comp() const
+			{ return mCompare; }
+
+		key_compare& key_comp()
+			{ return mCompare; }
+
+		value_compare value_comp() const
+			{ return value_compare(mCompare); }
+
+		iterator begin() EA_NOEXCEPT
+			{ return DoGetIterator(Internal::EytzingerFirst((size_t)mValues.size())); }
+
+		const_iterator begin() const EA_NOEXCEPT
+			{ return DoGetIterator(Internal::EytzingerFirst((size_t)mValues.size())); }
+
+		const_iterator cbegin() const EA_NOEXCEPT
+			{ return begin(); }
+
+		iterator end() EA_NOEXCEPT
+			{ return DoGetIterator(0); }
+
+		const_iterator end() const EA_NOEXCEPT
+			{ return DoGetIterator(0); }
+
+		const_iterator cend() const EA_NOEXCEPT
+			{ return end(); }
+
+		reverse_iterator rbegin() EA_NOEXCEPT
+			{ return reverse_iterator(end()); }
+
+		const_reverse_iterator rbegin() const EA_NOEXCEPT
+			{ return const_reverse_iterator(end()); }
+
+		const_reverse_iterator crbegin() const EA_NOEXCEPT
+			{ return rbegin(); }
+
+		reverse_iterator rend() EA_NOEXCEPT
+			{ return reverse_iterator(begin()); }
+
+		const_reverse_iterator rend() const EA_NOEXCEPT
+			{ return const_reverse_iterator(begin()); }
+
+		const_reverse_iterator crend() const EA_NOEXCEPT
+			{ return rend(); }
+
+		bool empty() const EA_NOEXCEPT
+			{ return mValues.empty(); }
+
+		size_type size() const EA_NOEXCEPT
+			{ return mValues.size(); }
+
+		iterator find(const key_type& key)
+			{ return DoGetIterator(DoFind(key)); }
+
+		const_iterator find(const key_type& key) const
+			{ return DoGetIterator(DoFind(key)); }
+
+		bool contains(const key_type& key) const
+			{ return DoFind(key) != 0; }
+
+		size_type count(const key_type& key) const
+			{ return DoFind(key) ? 1 : 0; }
+
+		iterator lower_bound(const key_type& key)
+			{ return DoGetIterator(Internal::EytzingerLowerBound(mKeys.data(), (size_t)mKeys.size(), key, mCompare)); }
+
+		const_iterator lower_bound(const key_type& key) const
+			{ return DoGetIterator(Internal::EytzingerLowerBound(mKeys.data(), (size_t)mKeys.size(), key, mCompare)); }
+
+		iterator upper_bound(const key_type& key)
+			{ return DoGetIterator(Internal::EytzingerUpperBound(mKeys.data(), (size_t)mKeys.size(), key, mCompare)); }
+
+		const_iterator upper_bound(const key_type& key) const
+			{ return DoGetIterator(Internal::EytzingerUpperBound(mKeys.data(), (size_t)mKeys.size(), key, mCompare)); }
+
+		eastl::pair<iterator, iterator> equal_range(const key_type& key)
+		{
+			const size_t k = DoFind(key);
+
+			if(k)
+				return eastl::pair<iterator, iterator>(DoGetIterator(k), DoGetIterator(Internal::EytzingerNext(k, (size_t)mKeys.size())));
+
+			const iterator itLower(lower_bound(key));
+			return eastl::pair<iterator, iterator>(itLower, itLower);
+		}
+
+		eastl::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+		{
+			const size_t k = DoFind(key);
+
+			if(k)
+				return eastl::pair<const_iterator, const_iterator>(DoGetIterator(k), DoGetIterator(Internal::EytzingerNext(k, (size_t)mKeys.size())));
+
+			const const_iterator itLower(lower_bound(key));
+			return eastl::pair<const_iterator, const_iterator>(itLower, itLower);
+		}
+
+		T& at(const Key& key)
+		{
+			const size_t k = DoFind(key);
+
+			if(k == 0)
+			{
+				#if EASTL_EXCEPTIONS_ENABLED
+					throw std::out_of_range("frozen_vector_map::at key does not exist");
+				#else
+					EASTL_FAIL_MSG("frozen_vector_map::at key does not exist");
+				#endif
+			}
+
+			return mValues[k - 1].second;
+		}
+
+		const T& at(const Key& key) const
+		{
+			const size_t k = DoFind(key);
+
+			if(k == 0)
+			{
+				#if EASTL_EXCEPTIONS_ENABLED
+					throw std::out_of_range("frozen_vector_map::at key does not exist");
+				#else
+					EASTL_FAIL_MSG("frozen_vector_map::at key does not exist");
+				#endif
+			}
+
+			return mValues[k - 1].second;
+		}
+
+		bool validate() const
+		{
+			if(!mKeys.validate() || !mValues.validate() || (mKeys.size() != mValues.size()))
+				return false;
+
+			const size_t n = (size_t)mKeys.size();
+
+			for(size_t k = 1; k <= n; ++k)
+			{
+				if(mCompare(mKeys[k - 1], mValues[k - 1].first) || mCompare(mValues[k - 1].first, mKeys[k - 1]))
+					return false;
+			}
+
+			for(size_t k = Internal::EytzingerFirst(n), kNext; k && (kNext = Internal::EytzingerNext(k, n)) != 0; k = kNext)
+			{
+				if(!mCompare(mKeys[k - 1], mKeys[kNext - 1])) // Keys must be strictly increasing in order.
+					return false;
+			}
+
+			return true;
+		}
+
+	protected:
+		// Returns the node holding key, or 0 if there is none.
+		size_t DoFind(const key_type& key) const
+		{
+			const size_t k = Internal::EytzingerLowerBound(mKeys.data(), (size_t)mKeys.size(), key, mCompare);
+
+			if(k && !mCompare(key, mKeys[k - 1]))
+				return k;
+
+			return 0;
+		}
+
+		iterator DoGetIterator(size_t k)
+			{ return iterator(mValues.data(), (size_t)mValues.size(), k); }
+
+		const_iterator DoGetIterator(size_t k) const
+			{ return const_iterator(const_cast<value_type*>(mValues.data()), (size_t)mValues.size(), k); }
+
+	}; // frozen_vector_map
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Key, typename T, typename Compare, typename Allocator>
+	inline bool operator==(const frozen_vector_map<Key, T, Compare, Allocator>& a, const frozen_vector_map<Key, T, Compare, Allocator>& b)
+		{ return (a.size() == b.size()) && eastl::equal(a.begin(), a.end(), b.begin()); }
+
+	template <typename Key, typename T, typename Compare, typename Allocator>
+	inline bool operator!=(const frozen_vector_map<Key, T, Compare, Allocator>& a, const frozen_vector_map<Key, T, Compare, Allocator>& b)
+		{ return !(a == b); }
+
+	template <typename Key, typename T, typename Compare, typename Allocator>
+	inline void swap(frozen_vector_map<Key, T, Compare, Allocator>& a, frozen_vector_map<Key, T, Compare, Allocator>& b)
+		{ a.swap(b); }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
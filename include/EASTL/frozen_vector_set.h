@@ -0,0 +1,281 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements frozen_vector_set, a read-only alternative to vector_set
+// for sets which are built once and then searched many times. It stores its
+// keys in a vector in Eytzinger order (see internal/eytzinger.h) instead of in
+// sorted order, which makes lookups substantially faster for large sets.
+//
+// frozen_vector_set has the lookup and iteration interface of vector_set, with
+// the following differences:
+//     - The contents are set by the constructors and assign(), and there is no
+//       insert or erase. Equivalent values in the input are removed, keeping the
+//       first, as inserting them one at a time into a set would.
+//     - Iterators are bidirectional rather than random access.
+//     - There is no RandomAccessContainer template parameter; the keys are always
+//       stored in an eastl::vector.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_FROZEN_VECTOR_SET_H
+#define EASTL_FROZEN_VECTOR_SET_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/eytzinger.h>
+#include <EASTL/allocator.h>
+#include <EASTL/functional.h>
+#include <EASTL/vector.h>
+#include <EASTL/utility.h>
+#include <EASTL/initializer_list.h>
+#include <stddef.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+
+	/// EASTL_FROZEN_VECTOR_SET_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_FROZEN_VECTOR_SET_DEFAULT_NAME
+		#define EASTL_FROZEN_VECTOR_SET_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " frozen_vector_set" // Unless the user overrides something, this is "EASTL frozen_vector_set".
+	#endif
+
+
+	/// EASTL_FROZEN_VECTOR_SET_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_FROZEN_VECTOR_SET_DEFAULT_ALLOCATOR
+		#define EASTL_FROZEN_VECTOR_SET_DEFAULT_ALLOCATOR allocator_type(EASTL_FROZEN_VECTOR_SET_DEFAULT_NAME)
+	#endif
+
+
+
+	/// frozen_vector_set
+	///
+	/// Implements a read-only set as a vector of keys in Eytzinger order. A lookup
+	/// is a branchless descent of an implicit binary tree whose top levels stay in
+	/// the cache, and which prefetches the nodes a few levels down, so it beats the
+	/// binary search of vector_set by a wide margin once the set outgrows the L1
+	/// cache. Iteration in order is slower than with vector_set, as it jumps around
+	/// the array.
+	///
+	/// Example usage:
+	///     eastl::frozen_vector_set<uint32_t> bannedIds(ids.begin(), ids.end()); // ids needn't be sorted or unique.
+	///
+	///     if(bannedIds.contains(id))
+	///         Reject(id);
+	///
+	template <typename Key, typename Compare = eastl::less<Key>, typename Allocator = EASTLAllocatorType>
+	class frozen_vector_set
+	{
+	public:
+		typedef frozen_vector_set<Key, Compare, Allocator>                        this_type;
+		typedef eastl::vector<Key, Allocator>                                     container_type;
+		typedef Allocator                                                         allocator_type;
+		typedef Key                                                               key_type;
+		typedef Key                                                               value_type;
+		typedef Compare                                                           key_compare;
+		typedef Compare                                                           value_compare;
+		typedef value_type*                                                       pointer;
+		typedef const value_type*                                                 const_pointer;
+		typedef value_type&                                                       reference;
+		typedef const value_type&                                                 const_reference;
+		typedef typename container_type::size_type                                size_type;
+		typedef typename container_type::difference_type                          difference_type;
+		typedef eytzinger_iterator<value_type, const value_type*, const value_type&> iterator; // Values cannot be modified, as that could change their order.
+		typedef eytzinger_iterator<value_type, const value_type*, const value_type&> const_iterator;
+		typedef eastl::reverse_iterator<iterator>                                 reverse_iterator;
+		typedef eastl::reverse_iterator<const_iterator>                           const_reverse_iterator;
+
+	protected:
+		container_type mKeys;    // The keys in Eytzinger order.
+		key_compare    mCompare;
+
+	public:
+		frozen_vector_set()
+			: mKeys(EASTL_FROZEN_VECTOR_SET_DEFAULT_ALLOCATOR), mCompare() { }
+
+		explicit frozen_vector_set(const allocator_type& allocator)
+			: mKeys(allocator), mCompare() { }
+
+		explicit frozen_vector_set(const key_compare& compare, const allocator_type& allocator = EASTL_FROZEN_VECTOR_SET_DEFAULT_ALLOCATOR)
+			: mKeys(allocator), mCompare(compare) { }
+
+		frozen_vector_set(std::initializer_list<value_type> ilist, const key_compare& compare = key_compare(), const allocator_type& allocator = EASTL_FROZEN_VECTOR_SET_DEFAULT_ALLOCATOR)
+			: mKeys(allocator), mCompare(compare)
+		{
+			assign(ilist.begin(), ilist.end());
+		}
+
+		template <typename InputIterator>
+		frozen_vector_set(InputIterator first, InputIterator last, const key_compare& compare = key_compare(), const allocator_type& allocator = EASTL_FROZEN_VECTOR_SET_DEFAULT_ALLOCATOR)
+			: mKeys(allocator), mCompare(compare)
+		{
+			assign(first, last);
+		}
+
+		/// assign
+		/// Replaces the contents with the values in [first, last), which needn't be sorted.
+		template <typename InputIterator>
+		void assign(InputIterator first, InputIterator last)
+		{
+			container_type keys(first, last, mKeys.get_allocator());
+			Internal::EytzingerSortAndLayOut(keys, mCompare);
+			mKeys.swap(keys);
+		}
+
+		void assign(std::initializer_list<value_type> ilist)
+			{ assign(ilist.begin(), ilist.end()); }
+
+		void clear()
+			{ mKeys.clear(); }
+
+		void swap(this_type& x)
+		{
+			mKeys.swap(x.mKeys);
+			eastl::swap(mCompare, x.mCompare);
+		}
+
+		const allocator_type& get_allocator() const EA_NOEXCEPT
+			{ return mKeys.get_allocator(); }
+
+		allocator_type& get_allocator() EA_NOEXCEPT
+			{ return mKeys.get_allocator(); }
+
+		void set_allocator(const allocator_type& allocator)
+			{ mKeys.set_allocator(allocator); }
+
+		const key_compare& key_comp() const
+			{ return mCompare; }
+
+		key_compare& key_comp()
+			{ return mCompare; }
+
+		const value_compare& value_comp() const
+			{ return mCompare; }
+
+		value_compare& value_comp()
+			{ return mCompare; }
+
+		/// keys
+		/// Returns the underlying vector, whose order is the Eytzinger order and not the sorted order.
+		const container_type& keys() const EA_NOEXCEPT
+			{ return mKeys; }
+
+		const_iterator begin() const EA_NOEXCEPT
+			{ return DoGetIterator(Internal::EytzingerFirst((size_t)mKeys.size())); }
+
+		const_iterator cbegin() const EA_NOEXCEPT
+			{ return begin(); }
+
+		const_iterator end() const EA_NOEXCEPT
+			{ return DoGetIterator(0); }
+
+		const_iterator cend() const EA_NOEXCEPT
+			{ return end(); }
+
+		const_reverse_iterator rbegin() const EA_NOEXCEPT
+			{ return const_reverse_iterator(end()); }
+
+		const_reverse_iterator crbegin() const EA_NOEXCEPT
+			{ return rbegin(); }
+
+		const_reverse_iterator rend() const EA_NOEXCEPT
+			{ return const_reverse_iterator(begin()); }
+
+		const_reverse_iterator crend() const EA_NOEXCEPT
+			{ return rend(); }
+
+		bool empty() const EA_NOEXCEPT
+			{ return mKeys.empty(); }
+
+		size_type size() const EA_NOEXCEPT
+			{ return mKeys.size(); }
+
+		const_iterator find(const key_type& key) const
+		{
+			const size_t k = Internal::EytzingerLowerBound(mKeys.data(), (size_t)mKeys.size(), key, mCompare);
+
+			if(k && !mCompare(key, mKeys[k - 1]))
+				return DoGetIterator(k);
+
+			return end();
+		}
+
+		bool contains(const key_type& key) const
+			{ return find(key) != end(); }
+
+		size_type count(const key_type& key) const
+			{ return (find(key) != end()) ? 1 : 0; }
+
+		const_iterator lower_bound(const key_type& key) const
+			{ return DoGetIterator(Internal::EytzingerLowerBound(mKeys.data(), (size_t)mKeys.size(), key, mCompare)); }
+
+		const_iterator upper_bound(const key_type& key) const
+			{ return DoGetIterator(Internal::EytzingerUpperBound(mKeys.data(), (size_t)mKeys.size(), key, mCompare)); }
+
+		eastl::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+		{
+			const const_iterator itLower(lower_bound(key));
+
+			if((itLower == end()) || mCompare(key, *itLower))
+				return eastl::pair<const_iterator, const_iterator>(itLower, itLower);
+
+			const_iterator itUpper(itLower);
+			return eastl::pair<const_iterator, const_iterator>(itLower, ++itUpper);
+		}
+
+		bool validate() const
+		{
+			if(!mKeys.validate())
+				return false;
+
+			const size_t n = (size_t)mKeys.size();
+
+			for(size_t k = Internal::EytzingerFirst(n), kNext; k && (kNext = Internal::EytzingerNext(k, n)) != 0; k = kNext)
+			{
+				if(!mCompare(mKeys[k - 1], mKeys[kNext - 1])) // Keys must be strictly increasing in order.
+					return false;
+			}
+
+			return true;
+		}
+
+	protected:
+		const_iterator DoGetIterator(size_t k) const
+			{ return const_iterator(const_cast<value_type*>(mKeys.data()), (size_t)mKeys.size(), k); }
+
+	}; // frozen_vector_set
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	// Sets with equal contents have identical layouts, so we can compare the vectors directly.
+	template <typename Key, typename Compare, typename Allocator>
+	inline bool operator==(const frozen_vector_set<Key, Compare, Allocator>& a, const frozen_vector_set<Key, Compare, Allocator>& b)
+		{ return a.keys() == b.keys(); }
+
+	template <typename Key, typename Compare, typename Allocator>
+	inline bool operator!=(const frozen_vector_set<Key, Compare, Allocator>& a, const frozen_vector_set<Key, Compare, Allocator>& b)
+		{ return !(a.keys() == b.keys()); }
+
+	template <typename Key, typename Compare, typename Allocator>
+	inline void swap(frozen_vector_set<Key, Compare, Allocator>& a, frozen_vector_set<Key, Compare, Allocator>& b)
+		{ a.swap(b); }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -13,6 +13,7 @@
 #include <EASTL/type_traits.h>
 #include <EASTL/internal/functional_base.h>
 #include <EASTL/internal/mem_fn.h>
+#include <EASTL/internal/hash_bytes.h>
 
 
 #if defined(EA_PRAGMA_ONCE_SUPPORTED)
@@ -1077,23 +1078,28 @@ namespace eastl
 	///////////////////////////////////////////////////////////////////////////
 	// string hashes
 	//
-	// Note that our string hashes here intentionally are slow for long strings.
-	// The reasoning for this is so:
-	//    - The large majority of hashed strings are only a few bytes long.
-	//    - The hash function is significantly more efficient if it can make this assumption.
-	//    - The user is welcome to make a custom hash for those uncommon cases where
-	//      long strings need to be hashed. Indeed, the user can probably make a 
-	//      special hash customized for such strings that's better than what we provide.
+	// Our string hashes use Internal::HashBytes (see internal/hash_bytes.h), 
+	// which consumes 16 to 48 bytes per step, rather than one character per 
+	// step. The character pointer hashes find the string length first (which 
+	// strlen does a word at a time), while the string and string_view hashes 
+	// use the length they already know. All of them hash the same bytes for 
+	// the same characters, so for example hash_map<string, T>::find_as can be 
+	// used with a const char* key. Define EASTL_STRING_HASH_LEGACY to 1 to use 
+	// the FNV-1 hash of previous EASTL versions instead.
 	///////////////////////////////////////////////////////////////////////////
 
 	template <> struct hash<char8_t*>
 	{
 		size_t operator()(const char8_t* p) const
 		{
-			uint32_t c, result = 2166136261U;   // FNV1 hash. Perhaps the best string hash. Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint8_t)*p++) != 0)     // Using '!=' disables compiler warnings.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				uint32_t c, result = 2166136261U;   // FNV1 hash. Perhaps the best string hash. Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				while((c = (uint8_t)*p++) != 0)     // Using '!=' disables compiler warnings.
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(p);
+			#endif
 		}
 	};
 
@@ -1101,10 +1107,14 @@ namespace eastl
 	{
 		size_t operator()(const char8_t* p) const
 		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint8_t)*p++) != 0)     // cast to unsigned 8 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				while((c = (uint8_t)*p++) != 0)     // cast to unsigned 8 bit.
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(p);
+			#endif
 		}
 	};
 
@@ -1112,10 +1122,14 @@ namespace eastl
 	{
 		size_t operator()(const char16_t* p) const
 		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint16_t)*p++) != 0)    // cast to unsigned 16 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				while((c = (uint16_t)*p++) != 0)    // cast to unsigned 16 bit.
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(p);
+			#endif
 		}
 	};
 
@@ -1123,10 +1137,14 @@ namespace eastl
 	{
 		size_t operator()(const char16_t* p) const
 		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint16_t)*p++) != 0)    // cast to unsigned 16 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				while((c = (uint16_t)*p++) != 0)    // cast to unsigned 16 bit.
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(p);
+			#endif
 		}
 	};
 
@@ -1134,10 +1152,14 @@ namespace eastl
 	{
 		size_t operator()(const char32_t* p) const
 		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				while((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(p);
+			#endif
 		}
 	};
 
@@ -1145,10 +1167,14 @@ namespace eastl
 	{
 		size_t operator()(const char32_t* p) const
 		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				while((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(p);
+			#endif
 		}
 	};
 
@@ -1157,10 +1183,14 @@ namespace eastl
 	{
 		size_t operator()(const wchar_t* p) const
 		{
-			uint32_t c, result = 2166136261U;    // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while ((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				uint32_t c, result = 2166136261U;    // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				while ((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(p);
+			#endif
 		}
 	};
 
@@ -1168,10 +1198,14 @@ namespace eastl
 	{
 		size_t operator()(const wchar_t* p) const
 		{
-			uint32_t c, result = 2166136261U;    // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while ((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				uint32_t c, result = 2166136261U;    // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				while ((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(p);
+			#endif
 		}
 	};
 #endif
@@ -1192,11 +1226,15 @@ namespace eastl
 
 		size_t operator()(const string_type& s) const
 		{
-			const unsigned_value_type* p = (const unsigned_value_type*)s.c_str();
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = *p++) != 0)
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				const unsigned_value_type* p = (const unsigned_value_type*)s.c_str();
+				uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				while((c = *p++) != 0)
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(s.c_str(), s.size());
+			#endif
 		}
 	};
 
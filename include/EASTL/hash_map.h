@@ -81,6 +81,17 @@ namespace eastl
 	/// is useful for cases whereby the calculation of the hash value for
 	/// a contained object is very expensive.
 	///
+	/// RehashPolicy
+	/// The policy which decides the bucket count. The default prime_rehash_policy
+	/// uses prime bucket counts and maps hash codes to buckets with a modulo.
+	/// power_of_two_rehash_policy uses power of two bucket counts and maps hash
+	/// codes to buckets with a multiplicative mix and a mask, which removes the
+	/// integer division from find and insert. Example usage:
+	///     hash_map<int, int, hash<int>, equal_to<int>, EASTLAllocatorType, false, power_of_two_rehash_policy> hashMap;
+	/// incremental_rehash_policy grows like prime_rehash_policy, but moves the
+	/// nodes to the new bucket array a few buckets per insertion rather than all
+	/// at once, which bounds the cost of the insertion that triggers the growth.
+	///
 	/// find_as
 	/// In order to support the ability to have a hashtable of strings but
 	/// be able to do efficiently lookups via char pointers (i.e. so they 
@@ -97,17 +108,18 @@ namespace eastl
 	///     i = hashMap.find_as("hello", hash<char*>(), equal_to_2<string, char*>());
 	///
 	template <typename Key, typename T, typename Hash = eastl::hash<Key>, typename Predicate = eastl::equal_to<Key>, 
-			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false>
+			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false, typename RehashPolicy = prime_rehash_policy>
 	class hash_map
 		: public hashtable<Key, eastl::pair<const Key, T>, Allocator, eastl::use_first<eastl::pair<const Key, T> >, Predicate,
-							Hash, mod_range_hashing, default_ranged_hash, prime_rehash_policy, bCacheHashCode, true, true>
+							Hash, typename rehash_policy_traits<RehashPolicy>::range_hashing_type, default_ranged_hash, RehashPolicy, bCacheHashCode, true, true>
 	{
 	public:
+		typedef typename rehash_policy_traits<RehashPolicy>::range_hashing_type range_hashing_type;
 		typedef hashtable<Key, eastl::pair<const Key, T>, Allocator, 
 						  eastl::use_first<eastl::pair<const Key, T> >, 
-						  Predicate, Hash, mod_range_hashing, default_ranged_hash, 
-						  prime_rehash_policy, bCacheHashCode, true, true>        base_type;
-		typedef hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode>      this_type;
+						  Predicate, Hash, range_hashing_type, default_ranged_hash, 
+						  RehashPolicy, bCacheHashCode, true, true>        base_type;
+		typedef hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>      this_type;
 		typedef typename base_type::size_type                                     size_type;
 		typedef typename base_type::key_type                                      key_type;
 		typedef T                                                                 mapped_type;
@@ -126,7 +138,7 @@ namespace eastl
 		/// Default constructor.
 		///
 		explicit hash_map(const allocator_type& allocator = EASTL_HASH_MAP_DEFAULT_ALLOCATOR)
-			: base_type(0, Hash(), mod_range_hashing(), default_ranged_hash(), 
+			: base_type(0, Hash(), range_hashing_type(), default_ranged_hash(), 
 						Predicate(), eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -141,7 +153,7 @@ namespace eastl
 		///
 		explicit hash_map(size_type nBucketCount, const Hash& hashFunction = Hash(), 
 						  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MAP_DEFAULT_ALLOCATOR)
-			: base_type(nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -173,7 +185,7 @@ namespace eastl
 		///     
 		hash_map(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MAP_DEFAULT_ALLOCATOR)
-			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -188,7 +200,7 @@ namespace eastl
 		template <typename ForwardIterator>
 		hash_map(ForwardIterator first, ForwardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				 const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MAP_DEFAULT_ALLOCATOR)
-			: base_type(first, last, nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(first, last, nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -300,17 +312,18 @@ namespace eastl
 	/// documentation for hash_set for details.
 	///
 	template <typename Key, typename T, typename Hash = eastl::hash<Key>, typename Predicate = eastl::equal_to<Key>,
-			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false>
+			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false, typename RehashPolicy = prime_rehash_policy>
 	class hash_multimap
 		: public hashtable<Key, eastl::pair<const Key, T>, Allocator, eastl::use_first<eastl::pair<const Key, T> >, Predicate,
-						   Hash, mod_range_hashing, default_ranged_hash, prime_rehash_policy, bCacheHashCode, true, false>
+						   Hash, typename rehash_policy_traits<RehashPolicy>::range_hashing_type, default_ranged_hash, RehashPolicy, bCacheHashCode, true, false>
 	{
 	public:
+		typedef typename rehash_policy_traits<RehashPolicy>::range_hashing_type range_hashing_type;
 		typedef hashtable<Key, eastl::pair<const Key, T>, Allocator, 
 						  eastl::use_first<eastl::pair<const Key, T> >, 
-						  Predicate, Hash, mod_range_hashing, default_ranged_hash, 
-						  prime_rehash_policy, bCacheHashCode, true, false>           base_type;
-		typedef hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode>     this_type;
+						  Predicate, Hash, range_hashing_type, default_ranged_hash, 
+						  RehashPolicy, bCacheHashCode, true, false>           base_type;
+		typedef hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>     this_type;
 		typedef typename base_type::size_type                                         size_type;
 		typedef typename base_type::key_type                                          key_type;
 		typedef T                                                                     mapped_type;
@@ -332,7 +345,7 @@ namespace eastl
 		/// Default constructor.
 		///
 		explicit hash_multimap(const allocator_type& allocator = EASTL_HASH_MULTIMAP_DEFAULT_ALLOCATOR)
-			: base_type(0, Hash(), mod_range_hashing(), default_ranged_hash(), 
+			: base_type(0, Hash(), range_hashing_type(), default_ranged_hash(), 
 						Predicate(), eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -347,7 +360,7 @@ namespace eastl
 		///
 		explicit hash_multimap(size_type nBucketCount, const Hash& hashFunction = Hash(), 
 							   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTIMAP_DEFAULT_ALLOCATOR)
-			: base_type(nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -379,7 +392,7 @@ namespace eastl
 		///     
 		hash_multimap(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTIMAP_DEFAULT_ALLOCATOR)
-			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -394,7 +407,7 @@ namespace eastl
 		template <typename ForwardIterator>
 		hash_multimap(ForwardIterator first, ForwardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTIMAP_DEFAULT_ALLOCATOR)
-			: base_type(first, last, nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(first, last, nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -445,11 +458,11 @@ namespace eastl
 	// global operators
 	///////////////////////////////////////////////////////////////////////
 
-	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode>
-	inline bool operator==(const hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode>& a, 
-						   const hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode>& b)
+	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode, typename RehashPolicy>
+	inline bool operator==(const hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& a, 
+						   const hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& b)
 	{
-		typedef typename hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode>::const_iterator const_iterator;
+		typedef typename hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>::const_iterator const_iterator;
 
 		// We implement branching with the assumption that the return value is usually false.
 		if(a.size() != b.size())
@@ -468,19 +481,19 @@ namespace eastl
 		return true;
 	}
 
-	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode>
-	inline bool operator!=(const hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode>& a, 
-						   const hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode>& b)
+	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode, typename RehashPolicy>
+	inline bool operator!=(const hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& a, 
+						   const hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& b)
 	{
 		return !(a == b);
 	}
 
 
-	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode>
-	inline bool operator==(const hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode>& a, 
-						   const hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode>& b)
+	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode, typename RehashPolicy>
+	inline bool operator==(const hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& a, 
+						   const hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& b)
 	{
-		typedef typename hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode>::const_iterator const_iterator;
+		typedef typename hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>::const_iterator const_iterator;
 		typedef typename eastl::iterator_traits<const_iterator>::difference_type difference_type;
 
 		// We implement branching with the assumption that the return value is usually false.
@@ -525,9 +538,9 @@ namespace eastl
 		return true;
 	}
 
-	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode>
-	inline bool operator!=(const hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode>& a, 
-						   const hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode>& b)
+	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode, typename RehashPolicy>
+	inline bool operator!=(const hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& a, 
+						   const hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& b)
 	{
 		return !(a == b);
 	}
@@ -81,6 +81,17 @@ namespace eastl
 	/// is useful for cases whereby the calculation of the hash value for
 	/// a contained object is very expensive.
 	///
+	/// RehashPolicy
+	/// The policy which decides the bucket count. The default prime_rehash_policy
+	/// uses prime bucket counts and maps hash codes to buckets with a modulo.
+	/// power_of_two_rehash_policy uses power of two bucket counts and maps hash
+	/// codes to buckets with a multiplicative mix and a mask, which removes the
+	/// integer division from find and insert. Example usage:
+	///     hash_set<int, hash<int>, equal_to<int>, EASTLAllocatorType, false, power_of_two_rehash_policy> hashSet;
+	/// incremental_rehash_policy grows like prime_rehash_policy, but moves the
+	/// nodes to the new bucket array a few buckets per insertion rather than all
+	/// at once, which bounds the cost of the insertion that triggers the growth.
+	///
 	/// find_as
 	/// In order to support the ability to have a hashtable of strings but
 	/// be able to do efficiently lookups via char pointers (i.e. so they 
@@ -97,17 +108,18 @@ namespace eastl
 	///     i = hashSet.find_as("hello", hash<char*>(), equal_to_2<string, char*>());
 	///
 	template <typename Value, typename Hash = eastl::hash<Value>, typename Predicate = eastl::equal_to<Value>, 
-			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false>
+			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false, typename RehashPolicy = prime_rehash_policy>
 	class hash_set
 		: public hashtable<Value, Value, Allocator, eastl::use_self<Value>, Predicate,
-						   Hash, mod_range_hashing, default_ranged_hash, 
-						   prime_rehash_policy, bCacheHashCode, false, true>
+						   Hash, typename rehash_policy_traits<RehashPolicy>::range_hashing_type, default_ranged_hash, 
+						   RehashPolicy, bCacheHashCode, false, true>
 	{
 	public:
+		typedef typename rehash_policy_traits<RehashPolicy>::range_hashing_type range_hashing_type;
 		typedef hashtable<Value, Value, Allocator, eastl::use_self<Value>, Predicate, 
-						  Hash, mod_range_hashing, default_ranged_hash,
-						  prime_rehash_policy, bCacheHashCode, false, true>       base_type;
-		typedef hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode>       this_type;
+						  Hash, range_hashing_type, default_ranged_hash,
+						  RehashPolicy, bCacheHashCode, false, true>       base_type;
+		typedef hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>       this_type;
 		typedef typename base_type::size_type                                     size_type;
 		typedef typename base_type::value_type                                    value_type;
 		typedef typename base_type::allocator_type                                allocator_type;
@@ -119,7 +131,7 @@ namespace eastl
 		/// Default constructor.
 		/// 
 		explicit hash_set(const allocator_type& allocator = EASTL_HASH_SET_DEFAULT_ALLOCATOR)
-			: base_type(0, Hash(), mod_range_hashing(), default_ranged_hash(), Predicate(), eastl::use_self<Value>(), allocator)
+			: base_type(0, Hash(), range_hashing_type(), default_ranged_hash(), Predicate(), eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -133,7 +145,7 @@ namespace eastl
 		///
 		explicit hash_set(size_type nBucketCount, const Hash& hashFunction = Hash(), const Predicate& predicate = Predicate(), 
 						  const allocator_type& allocator = EASTL_HASH_SET_DEFAULT_ALLOCATOR)
-			: base_type(nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -166,7 +178,7 @@ namespace eastl
 		///     
 		hash_set(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_SET_DEFAULT_ALLOCATOR)
-			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -180,7 +192,7 @@ namespace eastl
 		template <typename FowardIterator>
 		hash_set(FowardIterator first, FowardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				 const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_SET_DEFAULT_ALLOCATOR)
-			: base_type(first, last, nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(first, last, nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -219,17 +231,18 @@ namespace eastl
 	/// for hash_set for details.
 	///
 	template <typename Value, typename Hash = eastl::hash<Value>, typename Predicate = eastl::equal_to<Value>, 
-			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false>
+			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false, typename RehashPolicy = prime_rehash_policy>
 	class hash_multiset
 		: public hashtable<Value, Value, Allocator, eastl::use_self<Value>, Predicate,
-						   Hash, mod_range_hashing, default_ranged_hash,
-						   prime_rehash_policy, bCacheHashCode, false, false>
+						   Hash, typename rehash_policy_traits<RehashPolicy>::range_hashing_type, default_ranged_hash,
+						   RehashPolicy, bCacheHashCode, false, false>
 	{
 	public:
+		typedef typename rehash_policy_traits<RehashPolicy>::range_hashing_type range_hashing_type;
 		typedef hashtable<Value, Value, Allocator, eastl::use_self<Value>, Predicate,
-						  Hash, mod_range_hashing, default_ranged_hash,
-						  prime_rehash_policy, bCacheHashCode, false, false>          base_type;
-		typedef hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode>      this_type;
+						  Hash, range_hashing_type, default_ranged_hash,
+						  RehashPolicy, bCacheHashCode, false, false>          base_type;
+		typedef hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>      this_type;
 		typedef typename base_type::size_type                                         size_type;
 		typedef typename base_type::value_type                                        value_type;
 		typedef typename base_type::allocator_type                                    allocator_type;
@@ -241,7 +254,7 @@ namespace eastl
 		/// Default constructor.
 		/// 
 		explicit hash_multiset(const allocator_type& allocator = EASTL_HASH_MULTISET_DEFAULT_ALLOCATOR)
-			: base_type(0, Hash(), mod_range_hashing(), default_ranged_hash(), Predicate(), eastl::use_self<Value>(), allocator)
+			: base_type(0, Hash(), range_hashing_type(), default_ranged_hash(), Predicate(), eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -255,7 +268,7 @@ namespace eastl
 		///
 		explicit hash_multiset(size_type nBucketCount, const Hash& hashFunction = Hash(), 
 							   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTISET_DEFAULT_ALLOCATOR)
-			: base_type(nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -288,7 +301,7 @@ namespace eastl
 		///     
 		hash_multiset(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTISET_DEFAULT_ALLOCATOR)
-			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -302,7 +315,7 @@ namespace eastl
 		template <typename FowardIterator>
 		hash_multiset(FowardIterator first, FowardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTISET_DEFAULT_ALLOCATOR)
-			: base_type(first, last, nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(first, last, nBucketCount, hashFunction, range_hashing_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -335,11 +348,11 @@ namespace eastl
 	// global operators
 	///////////////////////////////////////////////////////////////////////
 
-	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode>
-	inline bool operator==(const hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode>& a, 
-						   const hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode>& b)
+	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode, typename RehashPolicy>
+	inline bool operator==(const hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& a, 
+						   const hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& b)
 	{
-		typedef typename hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode>::const_iterator const_iterator;
+		typedef typename hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>::const_iterator const_iterator;
 
 		// We implement branching with the assumption that the return value is usually false.
 		if(a.size() != b.size())
@@ -358,19 +371,19 @@ namespace eastl
 		return true;
 	}
 
-	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode>
-	inline bool operator!=(const hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode>& a, 
-						   const hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode>& b)
+	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode, typename RehashPolicy>
+	inline bool operator!=(const hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& a, 
+						   const hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& b)
 	{
 		return !(a == b);
 	}
 
 
-	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode>
-	inline bool operator==(const hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode>& a, 
-						   const hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode>& b)
+	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode, typename RehashPolicy>
+	inline bool operator==(const hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& a, 
+						   const hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& b)
 	{
-		typedef typename hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode>::const_iterator const_iterator;
+		typedef typename hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>::const_iterator const_iterator;
 		typedef typename eastl::iterator_traits<const_iterator>::difference_type difference_type;
 
 		// We implement branching with the assumption that the return value is usually false.
@@ -415,9 +428,9 @@ namespace eastl
 		return true;
 	}
 
-	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode>
-	inline bool operator!=(const hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode>& a, 
-						   const hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode>& b)
+	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode, typename RehashPolicy>
+	inline bool operator!=(const hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& a, 
+						   const hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>& b)
 	{
 		return !(a == b);
 	}
@@ -0,0 +1,42 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_ASSUME_SORTED_T_H
+#define EASTL_INTERNAL_ASSUME_SORTED_T_H
+
+
+#include <EABase/eabase.h>
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+namespace eastl
+{
+	///////////////////////////////////////////////////////////////////////////////
+	/// assume_sorted_t
+	///
+	/// A tag type used to select container constructors and functions which
+	/// require their input range to already be sorted by the container's
+	/// comparison, and in return can skip searching for each value's position.
+	///
+	struct assume_sorted_t
+	{
+		explicit assume_sorted_t() = default;
+	};
+
+
+	///////////////////////////////////////////////////////////////////////////////
+	/// assume_sorted
+	///
+	/// Example usage:
+	///     eastl::vector<eastl::pair<int, Order>> orders = LoadSnapshot(); // Sorted by key.
+	///     eastl::map<int, Order> book(eastl::assume_sorted, orders.begin(), orders.end());
+	///
+	EA_CONSTEXPR assume_sorted_t assume_sorted = eastl::assume_sorted_t();
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,356 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements the word array kernels which bitset and bitvector use
+// to scan, count and combine their words. They work a block at a time: 64
+// bytes per step with SSE2 or AVX2, and four words per step otherwise, which
+// makes scanning a sparse bitset of thousands of words or combining two
+// bitvectors of millions of bits mostly a matter of memory bandwidth.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_BIT_WORDS_H
+#define EASTL_INTERNAL_BIT_WORDS_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/bit.h>
+#include <stddef.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+/// EASTL_BIT_WORDS_SSE2
+///
+/// Defined as 0 or 1. If 1 then the bit word kernels test 64 bytes of words
+/// at a time with SSE2 instructions.
+///
+#ifndef EASTL_BIT_WORDS_SSE2
+	#if defined(EA_SSE2) && EA_SSE2
+		#define EASTL_BIT_WORDS_SSE2 1
+	#else
+		#define EASTL_BIT_WORDS_SSE2 0
+	#endif
+#endif
+
+/// EASTL_BIT_WORDS_AVX2
+///
+/// Defined as 0 or 1. If 1 then the bit word kernels use AVX2 instructions
+/// instead of SSE2. This is enabled by default only when the compiler targets
+/// AVX2 (e.g. -mavx2 or /arch:AVX2), as there is no run time dispatch.
+///
+#ifndef EASTL_BIT_WORDS_AVX2
+	#if defined(EA_AVX2) && EA_AVX2 && EASTL_BIT_WORDS_SSE2
+		#define EASTL_BIT_WORDS_AVX2 1
+	#else
+		#define EASTL_BIT_WORDS_AVX2 0
+	#endif
+#endif
+
+#if EASTL_BIT_WORDS_AVX2
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <immintrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#elif EASTL_BIT_WORDS_SSE2
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <emmintrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+
+
+namespace eastl
+{
+	/// GetBitCount
+	///
+	/// Returns the number of set bits in x. This compiles to a popcnt instruction where
+	/// the target supports it (see bit.h).
+	///
+	inline uint32_t GetBitCount(uint8_t x)
+	{
+		return (uint32_t)eastl::popcount(x);
+	}
+
+	inline uint32_t GetBitCount(uint16_t x)
+	{
+		return (uint32_t)eastl::popcount(x);
+	}
+
+	inline uint32_t GetBitCount(uint32_t x)
+	{
+		return (uint32_t)eastl::popcount(x);
+	}
+
+	inline uint32_t GetBitCount(uint64_t x)
+	{
+		return (uint32_t)eastl::popcount(x);
+	}
+
+	#if EASTL_INT128_SUPPORTED
+		inline uint32_t GetBitCount(eastl_uint128_t x)
+		{
+			return (uint32_t)(eastl::popcount((uint64_t)x) + eastl::popcount((uint64_t)(x >> 64)));
+		}
+	#endif
+
+
+
+	namespace Internal
+	{
+		/// BitWordsBlock
+		///
+		/// Operates on a block of kSize words at a time. The vector versions read
+		/// and write the block with unaligned loads and stores, as word arrays are
+		/// only word aligned.
+		///
+		template <typename Word>
+		struct BitWordsBlock
+		{
+		#if EASTL_BIT_WORDS_AVX2
+			enum { kSize = (64 / sizeof(Word)) > 0 ? (64 / sizeof(Word)) : 1, kVectorCount = 2 };
+			typedef __m256i vector_type;
+
+			static vector_type Load(const Word* pWords, size_t i)           { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWords) + i); }
+			static void        Store(Word* pWords, size_t i, vector_type v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(pWords) + i, v); }
+
+			// Returns true if any bit in the block is set.
+			static bool Any(const Word* pWords)
+			{
+				const __m256i v = _mm256_or_si256(Load(pWords, 0), Load(pWords, 1));
+				return !_mm256_testz_si256(v, v);
+			}
+
+			// Returns true if every bit in the block is set.
+			static bool All(const Word* pWords)
+			{
+				const __m256i v = _mm256_and_si256(Load(pWords, 0), Load(pWords, 1));
+				return _mm256_testc_si256(v, _mm256_set1_epi32(-1)) != 0;
+			}
+
+			// Returns the number of set bits in the block. This is the nibble lookup
+			// popcount: pshufb counts each half byte, and psadbw sums the byte counts.
+			static uint64_t Count(const Word* pWords)
+			{
+				const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+				                                        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+				const __m256i low    = _mm256_set1_epi8(0x0f);
+				__m256i       counts = _mm256_setzero_si256();
+
+				for(size_t i = 0; i < kVectorCount; i++)
+				{
+					const __m256i v = Load(pWords, i);
+					counts = _mm256_add_epi8(counts, _mm256_add_epi8(_mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low)),
+					                                                 _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low))));
+				}
+
+				EA_ALIGN(32) uint64_t sums[4];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+				return sums[0] + sums[1] + sums[2] + sums[3];
+			}
+		#elif EASTL_BIT_WORDS_SSE2
+			enum { kSize = (64 / sizeof(Word)) > 0 ? (64 / sizeof(Word)) : 1, kVectorCount = 4 };
+			typedef __m128i vector_type;
+
+			static vector_type Load(const Word* pWords, size_t i)           { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWords) + i); }
+			static void        Store(Word* pWords, size_t i, vector_type v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(pWords) + i, v); }
+
+			static bool Any(const Word* pWords)
+			{
+				const __m128i v = _mm_or_si128(_mm_or_si128(Load(pWords, 0), Load(pWords, 1)),
+				                               _mm_or_si128(Load(pWords, 2), Load(pWords, 3)));
+
+				return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) != 0xFFFF;
+			}
+
+			static bool All(const Word* pWords)
+			{
+				const __m128i v = _mm_and_si128(_mm_and_si128(Load(pWords, 0), Load(pWords, 1)),
+				                                _mm_and_si128(Load(pWords, 2), Load(pWords, 3)));
+
+				return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi32(-1))) == 0xFFFF;
+			}
+
+			// SSE2 has no byte shuffle, so this counts the bits of each byte with
+			// the usual shift and mask reduction, then sums the byte counts with psadbw.
+			static uint64_t Count(const Word* pWords)
+			{
+				const __m128i m1     = _mm_set1_epi8(0x55);
+				const __m128i m2     = _mm_set1_epi8(0x33);
+				const __m128i m4     = _mm_set1_epi8(0x0f);
+				__m128i       counts = _mm_setzero_si128();
+
+				for(size_t i = 0; i < kVectorCount; i++)
+				{
+					__m128i v = Load(pWords, i);
+					v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi16(v, 1), m1));
+					v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi16(v, 2), m2));
+					v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi16(v, 4)), m4);
+					counts = _mm_add_epi8(counts, v);
+				}
+
+				EA_ALIGN(16) uint64_t sums[2];
+				_mm_store_si128(reinterpret_cast<__m128i*>(sums), _mm_sad_epu8(counts, _mm_setzero_si128()));
+				return sums[0] + sums[1];
+			}
+		#else
+			enum { kSize = 4 };
+
+			static bool Any(const Word* pWords)
+				{ return (pWords[0] | pWords[1] | pWords[2] | pWords[3]) != 0; }
+
+			static bool All(const Word* pWords)
+				{ return (Word)(pWords[0] & pWords[1] & pWords[2] & pWords[3]) == (Word)~Word(0); }
+
+			static uint64_t Count(const Word* pWords)
+				{ return (uint64_t)GetBitCount(pWords[0]) + GetBitCount(pWords[1]) + GetBitCount(pWords[2]) + GetBitCount(pWords[3]); }
+		#endif
+		};
+
+
+		/// BitWordsFind
+		///
+		/// Returns the index of the first word in [first, last) which has a bit
+		/// equal to bValue, or last if there is none. That is, it skips over words
+		/// which are zero (for bValue == true) or all ones (for bValue == false).
+		///
+		template <bool bValue, typename Word>
+		inline size_t BitWordsFind(const Word* pWords, size_t first, size_t last)
+		{
+			typedef BitWordsBlock<Word> Block;
+
+			const Word skipWord = bValue ? Word(0) : (Word)~Word(0);
+
+			while(((last - first) >= (size_t)Block::kSize) && !(bValue ? Block::Any(pWords + first) : !Block::All(pWords + first)))
+				first += (size_t)Block::kSize;
+
+			// The block we stopped at, if any, has the bit we want in it, so this loop finishes within it.
+			while((first != last) && (pWords[first] == skipWord))
+				++first;
+
+			return first;
+		}
+
+
+		/// BitWordsFindReverse
+		///
+		/// Returns one past the index of the last word in [first, last) which has
+		/// a bit equal to bValue, or first if there is none.
+		///
+		template <bool bValue, typename Word>
+		inline size_t BitWordsFindReverse(const Word* pWords, size_t first, size_t last)
+		{
+			typedef BitWordsBlock<Word> Block;
+
+			const Word skipWord = bValue ? Word(0) : (Word)~Word(0);
+
+			while(((last - first) >= (size_t)Block::kSize) && !(bValue ? Block::Any(pWords + last - Block::kSize) : !Block::All(pWords + last - Block::kSize)))
+				last -= (size_t)Block::kSize;
+
+			while((last != first) && (pWords[last - 1] == skipWord))
+				--last;
+
+			return last;
+		}
+
+
+		/// BitWordsCount
+		///
+		/// Returns the number of set bits in the n words at pWords.
+		///
+		template <typename Word>
+		inline uint64_t BitWordsCount(const Word* pWords, size_t n)
+		{
+			typedef BitWordsBlock<Word> Block;
+
+			const size_t blockEnd = n - (n % (size_t)Block::kSize);
+			uint64_t     count    = 0;
+			size_t       i        = 0;
+
+			for(; i < blockEnd; i += (size_t)Block::kSize)
+				count += Block::Count(pWords + i);
+
+			for(; i < n; ++i)
+				count += GetBitCount(pWords[i]);
+
+			return count;
+		}
+
+
+		/// BitWordsAndOp / BitWordsOrOp / BitWordsXorOp / BitWordsAndNotOp
+		///
+		/// The operations BitWordsTransform applies, on words and on vectors.
+		///
+		struct BitWordsAndOp
+		{
+			template <typename Word> Word operator()(Word a, Word b) const { return (Word)(a & b); }
+			#if EASTL_BIT_WORDS_AVX2
+				__m256i operator()(__m256i a, __m256i b) const { return _mm256_and_si256(a, b); }
+			#elif EASTL_BIT_WORDS_SSE2
+				__m128i operator()(__m128i a, __m128i b) const { return _mm_and_si128(a, b); }
+			#endif
+		};
+
+		struct BitWordsOrOp
+		{
+			template <typename Word> Word operator()(Word a, Word b) const { return (Word)(a | b); }
+			#if EASTL_BIT_WORDS_AVX2
+				__m256i operator()(__m256i a, __m256i b) const { return _mm256_or_si256(a, b); }
+			#elif EASTL_BIT_WORDS_SSE2
+				__m128i operator()(__m128i a, __m128i b) const { return _mm_or_si128(a, b); }
+			#endif
+		};
+
+		struct BitWordsXorOp
+		{
+			template <typename Word> Word operator()(Word a, Word b) const { return (Word)(a ^ b); }
+			#if EASTL_BIT_WORDS_AVX2
+				__m256i operator()(__m256i a, __m256i b) const { return _mm256_xor_si256(a, b); }
+			#elif EASTL_BIT_WORDS_SSE2
+				__m128i operator()(__m128i a, __m128i b) const { return _mm_xor_si128(a, b); }
+			#endif
+		};
+
+		struct BitWordsAndNotOp // a & ~b
+		{
+			template <typename Word> Word operator()(Word a, Word b) const { return (Word)(a & ~b); }
+			#if EASTL_BIT_WORDS_AVX2
+				__m256i operator()(__m256i a, __m256i b) const { return _mm256_andnot_si256(b, a); }
+			#elif EASTL_BIT_WORDS_SSE2
+				__m128i operator()(__m128i a, __m128i b) const { return _mm_andnot_si128(b, a); }
+			#endif
+		};
+
+
+		/// BitWordsTransform
+		///
+		/// Sets pDest[i] = op(pDest[i], pSrc[i]) for each of the n words.
+		///
+		template <typename Word, typename Op>
+		inline void BitWordsTransform(Word* pDest, const Word* pSrc, size_t n, Op op)
+		{
+			size_t i = 0;
+
+			#if EASTL_BIT_WORDS_SSE2
+				typedef BitWordsBlock<Word> Block;
+
+				for(const size_t blockEnd = n - (n % (size_t)Block::kSize); i < blockEnd; i += (size_t)Block::kSize)
+				{
+					for(size_t v = 0; v < (size_t)Block::kVectorCount; v++)
+						Block::Store(pDest + i, v, op(Block::Load(pDest + i, v), Block::Load(pSrc + i, v)));
+				}
+			#endif
+
+			for(; i < n; ++i)
+				pDest[i] = op(pDest[i], pSrc[i]);
+		}
+
+	} // namespace Internal
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,2136 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements btree, the B-tree basis for the btree_map, btree_multimap,
+// btree_set and btree_multiset containers.
+//
+// Unlike rbtree, which allocates one node per element, a btree stores up to
+// kNodeValueCount elements contiguously in each node, with the node size in
+// bytes given as a template parameter (EASTL_BTREE_DEFAULT_NODE_SIZE by default).
+// A lookup touches one node per level, and the tree has far fewer levels than
+// a red-black tree of the same size, so lookups and ordered iteration incur far
+// fewer cache misses. Per-element memory overhead is also much lower: there are
+// no per-element pointers or allocation headers, and internal nodes are a small
+// fraction of all nodes.
+//
+// The price for this is that inserting or erasing an element moves the elements
+// after it within its node, and sometimes between nodes. Hence, unlike with
+// rbtree, insert and erase invalidate all iterators, pointers and references
+// into the container, and elements are moved around in memory (so value_type
+// must be movable). Neither node handles nor extract/merge are provided, as
+// there are no per-element nodes to hand out.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_BTREE_H
+#define EASTL_INTERNAL_BTREE_H
+
+
+#include <EABase/eabase.h>
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/allocator.h>
+#include <EASTL/iterator.h>
+#include <EASTL/utility.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/initializer_list.h>
+#include <EASTL/tuple.h>
+
+EA_DISABLE_ALL_VC_WARNINGS()
+#include <new>
+#include <stddef.h>
+EA_RESTORE_ALL_VC_WARNINGS()
+
+
+#ifdef _MSC_VER
+	#pragma warning(push)
+	#pragma warning(disable: 4512)  // 'class' : assignment operator could not be generated
+	#pragma warning(disable: 4530)  // C++ exception handler used, but unwind semantics are not enabled. Specify /EHsc
+	#pragma warning(disable: 4571)  // catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught.
+#endif
+
+
+namespace eastl
+{
+
+	/// EASTL_BTREE_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_BTREE_DEFAULT_NAME
+		#define EASTL_BTREE_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " btree" // Unless the user overrides something, this is "EASTL btree".
+	#endif
+
+
+	/// EASTL_BTREE_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_BTREE_DEFAULT_ALLOCATOR
+		#define EASTL_BTREE_DEFAULT_ALLOCATOR allocator_type(EASTL_BTREE_DEFAULT_NAME)
+	#endif
+
+
+	/// EASTL_BTREE_DEFAULT_NODE_SIZE
+	///
+	/// The default target size, in bytes, of a btree leaf node. Values of 256 to
+	/// 512 bytes (four to eight cache lines) work well for small keys: nodes are
+	/// large enough to make the tree shallow, but small enough that the binary
+	/// search within a node and the moving of elements on insertion stay cheap.
+	/// Nodes always hold at least three elements, however large value_type is.
+	///
+	#ifndef EASTL_BTREE_DEFAULT_NODE_SIZE
+		#define EASTL_BTREE_DEFAULT_NODE_SIZE 256
+	#endif
+
+
+
+	/// btree_node_base
+	///
+	/// The part of a btree node which doesn't depend on the value type.
+	///
+	struct btree_node_base
+	{
+		btree_node_base* mpParent;   // NULL for the root node.
+		uint16_t         mnPosition; // The index of this node in its parent's child array.
+		uint16_t         mnCount;    // The number of values in this node.
+		bool             mbLeaf;     // Leaf nodes have no child array.
+	};
+
+
+	template <typename Value, size_t nodeSize>
+	struct btree_internal_node;
+
+
+	/// btree_node
+	///
+	/// A leaf node. Internal nodes (btree_internal_node) add the child array.
+	/// Values are constructed in mValues[0, mnCount) only.
+	///
+	template <typename Value, size_t nodeSize>
+	struct btree_node : public btree_node_base
+	{
+		static const size_t kTargetValueCount = (nodeSize > sizeof(btree_node_base)) ? ((nodeSize - sizeof(btree_node_base)) / sizeof(Value)) : 0;
+		static const size_t kValueCount       = (kTargetValueCount < 3) ? 3 : kTargetValueCount;
+
+		static_assert(kValueCount < 0xffff, "btree nodes can hold at most 65534 values.");
+
+		typedef btree_internal_node<Value, nodeSize> internal_node_type;
+
+		typename aligned_storage<sizeof(Value), EASTL_ALIGN_OF(Value)>::type mValues[kValueCount];
+
+		Value* value_ptr(int i)
+			{ return reinterpret_cast<Value*>(&mValues[i]); }
+
+		Value& value(int i)
+			{ return *reinterpret_cast<Value*>(&mValues[i]); }
+
+		btree_node* parent() const
+			{ return static_cast<btree_node*>(mpParent); }
+
+		btree_node* child(int i) const
+			{ return static_cast<const internal_node_type*>(this)->mpChildren[i]; }
+
+		void set_child(int i, btree_node* pChild)
+		{
+			static_cast<internal_node_type*>(this)->mpChildren[i] = pChild;
+			pChild->mpParent   = this;
+			pChild->mnPosition = (uint16_t)i;
+		}
+	};
+
+
+	/// btree_internal_node
+	///
+	/// An internal node, which has (mnCount + 1) children.
+	///
+	template <typename Value, size_t nodeSize>
+	struct btree_internal_node : public btree_node<Value, nodeSize>
+	{
+		btree_node<Value, nodeSize>* mpChildren[btree_node<Value, nodeSize>::kValueCount + 1];
+	};
+
+
+
+	/// btree_iterator
+	///
+	/// Refers to a value by its node and its position within the node. end() is
+	/// one past the last value of the rightmost leaf, or (NULL, 0) for an empty tree.
+	///
+	template <typename T, typename Pointer, typename Reference, size_t nodeSize>
+	struct btree_iterator
+	{
+		typedef btree_iterator<T, Pointer, Reference, nodeSize>     this_type;
+		typedef btree_iterator<T, T*, T&, nodeSize>                 iterator;
+		typedef btree_iterator<T, const T*, const T&, nodeSize>     const_iterator;
+		typedef eastl_size_t                                        size_type;     // See config.h for the definition of eastl_size_t, which defaults to uint32_t.
+		typedef ptrdiff_t                                           difference_type;
+		typedef T                                                   value_type;
+		typedef btree_node<T, nodeSize>                             node_type;
+		typedef Pointer                                             pointer;
+		typedef Reference                                           reference;
+		typedef EASTL_ITC_NS::bidirectional_iterator_tag            iterator_category;
+
+	public:
+		node_type* mpNode;
+		int        mnPosition;
+
+	public:
+		btree_iterator()
+			: mpNode(NULL), mnPosition(0) { }
+
+		btree_iterator(const node_type* pNode, int nPosition)
+			: mpNode(const_cast<node_type*>(pNode)), mnPosition(nPosition) { }
+
+		btree_iterator(const iterator& x)
+			: mpNode(x.mpNode), mnPosition(x.mnPosition) { }
+
+		reference operator*() const
+			{ return mpNode->value(mnPosition); }
+
+		pointer operator->() const
+			{ return mpNode->value_ptr(mnPosition); }
+
+		this_type& operator++()
+		{
+			if(!mpNode->mbLeaf || (++mnPosition == (int)mpNode->mnCount))
+				DoIncrementSlow();
+			return *this;
+		}
+
+		this_type operator++(int)
+		{
+			this_type temp(*this);
+			operator++();
+			return temp;
+		}
+
+		this_type& operator--()
+		{
+			if(!mpNode->mbLeaf || (--mnPosition < 0))
+				DoDecrementSlow();
+			return *this;
+		}
+
+		this_type operator--(int)
+		{
+			this_type temp(*this);
+			operator--();
+			return temp;
+		}
+
+	protected:
+		void DoIncrementSlow();
+		void DoDecrementSlow();
+
+	}; // btree_iterator
+
+
+
+	/// btree
+	///
+	/// btree is the B-tree basis for btree_map, btree_multimap, btree_set and
+	/// btree_multiset. Its template parameters have the same meaning as those of
+	/// rbtree, plus nodeSize, the target size in bytes of a leaf node.
+	///
+	/// Values are kept in leaves and in internal nodes, as with a classic B-tree.
+	/// Every node other than the root holds between one and kNodeValueCount values
+	/// and is usually at least half full, and all leaves are at the same depth.
+	/// Splits are biased by the insertion position: a node which overflows at its
+	/// end is split into a full node and an empty one, so that building a tree
+	/// from sorted input (e.g. via insert(end(), value) or the range insert) leaves
+	/// nodes completely full.
+	///
+	template <typename Key, typename Value, typename Compare, typename Allocator,
+			  typename ExtractKey, bool bMutableIterators, bool bUniqueKeys, size_t nodeSize>
+	class btree
+	{
+	public:
+		typedef ptrdiff_t                                                                       difference_type;
+		typedef eastl_size_t                                                                    size_type;     // See config.h for the definition of eastl_size_t, which defaults to uint32_t.
+		typedef Key                                                                             key_type;
+		typedef Value                                                                           value_type;
+		typedef btree_node<value_type, nodeSize>                                                node_type;
+		typedef btree_internal_node<value_type, nodeSize>                                       internal_node_type;
+		typedef value_type&                                                                     reference;
+		typedef const value_type&                                                               const_reference;
+		typedef value_type*                                                                     pointer;
+		typedef const value_type*                                                               const_pointer;
+
+		typedef typename type_select<bMutableIterators,
+					btree_iterator<value_type, value_type*, value_type&, nodeSize>,
+					btree_iterator<value_type, const value_type*, const value_type&, nodeSize> >::type iterator;
+		typedef btree_iterator<value_type, const value_type*, const value_type&, nodeSize>      const_iterator;
+		typedef eastl::reverse_iterator<iterator>                                               reverse_iterator;
+		typedef eastl::reverse_iterator<const_iterator>                                         const_reverse_iterator;
+
+		typedef Allocator                                                                       allocator_type;
+		typedef Compare                                                                         key_compare;
+		typedef ExtractKey                                                                      extract_key;
+		typedef typename type_select<bUniqueKeys, eastl::pair<iterator, bool>, iterator>::type  insert_return_type;  // map/set::insert return a pair, multimap/multiset::iterator return an iterator.
+		typedef btree<Key, Value, Compare, Allocator, ExtractKey,
+					  bMutableIterators, bUniqueKeys, nodeSize>                                 this_type;
+		typedef integral_constant<bool, bUniqueKeys>                                            has_unique_keys_type;
+
+		static const int kNodeValueCount    = (int)node_type::kValueCount; /// The maximum number of values in a node.
+		static const int kMinNodeValueCount = kNodeValueCount / 2;         /// Nodes with fewer values are merged or rebalanced after an erase.
+
+	public:
+		node_type*        mpRoot;       /// NULL if the tree is empty.
+		node_type*        mpLeftmost;   /// The leaf which holds begin().
+		node_type*        mpRightmost;  /// The leaf which holds the last value; end() is one past it.
+		size_type         mnSize;       /// The number of values in the tree.
+		Compare           mCompare;
+		allocator_type    mAllocator;
+
+	public:
+		// ctor/dtor
+		btree();
+		btree(const allocator_type& allocator);
+		btree(const Compare& compare, const allocator_type& allocator = EASTL_BTREE_DEFAULT_ALLOCATOR);
+		btree(const this_type& x);
+		btree(this_type&& x);
+		btree(this_type&& x, const allocator_type& allocator);
+
+		template <typename InputIterator>
+		btree(InputIterator first, InputIterator last, const Compare& compare, const allocator_type& allocator = EASTL_BTREE_DEFAULT_ALLOCATOR);
+
+	   ~btree();
+
+	public:
+		// properties
+		const allocator_type& get_allocator() const EA_NOEXCEPT { return mAllocator; }
+		allocator_type&       get_allocator() EA_NOEXCEPT       { return mAllocator; }
+		void                  set_allocator(const allocator_type& allocator) { mAllocator = allocator; }
+
+		const key_compare& key_comp() const { return mCompare; }
+		key_compare&       key_comp()       { return mCompare; }
+
+		this_type& operator=(const this_type& x);
+		this_type& operator=(std::initializer_list<value_type> ilist);
+		this_type& operator=(this_type&& x);
+
+		void swap(this_type& x);
+
+	public:
+		// iterators
+		iterator        begin() EA_NOEXCEPT        { return iterator(mpLeftmost, 0); }
+		const_iterator  begin() const EA_NOEXCEPT  { return const_iterator(mpLeftmost, 0); }
+		const_iterator  cbegin() const EA_NOEXCEPT { return const_iterator(mpLeftmost, 0); }
+
+		iterator        end() EA_NOEXCEPT        { return iterator(mpRightmost, mpRightmost ? (int)mpRightmost->mnCount : 0); }
+		const_iterator  end() const EA_NOEXCEPT  { return const_iterator(mpRightmost, mpRightmost ? (int)mpRightmost->mnCount : 0); }
+		const_iterator  cend() const EA_NOEXCEPT { return const_iterator(mpRightmost, mpRightmost ? (int)mpRightmost->mnCount : 0); }
+
+		reverse_iterator        rbegin() EA_NOEXCEPT        { return reverse_iterator(end()); }
+		const_reverse_iterator  rbegin() const EA_NOEXCEPT  { return const_reverse_iterator(end()); }
+		const_reverse_iterator  crbegin() const EA_NOEXCEPT { return const_reverse_iterator(end()); }
+
+		reverse_iterator        rend() EA_NOEXCEPT        { return reverse_iterator(begin()); }
+		const_reverse_iterator  rend() const EA_NOEXCEPT  { return const_reverse_iterator(begin()); }
+		const_reverse_iterator  crend() const EA_NOEXCEPT { return const_reverse_iterator(begin()); }
+
+	public:
+		bool      empty() const EA_NOEXCEPT { return (mnSize == 0); }
+		size_type size() const EA_NOEXCEPT  { return mnSize; }
+
+		template <class... Args>
+		insert_return_type emplace(Args&&... args);
+
+		template <class... Args>
+		iterator emplace_hint(const_iterator position, Args&&... args);
+
+		template <class... Args> eastl::pair<iterator, bool> try_emplace(const key_type& k, Args&&... args);
+		template <class... Args> eastl::pair<iterator, bool> try_emplace(key_type&& k, Args&&... args);
+		template <class... Args> iterator                    try_emplace(const_iterator position, const key_type& k, Args&&... args);
+		template <class... Args> iterator                    try_emplace(const_iterator position, key_type&& k, Args&&... args);
+
+		// Standard conversion overload to avoid the overhead of mismatched 'pair<const Key, Value>' types.
+		template <class P, class = typename eastl::enable_if<eastl::is_constructible<value_type, P&&>::value>::type>
+		insert_return_type insert(P&& otherValue);
+
+		// Currently limited to value_type instead of P because it collides with insert(InputIterator, InputIterator).
+		// To allow this to work with templated P we need to implement a compile-time specialization for the
+		// case that P&& is const_iterator and have that specialization handle insert(InputIterator, InputIterator)
+		// instead of insert(InputIterator, InputIterator). Curiously, neither libstdc++ nor libc++
+		// implement this function either, which suggests they ran into the same problem I did here
+		// and haven't yet resolved it (at least as of March 2014, GCC 4.8.1).
+		iterator insert(const_iterator hint, value_type&& value);
+
+		/// map::insert and set::insert return a pair, while multimap::insert and
+		/// multiset::insert return an iterator.
+		insert_return_type insert(const value_type& value);
+
+		/// The value is inserted immediately before position if that keeps the
+		/// tree ordered, which makes appending sorted values at end() cheap.
+		/// Otherwise position is ignored.
+		iterator insert(const_iterator position, const value_type& value);
+
+		void insert(std::initializer_list<value_type> ilist);
+
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last);
+
+		/// Unlike rbtree::erase, these invalidate all iterators. The returned iterator refers
+		/// to the value which followed the erased value(s), or is end().
+		iterator         erase(const_iterator position);
+		iterator         erase(const_iterator first, const_iterator last);
+		reverse_iterator erase(const_reverse_iterator position);
+		reverse_iterator erase(const_reverse_iterator first, const_reverse_iterator last);
+
+		// For some reason, multiple STL versions make a specialization
+		// for erasing an array of key_types. I'm pretty sure we don't
+		// need this, but just to be safe we will follow suit.
+		// The implementation is trivial. Returns void because the values
+		// could well be randomly distributed throughout the tree and thus
+		// a return value would be nearly meaningless.
+		void erase(const key_type* first, const key_type* last);
+
+		void clear();
+		void reset_lose_memory(); // This is a unilateral reset to an initially empty state. No destructors are called, no deallocation occurs.
+
+		iterator       find(const key_type& key);
+		const_iterator find(const key_type& key) const;
+
+		/// Implements a find whereby the user supplies a comparison of a different type
+		/// than the tree's value_type. See rbtree::find_as for details.
+		template <typename U, typename Compare2>
+		iterator       find_as(const U& u, Compare2 compare2);
+
+		template <typename U, typename Compare2>
+		const_iterator find_as(const U& u, Compare2 compare2) const;
+
+		iterator       lower_bound(const key_type& key);
+		const_iterator lower_bound(const key_type& key) const;
+
+		iterator       upper_bound(const key_type& key);
+		const_iterator upper_bound(const key_type& key) const;
+
+		bool contains(const key_type& key) const { return (find(key) != end()); }
+
+		/// Heterogeneous versions of find, contains, lower_bound and upper_bound, available
+		/// only if Compare is transparent. See the heterogeneous lookup notes in red_black_tree.h.
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type find(const U& u)
+			{ return DoFind(u, mCompare); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type find(const U& u) const
+			{ return DoFind(u, mCompare); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, bool>::type contains(const U& u) const
+			{ return (DoFind(u, mCompare) != end()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type lower_bound(const U& u)
+			{ return DoLowerBound(u, mCompare); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type lower_bound(const U& u) const
+			{ return DoLowerBound(u, mCompare); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type upper_bound(const U& u)
+			{ return DoUpperBound(u, mCompare); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type upper_bound(const U& u) const
+			{ return DoUpperBound(u, mCompare); }
+
+		bool validate() const;
+		int  validate_iterator(const_iterator i) const;
+
+	protected:
+		node_type* DoAllocateNode(bool bLeaf);
+		void       DoFreeNode(node_type* pNode);
+		void       DoNukeSubtree(node_type* pNode);
+		node_type* DoCopySubtree(const node_type* pSource);
+		void       DoCopyFrom(const this_type& x);
+		void       DoMoveValue(value_type* pDest, value_type* pSource);
+
+		template <typename U, typename Compare2>
+		int DoLowerBoundInNode(const node_type* pNode, const U& u, Compare2 compare2) const;
+
+		template <typename U, typename Compare2>
+		int DoUpperBoundInNode(const node_type* pNode, const U& u, Compare2 compare2) const;
+
+		iterator DoEnd() const;
+		iterator DoNextValue(iterator it) const;
+
+		template <typename U, typename Compare2>
+		iterator DoFind(const U& u, Compare2 compare2) const;
+
+		template <typename U, typename Compare2>
+		iterator DoLowerBound(const U& u, Compare2 compare2) const;
+
+		template <typename U, typename Compare2>
+		iterator DoUpperBound(const U& u, Compare2 compare2) const;
+
+		template <class... Args>
+		eastl::pair<iterator, bool> DoInsertUniqueKey(const key_type& key, Args&&... args);
+
+		template <class... Args>
+		iterator DoInsertNonuniqueKey(const key_type& key, Args&&... args);
+
+		template <class... Args>
+		iterator DoInsertUniqueKeyHint(const_iterator position, const key_type& key, Args&&... args);
+
+		template <class... Args>
+		iterator DoInsertNonuniqueKeyHint(const_iterator position, const key_type& key, Args&&... args);
+
+		template <class... Args>
+		eastl::pair<iterator, bool> DoInsertValue(true_type, Args&&... args);
+
+		template <class... Args>
+		iterator DoInsertValue(false_type, Args&&... args);
+
+		eastl::pair<iterator, bool> DoInsertValue(true_type, value_type&& value);
+		iterator                    DoInsertValue(false_type, value_type&& value);
+
+		template <class... Args>
+		iterator DoInsertValueHint(true_type, const_iterator position, Args&&... args);
+
+		template <class... Args>
+		iterator DoInsertValueHint(false_type, const_iterator position, Args&&... args);
+
+		iterator DoInsertValueHint(true_type, const_iterator position, value_type&& value);
+		iterator DoInsertValueHint(false_type, const_iterator position, value_type&& value);
+
+		eastl::pair<iterator, bool> DoInsertValue(true_type, const value_type& value);
+		iterator                    DoInsertValue(false_type, const value_type& value);
+		iterator                    DoInsertValueHint(true_type, const_iterator position, const value_type& value);
+		iterator                    DoInsertValueHint(false_type, const_iterator position, const value_type& value);
+
+		eastl::pair<iterator, bool> DoInsertKey(true_type, const key_type& key);
+		iterator                    DoInsertKey(false_type, const key_type& key);
+
+		template <class... Args>
+		iterator DoEmplaceValueAt(iterator position, Args&&... args);
+		iterator DoEmplaceValueAt(iterator position, value_type&& value);
+		iterator DoInsertValueAt(iterator position, value_type&& value);
+
+		void DoSplit(iterator& position);
+		void DoInsertSeparator(node_type* pParent, int nPosition, value_type* pValue, node_type* pRight);
+
+		iterator DoRebalanceAfterErase(iterator it);
+		bool     DoMergeOrRebalance(iterator& it);
+		void     DoMergeNodes(node_type* pLeft, node_type* pRight);
+		void     DoRotateLeft(node_type* pLeft, node_type* pRight, int nCount);
+		void     DoRotateRight(node_type* pLeft, node_type* pRight, int nCount);
+		void     DoShrinkRoot();
+
+		int DoValidateSubtree(const node_type* pNode, int nDepth, int& nLeafDepth, size_type& nValueCount) const;
+
+	}; // btree
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// btree_iterator functions
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename T, typename Pointer, typename Reference, size_t nodeSize>
+	void btree_iterator<T, Pointer, Reference, nodeSize>::DoIncrementSlow()
+	{
+		if(mpNode->mbLeaf)
+		{
+			// We were at the last value of a leaf. The next value is in the nearest ancestor
+			// which we reach from a child other than its last one. If there is no such
+			// ancestor we were at the last value of the tree, and we stay at end().
+			node_type* const pNode     = mpNode;
+			const int        nPosition = mnPosition;
+
+			while((mnPosition == (int)mpNode->mnCount) && mpNode->mpParent)
+			{
+				mnPosition = mpNode->mnPosition;
+				mpNode     = mpNode->parent();
+			}
+
+			if(mnPosition == (int)mpNode->mnCount)
+			{
+				mpNode     = pNode;
+				mnPosition = nPosition;
+			}
+		}
+		else
+		{
+			// The next value is the first value of the leftmost leaf of the subtree after this value.
+			mpNode = mpNode->child(mnPosition + 1);
+
+			while(!mpNode->mbLeaf)
+				mpNode = mpNode->child(0);
+
+			mnPosition = 0;
+		}
+	}
+
+
+	template <typename T, typename Pointer, typename Reference, size_t nodeSize>
+	void btree_iterator<T, Pointer, Reference, nodeSize>::DoDecrementSlow()
+	{
+		if(mpNode->mbLeaf)
+		{
+			// We were at the first value of a leaf. This is the mirror image of the above.
+			node_type* const pNode     = mpNode;
+			const int        nPosition = mnPosition;
+
+			while((mnPosition < 0) && mpNode->mpParent)
+			{
+				mnPosition = (int)mpNode->mnPosition - 1;
+				mpNode     = mpNode->parent();
+			}
+
+			if(mnPosition < 0)
+			{
+				mpNode     = pNode;
+				mnPosition = nPosition;
+			}
+		}
+		else
+		{
+			// The previous value is the last value of the rightmost leaf of the subtree before this value.
+			mpNode = mpNode->child(mnPosition);
+
+			while(!mpNode->mbLeaf)
+				mpNode = mpNode->child(mpNode->mnCount);
+
+			mnPosition = (int)mpNode->mnCount - 1;
+		}
+	}
+
+
+	// The C++ defect report #179 requires that we support comparisons between const and non-const iterators.
+	// Thus we provide additional template paremeters here to support this. The defect report does not
+	// require us to support comparisons between reverse_iterators and const_reverse_iterators.
+	template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, size_t nodeSize>
+	inline bool operator==(const btree_iterator<T, PointerA, ReferenceA, nodeSize>& a,
+						   const btree_iterator<T, PointerB, ReferenceB, nodeSize>& b)
+	{
+		return (a.mpNode == b.mpNode) && (a.mnPosition == b.mnPosition);
+	}
+
+
+	template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, size_t nodeSize>
+	inline bool operator!=(const btree_iterator<T, PointerA, ReferenceA, nodeSize>& a,
+						   const btree_iterator<T, PointerB, ReferenceB, nodeSize>& b)
+	{
+		return (a.mpNode != b.mpNode) || (a.mnPosition != b.mnPosition);
+	}
+
+
+	// We provide a version of operator!= for the case where the iterators are of the
+	// same type. This helps prevent ambiguity errors in the presence of rel_ops.
+	template <typename T, typename Pointer, typename Reference, size_t nodeSize>
+	inline bool operator!=(const btree_iterator<T, Pointer, Reference, nodeSize>& a,
+						   const btree_iterator<T, Pointer, Reference, nodeSize>& b)
+	{
+		return (a.mpNode != b.mpNode) || (a.mnPosition != b.mnPosition);
+	}
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// btree functions
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline btree<K, V, C, A, E, bM, bU, N>::btree()
+		: mpRoot(NULL),
+		  mpLeftmost(NULL),
+		  mpRightmost(NULL),
+		  mnSize(0),
+		  mCompare(),
+		  mAllocator(EASTL_BTREE_DEFAULT_NAME)
+	{
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline btree<K, V, C, A, E, bM, bU, N>::btree(const allocator_type& allocator)
+		: mpRoot(NULL),
+		  mpLeftmost(NULL),
+		  mpRightmost(NULL),
+		  mnSize(0),
+		  mCompare(),
+		  mAllocator(allocator)
+	{
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline btree<K, V, C, A, E, bM, bU, N>::btree(const C& compare, const allocator_type& allocator)
+		: mpRoot(NULL),
+		  mpLeftmost(NULL),
+		  mpRightmost(NULL),
+		  mnSize(0),
+		  mCompare(compare),
+		  mAllocator(allocator)
+	{
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline btree<K, V, C, A, E, bM, bU, N>::btree(const this_type& x)
+		: mpRoot(NULL),
+		  mpLeftmost(NULL),
+		  mpRightmost(NULL),
+		  mnSize(0),
+		  mCompare(x.mCompare),
+		  mAllocator(x.mAllocator)
+	{
+		DoCopyFrom(x);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline btree<K, V, C, A, E, bM, bU, N>::btree(this_type&& x)
+		: mpRoot(NULL),
+		  mpLeftmost(NULL),
+		  mpRightmost(NULL),
+		  mnSize(0),
+		  mCompare(x.mCompare),
+		  mAllocator(x.mAllocator)
+	{
+		swap(x);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline btree<K, V, C, A, E, bM, bU, N>::btree(this_type&& x, const allocator_type& allocator)
+		: mpRoot(NULL),
+		  mpLeftmost(NULL),
+		  mpRightmost(NULL),
+		  mnSize(0),
+		  mCompare(x.mCompare),
+		  mAllocator(allocator)
+	{
+		swap(x); // swap will do an appropriate copy if the allocators differ.
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <typename InputIterator>
+	inline btree<K, V, C, A, E, bM, bU, N>::btree(InputIterator first, InputIterator last, const C& compare, const allocator_type& allocator)
+		: mpRoot(NULL),
+		  mpLeftmost(NULL),
+		  mpRightmost(NULL),
+		  mnSize(0),
+		  mCompare(compare),
+		  mAllocator(allocator)
+	{
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+		#endif
+				insert(first, last);
+		#if EASTL_EXCEPTIONS_ENABLED
+			}
+			catch(...)
+			{
+				clear();
+				throw;
+			}
+		#endif
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline btree<K, V, C, A, E, bM, bU, N>::~btree()
+	{
+		// Erase the entire tree. DoNukeSubtree is not a
+		// conventional erase function, as it does no rebalancing.
+		if(mpRoot)
+			DoNukeSubtree(mpRoot);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::this_type&
+	btree<K, V, C, A, E, bM, bU, N>::operator=(const this_type& x)
+	{
+		if(this != &x)
+		{
+			clear();
+
+			#if EASTL_ALLOCATOR_COPY_ENABLED
+				mAllocator = x.mAllocator;
+			#endif
+
+			mCompare = x.mCompare;
+			DoCopyFrom(x);
+		}
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::this_type&
+	btree<K, V, C, A, E, bM, bU, N>::operator=(this_type&& x)
+	{
+		if(this != &x)
+		{
+			clear();        // To consider: Are we really required to clear here? x is going away soon and will clear itself in its dtor.
+			swap(x);        // member swap handles the case that x has a different allocator than our allocator by doing a copy.
+		}
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::this_type&
+	btree<K, V, C, A, E, bM, bU, N>::operator=(std::initializer_list<value_type> ilist)
+	{
+		clear();
+		insert(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	void btree<K, V, C, A, E, bM, bU, N>::swap(this_type& x)
+	{
+		#if EASTL_RBTREE_LEGACY_SWAP_BEHAVIOUR_REQUIRES_COPY_CTOR
+			if(mAllocator == x.mAllocator) // If allocators are equivalent...
+		#endif
+			{
+				// The root is the only node which refers to the tree, and it does so only by
+				// having no parent, so swapping the members is all there is to it.
+				eastl::swap(mpRoot,      x.mpRoot);
+				eastl::swap(mpLeftmost,  x.mpLeftmost);
+				eastl::swap(mpRightmost, x.mpRightmost);
+				eastl::swap(mnSize,      x.mnSize);
+				eastl::swap(mCompare,    x.mCompare);
+				#if !EASTL_RBTREE_LEGACY_SWAP_BEHAVIOUR_REQUIRES_COPY_CTOR
+					eastl::swap(mAllocator, x.mAllocator);
+				#endif
+			}
+		#if EASTL_RBTREE_LEGACY_SWAP_BEHAVIOUR_REQUIRES_COPY_CTOR
+			else
+			{
+				const this_type temp(*this); // Can't call eastl::swap because that would
+				*this = x;                   // itself call this member swap function.
+				x     = temp;
+			}
+		#endif
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::insert_return_type
+	btree<K, V, C, A, E, bM, bU, N>::emplace(Args&&... args)
+	{
+		return DoInsertValue(has_unique_keys_type(), eastl::forward<Args>(args)...);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::emplace_hint(const_iterator position, Args&&... args)
+	{
+		return DoInsertValueHint(has_unique_keys_type(), position, eastl::forward<Args>(args)...);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline eastl::pair<typename btree<K, V, C, A, E, bM, bU, N>::iterator, bool>
+	btree<K, V, C, A, E, bM, bU, N>::try_emplace(const key_type& key, Args&&... args)
+	{
+		// Unlike emplace, this constructs the value only if the key isn't present.
+		return DoInsertUniqueKey(key, piecewise_construct, eastl::forward_as_tuple(key), eastl::forward_as_tuple(eastl::forward<Args>(args)...));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline eastl::pair<typename btree<K, V, C, A, E, bM, bU, N>::iterator, bool>
+	btree<K, V, C, A, E, bM, bU, N>::try_emplace(key_type&& key, Args&&... args)
+	{
+		// The key is only moved from after the search for its position is complete.
+		return DoInsertUniqueKey(key, piecewise_construct, eastl::forward_as_tuple(eastl::move(key)), eastl::forward_as_tuple(eastl::forward<Args>(args)...));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::try_emplace(const_iterator position, const key_type& key, Args&&... args)
+	{
+		return DoInsertUniqueKeyHint(position, key, piecewise_construct, eastl::forward_as_tuple(key), eastl::forward_as_tuple(eastl::forward<Args>(args)...));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::try_emplace(const_iterator position, key_type&& key, Args&&... args)
+	{
+		return DoInsertUniqueKeyHint(position, key, piecewise_construct, eastl::forward_as_tuple(eastl::move(key)), eastl::forward_as_tuple(eastl::forward<Args>(args)...));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class P, class>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::insert_return_type
+	btree<K, V, C, A, E, bM, bU, N>::insert(P&& otherValue)
+	{
+		return DoInsertValue(has_unique_keys_type(), eastl::forward<P>(otherValue));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::insert(const_iterator position, value_type&& value)
+	{
+		return DoInsertValueHint(has_unique_keys_type(), position, eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::insert_return_type
+	btree<K, V, C, A, E, bM, bU, N>::insert(const value_type& value)
+	{
+		return DoInsertValue(has_unique_keys_type(), value);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::insert(const_iterator position, const value_type& value)
+	{
+		return DoInsertValueHint(has_unique_keys_type(), position, value);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline void btree<K, V, C, A, E, bM, bU, N>::insert(std::initializer_list<value_type> ilist)
+	{
+		insert(ilist.begin(), ilist.end());
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <typename InputIterator>
+	void btree<K, V, C, A, E, bM, bU, N>::insert(InputIterator first, InputIterator last)
+	{
+		// Hinting at end() makes sorted input take the fast path in DoInsertValueHint.
+		for( ; first != last; ++first)
+			DoInsertValueHint(has_unique_keys_type(), end(), *first);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::erase(const_iterator position)
+	{
+		EASTL_ASSERT((position.mpNode != NULL) && (position.mnPosition < (int)position.mpNode->mnCount));
+
+		iterator   it(position.mpNode, position.mnPosition); // Convert from const_iterator to iterator.
+		const bool bInternal = !it.mpNode->mbLeaf;
+
+		it.mpNode->value_ptr(it.mnPosition)->~value_type();
+
+		if(bInternal)
+		{
+			// Values can only be removed from leaves, so we fill the hole with the value's
+			// predecessor, which is the last value of a leaf, and remove that value instead.
+			iterator itPrev(it);
+			--itPrev;
+			DoMoveValue(it.mpNode->value_ptr(it.mnPosition), itPrev.mpNode->value_ptr(itPrev.mnPosition));
+			it = itPrev;
+		}
+
+		// Close the hole at it.
+		node_type* const pLeaf = it.mpNode;
+
+		for(int i = it.mnPosition + 1; i < (int)pLeaf->mnCount; ++i)
+			DoMoveValue(pLeaf->value_ptr(i - 1), pLeaf->value_ptr(i));
+
+		--pLeaf->mnCount;
+		--mnSize;
+
+		iterator result(DoRebalanceAfterErase(it));
+
+		// If the value was moved up from a leaf, result now refers to that value, which
+		// is where the erased value was; the value we want is the one after it.
+		if(bInternal)
+			++result;
+
+		return result;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::erase(const_iterator first, const_iterator last)
+	{
+		// We expect that if the user means to clear a container, they will call clear.
+		if((first == begin()) && (last == end()))
+		{
+			clear();
+			return end();
+		}
+
+		// Each erase invalidates last, so we count instead.
+		iterator it(first.mpNode, first.mnPosition);
+
+		for(difference_type n = eastl::distance(first, last); n > 0; --n)
+			it = erase(it);
+
+		return it;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::reverse_iterator
+	btree<K, V, C, A, E, bM, bU, N>::erase(const_reverse_iterator position)
+	{
+		return reverse_iterator(erase((++position).base()));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	typename btree<K, V, C, A, E, bM, bU, N>::reverse_iterator
+	btree<K, V, C, A, E, bM, bU, N>::erase(const_reverse_iterator first, const_reverse_iterator last)
+	{
+		// Version which erases in order from first to last.
+		// difference_type i(first.base() - last.base());
+		// while(i--)
+		//     first = erase(first);
+		// return first;
+
+		// Version which erases in order from last to first, but is slightly more efficient:
+		return reverse_iterator(erase((++last).base(), (++first).base()));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline void btree<K, V, C, A, E, bM, bU, N>::erase(const key_type* first, const key_type* last)
+	{
+		// We have no choice but to run a loop like this, as the first/last range could
+		// have values that are discontiguously located in the tree. And some may not
+		// even be in the tree.
+		while(first != last)
+		{
+			for(iterator it(find(*first)); (it != end()) && !mCompare(*first, extract_key()(*it)); it = find(*first))
+				erase(it);
+			++first;
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline void btree<K, V, C, A, E, bM, bU, N>::clear()
+	{
+		// Erase the entire tree. DoNukeSubtree is not a
+		// conventional erase function, as it does no rebalancing.
+		if(mpRoot)
+			DoNukeSubtree(mpRoot);
+		reset_lose_memory();
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline void btree<K, V, C, A, E, bM, bU, N>::reset_lose_memory()
+	{
+		// The reset_lose_memory function is a special extension function which unilaterally
+		// resets the container to an empty state without freeing the memory of
+		// the contained objects. This is useful for very quickly tearing down a
+		// container built into scratch memory.
+		mpRoot      = NULL;
+		mpLeftmost  = NULL;
+		mpRightmost = NULL;
+		mnSize      = 0;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::find(const key_type& key)
+	{
+		return DoFind(key, mCompare);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::const_iterator
+	btree<K, V, C, A, E, bM, bU, N>::find(const key_type& key) const
+	{
+		return DoFind(key, mCompare);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <typename U, typename Compare2>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::find_as(const U& u, Compare2 compare2)
+	{
+		return DoFind(u, compare2);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <typename U, typename Compare2>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::const_iterator
+	btree<K, V, C, A, E, bM, bU, N>::find_as(const U& u, Compare2 compare2) const
+	{
+		return DoFind(u, compare2);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::lower_bound(const key_type& key)
+	{
+		return DoLowerBound(key, mCompare);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::const_iterator
+	btree<K, V, C, A, E, bM, bU, N>::lower_bound(const key_type& key) const
+	{
+		return DoLowerBound(key, mCompare);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::upper_bound(const key_type& key)
+	{
+		return DoUpperBound(key, mCompare);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::const_iterator
+	btree<K, V, C, A, E, bM, bU, N>::upper_bound(const key_type& key) const
+	{
+		return DoUpperBound(key, mCompare);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	bool btree<K, V, C, A, E, bM, bU, N>::validate() const
+	{
+		if(!mpRoot)
+			return !mpLeftmost && !mpRightmost && (mnSize == 0);
+
+		if(mpRoot->mpParent || !mpLeftmost || !mpRightmost)
+			return false;
+
+		int       nLeafDepth  = -1;
+		size_type nValueCount = 0;
+
+		if(!DoValidateSubtree(mpRoot, 0, nLeafDepth, nValueCount) || (nValueCount != mnSize))
+			return false;
+
+		// Verify that mpLeftmost and mpRightmost are what they should be.
+		const node_type* pLeftmost  = mpRoot;
+		const node_type* pRightmost = mpRoot;
+
+		while(!pLeftmost->mbLeaf)
+			pLeftmost = pLeftmost->child(0);
+
+		while(!pRightmost->mbLeaf)
+			pRightmost = pRightmost->child(pRightmost->mnCount);
+
+		if((pLeftmost != mpLeftmost) || (pRightmost != mpRightmost))
+			return false;
+
+		// Verify that the values are in order, which verifies the order of the nodes as well.
+		extract_key extractKey;
+		size_type   nIteratedCount = 0;
+
+		for(const_iterator it = begin(), itPrev = it; it != end(); itPrev = it, ++it, ++nIteratedCount)
+		{
+			if(nIteratedCount && (bU ? !mCompare(extractKey(*itPrev), extractKey(*it)) : mCompare(extractKey(*it), extractKey(*itPrev))))
+				return false;
+		}
+
+		return (nIteratedCount == mnSize);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	int btree<K, V, C, A, E, bM, bU, N>::DoValidateSubtree(const node_type* pNode, int nDepth, int& nLeafDepth, size_type& nValueCount) const
+	{
+		if((pNode->mnCount == 0) || ((int)pNode->mnCount > kNodeValueCount))
+			return 0;
+
+		nValueCount += pNode->mnCount;
+
+		if(pNode->mbLeaf)
+		{
+			if(nLeafDepth < 0)
+				nLeafDepth = nDepth;
+			return (nLeafDepth == nDepth); // All leaves must be at the same depth.
+		}
+
+		for(int i = 0; i <= (int)pNode->mnCount; ++i)
+		{
+			const node_type* const pChild = pNode->child(i);
+
+			if((pChild->mpParent != pNode) || (pChild->mnPosition != i) || !DoValidateSubtree(pChild, nDepth + 1, nLeafDepth, nValueCount))
+				return 0;
+		}
+
+		return 1;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline int btree<K, V, C, A, E, bM, bU, N>::validate_iterator(const_iterator i) const
+	{
+		for(const_iterator temp = begin(), tempEnd = end(); temp != tempEnd; ++temp)
+		{
+			if(temp == i)
+				return (isf_valid | isf_current | isf_can_dereference);
+		}
+
+		if(i == end())
+			return (isf_valid | isf_current);
+
+		return isf_none;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::node_type*
+	btree<K, V, C, A, E, bM, bU, N>::DoAllocateNode(bool bLeaf)
+	{
+		// Leaves don't have a child array, so they are allocated at the size of the base node type.
+		const size_t nSize = bLeaf ? sizeof(node_type) : sizeof(internal_node_type);
+		node_type* const pNode = (node_type*)allocate_memory(mAllocator, nSize, EASTL_ALIGN_OF(internal_node_type), 0);
+		EASTL_ASSERT_MSG(pNode != nullptr, "the behaviour of eastl::allocators that return nullptr is not defined.");
+
+		pNode->mpParent   = NULL;
+		pNode->mnPosition = 0;
+		pNode->mnCount    = 0;
+		pNode->mbLeaf     = bLeaf;
+
+		return pNode;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline void btree<K, V, C, A, E, bM, bU, N>::DoFreeNode(node_type* pNode)
+	{
+		EASTLFree(mAllocator, pNode, pNode->mbLeaf ? sizeof(node_type) : sizeof(internal_node_type));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	void btree<K, V, C, A, E, bM, bU, N>::DoNukeSubtree(node_type* pNode)
+	{
+		for(int i = 0; i < (int)pNode->mnCount; ++i)
+			pNode->value_ptr(i)->~value_type();
+
+		if(!pNode->mbLeaf)
+		{
+			for(int i = 0; i <= (int)pNode->mnCount; ++i)
+			{
+				if(pNode->child(i)) // Only NULL for a partially built DoCopySubtree node.
+					DoNukeSubtree(pNode->child(i));
+			}
+		}
+
+		DoFreeNode(pNode);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	typename btree<K, V, C, A, E, bM, bU, N>::node_type*
+	btree<K, V, C, A, E, bM, bU, N>::DoCopySubtree(const node_type* pSource)
+	{
+		node_type* const pNode = DoAllocateNode(pSource->mbLeaf);
+
+		// The children of an internal node start out NULL, so DoNukeSubtree can tear
+		// down whatever has been copied so far if a value or subtree copy throws.
+		if(!pSource->mbLeaf)
+		{
+			for(int i = 0; i <= (int)pSource->mnCount; ++i)
+				static_cast<internal_node_type*>(pNode)->mpChildren[i] = NULL;
+		}
+
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+		#endif
+				if(!pSource->mbLeaf)
+					pNode->set_child(0, DoCopySubtree(pSource->child(0)));
+
+				for(int i = 0; i < (int)pSource->mnCount; ++i)
+				{
+					::new(pNode->value_ptr(i)) value_type(const_cast<node_type*>(pSource)->value(i));
+					++pNode->mnCount;
+
+					if(!pSource->mbLeaf)
+						pNode->set_child(i + 1, DoCopySubtree(pSource->child(i + 1)));
+				}
+		#if EASTL_EXCEPTIONS_ENABLED
+			}
+			catch(...)
+			{
+				DoNukeSubtree(pNode);
+				throw;
+			}
+		#endif
+
+		return pNode;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	void btree<K, V, C, A, E, bM, bU, N>::DoCopyFrom(const this_type& x)
+	{
+		if(x.mpRoot)
+		{
+			mpRoot      = DoCopySubtree(x.mpRoot);
+			mpLeftmost  = mpRoot;
+			mpRightmost = mpRoot;
+
+			while(!mpLeftmost->mbLeaf)
+				mpLeftmost = mpLeftmost->child(0);
+
+			while(!mpRightmost->mbLeaf)
+				mpRightmost = mpRightmost->child(mpRightmost->mnCount);
+
+			mnSize = x.mnSize;
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline void btree<K, V, C, A, E, bM, bU, N>::DoMoveValue(value_type* pDest, value_type* pSource)
+	{
+		::new(pDest) value_type(eastl::move(*pSource));
+		pSource->~value_type();
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <typename U, typename Compare2>
+	inline int btree<K, V, C, A, E, bM, bU, N>::DoLowerBoundInNode(const node_type* pNode, const U& u, Compare2 compare2) const
+	{
+		// Returns the index of the first value which is not less than u, or mnCount.
+		// The search is written so that the compiler can use a conditional move rather than
+		// a branch to narrow the range, as the result of each comparison is unpredictable.
+		extract_key extractKey;
+		node_type* const pMutableNode = const_cast<node_type*>(pNode);
+		int nCount = (int)pNode->mnCount;
+		int nBase  = 0;
+
+		if(nCount == 0)
+			return 0;
+
+		while(nCount > 1)
+		{
+			const int nHalf = nCount >> 1;
+			nBase   = compare2(extractKey(pMutableNode->value(nBase + nHalf - 1)), u) ? (nBase + nHalf) : nBase;
+			nCount -= nHalf;
+		}
+
+		return nBase + (compare2(extractKey(pMutableNode->value(nBase)), u) ? 1 : 0);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <typename U, typename Compare2>
+	inline int btree<K, V, C, A, E, bM, bU, N>::DoUpperBoundInNode(const node_type* pNode, const U& u, Compare2 compare2) const
+	{
+		// Returns the index of the first value which is greater than u, or mnCount.
+		extract_key extractKey;
+		node_type* const pMutableNode = const_cast<node_type*>(pNode);
+		int nCount = (int)pNode->mnCount;
+		int nBase  = 0;
+
+		if(nCount == 0)
+			return 0;
+
+		while(nCount > 1)
+		{
+			const int nHalf = nCount >> 1;
+			nBase   = compare2(u, extractKey(pMutableNode->value(nBase + nHalf - 1))) ? nBase : (nBase + nHalf);
+			nCount -= nHalf;
+		}
+
+		return nBase + (compare2(u, extractKey(pMutableNode->value(nBase))) ? 0 : 1);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoEnd() const
+	{
+		return iterator(mpRightmost, mpRightmost ? (int)mpRightmost->mnCount : 0);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoNextValue(iterator it) const
+	{
+		// Moves a position which is one past the last value of a leaf up to the value which
+		// follows it, if any. Positions within a leaf are returned as they are.
+		while((it.mnPosition == (int)it.mpNode->mnCount) && it.mpNode->mpParent)
+		{
+			it.mnPosition = it.mpNode->mnPosition;
+			it.mpNode     = it.mpNode->parent();
+		}
+
+		if(it.mnPosition == (int)it.mpNode->mnCount)
+			return DoEnd();
+
+		return it;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <typename U, typename Compare2>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoFind(const U& u, Compare2 compare2) const
+	{
+		extract_key extractKey;
+
+		if(bU)
+		{
+			// With unique keys we can stop as soon as we see the key, even in an internal node.
+			for(node_type* pNode = mpRoot; pNode; )
+			{
+				const int i = DoLowerBoundInNode(pNode, u, compare2);
+
+				if((i < (int)pNode->mnCount) && !compare2(u, extractKey(pNode->value(i))))
+					return iterator(pNode, i);
+
+				pNode = pNode->mbLeaf ? NULL : pNode->child(i);
+			}
+
+			return DoEnd();
+		}
+		else
+		{
+			// Otherwise we need the first of the values with the key, which may be in a leaf below.
+			const iterator it(DoLowerBound(u, compare2));
+
+			if((it != DoEnd()) && !compare2(u, extractKey(*it)))
+				return it;
+
+			return DoEnd();
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <typename U, typename Compare2>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoLowerBound(const U& u, Compare2 compare2) const
+	{
+		if(!mpRoot)
+			return DoEnd();
+
+		// If the lower bound is in an internal node, the search ends one past the last
+		// value of the leaf before it, and DoNextValue moves back up to it.
+		for(node_type* pNode = mpRoot; ; pNode = pNode->child(DoLowerBoundInNode(pNode, u, compare2)))
+		{
+			if(pNode->mbLeaf)
+				return DoNextValue(iterator(pNode, DoLowerBoundInNode(pNode, u, compare2)));
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <typename U, typename Compare2>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoUpperBound(const U& u, Compare2 compare2) const
+	{
+		if(!mpRoot)
+			return DoEnd();
+
+		for(node_type* pNode = mpRoot; ; pNode = pNode->child(DoUpperBoundInNode(pNode, u, compare2)))
+		{
+			if(pNode->mbLeaf)
+				return DoNextValue(iterator(pNode, DoUpperBoundInNode(pNode, u, compare2)));
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	eastl::pair<typename btree<K, V, C, A, E, bM, bU, N>::iterator, bool>
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertUniqueKey(const key_type& key, Args&&... args)
+	{
+		extract_key extractKey;
+		iterator    position; // The position for an empty tree.
+
+		for(node_type* pNode = mpRoot; pNode; )
+		{
+			const int i = DoLowerBoundInNode(pNode, key, mCompare);
+
+			if((i < (int)pNode->mnCount) && !mCompare(key, extractKey(pNode->value(i))))
+				return eastl::pair<iterator, bool>(iterator(pNode, i), false);
+
+			if(pNode->mbLeaf)
+			{
+				position = iterator(pNode, i);
+				break;
+			}
+
+			pNode = pNode->child(i);
+		}
+
+		return eastl::pair<iterator, bool>(DoEmplaceValueAt(position, eastl::forward<Args>(args)...), true);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertNonuniqueKey(const key_type& key, Args&&... args)
+	{
+		// Equal values are inserted after any existing ones, as with rbtree.
+		iterator position;
+
+		for(node_type* pNode = mpRoot; pNode; )
+		{
+			const int i = DoUpperBoundInNode(pNode, key, mCompare);
+
+			if(pNode->mbLeaf)
+			{
+				position = iterator(pNode, i);
+				break;
+			}
+
+			pNode = pNode->child(i);
+		}
+
+		return DoEmplaceValueAt(position, eastl::forward<Args>(args)...);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertUniqueKeyHint(const_iterator position, const key_type& key, Args&&... args)
+	{
+		// The hint is used if key belongs immediately before it.
+		extract_key    extractKey;
+		const iterator itNext(position.mpNode, position.mnPosition);
+
+		if((itNext == DoEnd()) || mCompare(key, extractKey(*itNext)))
+		{
+			if(itNext == iterator(mpLeftmost, 0))
+				return DoEmplaceValueAt(itNext, eastl::forward<Args>(args)...);
+
+			iterator itPrev(itNext);
+			--itPrev;
+
+			if(mCompare(extractKey(*itPrev), key))
+				return DoEmplaceValueAt(itNext, eastl::forward<Args>(args)...);
+		}
+
+		return DoInsertUniqueKey(key, eastl::forward<Args>(args)...).first;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertNonuniqueKeyHint(const_iterator position, const key_type& key, Args&&... args)
+	{
+		// The hint is used if key may go immediately before it.
+		extract_key    extractKey;
+		const iterator itNext(position.mpNode, position.mnPosition);
+
+		if((itNext == DoEnd()) || !mCompare(extractKey(*itNext), key))
+		{
+			if(itNext == iterator(mpLeftmost, 0))
+				return DoEmplaceValueAt(itNext, eastl::forward<Args>(args)...);
+
+			iterator itPrev(itNext);
+			--itPrev;
+
+			if(!mCompare(key, extractKey(*itPrev)))
+				return DoEmplaceValueAt(itNext, eastl::forward<Args>(args)...);
+		}
+
+		return DoInsertNonuniqueKey(key, eastl::forward<Args>(args)...);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline eastl::pair<typename btree<K, V, C, A, E, bM, bU, N>::iterator, bool>
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValue(true_type, Args&&... args) // true_type means keys are unique.
+	{
+		// We need the value in order to get its key, so we construct it up front and move it into place.
+		value_type value(eastl::forward<Args>(args)...);
+		return DoInsertUniqueKey(extract_key()(value), eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValue(false_type, Args&&... args) // false_type means keys are not unique.
+	{
+		value_type value(eastl::forward<Args>(args)...);
+		return DoInsertNonuniqueKey(extract_key()(value), eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline eastl::pair<typename btree<K, V, C, A, E, bM, bU, N>::iterator, bool>
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValue(true_type, value_type&& value)
+	{
+		return DoInsertUniqueKey(extract_key()(value), eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValue(false_type, value_type&& value)
+	{
+		return DoInsertNonuniqueKey(extract_key()(value), eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline eastl::pair<typename btree<K, V, C, A, E, bM, bU, N>::iterator, bool>
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValue(true_type, const value_type& value)
+	{
+		return DoInsertUniqueKey(extract_key()(value), value);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValue(false_type, const value_type& value)
+	{
+		return DoInsertNonuniqueKey(extract_key()(value), value);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValueHint(true_type, const_iterator position, Args&&... args)
+	{
+		value_type value(eastl::forward<Args>(args)...);
+		return DoInsertUniqueKeyHint(position, extract_key()(value), eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValueHint(false_type, const_iterator position, Args&&... args)
+	{
+		value_type value(eastl::forward<Args>(args)...);
+		return DoInsertNonuniqueKeyHint(position, extract_key()(value), eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValueHint(true_type, const_iterator position, value_type&& value)
+	{
+		return DoInsertUniqueKeyHint(position, extract_key()(value), eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValueHint(false_type, const_iterator position, value_type&& value)
+	{
+		return DoInsertNonuniqueKeyHint(position, extract_key()(value), eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValueHint(true_type, const_iterator position, const value_type& value)
+	{
+		return DoInsertUniqueKeyHint(position, extract_key()(value), value);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValueHint(false_type, const_iterator position, const value_type& value)
+	{
+		return DoInsertNonuniqueKeyHint(position, extract_key()(value), value);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline eastl::pair<typename btree<K, V, C, A, E, bM, bU, N>::iterator, bool>
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertKey(true_type, const key_type& key)
+	{
+		return DoInsertUniqueKey(key, key);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertKey(false_type, const key_type& key)
+	{
+		return DoInsertNonuniqueKey(key, key);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	template <class... Args>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoEmplaceValueAt(iterator position, Args&&... args)
+	{
+		// The value is constructed before any values are moved to make room for it, as
+		// args may refer to a value within the tree (e.g. multiset.insert(*it)).
+		value_type value(eastl::forward<Args>(args)...);
+		return DoInsertValueAt(position, eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoEmplaceValueAt(iterator position, value_type&& value)
+	{
+		return DoInsertValueAt(position, eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoInsertValueAt(iterator position, value_type&& value)
+	{
+		// Inserts value immediately before position.
+		if(!mpRoot)
+		{
+			mpRoot = mpLeftmost = mpRightmost = DoAllocateNode(true);
+			position = iterator(mpRoot, 0);
+		}
+		else if(!position.mpNode->mbLeaf)
+		{
+			// Values can only be inserted into leaves. Immediately before a value in an internal
+			// node is the same as immediately after its predecessor, which is in a leaf.
+			--position;
+			++position.mnPosition;
+		}
+
+		if((int)position.mpNode->mnCount == kNodeValueCount)
+			DoSplit(position);
+
+		node_type* const pNode = position.mpNode;
+
+		for(int i = (int)pNode->mnCount; i > position.mnPosition; --i)
+			DoMoveValue(pNode->value_ptr(i), pNode->value_ptr(i - 1));
+
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+		#endif
+				::new(pNode->value_ptr(position.mnPosition)) value_type(eastl::move(value));
+		#if EASTL_EXCEPTIONS_ENABLED
+			}
+			catch(...)
+			{
+				for(int i = position.mnPosition; i < (int)pNode->mnCount; ++i)
+					DoMoveValue(pNode->value_ptr(i), pNode->value_ptr(i + 1));
+
+				// A split or a new root can leave us with an empty leaf, which we get rid of the same way erase does.
+				if(pNode->mnCount == 0)
+					DoRebalanceAfterErase(position);
+				throw;
+			}
+		#endif
+
+		++pNode->mnCount;
+		++mnSize;
+
+		return position;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	void btree<K, V, C, A, E, bM, bU, N>::DoSplit(iterator& position)
+	{
+		// Splits the full node at position into two, moving the value between them up into the
+		// parent, and updates position to refer to the same place within one of the two nodes.
+		node_type* const pNode = position.mpNode;
+		EASTL_ASSERT((int)pNode->mnCount == kNodeValueCount);
+
+		if(!pNode->mpParent)
+		{
+			// We are splitting the root, so the tree grows by a level.
+			node_type* const pRoot = DoAllocateNode(false);
+			pRoot->set_child(0, pNode);
+			mpRoot = pRoot;
+		}
+		else if((int)pNode->mpParent->mnCount == kNodeValueCount)
+		{
+			// The parent needs room for the value we move up into it.
+			iterator parentPosition(pNode->parent(), pNode->mnPosition);
+			DoSplit(parentPosition);
+		}
+
+		// The split is biased by the insertion position. Inserting at the end of a node (as when
+		// inserting in increasing order) leaves it full and starts a new empty node after it,
+		// and likewise for inserting at the front. Otherwise the values are split evenly.
+		const int nInsert     = position.mnPosition;
+		const int nRightCount = (nInsert == 0) ? (kNodeValueCount - 1) : (nInsert == kNodeValueCount) ? 0 : (kNodeValueCount / 2);
+		const int nLeftCount  = kNodeValueCount - nRightCount - 1;
+
+		node_type* const pRight = DoAllocateNode(pNode->mbLeaf);
+
+		for(int i = 0; i < nRightCount; ++i)
+			DoMoveValue(pRight->value_ptr(i), pNode->value_ptr(nLeftCount + 1 + i));
+
+		if(!pNode->mbLeaf)
+		{
+			for(int i = 0; i <= nRightCount; ++i)
+				pRight->set_child(i, pNode->child(nLeftCount + 1 + i));
+		}
+
+		pRight->mnCount = (uint16_t)nRightCount;
+		pNode->mnCount  = (uint16_t)nLeftCount;
+
+		DoInsertSeparator(pNode->parent(), pNode->mnPosition, pNode->value_ptr(nLeftCount), pRight);
+
+		if(pNode == mpRightmost)
+			mpRightmost = pRight;
+
+		if(nInsert > nLeftCount)
+		{
+			position.mpNode     = pRight;
+			position.mnPosition = nInsert - nLeftCount - 1;
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	void btree<K, V, C, A, E, bM, bU, N>::DoInsertSeparator(node_type* pParent, int nPosition, value_type* pValue, node_type* pRight)
+	{
+		// Moves *pValue into pParent at nPosition, with pRight as the child after it. pParent must not be full.
+		for(int i = (int)pParent->mnCount; i > nPosition; --i)
+			DoMoveValue(pParent->value_ptr(i), pParent->value_ptr(i - 1));
+
+		DoMoveValue(pParent->value_ptr(nPosition), pValue);
+
+		for(int i = (int)pParent->mnCount + 1; i > nPosition + 1; --i)
+			pParent->set_child(i, pParent->child(i - 1));
+
+		pParent->set_child(nPosition + 1, pRight);
+		++pParent->mnCount;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	typename btree<K, V, C, A, E, bM, bU, N>::iterator
+	btree<K, V, C, A, E, bM, bU, N>::DoRebalanceAfterErase(iterator it)
+	{
+		// Merges or rebalances the underfull nodes from it's node upwards. Returns the position
+		// which it had before, which is the position of the value after the erased one.
+		iterator result(it);
+		bool     bFirst = true;
+
+		for(;;)
+		{
+			if(it.mpNode == mpRoot)
+			{
+				DoShrinkRoot();
+
+				if(!mpRoot)
+					return DoEnd();
+				break;
+			}
+
+			if((int)it.mpNode->mnCount >= kMinNodeValueCount)
+				break;
+
+			const bool bMerged = DoMergeOrRebalance(it);
+
+			if(bFirst)
+			{
+				result = it;
+				bFirst = false;
+			}
+
+			if(!bMerged)
+				break;
+
+			it.mnPosition = it.mpNode->mnPosition;
+			it.mpNode     = it.mpNode->parent();
+		}
+
+		// If we erased the last value of a leaf, the next value is up the tree.
+		if(result.mnPosition == (int)result.mpNode->mnCount)
+		{
+			result.mnPosition = (int)result.mpNode->mnCount - 1;
+			++result;
+		}
+
+		return result;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	bool btree<K, V, C, A, E, bM, bU, N>::DoMergeOrRebalance(iterator& it)
+	{
+		// Returns true if it's node was merged with a sibling, in which case the parent lost a
+		// value and may need the same treatment. it is updated to refer to the same value.
+		node_type* const pNode   = it.mpNode;
+		node_type* const pParent = pNode->parent();
+		const int        nPos    = (int)pNode->mnPosition;
+
+		if(nPos > 0)
+		{
+			node_type* const pLeft = pParent->child(nPos - 1);
+
+			if((1 + (int)pLeft->mnCount + (int)pNode->mnCount) <= kNodeValueCount)
+			{
+				it.mnPosition += 1 + (int)pLeft->mnCount;
+				it.mpNode      = pLeft;
+				DoMergeNodes(pLeft, pNode);
+				return true;
+			}
+		}
+
+		if(nPos < (int)pParent->mnCount)
+		{
+			node_type* const pRight = pParent->child(nPos + 1);
+
+			if((1 + (int)pNode->mnCount + (int)pRight->mnCount) <= kNodeValueCount)
+			{
+				DoMergeNodes(pNode, pRight);
+				return true;
+			}
+
+			// We don't take values from the right if we erased the first value of the node,
+			// which is the pattern of erasing from the front of the tree; the following
+			// erases would just take the values away again.
+			if(((int)pRight->mnCount > kMinNodeValueCount) && ((pNode->mnCount == 0) || (it.mnPosition > 0)))
+			{
+				const int nMove = eastl::min_alt(((int)pRight->mnCount - (int)pNode->mnCount) / 2, (int)pRight->mnCount - 1);
+				DoRotateLeft(pNode, pRight, nMove);
+				return false;
+			}
+		}
+
+		if(nPos > 0)
+		{
+			// Likewise, we don't take values from the left if we erased the last value of the node.
+			node_type* const pLeft = pParent->child(nPos - 1);
+
+			if(((int)pLeft->mnCount > kMinNodeValueCount) && ((pNode->mnCount == 0) || (it.mnPosition < (int)pNode->mnCount)))
+			{
+				const int nMove = eastl::min_alt(((int)pLeft->mnCount - (int)pNode->mnCount) / 2, (int)pLeft->mnCount - 1);
+				DoRotateRight(pLeft, pNode, nMove);
+				it.mnPosition += nMove;
+				return false;
+			}
+		}
+
+		return false;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	void btree<K, V, C, A, E, bM, bU, N>::DoMergeNodes(node_type* pLeft, node_type* pRight)
+	{
+		// Appends the separator between the two siblings and all of pRight's values (and children)
+		// to pLeft, then removes the separator and pRight from the parent and frees pRight.
+		node_type* const pParent   = pLeft->parent();
+		const int        nPos      = (int)pLeft->mnPosition;
+		const int        nLeftCount = (int)pLeft->mnCount;
+
+		DoMoveValue(pLeft->value_ptr(nLeftCount), pParent->value_ptr(nPos));
+
+		for(int i = 0; i < (int)pRight->mnCount; ++i)
+			DoMoveValue(pLeft->value_ptr(nLeftCount + 1 + i), pRight->value_ptr(i));
+
+		if(!pLeft->mbLeaf)
+		{
+			for(int i = 0; i <= (int)pRight->mnCount; ++i)
+				pLeft->set_child(nLeftCount + 1 + i, pRight->child(i));
+		}
+
+		pLeft->mnCount = (uint16_t)(nLeftCount + 1 + (int)pRight->mnCount);
+
+		for(int i = nPos + 1; i < (int)pParent->mnCount; ++i)
+			DoMoveValue(pParent->value_ptr(i - 1), pParent->value_ptr(i));
+
+		for(int i = nPos + 2; i <= (int)pParent->mnCount; ++i)
+			pParent->set_child(i - 1, pParent->child(i));
+
+		--pParent->mnCount;
+
+		if(pRight == mpRightmost)
+			mpRightmost = pLeft;
+
+		DoFreeNode(pRight);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	void btree<K, V, C, A, E, bM, bU, N>::DoRotateLeft(node_type* pLeft, node_type* pRight, int nCount)
+	{
+		// Moves nCount values from pRight to its left sibling pLeft, through the separator in the parent.
+		node_type* const pParent     = pLeft->parent();
+		const int        nPos        = (int)pLeft->mnPosition;
+		const int        nLeftCount  = (int)pLeft->mnCount;
+		const int        nRightCount = (int)pRight->mnCount;
+
+		DoMoveValue(pLeft->value_ptr(nLeftCount), pParent->value_ptr(nPos));
+
+		for(int i = 0; i < nCount - 1; ++i)
+			DoMoveValue(pLeft->value_ptr(nLeftCount + 1 + i), pRight->value_ptr(i));
+
+		DoMoveValue(pParent->value_ptr(nPos), pRight->value_ptr(nCount - 1));
+
+		for(int i = nCount; i < nRightCount; ++i)
+			DoMoveValue(pRight->value_ptr(i - nCount), pRight->value_ptr(i));
+
+		if(!pLeft->mbLeaf)
+		{
+			for(int i = 0; i < nCount; ++i)
+				pLeft->set_child(nLeftCount + 1 + i, pRight->child(i));
+
+			for(int i = nCount; i <= nRightCount; ++i)
+				pRight->set_child(i - nCount, pRight->child(i));
+		}
+
+		pLeft->mnCount  = (uint16_t)(nLeftCount + nCount);
+		pRight->mnCount = (uint16_t)(nRightCount - nCount);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	void btree<K, V, C, A, E, bM, bU, N>::DoRotateRight(node_type* pLeft, node_type* pRight, int nCount)
+	{
+		// Moves nCount values from pLeft to its right sibling pRight, through the separator in the parent.
+		node_type* const pParent     = pLeft->parent();
+		const int        nPos        = (int)pLeft->mnPosition;
+		const int        nLeftCount  = (int)pLeft->mnCount;
+		const int        nRightCount = (int)pRight->mnCount;
+
+		for(int i = nRightCount - 1; i >= 0; --i)
+			DoMoveValue(pRight->value_ptr(i + nCount), pRight->value_ptr(i));
+
+		DoMoveValue(pRight->value_ptr(nCount - 1), pParent->value_ptr(nPos));
+
+		for(int i = 0; i < nCount - 1; ++i)
+			DoMoveValue(pRight->value_ptr(i), pLeft->value_ptr(nLeftCount - nCount + 1 + i));
+
+		DoMoveValue(pParent->value_ptr(nPos), pLeft->value_ptr(nLeftCount - nCount));
+
+		if(!pLeft->mbLeaf)
+		{
+			for(int i = nRightCount; i >= 0; --i)
+				pRight->set_child(i + nCount, pRight->child(i));
+
+			for(int i = 0; i < nCount; ++i)
+				pRight->set_child(i, pLeft->child(nLeftCount - nCount + 1 + i));
+		}
+
+		pLeft->mnCount  = (uint16_t)(nLeftCount - nCount);
+		pRight->mnCount = (uint16_t)(nRightCount + nCount);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	void btree<K, V, C, A, E, bM, bU, N>::DoShrinkRoot()
+	{
+		// An empty root leaf means the tree is empty, while an empty internal root
+		// (left behind by merging its last two children) is replaced by its only child.
+		if(mpRoot->mnCount == 0)
+		{
+			node_type* const pOldRoot = mpRoot;
+
+			if(pOldRoot->mbLeaf)
+				mpRoot = mpLeftmost = mpRightmost = NULL;
+			else
+			{
+				mpRoot = pOldRoot->child(0);
+				mpRoot->mpParent   = NULL;
+				mpRoot->mnPosition = 0;
+			}
+
+			DoFreeNode(pOldRoot);
+		}
+	}
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline bool operator==(const btree<K, V, C, A, E, bM, bU, N>& a, const btree<K, V, C, A, E, bM, bU, N>& b)
+	{
+		return (a.size() == b.size()) && eastl::equal(a.begin(), a.end(), b.begin());
+	}
+
+
+	// As with rbtree, operator< compares with the value_type's operator< rather than with the tree's Compare.
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline bool operator<(const btree<K, V, C, A, E, bM, bU, N>& a, const btree<K, V, C, A, E, bM, bU, N>& b)
+	{
+		return eastl::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline bool operator!=(const btree<K, V, C, A, E, bM, bU, N>& a, const btree<K, V, C, A, E, bM, bU, N>& b)
+	{
+		return !(a == b);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline bool operator>(const btree<K, V, C, A, E, bM, bU, N>& a, const btree<K, V, C, A, E, bM, bU, N>& b)
+	{
+		return b < a;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline bool operator<=(const btree<K, V, C, A, E, bM, bU, N>& a, const btree<K, V, C, A, E, bM, bU, N>& b)
+	{
+		return !(b < a);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline bool operator>=(const btree<K, V, C, A, E, bM, bU, N>& a, const btree<K, V, C, A, E, bM, bU, N>& b)
+	{
+		return !(a < b);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU, size_t N>
+	inline void swap(btree<K, V, C, A, E, bM, bU, N>& a, btree<K, V, C, A, E, bM, bU, N>& b)
+	{
+		a.swap(b);
+	}
+
+
+} // namespace eastl
+
+
+#ifdef _MSC_VER
+	#pragma warning(pop)
+#endif
+
+
+#endif // Header include guard
@@ -0,0 +1,926 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements the character search kernels which basic_string and
+// basic_string_view use for find, rfind, the find_*_of family and compare.
+//
+// The kernels examine 16 (SSE2) or 32 (AVX2) bytes of characters per step.
+// They are written against a small set of vector primitives (CharSimd: Load,
+// Splat and Equal, the last of which returns a bit mask with kMaskBitsPerChar
+// bits per character), so supporting another instruction set such as NEON
+// only requires another implementation of those primitives. Without a vector
+// implementation the kernels use scalar loops, as they do for short strings.
+//
+// Searches for sets of up to four characters (find_first_of and friends) use
+// one vector compare per set character. Larger sets are looked up in a 256 bit
+// bitmap built from the set, which makes these searches O(n + m) instead of
+// O(n * m). Substring search filters candidate positions by comparing the
+// first and last pattern characters a vector at a time, and switches to the
+// Two-Way algorithm (Crochemore and Perrin, 1991) if verifying candidates
+// does too much work, which bounds the worst case to linear time.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_CHAR_SEARCH_H
+#define EASTL_INTERNAL_CHAR_SEARCH_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/bit.h>
+#include <EASTL/iterator.h>
+#include <EASTL/type_traits.h>
+
+EA_DISABLE_ALL_VC_WARNINGS()
+#include <string.h> // memcmp
+EA_RESTORE_ALL_VC_WARNINGS()
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+/// EASTL_CHAR_SEARCH_SSE2
+///
+/// Defined as 0 or 1. If 1 then the string search kernels compare 16 bytes
+/// of characters at a time with SSE2 instructions.
+///
+#ifndef EASTL_CHAR_SEARCH_SSE2
+	#if defined(EA_SSE2) && EA_SSE2
+		#define EASTL_CHAR_SEARCH_SSE2 1
+	#else
+		#define EASTL_CHAR_SEARCH_SSE2 0
+	#endif
+#endif
+
+/// EASTL_CHAR_SEARCH_AVX2
+///
+/// Defined as 0 or 1. If 1 then the string search kernels compare 32 bytes
+/// of characters at a time with AVX2 instructions. This is enabled by default
+/// only when the compiler targets AVX2 (e.g. -mavx2 or /arch:AVX2), as there
+/// is no run time dispatch.
+///
+#ifndef EASTL_CHAR_SEARCH_AVX2
+	#if defined(EA_AVX2) && EA_AVX2 && EASTL_CHAR_SEARCH_SSE2
+		#define EASTL_CHAR_SEARCH_AVX2 1
+	#else
+		#define EASTL_CHAR_SEARCH_AVX2 0
+	#endif
+#endif
+
+#if EASTL_CHAR_SEARCH_AVX2
+	#define EASTL_CHAR_SEARCH_SIMD 1
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <immintrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#elif EASTL_CHAR_SEARCH_SSE2
+	#define EASTL_CHAR_SEARCH_SIMD 1
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <emmintrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#else
+	#define EASTL_CHAR_SEARCH_SIMD 0
+#endif
+
+
+
+namespace eastl
+{
+	namespace Internal
+	{
+		/// is_simd_char
+		///
+		/// True for the character types which the vector kernels can search.
+		///
+		template <typename T>
+		struct is_simd_char : public integral_constant<bool, (EASTL_CHAR_SEARCH_SIMD != 0) && is_integral<T>::value &&
+		                                                     ((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4))> {};
+
+
+		/// is_byte_char
+		///
+		/// True for the character types which can be searched with memchr.
+		///
+		template <typename T>
+		struct is_byte_char : public integral_constant<bool, is_integral<T>::value && (sizeof(T) == 1)> {};
+
+
+		#if EASTL_CHAR_SEARCH_SIMD
+			// CharSimdOps
+			//
+			// The instruction set specific primitives. Equal returns a mask with
+			// one bit for each byte of the vector; bits are set for the bytes of
+			// the characters which compare equal.
+			//
+			template <size_t CharSize>
+			struct CharSimdOps;
+
+			#if EASTL_CHAR_SEARCH_AVX2
+				#define EASTL_CHAR_SIMD_OPS(size, bits)                                                                             \
+					template <> struct CharSimdOps<size>                                                                        \
+					{                                                                                                           \
+						typedef __m256i vector_type;                                                                            \
+						static const size_t kBytes = 32;                                                                        \
+						static vector_type Load(const void* p)               { return _mm256_loadu_si256((const __m256i*)p); }  \
+						static vector_type Splat(uint32_t c)                 { return _mm256_set1_epi##bits((int##bits##_t)c); } \
+						static uint32_t    Equal(vector_type a, vector_type b) { return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi##bits(a, b)); } \
+					};
+			#else
+				#define EASTL_CHAR_SIMD_OPS(size, bits)                                                                             \
+					template <> struct CharSimdOps<size>                                                                        \
+					{                                                                                                           \
+						typedef __m128i vector_type;                                                                            \
+						static const size_t kBytes = 16;                                                                        \
+						static vector_type Load(const void* p)               { return _mm_loadu_si128((const __m128i*)p); }     \
+						static vector_type Splat(uint32_t c)                 { return _mm_set1_epi##bits((int##bits##_t)c); }    \
+						static uint32_t    Equal(vector_type a, vector_type b) { return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi##bits(a, b)); } \
+					};
+			#endif
+
+			EASTL_CHAR_SIMD_OPS(1, 8)
+			EASTL_CHAR_SIMD_OPS(2, 16)
+			EASTL_CHAR_SIMD_OPS(4, 32)
+
+			#undef EASTL_CHAR_SIMD_OPS
+
+
+			// CharSimd
+			//
+			// Adds the character geometry and mask helpers to CharSimdOps.
+			//
+			template <size_t CharSize>
+			struct CharSimd : public CharSimdOps<CharSize>
+			{
+				typedef CharSimdOps<CharSize> base_type;
+
+				static const size_t   kChars           = base_type::kBytes / CharSize;
+				static const size_t   kMaskBitsPerChar = CharSize;
+				static const uint32_t kMaskAll         = (uint32_t)(((uint64_t)1 << base_type::kBytes) - 1);
+
+				// Returns the index of the first or last character flagged in a non-zero mask.
+				static size_t FirstIndex(uint32_t mask) { return (size_t)countr_zero32_nonzero(mask) / kMaskBitsPerChar; }
+				static size_t LastIndex(uint32_t mask)  { return (size_t)(31 - countl_zero32_nonzero(mask)) / kMaskBitsPerChar; }
+
+				// Returns the mask bits of the first n characters of a vector.
+				static uint32_t HeadMask(size_t n) { return (uint32_t)(((uint64_t)1 << (n * kMaskBitsPerChar)) - 1); }
+			};
+		#endif
+
+
+		template <typename T>
+		inline bool CharEqual(const T* p1, const T* p2, size_t n)
+		{
+			return memcmp(p1, p2, n * sizeof(T)) == 0;
+		}
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Small character sets
+		//
+		// CharScanSet and CharScanSetLast return the first and last character
+		// of [p, pEnd) which is (or, if bNot, is not) one of the N characters
+		// at pSet, or pEnd if there is no such character.
+		///////////////////////////////////////////////////////////////////////
+
+		template <size_t N, typename T>
+		EA_FORCE_INLINE bool CharSetContains(const T* pSet, T c)
+		{
+			for(size_t i = 0; i < N; ++i)
+			{
+				if(pSet[i] == c)
+					return true;
+			}
+			return false;
+		}
+
+		template <bool bNot, size_t N, typename T>
+		inline const T* CharScanSet(const T* p, const T* pEnd, const T* pSet, false_type)
+		{
+			for(; p != pEnd; ++p)
+			{
+				if(CharSetContains<N>(pSet, *p) != bNot)
+					return p;
+			}
+			return pEnd;
+		}
+
+		template <bool bNot, size_t N, typename T>
+		inline const T* CharScanSetLast(const T* p, const T* pEnd, const T* pSet, false_type)
+		{
+			for(const T* pCurrent = pEnd; pCurrent != p; )
+			{
+				if(CharSetContains<N>(pSet, *--pCurrent) != bNot)
+					return pCurrent;
+			}
+			return pEnd;
+		}
+
+		#if EASTL_CHAR_SEARCH_SIMD
+			template <bool bNot, size_t N, typename Simd>
+			EA_FORCE_INLINE uint32_t CharSetMask(typename Simd::vector_type v, const typename Simd::vector_type* pSet)
+			{
+				uint32_t mask = Simd::Equal(v, pSet[0]);
+				for(size_t i = 1; i < N; ++i)
+					mask |= Simd::Equal(v, pSet[i]);
+				return bNot ? (mask ^ Simd::kMaskAll) : mask;
+			}
+
+			template <bool bNot, size_t N, typename T>
+			inline const T* CharScanSet(const T* p, const T* pEnd, const T* pSet, true_type)
+			{
+				typedef CharSimd<sizeof(T)> Simd;
+
+				if((size_t)(pEnd - p) < Simd::kChars)
+					return CharScanSet<bNot, N>(p, pEnd, pSet, false_type());
+
+				typename Simd::vector_type vSet[N];
+				for(size_t i = 0; i < N; ++i)
+					vSet[i] = Simd::Splat((uint32_t)pSet[i]);
+
+				// Examine four vectors per iteration while there is room, so that the
+				// loop isn't bound by a branch on every vector's mask.
+				for(; (size_t)(pEnd - p) >= (Simd::kChars * 4); p += (Simd::kChars * 4))
+				{
+					const uint32_t mask0 = CharSetMask<bNot, N, Simd>(Simd::Load(p), vSet);
+					const uint32_t mask1 = CharSetMask<bNot, N, Simd>(Simd::Load(p + Simd::kChars), vSet);
+					const uint32_t mask2 = CharSetMask<bNot, N, Simd>(Simd::Load(p + Simd::kChars * 2), vSet);
+					const uint32_t mask3 = CharSetMask<bNot, N, Simd>(Simd::Load(p + Simd::kChars * 3), vSet);
+
+					if(mask0 | mask1 | mask2 | mask3)
+					{
+						if(mask0)
+							return p + Simd::FirstIndex(mask0);
+						if(mask1)
+							return p + Simd::kChars + Simd::FirstIndex(mask1);
+						if(mask2)
+							return p + Simd::kChars * 2 + Simd::FirstIndex(mask2);
+						return p + Simd::kChars * 3 + Simd::FirstIndex(mask3);
+					}
+				}
+
+				for(; (size_t)(pEnd - p) >= Simd::kChars; p += Simd::kChars)
+				{
+					const uint32_t mask = CharSetMask<bNot, N, Simd>(Simd::Load(p), vSet);
+					if(mask)
+						return p + Simd::FirstIndex(mask);
+				}
+
+				if(p != pEnd) // Examine the remaining characters with a final vector which overlaps the previous one.
+				{
+					const T* const pLast = pEnd - Simd::kChars;
+					const uint32_t mask  = CharSetMask<bNot, N, Simd>(Simd::Load(pLast), vSet) & ~Simd::HeadMask((size_t)(p - pLast));
+					if(mask)
+						return pLast + Simd::FirstIndex(mask);
+				}
+
+				return pEnd;
+			}
+
+			template <bool bNot, size_t N, typename T>
+			inline const T* CharScanSetLast(const T* p, const T* pEnd, const T* pSet, true_type)
+			{
+				typedef CharSimd<sizeof(T)> Simd;
+
+				if((size_t)(pEnd - p) < Simd::kChars)
+					return CharScanSetLast<bNot, N>(p, pEnd, pSet, false_type());
+
+				typename Simd::vector_type vSet[N];
+				for(size_t i = 0; i < N; ++i)
+					vSet[i] = Simd::Splat((uint32_t)pSet[i]);
+
+				const T* pCurrent = pEnd;
+
+				for(; (size_t)(pCurrent - p) >= (Simd::kChars * 4); )
+				{
+					pCurrent -= (Simd::kChars * 4);
+					const uint32_t mask0 = CharSetMask<bNot, N, Simd>(Simd::Load(pCurrent), vSet);
+					const uint32_t mask1 = CharSetMask<bNot, N, Simd>(Simd::Load(pCurrent + Simd::kChars), vSet);
+					const uint32_t mask2 = CharSetMask<bNot, N, Simd>(Simd::Load(pCurrent + Simd::kChars * 2), vSet);
+					const uint32_t mask3 = CharSetMask<bNot, N, Simd>(Simd::Load(pCurrent + Simd::kChars * 3), vSet);
+
+					if(mask0 | mask1 | mask2 | mask3)
+					{
+						if(mask3)
+							return pCurrent + Simd::kChars * 3 + Simd::LastIndex(mask3);
+						if(mask2)
+							return pCurrent + Simd::kChars * 2 + Simd::LastIndex(mask2);
+						if(mask1)
+							return pCurrent + Simd::kChars + Simd::LastIndex(mask1);
+						return pCurrent + Simd::LastIndex(mask0);
+					}
+				}
+
+				for(; (size_t)(pCurrent - p) >= Simd::kChars; )
+				{
+					pCurrent -= Simd::kChars;
+					const uint32_t mask = CharSetMask<bNot, N, Simd>(Simd::Load(pCurrent), vSet);
+					if(mask)
+						return pCurrent + Simd::LastIndex(mask);
+				}
+
+				if(pCurrent != p)
+				{
+					const uint32_t mask = CharSetMask<bNot, N, Simd>(Simd::Load(p), vSet) & Simd::HeadMask((size_t)(pCurrent - p));
+					if(mask)
+						return p + Simd::LastIndex(mask);
+				}
+
+				return pEnd;
+			}
+		#endif
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Large character sets
+		///////////////////////////////////////////////////////////////////////
+
+		/// CharBitmap
+		///
+		/// A 256 bit membership bitmap of the low eight bits of the characters
+		/// of a set. For char sets the bitmap is exact. For wider characters a
+		/// bitmap hit is exact only if the set has no characters above 255;
+		/// otherwise hits are verified against the set.
+		///
+		template <typename T>
+		struct CharBitmap
+		{
+			typedef typename make_unsigned<T>::type unsigned_type;
+
+			uint64_t mBits[4];
+			const T* mpSetBegin;
+			const T* mpSetEnd;
+			bool     mbWide; // True if the set has a character above 255.
+
+			CharBitmap(const T* pSetBegin, const T* pSetEnd)
+				: mpSetBegin(pSetBegin), mpSetEnd(pSetEnd), mbWide(false)
+			{
+				mBits[0] = mBits[1] = mBits[2] = mBits[3] = 0;
+
+				for(; pSetBegin != pSetEnd; ++pSetBegin)
+				{
+					const unsigned_type u = (unsigned_type)*pSetBegin;
+					mBits[(u >> 6) & 3] |= (uint64_t)1 << (u & 63);
+					if(u > 255)
+						mbWide = true;
+				}
+			}
+
+			bool Contains(T c) const
+			{
+				const unsigned_type u = (unsigned_type)c;
+
+				if(((mBits[(u >> 6) & 3] >> (u & 63)) & 1) == 0)
+					return false;
+				if(!mbWide)
+					return (u <= 255);
+
+				for(const T* p = mpSetBegin; p != mpSetEnd; ++p)
+				{
+					if(*p == c)
+						return true;
+				}
+				return false;
+			}
+		};
+
+		// Searches which end within this many characters are done without
+		// building a CharBitmap, as building it would cost more than it saves.
+		static const ptrdiff_t kCharBitmapThreshold = 8;
+
+		template <typename T>
+		inline bool CharSetContains(const T* pSet, const T* pSetEnd, T c)
+		{
+			for(; pSet != pSetEnd; ++pSet)
+			{
+				if(*pSet == c)
+					return true;
+			}
+			return false;
+		}
+
+		template <bool bNot, typename T>
+		inline const T* CharScanBitmap(const T* p, const T* pEnd, const T* pSet, const T* pSetEnd)
+		{
+			const T* const pEndDirect = ((pEnd - p) > kCharBitmapThreshold) ? (p + kCharBitmapThreshold) : pEnd;
+
+			for(const T* pCurrent = p; pCurrent != pEndDirect; ++pCurrent)
+			{
+				if(CharSetContains(pSet, pSetEnd, *pCurrent) != bNot)
+					return pCurrent;
+			}
+
+			const CharBitmap<T> bitmap(pSet, pSetEnd);
+
+			for(p = pEndDirect; p != pEnd; ++p)
+			{
+				if(bitmap.Contains(*p) != bNot)
+					return p;
+			}
+			return pEnd;
+		}
+
+		template <bool bNot, typename T>
+		inline const T* CharScanBitmapLast(const T* p, const T* pEnd, const T* pSet, const T* pSetEnd)
+		{
+			const T* const pBeginDirect = ((pEnd - p) > kCharBitmapThreshold) ? (pEnd - kCharBitmapThreshold) : p;
+
+			for(const T* pCurrent = pEnd; pCurrent != pBeginDirect; )
+			{
+				if(CharSetContains(pSet, pSetEnd, *--pCurrent) != bNot)
+					return pCurrent;
+			}
+
+			const CharBitmap<T> bitmap(pSet, pSetEnd);
+
+			for(const T* pCurrent = pBeginDirect; pCurrent != p; )
+			{
+				if(bitmap.Contains(*--pCurrent) != bNot)
+					return pCurrent;
+			}
+			return pEnd;
+		}
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Character and character set search
+		///////////////////////////////////////////////////////////////////////
+
+		/// CharFind
+		///
+		/// Returns the first occurrence of c in [p, pEnd), or pEnd.
+		///
+		template <typename T>
+		inline const T* CharFind(const T* p, const T* pEnd, T c)
+		{
+			// The C library's memchr is usually vectorized with run time selection of
+			// the instruction set, so it outperforms a kernel which is limited to the
+			// instruction set targeted at compile time.
+			if(is_byte_char<T>::value)
+			{
+				const void* const pResult = (p != pEnd) ? memchr(p, (uint8_t)c, (size_t)(pEnd - p)) : NULL;
+				return pResult ? (const T*)pResult : pEnd;
+			}
+
+			return CharScanSet<false, 1>(p, pEnd, &c, is_simd_char<T>());
+		}
+
+		/// CharFindLast
+		///
+		/// Returns the last occurrence of c in [p, pEnd), or pEnd.
+		///
+		template <typename T>
+		inline const T* CharFindLast(const T* p, const T* pEnd, T c)
+		{
+			return CharScanSetLast<false, 1>(p, pEnd, &c, is_simd_char<T>());
+		}
+
+		/// CharFindFirstOf
+		///
+		/// Returns the first character in [p, pEnd) which is (or, if bNot, is
+		/// not) in the set [pSet, pSetEnd), or pEnd.
+		///
+		template <bool bNot, typename T>
+		inline const T* CharFindFirstOf(const T* p, const T* pEnd, const T* pSet, const T* pSetEnd)
+		{
+			typedef typename is_simd_char<T>::type simd_type;
+
+			switch(pSetEnd - pSet)
+			{
+				case 0:  return bNot ? p : pEnd;
+				case 1:  return CharScanSet<bNot, 1>(p, pEnd, pSet, simd_type());
+				case 2:  return CharScanSet<bNot, 2>(p, pEnd, pSet, simd_type());
+				case 3:  return CharScanSet<bNot, 3>(p, pEnd, pSet, simd_type());
+				case 4:  return CharScanSet<bNot, 4>(p, pEnd, pSet, simd_type());
+				default: return CharScanBitmap<bNot>(p, pEnd, pSet, pSetEnd);
+			}
+		}
+
+		/// CharFindLastOf
+		///
+		/// Returns the last character in [p, pEnd) which is (or, if bNot, is
+		/// not) in the set [pSet, pSetEnd), or pEnd.
+		///
+		template <bool bNot, typename T>
+		inline const T* CharFindLastOf(const T* p, const T* pEnd, const T* pSet, const T* pSetEnd)
+		{
+			typedef typename is_simd_char<T>::type simd_type;
+
+			switch(pSetEnd - pSet)
+			{
+				case 0:  return (bNot && (p != pEnd)) ? (pEnd - 1) : pEnd;
+				case 1:  return CharScanSetLast<bNot, 1>(p, pEnd, pSet, simd_type());
+				case 2:  return CharScanSetLast<bNot, 2>(p, pEnd, pSet, simd_type());
+				case 3:  return CharScanSetLast<bNot, 3>(p, pEnd, pSet, simd_type());
+				case 4:  return CharScanSetLast<bNot, 4>(p, pEnd, pSet, simd_type());
+				default: return CharScanBitmapLast<bNot>(p, pEnd, pSet, pSetEnd);
+			}
+		}
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Substring search
+		///////////////////////////////////////////////////////////////////////
+
+		// Candidate verification may examine this many characters plus four
+		// per character of text passed before substring search switches to
+		// the Two-Way algorithm.
+		static const size_t kCharSearchWorkSlack = 1024;
+
+		// TwoWayMaximalSuffix
+		//
+		// Computes the start (minus one) and period of the maximal suffix of
+		// the pattern under the character order, or the reverse of that order.
+		//
+		template <typename Iterator>
+		void TwoWayMaximalSuffix(Iterator pPattern, ptrdiff_t m, bool bReverseOrder, ptrdiff_t& suffix, ptrdiff_t& period)
+		{
+			ptrdiff_t i = -1, j = 0, k = 1, p = 1;
+
+			while((j + k) < m)
+			{
+				const typename iterator_traits<Iterator>::value_type a = pPattern[i + k];
+				const typename iterator_traits<Iterator>::value_type b = pPattern[j + k];
+
+				if(a == b)
+				{
+					if(k == p)
+					{
+						j += p;
+						k = 1;
+					}
+					else
+						++k;
+				}
+				else if(bReverseOrder ? (a < b) : (b < a))
+				{
+					j += k;
+					k = 1;
+					p = j - i;
+				}
+				else
+				{
+					i = j++;
+					k = p = 1;
+				}
+			}
+
+			suffix = i;
+			period = p;
+		}
+
+		/// TwoWaySearch
+		///
+		/// Returns the first occurrence of the m (>= 1) character pattern at
+		/// pPattern in [pText, pTextEnd), or pTextEnd. Runs in O(n + m) time
+		/// and constant space. Iterator is a random access iterator, which
+		/// lets reverse searches run this over reverse_iterators.
+		///
+		template <typename Iterator>
+		Iterator TwoWaySearch(Iterator pText, Iterator pTextEnd, Iterator pPattern, ptrdiff_t m)
+		{
+			// Find a critical factorization of the pattern, which is the longer
+			// of the maximal suffixes under the two character orders.
+			ptrdiff_t suffix, period, suffixReverse, periodReverse;
+
+			TwoWayMaximalSuffix(pPattern, m, false, suffix, period);
+			TwoWayMaximalSuffix(pPattern, m, true, suffixReverse, periodReverse);
+
+			if(suffixReverse > suffix)
+			{
+				suffix = suffixReverse;
+				period = periodReverse;
+			}
+
+			// If the prefix before the factorization recurs one period later then
+			// the pattern is periodic, and after a full match of the right side we
+			// can shift by the period and remember how much of the pattern matched.
+			ptrdiff_t memoryReset;
+
+			ptrdiff_t i = 0;
+
+			if((period + suffix + 1) <= m)
+			{
+				while((i <= suffix) && (pPattern[i] == pPattern[i + period]))
+					++i;
+			}
+
+			if(i > suffix)
+				memoryReset = m - period;
+			else
+			{
+				memoryReset = 0;
+				period = ((suffix > (m - suffix - 1)) ? suffix : (m - suffix - 1)) + 1;
+			}
+
+			ptrdiff_t memory = 0;
+
+			while((pTextEnd - pText) >= m)
+			{
+				// Match the right side of the factorization, left to right.
+				ptrdiff_t k = ((suffix + 1) > memory) ? (suffix + 1) : memory;
+				while((k < m) && (pPattern[k] == pText[k]))
+					++k;
+
+				if(k < m)
+				{
+					pText += (k - suffix);
+					memory = 0;
+					continue;
+				}
+
+				// Match the left side of the factorization, right to left.
+				k = suffix + 1;
+				while((k > memory) && (pPattern[k - 1] == pText[k - 1]))
+					--k;
+
+				if(k <= memory)
+					return pText;
+
+				pText += period;
+				memory = memoryReset;
+			}
+
+			return pTextEnd;
+		}
+
+		// CharSearchLastTwoWay
+		//
+		// Returns the last occurrence of the m character pattern at pPattern
+		// in [pText, pTextEnd), or NULL. Runs TwoWaySearch over the reversed
+		// text and pattern.
+		//
+		template <typename T>
+		const T* CharSearchLastTwoWay(const T* pText, const T* pTextEnd, const T* pPattern, size_t m)
+		{
+			typedef eastl::reverse_iterator<const T*> reverse_iterator_type;
+
+			const reverse_iterator_type rEnd(pText);
+			const reverse_iterator_type rResult = TwoWaySearch(reverse_iterator_type(pTextEnd), rEnd, reverse_iterator_type(pPattern + m), (ptrdiff_t)m);
+
+			return (rResult == rEnd) ? NULL : (rResult.base() - m);
+		}
+
+		// CharSearchImpl / CharSearchLastImpl
+		//
+		// m >= 2 and the text is at least m characters long.
+		//
+		template <typename T>
+		const T* CharSearchImpl(const T* pText, const T* pTextEnd, const T* pPattern, size_t m, false_type)
+		{
+			const T* const pCandidateEnd = pTextEnd - m + 1; // One past the last position at which the pattern could start.
+			const T        cLast         = pPattern[m - 1];
+			size_t         nWork         = 0;
+
+			for(const T* p = pText; ; ++p)
+			{
+				p = CharFind(p, pCandidateEnd, pPattern[0]);
+				if(p == pCandidateEnd)
+					return pTextEnd;
+				if((p[m - 1] == cLast) && CharEqual(p + 1, pPattern + 1, m - 2))
+					return p;
+
+				nWork += m;
+				if(EASTL_UNLIKELY(nWork > (((size_t)(p - pText) * 4) + kCharSearchWorkSlack)))
+					return TwoWaySearch(p + 1, pTextEnd, pPattern, (ptrdiff_t)m);
+			}
+		}
+
+		template <typename T>
+		const T* CharSearchLastImpl(const T* pText, const T* pTextEnd, const T* pPattern, size_t m, false_type)
+		{
+			const T* const pCandidateEnd = pTextEnd - m + 1;
+			const T        cFirst        = pPattern[0];
+			size_t         nWork         = 0;
+
+			for(const T* p = pCandidateEnd; p != pText; )
+			{
+				if((*--p == cFirst) && (p[m - 1] == pPattern[m - 1]) && CharEqual(p + 1, pPattern + 1, m - 2))
+					return p;
+
+				nWork += m;
+				if(EASTL_UNLIKELY(nWork > (((size_t)(pCandidateEnd - p) * 4) + kCharSearchWorkSlack)))
+				{
+					const T* const pResult = CharSearchLastTwoWay(pText, p + m - 1, pPattern, m);
+					return pResult ? pResult : pTextEnd;
+				}
+			}
+
+			return pTextEnd;
+		}
+
+		#if EASTL_CHAR_SEARCH_SIMD
+			// The vector versions compare the first and last pattern characters
+			// at kChars candidate positions per step and verify only positions
+			// which match both.
+
+			template <typename T>
+			const T* CharSearchImpl(const T* pText, const T* pTextEnd, const T* pPattern, size_t m, true_type)
+			{
+				typedef CharSimd<sizeof(T)> Simd;
+
+				const T* const pCandidateEnd = pTextEnd - m + 1;
+
+				if((size_t)(pCandidateEnd - pText) < Simd::kChars)
+					return CharSearchImpl(pText, pTextEnd, pPattern, m, false_type());
+
+				const typename Simd::vector_type vFirst = Simd::Splat((uint32_t)pPattern[0]);
+				const typename Simd::vector_type vLast  = Simd::Splat((uint32_t)pPattern[m - 1]);
+				const T* p     = pText;
+				size_t   nWork = 0;
+
+				for(;;)
+				{
+					const bool bFinal = ((size_t)(pCandidateEnd - p) < Simd::kChars);
+					uint32_t   mask;
+
+					if(bFinal) // Examine the remaining positions with a final vector which overlaps the previous one.
+					{
+						const T* const pLast = pCandidateEnd - Simd::kChars;
+						mask = ~Simd::HeadMask((size_t)(p - pLast));
+						p    = pLast;
+					}
+					else
+						mask = Simd::kMaskAll;
+
+					const uint32_t maskFirst = mask & Simd::Equal(Simd::Load(p), vFirst);
+					mask = maskFirst & Simd::Equal(Simd::Load(p + m - 1), vLast);
+
+					while(mask)
+					{
+						const size_t i = Simd::FirstIndex(mask);
+						if(CharEqual(p + i + 1, pPattern + 1, m - 2))
+							return p + i;
+
+						nWork += m;
+						mask  &= ~Simd::HeadMask(i + 1);
+					}
+
+					p += Simd::kChars;
+
+					if(bFinal || (p == pCandidateEnd))
+						return pTextEnd;
+
+					// If the first pattern character is sparse then let CharFind (memchr)
+					// skip to its next occurrence, which is faster than the filter.
+					if(is_byte_char<T>::value && !maskFirst)
+					{
+						p = CharFind(p, pCandidateEnd, pPattern[0]);
+						if(p == pCandidateEnd)
+							return pTextEnd;
+					}
+					if(EASTL_UNLIKELY(nWork > (((size_t)(p - pText) * 4) + kCharSearchWorkSlack)))
+						return TwoWaySearch(p, pTextEnd, pPattern, (ptrdiff_t)m);
+				}
+			}
+
+			template <typename T>
+			const T* CharSearchLastImpl(const T* pText, const T* pTextEnd, const T* pPattern, size_t m, true_type)
+			{
+				typedef CharSimd<sizeof(T)> Simd;
+
+				const T* const pCandidateEnd = pTextEnd - m + 1;
+
+				if((size_t)(pCandidateEnd - pText) < Simd::kChars)
+					return CharSearchLastImpl(pText, pTextEnd, pPattern, m, false_type());
+
+				const typename Simd::vector_type vFirst = Simd::Splat((uint32_t)pPattern[0]);
+				const typename Simd::vector_type vLast  = Simd::Splat((uint32_t)pPattern[m - 1]);
+				const T* p     = pCandidateEnd; // Positions [pText, p) have not been examined yet.
+				size_t   nWork = 0;
+
+				for(;;)
+				{
+					const bool bFinal = ((size_t)(p - pText) < Simd::kChars);
+					uint32_t   mask;
+
+					if(bFinal)
+					{
+						mask = Simd::HeadMask((size_t)(p - pText));
+						p    = pText;
+					}
+					else
+					{
+						mask = Simd::kMaskAll;
+						p   -= Simd::kChars;
+					}
+
+					mask &= Simd::Equal(Simd::Load(p), vFirst) & Simd::Equal(Simd::Load(p + m - 1), vLast);
+
+					while(mask)
+					{
+						const size_t i = Simd::LastIndex(mask);
+						if(CharEqual(p + i + 1, pPattern + 1, m - 2))
+							return p + i;
+
+						nWork += m;
+						mask  &= Simd::HeadMask(i);
+					}
+
+					if(bFinal || (p == pText))
+						return pTextEnd;
+					if(EASTL_UNLIKELY(nWork > (((size_t)(pCandidateEnd - p) * 4) + kCharSearchWorkSlack)))
+					{
+						const T* const pResult = CharSearchLastTwoWay(pText, p + m - 1, pPattern, m);
+						return pResult ? pResult : pTextEnd;
+					}
+				}
+			}
+		#endif
+
+		/// CharSearch
+		///
+		/// Returns the first occurrence of [pPattern, pPatternEnd) in
+		/// [pText, pTextEnd), or pTextEnd. An empty pattern matches at pText.
+		///
+		template <typename T>
+		const T* CharSearch(const T* pText, const T* pTextEnd, const T* pPattern, const T* pPatternEnd)
+		{
+			const size_t m = (size_t)(pPatternEnd - pPattern);
+
+			if(m == 0)
+				return pText;
+			if((size_t)(pTextEnd - pText) < m)
+				return pTextEnd;
+			if(m == 1)
+				return CharFind(pText, pTextEnd, *pPattern);
+
+			return CharSearchImpl(pText, pTextEnd, pPattern, m, is_simd_char<T>());
+		}
+
+		/// CharSearchLast
+		///
+		/// Returns the last occurrence of the non-empty [pPattern, pPatternEnd)
+		/// in [pText, pTextEnd), or pTextEnd.
+		///
+		template <typename T>
+		const T* CharSearchLast(const T* pText, const T* pTextEnd, const T* pPattern, const T* pPatternEnd)
+		{
+			const size_t m = (size_t)(pPatternEnd - pPattern);
+
+			if((size_t)(pTextEnd - pText) < m)
+				return pTextEnd;
+			if(m == 1)
+				return CharFindLast(pText, pTextEnd, *pPattern);
+
+			return CharSearchLastImpl(pText, pTextEnd, pPattern, m, is_simd_char<T>());
+		}
+
+
+		///////////////////////////////////////////////////////////////////////
+		// Comparison
+		///////////////////////////////////////////////////////////////////////
+
+		template <typename T>
+		EA_FORCE_INLINE int CharCompareAt(const T* p1, const T* p2, size_t i)
+		{
+			typedef typename make_unsigned<T>::type unsigned_type;
+			return ((unsigned_type)p1[i] < (unsigned_type)p2[i]) ? -1 : 1;
+		}
+
+		template <typename T>
+		inline int CharCompare(const T* p1, const T* p2, size_t n, false_type)
+		{
+			for(size_t i = 0; i < n; ++i)
+			{
+				if(p1[i] != p2[i])
+					return CharCompareAt(p1, p2, i);
+			}
+			return 0;
+		}
+
+		#if EASTL_CHAR_SEARCH_SIMD
+			template <typename T>
+			inline int CharCompare(const T* p1, const T* p2, size_t n, true_type)
+			{
+				typedef CharSimd<sizeof(T)> Simd;
+
+				size_t i = 0;
+
+				for(; (n - i) >= Simd::kChars; i += Simd::kChars)
+				{
+					const uint32_t mask = Simd::Equal(Simd::Load(p1 + i), Simd::Load(p2 + i)) ^ Simd::kMaskAll;
+					if(mask)
+						return CharCompareAt(p1, p2, i + Simd::FirstIndex(mask));
+				}
+
+				return CharCompare(p1 + i, p2 + i, n - i, false_type());
+			}
+		#endif
+
+		/// CharCompare
+		///
+		/// Compares n characters lexicographically, as unsigned values.
+		///
+		template <typename T>
+		inline int CharCompare(const T* p1, const T* p2, size_t n)
+		{
+			return CharCompare(p1, p2, n, is_simd_char<T>());
+		}
+
+	} // namespace Internal
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -17,6 +17,7 @@
 EA_ONCE()
 
 #include <EASTL/internal/config.h>
+#include <EASTL/internal/char_search.h>
 
 EA_DISABLE_ALL_VC_WARNINGS()
 #include <ctype.h>              // toupper, etc.
@@ -160,13 +161,7 @@ namespace eastl
 	template <typename T>
 	int Compare(const T* p1, const T* p2, size_t n)
 	{
-		for(; n > 0; ++p1, ++p2, --n)
-		{
-			if(*p1 != *p2)
-				return (static_cast<typename make_unsigned<T>::type>(*p1) < 
-						static_cast<typename make_unsigned<T>::type>(*p2)) ? -1 : 1;
-		}
-		return 0;
+		return Internal::CharCompare(p1, p2, n);
 	}
 
 	inline int Compare(const char8_t* p1, const char8_t* p2, size_t n)
@@ -197,36 +192,21 @@ namespace eastl
 
 	inline const char16_t* Find(const char16_t* p, char16_t c, size_t n)
 	{
-		for(; n > 0; --n, ++p)
-		{
-			if(*p == c)
-				return p;
-		}
-
-		return NULL;
+		const char16_t* const pResult = Internal::CharFind(p, p + n, c);
+		return (pResult != (p + n)) ? pResult : NULL;
 	}
 
 	inline const char32_t* Find(const char32_t* p, char32_t c, size_t n)
 	{
-		for(; n > 0; --n, ++p)
-		{
-			if(*p == c)
-				return p;
-		}
-
-		return NULL;
+		const char32_t* const pResult = Internal::CharFind(p, p + n, c);
+		return (pResult != (p + n)) ? pResult : NULL;
 	}
 
 	#if defined(EA_WCHAR_UNIQUE) && EA_WCHAR_UNIQUE
 		inline const wchar_t* Find(const wchar_t* p, wchar_t c, size_t n)
 		{
-			for(; n > 0; --n, ++p)
-			{
-				if(*p == c)
-					return p;
-			}
-
-			return NULL;
+			const wchar_t* const pResult = Internal::CharFind(p, p + n, c);
+			return (pResult != (p + n)) ? pResult : NULL;
 		}
 	#endif
 
@@ -276,135 +256,65 @@ namespace eastl
 	}
 
 	template <typename T>
-	const T* CharTypeStringFindEnd(const T* pBegin, const T* pEnd, T c)
+	inline const T* CharTypeStringFind(const T* pBegin, const T* pEnd, T c)
 	{
-		const T* pTemp = pEnd;
-		while(--pTemp >= pBegin)
-		{
-			if(*pTemp == c)
-				return pTemp;
-		}
+		return Internal::CharFind(pBegin, pEnd, c);
+	}
 
-		return pEnd;
+	template <typename T>
+	inline const T* CharTypeStringFindEnd(const T* pBegin, const T* pEnd, T c)
+	{
+		return Internal::CharFindLast(pBegin, pEnd, c);
 	}
-    
+
 	template <typename T>
-	const T* CharTypeStringRSearch(const T* p1Begin, const T* p1End, 
-								   const T* p2Begin, const T* p2End)
+	inline const T* CharTypeStringSearch(const T* p1Begin, const T* p1End, const T* p2Begin, const T* p2End)
+	{
+		return Internal::CharSearch(p1Begin, p1End, p2Begin, p2End);
+	}
+
+	template <typename T>
+	inline const T* CharTypeStringRSearch(const T* p1Begin, const T* p1End, const T* p2Begin, const T* p2End)
 	{
 		// Test for zero length strings, in which case we have a match or a failure, 
 		// but the return value is the same either way.
 		if((p1Begin == p1End) || (p2Begin == p2End))
 			return p1Begin;
 
-		// Test for a pattern of length 1.
-		if((p2Begin + 1) == p2End)
-			return CharTypeStringFindEnd(p1Begin, p1End, *p2Begin);
-
-		// Test for search string length being longer than string length.
-		if((p2End - p2Begin) > (p1End - p1Begin))
-			return p1End;
-
-		// General case.
-		const T* pSearchEnd = (p1End - (p2End - p2Begin) + 1);
-		const T* pCurrent1;
-		const T* pCurrent2;
-
-		while(pSearchEnd != p1Begin)
-		{
-			// Search for the last occurrence of *p2Begin.
-			pCurrent1 = CharTypeStringFindEnd(p1Begin, pSearchEnd, *p2Begin);
-			if(pCurrent1 == pSearchEnd) // If the first char of p2 wasn't found, 
-				return p1End;           // then we immediately have failure.
-
-			// In this case, *pTemp == *p2Begin. So compare the rest.
-			pCurrent2 = p2Begin;
-			while(*pCurrent1++ == *pCurrent2++)
-			{
-				if(pCurrent2 == p2End)
-					return (pCurrent1 - (p2End - p2Begin));
-			}
-
-			// A smarter algorithm might know to subtract more than just one,
-			// but in most cases it won't make much difference anyway.
-			--pSearchEnd;
-		}
-
-		return p1End;
+		return Internal::CharSearchLast(p1Begin, p1End, p2Begin, p2End);
 	}
 
 	template <typename T>
 	inline const T* CharTypeStringFindFirstOf(const T* p1Begin, const T* p1End, const T* p2Begin, const T* p2End)
 	{
-		for (; p1Begin != p1End; ++p1Begin)
-		{
-			for (const T* pTemp = p2Begin; pTemp != p2End; ++pTemp)
-			{
-				if (*p1Begin == *pTemp)
-					return p1Begin;
-			}
-		}
-		return p1End;
+		return Internal::CharFindFirstOf<false>(p1Begin, p1End, p2Begin, p2End);
 	}
 
 	template <typename T>
 	inline const T* CharTypeStringRFindFirstNotOf(const T* p1RBegin, const T* p1REnd, const T* p2Begin, const T* p2End)
 	{
-		for (; p1RBegin != p1REnd; --p1RBegin)
-		{
-			const T* pTemp;
-			for (pTemp = p2Begin; pTemp != p2End; ++pTemp)
-			{
-				if (*(p1RBegin - 1) == *pTemp)
-					break;
-			}
-			if (pTemp == p2End)
-				return p1RBegin;
-		}
-		return p1REnd;
+		const T* const pResult = Internal::CharFindLastOf<true>(p1REnd, p1RBegin, p2Begin, p2End);
+		return (pResult != p1RBegin) ? (pResult + 1) : p1REnd;
 	}
 
 	template <typename T>
 	inline const T* CharTypeStringFindFirstNotOf(const T* p1Begin, const T* p1End, const T* p2Begin, const T* p2End)
 	{
-		for (; p1Begin != p1End; ++p1Begin)
-		{
-			const T* pTemp;
-			for (pTemp = p2Begin; pTemp != p2End; ++pTemp)
-			{
-				if (*p1Begin == *pTemp)
-					break;
-			}
-			if (pTemp == p2End)
-				return p1Begin;
-		}
-		return p1End;
+		return Internal::CharFindFirstOf<true>(p1Begin, p1End, p2Begin, p2End);
 	}
 
 	template <typename T>
 	inline const T* CharTypeStringRFindFirstOf(const T* p1RBegin, const T* p1REnd, const T* p2Begin, const T* p2End)
 	{
-		for (; p1RBegin != p1REnd; --p1RBegin)
-		{
-			for (const T* pTemp = p2Begin; pTemp != p2End; ++pTemp)
-			{
-				if (*(p1RBegin - 1) == *pTemp)
-					return p1RBegin;
-			}
-		}
-		return p1REnd;
+		const T* const pResult = Internal::CharFindLastOf<false>(p1REnd, p1RBegin, p2Begin, p2End);
+		return (pResult != p1RBegin) ? (pResult + 1) : p1REnd;
 	}
 
 	template <typename T>
 	inline const T* CharTypeStringRFind(const T* pRBegin, const T* pREnd, const T c)
 	{
-		while (pRBegin > pREnd)
-		{
-			if (*(pRBegin - 1) == c)
-				return pRBegin;
-			--pRBegin;
-		}
-		return pREnd;
+		const T* const pResult = Internal::CharFindLast(pREnd, pRBegin, c);
+		return (pResult != pRBegin) ? (pResult + 1) : pREnd;
 	}
 
 
@@ -1194,6 +1194,31 @@ namespace eastl
 #endif
 
 
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_PREFETCH
+//
+// Defined as a macro which hints to the processor that the memory at the 
+// given address will soon be read, so that it can be brought into the cache
+// while other work is being done. It never faults, even for an invalid or 
+// NULL address, and it is a no-op for compilers which don't support it.
+// It's only worth using when the address is known well ahead of the read,
+// as with the batched lookup functions of the hash containers.
+//
+// Example usage:
+//    EASTL_PREFETCH(pNodeArray[i + 8]);
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_PREFETCH
+	#if defined(__GNUC__) || defined(__clang__)
+		#define EASTL_PREFETCH(addr) __builtin_prefetch((const void*)(addr))
+	#else
+		#define EASTL_PREFETCH(addr) ((void)(addr))
+	#endif
+#endif
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // EASTL_STD_TYPE_TRAITS_AVAILABLE
 //
@@ -1805,6 +1830,21 @@ typedef EASTL_SSIZE_T eastl_ssize_t; // Signed version of eastl_size_t. Concept
 	#define EASTL_CORE_ALLOCATOR_ENABLED 0
 #endif
 
+/// EASTL_STRING_HASH_LEGACY
+///
+/// Defined as 0 or 1. Default is 0.
+/// By default eastl::hash for strings, string views and character pointers 
+/// (and eastl::string_hash) hash the string's characters with the multi-byte 
+/// hash in internal/hash_bytes.h. If EASTL_STRING_HASH_LEGACY is 1, they use the 
+/// byte-at-a-time FNV-1 hash of previous EASTL versions instead. Enable this 
+/// if string hash values have been persisted (e.g. written to data files) 
+/// and must stay the same.
+///
+#ifndef EASTL_STRING_HASH_LEGACY
+	#define EASTL_STRING_HASH_LEGACY 0
+#endif
+
+
 /// EASTL_OPENSOURCE
 /// This is enabled when EASTL is building built in an "open source" mode.  Which is a mode that eliminates code
 /// dependencies on other technologies that have not been released publically.
@@ -0,0 +1,294 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements the Eytzinger array layout used by frozen_vector_map
+// and frozen_vector_set.
+//
+// An Eytzinger array stores a sorted sequence as an implicit, complete binary
+// search tree in breadth-first order, as a binary heap does. Numbering the nodes
+// from 1, the root is node 1 and the children of node k are nodes 2k and 2k+1.
+// A search then goes from node k to node 2k or 2k+1, which we can compute without
+// a branch, and the first levels of the tree share a few cache lines which stay
+// in the cache between searches. Also, the 16 descendants four levels below node
+// k are consecutive, so we can prefetch them while we compare with node k. The
+// result is that a search has far fewer cache misses and branch mispredictions
+// than a binary search of a sorted array, at the cost of making ordered iteration
+// jump around the array and insertion and erasure impractical.
+//
+// Node k is stored at array index k - 1.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_EYTZINGER_H
+#define EASTL_INTERNAL_EYTZINGER_H
+
+
+#include <EABase/eabase.h>
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/iterator.h>
+#include <EASTL/bit.h>
+#include <EASTL/vector.h>
+#include <EASTL/sort.h>
+#include <stddef.h>
+
+
+
+namespace eastl
+{
+	namespace Internal
+	{
+		/// EytzingerFirst
+		/// Returns the node which comes first in order in a tree of n nodes, or 0 if n is 0.
+		///
+		inline size_t EytzingerFirst(size_t n)
+		{
+			if(n == 0)
+				return 0;
+
+			size_t k = 1;
+
+			while((2 * k) <= n)
+				k = 2 * k;
+
+			return k;
+		}
+
+
+		/// EytzingerLast
+		/// Returns the node which comes last in order in a tree of n nodes, or 0 if n is 0.
+		///
+		inline size_t EytzingerLast(size_t n)
+		{
+			if(n == 0)
+				return 0;
+
+			size_t k = 1;
+
+			while(((2 * k) + 1) <= n)
+				k = (2 * k) + 1;
+
+			return k;
+		}
+
+
+		/// EytzingerNext
+		/// Returns the node which follows node k in order, or 0 if k is the last.
+		///
+		inline size_t EytzingerNext(size_t k, size_t n)
+		{
+			if(((2 * k) + 1) <= n) // If k has a right subtree, the next node is the first in it.
+			{
+				k = (2 * k) + 1;
+
+				while((2 * k) <= n)
+					k = 2 * k;
+
+				return k;
+			}
+
+			// Otherwise we go up to the first ancestor whose left subtree we are in. If we
+			// are a right child (k is odd) we go up until we aren't, and then to the parent.
+			// The root is odd, so this gives 0 if there is no such ancestor.
+			while(k & 1)
+				k >>= 1;
+
+			return k >> 1;
+		}
+
+
+		/// EytzingerPrev
+		/// Returns the node which precedes node k in order. The node which precedes 0 (the
+		/// end position) is the last node.
+		///
+		inline size_t EytzingerPrev(size_t k, size_t n)
+		{
+			if(k == 0)
+				return EytzingerLast(n);
+
+			if((2 * k) <= n) // If k has a left subtree, the previous node is the last in it.
+			{
+				k = 2 * k;
+
+				while(((2 * k) + 1) <= n)
+					k = (2 * k) + 1;
+
+				return k;
+			}
+
+			while(k && !(k & 1))
+				k >>= 1;
+
+			return k >> 1;
+		}
+
+
+		/// EytzingerPrefetchShift
+		/// The number of levels below the current node at which we prefetch: as many as fit the
+		/// descendants on that level into a 64 byte cache line, but at least one.
+		///
+		template <size_t nKeySize>
+		struct EytzingerPrefetchShift
+		{
+			static const size_t value = (nKeySize <= 4) ? 4 : (nKeySize <= 8) ? 3 : (nKeySize <= 16) ? 2 : 1;
+		};
+
+
+		/// EytzingerLowerBound
+		/// Returns the first node of the tree of n keys whose key is not less than key, or 0 if
+		/// there is none. Each step goes left if the node's key is not less than key, and right
+		/// otherwise. Having gone off the bottom, the answer is the last node at which we went
+		/// left, so we undo the trailing right turns (1 bits) and then the left turn.
+		///
+		template <typename Key, typename U, typename Compare>
+		inline size_t EytzingerLowerBound(const Key* pKeys, size_t n, const U& key, const Compare& compare)
+		{
+			size_t k = 1;
+
+			while(k <= n)
+			{
+				EASTL_PREFETCH(pKeys + ((k << EytzingerPrefetchShift<sizeof(Key)>::value) - 1));
+				k = (2 * k) + (size_t)compare(pKeys[k - 1], key);
+			}
+
+			return k >> (eastl::countr_zero(~k) + 1);
+		}
+
+
+		/// EytzingerUpperBound
+		/// Returns the first node of the tree of n keys whose key is greater than key, or 0 if
+		/// there is none.
+		///
+		template <typename Key, typename U, typename Compare>
+		inline size_t EytzingerUpperBound(const Key* pKeys, size_t n, const U& key, const Compare& compare)
+		{
+			size_t k = 1;
+
+			while(k <= n)
+			{
+				EASTL_PREFETCH(pKeys + ((k << EytzingerPrefetchShift<sizeof(Key)>::value) - 1));
+				k = (2 * k) + (size_t)!compare(key, pKeys[k - 1]);
+			}
+
+			return k >> (eastl::countr_zero(~k) + 1);
+		}
+
+
+		/// EytzingerSortAndLayOut
+		/// Sorts v by compare, removes all but the first of any equivalent values (as inserting
+		/// them one at a time into a set or map would), and rearranges the rest into Eytzinger order.
+		///
+		template <typename T, typename Allocator, typename Compare>
+		void EytzingerSortAndLayOut(eastl::vector<T, Allocator>& v, const Compare& compare)
+		{
+			typedef eastl::vector<T, Allocator>       vector_type;
+			typedef eastl::vector<size_t, Allocator>  index_vector_type;
+
+			eastl::stable_sort(v.begin(), v.end(), compare);
+
+			typename vector_type::iterator itUniqueEnd = v.begin();
+
+			for(typename vector_type::iterator it = v.begin(); it != v.end(); ++it)
+			{
+				if((itUniqueEnd == v.begin()) || compare(*(itUniqueEnd - 1), *it))
+				{
+					if(itUniqueEnd != it)
+						*itUniqueEnd = eastl::move(*it);
+					++itUniqueEnd;
+				}
+			}
+
+			v.erase(itUniqueEnd, v.end());
+
+			// Node k (at index k - 1) gets the value whose index in sorted order is its position in an in-order walk.
+			const size_t      n = (size_t)v.size();
+			vector_type       sorted(v.get_allocator());
+			index_vector_type indices((typename index_vector_type::size_type)n, 0, v.get_allocator());
+
+			sorted.swap(v);
+
+			for(size_t i = 0, k = EytzingerFirst(n); k; k = EytzingerNext(k, n), ++i)
+				indices[k - 1] = i;
+
+			v.reserve((typename vector_type::size_type)n);
+
+			for(size_t k = 0; k < n; ++k)
+				v.push_back(eastl::move(sorted[indices[k]]));
+		}
+
+	} // namespace Internal
+
+
+
+	/// eytzinger_iterator
+	///
+	/// Iterates an array in Eytzinger order (see above) in sorted order. It holds the
+	/// array, its size and the current node, which is 0 for the end position.
+	///
+	template <typename T, typename Pointer, typename Reference>
+	struct eytzinger_iterator
+	{
+		typedef eytzinger_iterator<T, Pointer, Reference>      this_type;
+		typedef eytzinger_iterator<T, T*, T&>                  iterator;
+		typedef eytzinger_iterator<T, const T*, const T&>      const_iterator;
+		typedef eastl_size_t                                   size_type;
+		typedef ptrdiff_t                                      difference_type;
+		typedef T                                              value_type;
+		typedef Pointer                                        pointer;
+		typedef Reference                                      reference;
+		typedef EASTL_ITC_NS::bidirectional_iterator_tag       iterator_category;
+
+	public:
+		T*     mpArray;
+		size_t mnSize;
+		size_t mnNode;
+
+	public:
+		eytzinger_iterator()
+			: mpArray(NULL), mnSize(0), mnNode(0) { }
+
+		eytzinger_iterator(T* pArray, size_t nSize, size_t nNode)
+			: mpArray(pArray), mnSize(nSize), mnNode(nNode) { }
+
+		eytzinger_iterator(const iterator& x)
+			: mpArray(x.mpArray), mnSize(x.mnSize), mnNode(x.mnNode) { }
+
+		reference operator*() const
+			{ return mpArray[mnNode - 1]; }
+
+		pointer operator->() const
+			{ return &mpArray[mnNode - 1]; }
+
+		this_type& operator++()
+			{ mnNode = Internal::EytzingerNext(mnNode, mnSize); return *this; }
+
+		this_type operator++(int)
+			{ this_type temp(*this); mnNode = Internal::EytzingerNext(mnNode, mnSize); return temp; }
+
+		this_type& operator--()
+			{ mnNode = Internal::EytzingerPrev(mnNode, mnSize); return *this; }
+
+		this_type operator--(int)
+			{ this_type temp(*this); mnNode = Internal::EytzingerPrev(mnNode, mnSize); return temp; }
+
+	}; // eytzinger_iterator
+
+
+	// The C++ defect report #179 requires that we support comparisons between const and non-const iterators.
+	template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB>
+	inline bool operator==(const eytzinger_iterator<T, PointerA, ReferenceA>& a, const eytzinger_iterator<T, PointerB, ReferenceB>& b)
+		{ return (a.mnNode == b.mnNode) && (a.mpArray == b.mpArray); }
+
+	template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB>
+	inline bool operator!=(const eytzinger_iterator<T, PointerA, ReferenceA>& a, const eytzinger_iterator<T, PointerB, ReferenceB>& b)
+		{ return (a.mnNode != b.mnNode) || (a.mpArray != b.mpArray); }
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -1559,6 +1559,271 @@ namespace eastl
 
 
 
+	///////////////////////////////////////////////////////////////////////////
+	// fixed_flat_table_allocator
+	///////////////////////////////////////////////////////////////////////////
+
+	/// fixed_flat_table_allocator
+	///
+	/// Allocator for the fixed flat hash containers (e.g. fixed_flat_hash_map).
+	/// A flat hash table allocates its control bytes and its slots together as a
+	/// single block, and only ever has one block in use except for the duration
+	/// of a resize. So rather than a pool of nodes, this allocator hands out its
+	/// single buffer to any request which fits in it while it isn't in use, and
+	/// passes all other requests to the overflow allocator.
+	///
+	/// Template parameters:
+	///     bufferSize             The size of the block the buffer can serve.
+	///     bufferAlignment        The alignment of the block the buffer can serve.
+	///     bEnableOverflow        Whether or not we should use the overflow heap if our buffer is exhausted.
+	///     OverflowAllocator      Overflow allocator, which is only used if bEnableOverflow == true. Defaults to the global heap.
+	///
+	template <size_t bufferSize, size_t bufferAlignment, bool bEnableOverflow, typename OverflowAllocator = EASTLAllocatorType>
+	class fixed_flat_table_allocator
+	{
+	public:
+		typedef fixed_flat_table_allocator<bufferSize, bufferAlignment, bEnableOverflow, OverflowAllocator>  this_type;
+		typedef OverflowAllocator overflow_allocator_type;
+
+		enum
+		{
+			kBlockSize       = bufferSize,
+			kBufferSize      = bufferSize + ((bufferAlignment > 1) ? bufferAlignment - 1 : 0), // The size of the user-declared buffer, which must allow for aligning the block within it.
+			kBufferAlignment = bufferAlignment
+		};
+
+	public:
+		overflow_allocator_type mOverflowAllocator;
+		void*                   mpBuffer;       // Aligned start of the block within the user-declared buffer.
+		bool                    mbBufferInUse;
+
+	public:
+		fixed_flat_table_allocator(void* pBuffer = nullptr)
+			: mpBuffer(NULL), mbBufferInUse(false)
+		{
+			reset(pBuffer);
+		}
+
+		fixed_flat_table_allocator(void* pBuffer, const overflow_allocator_type& allocator)
+			: mOverflowAllocator(allocator), mpBuffer(NULL), mbBufferInUse(false)
+		{
+			reset(pBuffer);
+		}
+
+		fixed_flat_table_allocator& operator=(const fixed_flat_table_allocator& x)
+		{
+			// We leave our buffer variables alone.
+
+			#if EASTL_ALLOCATOR_COPY_ENABLED
+				mOverflowAllocator = x.mOverflowAllocator;
+			#else
+				(void)x;
+			#endif
+
+			return *this;
+		}
+
+		void* allocate(size_t n, int flags = 0)
+		{
+			if(mpBuffer && !mbBufferInUse && (n <= kBlockSize))
+			{
+				mbBufferInUse = true;
+				return mpBuffer;
+			}
+			return mOverflowAllocator.allocate(n, flags);
+		}
+
+		void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0)
+		{
+			if(mpBuffer && !mbBufferInUse && (n <= kBlockSize) && (alignment <= kBufferAlignment) && (offset == 0))
+			{
+				mbBufferInUse = true;
+				return mpBuffer;
+			}
+			return mOverflowAllocator.allocate(n, alignment, offset, flags);
+		}
+
+		void deallocate(void* p, size_t n)
+		{
+			if(p == mpBuffer)
+				mbBufferInUse = false;
+			else
+				mOverflowAllocator.deallocate(p, n);
+		}
+
+		bool can_allocate() const
+		{
+			return !mbBufferInUse;
+		}
+
+		void reset(void* pBuffer)
+		{
+			mpBuffer      = pBuffer ? (void*)(((uintptr_t)pBuffer + (kBufferAlignment - 1)) & ~(uintptr_t)(kBufferAlignment - 1)) : NULL;
+			mbBufferInUse = false;
+		}
+
+		const char* get_name() const
+		{
+			return mOverflowAllocator.get_name();
+		}
+
+		void set_name(const char* pName)
+		{
+			mOverflowAllocator.set_name(pName);
+		}
+
+		const overflow_allocator_type& get_overflow_allocator() const EA_NOEXCEPT
+		{
+			return mOverflowAllocator;
+		}
+
+		overflow_allocator_type& get_overflow_allocator() EA_NOEXCEPT
+		{
+			return mOverflowAllocator;
+		}
+
+		void set_overflow_allocator(const overflow_allocator_type& allocator)
+		{
+			mOverflowAllocator = allocator;
+		}
+
+		void copy_overflow_allocator(const this_type& x)  // This function exists so we can write generic code that works for allocators that do and don't have overflow allocators.
+		{
+			mOverflowAllocator = x.mOverflowAllocator;
+		}
+
+	}; // fixed_flat_table_allocator
+
+
+	template <size_t bufferSize, size_t bufferAlignment, typename OverflowAllocator>
+	class fixed_flat_table_allocator<bufferSize, bufferAlignment, false, OverflowAllocator>
+	{
+	public:
+		typedef fixed_flat_table_allocator<bufferSize, bufferAlignment, false, OverflowAllocator>  this_type;
+		typedef OverflowAllocator overflow_allocator_type;
+
+		enum
+		{
+			kBlockSize       = bufferSize,
+			kBufferSize      = bufferSize + ((bufferAlignment > 1) ? bufferAlignment - 1 : 0),
+			kBufferAlignment = bufferAlignment
+		};
+
+	public:
+		void* mpBuffer;
+		bool  mbBufferInUse;
+
+	public:
+		fixed_flat_table_allocator(void* pBuffer = nullptr)
+			: mpBuffer(NULL), mbBufferInUse(false)
+		{
+			reset(pBuffer);
+		}
+
+		fixed_flat_table_allocator(void* pBuffer, const overflow_allocator_type& /*allocator*/)  // allocator is unused because bEnableOverflow is false in this specialization.
+			: mpBuffer(NULL), mbBufferInUse(false)
+		{
+			reset(pBuffer);
+		}
+
+		fixed_flat_table_allocator& operator=(const fixed_flat_table_allocator&)
+		{
+			// We leave our buffer variables alone.
+			return *this;
+		}
+
+		void* allocate(size_t n, int /*flags*/ = 0)
+		{
+			EASTL_ASSERT(mpBuffer && !mbBufferInUse && (n <= kBlockSize)); // A fixed flat hash container should not grow beyond its buffer, else the user has exhausted its space.
+			EA_UNUSED(n);
+			mbBufferInUse = true;
+			return mpBuffer;
+		}
+
+		void* allocate(size_t n, size_t alignment, size_t /*offset*/, int flags = 0)
+		{
+			EASTL_ASSERT(alignment <= kBufferAlignment);
+			EA_UNUSED(alignment);
+			return allocate(n, flags);
+		}
+
+		void deallocate(void* p, size_t /*n*/)
+		{
+			if(p == mpBuffer)
+				mbBufferInUse = false;
+		}
+
+		bool can_allocate() const
+		{
+			return !mbBufferInUse;
+		}
+
+		void reset(void* pBuffer)
+		{
+			mpBuffer      = pBuffer ? (void*)(((uintptr_t)pBuffer + (kBufferAlignment - 1)) & ~(uintptr_t)(kBufferAlignment - 1)) : NULL;
+			mbBufferInUse = false;
+		}
+
+		const char* get_name() const
+		{
+			return EASTL_FIXED_POOL_DEFAULT_NAME;
+		}
+
+		void set_name(const char* /*pName*/)
+		{
+		}
+
+		const overflow_allocator_type& get_overflow_allocator() const EA_NOEXCEPT
+		{
+			EASTL_ASSERT(false);
+			overflow_allocator_type* pNULL = NULL;
+			return *pNULL; // This is not pretty, but it should never execute. This is here only to allow this to compile.
+		}
+
+		overflow_allocator_type& get_overflow_allocator() EA_NOEXCEPT
+		{
+			EASTL_ASSERT(false);
+			overflow_allocator_type* pNULL = NULL;
+			return *pNULL; // This is not pretty, but it should never execute. This is here only to allow this to compile.
+		}
+
+		void set_overflow_allocator(const overflow_allocator_type& /*allocator*/)
+		{
+			// We don't have an overflow allocator.
+			EASTL_ASSERT(false);
+		}
+
+		void copy_overflow_allocator(const this_type&)  // This function exists so we can write generic code that works for allocators that do and don't have overflow allocators.
+		{
+			// We don't have an overflow allocator.
+		}
+
+	}; // fixed_flat_table_allocator
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <size_t bufferSize, size_t bufferAlignment, bool bEnableOverflow, typename OverflowAllocator>
+	inline bool operator==(const fixed_flat_table_allocator<bufferSize, bufferAlignment, bEnableOverflow, OverflowAllocator>& a, 
+						   const fixed_flat_table_allocator<bufferSize, bufferAlignment, bEnableOverflow, OverflowAllocator>& b)
+	{
+		return (&a == &b); // They are only equal if they are the same object.
+	}
+
+
+	template <size_t bufferSize, size_t bufferAlignment, bool bEnableOverflow, typename OverflowAllocator>
+	inline bool operator!=(const fixed_flat_table_allocator<bufferSize, bufferAlignment, bEnableOverflow, OverflowAllocator>& a, 
+						   const fixed_flat_table_allocator<bufferSize, bufferAlignment, bEnableOverflow, OverflowAllocator>& b)
+	{
+		return (&a != &b); // They are only equal if they are the same object.
+	}
+
+
+
+
+
 	///////////////////////////////////////////////////////////////////////////
 	// fixed_swap
 	///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1693 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements flat_hashtable, the open-addressing hash table which
+// underlies flat_hash_map and flat_hash_set. The design follows the "Swiss
+// table" layout popularized by Abseil and used by a number of other modern
+// hash table implementations:
+//
+//  - Elements are stored inline in a single contiguous slot array (no per
+//    element nodes), so a successful lookup usually touches one cache line
+//    of metadata and one cache line of element data.
+//  - Each slot has a one byte control (metadata) value. It is either one of
+//    the special values Empty, Deleted (a tombstone) or Sentinel, or it holds
+//    the low 7 bits of the element's hash (the "H2" value) if the slot is full.
+//  - The capacity is always 2^n - 1, so reducing a hash to a slot index is a
+//    single mask instead of a modulo by a prime.
+//  - Lookups scan a group of control bytes at a time (16 with SSE2, 8 with
+//    the portable 64 bit word implementation) and compare all of them against
+//    the H2 value in parallel. Only slots whose control byte matches have
+//    their keys compared, so the number of key comparisons per lookup is
+//    almost always one for hits and zero for misses.
+//  - The first (group width - 1) control bytes are cloned after the sentinel
+//    so that a group can be loaded starting at any slot index without any
+//    wraparound handling.
+//
+// Since elements are stored inline, iterators and references to elements are
+// invalidated by any insertion which causes the table to grow and by rehash.
+// Erasure doesn't move any other elements, and so only invalidates iterators
+// and references to the erased element. This is similar to vector_map and
+// unlike hash_map, and is the primary behavioral difference users need to be
+// aware of when switching from hash_map to flat_hash_map.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_FLAT_HASHTABLE_H
+#define EASTL_INTERNAL_FLAT_HASHTABLE_H
+
+
+#include <EASTL/internal/config.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+#include <EASTL/type_traits.h>
+#include <EASTL/allocator.h>
+#include <EASTL/iterator.h>
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/initializer_list.h>
+#include <EASTL/tuple.h>
+#include <EASTL/bit.h>
+#include <EASTL/internal/hashtable.h> // ht_distance, hashtable_find
+#include <string.h>
+
+EA_DISABLE_ALL_VC_WARNINGS()
+	#include <new>
+	#include <stddef.h>
+EA_RESTORE_ALL_VC_WARNINGS()
+
+#if EASTL_EXCEPTIONS_ENABLED
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <stdexcept> // std::out_of_range
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+
+/// EASTL_FLAT_HASHTABLE_SSE2
+///
+/// Defined as 0 or 1. If 1 then flat_hashtable probes its control bytes 16 at
+/// a time with SSE2 instructions. Otherwise a portable implementation which
+/// operates on 8 control bytes at a time within a 64 bit integer is used.
+/// The portable implementation is what would be used on NEON platforms as well,
+/// as it compiles to efficient code there.
+///
+#ifndef EASTL_FLAT_HASHTABLE_SSE2
+	#if defined(EA_SSE2) && EA_SSE2
+		#define EASTL_FLAT_HASHTABLE_SSE2 1
+	#else
+		#define EASTL_FLAT_HASHTABLE_SSE2 0
+	#endif
+#endif
+
+#if EASTL_FLAT_HASHTABLE_SSE2
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <emmintrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+
+EA_DISABLE_VC_WARNING(4512 4530 4571);
+
+
+namespace eastl
+{
+
+	/// EASTL_FLAT_HASHTABLE_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_FLAT_HASHTABLE_DEFAULT_NAME
+		#define EASTL_FLAT_HASHTABLE_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " flat_hashtable" // Unless the user overrides something, this is "EASTL flat_hashtable".
+	#endif
+
+
+	/// EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR
+		#define EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR allocator_type(EASTL_FLAT_HASHTABLE_DEFAULT_NAME)
+	#endif
+
+
+	/// gFlatHashtableEmptyGroup
+	///
+	/// A shared control byte array for an empty flat_hashtable. This is present so
+	/// that a new empty flat_hashtable allocates no memory. It consists of a lone
+	/// Sentinel followed by enough Empty bytes for a full group to be loaded from it.
+	///
+	extern EASTL_API const int8_t gFlatHashtableEmptyGroup[16];
+
+
+	namespace Internal
+	{
+		typedef int8_t flat_ctrl_t;
+		typedef uint8_t flat_h2_t;
+
+		// Control byte values. Full slots store their H2 value, which is in the range of [0, 127].
+		// The special values are all negative, so a single sign test distinguishes full from non-full.
+		static const flat_ctrl_t kFlatCtrlEmpty    = -128; // 0b10000000
+		static const flat_ctrl_t kFlatCtrlDeleted  = -2;   // 0b11111110
+		static const flat_ctrl_t kFlatCtrlSentinel = -1;   // 0b11111111
+
+		inline bool FlatIsEmpty(flat_ctrl_t c)          { return c == kFlatCtrlEmpty; }
+		inline bool FlatIsFull(flat_ctrl_t c)           { return c >= 0; }
+		inline bool FlatIsDeleted(flat_ctrl_t c)        { return c == kFlatCtrlDeleted; }
+		inline bool FlatIsEmptyOrDeleted(flat_ctrl_t c) { return c < kFlatCtrlSentinel; }
+
+
+		/// FlatHashMix
+		///
+		/// Many hash functions (including eastl::hash for integral types, which is the identity
+		/// function) produce values whose low bits are poorly distributed. Since the table takes
+		/// its slot index and its 7 bit H2 tag from different bits of the hash value, we apply
+		/// a multiplicative (Fibonacci) mix which spreads entropy from all input bits to all
+		/// output bits before using the value.
+		///
+		inline size_t FlatHashMix(size_t h)
+		{
+			#if (EA_PLATFORM_PTR_SIZE == 8)
+				h *= UINT64_C(0x9E3779B97F4A7C15);
+				return h ^ (h >> 32);
+			#else
+				h *= 0x9E3779B1u;
+				return h ^ (h >> 16);
+			#endif
+		}
+
+		inline size_t    FlatH1(size_t h) { return h >> 7; }
+		inline flat_h2_t FlatH2(size_t h) { return (flat_h2_t)(h & 0x7F); }
+
+
+		/// flat_bitmask
+		///
+		/// An abstraction over a bitmask which has one bit (or one byte, when Shift is 3) per
+		/// control byte of a group. Iterating it yields the indexes of the set positions.
+		///
+		template <typename T, int SignificantBits, int Shift>
+		struct flat_bitmask
+		{
+			T mMask;
+
+			explicit flat_bitmask(T mask) : mMask(mask) {}
+
+			operator bool() const          { return mMask != 0; }
+			int  LowestBitSet() const      { return eastl::countr_zero(mMask) >> Shift; }
+			int  TrailingZeros() const     { return eastl::countr_zero(mMask) >> Shift; }
+			void ClearLowestBit()          { mMask &= (mMask - 1); }
+
+			int LeadingZeros() const
+			{
+				const int kExtraBits = (int)(sizeof(T) * 8) - (SignificantBits << Shift);
+				return eastl::countl_zero((T)(mMask << kExtraBits)) >> Shift;
+			}
+		};
+
+
+		#if EASTL_FLAT_HASHTABLE_SSE2
+			/// flat_group
+			///
+			/// SSE2 implementation of a group of 16 control bytes.
+			///
+			struct flat_group
+			{
+				static const int kWidth = 16;
+				typedef flat_bitmask<uint32_t, kWidth, 0> bitmask_type;
+
+				__m128i mCtrl;
+
+				explicit flat_group(const flat_ctrl_t* pCtrl)
+					: mCtrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl))) {}
+
+				// Returns a bitmask of the control bytes which equal h2.
+				bitmask_type Match(flat_h2_t h2) const
+					{ return bitmask_type((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)h2), mCtrl))); }
+
+				// Returns a bitmask of the control bytes which are Empty.
+				bitmask_type MatchEmpty() const
+					{ return bitmask_type((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)kFlatCtrlEmpty), mCtrl))); }
+
+				// Returns a bitmask of the control bytes which are Empty or Deleted.
+				bitmask_type MatchEmptyOrDeleted() const
+					{ return bitmask_type((uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8((char)kFlatCtrlSentinel), mCtrl))); }
+
+				// Returns the number of leading Empty or Deleted control bytes.
+				int CountLeadingEmptyOrDeleted() const
+				{
+					const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8((char)kFlatCtrlSentinel), mCtrl));
+					return eastl::countr_zero((uint32_t)(mask + 1));
+				}
+			};
+		#else
+			/// flat_group
+			///
+			/// Portable implementation of a group of 8 control bytes, which uses
+			/// SWAR (SIMD within a register) techniques on a 64 bit integer.
+			///
+			struct flat_group
+			{
+				static const int kWidth = 8;
+				typedef flat_bitmask<uint64_t, kWidth, 3> bitmask_type;
+
+				uint64_t mCtrl;
+
+				explicit flat_group(const flat_ctrl_t* pCtrl)
+				{
+					#if defined(EA_SYSTEM_LITTLE_ENDIAN)
+						memcpy(&mCtrl, pCtrl, sizeof(mCtrl));
+					#else
+						mCtrl = 0;
+						for(int i = kWidth - 1; i >= 0; --i)
+							mCtrl = (mCtrl << 8) | (uint8_t)pCtrl[i];
+					#endif
+				}
+
+				bitmask_type Match(flat_h2_t h2) const
+				{
+					// This may report false positives when a byte below a genuine match is one greater
+					// than h2, which is harmless as every match is verified by a full key comparison.
+					const uint64_t kLsbs = UINT64_C(0x0101010101010101);
+					const uint64_t kMsbs = UINT64_C(0x8080808080808080);
+					const uint64_t x     = mCtrl ^ (kLsbs * h2);
+					return bitmask_type((x - kLsbs) & ~x & kMsbs);
+				}
+
+				bitmask_type MatchEmpty() const
+				{
+					const uint64_t kMsbs = UINT64_C(0x8080808080808080);
+					return bitmask_type((mCtrl & (~mCtrl << 6)) & kMsbs);
+				}
+
+				bitmask_type MatchEmptyOrDeleted() const
+				{
+					const uint64_t kMsbs = UINT64_C(0x8080808080808080);
+					return bitmask_type((mCtrl & (~mCtrl << 7)) & kMsbs);
+				}
+
+				int CountLeadingEmptyOrDeleted() const
+				{
+					const uint64_t kGaps = UINT64_C(0x00FEFEFEFEFEFEFE);
+					return (eastl::countr_zero((uint64_t)(((~mCtrl & (mCtrl >> 7)) | kGaps) + 1)) + 7) >> 3;
+				}
+			};
+		#endif
+
+
+		/// flat_probe_seq
+		///
+		/// Triangular probing over groups. Given a power of two number of groups, this
+		/// sequence visits every group exactly once before repeating.
+		///
+		struct flat_probe_seq
+		{
+			size_t mMask;
+			size_t mOffset;
+			size_t mIndex;
+
+			flat_probe_seq(size_t h1, size_t mask)
+				: mMask(mask), mOffset(h1 & mask), mIndex(0) {}
+
+			size_t Offset() const         { return mOffset; }
+			size_t Offset(size_t i) const { return (mOffset + i) & mMask; }
+
+			void Next()
+			{
+				mIndex  += flat_group::kWidth;
+				mOffset += mIndex;
+				mOffset &= mMask;
+			}
+		};
+
+
+		// Capacity math. Capacities are always of the form 2^n - 1.
+		inline bool FlatIsValidCapacity(size_t n) { return ((n + 1) & n) == 0 && n > 0; }
+
+		inline size_t FlatNormalizeCapacity(size_t n)
+			{ return n ? (~size_t(0) >> eastl::countl_zero(n)) : 1; }
+
+		// Returns the number of elements which can be inserted into a table of the given capacity before it must grow.
+		// This implements a maximum load factor of 7/8.
+		inline size_t FlatCapacityToGrowth(size_t capacity)
+		{
+			if((flat_group::kWidth == 8) && (capacity == 7)) // x - x/8 doesn't work when x == 7 and the group is 8 wide.
+				return 6;
+			return capacity - (capacity / 8);
+		}
+
+		// The inverse of FlatCapacityToGrowth, except that the result isn't normalized.
+		inline size_t FlatGrowthToLowerboundCapacity(size_t growth)
+		{
+			if((flat_group::kWidth == 8) && (growth == 7))
+				return 8;
+			return growth + (size_t)(((ptrdiff_t)growth - 1) / 7);
+		}
+
+		inline size_t FlatNumClonedBytes()              { return flat_group::kWidth - 1; }
+		inline size_t FlatCtrlBytes(size_t capacity)    { return capacity + 1 + FlatNumClonedBytes(); }
+
+		inline size_t FlatSlotOffset(size_t capacity, size_t slotAlign)
+			{ return (FlatCtrlBytes(capacity) + slotAlign - 1) & ~(slotAlign - 1); }
+
+		inline size_t FlatAllocSize(size_t capacity, size_t slotSize, size_t slotAlign)
+			{ return FlatSlotOffset(capacity, slotAlign) + (capacity * slotSize); }
+
+		// Compile time equivalents of the above, used to size the buffers of fixed flat containers.
+		template <size_t n>
+		struct flat_normalize_capacity { static const size_t value = (flat_normalize_capacity<(n >> 1)>::value << 1) | 1; };
+		template <> struct flat_normalize_capacity<1> { static const size_t value = 1; };
+		template <> struct flat_normalize_capacity<0> { static const size_t value = 1; };
+
+		template <size_t nodeCount, size_t slotSize, size_t slotAlign>
+		struct flat_table_layout
+		{
+			static const size_t kGrowth     = ((flat_group::kWidth == 8) && (nodeCount == 7)) ? 8 : (nodeCount + ((nodeCount > 0) ? ((nodeCount - 1) / 7) : 0));
+			static const size_t kCapacity   = flat_normalize_capacity<kGrowth>::value;
+			static const size_t kCtrlBytes  = kCapacity + flat_group::kWidth;
+			static const size_t kSlotOffset = (kCtrlBytes + slotAlign - 1) & ~(slotAlign - 1);
+			static const size_t kAllocSize  = kSlotOffset + (kCapacity * slotSize);
+		};
+
+		// Sets the control byte at index i, as well as its clone if i is within the first (group width - 1) bytes.
+		inline void FlatSetCtrl(flat_ctrl_t* pCtrl, size_t capacity, size_t i, flat_ctrl_t h)
+		{
+			pCtrl[i] = h;
+			pCtrl[((i - FlatNumClonedBytes()) & capacity) + (FlatNumClonedBytes() & capacity)] = h;
+		}
+
+	} // namespace Internal
+
+
+
+	/// flat_hashtable_can_grow
+	///
+	/// Identifies allocators which can't supply a second block of memory while one is in use,
+	/// such as the allocator of a fixed flat hash container with overflow disabled. Tables with
+	/// such allocators always reclaim tombstones in place rather than growing when they can.
+	///
+	template <size_t, size_t, bool, typename>
+	class fixed_flat_table_allocator;
+
+	template <typename Allocator>
+	struct flat_hashtable_can_grow : public eastl::true_type {};
+
+	template <size_t bufferSize, size_t bufferAlignment, typename OverflowAllocator>
+	struct flat_hashtable_can_grow<fixed_flat_table_allocator<bufferSize, bufferAlignment, false, OverflowAllocator> > : public eastl::false_type {};
+
+
+
+	/// flat_hashtable_iterator
+	///
+	/// Iterates the full slots of a flat_hashtable in slot order. The iterator
+	/// stores a pointer to the current control byte and the current slot; the
+	/// trailing sentinel control byte serves as the end marker, which means that
+	/// the end iterator is simply the (ctrl + capacity, slots + capacity) pair.
+	///
+	template <typename Value, bool bConst>
+	struct flat_hashtable_iterator
+	{
+	public:
+		typedef flat_hashtable_iterator<Value, bConst>                   this_type;
+		typedef flat_hashtable_iterator<Value, false>                    this_type_non_const;
+		typedef Value                                                    value_type;
+		typedef typename type_select<bConst, const Value*, Value*>::type pointer;
+		typedef typename type_select<bConst, const Value&, Value&>::type reference;
+		typedef ptrdiff_t                                                difference_type;
+		typedef EASTL_ITC_NS::forward_iterator_tag                       iterator_category;
+
+	public:
+		const Internal::flat_ctrl_t* mpCtrl;
+		Value*                       mpSlot;
+
+	public:
+		flat_hashtable_iterator(const Internal::flat_ctrl_t* pCtrl = NULL, Value* pSlot = NULL)
+			: mpCtrl(pCtrl), mpSlot(pSlot) { }
+
+		flat_hashtable_iterator(const this_type_non_const& x)
+			: mpCtrl(x.mpCtrl), mpSlot(x.mpSlot) { }
+
+		reference operator*() const
+			{ return *mpSlot; }
+
+		pointer operator->() const
+			{ return mpSlot; }
+
+		this_type& operator++()
+			{ ++mpCtrl; ++mpSlot; skip_empty_or_deleted(); return *this; }
+
+		this_type operator++(int)
+			{ this_type temp(*this); ++*this; return temp; }
+
+		void skip_empty_or_deleted()
+		{
+			while(Internal::FlatIsEmptyOrDeleted(*mpCtrl))
+			{
+				const int nShift = Internal::flat_group(mpCtrl).CountLeadingEmptyOrDeleted();
+				mpCtrl += nShift;
+				mpSlot += nShift;
+			}
+		}
+
+	}; // flat_hashtable_iterator
+
+
+	template <typename Value, bool bConstA, bool bConstB>
+	inline bool operator==(const flat_hashtable_iterator<Value, bConstA>& a, const flat_hashtable_iterator<Value, bConstB>& b)
+		{ return a.mpCtrl == b.mpCtrl; }
+
+	template <typename Value, bool bConstA, bool bConstB>
+	inline bool operator!=(const flat_hashtable_iterator<Value, bConstA>& a, const flat_hashtable_iterator<Value, bConstB>& b)
+		{ return a.mpCtrl != b.mpCtrl; }
+
+
+
+	/// flat_hashtable
+	///
+	/// Key data types:
+	///     Key                - The key type. For maps this is the map key type, for sets it's the same as Value.
+	///     Value              - The value type. For maps this is pair<const Key, T>.
+	///     Allocator          - The allocator. Element storage and control bytes are allocated as a single block.
+	///     ExtractKey         - Returns the key from a value (e.g. use_first or use_self).
+	///     Equal              - Key equality predicate.
+	///     Hash               - Key hash function. The result is further mixed by the table (see FlatHashMix),
+	///                          so user hash functions need not distribute well in the low bits.
+	///     bMutableIterators  - If true then iterator is mutable (map), else iterator is const (set).
+	///
+	/// Keys are always unique. There are no flat multimap/multiset variants.
+	///
+	template <typename Key, typename Value, typename Allocator, typename ExtractKey, typename Equal, typename Hash, bool bMutableIterators>
+	class flat_hashtable
+	{
+	public:
+		typedef Key                                                                         key_type;
+		typedef Value                                                                       value_type;
+		typedef Hash                                                                        hasher;
+		typedef Equal                                                                       key_equal;
+		typedef ptrdiff_t                                                                   difference_type;
+		typedef eastl_size_t                                                                size_type;     // See config.h for the definition of eastl_size_t, which defaults to size_t.
+		typedef value_type&                                                                 reference;
+		typedef const value_type&                                                           const_reference;
+		typedef flat_hashtable_iterator<value_type, !bMutableIterators>                     iterator;
+		typedef flat_hashtable_iterator<value_type, true>                                   const_iterator;
+		typedef Allocator                                                                   allocator_type;
+		typedef eastl::pair<iterator, bool>                                                 insert_return_type;
+		typedef flat_hashtable<Key, Value, Allocator, ExtractKey, Equal, Hash, bMutableIterators> this_type;
+		typedef Internal::flat_ctrl_t                                                       ctrl_type;
+		typedef Internal::flat_group                                                        group_type;
+
+		using key_equal_function = Equal;
+
+		static const size_t kGroupWidth = (size_t)group_type::kWidth;
+
+	protected:
+		ctrl_type*     mpCtrl;          // Control bytes; capacity + 1 + (kGroupWidth - 1) of them. Points to gFlatHashtableEmptyGroup when we have no memory.
+		value_type*    mpSlots;         // Slot array, located in the same memory block just after the control bytes.
+		size_type      mnCapacity;      // Always 0 or 2^n - 1.
+		size_type      mnSize;          // Number of full slots.
+		size_type      mnGrowthLeft;    // Number of additional elements which can be inserted into Empty slots before we must rehash.
+		Hash           mHash;
+		Equal          mEqual;
+		ExtractKey     mExtractKey;
+		allocator_type mAllocator;
+
+	public:
+		flat_hashtable(size_type nCapacity, const Hash& hashFunction, const Equal& equal, const allocator_type& allocator = EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR);
+
+		template <typename FowardIterator>
+		flat_hashtable(FowardIterator first, FowardIterator last, size_type nCapacity, const Hash& hashFunction, const Equal& equal,
+		               const allocator_type& allocator = EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR);
+
+		flat_hashtable(const flat_hashtable& x);
+		flat_hashtable(this_type&& x);
+		flat_hashtable(this_type&& x, const allocator_type& allocator);
+	   ~flat_hashtable();
+
+		const allocator_type& get_allocator() const EA_NOEXCEPT  { return mAllocator; }
+		allocator_type&       get_allocator() EA_NOEXCEPT        { return mAllocator; }
+		void                  set_allocator(const allocator_type& allocator) { mAllocator = allocator; }
+
+		this_type& operator=(const this_type& x);
+		this_type& operator=(std::initializer_list<value_type> ilist);
+		this_type& operator=(this_type&& x);
+
+		void swap(this_type& x);
+
+		iterator begin() EA_NOEXCEPT
+		{
+			iterator i(mpCtrl, mpSlots);
+			i.skip_empty_or_deleted();
+			return i;
+		}
+
+		const_iterator begin() const EA_NOEXCEPT
+		{
+			const_iterator i(mpCtrl, mpSlots);
+			i.skip_empty_or_deleted();
+			return i;
+		}
+
+		const_iterator cbegin() const EA_NOEXCEPT
+			{ return begin(); }
+
+		iterator end() EA_NOEXCEPT
+			{ return iterator(mpCtrl + mnCapacity, mpSlots + mnCapacity); }
+
+		const_iterator end() const EA_NOEXCEPT
+			{ return const_iterator(mpCtrl + mnCapacity, mpSlots + mnCapacity); }
+
+		const_iterator cend() const EA_NOEXCEPT
+			{ return end(); }
+
+		bool empty() const EA_NOEXCEPT
+			{ return mnSize == 0; }
+
+		size_type size() const EA_NOEXCEPT
+			{ return mnSize; }
+
+		/// bucket_count
+		///
+		/// Returns the number of slots in the table. This is provided for compatibility
+		/// with hash_map; flat_hashtable has no concept of buckets separate from slots.
+		///
+		size_type bucket_count() const EA_NOEXCEPT
+			{ return mnCapacity; }
+
+		/// capacity
+		///
+		/// Returns the number of elements which can be held without the table needing to grow.
+		///
+		size_type capacity() const EA_NOEXCEPT
+			{ return mnCapacity ? (size_type)Internal::FlatCapacityToGrowth(mnCapacity) : 0; }
+
+		float load_factor() const EA_NOEXCEPT
+			{ return mnCapacity ? ((float)mnSize / (float)mnCapacity) : 0.f; }
+
+		/// get_max_load_factor
+		///
+		/// The max load factor of a flat_hashtable is fixed at 7/8, as the probing
+		/// scheme depends on there always being Empty slots in the table.
+		///
+		float get_max_load_factor() const EA_NOEXCEPT
+			{ return 0.875f; }
+
+		template <class... Args>
+		insert_return_type emplace(Args&&... args);
+
+		template <class... Args>
+		iterator emplace_hint(const_iterator position, Args&&... args);
+
+		template <class... Args> insert_return_type try_emplace(const key_type& k, Args&&... args);
+		template <class... Args> insert_return_type try_emplace(key_type&& k, Args&&... args);
+		template <class... Args> iterator           try_emplace(const_iterator position, const key_type& k, Args&&... args);
+		template <class... Args> iterator           try_emplace(const_iterator position, key_type&& k, Args&&... args);
+
+		insert_return_type insert(const value_type& value);
+		insert_return_type insert(value_type&& otherValue);
+		iterator           insert(const_iterator hint, const value_type& value);
+		iterator           insert(const_iterator hint, value_type&& value);
+		void               insert(std::initializer_list<value_type> ilist);
+
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last);
+
+		template <class M> insert_return_type insert_or_assign(const key_type& k, M&& obj);
+		template <class M> insert_return_type insert_or_assign(key_type&& k, M&& obj);
+		template <class M> iterator           insert_or_assign(const_iterator hint, const key_type& k, M&& obj);
+		template <class M> iterator           insert_or_assign(const_iterator hint, key_type&& k, M&& obj);
+
+		iterator         erase(const_iterator position);
+		iterator         erase(const_iterator first, const_iterator last);
+		size_type        erase(const key_type& k);
+
+		void clear();
+		void clear(bool clearBuckets);                  // If clearBuckets is true, we free the slot memory and set the capacity to zero.
+		void reset_lose_memory() EA_NOEXCEPT;           // This is a unilateral reset to an initially empty state. No destructors are called, no deallocation occurs.
+		void rehash(size_type nCapacity);               // Grows the table so that it has at least nCapacity slots (and can hold size() elements). Also drops tombstones.
+		void reserve(size_type nElementCount);          // Grows the table so that nElementCount elements can be held without further growth.
+
+		iterator       find(const key_type& key);
+		const_iterator find(const key_type& key) const;
+
+		/// Implements a find whereby the user supplies a comparison of a different type
+		/// than the hashtable value_type. A useful case of this is one whereby you have
+		/// a container of string objects but want to do searches via passing in char pointers.
+		/// The problem is that without this kind of find, you need to do the expensive operation
+		/// of converting the char pointer to a string so it can be used as the argument to the
+		/// find function. The hash function for U must produce the same hash value as the table's
+		/// hash function would for the equivalent key_type.
+		///
+		/// Example usage (namespaces omitted for brevity):
+		///     flat_hash_set<string> hashSet;
+		///     hashSet.find_as("hello");    // Use default hash and compare.
+		///
+		/// Example usage (note that the predicate uses string as first type and char* as second):
+		///     flat_hash_set<string> hashSet;
+		///     hashSet.find_as("hello", hash<char*>(), equal_to_2<string, char*>());
+		///
+		template <typename U, typename UHash, typename BinaryPredicate>
+		iterator       find_as(const U& u, UHash uhash, BinaryPredicate predicate);
+
+		template <typename U, typename UHash, typename BinaryPredicate>
+		const_iterator find_as(const U& u, UHash uhash, BinaryPredicate predicate) const;
+
+		template <typename U>
+		iterator       find_as(const U& u);
+
+		template <typename U>
+		const_iterator find_as(const U& u) const;
+
+		size_type count(const key_type& k) const
+			{ return (find(k) != end()) ? 1 : 0; }
+
+		eastl::pair<iterator, iterator>             equal_range(const key_type& k);
+		eastl::pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
+
+		bool contains(const key_type& k) const
+			{ return find(k) != end(); }
+
+		/// Heterogeneous lookup, available only if both Hash and Equal define is_transparent.
+		/// See the description of these functions in hashtable.h.
+		///
+		template <typename U, typename HashT = Hash, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, iterator) find(const U& u)
+			{ return find_as(u, mHash, mEqual); }
+
+		template <typename U, typename HashT = Hash, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, const_iterator) find(const U& u) const
+			{ return find_as(u, mHash, mEqual); }
+
+		template <typename U, typename HashT = Hash, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, bool) contains(const U& u) const
+			{ return find_as(u, mHash, mEqual) != end(); }
+
+		template <typename U, typename HashT = Hash, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, size_type) count(const U& u) const
+			{ return (find_as(u, mHash, mEqual) != end()) ? 1 : 0; }
+
+		template <typename U, typename HashT = Hash, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, eastl::pair<iterator, iterator>) equal_range(const U& u)
+		{
+			const iterator it = find(u);
+			return eastl::pair<iterator, iterator>(it, (it == end()) ? it : eastl::next(it));
+		}
+
+		template <typename U, typename HashT = Hash, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, eastl::pair<const_iterator, const_iterator>) equal_range(const U& u) const
+		{
+			const const_iterator it = find(u);
+			return eastl::pair<const_iterator, const_iterator>(it, (it == end()) ? it : eastl::next(it));
+		}
+
+		template <typename U, typename HashT = Hash, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT_ERASE(HashT, EqualT, U, size_type) erase(const U& u)
+		{
+			const size_t i = DoFind(u, Internal::FlatHashMix((size_t)mHash(u)), mEqual);
+
+			if(i != mnCapacity)
+			{
+				mpSlots[i].~value_type();
+				DoEraseMetaOnly(i);
+				return 1;
+			}
+
+			return 0;
+		}
+
+		const Hash& hash_function() const
+			{ return mHash; }
+
+		const Equal& key_eq() const
+			{ return mEqual; }
+
+		bool validate() const;
+		int  validate_iterator(const_iterator i) const;
+
+	protected:
+		size_t DoHash(const key_type& k) const
+			{ return Internal::FlatHashMix((size_t)mHash(k)); }
+
+		size_t DoHashValue(const value_type& value) const
+			{ return DoHash(mExtractKey(value)); }
+
+		iterator DoIteratorAt(size_t i) const
+			{ return iterator(mpCtrl + i, mpSlots + i); }
+
+		template <typename U, typename BinaryPredicate>
+		size_t DoFind(const U& u, size_t h, BinaryPredicate predicate) const; // Returns the slot index, or mnCapacity if not found.
+
+		template <typename K>
+		eastl::pair<size_t, bool> DoFindOrPrepareInsert(const K& k, size_t h);
+
+		size_t DoFindFirstNonFull(size_t h) const;
+		size_t DoPrepareInsert(size_t h);
+		void   DoCommitInsert(size_t i, size_t h);
+
+		template <typename V>
+		insert_return_type DoInsertValue(V&& value);
+
+		template <typename K, class... Args>
+		insert_return_type DoTryEmplace(K&& k, Args&&... args);
+
+		void DoEraseMetaOnly(size_t i);
+		void DoDestroySlots();
+		void DoResetCtrl();
+		void DoResetGrowthLeft()
+			{ mnGrowthLeft = (size_type)(Internal::FlatCapacityToGrowth(mnCapacity) - mnSize); }
+
+		void DoInitializeSlots(size_t nCapacity);
+		void DoFreeMemory();
+		void DoResize(size_t nNewCapacity);
+		void DoDropDeletesWithoutResize();
+		void DoRehashAndGrowIfNecessary();
+		void DoCopyFrom(const this_type& x);
+
+	}; // class flat_hashtable
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// flat_hashtable
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::flat_hashtable(size_type nCapacity, const H& hashFunction, const Eq& equal, const allocator_type& allocator)
+		: mpCtrl(const_cast<ctrl_type*>(gFlatHashtableEmptyGroup)),
+		  mpSlots(NULL),
+		  mnCapacity(0),
+		  mnSize(0),
+		  mnGrowthLeft(0),
+		  mHash(hashFunction),
+		  mEqual(equal),
+		  mExtractKey(),
+		  mAllocator(allocator)
+	{
+		if(nCapacity)
+			DoInitializeSlots(Internal::FlatNormalizeCapacity(nCapacity));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename FowardIterator>
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::flat_hashtable(FowardIterator first, FowardIterator last, size_type nCapacity,
+	                                                       const H& hashFunction, const Eq& equal, const allocator_type& allocator)
+		: mpCtrl(const_cast<ctrl_type*>(gFlatHashtableEmptyGroup)),
+		  mpSlots(NULL),
+		  mnCapacity(0),
+		  mnSize(0),
+		  mnGrowthLeft(0),
+		  mHash(hashFunction),
+		  mEqual(equal),
+		  mExtractKey(),
+		  mAllocator(allocator)
+	{
+		if(nCapacity < 2)
+			reserve((size_type)eastl::ht_distance(first, last));
+		else
+			DoInitializeSlots(Internal::FlatNormalizeCapacity(nCapacity));
+
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+		#endif
+				for(; first != last; ++first)
+					insert(*first);
+		#if EASTL_EXCEPTIONS_ENABLED
+			}
+			catch(...)
+			{
+				clear(true);
+				throw;
+			}
+		#endif
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::flat_hashtable(const this_type& x)
+		: mpCtrl(const_cast<ctrl_type*>(gFlatHashtableEmptyGroup)),
+		  mpSlots(NULL),
+		  mnCapacity(0),
+		  mnSize(0),
+		  mnGrowthLeft(0),
+		  mHash(x.mHash),
+		  mEqual(x.mEqual),
+		  mExtractKey(x.mExtractKey),
+		  mAllocator(x.mAllocator)
+	{
+		DoCopyFrom(x);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::flat_hashtable(this_type&& x)
+		: mpCtrl(x.mpCtrl),
+		  mpSlots(x.mpSlots),
+		  mnCapacity(x.mnCapacity),
+		  mnSize(x.mnSize),
+		  mnGrowthLeft(x.mnGrowthLeft),
+		  mHash(x.mHash),
+		  mEqual(x.mEqual),
+		  mExtractKey(x.mExtractKey),
+		  mAllocator(x.mAllocator)
+	{
+		x.reset_lose_memory();
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::flat_hashtable(this_type&& x, const allocator_type& allocator)
+		: mpCtrl(const_cast<ctrl_type*>(gFlatHashtableEmptyGroup)),
+		  mpSlots(NULL),
+		  mnCapacity(0),
+		  mnSize(0),
+		  mnGrowthLeft(0),
+		  mHash(x.mHash),
+		  mEqual(x.mEqual),
+		  mExtractKey(x.mExtractKey),
+		  mAllocator(allocator)
+	{
+		swap(x); // swap will directly or indirectly handle the possibility that mAllocator != x.mAllocator.
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::~flat_hashtable()
+	{
+		DoDestroySlots();
+		DoFreeMemory();
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::this_type&
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::operator=(const this_type& x)
+	{
+		if(this != &x)
+		{
+			clear();
+
+			#if EASTL_ALLOCATOR_COPY_ENABLED
+				mAllocator = x.mAllocator;
+			#endif
+
+			mHash       = x.mHash;
+			mEqual      = x.mEqual;
+			mExtractKey = x.mExtractKey;
+			DoCopyFrom(x);
+		}
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::this_type&
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::operator=(std::initializer_list<value_type> ilist)
+	{
+		// The simplest means of doing this is to clear and insert. There probably isn't a generic
+		// solution that's any more efficient without having prior knowledge of the ilist contents.
+		clear();
+		insert(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::this_type&
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::operator=(this_type&& x)
+	{
+		if(this != &x)
+		{
+			clear(true); // To consider: Are we really required to clear here? x is going away soon and will clear itself in its dtor.
+			swap(x);     // member swap handles the case that x has a different allocator than our allocator by doing a copy.
+		}
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::swap(this_type& x)
+	{
+		eastl::swap(mpCtrl, x.mpCtrl);
+		eastl::swap(mpSlots, x.mpSlots);
+		eastl::swap(mnCapacity, x.mnCapacity);
+		eastl::swap(mnSize, x.mnSize);
+		eastl::swap(mnGrowthLeft, x.mnGrowthLeft);
+		eastl::swap(mHash, x.mHash);
+		eastl::swap(mEqual, x.mEqual);
+		eastl::swap(mExtractKey, x.mExtractKey);
+
+		if(mAllocator != x.mAllocator) // If allocators are not equivalent...
+			eastl::swap(mAllocator, x.mAllocator);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename U, typename BinaryPredicate>
+	inline size_t flat_hashtable<K, V, A, EK, Eq, H, bM>::DoFind(const U& u, size_t h, BinaryPredicate predicate) const
+	{
+		const Internal::flat_h2_t h2 = Internal::FlatH2(h);
+		Internal::flat_probe_seq  seq(Internal::FlatH1(h), mnCapacity);
+
+		for(;;)
+		{
+			const group_type g(mpCtrl + seq.Offset());
+
+			for(typename group_type::bitmask_type match = g.Match(h2); match; match.ClearLowestBit())
+			{
+				const size_t i = seq.Offset((size_t)match.LowestBitSet());
+
+				if(EASTL_LIKELY(predicate(mExtractKey(mpSlots[i]), u))) // Intentionally compare with key as first arg and u as second arg.
+					return i;
+			}
+
+			if(EASTL_LIKELY(g.MatchEmpty()))
+				return mnCapacity;
+
+			seq.Next();
+			EASTL_ASSERT_MSG(seq.mIndex <= mnCapacity, "flat_hashtable: full table");
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::find(const key_type& k)
+	{
+		return DoIteratorAt(DoFind(k, DoHash(k), mEqual));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::const_iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::find(const key_type& k) const
+	{
+		return DoIteratorAt(DoFind(k, DoHash(k), mEqual));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename U, typename UHash, typename BinaryPredicate>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::find_as(const U& other, UHash uhash, BinaryPredicate predicate)
+	{
+		return DoIteratorAt(DoFind(other, Internal::FlatHashMix((size_t)uhash(other)), predicate));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename U, typename UHash, typename BinaryPredicate>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::const_iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::find_as(const U& other, UHash uhash, BinaryPredicate predicate) const
+	{
+		return DoIteratorAt(DoFind(other, Internal::FlatHashMix((size_t)uhash(other)), predicate));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename U>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::find_as(const U& other)
+	{
+		return eastl::hashtable_find(*this, other);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename U>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::const_iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::find_as(const U& other) const
+	{
+		return eastl::hashtable_find(*this, other);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline eastl::pair<typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator,
+	                   typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator>
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::equal_range(const key_type& k)
+	{
+		const iterator it = find(k);
+		return eastl::pair<iterator, iterator>(it, (it == end()) ? it : eastl::next(it));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline eastl::pair<typename flat_hashtable<K, V, A, EK, Eq, H, bM>::const_iterator,
+	                   typename flat_hashtable<K, V, A, EK, Eq, H, bM>::const_iterator>
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::equal_range(const key_type& k) const
+	{
+		const const_iterator it = find(k);
+		return eastl::pair<const_iterator, const_iterator>(it, (it == end()) ? it : eastl::next(it));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline size_t flat_hashtable<K, V, A, EK, Eq, H, bM>::DoFindFirstNonFull(size_t h) const
+	{
+		Internal::flat_probe_seq seq(Internal::FlatH1(h), mnCapacity);
+
+		for(;;)
+		{
+			const typename group_type::bitmask_type mask = group_type(mpCtrl + seq.Offset()).MatchEmptyOrDeleted();
+
+			if(mask)
+				return seq.Offset((size_t)mask.LowestBitSet());
+
+			seq.Next();
+			EASTL_ASSERT_MSG(seq.mIndex <= mnCapacity, "flat_hashtable: full table");
+		}
+	}
+
+
+	// Returns the index of the slot into which an element with hash h should be placed, growing
+	// the table if needed. The slot's control byte is left unmodified until DoCommitInsert, so
+	// that if constructing the element throws an exception the table remains unchanged.
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline size_t flat_hashtable<K, V, A, EK, Eq, H, bM>::DoPrepareInsert(size_t h)
+	{
+		size_t i = DoFindFirstNonFull(h);
+
+		if(EASTL_UNLIKELY((mnGrowthLeft == 0) && !Internal::FlatIsDeleted(mpCtrl[i])))
+		{
+			DoRehashAndGrowIfNecessary();
+			i = DoFindFirstNonFull(h);
+		}
+
+		return i;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoCommitInsert(size_t i, size_t h)
+	{
+		++mnSize;
+		mnGrowthLeft -= (size_type)Internal::FlatIsEmpty(mpCtrl[i]);
+		Internal::FlatSetCtrl(mpCtrl, mnCapacity, i, (ctrl_type)Internal::FlatH2(h));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename KeyArg>
+	eastl::pair<size_t, bool> flat_hashtable<K, V, A, EK, Eq, H, bM>::DoFindOrPrepareInsert(const KeyArg& k, size_t h)
+	{
+		const size_t i = DoFind(k, h, mEqual);
+
+		if(i != mnCapacity)
+			return eastl::pair<size_t, bool>(i, false);
+
+		return eastl::pair<size_t, bool>(DoPrepareInsert(h), true);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename Val>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::DoInsertValue(Val&& value)
+	{
+		const key_type&                 k      = mExtractKey(value);
+		const size_t                    h      = DoHash(k);
+		const eastl::pair<size_t, bool> result = DoFindOrPrepareInsert(k, h);
+
+		if(result.second)
+		{
+			::new((void*)(mpSlots + result.first)) value_type(eastl::forward<Val>(value));
+			DoCommitInsert(result.first, h);
+		}
+
+		return insert_return_type(DoIteratorAt(result.first), result.second);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename KeyArg, class... Args>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::DoTryEmplace(KeyArg&& k, Args&&... args)
+	{
+		const size_t                    h      = DoHash(k);
+		const eastl::pair<size_t, bool> result = DoFindOrPrepareInsert(k, h);
+
+		if(result.second)
+		{
+			::new((void*)(mpSlots + result.first)) value_type(piecewise_construct, eastl::forward_as_tuple(eastl::forward<KeyArg>(k)),
+			                                                  eastl::forward_as_tuple(eastl::forward<Args>(args)...));
+			DoCommitInsert(result.first, h);
+		}
+
+		return insert_return_type(DoIteratorAt(result.first), result.second);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class... Args>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::emplace(Args&&... args)
+	{
+		// We need the key in order to find the insertion slot, so we construct the value on the stack
+		// and then move it into place. To consider: detect the (key, mapped) and piecewise argument
+		// forms and avoid the temporary for them, as try_emplace does.
+		value_type value(eastl::forward<Args>(args)...);
+		return DoInsertValue(eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class... Args>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::emplace_hint(const_iterator, Args&&... args)
+	{
+		// We currently ignore the iterator argument as a hint.
+		return emplace(eastl::forward<Args>(args)...).first;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class... Args>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::try_emplace(const key_type& key, Args&&... args)
+	{
+		return DoTryEmplace(key, eastl::forward<Args>(args)...);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class... Args>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::try_emplace(key_type&& key, Args&&... args)
+	{
+		return DoTryEmplace(eastl::move(key), eastl::forward<Args>(args)...);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class... Args>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::try_emplace(const_iterator, const key_type& key, Args&&... args)
+	{
+		return DoTryEmplace(key, eastl::forward<Args>(args)...).first; // we ignore the iterator hint
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class... Args>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::try_emplace(const_iterator, key_type&& key, Args&&... args)
+	{
+		return DoTryEmplace(eastl::move(key), eastl::forward<Args>(args)...).first; // we ignore the iterator hint
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::insert(const value_type& value)
+	{
+		return DoInsertValue(value);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::insert(value_type&& otherValue)
+	{
+		return DoInsertValue(eastl::move(otherValue));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::insert(const_iterator, const value_type& value)
+	{
+		return DoInsertValue(value).first; // we ignore the iterator hint
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::insert(const_iterator, value_type&& value)
+	{
+		return DoInsertValue(eastl::move(value)).first; // we ignore the iterator hint
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline void flat_hashtable<K, V, A, EK, Eq, H, bM>::insert(std::initializer_list<value_type> ilist)
+	{
+		insert(ilist.begin(), ilist.end());
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <typename InputIterator>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::insert(InputIterator first, InputIterator last)
+	{
+		const size_type nAdd = (size_type)eastl::ht_distance(first, last);
+
+		if(nAdd > mnGrowthLeft)
+			reserve(mnSize + nAdd);
+
+		for(; first != last; ++first)
+			DoInsertValue(*first);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class M>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_or_assign(const key_type& k, M&& obj)
+	{
+		insert_return_type result = DoTryEmplace(k, eastl::forward<M>(obj));
+		if(!result.second)
+			result.first->second = eastl::forward<M>(obj);
+		return result;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class M>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_or_assign(key_type&& k, M&& obj)
+	{
+		insert_return_type result = DoTryEmplace(eastl::move(k), eastl::forward<M>(obj));
+		if(!result.second)
+			result.first->second = eastl::forward<M>(obj);
+		return result;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class M>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_or_assign(const_iterator, const key_type& k, M&& obj)
+	{
+		return insert_or_assign(k, eastl::forward<M>(obj)).first; // we ignore the iterator hint
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	template <class M>
+	inline typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::insert_or_assign(const_iterator, key_type&& k, M&& obj)
+	{
+		return insert_or_assign(eastl::move(k), eastl::forward<M>(obj)).first; // we ignore the iterator hint
+	}
+
+
+	// Marks slot i as no longer full. If the slot was never part of a full group along any probe
+	// sequence (i.e. there is an Empty slot within a group width on both sides of it) then no
+	// lookup could have probed past it, and it can go straight back to Empty. Otherwise it
+	// becomes a Deleted tombstone so that probe sequences passing through it remain intact.
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoEraseMetaOnly(size_t i)
+	{
+		--mnSize;
+
+		const size_t nIndexBefore = (i - kGroupWidth) & mnCapacity;
+		const typename group_type::bitmask_type emptyAfter  = group_type(mpCtrl + i).MatchEmpty();
+		const typename group_type::bitmask_type emptyBefore = group_type(mpCtrl + nIndexBefore).MatchEmpty();
+
+		const bool bWasNeverFull = emptyBefore && emptyAfter &&
+		                           ((size_t)(emptyAfter.TrailingZeros() + emptyBefore.LeadingZeros()) < kGroupWidth);
+
+		Internal::FlatSetCtrl(mpCtrl, mnCapacity, i, bWasNeverFull ? Internal::kFlatCtrlEmpty : Internal::kFlatCtrlDeleted);
+		mnGrowthLeft += (size_type)bWasNeverFull;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::erase(const_iterator position)
+	{
+		EASTL_ASSERT_MSG(Internal::FlatIsFull(*position.mpCtrl), "flat_hashtable::erase: invalid iterator");
+
+		const size_t i = (size_t)(position.mpCtrl - mpCtrl);
+		mpSlots[i].~value_type();
+		DoEraseMetaOnly(i);
+
+		iterator next(DoIteratorAt(i));
+		next.skip_empty_or_deleted();
+		return next;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::iterator
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::erase(const_iterator first, const_iterator last)
+	{
+		while(first != last)
+			first = erase(first);
+		return DoIteratorAt((size_t)(last.mpCtrl - mpCtrl));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	typename flat_hashtable<K, V, A, EK, Eq, H, bM>::size_type
+	flat_hashtable<K, V, A, EK, Eq, H, bM>::erase(const key_type& k)
+	{
+		const size_t i = DoFind(k, DoHash(k), mEqual);
+
+		if(i != mnCapacity)
+		{
+			mpSlots[i].~value_type();
+			DoEraseMetaOnly(i);
+			return 1;
+		}
+
+		return 0;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoDestroySlots()
+	{
+		if(!eastl::is_trivially_destructible<value_type>::value)
+		{
+			for(size_t i = 0; i < mnCapacity; ++i)
+			{
+				if(Internal::FlatIsFull(mpCtrl[i]))
+					mpSlots[i].~value_type();
+			}
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoResetCtrl()
+	{
+		memset(mpCtrl, Internal::kFlatCtrlEmpty, Internal::FlatCtrlBytes(mnCapacity));
+		mpCtrl[mnCapacity] = Internal::kFlatCtrlSentinel;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::clear()
+	{
+		if(mnCapacity)
+		{
+			DoDestroySlots();
+			DoResetCtrl();
+			mnSize = 0;
+			DoResetGrowthLeft();
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::clear(bool clearBuckets)
+	{
+		if(clearBuckets)
+		{
+			DoDestroySlots();
+			DoFreeMemory();
+			reset_lose_memory();
+		}
+		else
+			clear();
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline void flat_hashtable<K, V, A, EK, Eq, H, bM>::reset_lose_memory() EA_NOEXCEPT
+	{
+		// The reset function is a special extension function which unilaterally
+		// resets the container to an empty state without freeing the memory of
+		// the contained objects. This is useful for very quickly tearing down a
+		// container built into scratch memory.
+		mpCtrl       = const_cast<ctrl_type*>(gFlatHashtableEmptyGroup);
+		mpSlots      = NULL;
+		mnCapacity   = 0;
+		mnSize       = 0;
+		mnGrowthLeft = 0;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoInitializeSlots(size_t nCapacity)
+	{
+		EASTL_ASSERT(Internal::FlatIsValidCapacity(nCapacity));
+
+		const size_t nAllocSize = Internal::FlatAllocSize(nCapacity, sizeof(value_type), EASTL_ALIGN_OF(value_type));
+		char* const  pMemory    = (char*)allocate_memory(mAllocator, nAllocSize, EASTL_ALIGN_OF(value_type), 0);
+
+		mpCtrl     = (ctrl_type*)pMemory;
+		mpSlots    = (value_type*)(pMemory + Internal::FlatSlotOffset(nCapacity, EASTL_ALIGN_OF(value_type)));
+		mnCapacity = (size_type)nCapacity;
+		DoResetCtrl();
+		DoResetGrowthLeft();
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoFreeMemory()
+	{
+		if(mnCapacity)
+			EASTLFree(mAllocator, mpCtrl, Internal::FlatAllocSize(mnCapacity, sizeof(value_type), EASTL_ALIGN_OF(value_type)));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoResize(size_t nNewCapacity)
+	{
+		// Elements are moved to the new slot array. If value_type's move constructor can throw
+		// then an exception here leaves the container in an unspecified (but destructible) state.
+		ctrl_type* const  pOldCtrl     = mpCtrl;
+		value_type* const pOldSlots    = mpSlots;
+		const size_t      nOldCapacity = mnCapacity;
+
+		DoInitializeSlots(nNewCapacity);
+
+		for(size_t i = 0; i < nOldCapacity; ++i)
+		{
+			if(Internal::FlatIsFull(pOldCtrl[i]))
+			{
+				const size_t h = DoHashValue(pOldSlots[i]);
+				const size_t j = DoFindFirstNonFull(h);
+
+				Internal::FlatSetCtrl(mpCtrl, mnCapacity, j, (ctrl_type)Internal::FlatH2(h));
+				::new((void*)(mpSlots + j)) value_type(eastl::move(pOldSlots[i]));
+				pOldSlots[i].~value_type();
+			}
+		}
+
+		DoResetGrowthLeft();
+
+		if(nOldCapacity)
+			EASTLFree(mAllocator, pOldCtrl, Internal::FlatAllocSize(nOldCapacity, sizeof(value_type), EASTL_ALIGN_OF(value_type)));
+	}
+
+
+	// Removes all tombstones by rehashing the elements in place, without allocating any memory.
+	// The algorithm is the same as Abseil's:
+	//  - Mark all Deleted slots as Empty and all full slots as Deleted.
+	//  - For each slot now marked Deleted (i.e. each element which has yet to be placed):
+	//     - If its ideal slot (first non-full along its probe sequence) is within the same
+	//       group as where it currently is, just mark it full where it is.
+	//     - If the ideal slot is Empty, move the element there and mark the old slot Empty.
+	//     - If the ideal slot is Deleted (i.e. holds a not yet placed element), swap the two
+	//       and process the current slot again with the element that was swapped in.
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoDropDeletesWithoutResize()
+	{
+		for(size_t i = 0; i < mnCapacity; ++i)
+			mpCtrl[i] = Internal::FlatIsFull(mpCtrl[i]) ? Internal::kFlatCtrlDeleted : Internal::kFlatCtrlEmpty;
+		memcpy(mpCtrl + mnCapacity + 1, mpCtrl, Internal::FlatNumClonedBytes());
+		mpCtrl[mnCapacity] = Internal::kFlatCtrlSentinel;
+
+		for(size_t i = 0; i < mnCapacity; ++i)
+		{
+			if(!Internal::FlatIsDeleted(mpCtrl[i]))
+				continue;
+
+			const size_t h       = DoHashValue(mpSlots[i]);
+			const size_t nTarget = DoFindFirstNonFull(h);
+			const size_t nOffset = Internal::flat_probe_seq(Internal::FlatH1(h), mnCapacity).Offset();
+
+			if((((nTarget - nOffset) & mnCapacity) / kGroupWidth) == (((i - nOffset) & mnCapacity) / kGroupWidth))
+			{
+				Internal::FlatSetCtrl(mpCtrl, mnCapacity, i, (ctrl_type)Internal::FlatH2(h));
+				continue;
+			}
+
+			if(Internal::FlatIsEmpty(mpCtrl[nTarget]))
+			{
+				Internal::FlatSetCtrl(mpCtrl, mnCapacity, nTarget, (ctrl_type)Internal::FlatH2(h));
+				::new((void*)(mpSlots + nTarget)) value_type(eastl::move(mpSlots[i]));
+				mpSlots[i].~value_type();
+				Internal::FlatSetCtrl(mpCtrl, mnCapacity, i, Internal::kFlatCtrlEmpty);
+			}
+			else
+			{
+				EASTL_ASSERT(Internal::FlatIsDeleted(mpCtrl[nTarget]));
+				Internal::FlatSetCtrl(mpCtrl, mnCapacity, nTarget, (ctrl_type)Internal::FlatH2(h));
+
+				value_type temp(eastl::move(mpSlots[i]));
+				mpSlots[i].~value_type();
+				::new((void*)(mpSlots + i)) value_type(eastl::move(mpSlots[nTarget]));
+				mpSlots[nTarget].~value_type();
+				::new((void*)(mpSlots + nTarget)) value_type(eastl::move(temp));
+				--i; // Repeat processing of the ith slot, which now holds the element which was at nTarget.
+			}
+		}
+
+		DoResetGrowthLeft();
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoRehashAndGrowIfNecessary()
+	{
+		const bool bHasDeleted = (mnSize < Internal::FlatCapacityToGrowth(mnCapacity));
+
+		if(mnCapacity == 0)
+			DoResize(1);
+		else if(bHasDeleted && (!flat_hashtable_can_grow<allocator_type>::value || ((mnCapacity > kGroupWidth) && ((uint64_t)mnSize * 32 <= (uint64_t)mnCapacity * 25))))
+			DoDropDeletesWithoutResize(); // At least ~1/8 of the slots are tombstones; reclaim them instead of growing.
+		else
+			DoResize((mnCapacity * 2) + 1);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::rehash(size_type nCapacity)
+	{
+		if((nCapacity == 0) && (mnSize == 0))
+		{
+			if(mnCapacity)
+				clear(true);
+			return;
+		}
+
+		const size_t nNewCapacity = Internal::FlatNormalizeCapacity(eastl::max_alt((size_t)nCapacity, Internal::FlatGrowthToLowerboundCapacity(mnSize)));
+
+		// We never shrink the slot array here, as that would require a second allocation to exist alongside
+		// the current one, which isn't possible for fixed-size containers. We do however drop any tombstones.
+		if(nNewCapacity > mnCapacity)
+			DoResize(nNewCapacity);
+		else if(mnSize != (Internal::FlatCapacityToGrowth(mnCapacity) - mnGrowthLeft))
+			DoDropDeletesWithoutResize();
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::reserve(size_type nElementCount)
+	{
+		if(nElementCount > (mnSize + mnGrowthLeft))
+		{
+			const size_t nNewCapacity = Internal::FlatNormalizeCapacity(Internal::FlatGrowthToLowerboundCapacity(nElementCount));
+			DoResize(nNewCapacity);
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	void flat_hashtable<K, V, A, EK, Eq, H, bM>::DoCopyFrom(const this_type& x)
+	{
+		// We know all keys of x are unique, so we can skip the key comparisons that insert would do.
+		reserve(x.mnSize);
+
+		for(size_t i = 0; i < x.mnCapacity; ++i)
+		{
+			if(Internal::FlatIsFull(x.mpCtrl[i]))
+			{
+				const size_t h = DoHashValue(x.mpSlots[i]);
+				const size_t j = DoFindFirstNonFull(h);
+
+				::new((void*)(mpSlots + j)) value_type(x.mpSlots[i]);
+				DoCommitInsert(j, h);
+			}
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	bool flat_hashtable<K, V, A, EK, Eq, H, bM>::validate() const
+	{
+		if(mnCapacity == 0)
+			return (mnSize == 0) && (mnGrowthLeft == 0) && (mpCtrl == gFlatHashtableEmptyGroup);
+
+		if(!Internal::FlatIsValidCapacity(mnCapacity) || (mpCtrl[mnCapacity] != Internal::kFlatCtrlSentinel))
+			return false;
+
+		// Verify the cloned control bytes. Clones past the end of a small table are always Empty.
+		for(size_t i = 0; i < Internal::FlatNumClonedBytes(); ++i)
+		{
+			if(mpCtrl[mnCapacity + 1 + i] != ((i < mnCapacity) ? mpCtrl[i] : Internal::kFlatCtrlEmpty))
+				return false;
+		}
+
+		size_type nFull = 0, nDeleted = 0;
+
+		for(size_t i = 0; i < mnCapacity; ++i)
+		{
+			if(Internal::FlatIsFull(mpCtrl[i]))
+			{
+				const size_t h = DoHashValue(mpSlots[i]);
+
+				// Verify the H2 value and that the element can be found by a lookup.
+				if((mpCtrl[i] != (ctrl_type)Internal::FlatH2(h)) || (DoFind(mExtractKey(mpSlots[i]), h, mEqual) != i))
+					return false;
+
+				++nFull;
+			}
+			else if(Internal::FlatIsDeleted(mpCtrl[i]))
+				++nDeleted;
+			else if(!Internal::FlatIsEmpty(mpCtrl[i]))
+				return false;
+		}
+
+		if(nFull != mnSize)
+			return false;
+
+		if((mnSize + mnGrowthLeft + nDeleted) != Internal::FlatCapacityToGrowth(mnCapacity))
+			return false;
+
+		return true;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	int flat_hashtable<K, V, A, EK, Eq, H, bM>::validate_iterator(const_iterator i) const
+	{
+		if(i.mpCtrl == (mpCtrl + mnCapacity))
+			return (isf_valid | isf_current);
+
+		if((i.mpCtrl >= mpCtrl) && (i.mpCtrl < (mpCtrl + mnCapacity)) && Internal::FlatIsFull(*i.mpCtrl))
+			return (isf_valid | isf_current | isf_can_dereference);
+
+		return isf_none;
+	}
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	// Two flat_hashtables are equal if they hold the same set of elements, regardless of order.
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline bool operator==(const flat_hashtable<K, V, A, EK, Eq, H, bM>& a,
+	                       const flat_hashtable<K, V, A, EK, Eq, H, bM>& b)
+	{
+		typedef typename flat_hashtable<K, V, A, EK, Eq, H, bM>::const_iterator const_iterator;
+
+		if(a.size() != b.size())
+			return false;
+
+		EK extractKey;
+
+		for(const_iterator ai = a.begin(), aiEnd = a.end(); ai != aiEnd; ++ai)
+		{
+			const const_iterator bi = b.find(extractKey(*ai));
+
+			if((bi == b.end()) || !(*ai == *bi))
+				return false;
+		}
+
+		return true;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline bool operator!=(const flat_hashtable<K, V, A, EK, Eq, H, bM>& a,
+	                       const flat_hashtable<K, V, A, EK, Eq, H, bM>& b)
+	{
+		return !(a == b);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq, typename H, bool bM>
+	inline void swap(flat_hashtable<K, V, A, EK, Eq, H, bM>& a,
+	                 flat_hashtable<K, V, A, EK, Eq, H, bM>& b)
+	{
+		a.swap(b);
+	}
+
+
+} // namespace eastl
+
+
+EA_RESTORE_VC_WARNING();
+
+
+#endif // Header include guard
@@ -177,6 +177,8 @@ namespace eastl
 	template <>
 	struct less<void>
 	{
+		typedef int is_transparent;
+
 		template<typename A, typename B>
 		EA_CPP14_CONSTEXPR auto operator()(A&& a, B&& b) const
 			-> decltype(eastl::forward<A>(a) < eastl::forward<B>(b))
@@ -184,6 +186,51 @@ namespace eastl
 	};
 
 
+	namespace Internal
+	{
+		/// has_is_transparent
+		///
+		/// Is true_type if T defines the member type is_transparent. This is the C++14
+		/// convention by which a comparison or hash function object (e.g. less<void>)
+		/// declares that it accepts arguments of types other than the container key type.
+		/// The associative containers enable their heterogeneous lookup functions
+		/// (find, count, equal_range, contains, erase) based on this.
+		///
+		template <typename T>
+		struct has_is_transparent
+		{
+		private:
+			template <typename U> static eastl::yes_type test(typename U::is_transparent*);
+			template <typename U> static eastl::no_type  test(...);
+
+		public:
+			static const bool value = (sizeof(test<T>(0)) == sizeof(eastl::yes_type));
+		};
+
+		/// enable_if_transparent
+		///
+		/// Has the member type 'type' (equal to Result) only if Compare is transparent.
+		/// The container functions which take a key of arbitrary type U use it in their
+		/// return types, with Compare defaulted from the container's comparison type:
+		///     template <typename U, typename C = Compare>
+		///     typename Internal::enable_if_transparent<C, iterator>::type find(const U& u);
+		///
+		template <typename Compare, typename Result = void>
+		struct enable_if_transparent : public eastl::enable_if<has_is_transparent<Compare>::value, Result> {};
+
+		/// enable_if_transparent_erase
+		///
+		/// As enable_if_transparent, but additionally disabled if U is convertible to one of
+		/// the iterator types of Container, so that erase(iterator) is unaffected.
+		///
+		template <typename Compare, typename U, typename Container, typename Result>
+		struct enable_if_transparent_erase
+			: public eastl::enable_if<has_is_transparent<Compare>::value &&
+			                          !eastl::is_convertible<U, typename Container::const_iterator>::value &&
+			                          !eastl::is_convertible<U, typename Container::const_reverse_iterator>::value, Result> {};
+	}
+
+
 	/// reference_wrapper
 	template <typename T>
 	class reference_wrapper
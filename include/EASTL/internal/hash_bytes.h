@@ -0,0 +1,187 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements the byte hash which EASTL uses for strings, string
+// views and character pointers (see eastl::hash and eastl::string_hash).
+//
+// The algorithm follows the design of wyhash: input is consumed 16 bytes
+// per step (48 bytes per step in three independent lanes for long inputs),
+// and each step is a single 64x64->128 bit multiply whose halves are folded
+// together. Inputs of 16 bytes or less are handled with at most four
+// unaligned loads and no loop. The length is mixed into the result, so
+// strings with embedded NUL characters hash correctly.
+//
+// The hash values are not the same across 32 and 64 bit platforms or across
+// endiannesses, nor are they guaranteed to be stable across EASTL versions.
+// Users who persist hash values should define EASTL_STRING_HASH_LEGACY to 1,
+// which makes eastl::hash use the FNV-1 hash of previous EASTL versions.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_HASH_BYTES_H
+#define EASTL_INTERNAL_HASH_BYTES_H
+
+
+#include <EASTL/internal/config.h>
+#include <string.h> // memcpy, strlen
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <intrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+	namespace Internal
+	{
+		static const uint64_t kHashSecret0 = UINT64_C(0xa0761d6478bd642f);
+		static const uint64_t kHashSecret1 = UINT64_C(0xe7037ed1a0b428db);
+		static const uint64_t kHashSecret2 = UINT64_C(0x8ebc6af09c88c6e3);
+		static const uint64_t kHashSecret3 = UINT64_C(0x589965cc75374cc3);
+
+
+		// HashMultiply
+		//
+		// Computes the full 128 bit product of a and b, and returns the low
+		// half in a and the high half in b.
+		//
+		EA_FORCE_INLINE void HashMultiply(uint64_t& a, uint64_t& b)
+		{
+			#if defined(__SIZEOF_INT128__)
+				__uint128_t r = a;
+				r *= b;
+				a = (uint64_t)r;
+				b = (uint64_t)(r >> 64);
+			#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+				a = _umul128(a, b, &b);
+			#else
+				const uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+				const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+				const uint64_t t  = rl + (rm0 << 32);
+				uint64_t       c  = (t < rl) ? 1 : 0;
+				const uint64_t lo = t + (rm1 << 32);
+				c += (lo < t) ? 1 : 0;
+				a = lo;
+				b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+			#endif
+		}
+
+		EA_FORCE_INLINE uint64_t HashMix(uint64_t a, uint64_t b)
+		{
+			HashMultiply(a, b);
+			return a ^ b;
+		}
+
+		EA_FORCE_INLINE uint64_t HashRead8(const uint8_t* p)
+			{ uint64_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+		EA_FORCE_INLINE uint64_t HashRead4(const uint8_t* p)
+			{ uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+		EA_FORCE_INLINE uint64_t HashRead3(const uint8_t* p, size_t n) // 1 <= n <= 3
+			{ return ((uint64_t)p[0] << 16) | ((uint64_t)p[n >> 1] << 8) | p[n - 1]; }
+
+
+		/// HashBytes
+		///
+		/// Returns a hash of the n bytes at pData.
+		///
+		inline size_t HashBytes(const void* pData, size_t n)
+		{
+			const uint8_t* p    = (const uint8_t*)pData;
+			uint64_t       seed = HashMix(kHashSecret0, kHashSecret1);
+			uint64_t       a, b;
+
+			if(EASTL_LIKELY(n <= 16))
+			{
+				if(n >= 4)
+				{
+					const size_t offset = (n >> 3) << 2; // 0 for n < 8 and 4 for n >= 8, such that the four loads cover all n bytes.
+					a = (HashRead4(p) << 32) | HashRead4(p + offset);
+					b = (HashRead4(p + n - 4) << 32) | HashRead4(p + n - 4 - offset);
+				}
+				else if(n > 0)
+				{
+					a = HashRead3(p, n);
+					b = 0;
+				}
+				else
+					a = b = 0;
+			}
+			else
+			{
+				size_t i = n;
+
+				if(EASTL_UNLIKELY(i > 48))
+				{
+					uint64_t seed1 = seed, seed2 = seed;
+
+					do {
+						seed  = HashMix(HashRead8(p)      ^ kHashSecret1, HashRead8(p + 8)  ^ seed);
+						seed1 = HashMix(HashRead8(p + 16) ^ kHashSecret2, HashRead8(p + 24) ^ seed1);
+						seed2 = HashMix(HashRead8(p + 32) ^ kHashSecret3, HashRead8(p + 40) ^ seed2);
+						p += 48;
+						i -= 48;
+					} while(i > 48);
+
+					seed ^= seed1 ^ seed2;
+				}
+
+				while(i > 16)
+				{
+					seed = HashMix(HashRead8(p) ^ kHashSecret1, HashRead8(p + 8) ^ seed);
+					p += 16;
+					i -= 16;
+				}
+
+				a = HashRead8(p + i - 16); // The final (overlapping) 16 bytes.
+				b = HashRead8(p + i - 8);
+			}
+
+			a ^= kHashSecret1;
+			b ^= seed;
+			HashMultiply(a, b);
+			return (size_t)HashMix(a ^ kHashSecret0 ^ (uint64_t)n, b ^ kHashSecret1);
+		}
+
+
+		/// HashString
+		///
+		/// Returns HashBytes of the characters of a string, given either its
+		/// length or (for the single argument version) a NUL-terminated string.
+		///
+		template <typename T>
+		inline size_t HashString(const T* p, size_t n)
+		{
+			return HashBytes(p, n * sizeof(T));
+		}
+
+		template <typename T>
+		inline size_t HashString(const T* p)
+		{
+			const T* pEnd = p;
+			while(*pEnd)
+				++pEnd;
+			return HashBytes(p, (size_t)(pEnd - p) * sizeof(T));
+		}
+
+		inline size_t HashString(const char* p)
+		{
+			return HashBytes(p, strlen(p));
+		}
+
+	} // namespace Internal
+
+} // namespace eastl
+
+
+#endif // Header include guard
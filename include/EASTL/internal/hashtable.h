@@ -39,8 +39,11 @@
 #include <EASTL/functional.h>
 #include <EASTL/utility.h>
 #include <EASTL/algorithm.h>
+#include <EASTL/bit.h>
 #include <EASTL/initializer_list.h>
 #include <EASTL/tuple.h>
+#include <EASTL/span.h>
+#include <EASTL/internal/node_handle.h>
 #include <string.h>
 
 EA_DISABLE_ALL_VC_WARNINGS()
@@ -74,6 +77,23 @@ namespace eastl
 		#define EASTL_HASHTABLE_DEFAULT_ALLOCATOR allocator_type(EASTL_HASHTABLE_DEFAULT_NAME)
 	#endif
 
+
+	/// EASTL_HASHTABLE_STATS
+	///
+	/// Defined as 0 or 1. When enabled, hashtable and intrusive_hashtable (and thus
+	/// hash_map, hash_set, fixed_hash_map, intrusive_hash_map, etc.) count lookups,
+	/// probes, key comparisons and rehashes per container instance, and provide
+	/// get_stats and reset_stats. This costs a few increments per lookup and is
+	/// meant for diagnosing poor hash functions; it is disabled by default.
+	///
+	/// The counters are plain integers which const lookups such as find and count
+	/// update. Thus with stats enabled, concurrent const access to a container from
+	/// several threads is a data race, unlike in the default configuration.
+	///
+	#ifndef EASTL_HASHTABLE_STATS
+		#define EASTL_HASHTABLE_STATS 0
+	#endif
+
 	
 	/// kHashtableAllocFlagBuckets
 	/// Flag to allocator which indicates that we are allocating buckets and not nodes.
@@ -89,6 +109,89 @@ namespace eastl
 	extern EASTL_API void* gpEmptyBucketArray[2];
 
 
+	/// hashtable_stats_counters
+	///
+	/// Event counters kept by each hashtable instance when EASTL_HASHTABLE_STATS is enabled.
+	/// A lookup is any search of a bucket chain for a key, which includes those done by
+	/// insert, erase and count. A probe is a visit of one node of the chain.
+	///
+	struct hashtable_stats_counters
+	{
+		uint64_t mnLookupCount;
+		uint64_t mnProbeCount;
+		uint64_t mnKeyCompareCount;      // Calls to the key equality function.
+		uint64_t mnHashCodeRejectCount;  // Probes rejected by the cached hash code without calling the equality function. Always 0 unless bCacheHashCode is true.
+		uint64_t mnRehashCount;
+
+		hashtable_stats_counters()
+			{ reset_counters(); }
+
+		void reset_counters()
+			{ mnLookupCount = mnProbeCount = mnKeyCompareCount = mnHashCodeRejectCount = mnRehashCount = 0; }
+	};
+
+
+	/// hashtable_stats
+	///
+	/// The counters of a hashtable instance plus a snapshot of the shape of its bucket
+	/// array, as returned by hashtable::get_stats. A good hash function gives a chain
+	/// length histogram close to a Poisson distribution with a mean of the load factor;
+	/// a long tail or a high average probe count indicates a poor one.
+	///
+	/// Example usage:
+	///     #define EASTL_HASHTABLE_STATS 1 // Typically done globally in the project's config.
+	///     hash_map<Widget, int, WidgetHash> widgetMap;
+	///     ...
+	///     char buffer[1024];
+	///     format_hashtable_stats(widgetMap.get_stats(), buffer, sizeof(buffer));
+	///     printf("%s", buffer);
+	///
+	struct hashtable_stats : public hashtable_stats_counters
+	{
+		enum { kChainLengthHistogramSize = 16 };
+
+		size_t mnElementCount;
+		size_t mnBucketCount;
+		size_t mnUsedBucketCount;                                 // Number of non-empty buckets.
+		size_t mnMaxChainLength;
+		size_t mChainLengthHistogram[kChainLengthHistogramSize];  // Number of buckets with a chain of i nodes. The last entry also counts all longer chains.
+
+		hashtable_stats()
+			: mnElementCount(0), mnBucketCount(0), mnUsedBucketCount(0), mnMaxChainLength(0)
+			{ memset(mChainLengthHistogram, 0, sizeof(mChainLengthHistogram)); }
+
+		void add_chain(size_t nChainLength)
+		{
+			mnElementCount += nChainLength;
+			mnBucketCount++;
+			if(nChainLength)
+				mnUsedBucketCount++;
+			if(nChainLength > mnMaxChainLength)
+				mnMaxChainLength = nChainLength;
+			mChainLengthHistogram[(nChainLength < kChainLengthHistogramSize) ? nChainLength : (kChainLengthHistogramSize - 1)]++;
+		}
+
+		float load_factor() const
+			{ return mnBucketCount ? ((float)mnElementCount / (float)mnBucketCount) : 0.f; }
+
+		float average_probe_count() const
+			{ return mnLookupCount ? ((float)mnProbeCount / (float)mnLookupCount) : 0.f; }
+
+		float average_key_compare_count() const
+			{ return mnLookupCount ? ((float)mnKeyCompareCount / (float)mnLookupCount) : 0.f; }
+	};
+
+
+	/// format_hashtable_stats
+	///
+	/// Writes a human-readable report of the given stats, including the chain length
+	/// histogram, to the given buffer. The output is always 0-terminated unless the
+	/// capacity is 0. Returns the number of characters the full report requires,
+	/// not including the terminating 0, in the manner of snprintf.
+	///
+	EASTL_API size_t format_hashtable_stats(const hashtable_stats& stats, char* pBuffer, size_t nBufferCapacity);
+
+
 	/// EASTL_MACRO_SWAP
 	///
 	/// Use EASTL_MACRO_SWAP because GCC (at least v4.6-4.8) has a bug where it fails to compile eastl::swap(mpBucketArray, x.mpBucketArray).
@@ -173,6 +276,13 @@ namespace eastl
 	#define ENABLE_IF_TRUETYPE(T) typename eastl::enable_if<T::value>::type*
 	#define DISABLE_IF_TRUETYPE(T) typename eastl::enable_if<!T::value>::type*
 
+	// convenience macros for the heterogeneous lookup functions, which are enabled only if both the
+	// hash function and the key equality predicate are transparent. The erase version additionally
+	// rejects U types that are convertible to an iterator, such that erase(iterator) is unaffected.
+	#define ENABLE_IF_TRANSPARENT(HashT, EqualT, ...) typename eastl::enable_if<Internal::has_is_transparent<HashT>::value && Internal::has_is_transparent<EqualT>::value, __VA_ARGS__>::type
+	#define ENABLE_IF_TRANSPARENT_ERASE(HashT, EqualT, U, RT) typename eastl::enable_if<Internal::has_is_transparent<HashT>::value && Internal::has_is_transparent<EqualT>::value && \
+	                                                                                   !eastl::is_convertible<U, iterator>::value && !eastl::is_convertible<U, const_iterator>::value, RT>::type
+
 
 	/// node_iterator_base
 	///
@@ -250,25 +360,30 @@ namespace eastl
 	/// We define a base class here because it is shared by both const and
 	/// non-const iterators.
 	///
-	template <typename Value, bool bCacheHashCode>
+	/// bLinkedBuckets is true for hashtables with an incremental_rehash_policy.
+	/// While such a hashtable is migrating its nodes, the sentinel of the old
+	/// bucket array is a tagged pointer to the new one, and iteration continues
+	/// from the end of the old array into the new one.
+	///
+	template <typename Value, bool bCacheHashCode, bool bLinkedBuckets = false>
 	struct hashtable_iterator_base
 	{
 	public:
-		typedef hashtable_iterator_base<Value, bCacheHashCode> this_type;
-		typedef hash_node<Value, bCacheHashCode>               node_type;
+		typedef hashtable_iterator_base<Value, bCacheHashCode, bLinkedBuckets> this_type;
+		typedef hash_node<Value, bCacheHashCode>                               node_type;
 
 	protected:
 		template <typename, typename, typename, typename, typename, typename, typename, typename, typename, bool, bool, bool>
 		friend class hashtable;
 
-		template <typename, bool, bool>
+		template <typename, bool, bool, bool>
 		friend struct hashtable_iterator;
 
-		template <typename V, bool b>
-		friend bool operator==(const hashtable_iterator_base<V, b>&, const hashtable_iterator_base<V, b>&);
+		template <typename V, bool b, bool bL>
+		friend bool operator==(const hashtable_iterator_base<V, b, bL>&, const hashtable_iterator_base<V, b, bL>&);
 
-		template <typename V, bool b>
-		friend bool operator!=(const hashtable_iterator_base<V, b>&, const hashtable_iterator_base<V, b>&);
+		template <typename V, bool b, bool bL>
+		friend bool operator!=(const hashtable_iterator_base<V, b, bL>&, const hashtable_iterator_base<V, b, bL>&);
 
 		node_type*  mpNode;      // Current node within current bucket.
 		node_type** mpBucket;    // Current bucket.
@@ -283,6 +398,9 @@ namespace eastl
 			while(*mpBucket == NULL) // We store an extra bucket with some non-NULL value at the end 
 				++mpBucket;          // of the bucket array so that finding the end of the bucket
 			mpNode = *mpBucket;      // array is quick and simple.
+
+			if(bLinkedBuckets)
+				follow_bucket_link();
 		}
 
 		void increment()
@@ -291,6 +409,22 @@ namespace eastl
 
 			while(mpNode == NULL)
 				mpNode = *++mpBucket;
+
+			if(bLinkedBuckets)
+				follow_bucket_link();
+		}
+
+		void follow_bucket_link()
+		{
+			// The end sentinel is ~0 and node pointers are at least pointer-aligned, so any 
+			// other value with the low bit set is the link to the next bucket array.
+			if(((uintptr_t)mpNode & 1) && ((uintptr_t)mpNode != (uintptr_t)~0))
+			{
+				mpBucket = reinterpret_cast<node_type**>((uintptr_t)mpNode & ~(uintptr_t)1);
+				while(*mpBucket == NULL)
+					++mpBucket;
+				mpNode = *mpBucket;
+			}
 		}
 
 	}; // hashtable_iterator_base
@@ -308,13 +442,13 @@ namespace eastl
 	/// The bConst parameter defines if the iterator is a const_iterator
 	/// or an iterator.
 	///
-	template <typename Value, bool bConst, bool bCacheHashCode>
-	struct hashtable_iterator : public hashtable_iterator_base<Value, bCacheHashCode>
+	template <typename Value, bool bConst, bool bCacheHashCode, bool bLinkedBuckets = false>
+	struct hashtable_iterator : public hashtable_iterator_base<Value, bCacheHashCode, bLinkedBuckets>
 	{
 	public:
-		typedef hashtable_iterator_base<Value, bCacheHashCode>           base_type;
-		typedef hashtable_iterator<Value, bConst, bCacheHashCode>        this_type;
-		typedef hashtable_iterator<Value, false, bCacheHashCode>         this_type_non_const;
+		typedef hashtable_iterator_base<Value, bCacheHashCode, bLinkedBuckets>    base_type;
+		typedef hashtable_iterator<Value, bConst, bCacheHashCode, bLinkedBuckets> this_type;
+		typedef hashtable_iterator<Value, false, bCacheHashCode, bLinkedBuckets>  this_type_non_const;
 		typedef typename base_type::node_type                            node_type;
 		typedef Value                                                    value_type;
 		typedef typename type_select<bConst, const Value*, Value*>::type pointer;
@@ -397,6 +531,28 @@ namespace eastl
 	};
 
 
+	/// mask_range_hashing
+	///
+	/// Implements the algorithm for conversion of a number in the range of
+	/// [0, SIZE_T_MAX] to the range of [0, BucketCount) for a power of two
+	/// BucketCount. A plain mask would use only the low bits of the hash code,
+	/// and a number of hash functions (e.g. eastl::hash for integers and
+	/// pointers) put little or no entropy there. So we first multiply by the
+	/// 64 bit golden ratio and fold the high half of the product into the low
+	/// half, which leaves every bit of the result dependent on every bit of
+	/// the input. This costs one multiply instead of the division done by
+	/// mod_range_hashing.
+	///
+	struct mask_range_hashing
+	{
+		uint32_t operator()(size_t r, uint32_t n) const
+		{
+			const uint64_t h = (uint64_t)r * UINT64_C(0x9E3779B97F4A7C15);
+			return (uint32_t)(h ^ (h >> 32)) & (n - 1);
+		}
+	};
+
+
 	/// default_ranged_hash
 	///
 	/// Default ranged hash function H. In principle it should be a
@@ -455,6 +611,117 @@ namespace eastl
 
 
 
+	/// power_of_two_rehash_policy
+	///
+	/// Alternative rehash policy which keeps the bucket count at a power of two.
+	/// It is meant to be used together with mask_range_hashing, which is what
+	/// rehash_policy_traits selects for it, and which removes the integer
+	/// division that prime_rehash_policy requires on every lookup. The
+	/// trade-off is that the quality of the bucket distribution now depends
+	/// on the mixing done by mask_range_hashing rather than on the modulus,
+	/// and that the table grows in steps of 2x (rather than ~8%) when a
+	/// bucket count is requested explicitly. hashtable::rehash rounds its
+	/// argument up to a power of two for mask_range_hashing, so policies
+	/// derived from this one are covered as well.
+	///
+	/// Example usage:
+	///     hash_map<int, int, hash<int>, equal_to<int>, EASTLAllocatorType, false, power_of_two_rehash_policy> hashMap;
+	///
+	struct EASTL_API power_of_two_rehash_policy
+	{
+	public:
+		float            mfMaxLoadFactor;
+		float            mfGrowthFactor;
+		mutable uint32_t mnNextResize;
+
+	public:
+		power_of_two_rehash_policy(float fMaxLoadFactor = 1.f)
+			: mfMaxLoadFactor(fMaxLoadFactor), mfGrowthFactor(2.f), mnNextResize(0) { }
+
+		float GetMaxLoadFactor() const
+			{ return mfMaxLoadFactor; }
+
+		/// Return a bucket count no greater than nBucketCountHint, 
+		/// Don't update member variables while at it.
+		static uint32_t GetPrevBucketCountOnly(uint32_t nBucketCountHint);
+
+		/// Return a bucket count no greater than nBucketCountHint.
+		/// This function has a side effect of updating mnNextResize.
+		uint32_t GetPrevBucketCount(uint32_t nBucketCountHint) const;
+
+		/// Return a bucket count no smaller than nBucketCountHint.
+		/// This function has a side effect of updating mnNextResize.
+		uint32_t GetNextBucketCount(uint32_t nBucketCountHint) const;
+
+		/// Return a bucket count appropriate for nElementCount elements.
+		/// This function has a side effect of updating mnNextResize.
+		uint32_t GetBucketCount(uint32_t nElementCount) const;
+
+		/// nBucketCount is current bucket count, nElementCount is current element count,
+		/// and nElementAdd is number of elements to be inserted. Do we need 
+		/// to increase bucket count? If so, return pair(true, n), where 
+		/// n is the new bucket count. If not, return pair(false, 0).
+		eastl::pair<bool, uint32_t>
+		GetRehashRequired(uint32_t nBucketCount, uint32_t nElementCount, uint32_t nElementAdd) const;
+	};
+
+
+	/// incremental_rehash_policy
+	///
+	/// Rehash policy which chooses the same bucket counts as prime_rehash_policy,
+	/// but with which hashtable spreads the cost of growing over the insertions
+	/// that follow, instead of moving every node at once. When an insertion
+	/// pushes the load factor over its maximum, the hashtable allocates the new
+	/// bucket array but keeps the old one, and every subsequent insertion moves
+	/// the nodes of the next mnMigrateBucketCount old buckets to the new array
+	/// until the old array is empty and can be freed. This bounds the time taken
+	/// by any single insertion, which matters for large tables in frame-based
+	/// code, at the cost of lookups checking which array holds a key's bucket
+	/// while a migration is in progress.
+	///
+	/// While a migration is in progress, insertions invalidate iterators (but not
+	/// pointers or references to elements), as they may move nodes. Lookups and
+	/// erasures don't move nodes. The bucket interface (begin(n), bucket_size(n)
+	/// and so on) describes only the new bucket array. rehash and reserve complete
+	/// any migration in progress.
+	///
+	/// Example usage:
+	///     hash_map<int, int, hash<int>, equal_to<int>, EASTLAllocatorType, false, incremental_rehash_policy> hashMap;
+	///
+	struct incremental_rehash_policy : public prime_rehash_policy
+	{
+	public:
+		uint32_t mnMigrateBucketCount; // The number of old buckets whose nodes each insertion moves.
+
+	public:
+		incremental_rehash_policy(float fMaxLoadFactor = 1.f, uint32_t nMigrateBucketCount = 4)
+			: prime_rehash_policy(fMaxLoadFactor), mnMigrateBucketCount(nMigrateBucketCount) { }
+	};
+
+
+	/// rehash_policy_traits
+	///
+	/// Maps a rehash policy to the range-hashing function (the H2 template 
+	/// parameter of hashtable) which hash_map, hash_set and their fixed 
+	/// variants use with it. User-defined policies get mod_range_hashing 
+	/// unless they specialize this.
+	///
+	template <typename RehashPolicy>
+	struct rehash_policy_traits
+	{
+		typedef mod_range_hashing range_hashing_type;
+	};
+
+	template <>
+	struct rehash_policy_traits<power_of_two_rehash_policy>
+	{
+		typedef mask_range_hashing range_hashing_type;
+	};
+
+
+
+
+
 	///////////////////////////////////////////////////////////////////////
 	// Base classes for hashtable. We define these base classes because 
 	// in some cases we want to do different things depending on the 
@@ -470,7 +737,7 @@ namespace eastl
 	/// rehash_base
 	///
 	/// Give hashtable the get_max_load_factor functions if the rehash 
-	/// policy is prime_rehash_policy.
+	/// policy is prime_rehash_policy or power_of_two_rehash_policy.
 	///
 	template <typename RehashPolicy, typename Hashtable>
 	struct rehash_base { };
@@ -495,6 +762,87 @@ namespace eastl
 		}
 	};
 
+	template <typename Hashtable>
+	struct rehash_base<power_of_two_rehash_policy, Hashtable>
+	{
+		float get_max_load_factor() const
+		{
+			const Hashtable* const pThis = static_cast<const Hashtable*>(this);
+			return pThis->rehash_policy().GetMaxLoadFactor();
+		}
+
+		void set_max_load_factor(float fMaxLoadFactor)
+		{
+			Hashtable* const pThis = static_cast<Hashtable*>(this);
+			pThis->rehash_policy(power_of_two_rehash_policy(fMaxLoadFactor));
+		}
+	};
+
+	template <typename Hashtable>
+	struct rehash_base<incremental_rehash_policy, Hashtable>
+	{
+		float get_max_load_factor() const
+		{
+			const Hashtable* const pThis = static_cast<const Hashtable*>(this);
+			return pThis->rehash_policy().GetMaxLoadFactor();
+		}
+
+		void set_max_load_factor(float fMaxLoadFactor)
+		{
+			Hashtable* const pThis = static_cast<Hashtable*>(this);
+			pThis->rehash_policy(incremental_rehash_policy(fMaxLoadFactor, pThis->rehash_policy().mnMigrateBucketCount));
+		}
+	};
+
+
+	/// incremental_rehash_base
+	///
+	/// Holds the bucket array which a hashtable with an incremental_rehash_policy
+	/// is moving its nodes out of. For other policies it holds nothing, and its
+	/// accessors return constants which let the compiler remove the code that
+	/// handles a migration in progress.
+	///
+	template <typename RehashPolicy, typename Node>
+	struct incremental_rehash_base
+	{
+		static const bool kIncrementalRehash = false;
+
+		Node**       GetOldBucketArray() const { return NULL; }
+		eastl_size_t GetOldBucketCount() const { return 0; }
+		eastl_size_t GetMigrateIndex() const   { return 0; }
+		void         SetMigration(Node**, eastl_size_t, eastl_size_t) { }
+
+		static uint32_t GetMigrateBucketCount(const RehashPolicy&)
+			{ return 0; }
+	};
+
+	template <typename Node>
+	struct incremental_rehash_base<incremental_rehash_policy, Node>
+	{
+		static const bool kIncrementalRehash = true;
+
+		Node**       mpOldBucketArray;  // The bucket array being migrated from, or NULL if no migration is in progress.
+		eastl_size_t mnOldBucketCount;
+		eastl_size_t mnMigrateIndex;    // The buckets of mpOldBucketArray below this index have been migrated and are empty.
+
+		incremental_rehash_base()
+			: mpOldBucketArray(NULL), mnOldBucketCount(0), mnMigrateIndex(0) { }
+
+		Node**       GetOldBucketArray() const { return mpOldBucketArray; }
+		eastl_size_t GetOldBucketCount() const { return mnOldBucketCount; }
+		eastl_size_t GetMigrateIndex() const   { return mnMigrateIndex; }
+
+		void SetMigration(Node** pOldBucketArray, eastl_size_t nOldBucketCount, eastl_size_t nMigrateIndex)
+		{
+			mpOldBucketArray = pOldBucketArray;
+			mnOldBucketCount = nOldBucketCount;
+			mnMigrateIndex   = nMigrateIndex;
+		}
+
+		static uint32_t GetMigrateBucketCount(const incremental_rehash_policy& rehashPolicy)
+			{ return rehashPolicy.mnMigrateBucketCount; }
+	};
+
 
 
 
@@ -828,7 +1176,8 @@ namespace eastl
 			  typename RehashPolicy, bool bCacheHashCode, bool bMutableIterators, bool bUniqueKeys>
 	class hashtable
 		:   public rehash_base<RehashPolicy, hashtable<Key, Value, Allocator, ExtractKey, Equal, H1, H2, H, RehashPolicy, bCacheHashCode, bMutableIterators, bUniqueKeys> >,
-			public hash_code_base<Key, Value, ExtractKey, Equal, H1, H2, H, bCacheHashCode>
+			public hash_code_base<Key, Value, ExtractKey, Equal, H1, H2, H, bCacheHashCode>,
+			public incremental_rehash_base<RehashPolicy, hash_node<Value, bCacheHashCode> >
 	{
 	public:
 		typedef Key                                                                                 key_type;
@@ -844,8 +1193,11 @@ namespace eastl
 		typedef const value_type&                                                                   const_reference;
 		typedef node_iterator<value_type, !bMutableIterators, bCacheHashCode>                       local_iterator;
 		typedef node_iterator<value_type, true,               bCacheHashCode>                       const_local_iterator;
-		typedef hashtable_iterator<value_type, !bMutableIterators, bCacheHashCode>                  iterator;
-		typedef hashtable_iterator<value_type, true,               bCacheHashCode>                  const_iterator;
+		typedef incremental_rehash_base<RehashPolicy, hash_node<Value, bCacheHashCode> >            incremental_rehash_base_type;
+		typedef hashtable_iterator<value_type, !bMutableIterators, bCacheHashCode,
+		                           incremental_rehash_base_type::kIncrementalRehash>                iterator;
+		typedef hashtable_iterator<value_type, true,               bCacheHashCode,
+		                           incremental_rehash_base_type::kIncrementalRehash>                const_iterator;
 		typedef hash_node<value_type, bCacheHashCode>                                               node_type;
 		typedef typename type_select<bUniqueKeys, eastl::pair<iterator, bool>, iterator>::type      insert_return_type;
 		typedef hashtable<Key, Value, Allocator, ExtractKey, Equal, H1, H2, H, 
@@ -857,6 +1209,11 @@ namespace eastl
 		typedef H                                                                                   h_type;
 		typedef integral_constant<bool, bUniqueKeys>                                                has_unique_keys_type;
 
+		// The C++17 node_type and insert_return_type. They have different names here, as node_type and
+		// insert_return_type already refer to the hash node and to the result of inserting a value.
+		typedef node_handle<node_type, key_type, ExtractKey, allocator_type>                        node_handle_type;
+		typedef typename type_select<bUniqueKeys, node_insert_return<iterator, node_handle_type>, iterator>::type node_insert_return_type;
+
 		using hash_code_base_type::key_eq;
 		using hash_code_base_type::hash_function;
 		using hash_code_base_type::mExtractKey;
@@ -865,13 +1222,19 @@ namespace eastl
 		using hash_code_base_type::compare;
 		using hash_code_base_type::set_code;
 		using hash_code_base_type::copy_code;
+		using incremental_rehash_base_type::GetOldBucketArray;
+		using incremental_rehash_base_type::GetOldBucketCount;
+		using incremental_rehash_base_type::GetMigrateIndex;
+		using incremental_rehash_base_type::SetMigration;
+		using incremental_rehash_base_type::GetMigrateBucketCount;
 
 		static const bool kCacheHashCode = bCacheHashCode;
 
 		enum
 		{
 			// This enumeration is deprecated in favor of eastl::kHashtableAllocFlagBuckets.
-			kAllocFlagBuckets = eastl::kHashtableAllocFlagBuckets                  // Flag to allocator which indicates that we are allocating buckets and not nodes.
+			kAllocFlagBuckets = eastl::kHashtableAllocFlagBuckets,                 // Flag to allocator which indicates that we are allocating buckets and not nodes.
+			kFindBatchGroupSize = 16                                                // The number of keys whose lookups find_batch overlaps.
 		};
 
 	protected:
@@ -881,6 +1244,10 @@ namespace eastl
 		RehashPolicy    mRehashPolicy;  // To do: Use base class optimization to make this go away.
 		allocator_type  mAllocator;     // To do: Use base class optimization to make this go away.
 
+		#if EASTL_HASHTABLE_STATS
+			mutable hashtable_stats_counters mStatsCounters; // Mutable because lookups are const.
+		#endif
+
 	public:
 		hashtable(size_type nBucketCount, const H1&, const H2&, const H&, const Equal&, const ExtractKey&, 
 				  const allocator_type& allocator = EASTL_HASHTABLE_DEFAULT_ALLOCATOR);
@@ -912,7 +1279,7 @@ namespace eastl
 
 		iterator begin() EA_NOEXCEPT
 		{
-			iterator i(mpBucketArray);
+			iterator i(GetOldBucketArray() ? GetOldBucketArray() : mpBucketArray); // Iteration starts in the old bucket array during an incremental rehash.
 			if(!i.mpNode)
 				i.increment_bucket();
 			return i;
@@ -920,7 +1287,7 @@ namespace eastl
 
 		const_iterator begin() const EA_NOEXCEPT
 		{
-			const_iterator i(mpBucketArray);
+			const_iterator i(GetOldBucketArray() ? GetOldBucketArray() : mpBucketArray);
 			if(!i.mpNode)
 				i.increment_bucket();
 			return i;
@@ -1016,8 +1383,13 @@ namespace eastl
 		iterator                               insert(const_iterator hint, value_type&& value);
 		void                                   insert(std::initializer_list<value_type> ilist);
 		template <typename InputIterator> void insert(InputIterator first, InputIterator last);
-	  //insert_return_type                     insert(node_type&& nh);
-	  //iterator                               insert(const_iterator hint, node_type&& nh);
+
+		/// Inserts the node owned by nh without allocating memory, unless nh's allocator doesn't
+		/// compare equal to ours (as with two fixed containers), in which case the value is moved
+		/// into a new node. An empty handle inserts nothing. The hint is ignored. With unique keys,
+		/// the result's node still owns the node if an equivalent key was present.
+		node_insert_return_type                insert(node_handle_type&& nh);
+		iterator                               insert(const_iterator hint, node_handle_type&& nh);
 
 		// This overload attempts to mitigate the overhead associated with mismatched cv-quality elements of
 		// the hashtable pair. It can avoid copy overhead because it will perfect forward the user provided pair types
@@ -1055,6 +1427,17 @@ namespace eastl
 		node_type* allocate_uninitialized_node();
 		void       free_uninitialized_node(node_type* pNode);
 
+		/// Unlinks the element from the table and returns a handle which owns its node,
+		/// without freeing memory or moving the element.
+		node_handle_type extract(const_iterator position);
+		node_handle_type extract(const key_type& k);
+
+		/// Moves the nodes of all elements of source whose keys aren't present here (or all elements,
+		/// if keys aren't unique) into this container. source may be any hashtable-based container
+		/// with the same node handle type, regardless of its hash and equality functions.
+		template <typename Source>
+		void merge(Source&& source);
+
 		iterator         erase(const_iterator position);
 		iterator         erase(const_iterator first, const_iterator last);
 		size_type        erase(const key_type& k);
@@ -1111,11 +1494,11 @@ namespace eastl
 				"so it requires cached hash codes.  Consider setting template parameter "
 				"bCacheHashCode to true or using find_by_hash(const key_type& k, hash_code_t c) instead.");
 
-			const size_type n = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
+			node_type** const pBucket = DoGetBucket(c);
 
-			node_type* const pNode = DoFindNode(mpBucketArray[n], c);
+			node_type* const pNode = DoFindNode(*pBucket, c);
 
-			return pNode ? iterator(pNode, mpBucketArray + n) :
+			return pNode ? iterator(pNode, pBucket) :
 						   iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 		}
 
@@ -1127,29 +1510,29 @@ namespace eastl
 								"so it requires cached hash codes.  Consider setting template parameter "
 								"bCacheHashCode to true or using find_by_hash(const key_type& k, hash_code_t c) instead.");
 
-			const size_type n = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
+			node_type** const pBucket = DoGetBucket(c);
 
-			node_type* const pNode = DoFindNode(mpBucketArray[n], c);
+			node_type* const pNode = DoFindNode(*pBucket, c);
 
 			return pNode ?
-					   const_iterator(pNode, mpBucketArray + n) :
+					   const_iterator(pNode, pBucket) :
 					   const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 		}
 
 		iterator find_by_hash(const key_type& k, hash_code_t c)
 		{
-			const size_type n = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
+			node_type** const pBucket = DoGetBucket(c);
 
-			node_type* const pNode = DoFindNode(mpBucketArray[n], k, c);
-			return pNode ? iterator(pNode, mpBucketArray + n) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+			node_type* const pNode = DoFindNode(*pBucket, k, c);
+			return pNode ? iterator(pNode, pBucket) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 		}
 
 		const_iterator find_by_hash(const key_type& k, hash_code_t c) const
 		{
-			const size_type n = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
+			node_type** const pBucket = DoGetBucket(c);
 
-			node_type* const pNode = DoFindNode(mpBucketArray[n], k, c);
-			return pNode ? const_iterator(pNode, mpBucketArray + n) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+			node_type* const pNode = DoFindNode(*pBucket, k, c);
+			return pNode ? const_iterator(pNode, pBucket) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 		}
 
 		// Returns a pair that allows iterating over all nodes in a hash bucket
@@ -1166,9 +1549,127 @@ namespace eastl
 		eastl::pair<iterator, iterator>             equal_range(const key_type& k);
 		eastl::pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
 
+		bool contains(const key_type& k) const
+			{ return find(k) != end(); }
+
+		/// find_batch / contains_batch
+		///
+		/// Look up many keys at once, writing the result for keys[i] to results[i], which
+		/// must have at least as many elements as keys. The result is the same as that of
+		/// calling find or contains for each key, but for tables which don't fit in the cache
+		/// this is usually much faster: the keys are processed in groups of kFindBatchGroupSize,
+		/// with all of a group's keys being hashed and their buckets prefetched before any of
+		/// the buckets are read, and all of their first nodes being prefetched before any of
+		/// the chains is walked. Thus the cache misses of a group overlap instead of being
+		/// paid one after another. contains_batch returns the number of keys found.
+		///
+		/// Example usage:
+		///     hash_set<int> intSet;
+		///     int  keys[3] = { 17, 42, 99 };
+		///     bool found[3];
+		///     intSet.contains_batch(keys, found);
+		///
+		void      find_batch(eastl::span<const key_type> keys, eastl::span<iterator> results);
+		void      find_batch(eastl::span<const key_type> keys, eastl::span<const_iterator> results) const;
+		size_type contains_batch(eastl::span<const key_type> keys, eastl::span<bool> results) const;
+
+		/// Heterogeneous lookup
+		///
+		/// The following overloads accept a key of any type U which the hash function and
+		/// the key equality predicate can both be called with, and are available only if
+		/// both of them define the member type is_transparent (C++14/C++20 style). Unlike
+		/// find_as, they require no extra arguments and they cover the remaining lookup
+		/// functions. The hash function must return the same value for a U as for the
+		/// key_type which compares equal to it.
+		///
+		/// Example usage (no temporary string is constructed by the lookups):
+		///     hash_set<string, hash<string_view>, equal_to<void>> hashSet;
+		///     hashSet.find(string_view("hello"));
+		///     hashSet.erase("hello");
+		///
+		template <typename U, typename HashT = H1, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, iterator) find(const U& u)
+			{ return find_as(u, hash_function(), key_eq()); }
+
+		template <typename U, typename HashT = H1, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, const_iterator) find(const U& u) const
+			{ return find_as(u, hash_function(), key_eq()); }
+
+		template <typename U, typename HashT = H1, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, bool) contains(const U& u) const
+			{ return find_as(u, hash_function(), key_eq()) != end(); }
+
+		template <typename U, typename HashT = H1, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, size_type) count(const U& u) const
+		{
+			const hash_code_t c      = (hash_code_t)hash_function()(u);
+			node_type** const pBucket = DoGetBucket(c);
+			size_type         result = 0;
+
+			for(node_type* pNode = *pBucket; pNode; pNode = pNode->mpNext)
+			{
+				if(key_eq()(mExtractKey(pNode->mValue), u))
+					++result;
+			}
+			return result;
+		}
+
+		template <typename U, typename HashT = H1, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, eastl::pair<iterator, iterator>) equal_range(const U& u)
+		{
+			const eastl::pair<const_iterator, const_iterator> range(const_cast<const this_type*>(this)->equal_range(u));
+			return eastl::pair<iterator, iterator>(iterator(range.first.mpNode, range.first.mpBucket),
+			                                       iterator(range.second.mpNode, range.second.mpBucket));
+		}
+
+		template <typename U, typename HashT = H1, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT(HashT, EqualT, eastl::pair<const_iterator, const_iterator>) equal_range(const U& u) const
+		{
+			const hash_code_t c     = (hash_code_t)hash_function()(u);
+			node_type** const head  = DoGetBucket(c);
+			node_type*        pNode = DoFindNodeT(*head, u, key_eq());
+
+			if(pNode)
+			{
+				node_type* p1 = pNode->mpNext;
+
+				while(p1 && key_eq()(mExtractKey(p1->mValue), u))
+					p1 = p1->mpNext;
+
+				const_iterator first(pNode, head);
+				const_iterator last(p1, head);
+
+				if(!p1)
+					last.increment_bucket();
+
+				return eastl::pair<const_iterator, const_iterator>(first, last);
+			}
+
+			return eastl::pair<const_iterator, const_iterator>(const_iterator(mpBucketArray + mnBucketCount),  // iterator(mpBucketArray + mnBucketCount) == end()
+			                                                   const_iterator(mpBucketArray + mnBucketCount));
+		}
+
+		template <typename U, typename HashT = H1, typename EqualT = Equal>
+		ENABLE_IF_TRANSPARENT_ERASE(HashT, EqualT, U, size_type) erase(const U& u)
+		{
+			const eastl::pair<const_iterator, const_iterator> range(equal_range(u));
+			const size_type nElementCountSaved = mnElementCount;
+
+			erase(range.first, range.second);
+			return nElementCountSaved - mnElementCount;
+		}
+
 		bool validate() const;
 		int  validate_iterator(const_iterator i) const;
 
+		#if EASTL_HASHTABLE_STATS
+			/// Returns the counters accumulated by this container since it was constructed or
+			/// reset_stats was called, along with the current chain length histogram.
+			/// Walks the entire bucket array and so is O(n + bucket_count()).
+			hashtable_stats get_stats() const;
+			void            reset_stats();
+		#endif
+
 	protected:
 		// We must remove one of the 'DoGetResultIterator' overloads from the overload-set (via SFINAE) because both can
 		// not compile successfully at the same time. The 'bUniqueKeys' template parameter chooses at compile-time the
@@ -1194,6 +1695,13 @@ namespace eastl
 		node_type*  DoAllocateNodeFromKey(const key_type& key);
 		node_type*  DoAllocateNodeFromKey(key_type&& key);
 		void        DoFreeNode(node_type* pNode);
+		void        DoUnlinkNode(node_type* pNode, node_type** pBucket);
+		node_type*  DoAcquireNode(node_handle_type& nh);
+
+		node_insert_return<iterator, node_handle_type> DoInsertNode(true_type, node_handle_type&& nh);
+		iterator                                       DoInsertNode(false_type, node_handle_type&& nh);
+		iterator                                       DoInsertNodeHint(true_type, node_handle_type&& nh);
+		iterator                                       DoInsertNodeHint(false_type, node_handle_type&& nh);
 		void        DoFreeNodes(node_type** pBucketArray, size_type);
 
 		node_type** DoAllocateBuckets(size_type n);
@@ -1266,19 +1774,122 @@ namespace eastl
 		iterator                    DoInsertKey(false_type, key_type&& key);
 
 		void       DoRehash(size_type nBucketCount);
+		void       DoGrowBuckets(size_type nBucketCount);
+
+		// The bucket count which rehash uses for a requested nBucketCount. mask_range_hashing needs a
+		// power of two whichever rehash policy it is paired with; other range hashing takes it as-is.
+		static size_type DoGetRehashBucketCount(true_type, size_type nBucketCount)  // H2 is mask_range_hashing
+		{
+			const uint32_t kMaxBucketCount = UINT32_C(1) << 31; // Matches power_of_two_rehash_policy.
+			if(nBucketCount <= 2)
+				return 2; // A bucket count of 1 is reserved for tables which use gpEmptyBucketArray.
+			return (nBucketCount >= kMaxBucketCount) ? kMaxBucketCount : (size_type)eastl::bit_ceil((uint32_t)nBucketCount);
+		}
+
+		static size_type DoGetRehashBucketCount(false_type, size_type nBucketCount)
+			{ return nBucketCount; }
+
+		void       DoMigrateBuckets(size_type nBucketCount);
+		void       DoFreeOldBuckets();
 		node_type* DoFindNode(node_type* pNode, const key_type& k, hash_code_t c) const;
 
+		template <typename Result>
+		size_type DoFindBatch(const key_type* pKeys, size_type nKeyCount, Result* pResults) const;
+
+		template <typename Iterator> // Iterator is iterator or const_iterator, which are the same type for sets.
+		void DoSetBatchResult(Iterator& result, node_type* pNode, node_type** pBucket) const
+			{ result = pNode ? Iterator(pNode, pBucket) : Iterator(mpBucketArray + mnBucketCount); }
+
+		void DoSetBatchResult(bool& result, node_type* pNode, node_type**) const
+			{ result = (pNode != NULL); }
+
+		// Moves a few more buckets if an incremental rehash is in progress. Called by the insertion functions.
+		void DoRehashStep()
+		{
+			if(GetOldBucketArray())
+				DoMigrateBuckets(GetMigrateBucketCount(mRehashPolicy));
+		}
+
+		void DoFinishRehash()
+		{
+			if(GetOldBucketArray())
+				DoMigrateBuckets(GetOldBucketCount());
+		}
+
+		// Returns the bucket which holds the elements with key k, whose hash code is c.
+		node_type** DoGetBucket(const key_type& k, hash_code_t c) const
+		{
+			node_type** const pOldBucketArray = GetOldBucketArray();
+
+			if(pOldBucketArray) // If an incremental rehash is in progress...
+			{
+				const size_type n = (size_type)bucket_index(k, c, (uint32_t)GetOldBucketCount());
+				if(n >= GetMigrateIndex())
+					return pOldBucketArray + n;
+			}
+
+			return mpBucketArray + bucket_index(k, c, (uint32_t)mnBucketCount);
+		}
+
+		node_type** DoGetBucket(hash_code_t c) const
+		{
+			node_type** const pOldBucketArray = GetOldBucketArray();
+
+			if(pOldBucketArray)
+			{
+				const size_type n = (size_type)bucket_index(c, (uint32_t)GetOldBucketCount());
+				if(n >= GetMigrateIndex())
+					return pOldBucketArray + n;
+			}
+
+			return mpBucketArray + bucket_index(c, (uint32_t)mnBucketCount);
+		}
+
 		template <typename T>
 		ENABLE_IF_HAS_HASHCODE(T, node_type) DoFindNode(T* pNode, hash_code_t c) const
 		{
+			#if EASTL_HASHTABLE_STATS
+				++mStatsCounters.mnLookupCount;
+			#endif
+
 			for (; pNode; pNode = pNode->mpNext)
 			{
+				#if EASTL_HASHTABLE_STATS
+					++mStatsCounters.mnProbeCount;
+				#endif
 				if (pNode->mnHashCode == c)
 					return pNode;
 			}
 			return NULL;
 		}
 
+		// Equivalent to compare, but counts the probe when EASTL_HASHTABLE_STATS is enabled.
+		bool DoCompare(const key_type& k, hash_code_t c, node_type* pNode) const
+		{
+			#if EASTL_HASHTABLE_STATS
+				DoCountProbe(c, pNode, integral_constant<bool, bCacheHashCode>());
+			#endif
+			return compare(k, c, pNode);
+		}
+
+		#if EASTL_HASHTABLE_STATS
+			template <typename NodeT> // A template so that explicit instantiations of hashtable don't instantiate it when nodes don't cache hash codes.
+			void DoCountProbe(hash_code_t c, const NodeT* pNode, true_type) const // true_type means bCacheHashCode is true.
+			{
+				++mStatsCounters.mnProbeCount;
+				if(pNode->mnHashCode == c)
+					++mStatsCounters.mnKeyCompareCount;
+				else
+					++mStatsCounters.mnHashCodeRejectCount;
+			}
+
+			void DoCountProbe(hash_code_t, const node_type*, false_type) const
+			{
+				++mStatsCounters.mnProbeCount;
+				++mStatsCounters.mnKeyCompareCount;
+			}
+		#endif
+
 		template <typename U, typename BinaryPredicate>
 		node_type* DoFindNodeT(node_type* pNode, const U& u, BinaryPredicate predicate) const;
 
@@ -1307,12 +1918,12 @@ namespace eastl
 	// hashtable_iterator_base
 	///////////////////////////////////////////////////////////////////////
 
-	template <typename Value, bool bCacheHashCode>
-	inline bool operator==(const hashtable_iterator_base<Value, bCacheHashCode>& a, const hashtable_iterator_base<Value, bCacheHashCode>& b)
+	template <typename Value, bool bCacheHashCode, bool bLinkedBuckets>
+	inline bool operator==(const hashtable_iterator_base<Value, bCacheHashCode, bLinkedBuckets>& a, const hashtable_iterator_base<Value, bCacheHashCode, bLinkedBuckets>& b)
 		{ return a.mpNode == b.mpNode; }
 
-	template <typename Value, bool bCacheHashCode>
-	inline bool operator!=(const hashtable_iterator_base<Value, bCacheHashCode>& a, const hashtable_iterator_base<Value, bCacheHashCode>& b)
+	template <typename Value, bool bCacheHashCode, bool bLinkedBuckets>
+	inline bool operator!=(const hashtable_iterator_base<Value, bCacheHashCode, bLinkedBuckets>& a, const hashtable_iterator_base<Value, bCacheHashCode, bLinkedBuckets>& b)
 		{ return a.mpNode != b.mpNode; }
 
 
@@ -1422,6 +2033,24 @@ namespace eastl
 							pNodeSource = pNodeSource->mpNext;
 						}
 					}
+
+					// If x is in the middle of an incremental rehash, we also copy the nodes it has yet to 
+					// migrate, directly into their buckets in our (single) bucket array.
+					if(node_type** const pOldBucketArray = x.GetOldBucketArray())
+					{
+						for(size_type i = x.GetMigrateIndex(); i < x.GetOldBucketCount(); ++i)
+						{
+							for(node_type* pNodeSource = pOldBucketArray[i]; pNodeSource; pNodeSource = pNodeSource->mpNext)
+							{
+								const size_type  n         = (size_type)bucket_index(pNodeSource, (uint32_t)mnBucketCount);
+								node_type* const pNodeDest = DoAllocateNode(pNodeSource->mValue);
+
+								copy_code(pNodeDest, pNodeSource);
+								pNodeDest->mpNext = mpBucketArray[n];
+								mpBucketArray[n]  = pNodeDest;
+							}
+						}
+					}
 			#if EASTL_EXCEPTIONS_ENABLED
 				}
 				catch(...)
@@ -1676,6 +2305,7 @@ namespace eastl
 		EASTL_MACRO_SWAP(node_type**, mpBucketArray, x.mpBucketArray);
 		eastl::swap(mnBucketCount, x.mnBucketCount);
 		eastl::swap(mnElementCount, x.mnElementCount);
+		eastl::swap(static_cast<incremental_rehash_base_type&>(*this), static_cast<incremental_rehash_base_type&>(x));
 
 		if (mAllocator != x.mAllocator) // If allocators are not equivalent...
 		{
@@ -1704,10 +2334,10 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find(const key_type& k)
 	{
 		const hash_code_t c = get_hash_code(k);
-		const size_type   n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+		node_type** const pBucket = DoGetBucket(k, c);
 
-		node_type* const pNode = DoFindNode(mpBucketArray[n], k, c);
-		return pNode ? iterator(pNode, mpBucketArray + n) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+		node_type* const pNode = DoFindNode(*pBucket, k, c);
+		return pNode ? iterator(pNode, pBucket) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 	}
 
 
@@ -1718,10 +2348,10 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find(const key_type& k) const
 	{
 		const hash_code_t c = get_hash_code(k);
-		const size_type   n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+		node_type** const pBucket = DoGetBucket(k, c);
 
-		node_type* const pNode = DoFindNode(mpBucketArray[n], k, c);
-		return pNode ? const_iterator(pNode, mpBucketArray + n) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+		node_type* const pNode = DoFindNode(*pBucket, k, c);
+		return pNode ? const_iterator(pNode, pBucket) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 	}
 
 
@@ -1733,10 +2363,10 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_as(const U& other, UHash uhash, BinaryPredicate predicate)
 	{
 		const hash_code_t c = (hash_code_t)uhash(other);
-		const size_type   n = (size_type)(c % mnBucketCount); // This assumes we are using the mod range policy.
+		node_type** const pBucket = DoGetBucket(c);
 
-		node_type* const pNode = DoFindNodeT(mpBucketArray[n], other, predicate);
-		return pNode ? iterator(pNode, mpBucketArray + n) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+		node_type* const pNode = DoFindNodeT(*pBucket, other, predicate);
+		return pNode ? iterator(pNode, pBucket) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 	}
 
 
@@ -1748,10 +2378,10 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_as(const U& other, UHash uhash, BinaryPredicate predicate) const
 	{
 		const hash_code_t c = (hash_code_t)uhash(other);
-		const size_type   n = (size_type)(c % mnBucketCount); // This assumes we are using the mod range policy.
+		node_type** const pBucket = DoGetBucket(c);
 
-		node_type* const pNode = DoFindNodeT(mpBucketArray[n], other, predicate);
-		return pNode ? const_iterator(pNode, mpBucketArray + n) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+		node_type* const pNode = DoFindNodeT(*pBucket, other, predicate);
+		return pNode ? const_iterator(pNode, pBucket) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 	}
 
 
@@ -1808,13 +2438,13 @@ namespace eastl
 				typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::const_iterator>
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_range_by_hash(hash_code_t c) const
 	{
-		const size_type start = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
-		node_type* const pNodeStart = mpBucketArray[start];
+		node_type** const pBucket    = DoGetBucket(c);
+		node_type* const  pNodeStart = *pBucket;
 
 		if (pNodeStart)
 		{
-			eastl::pair<const_iterator, const_iterator> pair(const_iterator(pNodeStart, mpBucketArray + start), 
-															 const_iterator(pNodeStart, mpBucketArray + start));
+			eastl::pair<const_iterator, const_iterator> pair(const_iterator(pNodeStart, pBucket), 
+															 const_iterator(pNodeStart, pBucket));
 			pair.second.increment_bucket();
 			return pair;
 		}
@@ -1831,13 +2461,13 @@ namespace eastl
 				typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator>
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_range_by_hash(hash_code_t c)
 	{
-		const size_type start = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
-		node_type* const pNodeStart = mpBucketArray[start];
+		node_type** const pBucket    = DoGetBucket(c);
+		node_type* const  pNodeStart = *pBucket;
 
 		if (pNodeStart)
 		{
-			eastl::pair<iterator, iterator> pair(iterator(pNodeStart, mpBucketArray + start), 
-												 iterator(pNodeStart, mpBucketArray + start));
+			eastl::pair<iterator, iterator> pair(iterator(pNodeStart, pBucket), 
+												 iterator(pNodeStart, pBucket));
 			pair.second.increment_bucket();
 			return pair;
 
@@ -1855,14 +2485,18 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::count(const key_type& k) const EA_NOEXCEPT
 	{
 		const hash_code_t c      = get_hash_code(k);
-		const size_type   n      = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+		node_type** const pBucket = DoGetBucket(k, c);
 		size_type         result = 0;
 
+		#if EASTL_HASHTABLE_STATS
+			++mStatsCounters.mnLookupCount;
+		#endif
+
 		// To do: Make a specialization for bU (unique keys) == true and take 
 		// advantage of the fact that the count will always be zero or one in that case. 
-		for(node_type* pNode = mpBucketArray[n]; pNode; pNode = pNode->mpNext)
+		for(node_type* pNode = *pBucket; pNode; pNode = pNode->mpNext)
 		{
-			if(compare(k, c, pNode))
+			if(DoCompare(k, c, pNode))
 				++result;
 		}
 		return result;
@@ -1877,8 +2511,7 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::equal_range(const key_type& k)
 	{
 		const hash_code_t c     = get_hash_code(k);
-		const size_type   n     = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-		node_type**       head  = mpBucketArray + n;
+		node_type** const head  = DoGetBucket(k, c);
 		node_type*        pNode = DoFindNode(*head, k, c);
 
 		if(pNode)
@@ -1887,7 +2520,7 @@ namespace eastl
 
 			for(; p1; p1 = p1->mpNext)
 			{
-				if(!compare(k, c, p1))
+				if(!DoCompare(k, c, p1))
 					break;
 			}
 
@@ -1914,8 +2547,7 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::equal_range(const key_type& k) const
 	{
 		const hash_code_t c     = get_hash_code(k);
-		const size_type   n     = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-		node_type**       head  = mpBucketArray + n;
+		node_type** const head  = DoGetBucket(k, c);
 		node_type*        pNode = DoFindNode(*head, k, c);
 
 		if(pNode)
@@ -1924,7 +2556,7 @@ namespace eastl
 
 			for(; p1; p1 = p1->mpNext)
 			{
-				if(!compare(k, c, p1))
+				if(!DoCompare(k, c, p1))
 					break;
 			}
 
@@ -1943,14 +2575,97 @@ namespace eastl
 
 
 
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	inline void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_batch(eastl::span<const key_type> keys, eastl::span<iterator> results)
+	{
+		EASTL_ASSERT(results.size() >= keys.size());
+		DoFindBatch(keys.data(), (size_type)keys.size(), results.data());
+	}
+
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	inline void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_batch(eastl::span<const key_type> keys, eastl::span<const_iterator> results) const
+	{
+		EASTL_ASSERT(results.size() >= keys.size());
+		DoFindBatch(keys.data(), (size_type)keys.size(), results.data());
+	}
+
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::size_type
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::contains_batch(eastl::span<const key_type> keys, eastl::span<bool> results) const
+	{
+		EASTL_ASSERT(results.size() >= keys.size());
+		return DoFindBatch(keys.data(), (size_type)keys.size(), results.data());
+	}
+
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	template <typename Result>
+	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::size_type
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoFindBatch(const key_type* pKeys, size_type nKeyCount, Result* pResults) const
+	{
+		hash_code_t codes[kFindBatchGroupSize];
+		node_type** buckets[kFindBatchGroupSize];
+		node_type*  nodes[kFindBatchGroupSize];
+		size_type   nFoundCount = 0;
+
+		for(size_type i = 0; i < nKeyCount; i += kFindBatchGroupSize)
+		{
+			const key_type* const pGroupKeys  = pKeys + i;
+			const size_type       nGroupCount = eastl::min_alt(nKeyCount - i, (size_type)kFindBatchGroupSize);
+			size_type             j;
+
+			// Hash every key of the group and start loading its bucket. DoGetBucket only does 
+			// arithmetic, so none of these iterations waits on memory.
+			for(j = 0; j < nGroupCount; ++j)
+			{
+				codes[j]   = get_hash_code(pGroupKeys[j]);
+				buckets[j] = DoGetBucket(pGroupKeys[j], codes[j]);
+				EASTL_PREFETCH(buckets[j]);
+			}
+
+			// By now the first buckets have arrived. Start loading the first node of each chain.
+			for(j = 0; j < nGroupCount; ++j)
+			{
+				nodes[j] = *buckets[j];
+				EASTL_PREFETCH(nodes[j]);
+			}
+
+			for(j = 0; j < nGroupCount; ++j)
+			{
+				node_type* const pNode = DoFindNode(nodes[j], pGroupKeys[j], codes[j]);
+
+				DoSetBatchResult(pResults[i + j], pNode, buckets[j]);
+				if(pNode)
+					++nFoundCount;
+			}
+		}
+
+		return nFoundCount;
+	}
+
+
+
 	template <typename K, typename V, typename A, typename EK, typename Eq,
 			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
 	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_type* 
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoFindNode(node_type* pNode, const key_type& k, hash_code_t c) const
 	{
+		#if EASTL_HASHTABLE_STATS
+			++mStatsCounters.mnLookupCount;
+		#endif
+
 		for(; pNode; pNode = pNode->mpNext)
 		{
-			if(compare(k, c, pNode))
+			if(DoCompare(k, c, pNode))
 				return pNode;
 		}
 		return NULL;
@@ -1964,8 +2679,16 @@ namespace eastl
 	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_type* 
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoFindNodeT(node_type* pNode, const U& other, BinaryPredicate predicate) const
 	{
+		#if EASTL_HASHTABLE_STATS
+			++mStatsCounters.mnLookupCount;
+		#endif
+
 		for(; pNode; pNode = pNode->mpNext)
 		{
+			#if EASTL_HASHTABLE_STATS
+				++mStatsCounters.mnProbeCount;
+				++mStatsCounters.mnKeyCompareCount;
+			#endif
 			if(predicate(mExtractKey(pNode->mValue), other)) // Intentionally compare with key as first arg and other as second arg.
 				return pNode;
 		}
@@ -1991,11 +2714,13 @@ namespace eastl
 		// specializations of the insert function for const value_type& and value_type&&, and so the only time this function
 		// should get called is when args refers to arguments to construct a value_type.
 
+		DoRehashStep();
+
 		node_type* const  pNodeNew = DoAllocateNode(eastl::forward<Args>(args)...);
 		const key_type&   k        = mExtractKey(pNodeNew->mValue);
 		const hash_code_t c        = get_hash_code(k);
-		size_type         n        = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-		node_type* const  pNode    = DoFindNode(mpBucketArray[n], k, c);
+		node_type**       pBucket  = DoGetBucket(k, c);
+		node_type* const  pNode    = DoFindNode(*pBucket, k, c);
 
 		if(pNode == NULL) // If value is not present... add it.
 		{
@@ -2009,16 +2734,16 @@ namespace eastl
 			#endif
 					if(bRehash.first)
 					{
-						n = (size_type)bucket_index(k, c, (uint32_t)bRehash.second);
-						DoRehash(bRehash.second);
+						DoGrowBuckets(bRehash.second);
+						pBucket = DoGetBucket(k, c);
 					}
 
 					EASTL_ASSERT((uintptr_t)mpBucketArray != (uintptr_t)&gpEmptyBucketArray[0]);
-					pNodeNew->mpNext = mpBucketArray[n];
-					mpBucketArray[n] = pNodeNew;
+					pNodeNew->mpNext = *pBucket;
+					*pBucket = pNodeNew;
 					++mnElementCount;
 
-					return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+					return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 			#if EASTL_EXCEPTIONS_ENABLED
 				}
 				catch(...)
@@ -2040,7 +2765,7 @@ namespace eastl
 			DoFreeNode(pNodeNew);
 		}
 
-		return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+		return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 	}
 
 
@@ -2050,15 +2775,17 @@ namespace eastl
 	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertValue(BoolConstantT, Args&&... args) // false_type means bUniqueKeys is false.
 	{
+		DoRehashStep();
+
 		const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
 		if(bRehash.first)
-			DoRehash(bRehash.second);
+			DoGrowBuckets(bRehash.second);
 
 		node_type*        pNodeNew = DoAllocateNode(eastl::forward<Args>(args)...);
 		const key_type&   k        = mExtractKey(pNodeNew->mValue);
 		const hash_code_t c        = get_hash_code(k);
-		const size_type   n        = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+		node_type** const pBucket  = DoGetBucket(k, c);
 
 		set_code(pNodeNew, c); // This is a no-op for most hashtables.
 
@@ -2068,13 +2795,13 @@ namespace eastl
 		// erase(value) can more quickly find equal values. The downside is that
 		// this insertion operation taking some extra time. How important is it to
 		// us that equal_range span all equal items? 
-		node_type* const pNodePrev = DoFindNode(mpBucketArray[n], k, c);
+		node_type* const pNodePrev = DoFindNode(*pBucket, k, c);
 
 		if(pNodePrev == NULL)
 		{
 			EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-			pNodeNew->mpNext = mpBucketArray[n];
-			mpBucketArray[n] = pNodeNew;
+			pNodeNew->mpNext = *pBucket;
+			*pBucket = pNodeNew;
 		}
 		else
 		{
@@ -2084,7 +2811,7 @@ namespace eastl
 
 		++mnElementCount;
 
-		return iterator(pNodeNew, mpBucketArray + n);
+		return iterator(pNodeNew, pBucket);
 	}
 
 
@@ -2130,10 +2857,12 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertValueExtra(BoolConstantT, const key_type& k,
 		hash_code_t c, node_type* pNodeNew, value_type&& value, ENABLE_IF_TRUETYPE(BoolConstantT)) // true_type means bUniqueKeys is true.
 	{
+		DoRehashStep();
+
 		// Adds the value to the hash table if not already present. 
 		// If already present then the existing value is returned via an iterator/bool pair.
-		size_type         n     = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-		node_type* const  pNode = DoFindNode(mpBucketArray[n], k, c);
+		node_type**       pBucket = DoGetBucket(k, c);
+		node_type* const  pNode = DoFindNode(*pBucket, k, c);
 
 		if(pNode == NULL) // If value is not present... add it.
 		{
@@ -2168,16 +2897,16 @@ namespace eastl
 			#endif
 					if(bRehash.first)
 					{
-						n = (size_type)bucket_index(k, c, (uint32_t)bRehash.second);
-						DoRehash(bRehash.second);
+						DoGrowBuckets(bRehash.second);
+						pBucket = DoGetBucket(k, c);
 					}
 
 					EASTL_ASSERT((uintptr_t)mpBucketArray != (uintptr_t)&gpEmptyBucketArray[0]);
-					pNodeNew->mpNext = mpBucketArray[n];
-					mpBucketArray[n] = pNodeNew;
+					pNodeNew->mpNext = *pBucket;
+					*pBucket = pNodeNew;
 					++mnElementCount;
 
-					return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+					return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 			#if EASTL_EXCEPTIONS_ENABLED
 				}
 				catch(...)
@@ -2190,7 +2919,7 @@ namespace eastl
 		}
 		// Else the value is already present, so don't add a new node. And don't free pNodeNew.
 
-		return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+		return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 	}
 
 
@@ -2214,12 +2943,14 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertValueExtra(BoolConstantT, const key_type& k, hash_code_t c, node_type* pNodeNew, value_type&& value, 
 			DISABLE_IF_TRUETYPE(BoolConstantT)) // false_type means bUniqueKeys is false.
 	{
+		DoRehashStep();
+
 		const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
 		if(bRehash.first)
-			DoRehash(bRehash.second); // Note: We don't need to wrap this call with try/catch because there's nothing we would need to do in the catch.
+			DoGrowBuckets(bRehash.second); // Note: We don't need to wrap this call with try/catch because there's nothing we would need to do in the catch.
 
-		const size_type n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+		node_type** const pBucket = DoGetBucket(k, c);
 
 		if(pNodeNew)
 			::new(eastl::addressof(pNodeNew->mValue)) value_type(eastl::move(value)); // It's expected that pNodeNew was allocated with allocate_uninitialized_node.
@@ -2234,13 +2965,13 @@ namespace eastl
 		// erase(value) can more quickly find equal values. The downside is that
 		// this insertion operation taking some extra time. How important is it to
 		// us that equal_range span all equal items? 
-		node_type* const pNodePrev = DoFindNode(mpBucketArray[n], k, c);
+		node_type* const pNodePrev = DoFindNode(*pBucket, k, c);
 
 		if(pNodePrev == NULL)
 		{
 			EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-			pNodeNew->mpNext = mpBucketArray[n];
-			mpBucketArray[n] = pNodeNew;
+			pNodeNew->mpNext = *pBucket;
+			*pBucket = pNodeNew;
 		}
 		else
 		{
@@ -2250,7 +2981,7 @@ namespace eastl
 
 		++mnElementCount;
 
-		return iterator(pNodeNew, mpBucketArray + n);
+		return iterator(pNodeNew, pBucket);
 	}
 
 
@@ -2300,10 +3031,12 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertValueExtra(BoolConstantT, const key_type& k, hash_code_t c, node_type* pNodeNew, const value_type& value, 
 			ENABLE_IF_TRUETYPE(BoolConstantT)) // true_type means bUniqueKeys is true.
 	{
+		DoRehashStep();
+
 		// Adds the value to the hash table if not already present. 
 		// If already present then the existing value is returned via an iterator/bool pair.
-		size_type         n     = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-		node_type* const  pNode = DoFindNode(mpBucketArray[n], k, c);
+		node_type**       pBucket = DoGetBucket(k, c);
+		node_type* const  pNode = DoFindNode(*pBucket, k, c);
 
 		if(pNode == NULL) // If value is not present... add it.
 		{
@@ -2338,16 +3071,16 @@ namespace eastl
 			#endif
 					if(bRehash.first)
 					{
-						n = (size_type)bucket_index(k, c, (uint32_t)bRehash.second);
-						DoRehash(bRehash.second);
+						DoGrowBuckets(bRehash.second);
+						pBucket = DoGetBucket(k, c);
 					}
 
 					EASTL_ASSERT((uintptr_t)mpBucketArray != (uintptr_t)&gpEmptyBucketArray[0]);
-					pNodeNew->mpNext = mpBucketArray[n];
-					mpBucketArray[n] = pNodeNew;
+					pNodeNew->mpNext = *pBucket;
+					*pBucket = pNodeNew;
 					++mnElementCount;
 
-					return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+					return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 			#if EASTL_EXCEPTIONS_ENABLED
 				}
 				catch(...)
@@ -2360,7 +3093,7 @@ namespace eastl
 		}
 		// Else the value is already present, so don't add a new node. And don't free pNodeNew.
 
-		return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+		return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 	}
 
 
@@ -2384,12 +3117,14 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertValueExtra(BoolConstantT, const key_type& k, hash_code_t c, node_type* pNodeNew, const value_type& value,
 			DISABLE_IF_TRUETYPE(BoolConstantT)) // false_type means bUniqueKeys is false.
 	{
+		DoRehashStep();
+
 		const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
 		if(bRehash.first)
-			DoRehash(bRehash.second); // Note: We don't need to wrap this call with try/catch because there's nothing we would need to do in the catch.
+			DoGrowBuckets(bRehash.second); // Note: We don't need to wrap this call with try/catch because there's nothing we would need to do in the catch.
 
-		const size_type n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+		node_type** const pBucket = DoGetBucket(k, c);
 
 		if(pNodeNew)
 			::new(eastl::addressof(pNodeNew->mValue)) value_type(value); // It's expected that pNodeNew was allocated with allocate_uninitialized_node.
@@ -2404,13 +3139,13 @@ namespace eastl
 		// erase(value) can more quickly find equal values. The downside is that
 		// this insertion operation taking some extra time. How important is it to
 		// us that equal_range span all equal items? 
-		node_type* const pNodePrev = DoFindNode(mpBucketArray[n], k, c);
+		node_type* const pNodePrev = DoFindNode(*pBucket, k, c);
 
 		if(pNodePrev == NULL)
 		{
 			EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-			pNodeNew->mpNext = mpBucketArray[n];
-			mpBucketArray[n] = pNodeNew;
+			pNodeNew->mpNext = *pBucket;
+			*pBucket = pNodeNew;
 		}
 		else
 		{
@@ -2420,7 +3155,7 @@ namespace eastl
 
 		++mnElementCount;
 
-		return iterator(pNodeNew, mpBucketArray + n);
+		return iterator(pNodeNew, pBucket);
 	}
 
 
@@ -2491,9 +3226,11 @@ namespace eastl
 	eastl::pair<typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator, bool>
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertKey(true_type, const key_type& key) // true_type means bUniqueKeys is true.
 	{
+		DoRehashStep();
+
 		const hash_code_t c     = get_hash_code(key);
-		size_type         n     = (size_type)bucket_index(key, c, (uint32_t)mnBucketCount);
-		node_type* const  pNode = DoFindNode(mpBucketArray[n], key, c);
+		node_type**       pBucket = DoGetBucket(key, c);
+		node_type* const  pNode = DoFindNode(*pBucket, key, c);
 
 		if(pNode == NULL)
 		{
@@ -2510,16 +3247,16 @@ namespace eastl
 			#endif
 					if(bRehash.first)
 					{
-						n = (size_type)bucket_index(key, c, (uint32_t)bRehash.second);
-						DoRehash(bRehash.second);
+						DoGrowBuckets(bRehash.second);
+						pBucket = DoGetBucket(key, c);
 					}
 
 					EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-					pNodeNew->mpNext = mpBucketArray[n];
-					mpBucketArray[n] = pNodeNew;
+					pNodeNew->mpNext = *pBucket;
+					*pBucket = pNodeNew;
 					++mnElementCount;
 
-					return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+					return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 			#if EASTL_EXCEPTIONS_ENABLED
 				}
 				catch(...)
@@ -2530,7 +3267,7 @@ namespace eastl
 			#endif
 		}
 
-		return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+		return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 	}
 
 
@@ -2540,13 +3277,15 @@ namespace eastl
 	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertKey(false_type, const key_type& key) // false_type means bUniqueKeys is false.
 	{
+		DoRehashStep();
+
 		const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
 		if(bRehash.first)
-			DoRehash(bRehash.second);
+			DoGrowBuckets(bRehash.second);
 
 		const hash_code_t c = get_hash_code(key);
-		const size_type   n = (size_type)bucket_index(key, c, (uint32_t)mnBucketCount);
+		node_type** const pBucket = DoGetBucket(key, c);
 
 		node_type* const pNodeNew = DoAllocateNodeFromKey(key);
 		set_code(pNodeNew, c); // This is a no-op for most hashtables.
@@ -2557,13 +3296,13 @@ namespace eastl
 		// erase(value) can more quickly find equal values. The downside is that
 		// this insertion operation taking some extra time. How important is it to
 		// us that equal_range span all equal items? 
-		node_type* const pNodePrev = DoFindNode(mpBucketArray[n], key, c);
+		node_type* const pNodePrev = DoFindNode(*pBucket, key, c);
 
 		if(pNodePrev == NULL)
 		{
 			EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-			pNodeNew->mpNext = mpBucketArray[n];
-			mpBucketArray[n] = pNodeNew;
+			pNodeNew->mpNext = *pBucket;
+			*pBucket = pNodeNew;
 		}
 		else
 		{
@@ -2573,7 +3312,7 @@ namespace eastl
 
 		++mnElementCount;
 
-		return iterator(pNodeNew, mpBucketArray + n);
+		return iterator(pNodeNew, pBucket);
 	}
 
 
@@ -2582,9 +3321,11 @@ namespace eastl
 	eastl::pair<typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator, bool>
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertKey(true_type, key_type&& key) // true_type means bUniqueKeys is true.
 	{
+		DoRehashStep();
+
 		const hash_code_t c     = get_hash_code(key);
-		size_type         n     = (size_type)bucket_index(key, c, (uint32_t)mnBucketCount);
-		node_type* const  pNode = DoFindNode(mpBucketArray[n], key, c);
+		node_type**       pBucket = DoGetBucket(key, c);
+		node_type* const  pNode = DoFindNode(*pBucket, key, c);
 
 		if(pNode == NULL)
 		{
@@ -2601,16 +3342,16 @@ namespace eastl
 			#endif
 					if(bRehash.first)
 					{
-						n = (size_type)bucket_index(key, c, (uint32_t)bRehash.second);
-						DoRehash(bRehash.second);
+						DoGrowBuckets(bRehash.second);
+						pBucket = DoGetBucket(key, c);
 					}
 
 					EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-					pNodeNew->mpNext = mpBucketArray[n];
-					mpBucketArray[n] = pNodeNew;
+					pNodeNew->mpNext = *pBucket;
+					*pBucket = pNodeNew;
 					++mnElementCount;
 
-					return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+					return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 			#if EASTL_EXCEPTIONS_ENABLED
 				}
 				catch(...)
@@ -2621,7 +3362,7 @@ namespace eastl
 			#endif
 		}
 
-		return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+		return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 	}
 
 
@@ -2630,13 +3371,15 @@ namespace eastl
 	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertKey(false_type, key_type&& key) // false_type means bUniqueKeys is false.
 	{
+		DoRehashStep();
+
 		const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
 		if(bRehash.first)
-			DoRehash(bRehash.second);
+			DoGrowBuckets(bRehash.second);
 
 		const hash_code_t c = get_hash_code(key);
-		const size_type   n = (size_type)bucket_index(key, c, (uint32_t)mnBucketCount);
+		node_type** const pBucket = DoGetBucket(key, c);
 
 		node_type* const pNodeNew = DoAllocateNodeFromKey(eastl::move(key));
 		set_code(pNodeNew, c); // This is a no-op for most hashtables.
@@ -2647,13 +3390,13 @@ namespace eastl
 		// erase(value) can more quickly find equal values. The downside is that
 		// this insertion operation taking some extra time. How important is it to
 		// us that equal_range span all equal items? 
-		node_type* const pNodePrev = DoFindNode(mpBucketArray[n], key, c);
+		node_type* const pNodePrev = DoFindNode(*pBucket, key, c);
 
 		if(pNodePrev == NULL)
 		{
 			EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-			pNodeNew->mpNext = mpBucketArray[n];
-			mpBucketArray[n] = pNodeNew;
+			pNodeNew->mpNext = *pBucket;
+			*pBucket = pNodeNew;
 		}
 		else
 		{
@@ -2663,7 +3406,7 @@ namespace eastl
 
 		++mnElementCount;
 
-		return iterator(pNodeNew, mpBucketArray + n);
+		return iterator(pNodeNew, pBucket);
 	}
 
 
@@ -2827,7 +3570,7 @@ namespace eastl
 		const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, nElementAdd);
 
 		if(bRehash.first)
-			DoRehash(bRehash.second);
+			DoGrowBuckets(bRehash.second);
 
 		for(; first != last; ++first)
 			DoInsertValue(has_unique_keys_type(), *first);
@@ -2897,15 +3640,25 @@ namespace eastl
 		iterator iNext(i.mpNode, i.mpBucket); // Convert from const_iterator to iterator while constructing.
 		++iNext;
 
-		node_type* pNode        =  i.mpNode;
-		node_type* pNodeCurrent = *i.mpBucket;
+		DoUnlinkNode(i.mpNode, i.mpBucket);
+		DoFreeNode(i.mpNode);
+
+		return iNext;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	inline void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoUnlinkNode(node_type* pNode, node_type** pBucket)
+	{
+		node_type* pNodeCurrent = *pBucket;
 
 		if(pNodeCurrent == pNode)
-			*i.mpBucket = pNodeCurrent->mpNext;
+			*pBucket = pNodeCurrent->mpNext;
 		else
 		{
 			// We have a singly-linked list, so we have no choice but to
-			// walk down it till we find the node before the node at 'i'.
+			// walk down it till we find the node before pNode.
 			node_type* pNodeNext = pNodeCurrent->mpNext;
 
 			while(pNodeNext != pNode)
@@ -2917,10 +3670,198 @@ namespace eastl
 			pNodeCurrent->mpNext = pNodeNext->mpNext;
 		}
 
-		DoFreeNode(pNode);
 		--mnElementCount;
+	}
 
-		return iNext;
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_handle_type
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::extract(const_iterator i)
+	{
+		DoUnlinkNode(i.mpNode, i.mpBucket);
+		return node_handle_type(i.mpNode, &mAllocator);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_handle_type
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::extract(const key_type& k)
+	{
+		const iterator it(find(k));
+
+		if(it != end())
+			return extract(it);
+		return node_handle_type();
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_insert_return_type
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::insert(node_handle_type&& nh)
+	{
+		return DoInsertNode(has_unique_keys_type(), eastl::move(nh));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::insert(const_iterator, node_handle_type&& nh)
+	{
+		return DoInsertNodeHint(has_unique_keys_type(), eastl::move(nh));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertNodeHint(true_type, node_handle_type&& nh) // true_type means bUniqueKeys is true.
+	{
+		// As with the C++ standard, nh is left unchanged if the key is already present.
+		node_insert_return<iterator, node_handle_type> result(DoInsertNode(true_type(), eastl::move(nh)));
+		if(!result.inserted)
+			nh = eastl::move(result.node);
+		return result.position;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertNodeHint(false_type, node_handle_type&& nh) // false_type means bUniqueKeys is false.
+	{
+		return DoInsertNode(false_type(), eastl::move(nh));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	template <typename Source>
+	void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::merge(Source&& source)
+	{
+		if((const void*)&source == (const void*)this)
+			return;
+
+		for(typename remove_reference<Source>::type::iterator it = source.begin(); it != source.end(); )
+		{
+			if(bU && (find(mExtractKey(*it)) != end()))
+				++it;
+			else
+				DoInsertNode(has_unique_keys_type(), source.extract(it++));
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_type*
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoAcquireNode(node_handle_type& nh)
+	{
+		if(nh.get_allocator() == mAllocator)
+			return nh.release();
+
+		// The node's memory can't be freed by our allocator (e.g. it belongs to another fixed
+		// container), so we fall back to moving the value into a node of our own.
+		node_type* const pNodeNew = DoAllocateNode(eastl::move(nh.value()));
+		nh = node_handle_type(); // Frees the source node.
+		return pNodeNew;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	node_insert_return<typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator,
+					   typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_handle_type>
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertNode(true_type, node_handle_type&& nh) // true_type means bUniqueKeys is true.
+	{
+		DoRehashStep();
+
+		node_insert_return<iterator, node_handle_type> result = { end(), false, node_handle_type() };
+
+		if(nh)
+		{
+			// The key refers into nh's node, which DoAcquireNode may free, so we are done with it before then.
+			const key_type&   k     = mExtractKey(nh.value());
+			const hash_code_t c     = get_hash_code(k);
+			node_type**       pBucket = DoGetBucket(k, c);
+			node_type* const  pNode = DoFindNode(*pBucket, k, c);
+
+			if(pNode == NULL)
+			{
+				const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
+
+				if(bRehash.first)
+				{
+					DoGrowBuckets(bRehash.second);
+					pBucket = DoGetBucket(k, c);
+				}
+
+				node_type* const pNodeNew = DoAcquireNode(nh);
+				set_code(pNodeNew, c); // The source container may not have cached the same hash code, as its hash function may differ.
+
+				EASTL_ASSERT((uintptr_t)mpBucketArray != (uintptr_t)&gpEmptyBucketArray[0]);
+				pNodeNew->mpNext = *pBucket;
+				*pBucket = pNodeNew;
+				++mnElementCount;
+
+				result.position = iterator(pNodeNew, pBucket);
+				result.inserted = true;
+			}
+			else
+			{
+				result.position = iterator(pNode, pBucket);
+				result.node     = eastl::move(nh);
+			}
+		}
+
+		return result;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertNode(false_type, node_handle_type&& nh) // false_type means bUniqueKeys is false.
+	{
+		DoRehashStep();
+
+		if(nh)
+		{
+			const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
+
+			if(bRehash.first)
+				DoGrowBuckets(bRehash.second);
+
+			// The key refers into nh's node, which DoAcquireNode may free, so we are done with it before then.
+			const key_type&   k         = mExtractKey(nh.value());
+			const hash_code_t c         = get_hash_code(k);
+			node_type** const pBucket   = DoGetBucket(k, c);
+			node_type* const  pNodePrev = DoFindNode(*pBucket, k, c);
+			node_type* const  pNodeNew  = DoAcquireNode(nh);
+
+			set_code(pNodeNew, c);
+
+			if(pNodePrev == NULL) // Insert equal values contiguously, as DoInsertValueExtra does.
+			{
+				EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
+				pNodeNew->mpNext = *pBucket;
+				*pBucket = pNodeNew;
+			}
+			else
+			{
+				pNodeNew->mpNext  = pNodePrev->mpNext;
+				pNodePrev->mpNext = pNodeNew;
+			}
+
+			++mnElementCount;
+
+			return iterator(pNodeNew, pBucket);
+		}
+
+		return end();
 	}
 
 
@@ -2947,15 +3888,18 @@ namespace eastl
 		// buckets are heavily overloaded; otherwise this mechanism may be slightly slower.
 
 		const hash_code_t c = get_hash_code(k);
-		const size_type   n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
 		const size_type   nElementCountSaved = mnElementCount;
 
-		node_type** pBucketArray = mpBucketArray + n;
+		node_type** pBucketArray = DoGetBucket(k, c);
+
+		#if EASTL_HASHTABLE_STATS
+			++mStatsCounters.mnLookupCount;
+		#endif
 
-		while(*pBucketArray && !compare(k, c, *pBucketArray))
+		while(*pBucketArray && !DoCompare(k, c, *pBucketArray))
 			pBucketArray = &(*pBucketArray)->mpNext;
 
-		while(*pBucketArray && compare(k, c, *pBucketArray))
+		while(*pBucketArray && DoCompare(k, c, *pBucketArray))
 		{
 			node_type* const pNode = *pBucketArray;
 			*pBucketArray = pNode->mpNext;
@@ -2972,6 +3916,7 @@ namespace eastl
 			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
 	inline void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::clear()
 	{
+		DoFreeOldBuckets();
 		DoFreeNodes(mpBucketArray, mnBucketCount);
 		mnElementCount = 0;
 	}
@@ -2982,6 +3927,7 @@ namespace eastl
 			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
 	inline void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::clear(bool clearBuckets)
 	{
+		DoFreeOldBuckets();
 		DoFreeNodes(mpBucketArray, mnBucketCount);
 		if(clearBuckets)
 		{
@@ -3012,6 +3958,7 @@ namespace eastl
 
 		mnElementCount = 0;
 		mRehashPolicy.mnNextResize = 0;
+		SetMigration(NULL, 0, 0);
 	}
 
 
@@ -3030,7 +3977,8 @@ namespace eastl
 	{
 		// Note that we unilaterally use the passed in bucket count; we do not attempt migrate it
 		// up to the next prime number. We leave it at the user's discretion to do such a thing.
-		DoRehash(nBucketCount);
+		// The exception is mask_range_hashing, which requires a power of two.
+		DoRehash(DoGetRehashBucketCount(typename is_same<H2, mask_range_hashing>::type(), nBucketCount));
 	}
 
 
@@ -3039,6 +3987,8 @@ namespace eastl
 			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
 	void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoRehash(size_type nNewBucketCount)
 	{
+		DoFinishRehash(); // In case an incremental rehash is in progress.
+
 		node_type** const pBucketArray = DoAllocateBuckets(nNewBucketCount); // nNewBucketCount should always be >= 2.
 
 		#if EASTL_EXCEPTIONS_ENABLED
@@ -3062,6 +4012,10 @@ namespace eastl
 				DoFreeBuckets(mpBucketArray, mnBucketCount);
 				mnBucketCount = nNewBucketCount;
 				mpBucketArray = pBucketArray;
+
+				#if EASTL_HASHTABLE_STATS
+					++mStatsCounters.mnRehashCount;
+				#endif
 		#if EASTL_EXCEPTIONS_ENABLED
 			}
 			catch(...)
@@ -3079,6 +4033,141 @@ namespace eastl
 	}
 
 
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoGrowBuckets(size_type nNewBucketCount)
+	{
+		// The shared gpEmptyBucketArray (mnBucketCount == 1) can't be linked to a new array, 
+		// and holds no nodes to migrate anyway.
+		if(incremental_rehash_base_type::kIncrementalRehash && (mnBucketCount > 1))
+		{
+			DoFinishRehash(); // In case insertions outpaced the previous migration, which is possible if there were many erasures in between.
+
+			node_type** const pBucketArray = DoAllocateBuckets(nNewBucketCount);
+
+			// Nodes stay where they are for now. We link the old array's sentinel to the new array,
+			// so that iteration continues from the end of the old array into the new one.
+			mpBucketArray[mnBucketCount] = reinterpret_cast<node_type*>((uintptr_t)pBucketArray | 1);
+			SetMigration(mpBucketArray, mnBucketCount, 0);
+			mpBucketArray = pBucketArray;
+			mnBucketCount = nNewBucketCount;
+
+			#if EASTL_HASHTABLE_STATS
+				++mStatsCounters.mnRehashCount;
+			#endif
+		}
+		else
+			DoRehash(nNewBucketCount);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoMigrateBuckets(size_type nBucketCount)
+	{
+		node_type** const pOldBucketArray = GetOldBucketArray();
+		const size_type   nOldBucketCount = GetOldBucketCount();
+		size_type         i               = GetMigrateIndex();
+		const size_type   iEnd            = ((nOldBucketCount - i) > nBucketCount) ? (i + nBucketCount) : nOldBucketCount;
+
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+		#endif
+				node_type* pNode;
+
+				for(; i < iEnd; ++i)
+				{
+					while((pNode = pOldBucketArray[i]) != NULL)
+					{
+						const size_type nNewBucketIndex = (size_type)bucket_index(pNode, (uint32_t)mnBucketCount);
+
+						pOldBucketArray[i] = pNode->mpNext;
+						pNode->mpNext      = mpBucketArray[nNewBucketIndex];
+						mpBucketArray[nNewBucketIndex] = pNode;
+					}
+				}
+		#if EASTL_EXCEPTIONS_ENABLED
+			}
+			catch(...)
+			{
+				// As with DoRehash, a hash function threw an exception and we can't restore the previous state.
+				DoFreeOldBuckets();
+				DoFreeNodes(mpBucketArray, mnBucketCount);
+				mnElementCount = 0;
+				throw;
+			}
+		#endif
+
+		if(i == nOldBucketCount) // If the migration is complete...
+		{
+			DoFreeBuckets(pOldBucketArray, nOldBucketCount);
+			SetMigration(NULL, 0, 0);
+		}
+		else
+			SetMigration(pOldBucketArray, nOldBucketCount, i);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	inline void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoFreeOldBuckets()
+	{
+		// Frees the nodes which an incremental rehash has yet to migrate, along with their bucket array.
+		if(node_type** const pOldBucketArray = GetOldBucketArray())
+		{
+			DoFreeNodes(pOldBucketArray, GetOldBucketCount());
+			DoFreeBuckets(pOldBucketArray, GetOldBucketCount());
+			SetMigration(NULL, 0, 0);
+		}
+	}
+
+
+	#if EASTL_HASHTABLE_STATS
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	hashtable_stats hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::get_stats() const
+	{
+		hashtable_stats stats;
+		static_cast<hashtable_stats_counters&>(stats) = mStatsCounters;
+
+		for(size_type i = 0; i < mnBucketCount; ++i)
+		{
+			size_t nChainLength = 0;
+
+			for(const node_type* pNode = mpBucketArray[i]; pNode; pNode = pNode->mpNext)
+				++nChainLength;
+
+			stats.add_chain(nChainLength);
+		}
+
+		// Buckets which an incremental rehash has yet to migrate count as chains of their own.
+		if(const node_type* const* const pOldBucketArray = GetOldBucketArray())
+		{
+			for(size_type i = GetMigrateIndex(); i < GetOldBucketCount(); ++i)
+			{
+				size_t nChainLength = 0;
+
+				for(const node_type* pNode = pOldBucketArray[i]; pNode; pNode = pNode->mpNext)
+					++nChainLength;
+
+				stats.add_chain(nChainLength);
+			}
+		}
+
+		return stats;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	inline void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::reset_stats()
+	{
+		mStatsCounters.reset_counters();
+	}
+	#endif
+
+
 	template <typename K, typename V, typename A, typename EK, typename Eq,
 			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
 	inline bool hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::validate() const
@@ -3111,6 +4200,23 @@ namespace eastl
 				return false;
 		}
 
+		// Verify the state of an incremental rehash, if one is in progress. The old bucket array 
+		// must be linked to ours, and the buckets which have been migrated must be empty.
+		if(node_type** const pOldBucketArray = GetOldBucketArray())
+		{
+			if((GetOldBucketCount() < 2) || (GetMigrateIndex() >= GetOldBucketCount()))
+				return false;
+
+			if(pOldBucketArray[GetOldBucketCount()] != reinterpret_cast<node_type*>((uintptr_t)mpBucketArray | 1))
+				return false;
+
+			for(size_type i = 0; i < GetMigrateIndex(); ++i)
+			{
+				if(pOldBucketArray[i])
+					return false;
+			}
+		}
+
 		// Verify that the element count matches mnElementCount. 
 		size_type nElementCount = 0;
 
@@ -28,6 +28,7 @@
 #include <EASTL/functional.h>
 #include <EASTL/utility.h>
 #include <EASTL/algorithm.h>
+#include <EASTL/span.h>
 
 #ifdef _MSC_VER
 	#pragma warning(push, 0)
@@ -284,7 +285,8 @@ namespace eastl
 
 		enum
 		{
-			kBucketCount = bucketCount
+			kBucketCount        = bucketCount,
+			kFindBatchGroupSize = 16            // The number of keys whose lookups find_batch overlaps.
 		};
 
 	protected:
@@ -293,6 +295,10 @@ namespace eastl
 		Hash       mHash;           // To do: Use base class optimization to make this go away when it is of zero size.
 		Equal      mEqual;          // To do: Use base class optimization to make this go away when it is of zero size.
 
+		#if EASTL_HASHTABLE_STATS
+			mutable hashtable_stats_counters mStatsCounters; // Mutable because lookups are const. mnHashCodeRejectCount and mnRehashCount are always 0.
+		#endif
+
 	public:
 		intrusive_hashtable(const Hash&, const Equal&);
 
@@ -416,6 +422,12 @@ namespace eastl
 
 		size_type      count(const key_type& k) const;
 
+		/// See hashtable::find_batch. As the bucket array is part of the container, the
+		/// prefetching mostly pays off for the nodes, which are usually scattered in memory.
+		void      find_batch(eastl::span<const key_type> keys, eastl::span<iterator> results);
+		void      find_batch(eastl::span<const key_type> keys, eastl::span<const_iterator> results) const;
+		size_type contains_batch(eastl::span<const key_type> keys, eastl::span<bool> results) const;
+
 		// The use for equal_range in a hash_table seems somewhat questionable.
 		// The primary reason for its existence is to replicate the interface of set/map.
 		eastl::pair<iterator, iterator>             equal_range(const key_type& k);
@@ -425,6 +437,12 @@ namespace eastl
 		bool validate() const;
 		int  validate_iterator(const_iterator i) const;
 
+		#if EASTL_HASHTABLE_STATS
+			/// See hashtable::get_stats.
+			hashtable_stats get_stats() const;
+			void            reset_stats();
+		#endif
+
 	public:
 		Hash hash_function() const
 			{ return mHash; }
@@ -447,6 +465,16 @@ namespace eastl
 		template <typename U, typename BinaryPredicate>
 		node_type* DoFindNode(node_type* pNode, const U& u, BinaryPredicate predicate) const;
 
+		template <typename Result>
+		size_type DoFindBatch(const key_type* pKeys, size_type nKeyCount, Result* pResults) const;
+
+		template <typename Iterator> // Iterator is iterator or const_iterator, which are the same type for intrusive_hash_set.
+		void DoSetBatchResult(Iterator& result, node_type* pNode, size_type n) const
+			{ result = pNode ? Iterator(pNode, const_cast<node_type**>(mBucketArray) + n) : Iterator(const_cast<node_type**>(mBucketArray) + kBucketCount); }
+
+		void DoSetBatchResult(bool& result, node_type* pNode, size_type) const
+			{ result = (pNode != NULL); }
+
 	}; // class intrusive_hashtable
 
 
@@ -557,6 +585,72 @@ namespace eastl
 	}
 
 
+	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
+	inline void intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::find_batch(eastl::span<const key_type> keys, eastl::span<iterator> results)
+	{
+		EASTL_ASSERT(results.size() >= keys.size());
+		DoFindBatch(keys.data(), (size_type)keys.size(), results.data());
+	}
+
+
+	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
+	inline void intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::find_batch(eastl::span<const key_type> keys, eastl::span<const_iterator> results) const
+	{
+		EASTL_ASSERT(results.size() >= keys.size());
+		DoFindBatch(keys.data(), (size_type)keys.size(), results.data());
+	}
+
+
+	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
+	inline typename intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::size_type
+	intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::contains_batch(eastl::span<const key_type> keys, eastl::span<bool> results) const
+	{
+		EASTL_ASSERT(results.size() >= keys.size());
+		return DoFindBatch(keys.data(), (size_type)keys.size(), results.data());
+	}
+
+
+	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
+	template <typename Result>
+	typename intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::size_type
+	intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::DoFindBatch(const key_type* pKeys, size_type nKeyCount, Result* pResults) const
+	{
+		size_type  buckets[kFindBatchGroupSize];
+		node_type* nodes[kFindBatchGroupSize];
+		size_type  nFoundCount = 0;
+
+		for(size_type i = 0; i < nKeyCount; i += kFindBatchGroupSize)
+		{
+			const key_type* const pGroupKeys  = pKeys + i;
+			const size_type       nGroupCount = eastl::min_alt(nKeyCount - i, (size_type)kFindBatchGroupSize);
+			size_type             j;
+
+			for(j = 0; j < nGroupCount; ++j)
+			{
+				buckets[j] = (size_type)(mHash(pGroupKeys[j]) % kBucketCount);
+				EASTL_PREFETCH(mBucketArray + buckets[j]);
+			}
+
+			for(j = 0; j < nGroupCount; ++j)
+			{
+				nodes[j] = mBucketArray[buckets[j]];
+				EASTL_PREFETCH(nodes[j]);
+			}
+
+			for(j = 0; j < nGroupCount; ++j)
+			{
+				node_type* const pNode = DoFindNode(nodes[j], pGroupKeys[j]);
+
+				DoSetBatchResult(pResults[i + j], pNode, buckets[j]);
+				if(pNode)
+					++nFoundCount;
+			}
+		}
+
+		return nFoundCount;
+	}
+
+
 	/// intrusive_hashtable_find
 	///
 	/// Helper function that defaults to using hash<U> and equal_to_2<T, U>.
@@ -609,10 +703,18 @@ namespace eastl
 		size_type   result = 0;
 		extract_key extractKey; // extract_key is empty and thus this ctor is a no-op.
 
+		#if EASTL_HASHTABLE_STATS
+			++mStatsCounters.mnLookupCount;
+		#endif
+
 		// To do: Make a specialization for bU (unique keys) == true and take 
 		// advantage of the fact that the count will always be zero or one in that case. 
 		for(node_type* pNode = mBucketArray[n]; pNode; pNode = static_cast<node_type*>(pNode->mpNext))
 		{
+			#if EASTL_HASHTABLE_STATS
+				++mStatsCounters.mnProbeCount;
+				++mStatsCounters.mnKeyCompareCount;
+			#endif
 			if(mEqual(k, extractKey(*pNode)))
 				++result;
 		}
@@ -696,8 +798,16 @@ namespace eastl
 	{
 		extract_key extractKey; // extract_key is empty and thus this ctor is a no-op.
 
+		#if EASTL_HASHTABLE_STATS
+			++mStatsCounters.mnLookupCount;
+		#endif
+
 		for(; pNode; pNode = static_cast<node_type*>(pNode->mpNext))
 		{
+			#if EASTL_HASHTABLE_STATS
+				++mStatsCounters.mnProbeCount;
+				++mStatsCounters.mnKeyCompareCount;
+			#endif
 			if(mEqual(k, extractKey(*pNode)))
 				return pNode;
 		}
@@ -712,8 +822,16 @@ namespace eastl
 	{
 		extract_key extractKey; // extract_key is empty and thus this ctor is a no-op.
 
+		#if EASTL_HASHTABLE_STATS
+			++mStatsCounters.mnLookupCount;
+		#endif
+
 		for(; pNode; pNode = static_cast<node_type*>(pNode->mpNext))
 		{
+			#if EASTL_HASHTABLE_STATS
+				++mStatsCounters.mnProbeCount;
+				++mStatsCounters.mnKeyCompareCount;
+			#endif
 			if(predicate(extractKey(*pNode), other)) // Intentionally compare with key as first arg and other as second arg.
 				return pNode;
 		}
@@ -887,6 +1005,35 @@ namespace eastl
 	}
 
 
+	#if EASTL_HASHTABLE_STATS
+	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
+	hashtable_stats intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::get_stats() const
+	{
+		hashtable_stats stats;
+		static_cast<hashtable_stats_counters&>(stats) = mStatsCounters;
+
+		for(size_type i = 0; i < kBucketCount; ++i)
+		{
+			size_t nChainLength = 0;
+
+			for(const node_type* pNode = mBucketArray[i]; pNode; pNode = static_cast<const node_type*>(pNode->mpNext))
+				++nChainLength;
+
+			stats.add_chain(nChainLength);
+		}
+
+		return stats;
+	}
+
+
+	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
+	inline void intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::reset_stats()
+	{
+		mStatsCounters.reset_counters();
+	}
+	#endif
+
+
 	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
 	inline bool intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::validate() const
 	{
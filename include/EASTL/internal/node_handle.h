@@ -0,0 +1,199 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements node_handle, the type returned by the extract function
+// of the node-based associative containers (map, set, hash_map, hash_set and
+// their multi and fixed variants), as well as node_insert_return, the type
+// returned by inserting a node handle into a container with unique keys.
+//
+// A node handle owns a node which has been unlinked from its container without
+// being freed. It can be inserted into another container of a compatible type
+// (e.g. from a map into a multimap with the same key, value and allocator
+// types), or back into the same container after changing its key, without
+// allocating a new node or copying the value.
+//
+// This corresponds to the C++17 node handle, with one difference: the handle
+// refers to the allocator of the container it was extracted from rather than
+// holding a copy of it, because the allocators of the fixed containers own
+// their memory and can't be copied meaningfully. A node handle therefore must
+// be inserted or destroyed before its source container is destroyed.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_NODE_HANDLE_H
+#define EASTL_INTERNAL_NODE_HANDLE_H
+
+
+#include <EABase/eabase.h>
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/utility.h>
+
+
+namespace eastl
+{
+
+	/// node_handle
+	///
+	/// Owns a node extracted from a node-based container. Node is the container's
+	/// node type, which stores the element as mValue. Allocator is the container's
+	/// allocator type, through which the node is freed if the handle is destroyed
+	/// while it still owns the node.
+	///
+	/// Example usage:
+	///     eastl::map<int, Widget> widgetMap;
+	///     ...
+	///     auto nh = widgetMap.extract(17);   // No memory is freed.
+	///     nh.key() = 42;                     // Re-key the element in place.
+	///     widgetMap.insert(eastl::move(nh)); // No memory is allocated.
+	///
+	template <typename Node, typename Key, typename ExtractKey, typename Allocator>
+	class node_handle
+	{
+	public:
+		typedef node_handle<Node, Key, ExtractKey, Allocator> this_type;
+		typedef Node                                           container_node_type;
+		typedef decltype(Node::mValue)                         value_type;
+		typedef Key                                            key_type;
+		typedef Allocator                                      allocator_type;
+
+	public:
+		EA_CONSTEXPR node_handle() EA_NOEXCEPT
+			: mpNode(NULL), mpAllocator(NULL) {}
+
+		/// Used by the containers. The handle takes ownership of pNode, which must have
+		/// been allocated from *pAllocator.
+		node_handle(container_node_type* pNode, allocator_type* pAllocator) EA_NOEXCEPT
+			: mpNode(pNode), mpAllocator(pAllocator) {}
+
+		node_handle(this_type&& x) EA_NOEXCEPT
+			: mpNode(x.mpNode), mpAllocator(x.mpAllocator)
+		{
+			x.mpNode      = NULL;
+			x.mpAllocator = NULL;
+		}
+
+		~node_handle()
+		{
+			reset();
+		}
+
+		this_type& operator=(this_type&& x) EA_NOEXCEPT
+		{
+			if(&x != this)
+			{
+				reset();
+				mpNode        = x.mpNode;
+				mpAllocator   = x.mpAllocator;
+				x.mpNode      = NULL;
+				x.mpAllocator = NULL;
+			}
+			return *this;
+		}
+
+		node_handle(const this_type&) = delete;
+		this_type& operator=(const this_type&) = delete;
+
+		bool empty() const EA_NOEXCEPT
+			{ return mpNode == NULL; }
+
+		explicit operator bool() const EA_NOEXCEPT
+			{ return mpNode != NULL; }
+
+		/// Returns the allocator of the container the node was extracted from.
+		/// The handle must not be empty.
+		allocator_type& get_allocator() const
+		{
+			EASTL_ASSERT(mpAllocator != NULL);
+			return *mpAllocator;
+		}
+
+		/// Returns the element. The handle must not be empty.
+		value_type& value() const
+		{
+			EASTL_ASSERT(mpNode != NULL);
+			return mpNode->mValue;
+		}
+
+		/// Returns a modifiable reference to the element's key, which is otherwise const
+		/// within a container. The handle must not be empty.
+		key_type& key() const
+		{
+			EASTL_ASSERT(mpNode != NULL);
+			return const_cast<key_type&>(ExtractKey()(mpNode->mValue));
+		}
+
+		/// Returns the mapped value of a map element. The handle must not be empty.
+		template <typename V = value_type>
+		typename V::second_type& mapped() const
+		{
+			EASTL_ASSERT(mpNode != NULL);
+			return mpNode->mValue.second;
+		}
+
+		void swap(this_type& x) EA_NOEXCEPT
+		{
+			eastl::swap(mpNode,      x.mpNode);
+			eastl::swap(mpAllocator, x.mpAllocator);
+		}
+
+		/// Used by the containers. Gives up ownership of the node without freeing it.
+		container_node_type* release() EA_NOEXCEPT
+		{
+			container_node_type* const pNode = mpNode;
+			mpNode      = NULL;
+			mpAllocator = NULL;
+			return pNode;
+		}
+
+	protected:
+		void reset()
+		{
+			if(mpNode)
+			{
+				mpNode->~container_node_type();
+				EASTLFree(*mpAllocator, mpNode, sizeof(container_node_type));
+				mpNode      = NULL;
+				mpAllocator = NULL;
+			}
+		}
+
+	protected:
+		container_node_type* mpNode;
+		allocator_type*      mpAllocator;
+	};
+
+
+	template <typename Node, typename Key, typename ExtractKey, typename Allocator>
+	inline void swap(node_handle<Node, Key, ExtractKey, Allocator>& a, node_handle<Node, Key, ExtractKey, Allocator>& b) EA_NOEXCEPT
+	{
+		a.swap(b);
+	}
+
+
+
+	/// node_insert_return
+	///
+	/// The result of inserting a node handle into a container with unique keys.
+	/// If the insertion failed because an element with an equivalent key was
+	/// already present, position refers to that element and node still owns
+	/// the node that was passed in.
+	///
+	template <typename Iterator, typename NodeHandle>
+	struct node_insert_return
+	{
+		Iterator   position;
+		bool       inserted;
+		NodeHandle node;
+	};
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
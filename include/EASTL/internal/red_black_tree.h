@@ -20,6 +20,8 @@
 #include <EASTL/algorithm.h>
 #include <EASTL/initializer_list.h>
 #include <EASTL/tuple.h>
+#include <EASTL/internal/node_handle.h>
+#include <EASTL/internal/assume_sorted_t.h>
 
 EA_DISABLE_ALL_VC_WARNINGS()
 #include <new>
@@ -54,6 +56,43 @@ namespace eastl
 	#endif
 
 
+	/// EASTL_RBTREE_COMPACT_NODES
+	///
+	/// Defined as 0 or 1. Default is 0.
+	/// If enabled, rbtree_node_base stores the node color in the low bit of the
+	/// parent pointer rather than in a member of its own. The color member is
+	/// otherwise padded out to the size of a pointer, so this makes every map,
+	/// multimap, set and multiset node a pointer smaller, at the cost of masking
+	/// the parent pointer whenever it is used.
+	///
+	/// This changes the node layout used by the non-templated functions in
+	/// red_black_tree.cpp, so it must have the same value for the EASTL library
+	/// and all code which uses it. The CMake build has an option of the same name.
+	///
+	#ifndef EASTL_RBTREE_COMPACT_NODES
+		#define EASTL_RBTREE_COMPACT_NODES 0
+	#endif
+
+
+	/// EASTL_RBTREE_ORDER_STATISTICS
+	///
+	/// Defined as 0 or 1. Default is 0.
+	/// If enabled, every rbtree node also stores the size of the subtree rooted at
+	/// it, which the insertion, erasure and rotation functions keep up to date.
+	/// This gives map, multimap, set and multiset the order statistic functions
+	/// select (the element at a given index) and rank (the index of a key), and
+	/// makes eastl::distance between their iterators O(log n) rather than O(n).
+	/// It costs one size_t per node.
+	///
+	/// As with EASTL_RBTREE_COMPACT_NODES, this changes the node layout used by
+	/// red_black_tree.cpp, so it must have the same value for the EASTL library
+	/// and all code which uses it. The CMake build has an option of the same name.
+	///
+	#ifndef EASTL_RBTREE_ORDER_STATISTICS
+		#define EASTL_RBTREE_ORDER_STATISTICS 0
+	#endif
+
+
 
 	/// RBTreeColor
 	///
@@ -85,6 +124,9 @@ namespace eastl
 	/// viewing of an rbtree harder, given that the node pointers are of type 
 	/// rbtree_node_base and not rbtree_node.
 	///
+	/// The parent and color are accessed via parent/set_parent and color/set_color,
+	/// as with EASTL_RBTREE_COMPACT_NODES they share a member.
+	///
 	struct rbtree_node_base
 	{
 		typedef rbtree_node_base this_type;
@@ -92,8 +134,30 @@ namespace eastl
 	public:
 		this_type* mpNodeRight;  // Declared first because it is used most often.
 		this_type* mpNodeLeft;
+	#if EASTL_RBTREE_COMPACT_NODES
+		uintptr_t  mnNodeParentColor; // The parent pointer, with the color in its low bit. Nodes are at least pointer-aligned, so this bit is otherwise zero.
+	#else
 		this_type* mpNodeParent;
-		char       mColor;       // We only need one bit here, would be nice if we could stuff that bit somewhere else.
+		char       mColor;       // We only need one bit here. See EASTL_RBTREE_COMPACT_NODES.
+	#endif
+	#if EASTL_RBTREE_ORDER_STATISTICS
+		size_t     mnSubtreeSize; // The number of nodes in the subtree rooted at this node, including itself. Unused in the anchor.
+	#endif
+
+	public:
+	#if EASTL_RBTREE_COMPACT_NODES
+		this_type* parent() const                                   { return (this_type*)(mnNodeParentColor & ~(uintptr_t)1); }
+		char       color() const                                    { return (char)(mnNodeParentColor & 1); }
+		void       set_parent(this_type* pNode)                     { mnNodeParentColor = (uintptr_t)pNode | (mnNodeParentColor & 1); }
+		void       set_color(char color)                            { mnNodeParentColor = (mnNodeParentColor & ~(uintptr_t)1) | (uintptr_t)color; }
+		void       set_parent_and_color(this_type* pNode, char color) { mnNodeParentColor = (uintptr_t)pNode | (uintptr_t)color; }
+	#else
+		this_type* parent() const                                   { return mpNodeParent; }
+		char       color() const                                    { return mColor; }
+		void       set_parent(this_type* pNode)                     { mpNodeParent = pNode; }
+		void       set_color(char color)                            { mColor = color; }
+		void       set_parent_and_color(this_type* pNode, char color) { mpNodeParent = pNode; mColor = color; }
+	#endif
 	};
 
 
@@ -139,6 +203,19 @@ namespace eastl
 														  RBTreeSide insertionSide);
 	EASTL_API void              RBTreeErase        (      rbtree_node_base* pNode,
 														  rbtree_node_base* pNodeAnchor); 
+	EASTL_API void              RBTreeJoin         (      rbtree_node_base* pNodeAnchor,
+														  rbtree_node_base* pNodeAnchorRight);
+	EASTL_API void              RBTreeSplit        (      rbtree_node_base* pNodeAnchor,
+														  rbtree_node_base* pNode,
+														  rbtree_node_base* pNodeAnchorRight);
+
+	#if EASTL_RBTREE_ORDER_STATISTICS
+		EASTL_API size_t            RBTreeGetIndex     (const rbtree_node_base* pNode);
+		EASTL_API rbtree_node_base* RBTreeSelect       (const rbtree_node_base* pNodeRoot, size_t nIndex);
+
+		inline size_t RBTreeGetSubtreeSize(const rbtree_node_base* pNode)
+			{ return pNode ? pNode->mnSubtreeSize : 0; }
+	#endif
 
 
 
@@ -358,6 +435,11 @@ namespace eastl
 		typedef integral_constant<bool, bUniqueKeys>                                            has_unique_keys_type;
 		typedef typename base_type::extract_key                                                 extract_key;
 
+		// The C++17 node_type and insert_return_type. They have different names here, as node_type and
+		// insert_return_type already refer to the tree node and to the result of inserting a value.
+		typedef node_handle<node_type, key_type, extract_key, allocator_type>                   node_handle_type;
+		typedef typename type_select<bUniqueKeys, node_insert_return<iterator, node_handle_type>, iterator>::type node_insert_return_type;
+
 		using base_type::mCompare;
 
 	public:
@@ -377,6 +459,13 @@ namespace eastl
 		template <typename InputIterator>
 		rbtree(InputIterator first, InputIterator last, const Compare& compare, const allocator_type& allocator = EASTL_RBTREE_DEFAULT_ALLOCATOR);
 
+		/// Constructs the tree from a range which is already sorted by compare and, for map
+		/// and set, has no equivalent keys. With forward iterators the tree is built directly
+		/// in linear time instead of by inserting each value. The constructor above checks
+		/// whether a forward iterator range is sorted and if so takes the same path.
+		template <typename InputIterator>
+		rbtree(assume_sorted_t, InputIterator first, InputIterator last, const Compare& compare, const allocator_type& allocator = EASTL_RBTREE_DEFAULT_ALLOCATOR);
+
 	   ~rbtree();
 
 	public:
@@ -459,15 +548,44 @@ namespace eastl
 		template <typename InputIterator>
 		void insert(InputIterator first, InputIterator last);
 
-		// TODO(rparolin):
-		// insert_return_type insert(node_type&& nh);
-		// iterator insert(const_iterator hint, node_type&& nh);
+		/// Inserts the node owned by nh without allocating memory, unless nh's allocator doesn't
+		/// compare equal to ours (as with two fixed containers), in which case the value is moved
+		/// into a new node. An empty handle inserts nothing. map::insert and set::insert return a
+		/// node_insert_return, whose node still owns the node if an equivalent key was present.
+		node_insert_return_type insert(node_handle_type&& nh);
+		iterator                insert(const_iterator hint, node_handle_type&& nh);
 
 		template <class M> pair<iterator, bool> insert_or_assign(const key_type& k, M&& obj);
 		template <class M> pair<iterator, bool> insert_or_assign(key_type&& k, M&& obj);
 		template <class M> iterator             insert_or_assign(const_iterator hint, const key_type& k, M&& obj);
 		template <class M> iterator             insert_or_assign(const_iterator hint, key_type&& k, M&& obj);
 
+		/// Unlinks the element from the tree and returns a handle which owns its node,
+		/// without freeing memory or moving the element.
+		node_handle_type extract(const_iterator position);
+		node_handle_type extract(const key_type& key);
+
+		/// Moves the nodes of all elements of source whose keys aren't present here (or all
+		/// elements, for multimap and multiset) into this container. source may be any map or
+		/// set with the same node handle type, regardless of its comparison function.
+		template <typename Source>
+		void merge(Source&& source);
+
+		/// join moves all the elements of x to the end of this container, leaving x empty. Every key
+		/// in x must be greater than every key here (or not less, for multimap and multiset). split
+		/// moves all the elements whose keys are not less than key into x, replacing its contents.
+		/// Both relink nodes rather than moving values, in O(log n) time. split also counts the
+		/// elements it moves, which takes O(log n) time with EASTL_RBTREE_ORDER_STATISTICS and
+		/// is otherwise linear. If the allocators differ, the values are moved one at a time.
+		///
+		/// Example usage:
+		///     map<int, Order> later;
+		///     orders.split(nTime, later); // orders keeps the elements before nTime.
+		///     orders.join(later);         // And now it has all of them again.
+		///
+		void join(this_type& x);
+		void split(const key_type& key, this_type& x);
+
 		iterator         erase(const_iterator position);
 		iterator         erase(const_iterator first, const_iterator last);
 		reverse_iterator erase(const_reverse_iterator position);
@@ -507,6 +625,64 @@ namespace eastl
 		iterator       upper_bound(const key_type& key);
 		const_iterator upper_bound(const key_type& key) const;
 
+		bool contains(const key_type& key) const
+			{ return find(key) != end(); }
+
+		/// Heterogeneous lookup
+		///
+		/// The following overloads accept a key of any type U which the comparison can
+		/// be called with (in both argument orders), and are available only if Compare
+		/// defines the member type is_transparent, as less<void> does. This allows, for
+		/// example, lookups via string_view or char pointers in a set of strings without
+		/// constructing a temporary string. map, multimap, set and multiset provide the
+		/// same for count, equal_range and erase.
+		///
+		/// Example usage:
+		///     set<string, less<void>> strings;
+		///     strings.find(string_view("hello"));
+		///
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type find(const U& u)
+			{ return find_as(u, mCompare); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type find(const U& u) const
+			{ return find_as(u, mCompare); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, bool>::type contains(const U& u) const
+			{ return find_as(u, mCompare) != end(); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type lower_bound(const U& u);
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type lower_bound(const U& u) const;
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type upper_bound(const U& u);
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type upper_bound(const U& u) const;
+
+	#if EASTL_RBTREE_ORDER_STATISTICS
+		/// Order statistics
+		///
+		/// select returns an iterator to the element at index n in the sorted sequence, or
+		/// end() if n >= size(). rank returns the number of elements whose keys are less
+		/// than key, which is the index of lower_bound(key). Both take O(log n) time.
+		/// These are available only with EASTL_RBTREE_ORDER_STATISTICS.
+		///
+		/// Example usage:
+		///     multiset<int> scores;
+		///     int median = *scores.select(scores.size() / 2);
+		///     size_type nBelow = scores.rank(score);
+		///
+		iterator       select(size_type n);
+		const_iterator select(size_type n) const;
+		size_type      rank(const key_type& key) const;
+	#endif
+
 		bool validate() const;
 		int  validate_iterator(const_iterator i) const;
 
@@ -525,6 +701,22 @@ namespace eastl
 		node_type* DoCopySubtree(const node_type* pNodeSource, node_type* pNodeDest);
 		void       DoNukeSubtree(node_type* pNode);
 
+		template <typename InputIterator>
+		void DoInitFromRange(InputIterator first, InputIterator last, EASTL_ITC_NS::input_iterator_tag);
+		template <typename ForwardIterator>
+		void DoInitFromRange(ForwardIterator first, ForwardIterator last, EASTL_ITC_NS::forward_iterator_tag);
+
+		template <typename InputIterator>
+		void DoInitFromSortedRange(InputIterator first, InputIterator last, EASTL_ITC_NS::input_iterator_tag);
+		template <typename ForwardIterator>
+		void DoInitFromSortedRange(ForwardIterator first, ForwardIterator last, EASTL_ITC_NS::forward_iterator_tag);
+
+		template <typename ForwardIterator>
+		bool DoIsSortedRange(ForwardIterator first, ForwardIterator last) const;
+
+		template <typename ForwardIterator>
+		node_type* DoBuildSortedSubtree(ForwardIterator& first, size_type n, size_type nDepth, size_type nRedDepth);
+
 		template <class... Args>
 		eastl::pair<iterator, bool> DoInsertValue(true_type, Args&&... args);
 
@@ -554,6 +746,19 @@ namespace eastl
 		node_type* DoGetKeyInsertionPositionUniqueKeysHint(const_iterator position, bool& bForceToLeft, const key_type& key);
 		node_type* DoGetKeyInsertionPositionNonuniqueKeysHint(const_iterator position, bool& bForceToLeft, const key_type& key);
 
+		node_type* DoAcquireNode(node_handle_type& nh);
+
+		node_insert_return<iterator, node_handle_type> DoInsertNode(true_type, node_handle_type&& nh);
+		iterator                                       DoInsertNode(false_type, node_handle_type&& nh);
+
+		iterator DoInsertNodeHint(true_type, const_iterator position, node_handle_type&& nh);
+		iterator DoInsertNodeHint(false_type, const_iterator position, node_handle_type&& nh);
+
+		template <typename Source>
+		void DoMerge(true_type, Source& source);
+		template <typename Source>
+		void DoMerge(false_type, Source& source);
+
 	}; // rbtree
 
 
@@ -681,6 +886,22 @@ namespace eastl
 	}
 
 
+	#if EASTL_RBTREE_ORDER_STATISTICS
+		/// distance
+		///
+		/// With EASTL_RBTREE_ORDER_STATISTICS, the distance between two rbtree iterators
+		/// is the difference of their indexes, which is found in O(log n) time from the
+		/// subtree sizes. This is picked over the generic distance (which would increment
+		/// first until it reaches last) as it is more specialized.
+		///
+		template <typename T, typename Pointer, typename Reference>
+		inline ptrdiff_t distance(rbtree_iterator<T, Pointer, Reference> first, rbtree_iterator<T, Pointer, Reference> last)
+		{
+			return (ptrdiff_t)RBTreeGetIndex(last.mpNode) - (ptrdiff_t)RBTreeGetIndex(first.mpNode);
+		}
+	#endif
+
+
 
 
 	///////////////////////////////////////////////////////////////////////
@@ -727,11 +948,11 @@ namespace eastl
 	{
 		reset_lose_memory();
 
-		if(x.mAnchor.mpNodeParent) // mAnchor.mpNodeParent is the rb_tree root node.
+		if(x.mAnchor.parent()) // mAnchor.parent() is the rb_tree root node.
 		{
-			mAnchor.mpNodeParent = DoCopySubtree((const node_type*)x.mAnchor.mpNodeParent, (node_type*)&mAnchor);
-			mAnchor.mpNodeRight  = RBTreeGetMaxChild(mAnchor.mpNodeParent);
-			mAnchor.mpNodeLeft   = RBTreeGetMinChild(mAnchor.mpNodeParent);
+			mAnchor.set_parent(DoCopySubtree((const node_type*)x.mAnchor.parent(), (node_type*)&mAnchor));
+			mAnchor.mpNodeRight  = RBTreeGetMaxChild(mAnchor.parent());
+			mAnchor.mpNodeLeft   = RBTreeGetMinChild(mAnchor.parent());
 			mnSize               = x.mnSize;
 		}
 	}
@@ -769,21 +990,20 @@ namespace eastl
 		  mAllocator(allocator)
 	{
 		reset_lose_memory();
+		DoInitFromRange(first, last, typename eastl::iterator_traits<InputIterator>::iterator_category());
+	}
 
-		#if EASTL_EXCEPTIONS_ENABLED
-			try
-			{
-		#endif
-				for(; first != last; ++first)
-					insert(*first);
-		#if EASTL_EXCEPTIONS_ENABLED
-			}
-			catch(...)
-			{
-				clear();
-				throw;
-			}
-		#endif
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename InputIterator>
+	inline rbtree<K, V, C, A, E, bM, bU>::rbtree(assume_sorted_t, InputIterator first, InputIterator last, const C& compare, const allocator_type& allocator)
+		: base_type(compare),
+		  mAnchor(),
+		  mnSize(0),
+		  mAllocator(allocator)
+	{
+		reset_lose_memory();
+		DoInitFromSortedRange(first, last, typename eastl::iterator_traits<InputIterator>::iterator_category());
 	}
 
 
@@ -792,7 +1012,7 @@ namespace eastl
 	{
 		// Erase the entire tree. DoNukeSubtree is not a 
 		// conventional erase function, as it does no rebalancing.
-		DoNukeSubtree((node_type*)mAnchor.mpNodeParent);
+		DoNukeSubtree((node_type*)mAnchor.parent());
 	}
 
 
@@ -916,11 +1136,11 @@ namespace eastl
 
 			base_type::mCompare = x.mCompare;
 
-			if(x.mAnchor.mpNodeParent) // mAnchor.mpNodeParent is the rb_tree root node.
+			if(x.mAnchor.parent()) // mAnchor.parent() is the rb_tree root node.
 			{
-				mAnchor.mpNodeParent = DoCopySubtree((const node_type*)x.mAnchor.mpNodeParent, (node_type*)&mAnchor);
-				mAnchor.mpNodeRight  = RBTreeGetMaxChild(mAnchor.mpNodeParent);
-				mAnchor.mpNodeLeft   = RBTreeGetMinChild(mAnchor.mpNodeParent);
+				mAnchor.set_parent(DoCopySubtree((const node_type*)x.mAnchor.parent(), (node_type*)&mAnchor));
+				mAnchor.mpNodeRight  = RBTreeGetMaxChild(mAnchor.parent());
+				mAnchor.mpNodeLeft   = RBTreeGetMinChild(mAnchor.parent());
 				mnSize               = x.mnSize;
 			}
 		}
@@ -971,39 +1191,41 @@ namespace eastl
 			// nominal container instance.
 
 			// We optimize for the expected most common case: both pointers being non-null.
-			if(mAnchor.mpNodeParent && x.mAnchor.mpNodeParent) // If both pointers are non-null...
+			if(mAnchor.parent() && x.mAnchor.parent()) // If both pointers are non-null...
 			{
 				eastl::swap(mAnchor.mpNodeRight,  x.mAnchor.mpNodeRight);
 				eastl::swap(mAnchor.mpNodeLeft,   x.mAnchor.mpNodeLeft);
-				eastl::swap(mAnchor.mpNodeParent, x.mAnchor.mpNodeParent);
+				rbtree_node_base* const pRoot = mAnchor.parent();
+				mAnchor.set_parent(x.mAnchor.parent());
+				x.mAnchor.set_parent(pRoot);
 
 				// We need to fix up the anchors to point to themselves (we can't just swap them).
-				mAnchor.mpNodeParent->mpNodeParent   = &mAnchor;
-				x.mAnchor.mpNodeParent->mpNodeParent = &x.mAnchor;
+				mAnchor.parent()->set_parent(&mAnchor);
+				x.mAnchor.parent()->set_parent(&x.mAnchor);
 			}
-			else if(mAnchor.mpNodeParent)
+			else if(mAnchor.parent())
 			{
 				x.mAnchor.mpNodeRight  = mAnchor.mpNodeRight;
 				x.mAnchor.mpNodeLeft   = mAnchor.mpNodeLeft;
-				x.mAnchor.mpNodeParent = mAnchor.mpNodeParent;
-				x.mAnchor.mpNodeParent->mpNodeParent = &x.mAnchor;
+				x.mAnchor.set_parent(mAnchor.parent());
+				x.mAnchor.parent()->set_parent(&x.mAnchor);
 
 				// We need to fix up our anchor to point it itself (we can't have it swap with x).
 				mAnchor.mpNodeRight  = &mAnchor;
 				mAnchor.mpNodeLeft   = &mAnchor;
-				mAnchor.mpNodeParent = NULL;
+				mAnchor.set_parent(NULL);
 			}
-			else if(x.mAnchor.mpNodeParent)
+			else if(x.mAnchor.parent())
 			{
 				mAnchor.mpNodeRight  = x.mAnchor.mpNodeRight;
 				mAnchor.mpNodeLeft   = x.mAnchor.mpNodeLeft;
-				mAnchor.mpNodeParent = x.mAnchor.mpNodeParent;
-				mAnchor.mpNodeParent->mpNodeParent = &mAnchor;
+				mAnchor.set_parent(x.mAnchor.parent());
+				mAnchor.parent()->set_parent(&mAnchor);
 
 				// We need to fix up x's anchor to point it itself (we can't have it swap with us).
 				x.mAnchor.mpNodeRight  = &x.mAnchor;
 				x.mAnchor.mpNodeLeft   = &x.mAnchor;
-				x.mAnchor.mpNodeParent = NULL;
+				x.mAnchor.set_parent(NULL);
 			} // Else both are NULL and there is nothing to do.
 		}
 		else
@@ -1182,7 +1404,7 @@ namespace eastl
 		// function whereby this version takes a key and not a full value_type.
 		extract_key extractKey;
 
-		node_type* pCurrent    = (node_type*)mAnchor.mpNodeParent; // Start with the root node.
+		node_type* pCurrent    = (node_type*)mAnchor.parent(); // Start with the root node.
 		node_type* pLowerBound = (node_type*)&mAnchor;             // Set it to the container end for now.
 		node_type* pParent;                                        // This will be where we insert the new node.
 
@@ -1241,7 +1463,7 @@ namespace eastl
 	rbtree<K, V, C, A, E, bM, bU>::DoGetKeyInsertionPositionNonuniqueKeys(const key_type& key)
 	{
 		// This is the pathway for insertion of non-unique keys (multimap and multiset, but not map and set).
-		node_type* pCurrent  = (node_type*)mAnchor.mpNodeParent; // Start with the root node.
+		node_type* pCurrent  = (node_type*)mAnchor.parent(); // Start with the root node.
 		node_type* pRangeEnd = (node_type*)&mAnchor;             // Set it to the container end for now.
 		extract_key extractKey;
 
@@ -1608,6 +1830,12 @@ namespace eastl
 	template <typename InputIterator>
 	void rbtree<K, V, C, A, E, bM, bU>::insert(InputIterator first, InputIterator last)
 	{
+		if(mnSize == 0) // If we can build the tree from scratch, as the constructor does...
+		{
+			DoInitFromRange(first, last, typename eastl::iterator_traits<InputIterator>::iterator_category());
+			return;
+		}
+
 		for( ; first != last; ++first)
 			DoInsertValue(has_unique_keys_type(), *first); // Or maybe we should call 'insert(end(), *first)' instead. If the first-last range was sorted then this might make some sense.
 	}
@@ -1618,7 +1846,7 @@ namespace eastl
 	{
 		// Erase the entire tree. DoNukeSubtree is not a 
 		// conventional erase function, as it does no rebalancing.
-		DoNukeSubtree((node_type*)mAnchor.mpNodeParent);
+		DoNukeSubtree((node_type*)mAnchor.parent());
 		reset_lose_memory();
 	}
 
@@ -1632,12 +1860,264 @@ namespace eastl
 		// container built into scratch memory.
 		mAnchor.mpNodeRight  = &mAnchor;
 		mAnchor.mpNodeLeft   = &mAnchor;
-		mAnchor.mpNodeParent = NULL;
-		mAnchor.mColor       = kRBTreeColorRed;
+		mAnchor.set_parent_and_color(NULL, kRBTreeColorRed);
 		mnSize               = 0;
 	}
 
 
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	inline typename rbtree<K, V, C, A, E, bM, bU>::node_insert_return_type
+	rbtree<K, V, C, A, E, bM, bU>::insert(node_handle_type&& nh)
+	{
+		return DoInsertNode(has_unique_keys_type(), eastl::move(nh));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	inline typename rbtree<K, V, C, A, E, bM, bU>::iterator
+	rbtree<K, V, C, A, E, bM, bU>::insert(const_iterator position, node_handle_type&& nh)
+	{
+		return DoInsertNodeHint(has_unique_keys_type(), position, eastl::move(nh));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	typename rbtree<K, V, C, A, E, bM, bU>::node_handle_type
+	rbtree<K, V, C, A, E, bM, bU>::extract(const_iterator position)
+	{
+		node_type* const pNode = position.mpNode;
+		--mnSize;
+		RBTreeErase(pNode, &mAnchor);
+		return node_handle_type(pNode, &mAllocator);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	inline typename rbtree<K, V, C, A, E, bM, bU>::node_handle_type
+	rbtree<K, V, C, A, E, bM, bU>::extract(const key_type& key)
+	{
+		const iterator it(find(key));
+
+		if(it != end())
+			return extract(it);
+		return node_handle_type();
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename Source>
+	inline void rbtree<K, V, C, A, E, bM, bU>::merge(Source&& source)
+	{
+		if((const void*)&source != (const void*)this)
+			DoMerge(has_unique_keys_type(), source);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	void rbtree<K, V, C, A, E, bM, bU>::join(this_type& x)
+	{
+		EASTL_ASSERT(&x != this);
+
+		#if EASTL_ASSERT_ENABLED
+			if(mnSize && x.mnSize)
+			{
+				extract_key      extractKey;
+				const key_type&  keyLast  = extractKey(static_cast<node_type*>(mAnchor.mpNodeRight)->mValue);
+				const key_type&  keyFirst = extractKey(static_cast<node_type*>(x.mAnchor.mpNodeLeft)->mValue);
+
+				if(has_unique_keys_type::value ? !mCompare(keyLast, keyFirst) : mCompare(keyFirst, keyLast))
+					EASTL_FAIL_MSG("rbtree::join: the keys of x must follow the keys of this container.");
+			}
+		#endif
+
+		if(mAllocator == x.mAllocator)
+		{
+			RBTreeJoin(&mAnchor, &x.mAnchor);
+			mnSize  += x.mnSize;
+			x.mnSize = 0;
+		}
+		else
+		{
+			// x's nodes can't be freed by our allocator, so we move the values instead.
+			for(iterator it = x.begin(), itEnd = x.end(); it != itEnd; ++it)
+				insert(cend(), eastl::move(*it));
+			x.clear();
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	void rbtree<K, V, C, A, E, bM, bU>::split(const key_type& key, this_type& x)
+	{
+		EASTL_ASSERT(&x != this);
+
+		x.clear();
+
+		const iterator itSplit(lower_bound(key));
+
+		if(itSplit != end())
+		{
+			if(mAllocator == x.mAllocator)
+			{
+				const size_type n = (size_type)eastl::distance(itSplit, end());
+
+				RBTreeSplit(&mAnchor, itSplit.mpNode, &x.mAnchor);
+				mnSize  -= n;
+				x.mnSize = n;
+			}
+			else
+			{
+				for(iterator it = itSplit, itEnd = end(); it != itEnd; ++it)
+					x.insert(x.cend(), eastl::move(*it));
+				erase(itSplit, end());
+			}
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename Source>
+	void rbtree<K, V, C, A, E, bM, bU>::DoMerge(true_type, Source& source) // true_type means keys are unique.
+	{
+		extract_key extractKey;
+
+		for(typename Source::iterator it = source.begin(); it != source.end(); )
+		{
+			bool       canInsert;
+			node_type* pPosition = DoGetKeyInsertionPositionUniqueKeys(canInsert, extractKey(*it));
+
+			if(canInsert)
+			{
+				node_handle_type nh(source.extract(it++));
+				node_type* const pNode = DoAcquireNode(nh);
+				DoInsertValueImpl(pPosition, false, extractKey(pNode->mValue), pNode);
+			}
+			else
+				++it;
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename Source>
+	void rbtree<K, V, C, A, E, bM, bU>::DoMerge(false_type, Source& source) // false_type means keys are not unique.
+	{
+		for(typename Source::iterator it = source.begin(); it != source.end(); )
+			DoInsertNode(false_type(), source.extract(it++));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	typename rbtree<K, V, C, A, E, bM, bU>::node_type*
+	rbtree<K, V, C, A, E, bM, bU>::DoAcquireNode(node_handle_type& nh)
+	{
+		if(nh.get_allocator() == mAllocator)
+			return nh.release();
+
+		// The node's memory can't be freed by our allocator (e.g. it belongs to another fixed
+		// container), so we fall back to moving the value into a node of our own.
+		node_type* const pNodeNew = DoCreateNode(eastl::move(nh.value()));
+		nh = node_handle_type(); // Frees the source node.
+		return pNodeNew;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	node_insert_return<typename rbtree<K, V, C, A, E, bM, bU>::iterator, typename rbtree<K, V, C, A, E, bM, bU>::node_handle_type>
+	rbtree<K, V, C, A, E, bM, bU>::DoInsertNode(true_type, node_handle_type&& nh) // true_type means keys are unique.
+	{
+		node_insert_return<iterator, node_handle_type> result = { end(), false, node_handle_type() };
+
+		if(nh)
+		{
+			extract_key extractKey;
+			bool        canInsert;
+			node_type*  pPosition = DoGetKeyInsertionPositionUniqueKeys(canInsert, extractKey(nh.value()));
+
+			if(canInsert)
+			{
+				node_type* const pNode = DoAcquireNode(nh);
+				result.position = DoInsertValueImpl(pPosition, false, extractKey(pNode->mValue), pNode);
+				result.inserted = true;
+			}
+			else
+			{
+				result.position = iterator(pPosition);
+				result.node     = eastl::move(nh);
+			}
+		}
+
+		return result;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	typename rbtree<K, V, C, A, E, bM, bU>::iterator
+	rbtree<K, V, C, A, E, bM, bU>::DoInsertNode(false_type, node_handle_type&& nh) // false_type means keys are not unique.
+	{
+		if(nh)
+		{
+			extract_key      extractKey;
+			node_type* const pPosition = DoGetKeyInsertionPositionNonuniqueKeys(extractKey(nh.value()));
+			node_type* const pNode     = DoAcquireNode(nh);
+
+			return DoInsertValueImpl(pPosition, false, extractKey(pNode->mValue), pNode);
+		}
+
+		return end();
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	typename rbtree<K, V, C, A, E, bM, bU>::iterator
+	rbtree<K, V, C, A, E, bM, bU>::DoInsertNodeHint(true_type, const_iterator position, node_handle_type&& nh) // true_type means keys are unique.
+	{
+		if(nh)
+		{
+			extract_key extractKey;
+			bool        bForceToLeft;
+			node_type*  pPosition = DoGetKeyInsertionPositionUniqueKeysHint(position, bForceToLeft, extractKey(nh.value()));
+
+			if(pPosition)
+			{
+				node_type* const pNode = DoAcquireNode(nh);
+				return DoInsertValueImpl(pPosition, bForceToLeft, extractKey(pNode->mValue), pNode);
+			}
+
+			// The hint was of no use. As with the C++ standard, nh is left unchanged if the key is already present.
+			node_insert_return<iterator, node_handle_type> result(DoInsertNode(true_type(), eastl::move(nh)));
+			if(!result.inserted)
+				nh = eastl::move(result.node);
+			return result.position;
+		}
+
+		return end();
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	typename rbtree<K, V, C, A, E, bM, bU>::iterator
+	rbtree<K, V, C, A, E, bM, bU>::DoInsertNodeHint(false_type, const_iterator position, node_handle_type&& nh) // false_type means keys are not unique.
+	{
+		if(nh)
+		{
+			extract_key extractKey;
+			bool        bForceToLeft;
+			node_type*  pPosition = DoGetKeyInsertionPositionNonuniqueKeysHint(position, bForceToLeft, extractKey(nh.value()));
+
+			if(pPosition)
+			{
+				node_type* const pNode = DoAcquireNode(nh);
+				return DoInsertValueImpl(pPosition, bForceToLeft, extractKey(pNode->mValue), pNode);
+			}
+
+			return DoInsertNode(false_type(), eastl::move(nh));
+		}
+
+		return end();
+	}
+
+
 	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
 	inline typename rbtree<K, V, C, A, E, bM, bU>::iterator
 	rbtree<K, V, C, A, E, bM, bU>::erase(const_iterator position)
@@ -1728,7 +2208,7 @@ namespace eastl
 		// find a lot with trees, but very uncommonly call lower_bound.
 		extract_key extractKey;
 
-		node_type* pCurrent  = (node_type*)mAnchor.mpNodeParent; // Start with the root node.
+		node_type* pCurrent  = (node_type*)mAnchor.parent(); // Start with the root node.
 		node_type* pRangeEnd = (node_type*)&mAnchor;             // Set it to the container end for now.
 
 		while(EASTL_LIKELY(pCurrent)) // Do a walk down the tree.
@@ -1767,7 +2247,7 @@ namespace eastl
 	{
 		extract_key extractKey;
 
-		node_type* pCurrent  = (node_type*)mAnchor.mpNodeParent; // Start with the root node.
+		node_type* pCurrent  = (node_type*)mAnchor.parent(); // Start with the root node.
 		node_type* pRangeEnd = (node_type*)&mAnchor;             // Set it to the container end for now.
 
 		while(EASTL_LIKELY(pCurrent)) // Do a walk down the tree.
@@ -1806,7 +2286,7 @@ namespace eastl
 	{
 		extract_key extractKey;
 
-		node_type* pCurrent  = (node_type*)mAnchor.mpNodeParent; // Start with the root node.
+		node_type* pCurrent  = (node_type*)mAnchor.parent(); // Start with the root node.
 		node_type* pRangeEnd = (node_type*)&mAnchor;             // Set it to the container end for now.
 
 		while(EASTL_LIKELY(pCurrent)) // Do a walk down the tree.
@@ -1842,7 +2322,7 @@ namespace eastl
 	{
 		extract_key extractKey;
 
-		node_type* pCurrent  = (node_type*)mAnchor.mpNodeParent; // Start with the root node.
+		node_type* pCurrent  = (node_type*)mAnchor.parent(); // Start with the root node.
 		node_type* pRangeEnd = (node_type*)&mAnchor;             // Set it to the container end for now.
 
 		while(EASTL_LIKELY(pCurrent)) // Do a walk down the tree.
@@ -1870,7 +2350,127 @@ namespace eastl
 	}
 
 
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename U, typename C2>
+	typename Internal::enable_if_transparent<C2, typename rbtree<K, V, C, A, E, bM, bU>::iterator>::type
+	rbtree<K, V, C, A, E, bM, bU>::lower_bound(const U& u)
+	{
+		extract_key extractKey;
+
+		node_type* pCurrent  = (node_type*)mAnchor.parent(); // Start with the root node.
+		node_type* pRangeEnd = (node_type*)&mAnchor;             // Set it to the container end for now.
+
+		while(EASTL_LIKELY(pCurrent)) // Do a walk down the tree.
+		{
+			if(EASTL_LIKELY(!mCompare(extractKey(pCurrent->mValue), u))) // If pCurrent is >= u...
+			{
+				pRangeEnd = pCurrent;
+				pCurrent  = (node_type*)pCurrent->mpNodeLeft;
+			}
+			else
+			{
+				EASTL_VALIDATE_COMPARE(!mCompare(u, extractKey(pCurrent->mValue))); // Validate that the compare function is sane.
+				pCurrent  = (node_type*)pCurrent->mpNodeRight;
+			}
+		}
+
+		return iterator(pRangeEnd);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename U, typename C2>
+	inline typename Internal::enable_if_transparent<C2, typename rbtree<K, V, C, A, E, bM, bU>::const_iterator>::type
+	rbtree<K, V, C, A, E, bM, bU>::lower_bound(const U& u) const
+	{
+		typedef rbtree<K, V, C, A, E, bM, bU> rbtree_type;
+		return const_iterator(const_cast<rbtree_type*>(this)->lower_bound(u));
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename U, typename C2>
+	typename Internal::enable_if_transparent<C2, typename rbtree<K, V, C, A, E, bM, bU>::iterator>::type
+	rbtree<K, V, C, A, E, bM, bU>::upper_bound(const U& u)
+	{
+		extract_key extractKey;
+
+		node_type* pCurrent  = (node_type*)mAnchor.parent(); // Start with the root node.
+		node_type* pRangeEnd = (node_type*)&mAnchor;             // Set it to the container end for now.
+
+		while(EASTL_LIKELY(pCurrent)) // Do a walk down the tree.
+		{
+			if(EASTL_LIKELY(mCompare(u, extractKey(pCurrent->mValue)))) // If u is < pCurrent...
+			{
+				EASTL_VALIDATE_COMPARE(!mCompare(extractKey(pCurrent->mValue), u)); // Validate that the compare function is sane.
+				pRangeEnd = pCurrent;
+				pCurrent  = (node_type*)pCurrent->mpNodeLeft;
+			}
+			else
+				pCurrent  = (node_type*)pCurrent->mpNodeRight;
+		}
+
+		return iterator(pRangeEnd);
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename U, typename C2>
+	inline typename Internal::enable_if_transparent<C2, typename rbtree<K, V, C, A, E, bM, bU>::const_iterator>::type
+	rbtree<K, V, C, A, E, bM, bU>::upper_bound(const U& u) const
+	{
+		typedef rbtree<K, V, C, A, E, bM, bU> rbtree_type;
+		return const_iterator(const_cast<rbtree_type*>(this)->upper_bound(u));
+	}
+
+
 	// To do: Move this validate function entirely to a template-less implementation.
+	#if EASTL_RBTREE_ORDER_STATISTICS
+		template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+		inline typename rbtree<K, V, C, A, E, bM, bU>::iterator
+		rbtree<K, V, C, A, E, bM, bU>::select(size_type n)
+		{
+			if(n < mnSize)
+				return iterator(static_cast<node_type*>(RBTreeSelect(mAnchor.parent(), (size_t)n)));
+			return iterator(static_cast<node_type*>(&mAnchor));
+		}
+
+
+		template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+		inline typename rbtree<K, V, C, A, E, bM, bU>::const_iterator
+		rbtree<K, V, C, A, E, bM, bU>::select(size_type n) const
+		{
+			typedef rbtree<K, V, C, A, E, bM, bU> rbtree_type;
+			return const_iterator(const_cast<rbtree_type*>(this)->select(n));
+		}
+
+
+		template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+		typename rbtree<K, V, C, A, E, bM, bU>::size_type
+		rbtree<K, V, C, A, E, bM, bU>::rank(const key_type& key) const
+		{
+			// This is lower_bound, except that we count the elements we pass on the left as we go.
+			extract_key extractKey;
+
+			const node_type* pCurrent = (const node_type*)mAnchor.parent(); // Start with the root node.
+			size_t           nRank    = 0;
+
+			while(pCurrent)
+			{
+				if(!mCompare(extractKey(pCurrent->mValue), key)) // If pCurrent is >= key...
+					pCurrent = (const node_type*)pCurrent->mpNodeLeft;
+				else
+				{
+					nRank   += RBTreeGetSubtreeSize(pCurrent->mpNodeLeft) + 1;
+					pCurrent = (const node_type*)pCurrent->mpNodeRight;
+				}
+			}
+
+			return (size_type)nRank;
+		}
+	#endif
+
+
 	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
 	bool rbtree<K, V, C, A, E, bM, bU>::validate() const
 	{
@@ -1892,13 +2492,13 @@ namespace eastl
 			//if(!mAnchor.mpNodeParent || (mAnchor.mpNodeLeft == mAnchor.mpNodeRight))
 			//    return false;             // Fix this for case of empty tree.
 
-			if(mAnchor.mpNodeLeft != RBTreeGetMinChild(mAnchor.mpNodeParent))
+			if(mAnchor.mpNodeLeft != RBTreeGetMinChild(mAnchor.parent()))
 				return false;
 
-			if(mAnchor.mpNodeRight != RBTreeGetMaxChild(mAnchor.mpNodeParent))
+			if(mAnchor.mpNodeRight != RBTreeGetMaxChild(mAnchor.parent()))
 				return false;
 
-			const size_t nBlackCount   = RBTreeGetBlackCount(mAnchor.mpNodeParent, mAnchor.mpNodeLeft);
+			const size_t nBlackCount   = RBTreeGetBlackCount(mAnchor.parent(), mAnchor.mpNodeLeft);
 			size_type    nIteratedSize = 0;
 
 			for(const_iterator it = begin(); it != end(); ++it, ++nIteratedSize)
@@ -1916,14 +2516,14 @@ namespace eastl
 					return false;
 
 				// Verify item #1 above.
-				if((pNode->mColor != kRBTreeColorRed) && (pNode->mColor != kRBTreeColorBlack))
+				if((pNode->color() != kRBTreeColorRed) && (pNode->color() != kRBTreeColorBlack))
 					return false;
 
 				// Verify item #3 above.
-				if(pNode->mColor == kRBTreeColorRed)
+				if(pNode->color() == kRBTreeColorRed)
 				{
-					if((pNodeRight && (pNodeRight->mColor == kRBTreeColorRed)) ||
-					   (pNodeLeft  && (pNodeLeft->mColor  == kRBTreeColorRed)))
+					if((pNodeRight && (pNodeRight->color() == kRBTreeColorRed)) ||
+					   (pNodeLeft  && (pNodeLeft->color()  == kRBTreeColorRed)))
 						return false;
 				}
 
@@ -1937,9 +2537,14 @@ namespace eastl
 				if(!pNodeRight && !pNodeLeft) // If we are at a bottom node of the tree...
 				{
 					// Verify item #4 above.
-					if(RBTreeGetBlackCount(mAnchor.mpNodeParent, pNode) != nBlackCount)
+					if(RBTreeGetBlackCount(mAnchor.parent(), pNode) != nBlackCount)
 						return false;
 				}
+
+				#if EASTL_RBTREE_ORDER_STATISTICS
+					if(pNode->mnSubtreeSize != (RBTreeGetSubtreeSize(pNodeLeft) + RBTreeGetSubtreeSize(pNodeRight) + 1))
+						return false;
+				#endif
 			}
 
 			// Verify item #5 above.
@@ -2022,8 +2627,7 @@ namespace eastl
 		#if EASTL_DEBUG
 			pNode->mpNodeRight  = NULL;
 			pNode->mpNodeLeft   = NULL;
-			pNode->mpNodeParent = NULL;
-			pNode->mColor       = kRBTreeColorBlack;
+			pNode->set_parent_and_color(NULL, kRBTreeColorBlack);
 		#endif
 
 		return pNode;
@@ -2056,8 +2660,7 @@ namespace eastl
 		#if EASTL_DEBUG
 			pNode->mpNodeRight  = NULL;
 			pNode->mpNodeLeft   = NULL;
-			pNode->mpNodeParent = NULL;
-			pNode->mColor       = kRBTreeColorBlack;
+			pNode->set_parent_and_color(NULL, kRBTreeColorBlack);
 		#endif
 
 		return pNode;
@@ -2090,8 +2693,7 @@ namespace eastl
 		#if EASTL_DEBUG
 			pNode->mpNodeRight  = NULL;
 			pNode->mpNodeLeft   = NULL;
-			pNode->mpNodeParent = NULL;
-			pNode->mColor       = kRBTreeColorBlack;
+			pNode->set_parent_and_color(NULL, kRBTreeColorBlack);
 		#endif
 
 		return pNode;
@@ -2125,8 +2727,7 @@ namespace eastl
 		#if EASTL_DEBUG
 			pNode->mpNodeRight  = NULL;
 			pNode->mpNodeLeft   = NULL;
-			pNode->mpNodeParent = NULL;
-			pNode->mColor       = kRBTreeColorBlack;
+			pNode->set_parent_and_color(NULL, kRBTreeColorBlack);
 		#endif
 
 		return pNode;
@@ -2141,8 +2742,11 @@ namespace eastl
 
 		pNode->mpNodeRight  = NULL;
 		pNode->mpNodeLeft   = NULL;
-		pNode->mpNodeParent = pNodeParent;
-		pNode->mColor       = pNodeSource->mColor;
+		pNode->set_parent_and_color(pNodeParent, pNodeSource->color());
+
+		#if EASTL_RBTREE_ORDER_STATISTICS
+			pNode->mnSubtreeSize = pNodeSource->mnSubtreeSize; // The subtree is copied as it is.
+		#endif
 
 		return pNode;
 	}
@@ -2203,6 +2807,172 @@ namespace eastl
 	}
 
 
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename InputIterator>
+	void rbtree<K, V, C, A, E, bM, bU>::DoInitFromRange(InputIterator first, InputIterator last, EASTL_ITC_NS::input_iterator_tag)
+	{
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+		#endif
+				for(; first != last; ++first)
+					insert(*first);
+		#if EASTL_EXCEPTIONS_ENABLED
+			}
+			catch(...)
+			{
+				clear();
+				throw;
+			}
+		#endif
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename ForwardIterator>
+	void rbtree<K, V, C, A, E, bM, bU>::DoInitFromRange(ForwardIterator first, ForwardIterator last, EASTL_ITC_NS::forward_iterator_tag)
+	{
+		// Checking costs a pass over the range, but it stops at the first value out of
+		// order, and for a sorted range it saves the n searches and rebalances of inserting.
+		if(DoIsSortedRange(first, last))
+			DoInitFromSortedRange(first, last, EASTL_ITC_NS::forward_iterator_tag());
+		else
+			DoInitFromRange(first, last, EASTL_ITC_NS::input_iterator_tag());
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename InputIterator>
+	void rbtree<K, V, C, A, E, bM, bU>::DoInitFromSortedRange(InputIterator first, InputIterator last, EASTL_ITC_NS::input_iterator_tag)
+	{
+		// We can't know the size of the range in advance, but inserting at the end is 
+		// still cheap, as the hint spares us the search for each value's position.
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+		#endif
+				for(; first != last; ++first)
+					emplace_hint(cend(), *first);
+		#if EASTL_EXCEPTIONS_ENABLED
+			}
+			catch(...)
+			{
+				clear();
+				throw;
+			}
+		#endif
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename ForwardIterator>
+	void rbtree<K, V, C, A, E, bM, bU>::DoInitFromSortedRange(ForwardIterator first, ForwardIterator last, EASTL_ITC_NS::forward_iterator_tag)
+	{
+		EASTL_ASSERT_MSG(DoIsSortedRange(first, last), "rbtree: the range is expected to be sorted, and without equivalent keys for map and set.");
+
+		const size_type n = (size_type)eastl::distance(first, last);
+
+		if(n)
+		{
+			// The nodes at depth log2(n + 1) (rounded down) are those of an incomplete bottom level.
+			size_type nRedDepth = 0;
+			for(size_type i = n + 1; i > 1; i >>= 1)
+				++nRedDepth;
+
+			node_type* const pNodeRoot = DoBuildSortedSubtree(first, n, 0, nRedDepth);
+
+			pNodeRoot->set_parent(&mAnchor);
+			mAnchor.set_parent(pNodeRoot);
+			mAnchor.mpNodeLeft  = RBTreeGetMinChild(pNodeRoot);
+			mAnchor.mpNodeRight = RBTreeGetMaxChild(pNodeRoot);
+			mnSize              = n;
+		}
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename ForwardIterator>
+	bool rbtree<K, V, C, A, E, bM, bU>::DoIsSortedRange(ForwardIterator first, ForwardIterator last) const
+	{
+		extract_key extractKey;
+
+		if(first != last)
+		{
+			for(ForwardIterator next = first; ++next != last; first = next)
+			{
+				// With unique keys each key must be less than the next, and otherwise not greater.
+				if(has_unique_keys_type::value ? !mCompare(extractKey(*first), extractKey(*next)) : mCompare(extractKey(*next), extractKey(*first)))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+
+	template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+	template <typename ForwardIterator>
+	typename rbtree<K, V, C, A, E, bM, bU>::node_type*
+	rbtree<K, V, C, A, E, bM, bU>::DoBuildSortedSubtree(ForwardIterator& first, size_type n, size_type nDepth, size_type nRedDepth)
+	{
+		// We build a subtree of the next n values with the middle value at its root, so the 
+		// depths of its leaves differ by at most one. All nodes are black except those of an 
+		// incomplete bottom level, which are red so that every path has the same black count.
+		if(n == 0)
+			return NULL;
+
+		const size_type  nLeftCount = (n - 1) / 2;
+		node_type* const pNodeLeft  = DoBuildSortedSubtree(first, nLeftCount, nDepth + 1, nRedDepth);
+		node_type*       pNode;
+
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+		#endif
+				pNode = DoCreateNode(*first);
+		#if EASTL_EXCEPTIONS_ENABLED
+			}
+			catch(...)
+			{
+				DoNukeSubtree(pNodeLeft);
+				throw;
+			}
+		#endif
+
+		++first;
+
+		pNode->mpNodeLeft  = pNodeLeft;
+		pNode->mpNodeRight = NULL;
+		pNode->set_parent_and_color(NULL, (nDepth == nRedDepth) ? kRBTreeColorRed : kRBTreeColorBlack);
+
+		#if EASTL_RBTREE_ORDER_STATISTICS
+			pNode->mnSubtreeSize = n;
+		#endif
+
+		if(pNodeLeft)
+			pNodeLeft->set_parent(pNode);
+
+		#if EASTL_EXCEPTIONS_ENABLED
+			try
+			{
+		#endif
+				pNode->mpNodeRight = DoBuildSortedSubtree(first, n - 1 - nLeftCount, nDepth + 1, nRedDepth);
+		#if EASTL_EXCEPTIONS_ENABLED
+			}
+			catch(...)
+			{
+				DoNukeSubtree(pNode);
+				throw;
+			}
+		#endif
+
+		if(pNode->mpNodeRight)
+			pNode->mpNodeRight->set_parent(pNode);
+
+		return pNode;
+	}
+
+
 
 	///////////////////////////////////////////////////////////////////////
 	// global operators
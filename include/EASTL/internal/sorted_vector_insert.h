@@ -0,0 +1,124 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements the range insertion shared by vector_map, vector_multimap,
+// vector_set and vector_multiset. Inserting the values one at a time costs a
+// search and a shift of the container's tail per value, which is quadratic for
+// large ranges. Instead we append the range, sort it, and merge it into the
+// existing values in one pass from the back.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_SORTED_VECTOR_INSERT_H
+#define EASTL_INTERNAL_SORTED_VECTOR_INSERT_H
+
+
+#include <EABase/eabase.h>
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/assume_sorted_t.h>
+#include <EASTL/iterator.h>
+#include <EASTL/vector.h>
+#include <EASTL/sort.h>
+
+
+
+namespace eastl
+{
+	namespace Internal
+	{
+		/// SortedVectorInsertRange
+		///
+		/// Inserts [first, last) into the random access container c, whose values are
+		/// sorted by compare. The result is the same as inserting the values one at a
+		/// time into a map or set (if bUnique) or a multimap or multiset (if not):
+		///     - If bUnique, a value is dropped if c or an earlier value of the range
+		///       already has an equivalent one.
+		///     - Otherwise, a value goes after the equivalent values already in c and
+		///       after the equivalent values earlier in the range.
+		///
+		/// If bSorted, the range must already be sorted by compare and we skip sorting it.
+		///
+		/// This takes O(m log m + n) time and O(m) extra memory, from EASTLAllocatorType, to insert m values into n.
+		/// If an exception is thrown partway through the merge, c is left with the
+		/// right size but with some values moved from.
+		///
+		template <typename Container, typename InputIterator, typename Compare>
+		void SortedVectorInsertRange(Container& c, InputIterator first, InputIterator last, const Compare& compare, bool bUnique, bool bSorted)
+		{
+			typedef typename Container::value_type                                value_type;
+			typedef typename Container::size_type                                 size_type;
+			typedef typename Container::iterator                                  iterator;
+			typedef eastl::vector<value_type, EASTLAllocatorType>                 buffer_type; // Not Container::allocator_type, which may be a fixed_vector's that can't provide more memory.
+
+			const size_type nOldSize = c.size();
+
+			c.insert(c.end(), first, last);
+
+			if(!bSorted)
+				eastl::stable_sort(c.begin() + nOldSize, c.end(), compare); // Stable, so that the first of equivalent values stays first.
+
+			EASTL_ASSERT_MSG(eastl::is_sorted(c.begin() + nOldSize, c.end(), compare), "insert: the range is expected to be sorted.");
+
+			if(bUnique)
+			{
+				const iterator itBatch = c.begin() + nOldSize;
+				iterator       itUniqueEnd = itBatch;
+
+				for(iterator it = itBatch; it != c.end(); ++it)
+				{
+					if((itUniqueEnd == itBatch) || compare(*(itUniqueEnd - 1), *it))
+					{
+						if(itUniqueEnd != it)
+							*itUniqueEnd = eastl::move(*it);
+						++itUniqueEnd;
+					}
+				}
+
+				c.erase(itUniqueEnd, c.end());
+			}
+
+			const size_type nNewSize = c.size() - nOldSize;
+
+			if((nOldSize == 0) || (nNewSize == 0))
+				return;
+
+			if(bUnique ? compare(c[nOldSize - 1], c[nOldSize]) : !compare(c[nOldSize], c[nOldSize - 1]))
+				return; // The new values all go after the old ones, as when appending in order.
+
+			// Move the new values out, and fill c from the back with whichever of the last
+			// remaining old and new values goes later. Old values are never overwritten
+			// before they are moved, as there's always a gap of at least the remaining new
+			// values between the last old value and the write position. If we dropped new
+			// values, some of the gap is left over at the end, and we close it.
+			buffer_type buffer(eastl::make_move_iterator(c.begin() + nOldSize), eastl::make_move_iterator(c.end()), EASTLAllocatorType(EASTL_VECTOR_DEFAULT_NAME));
+
+			size_type nOld   = nOldSize;
+			size_type nNew   = nNewSize;
+			size_type nWrite = nOldSize + nNewSize;
+
+			while(nNew)
+			{
+				if(nOld && compare(buffer[nNew - 1], c[nOld - 1]))
+					c[--nWrite] = eastl::move(c[--nOld]);
+				else if(bUnique && nOld && !compare(c[nOld - 1], buffer[nNew - 1]))
+					--nNew; // The existing equivalent value wins.
+				else
+					c[--nWrite] = eastl::move(buffer[--nNew]);
+			}
+
+			if(nWrite != nOld)
+				c.erase(c.begin() + nOld, c.begin() + nWrite);
+		}
+
+	} // namespace Internal
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,215 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements pool_allocator, a general purpose allocator which
+// serves small blocks from size-segregated pools and keeps a per-thread cache
+// of free blocks for each size class. It is intended for node-based containers
+// (list, map, set, hash_map, etc.), whose node allocation and deallocation
+// otherwise goes to the system heap one node at a time.
+//
+// Blocks of up to EASTL_POOL_ALLOCATOR_MAX_SIZE bytes are rounded up to one of
+// a small number of size classes. Each thread allocates from and frees to its
+// own cache without any synchronization. When a cache runs dry it fetches a
+// batch of blocks from the central pool for that size class, and when it holds
+// too many blocks it returns a batch, so the central pool's lock is taken only
+// once per batch. Larger blocks are passed through to eastl::allocator.
+//
+// A block may be freed by a thread other than the one that allocated it; it
+// simply ends up in the freeing thread's cache. Blocks cached by a thread are
+// returned to the central pool when the thread exits. Memory in the central
+// pool is never returned to the system.
+//
+// pool_allocator can be used as an explicit allocator argument:
+//     eastl::map<int, Widget, eastl::less<int>, eastl::pool_allocator> widgetMap;
+//
+// or as the default allocator for all of EASTL, by defining the following
+// before any EASTL header is included (e.g. in the project's prefix header),
+// and including this header before any other EASTL header:
+//     #define EASTLAllocatorType    eastl::pool_allocator
+//     #define EASTLAllocatorDefault eastl::GetDefaultPoolAllocator
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_POOL_ALLOCATOR_H
+#define EASTL_POOL_ALLOCATOR_H
+
+
+#include <EASTL/internal/config.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+namespace eastl
+{
+	// Declared before allocator.h is included, so that EASTLAllocatorType may refer to it.
+	class pool_allocator;
+}
+
+#include <EASTL/allocator.h>
+#include <EASTL/internal/thread_support.h>
+#include <stddef.h>
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_POOL_ALLOCATOR_DEFAULT_NAME
+//
+// Defines a default allocator name in the absence of a user-provided name.
+//
+#ifndef EASTL_POOL_ALLOCATOR_DEFAULT_NAME
+	#define EASTL_POOL_ALLOCATOR_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " pool_allocator" // Unless the user overrides something, this is "EASTL pool_allocator".
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_POOL_ALLOCATOR_THREAD_CACHE_ENABLED
+//
+// Defined as 0 or 1. When enabled, each thread keeps its own cache of free
+// blocks. When disabled (or when the compiler lacks C++11 thread_local), every
+// allocation and deallocation takes the central pool's lock for its size class.
+//
+#ifndef EASTL_POOL_ALLOCATOR_THREAD_CACHE_ENABLED
+	#if EASTL_THREAD_SUPPORT_AVAILABLE && !defined(EA_COMPILER_NO_THREAD_LOCAL)
+		#define EASTL_POOL_ALLOCATOR_THREAD_CACHE_ENABLED 1
+	#else
+		#define EASTL_POOL_ALLOCATOR_THREAD_CACHE_ENABLED 0
+	#endif
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_POOL_ALLOCATOR_MAX_SIZE
+//
+// The largest allocation size, in bytes, that is served from the pools. This
+// is the largest size class and can't be raised beyond it; it can be lowered
+// in order to pass more allocations through to eastl::allocator.
+//
+#ifndef EASTL_POOL_ALLOCATOR_MAX_SIZE
+	#define EASTL_POOL_ALLOCATOR_MAX_SIZE 512
+#endif
+
+
+
+namespace eastl
+{
+
+	/// pool_allocator
+	///
+	/// All pool_allocator instances share the same pools and compare equal, so
+	/// memory allocated through one instance can be freed through any other,
+	/// and containers can swap and splice freely.
+	///
+	/// deallocate doesn't rely on the size argument; the size class of a pooled
+	/// block is looked up from its address. This matters because some EASTL
+	/// containers (e.g. string_map) free memory with a size of 0.
+	///
+	/// Pooled blocks are aligned to at least 16 bytes, and more when the block
+	/// size is a multiple of a larger power of two. Aligned allocations are
+	/// served from the smallest size class that satisfies them; those which no
+	/// size class satisfies are passed through to eastl::allocator.
+	///
+	class EASTL_API pool_allocator
+	{
+	public:
+		EASTL_ALLOCATOR_EXPLICIT pool_allocator(const char* pName = EASTL_NAME_VAL(EASTL_POOL_ALLOCATOR_DEFAULT_NAME));
+		pool_allocator(const pool_allocator& x);
+		pool_allocator(const pool_allocator& x, const char* pName);
+
+		pool_allocator& operator=(const pool_allocator& x);
+
+		void* allocate(size_t n, int flags = 0);
+		void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0);
+		void  deallocate(void* p, size_t n);
+
+		const char* get_name() const;
+		void        set_name(const char* pName);
+
+		/// Returns the blocks cached by the calling thread to the central pool. This happens
+		/// automatically when a thread exits; calling it explicitly is useful for threads that
+		/// are about to go idle for a long time after freeing many blocks.
+		static void flush_thread_cache();
+
+		/// Returns the number of bytes that the pool would actually use for an allocation of n bytes
+		/// with default alignment, or 0 if such an allocation isn't pooled.
+		static size_t pooled_size(size_t n);
+
+	protected:
+		#if EASTL_NAME_ENABLED
+			const char* mpName; // Debug name, used to track memory.
+		#endif
+	};
+
+	inline bool operator==(const pool_allocator&, const pool_allocator&) { return true;  } // All instances share the same pools.
+	inline bool operator!=(const pool_allocator&, const pool_allocator&) { return false; }
+
+
+	/// GetDefaultPoolAllocator
+	///
+	/// Returns a default pool_allocator instance, for use as EASTLAllocatorDefault
+	/// when pool_allocator is EASTLAllocatorType.
+	///
+	EASTL_API pool_allocator* GetDefaultPoolAllocator();
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// pool_allocator inlines
+	///////////////////////////////////////////////////////////////////////
+
+	inline pool_allocator::pool_allocator(const char* EASTL_NAME(pName))
+	{
+		#if EASTL_NAME_ENABLED
+			mpName = pName ? pName : EASTL_POOL_ALLOCATOR_DEFAULT_NAME;
+		#endif
+	}
+
+
+	inline pool_allocator::pool_allocator(const pool_allocator& EASTL_NAME(x))
+	{
+		#if EASTL_NAME_ENABLED
+			mpName = x.mpName;
+		#endif
+	}
+
+
+	inline pool_allocator::pool_allocator(const pool_allocator&, const char* EASTL_NAME(pName))
+	{
+		#if EASTL_NAME_ENABLED
+			mpName = pName ? pName : EASTL_POOL_ALLOCATOR_DEFAULT_NAME;
+		#endif
+	}
+
+
+	inline pool_allocator& pool_allocator::operator=(const pool_allocator& EASTL_NAME(x))
+	{
+		#if EASTL_NAME_ENABLED
+			mpName = x.mpName;
+		#endif
+		return *this;
+	}
+
+
+	inline const char* pool_allocator::get_name() const
+	{
+		#if EASTL_NAME_ENABLED
+			return mpName;
+		#else
+			return EASTL_POOL_ALLOCATOR_DEFAULT_NAME;
+		#endif
+	}
+
+
+	inline void pool_allocator::set_name(const char* EASTL_NAME(pName))
+	{
+		#if EASTL_NAME_ENABLED
+			mpName = pName;
+		#endif
+	}
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,1365 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements roaring_bitmap, a compressed set of uint32_t values in
+// the style of Roaring bitmaps (Chambi, Lemire, Kaser et al.). It fills the gap
+// between bitset, which is fixed size, and bitvector, which is uncompressed and
+// so needs 512MB to hold any set over the full 32 bit range.
+//
+// The value range is split into 65536 chunks of 65536 values, keyed by the high
+// 16 bits of the value. Only non-empty chunks are stored, each in whichever of
+// three forms is smallest for its contents:
+//     - array:  a sorted vector of up to 4096 uint16_t low halves.
+//     - bitmap: 1024 uint64_t words, for chunks of more than 4096 values.
+//     - run:    a sorted vector of (start, length - 1) uint16_t pairs, for
+//               chunks which are mostly long runs of consecutive values. Run
+//               chunks are made only by run_optimize() and deserialize().
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_ROARING_BITMAP_H
+#define EASTL_ROARING_BITMAP_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/bit_words.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/allocator.h>
+#include <EASTL/bit.h>
+#include <EASTL/iterator.h>
+#include <EASTL/vector.h>
+#include <EASTL/initializer_list.h>
+#include <stddef.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+
+	/// EASTL_ROARING_BITMAP_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_ROARING_BITMAP_DEFAULT_NAME
+		#define EASTL_ROARING_BITMAP_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " roaring_bitmap" // Unless the user overrides something, this is "EASTL roaring_bitmap".
+	#endif
+
+
+	/// EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR
+		#define EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR allocator_type(EASTL_ROARING_BITMAP_DEFAULT_NAME)
+	#endif
+
+
+
+	template <typename Allocator>
+	class roaring_bitmap;
+
+
+	/// roaring_bitmap_iterator
+	///
+	/// Visits the values of a roaring_bitmap in increasing order. The values are
+	/// computed rather than stored, so the iterator is read-only and its reference
+	/// type is uint32_t, much as bitvector's iterator returns bool.
+	///
+	template <typename Allocator>
+	class roaring_bitmap_iterator
+	{
+	public:
+		typedef roaring_bitmap_iterator<Allocator>  this_type;
+		typedef roaring_bitmap<Allocator>           container_type;
+		typedef uint32_t                            value_type;
+		typedef ptrdiff_t                           difference_type;
+		typedef const uint32_t*                     pointer;
+		typedef uint32_t                            reference;
+		typedef EASTL_ITC_NS::forward_iterator_tag  iterator_category;
+
+	public:
+		roaring_bitmap_iterator()
+			: mpContainer(NULL), mnChunk(0), mnPosition(0), mnOffset(0), mnValue(0) { }
+
+		reference operator*() const  { return mnValue; }
+		pointer   operator->() const { return &mnValue; }
+
+		this_type& operator++()   { mpContainer->Increment(*this); return *this; }
+		this_type  operator++(int) { this_type temp(*this); mpContainer->Increment(*this); return temp; }
+
+		bool operator==(const this_type& x) const { return (mnChunk == x.mnChunk) && (mnPosition == x.mnPosition) && (mnOffset == x.mnOffset) && (mpContainer == x.mpContainer); }
+		bool operator!=(const this_type& x) const { return !operator==(x); }
+
+	protected:
+		friend class roaring_bitmap<Allocator>;
+
+		roaring_bitmap_iterator(const container_type* pContainer, eastl_size_t nChunk)
+			: mpContainer(pContainer), mnChunk(nChunk), mnPosition(0), mnOffset(0), mnValue(0) { }
+
+		const container_type* mpContainer;
+		eastl_size_t          mnChunk;      // Index of the current chunk, or the chunk count for the end iterator.
+		uint32_t              mnPosition;   // Index in an array chunk, run index in a run chunk, or bit index in a bitmap chunk.
+		uint32_t              mnOffset;     // Offset within the current run of a run chunk.
+		uint32_t              mnValue;      // The value at the current position.
+	};
+
+
+
+	/// roaring_bitmap
+	///
+	/// Implements a compressed set of uint32_t values (see the top of this file).
+	/// Membership tests are a binary search over the chunk keys followed by a bit
+	/// test or binary search within the chunk. Set operations between bitmaps work
+	/// chunk by chunk: word-parallel (with SIMD where available) when both chunks
+	/// are bitmaps, and with merges or galloping searches when one is an array.
+	///
+	/// Example usage:
+	///     eastl::roaring_bitmap<> postings1, postings2;
+	///     postings1.add(17);
+	///     postings1.add(4000000000u);
+	///     ...
+	///     postings1 &= postings2;
+	///
+	///     for(uint32_t docId : postings1)
+	///         Visit(docId);
+	///
+	template <typename Allocator = EASTLAllocatorType>
+	class roaring_bitmap
+	{
+	public:
+		typedef roaring_bitmap<Allocator>           this_type;
+		typedef uint32_t                            value_type;
+		typedef uint32_t                            reference;
+		typedef uint32_t                            const_reference;
+		typedef roaring_bitmap_iterator<Allocator>  iterator;
+		typedef roaring_bitmap_iterator<Allocator>  const_iterator;
+		typedef Allocator                           allocator_type;
+		typedef eastl_size_t                        size_type;
+		typedef ptrdiff_t                           difference_type;
+
+		enum
+		{
+			kArrayMaxSize = 4096   // Chunks with more values than this are stored as bitmaps.
+		};
+
+	protected:
+		friend class roaring_bitmap_iterator<Allocator>;
+
+		enum ChunkType
+		{
+			kChunkArray,
+			kChunkBitmap,
+			kChunkRun
+		};
+
+		enum
+		{
+			kBitmapWordCount = 1024,
+			kSerialCookie    = 0x45524231   // Identifies the serialized format.
+		};
+
+		typedef eastl::vector<uint16_t, Allocator> ValueVector;
+		typedef eastl::vector<uint64_t, Allocator> WordVector;
+
+		struct Chunk
+		{
+			uint16_t    mKey;            // The high 16 bits of the values in the chunk.
+			uint16_t    mType;           // A ChunkType.
+			uint32_t    mnSize;          // The number of values in the chunk, from 1 to 65536.
+			ValueVector mValues;         // The array values, or the (start, length - 1) pairs of the runs.
+			WordVector  mWords;          // The bitmap words.
+
+			Chunk(uint16_t key, const Allocator& allocator)
+				: mKey(key), mType(kChunkArray), mnSize(0), mValues(allocator), mWords(allocator) { }
+		};
+
+		typedef eastl::vector<Chunk, Allocator> ChunkVector;
+
+		ChunkVector mChunks;            // Sorted by key.
+
+	public:
+		roaring_bitmap();
+		explicit roaring_bitmap(const allocator_type& allocator);
+		roaring_bitmap(std::initializer_list<value_type> ilist, const allocator_type& allocator = EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR);
+
+		template <typename InputIterator>
+		roaring_bitmap(InputIterator first, InputIterator last, const allocator_type& allocator = EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR);
+
+		void swap(this_type& x);
+
+		const_iterator begin() const;
+		const_iterator cbegin() const { return begin(); }
+		const_iterator end() const    { return const_iterator(this, mChunks.size()); }
+		const_iterator cend() const   { return end(); }
+
+		bool      empty() const { return mChunks.empty(); }
+		size_type size() const  { return (size_type)cardinality(); }
+		uint64_t  cardinality() const;   // Returns the number of values, which can be 2^32 and so needs 64 bits.
+		void      clear()       { mChunks.clear(); }
+
+		bool add(value_type value);      // Returns true if value wasn't already in the set.
+		bool remove(value_type value);   // Returns true if value was in the set.
+		bool contains(value_type value) const;
+
+		template <typename InputIterator>
+		void add(InputIterator first, InputIterator last);
+
+		this_type& operator|=(const this_type& x);   // Union.
+		this_type& operator&=(const this_type& x);   // Intersection.
+		this_type& operator-=(const this_type& x);   // Difference.
+
+		bool run_optimize();             // Converts chunks to run form where that is smaller, and back where not. Returns true if any chunk is then in run form.
+
+		size_type serialized_size() const;
+		size_type serialize(void* pBuffer, size_type bufferSize) const;    // Writes the bitmap in a portable little-endian format. Returns the number of bytes written, or 0 if bufferSize is less than serialized_size().
+		bool      deserialize(const void* pBuffer, size_type bufferSize); // Reads a bitmap written by serialize. Returns false, and clears the bitmap, if the data is malformed.
+
+		bool equals(const this_type& x) const;
+		bool validate() const;
+
+	protected:
+		static uint16_t HighBits(value_type value) { return (uint16_t)(value >> 16); }
+		static uint16_t LowBits(value_type value)  { return (uint16_t)(value & 0xffff); }
+
+		size_type FindChunk(uint16_t key) const;  // Returns the index of the first chunk whose key is >= key.
+		void      Increment(iterator& it) const;
+		void      SetIteratorValue(iterator& it) const;
+
+		template <typename Function>
+		static void ChunkForEach(const Chunk& chunk, Function f); // Calls f(low) with each value of the chunk, in increasing order.
+
+		static bool ChunkContains(const Chunk& chunk, uint16_t low);
+		static void ChunkToArray(Chunk& chunk);
+		static void ChunkToBitmap(Chunk& chunk);
+		static void ChunkToRun(Chunk& chunk);
+		static void ChunkMaterialize(Chunk& chunk);  // Converts a run chunk to an array or bitmap chunk.
+		static void ChunkNormalize(Chunk& chunk);    // Converts between array and bitmap chunks according to size.
+
+		static void ChunkUnion(Chunk& a, const Chunk& b);
+		static void ChunkIntersection(Chunk& a, const Chunk& b);
+		static void ChunkDifference(Chunk& a, const Chunk& b);
+		static bool ChunkEquals(const Chunk& a, const Chunk& b);
+
+		static const uint16_t* Gallop(const uint16_t* first, const uint16_t* last, uint16_t value);
+
+		static bool     BitmapTest(const uint64_t* pWords, uint16_t low) { return ((pWords[low >> 6] >> (low & 63)) & 1) != 0; }
+		static uint32_t BitmapCount(const uint64_t* pWords)             { return (uint32_t)Internal::BitWordsCount(pWords, kBitmapWordCount); }
+		static uint32_t CountRuns(const Chunk& chunk);
+	};
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// roaring_bitmap
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Allocator>
+	inline roaring_bitmap<Allocator>::roaring_bitmap()
+		: mChunks(EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR)
+	{
+	}
+
+
+	template <typename Allocator>
+	inline roaring_bitmap<Allocator>::roaring_bitmap(const allocator_type& allocator)
+		: mChunks(allocator)
+	{
+	}
+
+
+	template <typename Allocator>
+	inline roaring_bitmap<Allocator>::roaring_bitmap(std::initializer_list<value_type> ilist, const allocator_type& allocator)
+		: mChunks(allocator)
+	{
+		add(ilist.begin(), ilist.end());
+	}
+
+
+	template <typename Allocator>
+	template <typename InputIterator>
+	inline roaring_bitmap<Allocator>::roaring_bitmap(InputIterator first, InputIterator last, const allocator_type& allocator)
+		: mChunks(allocator)
+	{
+		add(first, last);
+	}
+
+
+	template <typename Allocator>
+	inline void roaring_bitmap<Allocator>::swap(this_type& x)
+	{
+		mChunks.swap(x.mChunks);
+	}
+
+
+	template <typename Allocator>
+	inline typename roaring_bitmap<Allocator>::const_iterator
+	roaring_bitmap<Allocator>::begin() const
+	{
+		const_iterator it(this, 0);
+
+		if(!mChunks.empty())
+		{
+			const Chunk& chunk = mChunks[0];
+
+			if(chunk.mType == kChunkBitmap)
+			{
+				const size_t wordIndex = Internal::BitWordsFind<true>(chunk.mWords.data(), 0, kBitmapWordCount);
+				it.mnPosition = (uint32_t)(wordIndex * 64) + (uint32_t)eastl::countr_zero(chunk.mWords[wordIndex]);
+			}
+
+			SetIteratorValue(it);
+		}
+
+		return it;
+	}
+
+
+	template <typename Allocator>
+	inline void roaring_bitmap<Allocator>::SetIteratorValue(iterator& it) const
+	{
+		const Chunk& chunk = mChunks[it.mnChunk];
+		uint32_t     low;
+
+		if(chunk.mType == kChunkArray)
+			low = chunk.mValues[it.mnPosition];
+		else if(chunk.mType == kChunkBitmap)
+			low = it.mnPosition;
+		else
+			low = (uint32_t)chunk.mValues[it.mnPosition * 2] + it.mnOffset;
+
+		it.mnValue = ((uint32_t)chunk.mKey << 16) | low;
+	}
+
+
+	template <typename Allocator>
+	void roaring_bitmap<Allocator>::Increment(iterator& it) const
+	{
+		const Chunk& chunk = mChunks[it.mnChunk];
+		bool         bNextChunk;
+
+		if(chunk.mType == kChunkArray)
+			bNextChunk = (++it.mnPosition == chunk.mnSize);
+		else if(chunk.mType == kChunkRun)
+		{
+			if(it.mnOffset < chunk.mValues[it.mnPosition * 2 + 1])
+				it.mnOffset++;
+			else
+			{
+				it.mnOffset = 0;
+				it.mnPosition++;
+			}
+
+			bNextChunk = ((it.mnPosition * 2) == (uint32_t)chunk.mValues.size());
+		}
+		else
+		{
+			const uint64_t* const pWords    = chunk.mWords.data();
+			size_t                wordIndex = (size_t)(it.mnPosition >> 6);
+			uint64_t              word      = ((it.mnPosition & 63) == 63) ? 0 : (pWords[wordIndex] & (~UINT64_C(0) << ((it.mnPosition & 63) + 1)));
+
+			if(!word)
+			{
+				wordIndex = Internal::BitWordsFind<true>(pWords, wordIndex + 1, kBitmapWordCount);
+				word      = (wordIndex < kBitmapWordCount) ? pWords[wordIndex] : 0;
+			}
+
+			bNextChunk = (word == 0);
+
+			if(!bNextChunk)
+				it.mnPosition = (uint32_t)(wordIndex * 64) + (uint32_t)eastl::countr_zero(word);
+		}
+
+		if(bNextChunk)
+		{
+			it.mnPosition = 0;
+			it.mnOffset   = 0;
+
+			if(++it.mnChunk == mChunks.size())
+				return;
+
+			const Chunk& next = mChunks[it.mnChunk];
+
+			if(next.mType == kChunkBitmap)
+			{
+				const size_t wordIndex = Internal::BitWordsFind<true>(next.mWords.data(), 0, kBitmapWordCount);
+				it.mnPosition = (uint32_t)(wordIndex * 64) + (uint32_t)eastl::countr_zero(next.mWords[wordIndex]);
+			}
+		}
+
+		SetIteratorValue(it);
+	}
+
+
+	template <typename Allocator>
+	uint64_t roaring_bitmap<Allocator>::cardinality() const
+	{
+		uint64_t result = 0;
+
+		for(typename ChunkVector::const_iterator it = mChunks.begin(); it != mChunks.end(); ++it)
+			result += it->mnSize;
+
+		return result;
+	}
+
+
+	template <typename Allocator>
+	inline typename roaring_bitmap<Allocator>::size_type
+	roaring_bitmap<Allocator>::FindChunk(uint16_t key) const
+	{
+		size_type first = 0, count = (size_type)mChunks.size();
+
+		while(count > 0)
+		{
+			const size_type half = count / 2;
+
+			if(mChunks[first + half].mKey < key)
+			{
+				first += half + 1;
+				count -= half + 1;
+			}
+			else
+				count = half;
+		}
+
+		return first;
+	}
+
+
+	template <typename Allocator>
+	bool roaring_bitmap<Allocator>::add(value_type value)
+	{
+		const uint16_t  key   = HighBits(value);
+		const uint16_t  low   = LowBits(value);
+		const size_type index = FindChunk(key);
+
+		if((index == mChunks.size()) || (mChunks[index].mKey != key))
+		{
+			Chunk chunk(key, mChunks.get_allocator());
+			chunk.mValues.push_back(low);
+			chunk.mnSize = 1;
+			mChunks.insert(mChunks.begin() + index, eastl::move(chunk));
+			return true;
+		}
+
+		Chunk& chunk = mChunks[index];
+
+		if(chunk.mType == kChunkRun)
+		{
+			if(ChunkContains(chunk, low))
+				return false;
+			ChunkMaterialize(chunk);
+		}
+
+		if(chunk.mType == kChunkArray)
+		{
+			typename ValueVector::iterator it = eastl::lower_bound(chunk.mValues.begin(), chunk.mValues.end(), low);
+
+			if((it != chunk.mValues.end()) && (*it == low))
+				return false;
+
+			if(chunk.mnSize < (uint32_t)kArrayMaxSize)
+			{
+				chunk.mValues.insert(it, low);
+				chunk.mnSize++;
+				return true;
+			}
+
+			ChunkToBitmap(chunk);
+		}
+
+		uint64_t& word = chunk.mWords[low >> 6];
+		const uint64_t mask = UINT64_C(1) << (low & 63);
+
+		if(word & mask)
+			return false;
+
+		word |= mask;
+		chunk.mnSize++;
+		return true;
+	}
+
+
+	template <typename Allocator>
+	template <typename InputIterator>
+	inline void roaring_bitmap<Allocator>::add(InputIterator first, InputIterator last)
+	{
+		for(; first != last; ++first)
+			add((value_type)*first);
+	}
+
+
+	template <typename Allocator>
+	bool roaring_bitmap<Allocator>::remove(value_type value)
+	{
+		const uint16_t  key   = HighBits(value);
+		const uint16_t  low   = LowBits(value);
+		const size_type index = FindChunk(key);
+
+		if((index == mChunks.size()) || (mChunks[index].mKey != key) || !ChunkContains(mChunks[index], low))
+			return false;
+
+		Chunk& chunk = mChunks[index];
+
+		if(chunk.mnSize == 1)
+		{
+			mChunks.erase(mChunks.begin() + index);
+			return true;
+		}
+
+		ChunkMaterialize(chunk);
+
+		if(chunk.mType == kChunkArray)
+			chunk.mValues.erase(eastl::lower_bound(chunk.mValues.begin(), chunk.mValues.end(), low));
+		else
+			chunk.mWords[low >> 6] &= ~(UINT64_C(1) << (low & 63));
+
+		chunk.mnSize--;
+		ChunkNormalize(chunk);
+		return true;
+	}
+
+
+	template <typename Allocator>
+	inline bool roaring_bitmap<Allocator>::contains(value_type value) const
+	{
+		const uint16_t  key   = HighBits(value);
+		const size_type index = FindChunk(key);
+
+		return (index != mChunks.size()) && (mChunks[index].mKey == key) && ChunkContains(mChunks[index], LowBits(value));
+	}
+
+
+	template <typename Allocator>
+	typename roaring_bitmap<Allocator>::this_type&
+	roaring_bitmap<Allocator>::operator|=(const this_type& x)
+	{
+		if(&x == this)
+			return *this;
+
+		ChunkVector result(mChunks.get_allocator());
+		result.reserve(mChunks.size() + x.mChunks.size());
+
+		typename ChunkVector::iterator       a    = mChunks.begin();
+		typename ChunkVector::const_iterator b    = x.mChunks.begin();
+		const typename ChunkVector::iterator aEnd = mChunks.end();
+
+		while((a != aEnd) || (b != x.mChunks.end()))
+		{
+			if((b == x.mChunks.end()) || ((a != aEnd) && (a->mKey < b->mKey)))
+				result.push_back(eastl::move(*a++));
+			else if((a == aEnd) || (b->mKey < a->mKey))
+				result.push_back(*b++);
+			else
+			{
+				ChunkUnion(*a, *b++);
+				result.push_back(eastl::move(*a++));
+			}
+		}
+
+		mChunks.swap(result);
+		return *this;
+	}
+
+
+	template <typename Allocator>
+	typename roaring_bitmap<Allocator>::this_type&
+	roaring_bitmap<Allocator>::operator&=(const this_type& x)
+	{
+		if(&x == this)
+			return *this;
+
+		typename ChunkVector::iterator       out = mChunks.begin();
+		typename ChunkVector::const_iterator b   = x.mChunks.begin();
+
+		for(typename ChunkVector::iterator a = mChunks.begin(); (a != mChunks.end()) && (b != x.mChunks.end()); ++a)
+		{
+			while((b != x.mChunks.end()) && (b->mKey < a->mKey))
+				++b;
+
+			if((b != x.mChunks.end()) && (b->mKey == a->mKey))
+			{
+				ChunkIntersection(*a, *b);
+
+				if(a->mnSize)
+				{
+					if(out != a)
+						*out = eastl::move(*a);
+					++out;
+				}
+			}
+		}
+
+		mChunks.erase(out, mChunks.end());
+		return *this;
+	}
+
+
+	template <typename Allocator>
+	typename roaring_bitmap<Allocator>::this_type&
+	roaring_bitmap<Allocator>::operator-=(const this_type& x)
+	{
+		if(&x == this)
+		{
+			clear();
+			return *this;
+		}
+
+		typename ChunkVector::iterator       out = mChunks.begin();
+		typename ChunkVector::const_iterator b   = x.mChunks.begin();
+
+		for(typename ChunkVector::iterator a = mChunks.begin(); a != mChunks.end(); ++a)
+		{
+			while((b != x.mChunks.end()) && (b->mKey < a->mKey))
+				++b;
+
+			if((b != x.mChunks.end()) && (b->mKey == a->mKey))
+				ChunkDifference(*a, *b);
+
+			if(a->mnSize)
+			{
+				if(out != a)
+					*out = eastl::move(*a);
+				++out;
+			}
+		}
+
+		mChunks.erase(out, mChunks.end());
+		return *this;
+	}
+
+
+	template <typename Allocator>
+	bool roaring_bitmap<Allocator>::run_optimize()
+	{
+		bool bHasRuns = false;
+
+		for(typename ChunkVector::iterator it = mChunks.begin(); it != mChunks.end(); ++it)
+		{
+			Chunk& chunk = *it;
+
+			// The sizes in bytes of the chunk as runs, and as an array or bitmap.
+			const uint32_t runSize   = 4 * CountRuns(chunk);
+			const uint32_t otherSize = (chunk.mnSize <= (uint32_t)kArrayMaxSize) ? (2 * chunk.mnSize) : (8 * kBitmapWordCount);
+
+			if(runSize < otherSize)
+			{
+				if(chunk.mType != kChunkRun)
+					ChunkToRun(chunk);
+				bHasRuns = true;
+			}
+			else
+				ChunkMaterialize(chunk);
+		}
+
+		return bHasRuns;
+	}
+
+
+	template <typename Allocator>
+	bool roaring_bitmap<Allocator>::equals(const this_type& x) const
+	{
+		if(mChunks.size() != x.mChunks.size())
+			return false;
+
+		for(size_type i = 0, iEnd = (size_type)mChunks.size(); i < iEnd; i++)
+		{
+			if(!ChunkEquals(mChunks[i], x.mChunks[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+
+	template <typename Allocator>
+	bool roaring_bitmap<Allocator>::validate() const
+	{
+		for(size_type i = 0, iEnd = (size_type)mChunks.size(); i < iEnd; i++)
+		{
+			const Chunk& chunk = mChunks[i];
+
+			if((i > 0) && (mChunks[i - 1].mKey >= chunk.mKey))
+				return false;
+
+			if(chunk.mType == kChunkArray)
+			{
+				if((chunk.mnSize == 0) || (chunk.mnSize > (uint32_t)kArrayMaxSize) || (chunk.mValues.size() != chunk.mnSize))
+					return false;
+
+				for(size_type j = 1; j < chunk.mnSize; j++)
+				{
+					if(chunk.mValues[j - 1] >= chunk.mValues[j])
+						return false;
+				}
+			}
+			else if(chunk.mType == kChunkBitmap)
+			{
+				if((chunk.mnSize <= (uint32_t)kArrayMaxSize) || (chunk.mWords.size() != kBitmapWordCount) || (BitmapCount(chunk.mWords.data()) != chunk.mnSize))
+					return false;
+			}
+			else
+			{
+				const size_type runCount = (size_type)chunk.mValues.size() / 2;
+				uint32_t        size     = 0;
+
+				if((runCount == 0) || (chunk.mValues.size() % 2))
+					return false;
+
+				for(size_type r = 0; r < runCount; r++)
+				{
+					const uint32_t start = chunk.mValues[r * 2];
+					const uint32_t last  = start + chunk.mValues[r * 2 + 1];
+
+					if((last > 0xffff) || ((r > 0) && (start <= (uint32_t)chunk.mValues[r * 2 - 2] + chunk.mValues[r * 2 - 1] + 1)))
+						return false; // Runs must not overflow, overlap or touch.
+
+					size += last - start + 1;
+				}
+
+				if(size != chunk.mnSize)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Chunk functions
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Allocator>
+	template <typename Function>
+	inline void roaring_bitmap<Allocator>::ChunkForEach(const Chunk& chunk, Function f)
+	{
+		if(chunk.mType == kChunkArray)
+		{
+			for(typename ValueVector::const_iterator it = chunk.mValues.begin(); it != chunk.mValues.end(); ++it)
+				f(*it);
+		}
+		else if(chunk.mType == kChunkBitmap)
+		{
+			for(uint32_t i = 0; i < kBitmapWordCount; i++)
+			{
+				for(uint64_t word = chunk.mWords[i]; word; word &= (word - 1))
+					f((uint16_t)((i * 64) + (uint32_t)eastl::countr_zero(word)));
+			}
+		}
+		else
+		{
+			for(size_type r = 0, rEnd = (size_type)chunk.mValues.size(); r < rEnd; r += 2)
+			{
+				const uint32_t start = chunk.mValues[r];
+				const uint32_t last  = start + chunk.mValues[r + 1];
+
+				for(uint32_t low = start; low <= last; low++)
+					f((uint16_t)low);
+			}
+		}
+	}
+
+
+	template <typename Allocator>
+	bool roaring_bitmap<Allocator>::ChunkContains(const Chunk& chunk, uint16_t low)
+	{
+		if(chunk.mType == kChunkArray)
+			return eastl::binary_search(chunk.mValues.begin(), chunk.mValues.end(), low);
+
+		if(chunk.mType == kChunkBitmap)
+			return BitmapTest(chunk.mWords.data(), low);
+
+		// Find the last run which starts at or before low.
+		size_type first = 0, count = (size_type)chunk.mValues.size() / 2;
+
+		while(count > 0)
+		{
+			const size_type half = count / 2;
+
+			if(chunk.mValues[(first + half) * 2] <= low)
+			{
+				first += half + 1;
+				count -= half + 1;
+			}
+			else
+				count = half;
+		}
+
+		return (first > 0) && (((uint32_t)low - chunk.mValues[(first - 1) * 2]) <= chunk.mValues[(first - 1) * 2 + 1]);
+	}
+
+
+	template <typename Allocator>
+	void roaring_bitmap<Allocator>::ChunkToArray(Chunk& chunk)
+	{
+		ValueVector values(chunk.mValues.get_allocator());
+		values.reserve(chunk.mnSize);
+
+		ChunkForEach(chunk, [&values](uint16_t low) { values.push_back(low); });
+
+		chunk.mValues.swap(values);
+		chunk.mWords.set_capacity(0);
+		chunk.mType = kChunkArray;
+	}
+
+
+	template <typename Allocator>
+	void roaring_bitmap<Allocator>::ChunkToBitmap(Chunk& chunk)
+	{
+		WordVector words(kBitmapWordCount, 0, chunk.mWords.get_allocator());
+		uint64_t*  pWords = words.data();
+
+		ChunkForEach(chunk, [pWords](uint16_t low) { pWords[low >> 6] |= (UINT64_C(1) << (low & 63)); });
+
+		chunk.mWords.swap(words);
+		chunk.mValues.set_capacity(0);
+		chunk.mType = kChunkBitmap;
+	}
+
+
+	template <typename Allocator>
+	void roaring_bitmap<Allocator>::ChunkToRun(Chunk& chunk)
+	{
+		ValueVector runs(chunk.mValues.get_allocator());
+		runs.reserve(CountRuns(chunk) * 2);
+
+		ChunkForEach(chunk, [&runs](uint16_t low)
+		{
+			if(!runs.empty() && ((uint32_t)runs[runs.size() - 2] + runs.back() + 1 == low))
+				runs.back()++;
+			else
+			{
+				runs.push_back(low);
+				runs.push_back(0);
+			}
+		});
+
+		chunk.mValues.swap(runs);
+		chunk.mWords.set_capacity(0);
+		chunk.mType = kChunkRun;
+	}
+
+
+	template <typename Allocator>
+	inline void roaring_bitmap<Allocator>::ChunkMaterialize(Chunk& chunk)
+	{
+		if(chunk.mType == kChunkRun)
+		{
+			if(chunk.mnSize <= (uint32_t)kArrayMaxSize)
+				ChunkToArray(chunk);
+			else
+				ChunkToBitmap(chunk);
+		}
+	}
+
+
+	template <typename Allocator>
+	inline void roaring_bitmap<Allocator>::ChunkNormalize(Chunk& chunk)
+	{
+		if((chunk.mType == kChunkBitmap) && (chunk.mnSize <= (uint32_t)kArrayMaxSize))
+			ChunkToArray(chunk);
+		else if((chunk.mType == kChunkArray) && (chunk.mnSize > (uint32_t)kArrayMaxSize))
+			ChunkToBitmap(chunk);
+	}
+
+
+	template <typename Allocator>
+	uint32_t roaring_bitmap<Allocator>::CountRuns(const Chunk& chunk)
+	{
+		if(chunk.mType == kChunkRun)
+			return (uint32_t)chunk.mValues.size() / 2;
+
+		uint32_t runCount = 0;
+
+		if(chunk.mType == kChunkBitmap)
+		{
+			uint64_t carry = 0; // The top bit of the previous word.
+
+			for(uint32_t i = 0; i < kBitmapWordCount; i++)
+			{
+				const uint64_t word = chunk.mWords[i];
+				runCount += (uint32_t)eastl::popcount(word & ~((word << 1) | carry)); // Count the bits which start a run.
+				carry = word >> 63;
+			}
+		}
+		else
+		{
+			for(uint32_t i = 0; i < chunk.mnSize; i++)
+			{
+				if((i == 0) || (chunk.mValues[i] != chunk.mValues[i - 1] + 1))
+					runCount++;
+			}
+		}
+
+		return runCount;
+	}
+
+
+	template <typename Allocator>
+	inline const uint16_t* roaring_bitmap<Allocator>::Gallop(const uint16_t* first, const uint16_t* last, uint16_t value)
+	{
+		// Probe at exponentially growing distances to bracket value, then binary search the bracket.
+		ptrdiff_t step = 1;
+
+		while(((last - first) > step) && (first[step] < value))
+		{
+			first += step;
+			step  *= 2;
+		}
+
+		return eastl::lower_bound(first, ((last - first) > step) ? (first + step + 1) : last, value);
+	}
+
+
+	template <typename Allocator>
+	void roaring_bitmap<Allocator>::ChunkUnion(Chunk& a, const Chunk& b)
+	{
+		if(b.mType == kChunkRun)
+		{
+			Chunk temp(b);
+			ChunkMaterialize(temp);
+			ChunkUnion(a, temp);
+			return;
+		}
+
+		ChunkMaterialize(a);
+
+		if((a.mType == kChunkArray) && (b.mType == kChunkArray) && ((a.mnSize + b.mnSize) <= (uint32_t)kArrayMaxSize))
+		{
+			ValueVector values(a.mValues.get_allocator());
+			values.resize(a.mnSize + b.mnSize);
+
+			const uint16_t* const pEnd = eastl::set_union(a.mValues.begin(), a.mValues.end(), b.mValues.begin(), b.mValues.end(), values.begin());
+
+			values.resize((size_type)(pEnd - values.begin()));
+			a.mValues.swap(values);
+			a.mnSize = (uint32_t)a.mValues.size();
+			return;
+		}
+
+		if(a.mType == kChunkArray)
+		{
+			if(b.mType == kChunkBitmap)
+			{
+				// Add a's values to a copy of b's words, rather than b's values to a's words.
+				WordVector words(b.mWords);
+				for(typename ValueVector::const_iterator it = a.mValues.begin(); it != a.mValues.end(); ++it)
+					words[*it >> 6] |= (UINT64_C(1) << (*it & 63));
+
+				a.mWords.swap(words);
+				a.mValues.set_capacity(0);
+				a.mType = kChunkBitmap;
+				a.mnSize = BitmapCount(a.mWords.data());
+				return;
+			}
+
+			ChunkToBitmap(a);
+		}
+
+		if(b.mType == kChunkBitmap)
+			Internal::BitWordsTransform(a.mWords.data(), b.mWords.data(), kBitmapWordCount, Internal::BitWordsOrOp());
+		else
+		{
+			for(typename ValueVector::const_iterator it = b.mValues.begin(); it != b.mValues.end(); ++it)
+				a.mWords[*it >> 6] |= (UINT64_C(1) << (*it & 63));
+		}
+
+		a.mnSize = BitmapCount(a.mWords.data());
+		ChunkNormalize(a); // Two arrays may have had more than kArrayMaxSize values between them but not in their union.
+	}
+
+
+	template <typename Allocator>
+	void roaring_bitmap<Allocator>::ChunkIntersection(Chunk& a, const Chunk& b)
+	{
+		if(b.mType == kChunkRun)
+		{
+			Chunk temp(b);
+			ChunkMaterialize(temp);
+			ChunkIntersection(a, temp);
+			return;
+		}
+
+		ChunkMaterialize(a);
+
+		if((a.mType == kChunkBitmap) && (b.mType == kChunkBitmap))
+		{
+			Internal::BitWordsTransform(a.mWords.data(), b.mWords.data(), kBitmapWordCount, Internal::BitWordsAndOp());
+			a.mnSize = BitmapCount(a.mWords.data());
+			ChunkNormalize(a);
+			return;
+		}
+
+		ValueVector values(a.mValues.get_allocator());
+
+		if(a.mType == kChunkBitmap) // and b is an array.
+		{
+			values.reserve(b.mnSize);
+			for(typename ValueVector::const_iterator it = b.mValues.begin(); it != b.mValues.end(); ++it)
+			{
+				if(BitmapTest(a.mWords.data(), *it))
+					values.push_back(*it);
+			}
+			a.mWords.set_capacity(0);
+			a.mType = kChunkArray;
+		}
+		else if(b.mType == kChunkBitmap) // and a is an array.
+		{
+			values.reserve(a.mnSize);
+			for(typename ValueVector::const_iterator it = a.mValues.begin(); it != a.mValues.end(); ++it)
+			{
+				if(BitmapTest(b.mWords.data(), *it))
+					values.push_back(*it);
+			}
+		}
+		else
+		{
+			// Gallop through the larger array when the arrays differ a lot in size, and merge otherwise.
+			const bool      bASmaller = (a.mnSize <= b.mnSize);
+			const uint16_t* pSmall    = bASmaller ? a.mValues.data() : b.mValues.data();
+			const uint16_t* pSmallEnd = pSmall + (bASmaller ? a.mnSize : b.mnSize);
+			const uint16_t* pLarge    = bASmaller ? b.mValues.data() : a.mValues.data();
+			const uint16_t* pLargeEnd = pLarge + (bASmaller ? b.mnSize : a.mnSize);
+
+			values.reserve((size_type)(pSmallEnd - pSmall));
+
+			if((size_t)(pSmallEnd - pSmall) * 32 < (size_t)(pLargeEnd - pLarge))
+			{
+				for(; (pSmall != pSmallEnd) && (pLarge != pLargeEnd); ++pSmall)
+				{
+					pLarge = Gallop(pLarge, pLargeEnd, *pSmall);
+
+					if((pLarge != pLargeEnd) && (*pLarge == *pSmall))
+						values.push_back(*pSmall);
+				}
+			}
+			else
+			{
+				while((pSmall != pSmallEnd) && (pLarge != pLargeEnd))
+				{
+					if(*pSmall < *pLarge)
+						++pSmall;
+					else if(*pLarge < *pSmall)
+						++pLarge;
+					else
+					{
+						values.push_back(*pSmall++);
+						++pLarge;
+					}
+				}
+			}
+		}
+
+		a.mValues.swap(values);
+		a.mnSize = (uint32_t)a.mValues.size();
+	}
+
+
+	template <typename Allocator>
+	void roaring_bitmap<Allocator>::ChunkDifference(Chunk& a, const Chunk& b)
+	{
+		if(b.mType == kChunkRun)
+		{
+			Chunk temp(b);
+			ChunkMaterialize(temp);
+			ChunkDifference(a, temp);
+			return;
+		}
+
+		ChunkMaterialize(a);
+
+		if(a.mType == kChunkBitmap)
+		{
+			if(b.mType == kChunkBitmap)
+				Internal::BitWordsTransform(a.mWords.data(), b.mWords.data(), kBitmapWordCount, Internal::BitWordsAndNotOp());
+			else
+			{
+				for(typename ValueVector::const_iterator it = b.mValues.begin(); it != b.mValues.end(); ++it)
+					a.mWords[*it >> 6] &= ~(UINT64_C(1) << (*it & 63));
+			}
+
+			a.mnSize = BitmapCount(a.mWords.data());
+			ChunkNormalize(a);
+			return;
+		}
+
+		ValueVector values(a.mValues.get_allocator());
+		values.reserve(a.mnSize);
+
+		if(b.mType == kChunkBitmap)
+		{
+			for(typename ValueVector::const_iterator it = a.mValues.begin(); it != a.mValues.end(); ++it)
+			{
+				if(!BitmapTest(b.mWords.data(), *it))
+					values.push_back(*it);
+			}
+		}
+		else
+		{
+			const uint16_t*       pB     = b.mValues.data();
+			const uint16_t* const pBEnd  = pB + b.mnSize;
+			const bool            bGallop = ((size_t)a.mnSize * 32) < (size_t)b.mnSize;
+
+			for(typename ValueVector::const_iterator it = a.mValues.begin(); it != a.mValues.end(); ++it)
+			{
+				if(bGallop)
+					pB = Gallop(pB, pBEnd, *it);
+				else
+				{
+					while((pB != pBEnd) && (*pB < *it))
+						++pB;
+				}
+
+				if((pB == pBEnd) || (*pB != *it))
+					values.push_back(*it);
+			}
+		}
+
+		a.mValues.swap(values);
+		a.mnSize = (uint32_t)a.mValues.size();
+	}
+
+
+	template <typename Allocator>
+	bool roaring_bitmap<Allocator>::ChunkEquals(const Chunk& a, const Chunk& b)
+	{
+		if((a.mKey != b.mKey) || (a.mnSize != b.mnSize))
+			return false;
+
+		if(a.mType == b.mType)
+			return (a.mType == kChunkBitmap) ? (a.mWords == b.mWords) : (a.mValues == b.mValues); // Runs are always maximal, so equal run sets have equal runs.
+
+		// Compare different forms by their values. Only a run chunk can match a chunk of
+		// another form, as array and bitmap chunks of the same size have the same form.
+		Chunk temp(a.mType == kChunkRun ? a : b);
+		ChunkMaterialize(temp);
+		return ChunkEquals(temp, (a.mType == kChunkRun) ? b : a);
+	}
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Serialization
+	//
+	// The format is, with every integer little-endian:
+	//     uint32_t cookie           kSerialCookie
+	//     uint32_t chunk count
+	//     for each chunk, in increasing key order:
+	//         uint16_t key
+	//         uint16_t type         A ChunkType.
+	//         uint32_t count        The number of values, runs, or bitmap words.
+	//         count uint16_t values, count (start, length - 1) uint16_t pairs, or 1024 uint64_t words.
+	///////////////////////////////////////////////////////////////////////
+
+	namespace Internal
+	{
+		inline uint8_t* RoaringWrite(uint8_t* p, uint64_t value, int byteCount)
+		{
+			for(int i = 0; i < byteCount; i++, value >>= 8)
+				*p++ = (uint8_t)value;
+			return p;
+		}
+
+		inline const uint8_t* RoaringRead(const uint8_t* p, uint64_t& value, int byteCount)
+		{
+			value = 0;
+			for(int i = 0; i < byteCount; i++)
+				value |= (uint64_t)*p++ << (8 * i);
+			return p;
+		}
+	}
+
+
+	template <typename Allocator>
+	typename roaring_bitmap<Allocator>::size_type
+	roaring_bitmap<Allocator>::serialized_size() const
+	{
+		size_type result = 8;
+
+		for(typename ChunkVector::const_iterator it = mChunks.begin(); it != mChunks.end(); ++it)
+			result += 8 + ((it->mType == kChunkBitmap) ? (kBitmapWordCount * 8) : ((size_type)it->mValues.size() * 2));
+
+		return result;
+	}
+
+
+	template <typename Allocator>
+	typename roaring_bitmap<Allocator>::size_type
+	roaring_bitmap<Allocator>::serialize(void* pBuffer, size_type bufferSize) const
+	{
+		const size_type size = serialized_size();
+
+		if(bufferSize < size)
+			return 0;
+
+		uint8_t* p = static_cast<uint8_t*>(pBuffer);
+
+		p = Internal::RoaringWrite(p, kSerialCookie, 4);
+		p = Internal::RoaringWrite(p, mChunks.size(), 4);
+
+		for(typename ChunkVector::const_iterator it = mChunks.begin(); it != mChunks.end(); ++it)
+		{
+			const Chunk& chunk = *it;
+
+			p = Internal::RoaringWrite(p, chunk.mKey, 2);
+			p = Internal::RoaringWrite(p, chunk.mType, 2);
+
+			if(chunk.mType == kChunkBitmap)
+			{
+				p = Internal::RoaringWrite(p, kBitmapWordCount, 4);
+				for(uint32_t i = 0; i < kBitmapWordCount; i++)
+					p = Internal::RoaringWrite(p, chunk.mWords[i], 8);
+			}
+			else
+			{
+				p = Internal::RoaringWrite(p, (chunk.mType == kChunkArray) ? chunk.mValues.size() : (chunk.mValues.size() / 2), 4);
+				for(typename ValueVector::const_iterator v = chunk.mValues.begin(); v != chunk.mValues.end(); ++v)
+					p = Internal::RoaringWrite(p, *v, 2);
+			}
+		}
+
+		EASTL_ASSERT(p == (static_cast<uint8_t*>(pBuffer) + size));
+		return size;
+	}
+
+
+	template <typename Allocator>
+	bool roaring_bitmap<Allocator>::deserialize(const void* pBuffer, size_type bufferSize)
+	{
+		const uint8_t*       p    = static_cast<const uint8_t*>(pBuffer);
+		const uint8_t* const pEnd = p + bufferSize;
+		uint64_t             cookie, chunkCount;
+
+		clear();
+
+		if(bufferSize < 8)
+			return false;
+
+		p = Internal::RoaringRead(p, cookie, 4);
+		p = Internal::RoaringRead(p, chunkCount, 4);
+
+		if((cookie != kSerialCookie) || (chunkCount > 65536) || (chunkCount * 8 > (uint64_t)(pEnd - p)))
+			return false;
+
+		mChunks.reserve((size_type)chunkCount);
+
+		for(uint64_t c = 0; c < chunkCount; c++)
+		{
+			uint64_t key, type, count;
+
+			if((pEnd - p) < 8)
+				break;
+
+			p = Internal::RoaringRead(p, key, 2);
+			p = Internal::RoaringRead(p, type, 2);
+			p = Internal::RoaringRead(p, count, 4);
+
+			const uint64_t payloadSize = (type == kChunkBitmap) ? (count * 8) : (type == kChunkRun) ? (count * 4) : (count * 2);
+
+			if((type > kChunkRun) || ((type == kChunkBitmap) && (count != kBitmapWordCount)) || (count == 0) || (count > 65536) || (payloadSize > (uint64_t)(pEnd - p)))
+				break;
+
+			mChunks.push_back(Chunk((uint16_t)key, mChunks.get_allocator()));
+			Chunk& chunk = mChunks.back();
+			chunk.mType = (uint16_t)type;
+
+			if(type == kChunkBitmap)
+			{
+				chunk.mWords.resize(kBitmapWordCount);
+				for(uint32_t i = 0; i < kBitmapWordCount; i++)
+					p = Internal::RoaringRead(p, chunk.mWords[i], 8);
+				chunk.mnSize = BitmapCount(chunk.mWords.data());
+			}
+			else
+			{
+				uint64_t value;
+
+				chunk.mValues.reserve((size_type)(payloadSize / 2));
+				for(uint64_t i = 0; i < (payloadSize / 2); i++)
+				{
+					p = Internal::RoaringRead(p, value, 2);
+					chunk.mValues.push_back((uint16_t)value);
+				}
+
+				if(type == kChunkArray)
+					chunk.mnSize = (uint32_t)count;
+				else
+				{
+					for(uint64_t r = 0; r < count; r++)
+						chunk.mnSize += (uint32_t)chunk.mValues[(size_type)(r * 2 + 1)] + 1;
+				}
+			}
+
+			if(chunk.mnSize == 0)
+				break;
+
+			// A bitmap chunk may be small enough to be an array (which validate requires).
+			if((chunk.mType == kChunkBitmap) && (chunk.mnSize <= (uint32_t)kArrayMaxSize))
+				ChunkToArray(chunk);
+		}
+
+		if((mChunks.size() != chunkCount) || (p != pEnd) || !validate())
+		{
+			clear();
+			return false;
+		}
+
+		return true;
+	}
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Allocator>
+	inline bool operator==(const roaring_bitmap<Allocator>& a, const roaring_bitmap<Allocator>& b)
+	{
+		return a.equals(b);
+	}
+
+
+	template <typename Allocator>
+	inline bool operator!=(const roaring_bitmap<Allocator>& a, const roaring_bitmap<Allocator>& b)
+	{
+		return !a.equals(b);
+	}
+
+
+	template <typename Allocator>
+	inline roaring_bitmap<Allocator> operator|(const roaring_bitmap<Allocator>& a, const roaring_bitmap<Allocator>& b)
+	{
+		return roaring_bitmap<Allocator>(a) |= b;
+	}
+
+
+	template <typename Allocator>
+	inline roaring_bitmap<Allocator> operator&(const roaring_bitmap<Allocator>& a, const roaring_bitmap<Allocator>& b)
+	{
+		return roaring_bitmap<Allocator>(a) &= b;
+	}
+
+
+	template <typename Allocator>
+	inline roaring_bitmap<Allocator> operator-(const roaring_bitmap<Allocator>& a, const roaring_bitmap<Allocator>& b)
+	{
+		return roaring_bitmap<Allocator>(a) -= b;
+	}
+
+
+	template <typename Allocator>
+	inline void swap(roaring_bitmap<Allocator>& a, roaring_bitmap<Allocator>& b)
+	{
+		a.swap(b);
+	}
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -114,6 +114,9 @@ namespace eastl
 		template <typename Iterator>
 		set(Iterator itBegin, Iterator itEnd); // allocator arg removed because VC7.1 fails on the default arg. To do: Make a second version of this function without a default arg.
 
+		template <typename Iterator>
+		set(assume_sorted_t, Iterator itBegin, Iterator itEnd, const Compare& compare = Compare(), const allocator_type& allocator = EASTL_SET_DEFAULT_ALLOCATOR); // The range must be sorted. See rbtree.
+
 		// The (this_type&& x) ctor above has the side effect of forcing us to make operator= visible in this subclass.
 		this_type& operator=(const this_type& x) { return (this_type&)base_type::operator=(x); }
 		this_type& operator=(std::initializer_list<value_type> ilist) { return (this_type&)base_type::operator=(ilist); }
@@ -134,6 +137,49 @@ namespace eastl
 		eastl::pair<iterator, iterator>             equal_range(const Key& k);
 		eastl::pair<const_iterator, const_iterator> equal_range(const Key& k) const;
 
+		/// Heterogeneous versions of erase, count and equal_range, available only if Compare
+		/// is transparent. See the heterogeneous lookup notes in red_black_tree.h.
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent_erase<C2, U, this_type, size_type>::type erase(const U& u)
+		{
+			const iterator it(find(u));
+
+			if(it != end())
+			{
+				base_type::erase(it);
+				return 1;
+			}
+			return 0;
+		}
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, size_type>::type count(const U& u) const
+			{ return (find(u) != end()) ? (size_type)1 : (size_type)0; }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, eastl::pair<iterator, iterator> >::type equal_range(const U& u)
+		{
+			const iterator itLower(lower_bound(u));
+
+			if((itLower == end()) || mCompare(u, *itLower)) // If at the end or if (u is < itLower)...
+				return eastl::pair<iterator, iterator>(itLower, itLower);
+
+			iterator itUpper(itLower);
+			return eastl::pair<iterator, iterator>(itLower, ++itUpper);
+		}
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, eastl::pair<const_iterator, const_iterator> >::type equal_range(const U& u) const
+		{
+			const const_iterator itLower(lower_bound(u));
+
+			if((itLower == end()) || mCompare(u, *itLower)) // If at the end or if (u is < itLower)...
+				return eastl::pair<const_iterator, const_iterator>(itLower, itLower);
+
+			const_iterator itUpper(itLower);
+			return eastl::pair<const_iterator, const_iterator>(itLower, ++itUpper);
+		}
+
 	}; // set
 
 
@@ -194,6 +240,9 @@ namespace eastl
 		template <typename Iterator>
 		multiset(Iterator itBegin, Iterator itEnd); // allocator arg removed because VC7.1 fails on the default arg. To do: Make a second version of this function without a default arg.
 
+		template <typename Iterator>
+		multiset(assume_sorted_t, Iterator itBegin, Iterator itEnd, const Compare& compare = Compare(), const allocator_type& allocator = EASTL_MULTISET_DEFAULT_ALLOCATOR); // The range must be sorted. See rbtree.
+
 		// The (this_type&& x) ctor above has the side effect of forcing us to make operator= visible in this subclass.
 		this_type& operator=(const this_type& x) { return (this_type&)base_type::operator=(x); }
 		this_type& operator=(std::initializer_list<value_type> ilist) { return (this_type&)base_type::operator=(ilist); }
@@ -214,6 +263,32 @@ namespace eastl
 		eastl::pair<iterator, iterator>             equal_range(const Key& k);
 		eastl::pair<const_iterator, const_iterator> equal_range(const Key& k) const;
 
+		/// Heterogeneous versions of erase, count and equal_range, available only if Compare
+		/// is transparent. See the heterogeneous lookup notes in red_black_tree.h.
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent_erase<C2, U, this_type, size_type>::type erase(const U& u)
+		{
+			const eastl::pair<iterator, iterator> range(equal_range(u));
+			const size_type n = (size_type)eastl::distance(range.first, range.second);
+			base_type::erase(range.first, range.second);
+			return n;
+		}
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, size_type>::type count(const U& u) const
+		{
+			const eastl::pair<const_iterator, const_iterator> range(equal_range(u));
+			return (size_type)eastl::distance(range.first, range.second);
+		}
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, eastl::pair<iterator, iterator> >::type equal_range(const U& u)
+			{ return eastl::pair<iterator, iterator>(lower_bound(u), upper_bound(u)); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, eastl::pair<const_iterator, const_iterator> >::type equal_range(const U& u) const
+			{ return eastl::pair<const_iterator, const_iterator>(lower_bound(u), upper_bound(u)); }
+
 		/// equal_range_small
 		/// This is a special version of equal_range which is optimized for the 
 		/// case of there being few or no duplicated keys in the tree.
@@ -279,6 +354,14 @@ namespace eastl
 	}
 
 
+	template <typename Key, typename Compare, typename Allocator>
+	template <typename Iterator>
+	inline set<Key, Compare, Allocator>::set(assume_sorted_t, Iterator itBegin, Iterator itEnd, const Compare& compare, const allocator_type& allocator)
+		: base_type(assume_sorted, itBegin, itEnd, compare, allocator)
+	{
+	}
+
+
 	template <typename Key, typename Compare, typename Allocator>
 	inline typename set<Key, Compare, Allocator>::value_compare
 	set<Key, Compare, Allocator>::value_comp() const
@@ -445,6 +528,14 @@ namespace eastl
 	}
 
 
+	template <typename Key, typename Compare, typename Allocator>
+	template <typename Iterator>
+	inline multiset<Key, Compare, Allocator>::multiset(assume_sorted_t, Iterator itBegin, Iterator itEnd, const Compare& compare, const allocator_type& allocator)
+		: base_type(assume_sorted, itBegin, itEnd, compare, allocator)
+	{
+	}
+
+
 	template <typename Key, typename Compare, typename Allocator>
 	inline typename multiset<Key, Compare, Allocator>::value_compare
 	multiset<Key, Compare, Allocator>::value_comp() const
@@ -55,9 +55,34 @@
 	#include <exception>
 #endif
 
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_ATOMIC_SHARED_PTR_LOCK_FREE
+//
+// Defined as 0 or 1. Identifies whether atomic_shared_ptr and atomic_weak_ptr are
+// lock-free. The lock-free implementation keeps a reference count in the upper 16
+// bits of a 64 bit pointer, which requires user space addresses to fit in 48 bits
+// and the upper bits to be free of tags. Android on ARM64 tags heap pointers in the
+// top byte. Where it is 0, a hashed mutex pool is used instead.
+// The count limits each atomic_shared_ptr to 65535 threads inside load or
+// compare_exchange at the same time; debug builds assert if that is exceeded.
+///////////////////////////////////////////////////////////////////////////////
+
+#if !defined(EASTL_ATOMIC_SHARED_PTR_LOCK_FREE)
+	#if defined(EA_HAVE_CPP11_ATOMIC) && EASTL_THREAD_SUPPORT_AVAILABLE && (defined(EA_PROCESSOR_X86_64) || (defined(EA_PROCESSOR_ARM64) && !defined(EA_PLATFORM_ANDROID)))
+		#define EASTL_ATOMIC_SHARED_PTR_LOCK_FREE 1
+	#else
+		#define EASTL_ATOMIC_SHARED_PTR_LOCK_FREE 0
+	#endif
+#endif
+
 EA_DISABLE_ALL_VC_WARNINGS()
 #include <new>
 #include <stddef.h>
+#if EASTL_ATOMIC_SHARED_PTR_LOCK_FREE
+	#include <atomic>
+#endif
 EA_RESTORE_ALL_VC_WARNINGS()
 
 #ifdef _MSC_VER
@@ -163,7 +188,12 @@ namespace eastl
 	{
 		EASTL_ASSERT((mRefCount > 0) && (mWeakRefCount > 0));
 		if(Internal::atomic_decrement(&mRefCount) > 0)
-			Internal::atomic_decrement(&mWeakRefCount);
+		{
+			// Another thread may have released the last reference in between our two decrements,
+			// in which case it has freed the value and left the final weak decrement to us.
+			if(Internal::atomic_decrement(&mWeakRefCount) == 0)
+				free_ref_count_sp();
+		}
 		else
 		{
 			free_value();
@@ -1243,7 +1273,7 @@ namespace eastl
 		// as opposed to wrapping it with a mutex like we do below. Given the nature of shared_ptr, it's 
 		// probably not feasible to implement these operations without a mutex. atomic_is_lock_free exists
 		// in the C++11 Standard because it also applies to other types such as built-in types which can
-		// be lock-free in their access.
+		// be lock-free in their access. See atomic_shared_ptr below for a lock-free alternative.
 		return false;
 	}
 
@@ -1284,7 +1314,7 @@ namespace eastl
 	template <typename T>
 	inline shared_ptr<T> atomic_exchange_explicit(shared_ptr<T>* pSharedPtrA, shared_ptr<T> sharedPtrB, ... /*std::memory_order memoryOrder*/)
 	{
-		atomic_exchange(pSharedPtrA, sharedPtrB);
+		return atomic_exchange(pSharedPtrA, sharedPtrB);
 	}
 
 	// Compares the shared pointers pointed-to by p and expected. If they are equivalent (share ownership of the 
@@ -1687,6 +1717,394 @@ namespace eastl
 	};
 
 
+
+	///////////////////////////////////////////////////////////////////////////
+	// atomic_shared_ptr / atomic_weak_ptr
+	//
+	// An atomic_shared_ptr is a shared_ptr slot that can be loaded, stored,
+	// exchanged and compare-exchanged from multiple threads at once, like the
+	// C++20 std::atomic<shared_ptr<T>>. Unlike the atomic_load/atomic_store
+	// functions above, which work on a plain shared_ptr and thus have to go
+	// through a mutex, atomic_shared_ptr is lock-free where the platform
+	// allows it (see EASTL_ATOMIC_SHARED_PTR_LOCK_FREE).
+	//
+	// Example usage:
+	//     eastl::atomic_shared_ptr<const Config> gConfig;
+	//
+	//     // Reader threads:
+	//     eastl::shared_ptr<const Config> pConfig = gConfig.load();
+	//
+	//     // Writer thread:
+	//     gConfig.store(eastl::make_shared<const Config>(newSettings));
+	//
+	// Implementation:
+	// The shared_ptr is stored in a separately allocated node, and the atomic
+	// word holds a pointer to the node together with a count of "local"
+	// references in its otherwise unused upper bits. A load pins the current
+	// node by incrementing the local count, copies the node's shared_ptr, and
+	// then returns its local reference by decrementing the count again. A
+	// store swaps in a new node and adds the old node's local count to the old
+	// node's own reference count, so that loads which pinned it before the
+	// swap keep it alive until they are done; each such load notices that the
+	// node was swapped out and releases its reference from the node instead.
+	// Those releases may happen before the transfer, so the node's count
+	// starts at zero and may go negative; whoever brings it back to zero
+	// destroys the node.
+	// A new node is allocated on every store, so a node's address can't
+	// reappear in the atomic word while any load still holds a reference to it.
+	///////////////////////////////////////////////////////////////////////////
+
+	namespace Internal
+	{
+		template <typename T>
+		inline bool atomic_smart_ptr_is_null(const shared_ptr<T>& p) EA_NOEXCEPT
+			{ return !p.get() && !p.use_count(); }
+
+		template <typename T>
+		inline bool atomic_smart_ptr_is_null(const weak_ptr<T>& p) EA_NOEXCEPT
+			{ return !p.owner_before(weak_ptr<T>()) && !weak_ptr<T>().owner_before(p); }
+
+		template <typename T>
+		inline bool atomic_smart_ptr_equivalent(const shared_ptr<T>& a, const shared_ptr<T>& b) EA_NOEXCEPT
+			{ return (a.get() == b.get()) && a.equivalent_ownership(b); }
+
+		// weak_ptr doesn't expose its stored pointer, so weak_ptrs are compared by ownership only.
+		template <typename T>
+		inline bool atomic_smart_ptr_equivalent(const weak_ptr<T>& a, const weak_ptr<T>& b) EA_NOEXCEPT
+			{ return !a.owner_before(b) && !b.owner_before(a); }
+
+
+		#if EASTL_ATOMIC_SHARED_PTR_LOCK_FREE
+
+			template <typename Ptr>
+			struct atomic_smart_ptr_node
+			{
+				Ptr                  mPtr;
+				std::atomic<int32_t> mRefCount; // Local references transferred to the node when it was swapped out, minus those released since.
+				                                // Releases may come first and take this negative; it reaches zero only once all are accounted for.
+
+				explicit atomic_smart_ptr_node(Ptr&& ptr) : mPtr(eastl::move(ptr)), mRefCount(0) {}
+			};
+
+
+			/// atomic_smart_ptr_base
+			///
+			/// Implements atomic_shared_ptr and atomic_weak_ptr. Ptr is shared_ptr<T> or weak_ptr<T>.
+			///
+			template <typename Ptr>
+			class atomic_smart_ptr_base
+			{
+			public:
+				typedef Ptr                              value_type;
+				typedef atomic_smart_ptr_node<Ptr>       node_type;
+
+				static const bool is_always_lock_free = true;
+
+				atomic_smart_ptr_base() EA_NOEXCEPT
+					: mValue(0) {}
+
+				atomic_smart_ptr_base(Ptr desired)
+					: mValue((uintptr_t)CreateNode(eastl::move(desired))) {}
+
+				~atomic_smart_ptr_base()
+				{
+					if(node_type* const pNode = GetNode(mValue.load(std::memory_order_relaxed)))
+						DestroyNode(pNode);
+				}
+
+				atomic_smart_ptr_base(const atomic_smart_ptr_base&) = delete;
+				atomic_smart_ptr_base& operator=(const atomic_smart_ptr_base&) = delete;
+
+				bool is_lock_free() const EA_NOEXCEPT
+					{ return true; }
+
+				Ptr load() const
+				{
+					// fetch_add rather than a compare-exchange loop, so that concurrent loads never retry.
+					node_type* const pNode = GetNode(AcquireLocalRef());
+					Ptr result;
+
+					if(pNode)
+						result = pNode->mPtr;
+					ReleaseLocalRef(pNode);
+
+					return result;
+				}
+
+				operator Ptr() const
+					{ return load(); }
+
+				void store(Ptr desired)
+					{ exchange(eastl::move(desired)); }
+
+				Ptr exchange(Ptr desired)
+				{
+					const uintptr_t  oldValue = mValue.exchange((uintptr_t)CreateNode(eastl::move(desired)));
+					node_type* const pOld     = GetNode(oldValue);
+					Ptr result;
+
+					if(pOld)
+					{
+						const int32_t nLocalRefs = (int32_t)GetLocalCount(oldValue);
+
+						if(nLocalRefs == 0)
+						{
+							// No load had the node pinned, so nobody else can reach it any more.
+							result = eastl::move(pOld->mPtr);
+							DestroyNode(pOld);
+						}
+						else
+						{
+							// The node stays alive until we transfer the local references to it.
+							result = pOld->mPtr;
+							TransferLocalRefs(pOld, nLocalRefs);
+						}
+					}
+
+					return result;
+				}
+
+				bool compare_exchange_strong(Ptr& expected, Ptr desired)
+				{
+					// The node for desired is only created once the comparison succeeds, so a failing
+					// compare_exchange doesn't allocate. pNew stays NULL if desired is null.
+					node_type* pNew        = NULL;
+					bool       bNewCreated = false;
+
+					for(;;)
+					{
+						uintptr_t        value = AcquireLocalRef();
+						node_type* const pNode = GetNode(value);
+
+						if(pNode ? !atomic_smart_ptr_equivalent(pNode->mPtr, expected) : !atomic_smart_ptr_is_null(expected))
+						{
+							expected = pNode ? pNode->mPtr : Ptr();
+							ReleaseLocalRef(pNode);
+							if(pNew) // Created by an earlier round which then lost the race to swap it in.
+								DestroyNode(pNew);
+							return false;
+						}
+
+						if(!bNewCreated)
+						{
+							pNew        = CreateNode(eastl::move(desired));
+							bNewCreated = true;
+						}
+
+						// Replace the node if it's still current. The local count may change under us as loads come and go.
+						while(GetNode(value) == pNode)
+						{
+							if(mValue.compare_exchange_weak(value, (uintptr_t)pNew))
+							{
+								// Transfer the other local references to the old node; ours is simply dropped.
+								TransferLocalRefs(pNode, (int32_t)GetLocalCount(value) - 1);
+								return true;
+							}
+						}
+
+						// Someone else swapped the node out and transferred our local reference to it; release it and start over.
+						ReleaseNodeRef(pNode);
+					}
+				}
+
+				bool compare_exchange_weak(Ptr& expected, Ptr desired)
+					{ return compare_exchange_strong(expected, eastl::move(desired)); }
+
+			protected:
+				static const int       kLocalRefShift = 48;                         // User space addresses on the supported platforms fit in 48 bits.
+				static const uintptr_t kLocalRefOne   = (uintptr_t)1 << kLocalRefShift;
+				static const uintptr_t kNodeMask      = kLocalRefOne - 1;
+				static const uintptr_t kLocalRefMax   = ~(uintptr_t)0 >> kLocalRefShift; // 65535 loads and compare_exchanges may be in progress at once.
+
+				static node_type* GetNode(uintptr_t value) EA_NOEXCEPT
+					{ return (node_type*)(value & kNodeMask); }
+
+				static uintptr_t GetLocalCount(uintptr_t value) EA_NOEXCEPT
+					{ return value >> kLocalRefShift; }
+
+				static node_type* CreateNode(Ptr&& ptr)
+				{
+					if(atomic_smart_ptr_is_null(ptr))
+						return NULL;
+
+					EASTLAllocatorType allocator(EASTL_SHARED_PTR_DEFAULT_NAME);
+					void* const pMemory = EASTLAlloc(allocator, sizeof(node_type));
+					node_type* const pNode = ::new(pMemory) node_type(eastl::move(ptr));
+
+					EASTL_ASSERT(((uintptr_t)pNode & ~kNodeMask) == 0);
+					return pNode;
+				}
+
+				static void DestroyNode(node_type* pNode)
+				{
+					EASTLAllocatorType allocator(EASTL_SHARED_PTR_DEFAULT_NAME);
+					pNode->~node_type();
+					EASTLFree(allocator, pNode, sizeof(node_type));
+				}
+
+				// Called once, by the thread that swapped the node out. The node is destroyed here if
+				// the loads that had it pinned have all released their references already.
+				static void TransferLocalRefs(node_type* pNode, int32_t nLocalRefs)
+				{
+					if(pNode && ((pNode->mRefCount.fetch_add(nLocalRefs, std::memory_order_acq_rel) + nLocalRefs) == 0))
+						DestroyNode(pNode);
+				}
+
+				static void ReleaseNodeRef(node_type* pNode)
+				{
+					if(pNode && (pNode->mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1))
+						DestroyNode(pNode);
+				}
+
+				// Pins the current node and returns the new value of mValue. A thread holds at most one local
+				// reference at a time and only for the duration of a load or compare_exchange, so the 16 bit
+				// count limits the number of threads inside those calls at once rather than the number of
+				// readers overall. Exceeding it would wrap the count and free the node too early.
+				uintptr_t AcquireLocalRef() const
+				{
+					const uintptr_t value = mValue.fetch_add(kLocalRefOne);
+					EASTL_ASSERT_MSG(GetLocalCount(value) < kLocalRefMax, "atomic_shared_ptr: too many concurrent loads.");
+					return value + kLocalRefOne;
+				}
+
+				void ReleaseLocalRef(node_type* pNode) const
+				{
+					uintptr_t value = mValue.load(std::memory_order_relaxed);
+
+					while(GetNode(value) == pNode)
+					{
+						// A null slot may have been stored to and back to null since we pinned it. The store
+						// dropped our local reference along with the rest, so there's nothing left to release.
+						if(!pNode && (GetLocalCount(value) == 0))
+							return;
+
+						if(mValue.compare_exchange_weak(value, value - kLocalRefOne))
+							return;
+					}
+
+					ReleaseNodeRef(pNode); // The node was swapped out and our local reference was (or will be) transferred to it.
+				}
+
+				mutable std::atomic<uintptr_t> mValue; // Node pointer in the low bits, local reference count in the high bits.
+			};
+
+		#else
+
+			// Fallback for platforms where the node pointer can't be packed with a count: the same
+			// hashed mutex pool that the shared_ptr atomic functions use.
+			template <typename Ptr>
+			class atomic_smart_ptr_base
+			{
+			public:
+				typedef Ptr value_type;
+
+				static const bool is_always_lock_free = false;
+
+				atomic_smart_ptr_base() EA_NOEXCEPT
+					: mPtr() {}
+
+				atomic_smart_ptr_base(Ptr desired)
+					: mPtr(eastl::move(desired)) {}
+
+				atomic_smart_ptr_base(const atomic_smart_ptr_base&) = delete;
+				atomic_smart_ptr_base& operator=(const atomic_smart_ptr_base&) = delete;
+
+				bool is_lock_free() const EA_NOEXCEPT
+					{ return false; }
+
+				Ptr load() const
+				{
+					Internal::shared_ptr_auto_mutex autoMutex(this);
+					return mPtr;
+				}
+
+				operator Ptr() const
+					{ return load(); }
+
+				void store(Ptr desired)
+					{ exchange(eastl::move(desired)); }
+
+				Ptr exchange(Ptr desired)
+				{
+					{
+						Internal::shared_ptr_auto_mutex autoMutex(this);
+						mPtr.swap(desired);
+					}
+					return desired; // The previous value is released outside the lock.
+				}
+
+				bool compare_exchange_strong(Ptr& expected, Ptr desired)
+				{
+					{
+						Internal::shared_ptr_auto_mutex autoMutex(this);
+
+						if(atomic_smart_ptr_is_null(mPtr) ? atomic_smart_ptr_is_null(expected) : atomic_smart_ptr_equivalent(mPtr, expected))
+						{
+							mPtr.swap(desired);
+							return true;
+						}
+
+						expected = mPtr;
+					}
+					return false;
+				}
+
+				bool compare_exchange_weak(Ptr& expected, Ptr desired)
+					{ return compare_exchange_strong(expected, eastl::move(desired)); }
+
+			protected:
+				Ptr mPtr;
+			};
+
+		#endif
+
+	} // namespace Internal
+
+
+	/// atomic_shared_ptr
+	///
+	/// Provides load, store, exchange, compare_exchange_strong and compare_exchange_weak,
+	/// all of which are sequentially consistent, plus is_lock_free.
+	/// compare_exchange succeeds if the stored shared_ptr holds the same pointer and shares
+	/// ownership with expected; otherwise it copies the stored shared_ptr into expected.
+	///
+	template <typename T>
+	class atomic_shared_ptr : public Internal::atomic_smart_ptr_base< shared_ptr<T> >
+	{
+		typedef Internal::atomic_smart_ptr_base< shared_ptr<T> > base_type;
+
+	public:
+		atomic_shared_ptr() EA_NOEXCEPT {}
+
+		atomic_shared_ptr(shared_ptr<T> desired)
+			: base_type(eastl::move(desired)) {}
+
+		void operator=(shared_ptr<T> desired)
+			{ base_type::store(eastl::move(desired)); }
+	};
+
+
+	/// atomic_weak_ptr
+	///
+	/// The weak_ptr counterpart of atomic_shared_ptr. compare_exchange compares by
+	/// ownership only, as weak_ptr doesn't expose the pointer it stores.
+	///
+	template <typename T>
+	class atomic_weak_ptr : public Internal::atomic_smart_ptr_base< weak_ptr<T> >
+	{
+		typedef Internal::atomic_smart_ptr_base< weak_ptr<T> > base_type;
+
+	public:
+		atomic_weak_ptr() EA_NOEXCEPT {}
+
+		atomic_weak_ptr(weak_ptr<T> desired)
+			: base_type(eastl::move(desired)) {}
+
+		void operator=(weak_ptr<T> desired)
+			{ base_type::store(eastl::move(desired)); }
+	};
+
+
 } // namespace eastl
 
 
@@ -8,7 +8,7 @@
 // C++ standard. We implement the following sorting algorithms:
 //    is_sorted             -- 
 //    sort                  -- Unstable.    The implementation of this is mapped to quick_sort by default.
-//    quick_sort            -- Unstable.    This is actually an intro-sort (quick sort with switch to insertion sort).
+//    quick_sort            -- Unstable.    This is actually a pattern-defeating intro-sort (quick sort with switch to insertion sort and heap sort).
 //    tim_sort              -- Stable.
 //    tim_sort_buffer       -- Stable.
 //    partial_sort          -- Unstable.
@@ -29,6 +29,9 @@
 //
 // * Found in sort_extra.h.
 //
+// sort, stable_sort, radix_sort, partial_sort and nth_element also have parallel
+// versions, which take a task_scheduler (see task_scheduler.h) as their first argument.
+//
 // Additional sorting and related algorithms we may want to implement:
 //    partial_sort_copy     This would be like the std STL version.
 //    paritition            This would be like the std STL version. This is not categorized as a sort routine by the language standard.
@@ -50,6 +53,7 @@
 #include <EASTL/heap.h>
 #include <EASTL/allocator.h>
 #include <EASTL/memory.h>
+#include <EASTL/task_scheduler.h>
 
 
 #if defined(EA_PRAGMA_ONCE_SUPPORTED)
@@ -70,6 +74,27 @@
 #endif
 
 
+// EASTL_PARALLEL_SORT_MIN_SIZE
+//
+// The task_scheduler overloads of the sorting functions sort ranges of this many
+// elements or fewer serially, and don't divide ranges into pieces smaller than this.
+//
+#if !defined(EASTL_PARALLEL_SORT_MIN_SIZE)
+	#define EASTL_PARALLEL_SORT_MIN_SIZE 8192
+#endif
+
+
+// EASTL_QUICK_SORT_LEGACY
+//
+// Defined as 0 or 1. If 1, quick_sort (and thus sort) uses the original median-of-three
+// introsort instead of the pattern-defeating quick sort. This exists for comparison and
+// for users who depend on the exact sequence of compares or swaps of the old version.
+//
+#if !defined(EASTL_QUICK_SORT_LEGACY)
+	#define EASTL_QUICK_SORT_LEGACY 0
+#endif
+
+
 namespace eastl
 {
 
@@ -953,997 +978,2128 @@ namespace eastl
 	}
 
 
-	/// quick_sort
-	///
-	/// This is an unstable sort.
-	/// quick_sort sorts the elements in [first, last) into ascending order, 
-	/// meaning that if i and j are any two valid iterators in [first, last) 
-	/// such that i precedes j, then *j is not less than *i. quick_sort is not 
-	/// guaranteed to be stable. That is, suppose that *i and *j are equivalent: 
-	/// neither one is less than the other. It is not guaranteed that the 
-	/// relative order of these two elements will be preserved by sort.
-	///
-	/// We implement the "introspective" variation of quick-sort. This is 
-	/// considered to be the best general-purpose variant, as it avoids 
-	/// worst-case behaviour and optimizes the final sorting stage by 
-	/// switching to an insertion sort.
-	///
-	template <typename RandomAccessIterator>
-	void quick_sort(RandomAccessIterator first, RandomAccessIterator last)
+	namespace Internal
 	{
-		typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		// Portions of the pdq_sort code were originally written by Orson Peters.
+		// https://github.com/orlp/pdqsort
+		//
+		// Pattern-defeating quick sort is an introsort with the following additions:
+		//    - Tukey's ninther is used as the pivot for large ranges, and median-of-three otherwise.
+		//    - If a partition turns out highly unbalanced, some elements are shuffled to break up the
+		//      pattern which caused it; too many of these and it switches to heap sort, as introsort does.
+		//    - If a partition did no swaps, the range is likely presorted, and an insertion sort which gives
+		//      up after a few moves is tried on each side.
+		//    - Runs of elements equal to a previous pivot are put in place in a single linear pass.
+		//    - For arithmetic types with the default compare, the partition is done in blocks without
+		//      branching on the result of each compare ("BlockQuicksort", Edelkamp and Weiss).
+		//
+		static const int    kPdqInsertionSortLimit        = 24;  // Ranges smaller than this are insertion sorted.
+		static const int    kPdqNintherLimit              = 128; // Ranges larger than this use Tukey's ninther as the pivot.
+		static const size_t kPdqPartialInsertionSortLimit = 8;   // The number of element moves after which a partial insertion sort gives up.
+		static const size_t kPdqBlockSize                 = 64;  // The number of elements per block in block partitioning. Must fit in an unsigned char.
 
-		if(first != last)
+
+		// Whether pdq_sort should use branchless block partitioning for the given value type and compare.
+		// This is only a win if the compare is cheap and doesn't branch itself.
+		template <typename T, typename Compare>
+		struct pdq_use_branchless : public eastl::integral_constant<bool, eastl::is_arithmetic<T>::value &&
+			(eastl::is_same<Compare, eastl::less<T> >::value    || eastl::is_same<Compare, eastl::less<void> >::value ||
+			 eastl::is_same<Compare, eastl::greater<T> >::value || eastl::is_same<Compare, eastl::greater<void> >::value)> {};
+
+
+		template <typename RandomAccessIterator, typename Compare>
+		inline void pdq_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
 		{
-			eastl::Internal::quick_sort_impl<RandomAccessIterator, difference_type>(first, last, 2 * Internal::Log2(last - first));
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
 
-			if((last - first) > (difference_type)kQuickSortLimit)
+			if(first == last)
+				return;
+
+			for(RandomAccessIterator current = first + 1; current != last; ++current)
 			{
-				eastl::insertion_sort<RandomAccessIterator>(first, first + kQuickSortLimit);
-				eastl::Internal::insertion_sort_simple<RandomAccessIterator>(first + kQuickSortLimit, last);
+				RandomAccessIterator sift(current), siftPrev(current - 1);
+
+				if(compare(*sift, *siftPrev))
+				{
+					value_type value(eastl::move(*sift));
+
+					do {
+						*sift-- = eastl::move(*siftPrev);
+					} while((sift != first) && compare(value, *--siftPrev));
+
+					*sift = eastl::move(value);
+				}
 			}
-			else
-				eastl::insertion_sort<RandomAccessIterator>(first, last);
 		}
-	}
-
 
-	template <typename RandomAccessIterator, typename Compare>
-	void quick_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
-	{
-		typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
 
-		if(first != last)
+		// Like pdq_insertion_sort, but assumes that *(first - 1) is not greater than any element in the range.
+		template <typename RandomAccessIterator, typename Compare>
+		inline void pdq_unguarded_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
 		{
-			eastl::Internal::quick_sort_impl<RandomAccessIterator, difference_type, Compare>(first, last, 2 * Internal::Log2(last - first), compare);
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
 
-			if((last - first) > (difference_type)kQuickSortLimit)
+			if(first == last)
+				return;
+
+			for(RandomAccessIterator current = first + 1; current != last; ++current)
 			{
-				eastl::insertion_sort<RandomAccessIterator, Compare>(first, first + kQuickSortLimit, compare);
-				eastl::Internal::insertion_sort_simple<RandomAccessIterator, Compare>(first + kQuickSortLimit, last, compare);
+				RandomAccessIterator sift(current), siftPrev(current - 1);
+
+				if(compare(*sift, *siftPrev))
+				{
+					EASTL_VALIDATE_COMPARE(!compare(*siftPrev, *sift)); // Validate that the compare function is sane.
+					value_type value(eastl::move(*sift));
+
+					do {
+						*sift-- = eastl::move(*siftPrev);
+					} while(compare(value, *--siftPrev));
+
+					*sift = eastl::move(value);
+				}
 			}
-			else
-				eastl::insertion_sort<RandomAccessIterator, Compare>(first, last, compare);
 		}
-	}
 
 
+		// Insertion sorts [first, last) unless it would take more than kPdqPartialInsertionSortLimit element moves,
+		// in which case it returns false with the range partly sorted.
+		template <typename RandomAccessIterator, typename Compare>
+		inline bool pdq_partial_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+		{
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
 
+			if(first == last)
+				return true;
 
-	namespace Internal
-	{
-		// Portions of the tim_sort code were originally written by Christopher Swenson.
-		// https://github.com/swenson/sort
-		// All code in this repository, unless otherwise specified, is hereby licensed under the 
-		// MIT Public License: Copyright (c) 2010 Christopher Swenson
+			size_t nMoveCount = 0;
 
-		const intptr_t kTimSortStackSize = 64; // Question: What's the upper-limit size requirement for this?
+			for(RandomAccessIterator current = first + 1; current != last; ++current)
+			{
+				RandomAccessIterator sift(current), siftPrev(current - 1);
 
-		struct tim_sort_run
-		{
-			intptr_t start;
-			intptr_t length;
-		};
+				if(compare(*sift, *siftPrev))
+				{
+					value_type value(eastl::move(*sift));
 
+					do {
+						*sift-- = eastl::move(*siftPrev);
+					} while((sift != first) && compare(value, *--siftPrev));
 
-		// EASTL_COUNT_LEADING_ZEROES
-		//
-		// Count leading zeroes in an integer.
-		//
-		#ifndef EASTL_COUNT_LEADING_ZEROES
-			#if   defined(__GNUC__)
-				#if (EA_PLATFORM_PTR_SIZE == 8)
-					#define EASTL_COUNT_LEADING_ZEROES __builtin_clzll
-				#else
-					#define EASTL_COUNT_LEADING_ZEROES __builtin_clz
-				#endif
-			#endif
+					*sift = eastl::move(value);
+					nMoveCount += (size_t)(current - sift);
 
-			#ifndef EASTL_COUNT_LEADING_ZEROES
-				static inline int eastl_count_leading_zeroes(uint64_t x)
-				{
-					if(x)
-					{
-						int n = 0;
-						if(x & UINT64_C(0xFFFFFFFF00000000)) { n += 32; x >>= 32; }
-						if(x & 0xFFFF0000)                   { n += 16; x >>= 16; }
-						if(x & 0xFFFFFF00)                   { n +=  8; x >>=  8; }
-						if(x & 0xFFFFFFF0)                   { n +=  4; x >>=  4; }
-						if(x & 0xFFFFFFFC)                   { n +=  2; x >>=  2; }
-						if(x & 0xFFFFFFFE)                   { n +=  1;           }
-						return 63 - n;
-					}
-					return 64;
+					if(nMoveCount > kPdqPartialInsertionSortLimit)
+						return false;
 				}
+			}
 
-				static inline int eastl_count_leading_zeroes(uint32_t x)
-				{
-					if(x)
-					{
-						int n = 0;
-						if(x <= 0x0000FFFF) { n += 16; x <<= 16; }
-						if(x <= 0x00FFFFFF) { n +=  8; x <<=  8; }
-						if(x <= 0x0FFFFFFF) { n +=  4; x <<=  4; }
-						if(x <= 0x3FFFFFFF) { n +=  2; x <<=  2; }
-						if(x <= 0x7FFFFFFF) { n +=  1;           }
-						return n;
-					}
-					return 32;
-				}
+			return true;
+		}
 
-				#define EASTL_COUNT_LEADING_ZEROES eastl_count_leading_zeroes
-			#endif
-		#endif
 
+		template <typename RandomAccessIterator, typename Compare>
+		inline void pdq_sort2(RandomAccessIterator a, RandomAccessIterator b, Compare& compare)
+		{
+			if(compare(*b, *a))
+				eastl::iter_swap(a, b);
+		}
 
-		// Sorts a range whose initial (start - first) entries are already sorted.
-		// This function is a useful helper to the tim_sort function.
-		// This is the same as insertion_sort except that it has a start parameter which indicates
-		// where the start of the unsorted data is.
-		template <typename BidirectionalIterator, typename StrictWeakOrdering>
-		void insertion_sort_already_started(BidirectionalIterator first, BidirectionalIterator last, BidirectionalIterator start, StrictWeakOrdering compare)
+
+		// Sorts the elements at a, b and c, which leaves the median at b.
+		template <typename RandomAccessIterator, typename Compare>
+		inline void pdq_sort3(RandomAccessIterator a, RandomAccessIterator b, RandomAccessIterator c, Compare& compare)
 		{
-			typedef typename eastl::iterator_traits<BidirectionalIterator>::value_type value_type;
+			pdq_sort2(a, b, compare);
+			pdq_sort2(b, c, compare);
+			pdq_sort2(a, b, compare);
+		}
 
-			if(first != last) // if the range is non-empty...
-			{
-				BidirectionalIterator iCurrent, iNext, iSorted = start - 1;
 
-				for(++iSorted; iSorted != last; ++iSorted)
-				{
-					const value_type temp(*iSorted);
+		// Swaps the elements at first + pOffsetsL[i] with those at last - pOffsetsR[i]. Unless bUseSwaps is set,
+		// this is done as a single cyclic permutation, which needs fewer moves than swapping each pair.
+		template <typename RandomAccessIterator>
+		inline void pdq_swap_offsets(RandomAccessIterator first, RandomAccessIterator last,
+		                             const unsigned char* pOffsetsL, const unsigned char* pOffsetsR, size_t n, bool bUseSwaps)
+		{
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
 
-					iNext = iCurrent = iSorted;
+			if(bUseSwaps)
+			{
+				// Pairwise swaps are needed for descending input, where the cyclic permutation would
+				// leave the elements in an order which makes the sort quadratic.
+				for(size_t i = 0; i < n; ++i)
+					eastl::iter_swap(first + pOffsetsL[i], last - pOffsetsR[i]);
+			}
+			else if(n > 0)
+			{
+				RandomAccessIterator l(first + pOffsetsL[0]);
+				RandomAccessIterator r(last - pOffsetsR[0]);
+				value_type           value(eastl::move(*l));
 
-					for(--iCurrent; (iNext != first) && compare(temp, *iCurrent); --iNext, --iCurrent)
-					{
-						EASTL_VALIDATE_COMPARE(!compare(*iCurrent, temp)); // Validate that the compare function is sane.
-						*iNext = *iCurrent;
-					}
+				*l = eastl::move(*r);
 
-					*iNext = temp;
+				for(size_t i = 1; i < n; ++i)
+				{
+					l  = first + pOffsetsL[i];
+					*r = eastl::move(*l);
+					r  = last - pOffsetsR[i];
+					*l = eastl::move(*r);
 				}
+
+				*r = eastl::move(value);
 			}
 		}
 
 
-		// reverse_elements
-		//
-		// Reverses the range [first + start, first + start + size)
-		// To consider: Use void eastl::reverse(BidirectionalIterator first, BidirectionalIterator last);
-		//
-		template <typename RandomAccessIterator>
-		void reverse_elements(RandomAccessIterator first, intptr_t start, intptr_t end)
+		// Partitions [first, last) around the pivot *first. Elements equal to the pivot go to the right partition.
+		// Returns the position of the pivot after partitioning and whether the range was already partitioned.
+		// Requires that [first, last) holds at least three elements, with the pivot the median of three of them.
+		template <typename RandomAccessIterator, typename Compare>
+		inline eastl::pair<RandomAccessIterator, bool> pdq_partition_right(RandomAccessIterator first, RandomAccessIterator last, Compare& compare, eastl::false_type)
 		{
-			while(start < end)
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+			value_type           pivot(eastl::move(*first));
+			RandomAccessIterator l(first), r(last);
+
+			// The median of three guarantees that there is an element not less than the pivot.
+			while(compare(*++l, pivot))
+				{ }
+
+			// If there was no element before *l, this search needs a bound.
+			if((l - 1) == first)
 			{
-				eastl::swap(*(first + start), *(first + end));
-				++start;
-				--end;
+				while((l < r) && !compare(*--r, pivot))
+					{ }
+			}
+			else
+			{
+				while(!compare(*--r, pivot))
+					{ }
+			}
+
+			const bool bAlreadyPartitioned = (l >= r);
+
+			while(l < r)
+			{
+				eastl::iter_swap(l, r);
+
+				while(compare(*++l, pivot))
+					EASTL_VALIDATE_COMPARE(!compare(pivot, *l)); // Validate that the compare function is sane.
+				while(!compare(*--r, pivot))
+					{ }
 			}
+
+			const RandomAccessIterator pivotPosition(l - 1);
+			*first = eastl::move(*pivotPosition);
+			*pivotPosition = eastl::move(pivot);
+
+			return eastl::pair<RandomAccessIterator, bool>(pivotPosition, bAlreadyPartitioned);
 		}
 
 
-		// tim_sort_count_run
-		//
-		// Finds the length of a run which is already sorted (either up or down).
-		// If the run is in reverse order, this function puts it in regular order.
-		//
-		template <typename RandomAccessIterator, typename StrictWeakOrdering>
-		intptr_t tim_sort_count_run(const RandomAccessIterator first, const intptr_t start, const intptr_t size, StrictWeakOrdering compare)
+		// Like the version above, but classifies a block of elements at a time, recording the offsets of the ones on
+		// the wrong side without branching on the compare, and then swaps them.
+		template <typename RandomAccessIterator, typename Compare>
+		inline eastl::pair<RandomAccessIterator, bool> pdq_partition_right(RandomAccessIterator first, RandomAccessIterator last, Compare& compare, eastl::true_type)
 		{
-			if((size - start) > 1) // If there is anything in the set...
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+			value_type           pivot(eastl::move(*first));
+			RandomAccessIterator l(first), r(last);
+
+			while(compare(*++l, pivot))
+				{ }
+
+			if((l - 1) == first)
 			{
-				intptr_t curr = (start + 2);
-				
-				if(!compare(*(first + start + 1), *(first + start))) // If (first[start + 1] >= first[start]) (If the run is increasing) ...
+				while((l < r) && !compare(*--r, pivot))
+					{ }
+			}
+			else
+			{
+				while(!compare(*--r, pivot))
+					{ }
+			}
+
+			const bool bAlreadyPartitioned = (l >= r);
+
+			if(!bAlreadyPartitioned)
+			{
+				eastl::iter_swap(l, r);
+				++l;
+
+				EA_ALIGN(64) unsigned char offsetsL[kPdqBlockSize]; // Aligned to a cache line.
+				EA_ALIGN(64) unsigned char offsetsR[kPdqBlockSize];
+
+				RandomAccessIterator offsetsBaseL(l), offsetsBaseR(r);
+				size_t               nL = 0, nR = 0, nStartL = 0, nStartR = 0;
+
+				while(l < r)
 				{
-					for(;; ++curr)
+					// Decide how many of the remaining elements to classify on each side. A side whose
+					// block still has unswapped offsets doesn't classify any more.
+					const size_t nUnknown = (size_t)(r - l);
+					const size_t nSplitL  = (nL == 0) ? ((nR == 0) ? (nUnknown / 2) : nUnknown) : 0;
+					const size_t nSplitR  = (nR == 0) ? (nUnknown - nSplitL) : 0;
+
+					if(nSplitL >= kPdqBlockSize)
 					{
-						if(curr == (size - 1)) // If we are at the end of the data... this run is done.
-							break;
+						for(size_t i = 0; i < kPdqBlockSize; ++i)
+						{
+							offsetsL[nL] = (unsigned char)i;
+							nL += !compare(*l, pivot);
+							++l;
+						}
+					}
+					else
+					{
+						for(size_t i = 0; i < nSplitL; ++i)
+						{
+							offsetsL[nL] = (unsigned char)i;
+							nL += !compare(*l, pivot);
+							++l;
+						}
+					}
 
-						if(compare(*(first + curr), *(first + curr - 1))) // If this item is not in order... this run is done.
-							break;
+					if(nSplitR >= kPdqBlockSize)
+					{
+						for(size_t i = 1; i <= kPdqBlockSize; ++i)
+						{
+							offsetsR[nR] = (unsigned char)i;
+							nR += compare(*--r, pivot);
+						}
 					}
-				}
-				else  // Else it is decreasing.
-				{
-					for(;; ++curr)
+					else
 					{
-						if(curr == (size - 1))  // If we are at the end of the data... this run is done.
-							break;
+						for(size_t i = 1; i <= nSplitR; ++i)
+						{
+							offsetsR[nR] = (unsigned char)i;
+							nR += compare(*--r, pivot);
+						}
+					}
 
-						if(!compare(*(first + curr), *(first + curr - 1)))  // If this item is not in order... this run is done.
-							break;                                          // Note that we intentionally compare against <= 0 and not just < 0. This is because 
-					}                                                       // The reverse_elements call below could reverse two equal elements and break our stability requirement.
+					const size_t n = eastl::min_alt(nL, nR);
+					pdq_swap_offsets(offsetsBaseL, offsetsBaseR, offsetsL + nStartL, offsetsR + nStartR, n, nL == nR);
 
-					reverse_elements(first, start, curr - 1);
+					nL -= n;
+					nR -= n;
+					nStartL += n;
+					nStartR += n;
+
+					if(nL == 0)
+					{
+						nStartL = 0;
+						offsetsBaseL = l;
+					}
+
+					if(nR == 0)
+					{
+						nStartR = 0;
+						offsetsBaseR = r;
+					}
 				}
 
-				return (curr - start);
+				// At most one side has offsets left; swap them with the end of the other side.
+				if(nL)
+				{
+					while(nL--)
+						eastl::iter_swap(offsetsBaseL + offsetsL[nStartL + nL], --r);
+					l = r;
+				}
+
+				if(nR)
+				{
+					while(nR--)
+						eastl::iter_swap(offsetsBaseR - offsetsR[nStartR + nR], l++);
+				}
 			}
 
-			// Else we have just one item in the set.       
-			return 1;
+			const RandomAccessIterator pivotPosition(l - 1);
+			*first = eastl::move(*pivotPosition);
+			*pivotPosition = eastl::move(pivot);
+
+			return eastl::pair<RandomAccessIterator, bool>(pivotPosition, bAlreadyPartitioned);
 		}
 
 
-		// Input   Return
-		// --------------
-		//  64      32
-		//  65      33
-		//  66      33
-		//  67      34
-		//  68      34
-		// ...
-		// 125      63
-		// 126      63
-		// 127      64
-		// 128      32
-		// 129      33
-		// 130      33
-		// 131      33
-		// 132      33
-		// 133      34
-		// 134      34
-		// 135      34
-		// 136      34
-		// 137      35
-		// ...
-		//
-		// This function will return a value that is always in the range of [32, 64].
-		//
-		static inline intptr_t timsort_compute_minrun(intptr_t size)
+		// Partitions [first, last) around the pivot *first, with elements equal to the pivot going to the left partition.
+		// pdq_sort uses this when the pivot is equal to the element before the range, in which case the left partition
+		// holds only elements equal to the pivot and needs no further sorting. Returns the position of the pivot.
+		template <typename RandomAccessIterator, typename Compare>
+		inline RandomAccessIterator pdq_partition_left(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
 		{
-			const int32_t  top_bit = (int32_t)((sizeof(intptr_t) * 8) - EASTL_COUNT_LEADING_ZEROES((uintptr_t)size));
-			const int32_t  shift   = (top_bit > 6) ? (top_bit - 6) : 0;
-			const intptr_t mask    = (intptr_t(1) << shift) - 1;
-				  intptr_t minrun  = (intptr_t)(size >> shift);
-
-			if(mask & size)
-				++minrun;
-
-			return minrun;
-		}
-
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
 
-		template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
-		void tim_sort_merge(RandomAccessIterator first, const tim_sort_run* run_stack, const intptr_t stack_curr, 
-							T* pBuffer, StrictWeakOrdering compare)
-		{
-			const intptr_t A    = run_stack[stack_curr - 2].length;
-			const intptr_t B    = run_stack[stack_curr - 1].length;
-			const intptr_t curr = run_stack[stack_curr - 2].start;
+			value_type           pivot(eastl::move(*first));
+			RandomAccessIterator l(first), r(last);
 
-			EASTL_DEV_ASSERT((A < 10000000) && (B < 10000000) && (curr < 10000000)); // Sanity check.
+			while(compare(pivot, *--r))
+				{ }
 
-			if(A < B) // If the first run is shorter than the second run... merge left.
+			if((r + 1) == last)
 			{
-				// Copy to another location so we have room in the main array to put the sorted items.
-				eastl::copy(first + curr, first + curr + A, pBuffer);
-
-				#if EASTL_DEV_DEBUG
-					typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
-
-					for(intptr_t i = 0; i < A; i++)
-						*(first + curr + i) = value_type();
-				#endif
-
-				intptr_t i = 0;
-				intptr_t j = curr + A;
-				
-				for(intptr_t k = curr; k < curr + A + B; k++)
-				{
-					if((i < A) && (j < (curr + A + B)))
-					{
-						if(!compare(*(first + j), *(pBuffer + i))) // If (first[j] >= pBuffer[i])...
-							*(first + k) = *(pBuffer + i++);
-						else
-							*(first + k) = *(first + j++);
-					}
-					else if(i < A)
-						*(first + k) = *(pBuffer + i++);
-					else
-						*(first + k) = *(first + j++);
-				}
+				while((l < r) && !compare(pivot, *++l))
+					{ }
 			}
-			else // Else the second run is equal or shorter... merge right.
+			else
 			{
-				eastl::copy(first + curr + A, first + curr + A + B, pBuffer);
-
-				intptr_t i = B - 1;
-				intptr_t j = curr + A - 1;
-				
-				for(intptr_t k = curr + A + B - 1; k >= curr; k--)
-				{
-					if((i >= 0) && (j >= curr))
-					{
-						if(compare(*(pBuffer + i), *(first + j))) // If (pBuffer[i] < first[j]) ...
-							*(first + k) = *(first + j--);
-						else
-							*(first + k) = *(pBuffer + i--);
-					}
-					else if(i >= 0)
-						*(first + k) = *(pBuffer + i--);
-					else
-						*(first + k) = *(first + j--);
-				}
+				while(!compare(pivot, *++l))
+					{ }
 			}
-		}
 
-
-		// See the timsort.txt file for an explanation of this function.
-		//
-		// ------------------------------------------------------------------------
-		// What turned out to be a good compromise maintains two invariants on the
-		// stack entries, where A, B and C are the lengths of the three righmost 
-		// not-yet merged slices:
-		//    1.  A > B+C
-		//    2.  B > C
-		// ------------------------------------------------------------------------
-		//
-		static inline bool timsort_check_invariant(tim_sort_run* run_stack, const intptr_t stack_curr)
-		{
-			// To do: Optimize this for the most common type of values.
-			if(stack_curr > 2)
+			while(l < r)
 			{
-				const intptr_t A = run_stack[stack_curr - 3].length;
-				const intptr_t B = run_stack[stack_curr - 2].length;
-				const intptr_t C = run_stack[stack_curr - 1].length;
-
-				EASTL_DEV_ASSERT((A < 10000000) && (B < 10000000) && (C < 10000000)); // Sanity check.
+				eastl::iter_swap(l, r);
 
-				if((A <= (B + C)) || (B <= C))
-					return true; // Merge the right-most runs.
+				while(compare(pivot, *--r))
+					{ }
+				while(!compare(pivot, *++l))
+					{ }
 			}
-			else if(stack_curr == 2)
-			{
-				const intptr_t A = run_stack[stack_curr - 2].length;
-				const intptr_t B = run_stack[stack_curr - 1].length;
-
-				EASTL_DEV_ASSERT((A < 10000000) && (B < 10000000)); // Sanity check.
 
-				if(A <= B)
-					return true; // Merge the right-most runs.
-			}
+			*first = eastl::move(*r);
+			*r = eastl::move(pivot);
 
-			return false; // Don't merge the right-most runs.
+			return r;
 		}
 
 
-		template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
-		intptr_t tim_sort_collapse(RandomAccessIterator first, tim_sort_run* run_stack, intptr_t stack_curr, 
-								   T* pBuffer, const intptr_t size, StrictWeakOrdering compare)
+		template <typename RandomAccessIterator, typename Compare, typename UseBranchless>
+		void pdq_sort_loop(RandomAccessIterator first, RandomAccessIterator last, Compare& compare, int nBadAllowed, bool bLeftmost)
 		{
-			// If the run_stack only has one thing on it, we are done with the collapse.
-			while(stack_curr > 1)
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+			for(;;)
 			{
-				// If this is the last merge, just do it.
-				if((stack_curr == 2) && ((run_stack[0].length + run_stack[1].length) == size))
+				const difference_type n = last - first;
+
+				if(n < kPdqInsertionSortLimit)
 				{
-					tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);
-					run_stack[0].length += run_stack[1].length;
-					stack_curr--;
+					// Unless this is the leftmost range, the element before it is a previous pivot, which is a sentinel.
+					if(bLeftmost)
+						pdq_insertion_sort(first, last, compare);
+					else
+						pdq_unguarded_insertion_sort(first, last, compare);
+					return;
+				}
 
-					#if EASTL_DEV_DEBUG
-						memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
-					#endif
+				// Move the pivot to *first.
+				const difference_type nHalf = n / 2;
 
-					break;
+				if(n > kPdqNintherLimit)
+				{
+					pdq_sort3(first, first + nHalf, last - 1, compare);
+					pdq_sort3(first + 1, first + (nHalf - 1), last - 2, compare);
+					pdq_sort3(first + 2, first + (nHalf + 1), last - 3, compare);
+					pdq_sort3(first + (nHalf - 1), first + nHalf, first + (nHalf + 1), compare);
+					eastl::iter_swap(first, first + nHalf);
 				}
-				// Check if the invariant is off for a run_stack of 2 elements.
-				else if((stack_curr == 2) && (run_stack[0].length <= run_stack[1].length))
+				else
+					pdq_sort3(first + nHalf, first, last - 1, compare);
+
+				// No element of this range is less than *(first - 1). So if the pivot isn't greater than it, every
+				// element equal to the pivot can be put in place with one partition, and only the rest needs sorting.
+				if(!bLeftmost && !compare(*(first - 1), *first))
 				{
-					tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);
-					run_stack[0].length += run_stack[1].length;
-					stack_curr--;
+					first = pdq_partition_left(first, last, compare) + 1;
+					continue;
+				}
 
-					#if EASTL_DEV_DEBUG
-						memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
-					#endif
+				const eastl::pair<RandomAccessIterator, bool> result = pdq_partition_right(first, last, compare, UseBranchless());
+				const RandomAccessIterator                    pivotPosition(result.first);
 
-					break;
-				}
-				else if (stack_curr == 2)
-					break;
+				const difference_type nL = pivotPosition - first;
+				const difference_type nR = last - (pivotPosition + 1);
 
-				const intptr_t A = run_stack[stack_curr - 3].length;
-				const intptr_t B = run_stack[stack_curr - 2].length;
-				const intptr_t C = run_stack[stack_curr - 1].length;
-				
-				if(A <= (B + C)) // Check first invariant.
+				if((nL < (n / 8)) || (nR < (n / 8)))
 				{
-					if(A < C)
+					// A highly unbalanced partition. After enough of them, give up on quick sort and use heap sort.
+					if(--nBadAllowed == 0)
 					{
-						tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr - 1, pBuffer, compare);
+						eastl::make_heap<RandomAccessIterator, Compare&>(first, last, compare);
+						eastl::sort_heap<RandomAccessIterator, Compare&>(first, last, compare);
+						return;
+					}
 
-						stack_curr--;
-						run_stack[stack_curr - 2].length += run_stack[stack_curr - 1].length;   // Merge A and B.
-						run_stack[stack_curr - 1] = run_stack[stack_curr];
+					// Otherwise swap some elements around to break up whatever pattern gave the bad pivot.
+					if(nL >= kPdqInsertionSortLimit)
+					{
+						eastl::iter_swap(first, first + (nL / 4));
+						eastl::iter_swap(pivotPosition - 1, pivotPosition - (nL / 4));
 
-						#if EASTL_DEV_DEBUG
-							EASTL_DEV_ASSERT((run_stack[stack_curr - 2].start + run_stack[stack_curr - 2].length) <= size);
-							EASTL_DEV_ASSERT((run_stack[stack_curr - 1].start + run_stack[stack_curr - 1].length) <= size);
-							memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
-						#endif
+						if(nL > kPdqNintherLimit)
+						{
+							eastl::iter_swap(first + 1, first + (nL / 4 + 1));
+							eastl::iter_swap(first + 2, first + (nL / 4 + 2));
+							eastl::iter_swap(pivotPosition - 2, pivotPosition - (nL / 4 + 1));
+							eastl::iter_swap(pivotPosition - 3, pivotPosition - (nL / 4 + 2));
+						}
 					}
-					else
-					{
-						tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);                  // Merge B and C.
 
-						stack_curr--;
-						run_stack[stack_curr - 1].length += run_stack[stack_curr].length;
+					if(nR >= kPdqInsertionSortLimit)
+					{
+						eastl::iter_swap(pivotPosition + 1, pivotPosition + (1 + nR / 4));
+						eastl::iter_swap(last - 1, last - (nR / 4));
 
-						#if EASTL_DEV_DEBUG
-							EASTL_DEV_ASSERT((run_stack[stack_curr - 1].start + run_stack[stack_curr - 1].length) <= size);
-							memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
-						#endif
+						if(nR > kPdqNintherLimit)
+						{
+							eastl::iter_swap(pivotPosition + 2, pivotPosition + (2 + nR / 4));
+							eastl::iter_swap(pivotPosition + 3, pivotPosition + (3 + nR / 4));
+							eastl::iter_swap(last - 2, last - (1 + nR / 4));
+							eastl::iter_swap(last - 3, last - (2 + nR / 4));
+						}
 					}
 				}
-				else if(B <= C) // Check second invariant
+				else if(result.second && pdq_partial_insertion_sort(first, pivotPosition, compare) &&
+				                         pdq_partial_insertion_sort(pivotPosition + 1, last, compare))
 				{
-					tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);
-
-					stack_curr--;
-					run_stack[stack_curr - 1].length += run_stack[stack_curr].length;       // Merge B and C.
-
-					#if EASTL_DEV_DEBUG
-						EASTL_DEV_ASSERT((run_stack[stack_curr - 1].start + run_stack[stack_curr - 1].length) <= size);
-						memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
-					#endif
+					// A balanced partition that needed no swaps suggests presorted input, which the
+					// insertion sorts above have finished off cheaply.
+					return;
 				}
-				else
-					break;
-			}
 
-			return stack_curr;
+				// Recurse on the left side and loop on the right side.
+				pdq_sort_loop<RandomAccessIterator, Compare, UseBranchless>(first, pivotPosition, compare, nBadAllowed, bLeftmost);
+				first     = pivotPosition + 1;
+				bLeftmost = false;
+			}
 		}
 
 
-		// tim_sort_add_run
-		//
-		// Return true if the sort is done.
-		//
-		template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
-		bool tim_sort_add_run(tim_sort_run* run_stack, RandomAccessIterator first, T* pBuffer, const intptr_t size, const intptr_t minrun, 
-							  intptr_t& len, intptr_t& run, intptr_t& curr, intptr_t& stack_curr, StrictWeakOrdering compare)
+		template <typename RandomAccessIterator, typename Compare>
+		void pdq_sort(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
 		{
-			len = tim_sort_count_run<RandomAccessIterator, StrictWeakOrdering>(first, curr, size, compare); // This will count the length of the run and reverse the run if it is backwards.
-			run = minrun;
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
 
-			if(run < minrun)            // Always make runs be of minrun length (we'll sort the additional data as needed below)
-			   run = minrun;
+			if((last - first) < 2)
+				return;
 
-			if(run > (size - curr))     // But if there isn't minrun data remaining, just sort what's remaining.
-			   run = (size - curr);
+			// Sorted and reverse sorted input is common and cheap to detect, as the scan stops at
+			// the first element out of place.
+			RandomAccessIterator runEnd(first + 1);
 
-			if(run > len)               // If there is any additional data we want to sort to bring up the run length to minrun.
+			if(compare(*runEnd, *first))
 			{
-				insertion_sort_already_started<RandomAccessIterator, StrictWeakOrdering>(first + curr, first + curr + run, first + curr + len, compare);
-				len = run;
-			}
+				while((++runEnd != last) && compare(*runEnd, *(runEnd - 1)))
+					{ }
 
-			// At this point, run will be equal to minrun or will go to the end of our data.
-			// Add this run to our stack of runs.
-			EASTL_DEV_ASSERT(stack_curr < kTimSortStackSize);
-			EASTL_DEV_ASSERT((curr >= 0) && (curr < size) && ((curr + len) <= size));
-
-			run_stack[stack_curr].start  = curr;
-			run_stack[stack_curr].length = len;
-			stack_curr++;
-
-			// Move to the beginning of the next run in the data.
-			curr += len;
-
-			if(curr == size)    // If we have hit the end of the data...
-			{
-				while(stack_curr > 1) // If there is any more than one run... (else all the data is sorted)
+				if(runEnd == last)
 				{
-					tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);
-
-					run_stack[stack_curr - 2].length += run_stack[stack_curr - 1].length;
-					stack_curr--;
-
-					#if EASTL_DEV_DEBUG
-						EASTL_DEV_ASSERT((run_stack[stack_curr - 1].start + run_stack[stack_curr - 1].length) <= size);
-						memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
-					#endif
+					for(RandomAccessIterator l(first), r(last); l < --r; ++l) // eastl::reverse only knows EASTL iterator categories.
+						eastl::iter_swap(l, r);
+					return;
 				}
+			}
+			else
+			{
+				while((++runEnd != last) && !compare(*runEnd, *(runEnd - 1)))
+					{ }
 
-				return true; // We are done with sorting.
+				if(runEnd == last)
+					return;
 			}
 
-			return false;
+			pdq_sort_loop<RandomAccessIterator, Compare, pdq_use_branchless<value_type, Compare> >(first, last, compare, (int)Log2(last - first), true);
 		}
-
 	} // namespace Internal
 
 
-	// tim_sort_buffer
-	//
+	/// quick_sort
+	///
+	/// This is an unstable sort.
+	/// quick_sort sorts the elements in [first, last) into ascending order, 
+	/// meaning that if i and j are any two valid iterators in [first, last) 
+	/// such that i precedes j, then *j is not less than *i. quick_sort is not 
+	/// guaranteed to be stable. That is, suppose that *i and *j are equivalent: 
+	/// neither one is less than the other. It is not guaranteed that the 
+	/// relative order of these two elements will be preserved by sort.
+	///
+	/// We implement the "introspective" variation of quick-sort. This is 
+	/// considered to be the best general-purpose variant, as it avoids 
+	/// worst-case behaviour and optimizes the final sorting stage by 
+	/// switching to an insertion sort. On top of that it is "pattern-defeating"
+	/// (see Internal::pdq_sort): sorted, reverse sorted and mostly sorted input 
+	/// and input with many equal elements are sorted in close to linear time.
+	/// Define EASTL_QUICK_SORT_LEGACY to 1 to use the original introsort.
+	///
+	template <typename RandomAccessIterator>
+	void quick_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		#if EASTL_QUICK_SORT_LEGACY
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+			if(first != last)
+			{
+				eastl::Internal::quick_sort_impl<RandomAccessIterator, difference_type>(first, last, 2 * Internal::Log2(last - first));
+
+				if((last - first) > (difference_type)kQuickSortLimit)
+				{
+					eastl::insertion_sort<RandomAccessIterator>(first, first + kQuickSortLimit);
+					eastl::Internal::insertion_sort_simple<RandomAccessIterator>(first + kQuickSortLimit, last);
+				}
+				else
+					eastl::insertion_sort<RandomAccessIterator>(first, last);
+			}
+		#else
+			typedef eastl::less<typename eastl::iterator_traits<RandomAccessIterator>::value_type> Less;
+
+			Less compare;
+			eastl::Internal::pdq_sort<RandomAccessIterator, Less>(first, last, compare);
+		#endif
+	}
+
+
+	template <typename RandomAccessIterator, typename Compare>
+	void quick_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		#if EASTL_QUICK_SORT_LEGACY
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+			if(first != last)
+			{
+				eastl::Internal::quick_sort_impl<RandomAccessIterator, difference_type, Compare>(first, last, 2 * Internal::Log2(last - first), compare);
+
+				if((last - first) > (difference_type)kQuickSortLimit)
+				{
+					eastl::insertion_sort<RandomAccessIterator, Compare>(first, first + kQuickSortLimit, compare);
+					eastl::Internal::insertion_sort_simple<RandomAccessIterator, Compare>(first + kQuickSortLimit, last, compare);
+				}
+				else
+					eastl::insertion_sort<RandomAccessIterator, Compare>(first, last, compare);
+			}
+		#else
+			eastl::Internal::pdq_sort<RandomAccessIterator, typename eastl::remove_reference<Compare>::type>(first, last, compare);
+		#endif
+	}
+
+
+
+
+	namespace Internal
+	{
+		// Portions of the tim_sort code were originally written by Christopher Swenson.
+		// https://github.com/swenson/sort
+		// All code in this repository, unless otherwise specified, is hereby licensed under the 
+		// MIT Public License: Copyright (c) 2010 Christopher Swenson
+
+		const intptr_t kTimSortStackSize = 64; // Question: What's the upper-limit size requirement for this?
+
+		struct tim_sort_run
+		{
+			intptr_t start;
+			intptr_t length;
+		};
+
+
+		// EASTL_COUNT_LEADING_ZEROES
+		//
+		// Count leading zeroes in an integer.
+		//
+		#ifndef EASTL_COUNT_LEADING_ZEROES
+			#if   defined(__GNUC__)
+				#if (EA_PLATFORM_PTR_SIZE == 8)
+					#define EASTL_COUNT_LEADING_ZEROES __builtin_clzll
+				#else
+					#define EASTL_COUNT_LEADING_ZEROES __builtin_clz
+				#endif
+			#endif
+
+			#ifndef EASTL_COUNT_LEADING_ZEROES
+				static inline int eastl_count_leading_zeroes(uint64_t x)
+				{
+					if(x)
+					{
+						int n = 0;
+						if(x & UINT64_C(0xFFFFFFFF00000000)) { n += 32; x >>= 32; }
+						if(x & 0xFFFF0000)                   { n += 16; x >>= 16; }
+						if(x & 0xFFFFFF00)                   { n +=  8; x >>=  8; }
+						if(x & 0xFFFFFFF0)                   { n +=  4; x >>=  4; }
+						if(x & 0xFFFFFFFC)                   { n +=  2; x >>=  2; }
+						if(x & 0xFFFFFFFE)                   { n +=  1;           }
+						return 63 - n;
+					}
+					return 64;
+				}
+
+				static inline int eastl_count_leading_zeroes(uint32_t x)
+				{
+					if(x)
+					{
+						int n = 0;
+						if(x <= 0x0000FFFF) { n += 16; x <<= 16; }
+						if(x <= 0x00FFFFFF) { n +=  8; x <<=  8; }
+						if(x <= 0x0FFFFFFF) { n +=  4; x <<=  4; }
+						if(x <= 0x3FFFFFFF) { n +=  2; x <<=  2; }
+						if(x <= 0x7FFFFFFF) { n +=  1;           }
+						return n;
+					}
+					return 32;
+				}
+
+				#define EASTL_COUNT_LEADING_ZEROES eastl_count_leading_zeroes
+			#endif
+		#endif
+
+
+		// Sorts a range whose initial (start - first) entries are already sorted.
+		// This function is a useful helper to the tim_sort function.
+		// This is the same as insertion_sort except that it has a start parameter which indicates
+		// where the start of the unsorted data is.
+		template <typename BidirectionalIterator, typename StrictWeakOrdering>
+		void insertion_sort_already_started(BidirectionalIterator first, BidirectionalIterator last, BidirectionalIterator start, StrictWeakOrdering compare)
+		{
+			typedef typename eastl::iterator_traits<BidirectionalIterator>::value_type value_type;
+
+			if(first != last) // if the range is non-empty...
+			{
+				BidirectionalIterator iCurrent, iNext, iSorted = start - 1;
+
+				for(++iSorted; iSorted != last; ++iSorted)
+				{
+					const value_type temp(*iSorted);
+
+					iNext = iCurrent = iSorted;
+
+					for(--iCurrent; (iNext != first) && compare(temp, *iCurrent); --iNext, --iCurrent)
+					{
+						EASTL_VALIDATE_COMPARE(!compare(*iCurrent, temp)); // Validate that the compare function is sane.
+						*iNext = *iCurrent;
+					}
+
+					*iNext = temp;
+				}
+			}
+		}
+
+
+		// reverse_elements
+		//
+		// Reverses the range [first + start, first + start + size)
+		// To consider: Use void eastl::reverse(BidirectionalIterator first, BidirectionalIterator last);
+		//
+		template <typename RandomAccessIterator>
+		void reverse_elements(RandomAccessIterator first, intptr_t start, intptr_t end)
+		{
+			while(start < end)
+			{
+				eastl::swap(*(first + start), *(first + end));
+				++start;
+				--end;
+			}
+		}
+
+
+		// tim_sort_count_run
+		//
+		// Finds the length of a run which is already sorted (either up or down).
+		// If the run is in reverse order, this function puts it in regular order.
+		//
+		template <typename RandomAccessIterator, typename StrictWeakOrdering>
+		intptr_t tim_sort_count_run(const RandomAccessIterator first, const intptr_t start, const intptr_t size, StrictWeakOrdering compare)
+		{
+			if((size - start) > 1) // If there is anything in the set...
+			{
+				intptr_t curr = (start + 2);
+				
+				if(!compare(*(first + start + 1), *(first + start))) // If (first[start + 1] >= first[start]) (If the run is increasing) ...
+				{
+					for(;; ++curr)
+					{
+						if(curr == (size - 1)) // If we are at the end of the data... this run is done.
+							break;
+
+						if(compare(*(first + curr), *(first + curr - 1))) // If this item is not in order... this run is done.
+							break;
+					}
+				}
+				else  // Else it is decreasing.
+				{
+					for(;; ++curr)
+					{
+						if(curr == (size - 1))  // If we are at the end of the data... this run is done.
+							break;
+
+						if(!compare(*(first + curr), *(first + curr - 1)))  // If this item is not in order... this run is done.
+							break;                                          // Note that we intentionally compare against <= 0 and not just < 0. This is because 
+					}                                                       // The reverse_elements call below could reverse two equal elements and break our stability requirement.
+
+					reverse_elements(first, start, curr - 1);
+				}
+
+				return (curr - start);
+			}
+
+			// Else we have just one item in the set.       
+			return 1;
+		}
+
+
+		// Input   Return
+		// --------------
+		//  64      32
+		//  65      33
+		//  66      33
+		//  67      34
+		//  68      34
+		// ...
+		// 125      63
+		// 126      63
+		// 127      64
+		// 128      32
+		// 129      33
+		// 130      33
+		// 131      33
+		// 132      33
+		// 133      34
+		// 134      34
+		// 135      34
+		// 136      34
+		// 137      35
+		// ...
+		//
+		// This function will return a value that is always in the range of [32, 64].
+		//
+		static inline intptr_t timsort_compute_minrun(intptr_t size)
+		{
+			const int32_t  top_bit = (int32_t)((sizeof(intptr_t) * 8) - EASTL_COUNT_LEADING_ZEROES((uintptr_t)size));
+			const int32_t  shift   = (top_bit > 6) ? (top_bit - 6) : 0;
+			const intptr_t mask    = (intptr_t(1) << shift) - 1;
+				  intptr_t minrun  = (intptr_t)(size >> shift);
+
+			if(mask & size)
+				++minrun;
+
+			return minrun;
+		}
+
+
+		template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+		void tim_sort_merge(RandomAccessIterator first, const tim_sort_run* run_stack, const intptr_t stack_curr, 
+							T* pBuffer, StrictWeakOrdering compare)
+		{
+			const intptr_t A    = run_stack[stack_curr - 2].length;
+			const intptr_t B    = run_stack[stack_curr - 1].length;
+			const intptr_t curr = run_stack[stack_curr - 2].start;
+
+			EASTL_DEV_ASSERT((A < 10000000) && (B < 10000000) && (curr < 10000000)); // Sanity check.
+
+			if(A < B) // If the first run is shorter than the second run... merge left.
+			{
+				// Copy to another location so we have room in the main array to put the sorted items.
+				eastl::copy(first + curr, first + curr + A, pBuffer);
+
+				#if EASTL_DEV_DEBUG
+					typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+					for(intptr_t i = 0; i < A; i++)
+						*(first + curr + i) = value_type();
+				#endif
+
+				intptr_t i = 0;
+				intptr_t j = curr + A;
+				
+				for(intptr_t k = curr; k < curr + A + B; k++)
+				{
+					if((i < A) && (j < (curr + A + B)))
+					{
+						if(!compare(*(first + j), *(pBuffer + i))) // If (first[j] >= pBuffer[i])...
+							*(first + k) = *(pBuffer + i++);
+						else
+							*(first + k) = *(first + j++);
+					}
+					else if(i < A)
+						*(first + k) = *(pBuffer + i++);
+					else
+						*(first + k) = *(first + j++);
+				}
+			}
+			else // Else the second run is equal or shorter... merge right.
+			{
+				eastl::copy(first + curr + A, first + curr + A + B, pBuffer);
+
+				intptr_t i = B - 1;
+				intptr_t j = curr + A - 1;
+				
+				for(intptr_t k = curr + A + B - 1; k >= curr; k--)
+				{
+					if((i >= 0) && (j >= curr))
+					{
+						if(compare(*(pBuffer + i), *(first + j))) // If (pBuffer[i] < first[j]) ...
+							*(first + k) = *(first + j--);
+						else
+							*(first + k) = *(pBuffer + i--);
+					}
+					else if(i >= 0)
+						*(first + k) = *(pBuffer + i--);
+					else
+						*(first + k) = *(first + j--);
+				}
+			}
+		}
+
+
+		// See the timsort.txt file for an explanation of this function.
+		//
+		// ------------------------------------------------------------------------
+		// What turned out to be a good compromise maintains two invariants on the
+		// stack entries, where A, B and C are the lengths of the three righmost 
+		// not-yet merged slices:
+		//    1.  A > B+C
+		//    2.  B > C
+		// ------------------------------------------------------------------------
+		//
+		static inline bool timsort_check_invariant(tim_sort_run* run_stack, const intptr_t stack_curr)
+		{
+			// To do: Optimize this for the most common type of values.
+			if(stack_curr > 2)
+			{
+				const intptr_t A = run_stack[stack_curr - 3].length;
+				const intptr_t B = run_stack[stack_curr - 2].length;
+				const intptr_t C = run_stack[stack_curr - 1].length;
+
+				EASTL_DEV_ASSERT((A < 10000000) && (B < 10000000) && (C < 10000000)); // Sanity check.
+
+				if((A <= (B + C)) || (B <= C))
+					return true; // Merge the right-most runs.
+			}
+			else if(stack_curr == 2)
+			{
+				const intptr_t A = run_stack[stack_curr - 2].length;
+				const intptr_t B = run_stack[stack_curr - 1].length;
+
+				EASTL_DEV_ASSERT((A < 10000000) && (B < 10000000)); // Sanity check.
+
+				if(A <= B)
+					return true; // Merge the right-most runs.
+			}
+
+			return false; // Don't merge the right-most runs.
+		}
+
+
+		template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+		intptr_t tim_sort_collapse(RandomAccessIterator first, tim_sort_run* run_stack, intptr_t stack_curr, 
+								   T* pBuffer, const intptr_t size, StrictWeakOrdering compare)
+		{
+			// If the run_stack only has one thing on it, we are done with the collapse.
+			while(stack_curr > 1)
+			{
+				// If this is the last merge, just do it.
+				if((stack_curr == 2) && ((run_stack[0].length + run_stack[1].length) == size))
+				{
+					tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);
+					run_stack[0].length += run_stack[1].length;
+					stack_curr--;
+
+					#if EASTL_DEV_DEBUG
+						memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
+					#endif
+
+					break;
+				}
+				// Check if the invariant is off for a run_stack of 2 elements.
+				else if((stack_curr == 2) && (run_stack[0].length <= run_stack[1].length))
+				{
+					tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);
+					run_stack[0].length += run_stack[1].length;
+					stack_curr--;
+
+					#if EASTL_DEV_DEBUG
+						memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
+					#endif
+
+					break;
+				}
+				else if (stack_curr == 2)
+					break;
+
+				const intptr_t A = run_stack[stack_curr - 3].length;
+				const intptr_t B = run_stack[stack_curr - 2].length;
+				const intptr_t C = run_stack[stack_curr - 1].length;
+				
+				if(A <= (B + C)) // Check first invariant.
+				{
+					if(A < C)
+					{
+						tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr - 1, pBuffer, compare);
+
+						stack_curr--;
+						run_stack[stack_curr - 2].length += run_stack[stack_curr - 1].length;   // Merge A and B.
+						run_stack[stack_curr - 1] = run_stack[stack_curr];
+
+						#if EASTL_DEV_DEBUG
+							EASTL_DEV_ASSERT((run_stack[stack_curr - 2].start + run_stack[stack_curr - 2].length) <= size);
+							EASTL_DEV_ASSERT((run_stack[stack_curr - 1].start + run_stack[stack_curr - 1].length) <= size);
+							memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
+						#endif
+					}
+					else
+					{
+						tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);                  // Merge B and C.
+
+						stack_curr--;
+						run_stack[stack_curr - 1].length += run_stack[stack_curr].length;
+
+						#if EASTL_DEV_DEBUG
+							EASTL_DEV_ASSERT((run_stack[stack_curr - 1].start + run_stack[stack_curr - 1].length) <= size);
+							memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
+						#endif
+					}
+				}
+				else if(B <= C) // Check second invariant
+				{
+					tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);
+
+					stack_curr--;
+					run_stack[stack_curr - 1].length += run_stack[stack_curr].length;       // Merge B and C.
+
+					#if EASTL_DEV_DEBUG
+						EASTL_DEV_ASSERT((run_stack[stack_curr - 1].start + run_stack[stack_curr - 1].length) <= size);
+						memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
+					#endif
+				}
+				else
+					break;
+			}
+
+			return stack_curr;
+		}
+
+
+		// tim_sort_add_run
+		//
+		// Return true if the sort is done.
+		//
+		template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+		bool tim_sort_add_run(tim_sort_run* run_stack, RandomAccessIterator first, T* pBuffer, const intptr_t size, const intptr_t minrun, 
+							  intptr_t& len, intptr_t& run, intptr_t& curr, intptr_t& stack_curr, StrictWeakOrdering compare)
+		{
+			len = tim_sort_count_run<RandomAccessIterator, StrictWeakOrdering>(first, curr, size, compare); // This will count the length of the run and reverse the run if it is backwards.
+			run = minrun;
+
+			if(run < minrun)            // Always make runs be of minrun length (we'll sort the additional data as needed below)
+			   run = minrun;
+
+			if(run > (size - curr))     // But if there isn't minrun data remaining, just sort what's remaining.
+			   run = (size - curr);
+
+			if(run > len)               // If there is any additional data we want to sort to bring up the run length to minrun.
+			{
+				insertion_sort_already_started<RandomAccessIterator, StrictWeakOrdering>(first + curr, first + curr + run, first + curr + len, compare);
+				len = run;
+			}
+
+			// At this point, run will be equal to minrun or will go to the end of our data.
+			// Add this run to our stack of runs.
+			EASTL_DEV_ASSERT(stack_curr < kTimSortStackSize);
+			EASTL_DEV_ASSERT((curr >= 0) && (curr < size) && ((curr + len) <= size));
+
+			run_stack[stack_curr].start  = curr;
+			run_stack[stack_curr].length = len;
+			stack_curr++;
+
+			// Move to the beginning of the next run in the data.
+			curr += len;
+
+			if(curr == size)    // If we have hit the end of the data...
+			{
+				while(stack_curr > 1) // If there is any more than one run... (else all the data is sorted)
+				{
+					tim_sort_merge<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, compare);
+
+					run_stack[stack_curr - 2].length += run_stack[stack_curr - 1].length;
+					stack_curr--;
+
+					#if EASTL_DEV_DEBUG
+						EASTL_DEV_ASSERT((run_stack[stack_curr - 1].start + run_stack[stack_curr - 1].length) <= size);
+						memset(&run_stack[stack_curr], 0, sizeof(run_stack[stack_curr]));
+					#endif
+				}
+
+				return true; // We are done with sorting.
+			}
+
+			return false;
+		}
+
+	} // namespace Internal
+
+
+	// tim_sort_buffer
+	//
+	/// This is a stable sort.
+	// Implements the tim-sort sorting algorithm with a user-provided scratch buffer.
+	// http://en.wikipedia.org/wiki/Timsort
+	// This sort is the fastest sort when sort stability (maintaining order of equal values) is required and
+	// data sets are non-trivial (size >= 15). It's also the fastest sort (e.g. faster than quick_sort) for 
+	// the case that at at least half your data is already sorted. Otherwise, eastl::quick_sort is about 10% 
+	// faster than tim_sort_buffer but is not a stable sort. There are some reports that tim_sort outperforms
+	// quick_sort but most of these aren't taking into account that optimal quick_sort implementations use
+	// a hybrid approach called "introsort" (http://en.wikipedia.org/wiki/Introsort) which improves quick_sort
+	// considerably in practice.
+	//
+	// Strengths:
+	//     - Fastest stable sort for most sizes of data.
+	//     - Fastest sort for containers of data already mostly sorted.
+	//     - Simpler to understand than quick_sort.
+	//
+	// Weaknesses:
+	//     - User must provide a scratch buffer, otherwise the buffer is dynamically allocated during runtime.
+	//     - Not as fast as quick_sort for the general case of randomized data.
+	//     - Requires a RandomAccessIterator; thus must be on an array container type and not a list container type.
+	//     - Uses a lot of code to implement; thus it's not great when there is little room for more code.
+	//
+	// The pBuffer parameter must hold at least ((last-first)/2) elements (i.e. half the elements of the container).
+	// This minimum size is a worst-case size requirement, but handles all possible cases. pBuffer is just a scratch
+	// buffer and is not needed after the return of this function, and doesn't need to be seeded with any particular
+	// values upon entering this function.
+	//
+	// Example usage:
+	//     int intArray[64];
+	//     int buffer[32];
+	//     ...
+	//     tim_sort_buffer(intArray, intArray + 64, buffer);
+	//
+	template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+	void tim_sort_buffer(RandomAccessIterator first, RandomAccessIterator last, T* pBuffer, StrictWeakOrdering compare)
+	{
+		using namespace Internal;
+
+		// To consider: Convert the implementation to use first/last instead of first/size.
+		const intptr_t size = (intptr_t)(last - first);
+
+		if(size < 64)
+			insertion_sort_already_started(first, first + size, first + 1, compare);
+		else
+		{
+			tim_sort_run   run_stack[kTimSortStackSize];
+			intptr_t       stack_curr = 0;
+			intptr_t       len, run;
+			intptr_t       curr = 0;
+			const intptr_t minrun = timsort_compute_minrun(size);
+
+			#if EASTL_DEV_DEBUG
+				memset(run_stack, 0, sizeof(run_stack));
+			#endif
+
+			if(tim_sort_add_run<RandomAccessIterator, T, StrictWeakOrdering>(run_stack, first, pBuffer, size, minrun, len, run, curr, stack_curr, compare))
+				return;
+			if(tim_sort_add_run<RandomAccessIterator, T, StrictWeakOrdering>(run_stack, first, pBuffer, size, minrun, len, run, curr, stack_curr, compare))
+				return;
+			if(tim_sort_add_run<RandomAccessIterator, T, StrictWeakOrdering>(run_stack, first, pBuffer, size, minrun, len, run, curr, stack_curr, compare))
+				return;
+
+			for(;;)
+			{
+				if(timsort_check_invariant(run_stack, stack_curr))
+					stack_curr = tim_sort_collapse<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, size, compare);
+				else
+				{
+					if(tim_sort_add_run<RandomAccessIterator, T, StrictWeakOrdering>(run_stack, first, pBuffer, size, minrun, len, run, curr, stack_curr, compare))
+						break;
+				}
+			}
+		}
+	}
+
+
+	template <typename RandomAccessIterator, typename T>
+	inline void tim_sort_buffer(RandomAccessIterator first, RandomAccessIterator last, T* pBuffer)
+	{
+		typedef eastl::less<T> Less;
+
+		eastl::tim_sort_buffer<RandomAccessIterator, T, Less>(first, last, pBuffer, Less());
+	}
+
+
+
+
+	/// radix_sort
+	///
+	/// Implements a classic LSD (least significant digit) radix sort.
+	/// See http://en.wikipedia.org/wiki/Radix_sort.
+	/// This sort requires that the sorted data be of a type that has a member
+	/// radix_type typedef and an mKey member of that type. The type must be
+	/// an integral type. This limits what can be sorted, but radix_sort is 
+	/// very fast -- typically faster than any other sort.
+	/// For example:
+	///     struct Sortable {
+	///         typedef int radix_type;
+	///         radix_type mKey;
+	///         // User data goes here, or the user can inherit from Sortable.
+	///     };
+	/// or, more generally:
+	///     template <typname Integer>
+	///     struct Sortable {
+	///         typedef Integer radix_type;
+	///         Integer mKey;
+	///     };
+	/// 
+	/// Example usage:
+	///     struct Element {
+	///         typedef uint16_t radix_type;
+	///         uint16_t mKey;
+	///         uint16_t mUserData;
+	///     };
+	///
+	///     Element elementArray[100];
+	///     Element buffer[100];
+	///
+	///     radix_sort<Element*, extract_radix_key<Element> >(elementArray, elementArray + 100, buffer);
+	///
+	/// To consider: A static linked-list implementation may be faster than the version here.
+
+	namespace Internal
+	{
+		/// extract_radix_key
+		///
+		/// Default radix sort integer value reader. It expects the sorted elements 
+		/// to have an integer member of type radix_type and of name "mKey". 
+		///
+		template <typename Node>
+		struct extract_radix_key
+		{
+			typedef typename Node::radix_type radix_type;
+
+			const radix_type operator()(const Node& x) const
+				{ return x.mKey; }
+		};
+
+		// The radix_sort implementation uses two optimizations that are not part of a typical radix sort implementation.
+		// 1. Computing a histogram (i.e. finding the number of elements per bucket) for the next pass is done in parallel with the loop that "scatters"
+		//    elements in the current pass.  The advantage is that it avoids the memory traffic / cache pressure of reading keys in a separate operation.
+		//    Note: It would also be possible to compute all histograms in a single pass.  However, that would increase the amount of stack space used and
+		//    also increase cache pressure slightly.  However, it could still be faster under some situations.
+		// 2. If all elements are mapped to a single bucket, then there is no need to perform a scatter operation.  Instead the elements are left in place
+		//    and only copied if they need to be copied to the final output buffer.
+		template <typename RandomAccessIterator, typename ExtractKey, int DigitBits, typename IntegerType>
+		void radix_sort_impl(RandomAccessIterator first,
+			RandomAccessIterator last,
+			RandomAccessIterator buffer,
+			ExtractKey extractKey,
+			IntegerType)
+		{
+			RandomAccessIterator srcFirst = first;
+			constexpr size_t numBuckets = 1 << DigitBits;
+			constexpr IntegerType bucketMask = numBuckets - 1;
+
+			// The alignment of this variable isn't required; it merely allows the code below to be faster on some platforms.
+			uint32_t EA_PREFIX_ALIGN(EASTL_PLATFORM_PREFERRED_ALIGNMENT) bucketSize[numBuckets];
+			uint32_t EA_PREFIX_ALIGN(EASTL_PLATFORM_PREFERRED_ALIGNMENT) bucketPosition[numBuckets];
+
+			RandomAccessIterator temp;
+			uint32_t i;
+
+			bool doSeparateHistogramCalculation = true;
+			uint32_t j;
+			for (j = 0; j < (8 * sizeof(IntegerType)); j += DigitBits)
+			{
+				if (doSeparateHistogramCalculation)
+				{
+					memset(bucketSize, 0, sizeof(bucketSize));
+					// Calculate histogram for the first scatter operation
+					for (temp = srcFirst; temp != last; ++temp)
+						++bucketSize[(extractKey(*temp) >> j) & bucketMask];
+				}
+
+				// If a single bucket contains all of the elements, then don't bother redistributing all elements to the
+				// same bucket.
+				if (bucketSize[((extractKey(*srcFirst) >> j) & bucketMask)] == uint32_t(last - srcFirst))
+				{
+					// Set flag to ensure histogram is computed for next digit position.
+					doSeparateHistogramCalculation = true;
+				}
+				else
+				{
+					// The histogram is either not needed or it will be calculated in parallel with the scatter operation below for better cache efficiency.
+					doSeparateHistogramCalculation = false;
+
+					// If this is the last digit position, then don't calculate a histogram
+					if (j == (8 * sizeof(IntegerType) - DigitBits))
+					{
+						bucketPosition[0] = 0;
+						for (i = 0; i < numBuckets - 1; i++)
+						{
+							bucketPosition[i + 1] = bucketPosition[i] + bucketSize[i];
+						}
+
+						for (temp = srcFirst; temp != last; ++temp)
+						{
+							IntegerType key = extractKey(*temp);
+							const size_t digit = (key >> j) & bucketMask;
+							buffer[bucketPosition[digit]++] = *temp;
+						}
+					}
+					// Compute the histogram while performing the scatter operation
+					else
+					{
+						bucketPosition[0] = 0;
+						for (i = 0; i < numBuckets - 1; i++)
+						{
+							bucketPosition[i + 1] = bucketPosition[i] + bucketSize[i];
+							bucketSize[i] = 0;	// Clear the bucket for the next pass
+						}
+
+						uint32_t jNext = j + DigitBits;
+						for (temp = srcFirst; temp != last; ++temp)
+						{
+							IntegerType key = extractKey(*temp);
+							const size_t digit = (key >> j) & bucketMask;
+							buffer[bucketPosition[digit]++] = *temp;
+
+							// Update histogram for the next scatter operation
+							++bucketSize[(extractKey(*temp) >> jNext) & bucketMask];
+						}
+					}
+
+					last = buffer + (last - srcFirst);
+					temp = srcFirst;
+					srcFirst = buffer;
+					buffer = temp;
+				}
+			}
+
+			if (srcFirst != first)
+			{
+				// Copy values back into the expected buffer
+				for (temp = srcFirst; temp != last; ++temp)
+					*buffer++ = *temp;
+			}
+		}
+	} // namespace Internal
+
+	template <typename RandomAccessIterator, typename ExtractKey, int DigitBits = 8>
+	void radix_sort(RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator buffer)
+	{
+		static_assert(DigitBits > 0, "DigitBits must be > 0");
+		static_assert(DigitBits <= (sizeof(typename ExtractKey::radix_type) * 8), "DigitBits must be <= the size of the key (in bits)");
+		if(first != last) // radix_sort_impl reads the first element.
+			eastl::Internal::radix_sort_impl<RandomAccessIterator, ExtractKey, DigitBits>(first, last, buffer, ExtractKey(), typename ExtractKey::radix_type());
+	}
+
+
+
+	/// comb_sort
+	///
+	/// This is an unstable sort.
+	/// Implements the CombSort algorithm; in particular, implements the CombSort11 variation 
+	/// of the CombSort algorithm, based on the reference to '11' in the implementation.
+	///
+	/// To consider: Use a comb sort table instead of the '((nSpace * 10) + 3) / 13' expression.
+	///              Ideal tables can be found on the Internet by looking up "comb sort table".
+	///
+	template <typename ForwardIterator, typename StrictWeakOrdering>
+	void comb_sort(ForwardIterator first, ForwardIterator last, StrictWeakOrdering compare)
+	{
+		typedef typename eastl::iterator_traits<ForwardIterator>::difference_type difference_type;
+
+		ForwardIterator iCurrent, iNext;
+		difference_type length = eastl::distance(first, last);
+		difference_type nSpace = length;
+
+		for(bool bSwapped = false; (nSpace > 1) || bSwapped; )
+		{
+			nSpace = ((nSpace * 10) + 3) / 13; // Integer division is less than ideal.
+
+			if((nSpace == 9) || (nSpace == 10))
+				nSpace = 11;
+
+			iCurrent = iNext = first;
+			eastl::advance(iNext, nSpace);
+			
+			for(bSwapped = false; iNext != last; iCurrent++, iNext++)
+			{
+				if(compare(*iNext, *iCurrent))
+				{
+					EASTL_VALIDATE_COMPARE(!compare(*iCurrent, *iNext)); // Validate that the compare function is sane.
+					eastl::iter_swap(iCurrent, iNext);
+					bSwapped = true;
+				}
+			}
+		}
+	} // comb_sort
+
+	template <typename ForwardIterator>
+	inline void comb_sort(ForwardIterator first, ForwardIterator last)
+	{
+		typedef eastl::less<typename eastl::iterator_traits<ForwardIterator>::value_type> Less;
+
+		eastl::comb_sort<ForwardIterator, Less>(first, last, Less());
+	}
+
+
+
+
+	/// bubble_sort
+	///
 	/// This is a stable sort.
-	// Implements the tim-sort sorting algorithm with a user-provided scratch buffer.
-	// http://en.wikipedia.org/wiki/Timsort
-	// This sort is the fastest sort when sort stability (maintaining order of equal values) is required and
-	// data sets are non-trivial (size >= 15). It's also the fastest sort (e.g. faster than quick_sort) for 
-	// the case that at at least half your data is already sorted. Otherwise, eastl::quick_sort is about 10% 
-	// faster than tim_sort_buffer but is not a stable sort. There are some reports that tim_sort outperforms
-	// quick_sort but most of these aren't taking into account that optimal quick_sort implementations use
-	// a hybrid approach called "introsort" (http://en.wikipedia.org/wiki/Introsort) which improves quick_sort
-	// considerably in practice.
-	//
-	// Strengths:
-	//     - Fastest stable sort for most sizes of data.
-	//     - Fastest sort for containers of data already mostly sorted.
-	//     - Simpler to understand than quick_sort.
-	//
-	// Weaknesses:
-	//     - User must provide a scratch buffer, otherwise the buffer is dynamically allocated during runtime.
-	//     - Not as fast as quick_sort for the general case of randomized data.
-	//     - Requires a RandomAccessIterator; thus must be on an array container type and not a list container type.
-	//     - Uses a lot of code to implement; thus it's not great when there is little room for more code.
+	/// Implements the BubbleSort algorithm. This algorithm is only useful for 
+	/// small range sizes, such as 10 or less items. You may be better off using
+	/// insertion_sort for cases where bubble_sort works.
+	///
+	namespace Internal
+	{
+		template <typename ForwardIterator, typename StrictWeakOrdering>
+		void bubble_sort_impl(ForwardIterator first, ForwardIterator last, StrictWeakOrdering compare, EASTL_ITC_NS::forward_iterator_tag)
+		{
+			ForwardIterator iCurrent, iNext;
+
+			while(first != last)
+			{
+				iNext = iCurrent = first;
+				
+				for(++iNext; iNext != last; iCurrent = iNext, ++iNext) 
+				{
+					if(compare(*iNext, *iCurrent))
+					{
+						EASTL_VALIDATE_COMPARE(!compare(*iCurrent, *iNext)); // Validate that the compare function is sane.
+						eastl::iter_swap(iCurrent, iNext);
+					}
+				}
+				last = iCurrent;
+			}
+		}
+
+		template <typename BidirectionalIterator, typename StrictWeakOrdering>
+		void bubble_sort_impl(BidirectionalIterator first, BidirectionalIterator last, StrictWeakOrdering compare, EASTL_ITC_NS::bidirectional_iterator_tag)
+		{
+			if(first != last)
+			{
+				BidirectionalIterator iCurrent, iNext, iLastModified;
+
+				last--;
+
+				while(first != last)
+				{
+					iLastModified = iNext = iCurrent = first;
+					
+					for(++iNext; iCurrent != last; iCurrent = iNext, ++iNext)
+					{
+						if(compare(*iNext, *iCurrent))
+						{
+							EASTL_VALIDATE_COMPARE(!compare(*iCurrent, *iNext)); // Validate that the compare function is sane.
+							iLastModified = iCurrent;
+							eastl::iter_swap(iCurrent, iNext);
+						}
+					}
+
+					last = iLastModified;
+				}
+			}
+		}
+	} // namespace Internal
+
+	template <typename ForwardIterator, typename StrictWeakOrdering>
+	inline void bubble_sort(ForwardIterator first, ForwardIterator last, StrictWeakOrdering compare)
+	{
+		typedef typename eastl::iterator_traits<ForwardIterator>::iterator_category IC;
+
+		eastl::Internal::bubble_sort_impl<ForwardIterator, StrictWeakOrdering>(first, last, compare, IC());
+	}
+
+	template <typename ForwardIterator>
+	inline void bubble_sort(ForwardIterator first, ForwardIterator last)
+	{
+		typedef eastl::less<typename eastl::iterator_traits<ForwardIterator>::value_type> Less;
+		typedef typename eastl::iterator_traits<ForwardIterator>::iterator_category IC;
+
+		eastl::Internal::bubble_sort_impl<ForwardIterator, Less>(first, last, Less(), IC());
+	}
+
+
+
+	/// sort
+	/// 
+	/// We use quick_sort by default. See quick_sort for details.
+	///
+	/// EASTL_DEFAULT_SORT_FUNCTION
+	/// If a default sort function is specified then call it, otherwise use EASTL's default quick_sort.
+	/// EASTL_DEFAULT_SORT_FUNCTION must be namespace-qualified and include any necessary template
+	/// parameters (e.g. eastl::comb_sort instead of just comb_sort), and it must be visible to this code. 
+	/// The EASTL_DEFAULT_SORT_FUNCTION must be provided in two versions: 
+	///     template <typename RandomAccessIterator>
+	///     void EASTL_DEFAULT_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last);
+	///
+	///     template <typename RandomAccessIterator, typename Compare>
+	///     void EASTL_DEFAULT_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	///
+	template <typename RandomAccessIterator>
+	inline void sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		#if defined(EASTL_DEFAULT_SORT_FUNCTION)
+			EASTL_DEFAULT_SORT_FUNCTION(first, last);
+		#else
+			eastl::quick_sort<RandomAccessIterator>(first, last);
+		#endif
+	}
+
+	template <typename RandomAccessIterator, typename Compare>
+	inline void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		#if defined(EASTL_DEFAULT_SORT_FUNCTION)
+			EASTL_DEFAULT_SORT_FUNCTION(first, last, compare);
+		#else
+			eastl::quick_sort<RandomAccessIterator, Compare>(first, last, compare);
+		#endif
+	}
+
+
+
+	/// stable_sort
+	/// 
+	/// We use merge_sort by default. See merge_sort for details.
+	/// Beware that the used merge_sort -- and thus stable_sort -- allocates 
+	/// memory during execution. Try using merge_sort_buffer if you want
+	/// to avoid memory allocation.
+	///
+	/// EASTL_DEFAULT_STABLE_SORT_FUNCTION
+	/// If a default sort function is specified then call it, otherwise use EASTL's default merge_sort.
+	/// EASTL_DEFAULT_STABLE_SORT_FUNCTION must be namespace-qualified and include any necessary template
+	/// parameters (e.g. eastl::tim_sort instead of just tim_sort), and it must be visible to this code. 
+	/// The EASTL_DEFAULT_STABLE_SORT_FUNCTION must be provided in three versions, though the third
+	/// allocation implementation may choose to ignore the allocator parameter: 
+	///     template <typename RandomAccessIterator, typename StrictWeakOrdering>
+	///     void EASTL_DEFAULT_STABLE_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering compare);
+	///     
+	///     template <typename RandomAccessIterator>
+	///     void EASTL_DEFAULT_STABLE_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last);
+	///
+	///     template <typename RandomAccessIterator, typename Allocator, typename StrictWeakOrdering>
+	///     void EASTL_DEFAULT_STABLE_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last, Allocator& allocator, StrictWeakOrdering compare);
+	///
+	template <typename RandomAccessIterator, typename StrictWeakOrdering>
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering compare)
+	{
+		#if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
+			EASTL_DEFAULT_STABLE_SORT_FUNCTION(first, last, *get_default_allocator(0), compare);
+		#else
+			eastl::merge_sort<RandomAccessIterator, EASTLAllocatorType, StrictWeakOrdering>
+							 (first, last, *get_default_allocator(0), compare);
+		#endif
+	}
+
+	template <typename RandomAccessIterator>
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		#if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
+			EASTL_DEFAULT_STABLE_SORT_FUNCTION(first, last, *get_default_allocator(0));
+		#else
+			eastl::merge_sort<RandomAccessIterator, EASTLAllocatorType>
+							 (first, last, *get_default_allocator(0));
+		#endif
+	}
+
+	template <typename RandomAccessIterator, typename Allocator, typename StrictWeakOrdering>
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Allocator& allocator, StrictWeakOrdering compare)
+	{
+		#if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
+			EASTL_DEFAULT_STABLE_SORT_FUNCTION(first, last, allocator, compare);
+		#else
+			eastl::merge_sort<RandomAccessIterator, Allocator, StrictWeakOrdering>(first, last, allocator, compare);
+		#endif
+	}
+
+	// This is not defined because it would cause compiler errors due to conflicts with a version above. 
+	//template <typename RandomAccessIterator, typename Allocator>
+	//void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Allocator& allocator)
+	//{
+	//    #if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
+	//        EASTL_DEFAULT_STABLE_SORT_FUNCTION<RandomAccessIterator, Allocator>(first, last, allocator);
+	//    #else
+	//        eastl::merge_sort<RandomAccessIterator, Allocator>(first, last, allocator);
+	//    #endif
+	//}
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Parallel sorting
 	//
-	// The pBuffer parameter must hold at least ((last-first)/2) elements (i.e. half the elements of the container).
-	// This minimum size is a worst-case size requirement, but handles all possible cases. pBuffer is just a scratch
-	// buffer and is not needed after the return of this function, and doesn't need to be seeded with any particular
-	// values upon entering this function.
+	// The overloads below take a task_scheduler (see task_scheduler.h) as their
+	// first argument and divide the work among its threads. The result is the
+	// same as that of the corresponding serial function, including stability
+	// where the serial function is stable. Inputs of EASTL_PARALLEL_SORT_MIN_SIZE
+	// elements or fewer, or schedulers with a concurrency of 1, fall back to the
+	// serial function. As with the serial versions, memory is supplied by the
+	// caller: stable_sort and radix_sort take a buffer as large as the input.
 	//
 	// Example usage:
-	//     int intArray[64];
-	//     int buffer[32];
-	//     ...
-	//     tim_sort_buffer(intArray, intArray + 64, buffer);
+	//     eastl::default_task_scheduler scheduler;
+	//     eastl::vector<int> v(10000000);
+	//     eastl::sort(scheduler, v.begin(), v.end());
 	//
-	template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
-	void tim_sort_buffer(RandomAccessIterator first, RandomAccessIterator last, T* pBuffer, StrictWeakOrdering compare)
+	//     eastl::vector<Widget> buffer(v.size());
+	//     eastl::stable_sort(scheduler, widgets.begin(), widgets.end(), buffer.data(), WidgetCompare());
+	///////////////////////////////////////////////////////////////////////
+
+	namespace Internal
 	{
-		using namespace Internal;
+		template <typename Function>
+		void parallel_task_thunk(void* pContext, size_t index)
+		{
+			(*static_cast<Function*>(pContext))(index);
+		}
 
-		// To consider: Convert the implementation to use first/last instead of first/size.
-		const intptr_t size = (intptr_t)(last - first);
+		// Calls function(i) for each i in [0, count) via the scheduler.
+		template <typename Function>
+		inline void parallel_for(task_scheduler& scheduler, size_t count, Function& function)
+		{
+			scheduler.run(&parallel_task_thunk<Function>, &function, count);
+		}
 
-		if(size < 64)
-			insertion_sort_already_started(first, first + size, first + 1, compare);
-		else
+		// Upper bound on the number of chunks a range is divided into. Bounds the size of the bookkeeping arrays below.
+		static const size_t kParallelSortMaxChunks = 128;
+
+		// Returns the number of chunks to divide n elements into. A few chunks per thread lets
+		// threads that finish early take over work from the others.
+		template <typename Difference>
+		inline size_t parallel_sort_chunk_count(task_scheduler& scheduler, Difference n)
 		{
-			tim_sort_run   run_stack[kTimSortStackSize];
-			intptr_t       stack_curr = 0;
-			intptr_t       len, run;
-			intptr_t       curr = 0;
-			const intptr_t minrun = timsort_compute_minrun(size);
+			const size_t nConcurrency = scheduler.concurrency();
+			const size_t nChunks      = eastl::min_alt((size_t)n / EASTL_PARALLEL_SORT_MIN_SIZE, eastl::min_alt(nConcurrency * 4, kParallelSortMaxChunks));
 
-			#if EASTL_DEV_DEBUG
-				memset(run_stack, 0, sizeof(run_stack));
-			#endif
+			return ((nConcurrency > 1) && (nChunks > 1)) ? nChunks : 1;
+		}
 
-			if(tim_sort_add_run<RandomAccessIterator, T, StrictWeakOrdering>(run_stack, first, pBuffer, size, minrun, len, run, curr, stack_curr, compare))
-				return;
-			if(tim_sort_add_run<RandomAccessIterator, T, StrictWeakOrdering>(run_stack, first, pBuffer, size, minrun, len, run, curr, stack_curr, compare))
-				return;
-			if(tim_sort_add_run<RandomAccessIterator, T, StrictWeakOrdering>(run_stack, first, pBuffer, size, minrun, len, run, curr, stack_curr, compare))
-				return;
+		// Returns the offset of chunk i when n elements are divided into nChunks nearly equal chunks. i may be nChunks.
+		template <typename Difference>
+		inline Difference parallel_chunk_begin(Difference n, size_t nChunks, size_t i)
+		{
+			const Difference nQuotient  = n / (Difference)nChunks;
+			const Difference nRemainder = n % (Difference)nChunks;
 
-			for(;;)
+			return (nQuotient * (Difference)i) + eastl::min_alt((Difference)i, nRemainder);
+		}
+
+		// Pseudo-median of nine elements, spread over [first, last). Requires (last - first) >= 9.
+		template <typename RandomAccessIterator, typename Compare>
+		inline typename eastl::iterator_traits<RandomAccessIterator>::value_type
+		parallel_sort_pivot(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+		{
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type      value_type;
+
+			const difference_type      nStep = (last - first) / 8;
+			const RandomAccessIterator mid   = first + ((last - first) / 2);
+
+			return eastl::median<value_type, Compare>(eastl::median<value_type, Compare>(*first, *(first + nStep), *(first + (2 * nStep)), compare),
+			                                          eastl::median<value_type, Compare>(*(mid - nStep), *mid, *(mid + nStep), compare),
+			                                          eastl::median<value_type, Compare>(*(last - (2 * nStep) - 1), *(last - nStep - 1), *(last - 1), compare),
+			                                          compare);
+		}
+
+		// Partitions [first, last) so that the elements for which predicate is true precede the others,
+		// and returns the split point. Each chunk is first partitioned independently. After that the only
+		// misplaced elements are the false ones left of the final split point and the true ones right of
+		// it; there are equally many of each, and the two sets are swapped with each other in parallel.
+		template <typename RandomAccessIterator, typename Predicate>
+		RandomAccessIterator parallel_partition(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator last, Predicate& predicate)
+		{
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+			struct Span
 			{
-				if(timsort_check_invariant(run_stack, stack_curr))
-					stack_curr = tim_sort_collapse<RandomAccessIterator, T, StrictWeakOrdering>(first, run_stack, stack_curr, pBuffer, size, compare);
-				else
+				difference_type mBegin;
+				difference_type mEnd;
+				difference_type mnPrefix; // Number of misplaced elements in the preceding spans.
+			};
+
+			const difference_type n       = last - first;
+			const size_t          nChunks = parallel_sort_chunk_count(scheduler, n);
+
+			if(nChunks < 2)
+				return eastl::partition(first, last, predicate);
+
+			difference_type splits[kParallelSortMaxChunks];
+
+			auto partitionChunk = [&](size_t i)
+			{
+				const RandomAccessIterator chunkFirst = first + parallel_chunk_begin(n, nChunks, i);
+				const RandomAccessIterator chunkLast  = first + parallel_chunk_begin(n, nChunks, i + 1);
+
+				splits[i] = eastl::partition(chunkFirst, chunkLast, predicate) - first;
+			};
+			parallel_for(scheduler, nChunks, partitionChunk);
+
+			difference_type nSplit = 0;
+			for(size_t i = 0; i < nChunks; ++i)
+				nSplit += splits[i] - parallel_chunk_begin(n, nChunks, i);
+
+			Span            falseSpans[kParallelSortMaxChunks]; // False elements left of nSplit.
+			Span            trueSpans[kParallelSortMaxChunks];  // True elements right of nSplit.
+			size_t          nFalseSpans = 0, nTrueSpans = 0;
+			difference_type nMisplaced = 0, nTrueMisplaced = 0;
+
+			for(size_t i = 0; i < nChunks; ++i)
+			{
+				const difference_type chunkBegin = parallel_chunk_begin(n, nChunks, i);
+				const difference_type chunkEnd   = parallel_chunk_begin(n, nChunks, i + 1);
+				const difference_type falseEnd   = eastl::min_alt(chunkEnd, nSplit);
+				const difference_type trueBegin  = eastl::max_alt(chunkBegin, nSplit);
+
+				if(splits[i] < falseEnd)
 				{
-					if(tim_sort_add_run<RandomAccessIterator, T, StrictWeakOrdering>(run_stack, first, pBuffer, size, minrun, len, run, curr, stack_curr, compare))
-						break;
+					const Span span = { splits[i], falseEnd, nMisplaced };
+					falseSpans[nFalseSpans++] = span;
+					nMisplaced += falseEnd - splits[i];
 				}
-			}
-		}
-	}
 
+				if(trueBegin < splits[i])
+				{
+					const Span span = { trueBegin, splits[i], nTrueMisplaced };
+					trueSpans[nTrueSpans++] = span;
+					nTrueMisplaced += splits[i] - trueBegin;
+				}
+			}
 
-	template <typename RandomAccessIterator, typename T>
-	inline void tim_sort_buffer(RandomAccessIterator first, RandomAccessIterator last, T* pBuffer)
-	{
-		typedef eastl::less<T> Less;
+			EASTL_ASSERT(nMisplaced == nTrueMisplaced);
 
-		eastl::tim_sort_buffer<RandomAccessIterator, T, Less>(first, last, pBuffer, Less());
-	}
+			if(nMisplaced)
+			{
+				const size_t nPieces = eastl::max_alt(eastl::min_alt((size_t)nMisplaced / (EASTL_PARALLEL_SORT_MIN_SIZE / 4), nChunks), (size_t)1);
 
+				auto swapPiece = [&](size_t k)
+				{
+					difference_type       g    = parallel_chunk_begin(nMisplaced, nPieces, k);
+					const difference_type gEnd = parallel_chunk_begin(nMisplaced, nPieces, k + 1);
+					size_t f = 0, t = 0;
 
+					while((falseSpans[f].mnPrefix + (falseSpans[f].mEnd - falseSpans[f].mBegin)) <= g)
+						++f;
+					while((trueSpans[t].mnPrefix + (trueSpans[t].mEnd - trueSpans[t].mBegin)) <= g)
+						++t;
 
+					difference_type falsePos = falseSpans[f].mBegin + (g - falseSpans[f].mnPrefix);
+					difference_type truePos  = trueSpans[t].mBegin  + (g - trueSpans[t].mnPrefix);
 
-	/// radix_sort
-	///
-	/// Implements a classic LSD (least significant digit) radix sort.
-	/// See http://en.wikipedia.org/wiki/Radix_sort.
-	/// This sort requires that the sorted data be of a type that has a member
-	/// radix_type typedef and an mKey member of that type. The type must be
-	/// an integral type. This limits what can be sorted, but radix_sort is 
-	/// very fast -- typically faster than any other sort.
-	/// For example:
-	///     struct Sortable {
-	///         typedef int radix_type;
-	///         radix_type mKey;
-	///         // User data goes here, or the user can inherit from Sortable.
-	///     };
-	/// or, more generally:
-	///     template <typname Integer>
-	///     struct Sortable {
-	///         typedef Integer radix_type;
-	///         Integer mKey;
-	///     };
-	/// 
-	/// Example usage:
-	///     struct Element {
-	///         typedef uint16_t radix_type;
-	///         uint16_t mKey;
-	///         uint16_t mUserData;
-	///     };
-	///
-	///     Element elementArray[100];
-	///     Element buffer[100];
-	///
-	///     radix_sort<Element*, extract_radix_key<Element> >(elementArray, elementArray + 100, buffer);
-	///
-	/// To consider: A static linked-list implementation may be faster than the version here.
+					while(g < gEnd)
+					{
+						const difference_type nStep = eastl::min_alt(gEnd - g, eastl::min_alt(falseSpans[f].mEnd - falsePos, trueSpans[t].mEnd - truePos));
 
-	namespace Internal
-	{
-		/// extract_radix_key
-		///
-		/// Default radix sort integer value reader. It expects the sorted elements 
-		/// to have an integer member of type radix_type and of name "mKey". 
-		///
-		template <typename Node>
-		struct extract_radix_key
-		{
-			typedef typename Node::radix_type radix_type;
+						eastl::swap_ranges(first + falsePos, first + falsePos + nStep, first + truePos);
+						g        += nStep;
+						falsePos += nStep;
+						truePos  += nStep;
 
-			const radix_type operator()(const Node& x) const
-				{ return x.mKey; }
-		};
+						if((falsePos == falseSpans[f].mEnd) && (++f < nFalseSpans))
+							falsePos = falseSpans[f].mBegin;
+						if((truePos == trueSpans[t].mEnd) && (++t < nTrueSpans))
+							truePos = trueSpans[t].mBegin;
+					}
+				};
+				parallel_for(scheduler, nPieces, swapPiece);
+			}
 
-		// The radix_sort implementation uses two optimizations that are not part of a typical radix sort implementation.
-		// 1. Computing a histogram (i.e. finding the number of elements per bucket) for the next pass is done in parallel with the loop that "scatters"
-		//    elements in the current pass.  The advantage is that it avoids the memory traffic / cache pressure of reading keys in a separate operation.
-		//    Note: It would also be possible to compute all histograms in a single pass.  However, that would increase the amount of stack space used and
-		//    also increase cache pressure slightly.  However, it could still be faster under some situations.
-		// 2. If all elements are mapped to a single bucket, then there is no need to perform a scatter operation.  Instead the elements are left in place
-		//    and only copied if they need to be copied to the final output buffer.
-		template <typename RandomAccessIterator, typename ExtractKey, int DigitBits, typename IntegerType>
-		void radix_sort_impl(RandomAccessIterator first,
-			RandomAccessIterator last,
-			RandomAccessIterator buffer,
-			ExtractKey extractKey,
-			IntegerType)
-		{
-			RandomAccessIterator srcFirst = first;
-			constexpr size_t numBuckets = 1 << DigitBits;
-			constexpr IntegerType bucketMask = numBuckets - 1;
+			return first + nSplit;
+		}
 
-			// The alignment of this variable isn't required; it merely allows the code below to be faster on some platforms.
-			uint32_t EA_PREFIX_ALIGN(EASTL_PLATFORM_PREFERRED_ALIGNMENT) bucketSize[numBuckets];
-			uint32_t EA_PREFIX_ALIGN(EASTL_PLATFORM_PREFERRED_ALIGNMENT) bucketPosition[numBuckets];
 
-			RandomAccessIterator temp;
-			uint32_t i;
+		// Quick sort whose two halves are sorted as separate tasks. Ranges of nSerialSize or fewer elements
+		// are handed to the serial sort, and ranges of at least nParallelPartitionSize are partitioned in
+		// parallel; below that there are already enough concurrent tasks to keep the threads busy.
+		template <typename RandomAccessIterator, typename Compare>
+		void parallel_quick_sort_impl(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator last, Compare& compare,
+		                              typename eastl::iterator_traits<RandomAccessIterator>::difference_type nSerialSize,
+		                              typename eastl::iterator_traits<RandomAccessIterator>::difference_type nParallelPartitionSize,
+		                              int nRecursionBudget)
+		{
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
 
-			bool doSeparateHistogramCalculation = true;
-			uint32_t j;
-			for (j = 0; j < (8 * sizeof(IntegerType)); j += DigitBits)
+			for(;;)
 			{
-				if (doSeparateHistogramCalculation)
+				// Running out of the recursion budget means the pivots are performing badly; the serial sort's
+				// own introspection then guarantees n log n behavior for the rest of the range.
+				if(((last - first) <= nSerialSize) || (nRecursionBudget-- == 0))
 				{
-					memset(bucketSize, 0, sizeof(bucketSize));
-					// Calculate histogram for the first scatter operation
-					for (temp = srcFirst; temp != last; ++temp)
-						++bucketSize[(extractKey(*temp) >> j) & bucketMask];
+					eastl::sort<RandomAccessIterator, Compare>(first, last, compare);
+					return;
 				}
 
-				// If a single bucket contains all of the elements, then don't bother redistributing all elements to the
-				// same bucket.
-				if (bucketSize[((extractKey(*srcFirst) >> j) & bucketMask)] == uint32_t(last - srcFirst))
+				const value_type     pivot(parallel_sort_pivot<RandomAccessIterator, Compare>(first, last, compare));
+				RandomAccessIterator middle;
+
+				if((last - first) >= nParallelPartitionSize)
 				{
-					// Set flag to ensure histogram is computed for next digit position.
-					doSeparateHistogramCalculation = true;
+					auto isLess = [&](const value_type& x) { return compare(x, pivot); };
+					middle = parallel_partition(scheduler, first, last, isLess);
+
+					if(middle == first)
+					{
+						// The pivot is the smallest value. Gather the elements equivalent to it, which are then
+						// already sorted, and continue with the rest; this also ends runs of equal elements.
+						auto isNotGreater = [&](const value_type& x) { return !compare(pivot, x); };
+						first = parallel_partition(scheduler, first, last, isNotGreater);
+						continue;
+					}
 				}
 				else
 				{
-					// The histogram is either not needed or it will be calculated in parallel with the scatter operation below for better cache efficiency.
-					doSeparateHistogramCalculation = false;
+					// The pivot is the median of several distinct elements, which serves as a sentinel
+					// for both ends of get_partition's scans and guarantees first < middle < last.
+					middle = eastl::get_partition<RandomAccessIterator, value_type, Compare>(first, last, pivot, compare);
+				}
 
-					// If this is the last digit position, then don't calculate a histogram
-					if (j == (8 * sizeof(IntegerType) - DigitBits))
+				auto sortPart = [&](size_t i)
+				{
+					if(i == 0)
+						parallel_quick_sort_impl<RandomAccessIterator, Compare>(scheduler, first, middle, compare, nSerialSize, nParallelPartitionSize, nRecursionBudget);
+					else
+						parallel_quick_sort_impl<RandomAccessIterator, Compare>(scheduler, middle, last, compare, nSerialSize, nParallelPartitionSize, nRecursionBudget);
+				};
+				parallel_for(scheduler, 2, sortPart);
+				return;
+			}
+		}
+
+
+		// Returns how many of the first k elements of the merge of [a, a + nA) and [b, b + nB) come
+		// from a. Ties are taken from a first, as eastl::merge does, so splitting a merge at such
+		// points and merging the pieces independently gives the same (stable) result.
+		template <typename Iterator1, typename Iterator2, typename Difference, typename StrictWeakOrdering>
+		Difference merge_path_split(Iterator1 a, Difference nA, Iterator2 b, Difference nB, Difference k, StrictWeakOrdering& compare)
+		{
+			Difference lo = (k > nB) ? (k - nB) : 0;
+			Difference hi = (k < nA) ? k : nA;
+
+			while(lo < hi)
+			{
+				const Difference mid = lo + ((hi - lo) / 2);
+
+				if(compare(b[k - mid - 1], a[mid]))
+					hi = mid;
+				else
+					lo = mid + 1;
+			}
+
+			return lo;
+		}
+
+		// Merges the runs [pRunBounds[0], pRunBounds[1]) with [pRunBounds[1], pRunBounds[2]), the next two
+		// runs with each other, and so on, from src into dst. A trailing unpaired run is copied. The output
+		// is divided into nPieces equal pieces regardless of where the runs start and end.
+		template <typename InputIterator, typename OutputIterator, typename Difference, typename StrictWeakOrdering>
+		void parallel_merge_runs(task_scheduler& scheduler, InputIterator src, OutputIterator dst, Difference n,
+		                         const Difference* pRunBounds, size_t nRuns, size_t nPieces, StrictWeakOrdering& compare)
+		{
+			auto mergePiece = [&](size_t k)
+			{
+				const Difference outBegin = parallel_chunk_begin(n, nPieces, k);
+				const Difference outEnd   = parallel_chunk_begin(n, nPieces, k + 1);
+
+				for(size_t p = 0; (p < nRuns) && (pRunBounds[p] < outEnd); p += 2)
+				{
+					const Difference runBegin = pRunBounds[p];
+					const Difference runMid   = pRunBounds[eastl::min_alt(p + 1, nRuns)];
+					const Difference runEnd   = pRunBounds[eastl::min_alt(p + 2, nRuns)];
+
+					if(runEnd > outBegin)
 					{
-						bucketPosition[0] = 0;
-						for (i = 0; i < numBuckets - 1; i++)
-						{
-							bucketPosition[i + 1] = bucketPosition[i] + bucketSize[i];
-						}
+						const Difference k0 = eastl::max_alt(outBegin, runBegin) - runBegin;
+						const Difference k1 = eastl::min_alt(outEnd, runEnd) - runBegin;
+						const Difference i0 = merge_path_split(src + runBegin, runMid - runBegin, src + runMid, runEnd - runMid, k0, compare);
+						const Difference i1 = merge_path_split(src + runBegin, runMid - runBegin, src + runMid, runEnd - runMid, k1, compare);
 
-						for (temp = srcFirst; temp != last; ++temp)
-						{
-							IntegerType key = extractKey(*temp);
-							const size_t digit = (key >> j) & bucketMask;
-							buffer[bucketPosition[digit]++] = *temp;
-						}
+						eastl::merge(src + runBegin + i0, src + runBegin + i1, src + runMid + (k0 - i0), src + runMid + (k1 - i1), dst + runBegin + k0, compare);
 					}
-					// Compute the histogram while performing the scatter operation
-					else
-					{
-						bucketPosition[0] = 0;
-						for (i = 0; i < numBuckets - 1; i++)
-						{
-							bucketPosition[i + 1] = bucketPosition[i] + bucketSize[i];
-							bucketSize[i] = 0;	// Clear the bucket for the next pass
-						}
+				}
+			};
+			parallel_for(scheduler, nPieces, mergePiece);
+		}
 
-						uint32_t jNext = j + DigitBits;
-						for (temp = srcFirst; temp != last; ++temp)
-						{
-							IntegerType key = extractKey(*temp);
-							const size_t digit = (key >> j) & bucketMask;
-							buffer[bucketPosition[digit]++] = *temp;
 
-							// Update histogram for the next scatter operation
-							++bucketSize[(extractKey(*temp) >> jNext) & bucketMask];
-						}
+		template <typename RandomAccessIterator, typename ExtractKey, int DigitBits, typename IntegerType>
+		void parallel_radix_sort_impl(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator buffer, size_t nChunks, IntegerType)
+		{
+			typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+			constexpr size_t      numBuckets = 1 << DigitBits;
+			constexpr IntegerType bucketMask = numBuckets - 1;
+
+			const difference_type n = last - first;
+			ExtractKey            extractKey;
+
+			// The bucket positions of every chunk, numBuckets per chunk. This is a small amount of bookkeeping
+			// compared to the element buffer, and unlike the serial version it is too large for the stack.
+			EASTLAllocatorType& allocator  = *eastl::get_default_allocator((EASTLAllocatorType*)NULL);
+			const size_t        nTableSize = nChunks * numBuckets * sizeof(difference_type);
+			difference_type*    pTable     = (difference_type*)EASTLAlloc(allocator, nTableSize);
+
+			RandomAccessIterator src = first;
+			RandomAccessIterator dst = buffer;
+
+			for(uint32_t j = 0; j < (8 * sizeof(IntegerType)); j += DigitBits)
+			{
+				auto countChunk = [&](size_t c)
+				{
+					difference_type* const pCounts = pTable + (c * numBuckets);
+					memset(pCounts, 0, numBuckets * sizeof(difference_type));
+
+					for(RandomAccessIterator it = src + parallel_chunk_begin(n, nChunks, c), itEnd = src + parallel_chunk_begin(n, nChunks, c + 1); it != itEnd; ++it)
+						++pCounts[(extractKey(*it) >> j) & bucketMask];
+				};
+				parallel_for(scheduler, nChunks, countChunk);
+
+				// Turn the counts into starting positions. Within a bucket, earlier chunks go first, which keeps the sort stable.
+				difference_type nPosition      = 0;
+				bool            bSingleBucket  = false;
+
+				for(size_t d = 0; d < numBuckets; ++d)
+				{
+					const difference_type nBucketBegin = nPosition;
+
+					for(size_t c = 0; c < nChunks; ++c)
+					{
+						difference_type& entry = pTable[(c * numBuckets) + d];
+						const difference_type nCount = entry;
+						entry = nPosition;
+						nPosition += nCount;
 					}
 
-					last = buffer + (last - srcFirst);
-					temp = srcFirst;
-					srcFirst = buffer;
-					buffer = temp;
+					if((nPosition - nBucketBegin) == n)
+						bSingleBucket = true;
+				}
+
+				// If a single bucket contains all of the elements, this pass wouldn't move anything.
+				if(!bSingleBucket)
+				{
+					auto scatterChunk = [&](size_t c)
+					{
+						difference_type* const pPositions = pTable + (c * numBuckets);
+
+						for(RandomAccessIterator it = src + parallel_chunk_begin(n, nChunks, c), itEnd = src + parallel_chunk_begin(n, nChunks, c + 1); it != itEnd; ++it)
+							dst[pPositions[(extractKey(*it) >> j) & bucketMask]++] = *it;
+					};
+					parallel_for(scheduler, nChunks, scatterChunk);
+
+					eastl::swap(src, dst);
 				}
 			}
 
-			if (srcFirst != first)
+			if(src != first)
 			{
-				// Copy values back into the expected buffer
-				for (temp = srcFirst; temp != last; ++temp)
-					*buffer++ = *temp;
+				auto copyChunk = [&](size_t c)
+				{
+					const difference_type chunkBegin = parallel_chunk_begin(n, nChunks, c);
+					const difference_type chunkEnd   = parallel_chunk_begin(n, nChunks, c + 1);
+
+					eastl::copy(src + chunkBegin, src + chunkEnd, first + chunkBegin);
+				};
+				parallel_for(scheduler, nChunks, copyChunk);
 			}
-		}
-	} // namespace Internal
 
-	template <typename RandomAccessIterator, typename ExtractKey, int DigitBits = 8>
-	void radix_sort(RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator buffer)
-	{
-		static_assert(DigitBits > 0, "DigitBits must be > 0");
-		static_assert(DigitBits <= (sizeof(typename ExtractKey::radix_type) * 8), "DigitBits must be <= the size of the key (in bits)");
-		eastl::Internal::radix_sort_impl<RandomAccessIterator, ExtractKey, DigitBits>(first, last, buffer, ExtractKey(), typename ExtractKey::radix_type());
-	}
+			EASTLFree(allocator, pTable, nTableSize);
+		}
 
+	} // namespace Internal
 
 
-	/// comb_sort
-	///
-	/// This is an unstable sort.
-	/// Implements the CombSort algorithm; in particular, implements the CombSort11 variation 
-	/// of the CombSort algorithm, based on the reference to '11' in the implementation.
+	/// sort
 	///
-	/// To consider: Use a comb sort table instead of the '((nSpace * 10) + 3) / 13' expression.
-	///              Ideal tables can be found on the Internet by looking up "comb sort table".
+	/// Parallel version of sort. This is an unstable sort.
+	/// Large ranges are quick sorted with both halves of each partition sorted as separate
+	/// tasks, and with the top-level partitions themselves done in parallel. Small ranges are
+	/// handed to the serial sort.
 	///
-	template <typename ForwardIterator, typename StrictWeakOrdering>
-	void comb_sort(ForwardIterator first, ForwardIterator last, StrictWeakOrdering compare)
+	template <typename RandomAccessIterator, typename Compare>
+	void sort(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 	{
-		typedef typename eastl::iterator_traits<ForwardIterator>::difference_type difference_type;
+		typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
 
-		ForwardIterator iCurrent, iNext;
-		difference_type length = eastl::distance(first, last);
-		difference_type nSpace = length;
+		const difference_type n            = last - first;
+		const size_t          nConcurrency = scheduler.concurrency();
 
-		for(bool bSwapped = false; (nSpace > 1) || bSwapped; )
+		if((nConcurrency < 2) || (n <= (difference_type)EASTL_PARALLEL_SORT_MIN_SIZE))
+			eastl::sort<RandomAccessIterator, Compare>(first, last, compare);
+		else
 		{
-			nSpace = ((nSpace * 10) + 3) / 13; // Integer division is less than ideal.
-
-			if((nSpace == 9) || (nSpace == 10))
-				nSpace = 11;
+			// Aim for a dozen or so serial sorts per thread, to balance load.
+			const difference_type nSerialSize            = eastl::max_alt((difference_type)EASTL_PARALLEL_SORT_MIN_SIZE, n / (difference_type)(nConcurrency * 16));
+			const difference_type nParallelPartitionSize = eastl::max_alt((difference_type)EASTL_PARALLEL_SORT_MIN_SIZE * 2, n / (difference_type)nConcurrency);
 
-			iCurrent = iNext = first;
-			eastl::advance(iNext, nSpace);
-			
-			for(bSwapped = false; iNext != last; iCurrent++, iNext++)
-			{
-				if(compare(*iNext, *iCurrent))
-				{
-					EASTL_VALIDATE_COMPARE(!compare(*iCurrent, *iNext)); // Validate that the compare function is sane.
-					eastl::iter_swap(iCurrent, iNext);
-					bSwapped = true;
-				}
-			}
+			Internal::parallel_quick_sort_impl<RandomAccessIterator, Compare>(scheduler, first, last, compare, nSerialSize, nParallelPartitionSize, 2 * (int)Internal::Log2(n));
 		}
-	} // comb_sort
+	}
 
-	template <typename ForwardIterator>
-	inline void comb_sort(ForwardIterator first, ForwardIterator last)
+	template <typename RandomAccessIterator>
+	inline void sort(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator last)
 	{
-		typedef eastl::less<typename eastl::iterator_traits<ForwardIterator>::value_type> Less;
+		typedef eastl::less<typename eastl::iterator_traits<RandomAccessIterator>::value_type> Less;
 
-		eastl::comb_sort<ForwardIterator, Less>(first, last, Less());
+		eastl::sort<RandomAccessIterator, Less>(scheduler, first, last, Less());
 	}
 
 
-
-
-	/// bubble_sort
+	/// stable_sort
 	///
-	/// This is a stable sort.
-	/// Implements the BubbleSort algorithm. This algorithm is only useful for 
-	/// small range sizes, such as 10 or less items. You may be better off using
-	/// insertion_sort for cases where bubble_sort works.
+	/// Parallel version of stable_sort. This is a stable sort.
+	/// pBuffer must point to (last - first) elements, as with merge_sort_buffer.
+	/// The range is divided into chunks which are sorted with merge_sort_buffer, after which
+	/// pairs of runs are merged back and forth between the range and the buffer. Each merge
+	/// is split into equally sized pieces along its merge path, so all threads remain busy
+	/// through the final merge.
 	///
-	namespace Internal
+	template <typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+	void stable_sort(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator last, T* pBuffer, StrictWeakOrdering compare)
 	{
-		template <typename ForwardIterator, typename StrictWeakOrdering>
-		void bubble_sort_impl(ForwardIterator first, ForwardIterator last, StrictWeakOrdering compare, EASTL_ITC_NS::forward_iterator_tag)
-		{
-			ForwardIterator iCurrent, iNext;
+		typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
 
-			while(first != last)
-			{
-				iNext = iCurrent = first;
-				
-				for(++iNext; iNext != last; iCurrent = iNext, ++iNext) 
-				{
-					if(compare(*iNext, *iCurrent))
-					{
-						EASTL_VALIDATE_COMPARE(!compare(*iCurrent, *iNext)); // Validate that the compare function is sane.
-						eastl::iter_swap(iCurrent, iNext);
-					}
-				}
-				last = iCurrent;
-			}
+		const difference_type n       = last - first;
+		const size_t          nChunks = Internal::parallel_sort_chunk_count(scheduler, n);
+
+		if(nChunks < 2)
+		{
+			eastl::merge_sort_buffer<RandomAccessIterator, T, StrictWeakOrdering>(first, last, pBuffer, compare);
+			return;
 		}
 
-		template <typename BidirectionalIterator, typename StrictWeakOrdering>
-		void bubble_sort_impl(BidirectionalIterator first, BidirectionalIterator last, StrictWeakOrdering compare, EASTL_ITC_NS::bidirectional_iterator_tag)
+		difference_type runBounds[Internal::kParallelSortMaxChunks + 1];
+		size_t          nRuns = nChunks;
+
+		for(size_t i = 0; i <= nChunks; ++i)
+			runBounds[i] = Internal::parallel_chunk_begin(n, nChunks, i);
+
+		auto sortChunk = [&](size_t i)
 		{
-			if(first != last)
-			{
-				BidirectionalIterator iCurrent, iNext, iLastModified;
+			eastl::merge_sort_buffer<RandomAccessIterator, T, StrictWeakOrdering>(first + runBounds[i], first + runBounds[i + 1], pBuffer + runBounds[i], compare);
+		};
+		Internal::parallel_for(scheduler, nChunks, sortChunk);
 
-				last--;
+		bool bInBuffer = false;
 
-				while(first != last)
-				{
-					iLastModified = iNext = iCurrent = first;
-					
-					for(++iNext; iCurrent != last; iCurrent = iNext, ++iNext)
-					{
-						if(compare(*iNext, *iCurrent))
-						{
-							EASTL_VALIDATE_COMPARE(!compare(*iCurrent, *iNext)); // Validate that the compare function is sane.
-							iLastModified = iCurrent;
-							eastl::iter_swap(iCurrent, iNext);
-						}
-					}
+		while(nRuns > 1)
+		{
+			if(bInBuffer)
+				Internal::parallel_merge_runs(scheduler, pBuffer, first, n, runBounds, nRuns, nChunks, compare);
+			else
+				Internal::parallel_merge_runs(scheduler, first, pBuffer, n, runBounds, nRuns, nChunks, compare);
 
-					last = iLastModified;
-				}
-			}
+			bInBuffer = !bInBuffer;
+
+			for(size_t i = 0; (i * 2) < nRuns; ++i)
+				runBounds[i] = runBounds[i * 2];
+			nRuns = (nRuns + 1) / 2;
+			runBounds[nRuns] = n;
 		}
-	} // namespace Internal
 
-	template <typename ForwardIterator, typename StrictWeakOrdering>
-	inline void bubble_sort(ForwardIterator first, ForwardIterator last, StrictWeakOrdering compare)
-	{
-		typedef typename eastl::iterator_traits<ForwardIterator>::iterator_category IC;
+		if(bInBuffer)
+		{
+			auto copyChunk = [&](size_t i)
+			{
+				const difference_type chunkBegin = Internal::parallel_chunk_begin(n, nChunks, i);
+				const difference_type chunkEnd   = Internal::parallel_chunk_begin(n, nChunks, i + 1);
 
-		eastl::Internal::bubble_sort_impl<ForwardIterator, StrictWeakOrdering>(first, last, compare, IC());
+				eastl::copy(pBuffer + chunkBegin, pBuffer + chunkEnd, first + chunkBegin);
+			};
+			Internal::parallel_for(scheduler, nChunks, copyChunk);
+		}
 	}
 
-	template <typename ForwardIterator>
-	inline void bubble_sort(ForwardIterator first, ForwardIterator last)
+	template <typename RandomAccessIterator, typename T>
+	inline void stable_sort(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator last, T* pBuffer)
 	{
-		typedef eastl::less<typename eastl::iterator_traits<ForwardIterator>::value_type> Less;
-		typedef typename eastl::iterator_traits<ForwardIterator>::iterator_category IC;
+		typedef eastl::less<typename eastl::iterator_traits<RandomAccessIterator>::value_type> Less;
 
-		eastl::Internal::bubble_sort_impl<ForwardIterator, Less>(first, last, Less(), IC());
+		eastl::stable_sort<RandomAccessIterator, T, Less>(scheduler, first, last, pBuffer, Less());
 	}
 
 
-
-	/// sort
-	/// 
-	/// We use quick_sort by default. See quick_sort for details.
-	///
-	/// EASTL_DEFAULT_SORT_FUNCTION
-	/// If a default sort function is specified then call it, otherwise use EASTL's default quick_sort.
-	/// EASTL_DEFAULT_SORT_FUNCTION must be namespace-qualified and include any necessary template
-	/// parameters (e.g. eastl::comb_sort instead of just comb_sort), and it must be visible to this code. 
-	/// The EASTL_DEFAULT_SORT_FUNCTION must be provided in two versions: 
-	///     template <typename RandomAccessIterator>
-	///     void EASTL_DEFAULT_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last);
+	/// radix_sort
 	///
-	///     template <typename RandomAccessIterator, typename Compare>
-	///     void EASTL_DEFAULT_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	/// Parallel version of radix_sort. This is a stable sort.
+	/// buffer must refer to (last - first) elements, as with the serial version, and the
+	/// result ends up in [first, last). For each digit, every chunk counts its keys in
+	/// parallel; the counts are combined into per-chunk bucket positions, and then every
+	/// chunk scatters its elements into the other buffer in parallel.
 	///
-	template <typename RandomAccessIterator>
-	inline void sort(RandomAccessIterator first, RandomAccessIterator last)
+	template <typename RandomAccessIterator, typename ExtractKey, int DigitBits = 8>
+	void radix_sort(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator buffer)
 	{
-		#if defined(EASTL_DEFAULT_SORT_FUNCTION)
-			EASTL_DEFAULT_SORT_FUNCTION(first, last);
-		#else
-			eastl::quick_sort<RandomAccessIterator>(first, last);
-		#endif
+		static_assert(DigitBits > 0, "DigitBits must be > 0");
+		static_assert(DigitBits <= (sizeof(typename ExtractKey::radix_type) * 8), "DigitBits must be <= the size of the key (in bits)");
+
+		const size_t nChunks = Internal::parallel_sort_chunk_count(scheduler, last - first);
+
+		if(nChunks < 2)
+			eastl::radix_sort<RandomAccessIterator, ExtractKey, DigitBits>(first, last, buffer);
+		else
+			eastl::Internal::parallel_radix_sort_impl<RandomAccessIterator, ExtractKey, DigitBits>(scheduler, first, last, buffer, nChunks, typename ExtractKey::radix_type());
 	}
 
+
+	/// nth_element
+	///
+	/// Parallel version of nth_element. 
+	/// Large ranges are narrowed down with parallel partitions until the range containing
+	/// nth is small enough for the serial nth_element.
+	///
 	template <typename RandomAccessIterator, typename Compare>
-	inline void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	void nth_element(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare)
 	{
-		#if defined(EASTL_DEFAULT_SORT_FUNCTION)
-			EASTL_DEFAULT_SORT_FUNCTION(first, last, compare);
-		#else
-			eastl::quick_sort<RandomAccessIterator, Compare>(first, last, compare);
-		#endif
+		typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		while(Internal::parallel_sort_chunk_count(scheduler, last - first) > 1)
+		{
+			const value_type     pivot(Internal::parallel_sort_pivot<RandomAccessIterator, Compare>(first, last, compare));
+			auto                 isLess = [&](const value_type& x) { return compare(x, pivot); };
+			RandomAccessIterator middle = Internal::parallel_partition(scheduler, first, last, isLess);
+
+			if(middle == first)
+			{
+				// The pivot is the smallest value. The elements equivalent to it are in their final place once gathered.
+				auto isNotGreater = [&](const value_type& x) { return !compare(pivot, x); };
+				middle = Internal::parallel_partition(scheduler, first, last, isNotGreater);
+
+				if(nth < middle)
+					return;
+				first = middle;
+			}
+			else if(nth < middle)
+				last = middle;
+			else
+				first = middle;
+		}
+
+		eastl::nth_element<RandomAccessIterator, Compare>(first, nth, last, compare);
 	}
 
+	template <typename RandomAccessIterator>
+	inline void nth_element(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+	{
+		typedef eastl::less<typename eastl::iterator_traits<RandomAccessIterator>::value_type> Less;
+
+		eastl::nth_element<RandomAccessIterator, Less>(scheduler, first, nth, last, Less());
+	}
 
 
-	/// stable_sort
-	/// 
-	/// We use merge_sort by default. See merge_sort for details.
-	/// Beware that the used merge_sort -- and thus stable_sort -- allocates 
-	/// memory during execution. Try using merge_sort_buffer if you want
-	/// to avoid memory allocation.
-	///
-	/// EASTL_DEFAULT_STABLE_SORT_FUNCTION
-	/// If a default sort function is specified then call it, otherwise use EASTL's default merge_sort.
-	/// EASTL_DEFAULT_STABLE_SORT_FUNCTION must be namespace-qualified and include any necessary template
-	/// parameters (e.g. eastl::tim_sort instead of just tim_sort), and it must be visible to this code. 
-	/// The EASTL_DEFAULT_STABLE_SORT_FUNCTION must be provided in three versions, though the third
-	/// allocation implementation may choose to ignore the allocator parameter: 
-	///     template <typename RandomAccessIterator, typename StrictWeakOrdering>
-	///     void EASTL_DEFAULT_STABLE_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering compare);
-	///     
-	///     template <typename RandomAccessIterator>
-	///     void EASTL_DEFAULT_STABLE_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last);
+	/// partial_sort
 	///
-	///     template <typename RandomAccessIterator, typename Allocator, typename StrictWeakOrdering>
-	///     void EASTL_DEFAULT_STABLE_SORT_FUNCTION(RandomAccessIterator first, RandomAccessIterator last, Allocator& allocator, StrictWeakOrdering compare);
+	/// Parallel version of partial_sort. This is an unstable sort.
+	/// Selects the smallest (middle - first) elements with the parallel nth_element and
+	/// then sorts them with the parallel sort.
 	///
-	template <typename RandomAccessIterator, typename StrictWeakOrdering>
-	void stable_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering compare)
+	template <typename RandomAccessIterator, typename Compare>
+	void partial_sort(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare compare)
 	{
-		#if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
-			EASTL_DEFAULT_STABLE_SORT_FUNCTION(first, last, *get_default_allocator(0), compare);
-		#else
-			eastl::merge_sort<RandomAccessIterator, EASTLAllocatorType, StrictWeakOrdering>
-							 (first, last, *get_default_allocator(0), compare);
-		#endif
+		if(Internal::parallel_sort_chunk_count(scheduler, last - first) < 2)
+			eastl::partial_sort<RandomAccessIterator, Compare>(first, middle, last, compare);
+		else if(first != middle)
+		{
+			if(middle != last)
+				eastl::nth_element<RandomAccessIterator, Compare>(scheduler, first, middle, last, compare);
+
+			eastl::sort<RandomAccessIterator, Compare>(scheduler, first, middle, compare);
+		}
 	}
 
 	template <typename RandomAccessIterator>
-	void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+	inline void partial_sort(task_scheduler& scheduler, RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
 	{
-		#if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
-			EASTL_DEFAULT_STABLE_SORT_FUNCTION(first, last, *get_default_allocator(0));
-		#else
-			eastl::merge_sort<RandomAccessIterator, EASTLAllocatorType>
-							 (first, last, *get_default_allocator(0));
-		#endif
-	}
+		typedef eastl::less<typename eastl::iterator_traits<RandomAccessIterator>::value_type> Less;
 
-	template <typename RandomAccessIterator, typename Allocator, typename StrictWeakOrdering>
-	void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Allocator& allocator, StrictWeakOrdering compare)
-	{
-		#if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
-			EASTL_DEFAULT_STABLE_SORT_FUNCTION(first, last, allocator, compare);
-		#else
-			eastl::merge_sort<RandomAccessIterator, Allocator, StrictWeakOrdering>(first, last, allocator, compare);
-		#endif
+		eastl::partial_sort<RandomAccessIterator, Less>(scheduler, first, middle, last, Less());
 	}
 
-	// This is not defined because it would cause compiler errors due to conflicts with a version above. 
-	//template <typename RandomAccessIterator, typename Allocator>
-	//void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Allocator& allocator)
-	//{
-	//    #if defined(EASTL_DEFAULT_STABLE_SORT_FUNCTION)
-	//        EASTL_DEFAULT_STABLE_SORT_FUNCTION<RandomAccessIterator, Allocator>(first, last, allocator);
-	//    #else
-	//        eastl::merge_sort<RandomAccessIterator, Allocator>(first, last, allocator);
-	//    #endif
-	//}
-
 
 
 
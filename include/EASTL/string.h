@@ -2642,7 +2642,7 @@ namespace eastl
 
 		if(EASTL_LIKELY(((npos - n) >= position) && (position + n) <= internalLayout().GetSize())) // If the range is valid...
 		{
-			const value_type* const pTemp = eastl::search(internalLayout().BeginPtr() + position, internalLayout().EndPtr(), p, p + n);
+			const value_type* const pTemp = CharTypeStringSearch(internalLayout().BeginPtr() + position, internalLayout().EndPtr(), p, p + n);
 
 			if((pTemp != internalLayout().EndPtr()) || (n == 0))
 				return (size_type)(pTemp - internalLayout().BeginPtr());
@@ -2664,7 +2664,7 @@ namespace eastl
 
 		if(EASTL_LIKELY(position < internalLayout().GetSize()))// If the position is valid...
 		{
-			const const_iterator pResult = eastl::find(internalLayout().BeginPtr() + position, internalLayout().EndPtr(), c);
+			const const_iterator pResult = eastl::CharTypeStringFind(internalLayout().BeginPtr() + position, internalLayout().EndPtr(), c);
 
 			if(pResult != internalLayout().EndPtr())
 				return (size_type)(pResult - internalLayout().BeginPtr());
@@ -2866,7 +2866,6 @@ namespace eastl
 	{
 		if(EASTL_LIKELY(position <= internalLayout().GetSize()))
 		{
-			// Todo: Possibly make a specialized version of CharTypeStringFindFirstNotOf(pBegin, pEnd, c).
 			const const_iterator pResult =
 			    CharTypeStringFindFirstNotOf(internalLayout().BeginPtr() + position, internalLayout().EndPtr(), &c, &c + 1);
 
@@ -2919,7 +2918,6 @@ namespace eastl
 
 		if(EASTL_LIKELY(nLength))
 		{
-			// Todo: Possibly make a specialized version of CharTypeStringRFindFirstNotOf(pBegin, pEnd, c).
 			const value_type* const pEnd    = internalLayout().BeginPtr() + eastl::min_alt(nLength - 1, position) + 1;
 			const value_type* const pResult = CharTypeStringRFindFirstNotOf(pEnd, internalLayout().BeginPtr(), &c, &c + 1);
 
@@ -3338,81 +3336,32 @@ namespace eastl
 	// Specialized char version of STL find() from back function.
 	// Not the same as RFind because search range is specified as forward iterators.
 	template <typename T, typename Allocator>
-	const typename basic_string<T, Allocator>::value_type*
+	inline const typename basic_string<T, Allocator>::value_type*
 	basic_string<T, Allocator>::CharTypeStringFindEnd(const value_type* pBegin, const value_type* pEnd, value_type c)
 	{
-		const value_type* pTemp = pEnd;
-		while(--pTemp >= pBegin)
-		{
-			if(*pTemp == c)
-				return pTemp;
-		}
-
-		return pEnd;
+		return eastl::CharTypeStringFindEnd(pBegin, pEnd, c);
 	}
 
 
 	// CharTypeStringRFind
 	// Specialized value_type version of STL find() function in reverse.
 	template <typename T, typename Allocator>
-	const typename basic_string<T, Allocator>::value_type*
+	inline const typename basic_string<T, Allocator>::value_type*
 	basic_string<T, Allocator>::CharTypeStringRFind(const value_type* pRBegin, const value_type* pREnd, const value_type c)
 	{
-		while(pRBegin > pREnd)
-		{
-			if(*(pRBegin - 1) == c)
-				return pRBegin;
-			--pRBegin;
-		}
-		return pREnd;
+		return eastl::CharTypeStringRFind(pRBegin, pREnd, c);
 	}
 
 
 	// CharTypeStringSearch
 	// Specialized value_type version of STL search() function.
-	// Purpose: find p2 within p1. Return p1End if not found or if either string is zero length.
+	// Purpose: find p2 within p1. Return p1End if not found, or p1Begin if p2 is zero length.
 	template <typename T, typename Allocator>
-	const typename basic_string<T, Allocator>::value_type*
+	inline const typename basic_string<T, Allocator>::value_type*
 	basic_string<T, Allocator>::CharTypeStringSearch(const value_type* p1Begin, const value_type* p1End,
 													 const value_type* p2Begin, const value_type* p2End)
 	{
-		// Test for zero length strings, in which case we have a match or a failure,
-		// but the return value is the same either way.
-		if((p1Begin == p1End) || (p2Begin == p2End))
-			return p1Begin;
-
-		// Test for a pattern of length 1.
-		if((p2Begin + 1) == p2End)
-			return eastl::find(p1Begin, p1End, *p2Begin);
-
-		// General case.
-		const value_type* pTemp;
-		const value_type* pTemp1 = (p2Begin + 1);
-		const value_type* pCurrent = p1Begin;
-
-		while(p1Begin != p1End)
-		{
-			p1Begin = eastl::find(p1Begin, p1End, *p2Begin);
-			if(p1Begin == p1End)
-				return p1End;
-
-			pTemp = pTemp1;
-			pCurrent = p1Begin;
-			if(++pCurrent == p1End)
-				return p1End;
-
-			while(*pCurrent == *pTemp)
-			{
-				if(++pTemp == p2End)
-					return p1Begin;
-				if(++pCurrent == p1End)
-					return p1End;
-			}
-
-			++p1Begin;
-		}
-
-		return p1Begin;
+		return eastl::CharTypeStringSearch(p1Begin, p1End, p2Begin, p2End);
 	}
 
 
@@ -3420,49 +3369,11 @@ namespace eastl
 	// Specialized value_type version of STL find_end() function (which really is a reverse search function).
 	// Purpose: find last instance of p2 within p1. Return p1End if not found or if either string is zero length.
 	template <typename T, typename Allocator>
-	const typename basic_string<T, Allocator>::value_type*
+	inline const typename basic_string<T, Allocator>::value_type*
 	basic_string<T, Allocator>::CharTypeStringRSearch(const value_type* p1Begin, const value_type* p1End,
 													  const value_type* p2Begin, const value_type* p2End)
 	{
-		// Test for zero length strings, in which case we have a match or a failure,
-		// but the return value is the same either way.
-		if((p1Begin == p1End) || (p2Begin == p2End))
-			return p1Begin;
-
-		// Test for a pattern of length 1.
-		if((p2Begin + 1) == p2End)
-			return CharTypeStringFindEnd(p1Begin, p1End, *p2Begin);
-
-		// Test for search string length being longer than string length.
-		if((p2End - p2Begin) > (p1End - p1Begin))
-			return p1End;
-
-		// General case.
-		const value_type* pSearchEnd = (p1End - (p2End - p2Begin) + 1);
-		const value_type* pCurrent1;
-		const value_type* pCurrent2;
-
-		while(pSearchEnd != p1Begin)
-		{
-			// Search for the last occurrence of *p2Begin.
-			pCurrent1 = CharTypeStringFindEnd(p1Begin, pSearchEnd, *p2Begin);
-			if(pCurrent1 == pSearchEnd) // If the first char of p2 wasn't found,
-				return p1End;           // then we immediately have failure.
-
-			// In this case, *pTemp == *p2Begin. So compare the rest.
-			pCurrent2 = p2Begin;
-			while(*pCurrent1++ == *pCurrent2++)
-			{
-				if(pCurrent2 == p2End)
-					return (pCurrent1 - (p2End - p2Begin));
-			}
-
-			// A smarter algorithm might know to subtract more than just one,
-			// but in most cases it won't make much difference anyway.
-			--pSearchEnd;
-		}
-
-		return p1End;
+		return eastl::CharTypeStringRSearch(p1Begin, p1End, p2Begin, p2End);
 	}
 
 
@@ -3470,19 +3381,11 @@ namespace eastl
 	// Specialized value_type version of STL find_first_of() function.
 	// This function is much like the C runtime strtok function, except the strings aren't null-terminated.
 	template <typename T, typename Allocator>
-	const typename basic_string<T, Allocator>::value_type*
+	inline const typename basic_string<T, Allocator>::value_type*
 	basic_string<T, Allocator>::CharTypeStringFindFirstOf(const value_type* p1Begin, const value_type* p1End,
 														  const value_type* p2Begin, const value_type* p2End)
 	{
-		for( ; p1Begin != p1End; ++p1Begin)
-		{
-			for(const value_type* pTemp = p2Begin; pTemp != p2End; ++pTemp)
-			{
-				if(*p1Begin == *pTemp)
-					return p1Begin;
-			}
-		}
-		return p1End;
+		return eastl::CharTypeStringFindFirstOf(p1Begin, p1End, p2Begin, p2End);
 	}
 
 
@@ -3490,64 +3393,33 @@ namespace eastl
 	// Specialized value_type version of STL find_first_of() function in reverse.
 	// This function is much like the C runtime strtok function, except the strings aren't null-terminated.
 	template <typename T, typename Allocator>
-	const typename basic_string<T, Allocator>::value_type*
+	inline const typename basic_string<T, Allocator>::value_type*
 	basic_string<T, Allocator>::CharTypeStringRFindFirstOf(const value_type* p1RBegin, const value_type* p1REnd,
 														   const value_type* p2Begin,  const value_type* p2End)
 	{
-		for( ; p1RBegin != p1REnd; --p1RBegin)
-		{
-			for(const value_type* pTemp = p2Begin; pTemp != p2End; ++pTemp)
-			{
-				if(*(p1RBegin - 1) == *pTemp)
-					return p1RBegin;
-			}
-		}
-		return p1REnd;
+		return eastl::CharTypeStringRFindFirstOf(p1RBegin, p1REnd, p2Begin, p2End);
 	}
 
 
-
 	// CharTypeStringFindFirstNotOf
 	// Specialized value_type version of STL find_first_not_of() function.
 	template <typename T, typename Allocator>
-	const typename basic_string<T, Allocator>::value_type*
+	inline const typename basic_string<T, Allocator>::value_type*
 	basic_string<T, Allocator>::CharTypeStringFindFirstNotOf(const value_type* p1Begin, const value_type* p1End,
 															 const value_type* p2Begin, const value_type* p2End)
 	{
-		for( ; p1Begin != p1End; ++p1Begin)
-		{
-			const value_type* pTemp;
-			for(pTemp = p2Begin; pTemp != p2End; ++pTemp)
-			{
-				if(*p1Begin == *pTemp)
-					break;
-			}
-			if(pTemp == p2End)
-				return p1Begin;
-		}
-		return p1End;
+		return eastl::CharTypeStringFindFirstNotOf(p1Begin, p1End, p2Begin, p2End);
 	}
 
 
 	// CharTypeStringRFindFirstNotOf
 	// Specialized value_type version of STL find_first_not_of() function in reverse.
 	template <typename T, typename Allocator>
-	const typename basic_string<T, Allocator>::value_type*
+	inline const typename basic_string<T, Allocator>::value_type*
 	basic_string<T, Allocator>::CharTypeStringRFindFirstNotOf(const value_type* p1RBegin, const value_type* p1REnd,
 															  const value_type* p2Begin,  const value_type* p2End)
 	{
-		for( ; p1RBegin != p1REnd; --p1RBegin)
-		{
-			const value_type* pTemp;
-			for(pTemp = p2Begin; pTemp != p2End; ++pTemp)
-			{
-				if(*(p1RBegin-1) == *pTemp)
-					break;
-			}
-			if(pTemp == p2End)
-				return p1RBegin;
-		}
-		return p1REnd;
+		return eastl::CharTypeStringRFindFirstNotOf(p1RBegin, p1REnd, p2Begin, p2End);
 	}
 
 
@@ -3876,11 +3748,15 @@ namespace eastl
 	{
 		size_t operator()(const string& x) const
 		{
-			const unsigned char* p = (const unsigned char*)x.c_str(); // To consider: limit p to at most 256 chars.
-			unsigned int c, result = 2166136261U; // We implement an FNV-like string hash.
-			while((c = *p++) != 0) // Using '!=' disables compiler warnings.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				const unsigned char* p = (const unsigned char*)x.c_str(); // To consider: limit p to at most 256 chars.
+				unsigned int c, result = 2166136261U; // We implement an FNV-like string hash.
+				while((c = *p++) != 0) // Using '!=' disables compiler warnings.
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(x.data(), x.size());
+			#endif
 		}
 	};
 
@@ -3889,11 +3765,15 @@ namespace eastl
 	{
 		size_t operator()(const string16& x) const
 		{
-			const char16_t* p = x.c_str();
-			unsigned int c, result = 2166136261U;
-			while((c = *p++) != 0)
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				const char16_t* p = x.c_str();
+				unsigned int c, result = 2166136261U;
+				while((c = *p++) != 0)
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(x.data(), x.size());
+			#endif
 		}
 	};
 
@@ -3902,11 +3782,15 @@ namespace eastl
 	{
 		size_t operator()(const string32& x) const
 		{
-			const char32_t* p = x.c_str();
-			unsigned int c, result = 2166136261U;
-			while((c = (unsigned int)*p++) != 0)
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				const char32_t* p = x.c_str();
+				unsigned int c, result = 2166136261U;
+				while((c = (unsigned int)*p++) != 0)
+					result = (result * 16777619) ^ c;
+				return (size_t)result;
+			#else
+				return Internal::HashString(x.data(), x.size());
+			#endif
 		}
 	};
 
@@ -3916,11 +3800,15 @@ namespace eastl
 		{
 			size_t operator()(const wstring& x) const
 			{
-				const wchar_t* p = x.c_str();
-				unsigned int c, result = 2166136261U;
-				while((c = (unsigned int)*p++) != 0)
-					result = (result * 16777619) ^ c;
-				return (size_t)result;
+				#if EASTL_STRING_HASH_LEGACY
+					const wchar_t* p = x.c_str();
+					unsigned int c, result = 2166136261U;
+					while((c = (unsigned int)*p++) != 0)
+						result = (result * 16777619) ^ c;
+					return (size_t)result;
+				#else
+					return Internal::HashString(x.data(), x.size());
+				#endif
 			}
 		};
 	#endif
@@ -18,7 +18,9 @@
 
 #include <EASTL/internal/config.h>
 #include <EASTL/internal/char_traits.h>
+#include <EASTL/internal/hash_bytes.h>
 #include <EASTL/numeric_limits.h>
+#include <EASTL/type_traits.h>
 
 EA_DISABLE_VC_WARNING(4814)
 
@@ -206,7 +208,7 @@ namespace eastl
 			auto* pEnd = mpBegin + mnCount;
 			if (EASTL_LIKELY(((npos - sw.size()) >= pos) && (pos + sw.size()) <= mnCount))
 			{
-				const value_type* const pTemp = eastl::search(mpBegin + pos, pEnd, sw.data(), sw.data() + sw.size());
+				const value_type* const pTemp = CharTypeStringSearch(mpBegin + pos, pEnd, sw.data(), sw.data() + sw.size());
 
 				if ((pTemp != pEnd) || (sw.size() == 0))
 					return (size_type)(pTemp - mpBegin);
@@ -282,7 +284,7 @@ namespace eastl
 
 		EA_CONSTEXPR size_type find_first_of(basic_string_view sw, size_type pos = 0) const EA_NOEXCEPT
 		{
-			return find_first_of(sw.mpBegin, pos, mnCount);
+			return find_first_of(sw.mpBegin, pos, sw.mnCount);
 		}
 
 		EA_CONSTEXPR size_type find_first_of(T c, size_type pos = 0) const EA_NOEXCEPT { return find(c, pos); }
@@ -343,7 +345,6 @@ namespace eastl
 			if (EASTL_LIKELY(pos <= mnCount))
 			{
 				const auto pEnd = mpBegin + mnCount;
-				// Todo: Possibly make a specialized version of CharTypeStringFindFirstNotOf(pBegin, pEnd, c).
 				const const_iterator pResult = CharTypeStringFindFirstNotOf(mpBegin + pos, pEnd, &c, &c + 1);
 
 				if (pResult != pEnd)
@@ -379,7 +380,6 @@ namespace eastl
 		{
 			if (EASTL_LIKELY(mnCount))
 			{
-				// Todo: Possibly make a specialized version of CharTypeStringRFindFirstNotOf(pBegin, pEnd, c).
 				const value_type* const pEnd = mpBegin + eastl::min_alt(mnCount - 1, pos) + 1;
 				const value_type* const pResult = CharTypeStringRFindFirstNotOf(pEnd, mpBegin, &c, &c + 1);
 
@@ -478,6 +478,85 @@ namespace eastl
 		return !(lhs < rhs);
 	}
 
+	// The following overloads allow a basic_string_view to be compared with any object which
+	// is implicitly convertible to it (e.g. a basic_string or a character pointer), as
+	// required by the C++17 Standard. One of the two parameters is a non-deduced context
+	// so that template argument deduction succeeds with only the other. This in particular
+	// is what allows string_view lookups in containers of strings which use less<void>
+	// or equal_to<void>.
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator==(basic_string_view<CharT> lhs, typename eastl::decay<basic_string_view<CharT> >::type rhs)
+	{
+		return (lhs.size() == rhs.size()) && (lhs.compare(rhs) == 0);
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator==(typename eastl::decay<basic_string_view<CharT> >::type lhs, basic_string_view<CharT> rhs)
+	{
+		return (lhs.size() == rhs.size()) && (lhs.compare(rhs) == 0);
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator!=(basic_string_view<CharT> lhs, typename eastl::decay<basic_string_view<CharT> >::type rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator!=(typename eastl::decay<basic_string_view<CharT> >::type lhs, basic_string_view<CharT> rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator<(basic_string_view<CharT> lhs, typename eastl::decay<basic_string_view<CharT> >::type rhs)
+	{
+		return lhs.compare(rhs) < 0;
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator<(typename eastl::decay<basic_string_view<CharT> >::type lhs, basic_string_view<CharT> rhs)
+	{
+		return lhs.compare(rhs) < 0;
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator<=(basic_string_view<CharT> lhs, typename eastl::decay<basic_string_view<CharT> >::type rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator<=(typename eastl::decay<basic_string_view<CharT> >::type lhs, basic_string_view<CharT> rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator>(basic_string_view<CharT> lhs, typename eastl::decay<basic_string_view<CharT> >::type rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator>(typename eastl::decay<basic_string_view<CharT> >::type lhs, basic_string_view<CharT> rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator>=(basic_string_view<CharT> lhs, typename eastl::decay<basic_string_view<CharT> >::type rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	template <class CharT>
+	inline EA_CONSTEXPR bool operator>=(typename eastl::decay<basic_string_view<CharT> >::type lhs, basic_string_view<CharT> rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+
 	// string_view / wstring_view 
 	typedef basic_string_view<char> string_view;
 	typedef basic_string_view<wchar_t> wstring_view;
@@ -496,58 +575,89 @@ namespace eastl
 	///    #include <EASTL/hash_set.h>
 	///    hash_set<string_view> stringHashSet;
 	///
+	/// The view hashes are transparent (i.e. they define is_transparent) and hash strings
+	/// and character pointers to the same value as the equivalent view. Together with
+	/// equal_to<void> this allows a container of strings to be searched by string_view
+	/// or character pointer without constructing a temporary string:
+	///    hash_set<string, hash<string_view>, equal_to<void>> stringHashSet;
+	///    stringHashSet.find(string_view("hello"));
+	///
 	template <typename T> struct hash;
 
 	template<> struct hash<string_view>
 	{
+		typedef int is_transparent;
+
 		size_t operator()(const string_view& x) const
 		{
-			string_view::const_iterator p = x.cbegin();
-			string_view::const_iterator end = x.cend();
-			uint32_t result = 2166136261U; // We implement an FNV-like string hash.
-			while (p != end)
-				result = (result * 16777619) ^ (uint8_t)*p++;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				string_view::const_iterator p = x.cbegin();
+				string_view::const_iterator end = x.cend();
+				uint32_t result = 2166136261U; // We implement an FNV-like string hash.
+				while (p != end)
+					result = (result * 16777619) ^ (uint8_t)*p++;
+				return (size_t)result;
+			#else
+				return Internal::HashString(x.data(), x.size());
+			#endif
 		}
 	};
 
 	template<> struct hash<u16string_view>
 	{
+		typedef int is_transparent;
+
 		size_t operator()(const u16string_view& x) const
 		{
-			u16string_view::const_iterator p = x.cbegin();
-			u16string_view::const_iterator end = x.cend();
-			uint32_t result = 2166136261U;
-			while (p != end)
-				result = (result * 16777619) ^ (uint16_t)*p++;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				u16string_view::const_iterator p = x.cbegin();
+				u16string_view::const_iterator end = x.cend();
+				uint32_t result = 2166136261U;
+				while (p != end)
+					result = (result * 16777619) ^ (uint16_t)*p++;
+				return (size_t)result;
+			#else
+				return Internal::HashString(x.data(), x.size());
+			#endif
 		}
 	};
 
 	template<> struct hash<u32string_view>
 	{
+		typedef int is_transparent;
+
 		size_t operator()(const u32string_view& x) const
 		{
-			u32string_view::const_iterator p = x.cbegin();
-			u32string_view::const_iterator end = x.cend();
-			uint32_t result = 2166136261U;
-			while (p != end)
-				result = (result * 16777619) ^ (uint32_t)*p++;
-			return (size_t)result;
+			#if EASTL_STRING_HASH_LEGACY
+				u32string_view::const_iterator p = x.cbegin();
+				u32string_view::const_iterator end = x.cend();
+				uint32_t result = 2166136261U;
+				while (p != end)
+					result = (result * 16777619) ^ (uint32_t)*p++;
+				return (size_t)result;
+			#else
+				return Internal::HashString(x.data(), x.size());
+			#endif
 		}
 	};
 
 	#if defined(EA_WCHAR_UNIQUE) && EA_WCHAR_UNIQUE
 		template<> struct hash<wstring_view>
 		{
+			typedef int is_transparent;
+
 			size_t operator()(const wstring_view& x) const
 			{
-				wstring_view::const_iterator p = x.cbegin();
-				wstring_view::const_iterator end = x.cend();
-				uint32_t result = 2166136261U;
-				while (p != end)
-					result = (result * 16777619) ^ (uint32_t)*p++;
-				return (size_t)result;
+				#if EASTL_STRING_HASH_LEGACY
+					wstring_view::const_iterator p = x.cbegin();
+					wstring_view::const_iterator end = x.cend();
+					uint32_t result = 2166136261U;
+					while (p != end)
+						result = (result * 16777619) ^ (uint32_t)*p++;
+					return (size_t)result;
+				#else
+					return Internal::HashString(x.data(), x.size());
+				#endif
 			}
 		};
 	#endif
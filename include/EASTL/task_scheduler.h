@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file defines the task_scheduler interface used by the parallel
+// algorithms (e.g. the task_scheduler overloads of sort, stable_sort and
+// radix_sort in sort.h). EASTL doesn't own any threads by itself; a parallel
+// algorithm is handed a task_scheduler and asks it to execute a batch of
+// independent tasks. Users who already have a job system implement the
+// interface on top of it, while everybody else can use the provided
+// default_task_scheduler, which is a small std::thread based pool.
+//
+// Example usage:
+//     eastl::default_task_scheduler scheduler;          // One worker per hardware thread, minus the calling thread.
+//     eastl::sort(scheduler, v.begin(), v.end());
+//
+//     eastl::sort(eastl::GetDefaultTaskScheduler(), v.begin(), v.end());
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_TASK_SCHEDULER_H
+#define EASTL_TASK_SCHEDULER_H
+
+
+#include <EASTL/internal/config.h>
+#include <stddef.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_DEFAULT_TASK_SCHEDULER_ENABLED
+//
+// Defined as 0 or 1. Identifies whether default_task_scheduler (which needs
+// std::thread, std::mutex and std::condition_variable) is available. When it
+// is not, GetDefaultTaskScheduler returns a serial_task_scheduler.
+///////////////////////////////////////////////////////////////////////////////
+
+#if !defined(EASTL_DEFAULT_TASK_SCHEDULER_ENABLED)
+	#if defined(EA_HAVE_CPP11_THREAD) && defined(EA_HAVE_CPP11_MUTEX) && defined(EA_HAVE_CPP11_CONDITION_VARIABLE)
+		#define EASTL_DEFAULT_TASK_SCHEDULER_ENABLED 1
+	#else
+		#define EASTL_DEFAULT_TASK_SCHEDULER_ENABLED 0
+	#endif
+#endif
+
+
+namespace eastl
+{
+
+	/// task_scheduler
+	///
+	/// Abstract interface through which the parallel algorithms execute work.
+	///
+	/// run(pFunction, pContext, count) calls pFunction(pContext, i) exactly once for
+	/// each i in [0, count), possibly concurrently and in any order, and returns
+	/// only after all of the calls have completed. The calling thread is expected
+	/// to take part in the execution. Implementations must support nested calls:
+	/// a task may itself call run on the same scheduler, so a thread that waits
+	/// for its batch to complete has to keep executing pending tasks rather than
+	/// simply block, or a pool could deadlock with all of its threads waiting.
+	///
+	/// Task functions must not throw.
+	///
+	class EASTL_API task_scheduler
+	{
+	public:
+		typedef void (*task_function)(void* pContext, size_t index);
+
+		virtual ~task_scheduler() {}
+
+		/// Returns the number of threads that can execute tasks concurrently, including the calling thread.
+		/// The parallel algorithms use this to decide how finely to divide their work. Must be >= 1.
+		virtual size_t concurrency() const = 0;
+
+		virtual void run(task_function pFunction, void* pContext, size_t count) = 0;
+	};
+
+
+	/// serial_task_scheduler
+	///
+	/// Executes every task on the calling thread, in index order.
+	/// Useful for debugging and for platforms without thread support.
+	///
+	class EASTL_API serial_task_scheduler : public task_scheduler
+	{
+	public:
+		size_t concurrency() const EA_OVERRIDE
+			{ return 1; }
+
+		void run(task_function pFunction, void* pContext, size_t count) EA_OVERRIDE
+		{
+			for(size_t i = 0; i < count; ++i)
+				pFunction(pContext, i);
+		}
+	};
+
+
+	#if EASTL_DEFAULT_TASK_SCHEDULER_ENABLED
+		/// default_task_scheduler
+		///
+		/// A std::thread based pool of worker threads. Each call to run publishes its batch
+		/// and then executes tasks from it on the calling thread; idle workers steal task
+		/// indices from any published batch, newest batch first, so that the nested batches
+		/// created by recursive algorithms are drained before their parents. A thread that
+		/// waits for its batch to finish helps with other pending batches in the meantime.
+		///
+		/// threadCount is the number of worker threads to create. The default of 0 means
+		/// one less than the number of hardware threads, as the calling thread participates.
+		///
+		class EASTL_API default_task_scheduler : public task_scheduler
+		{
+		public:
+			explicit default_task_scheduler(size_t threadCount = 0);
+		   ~default_task_scheduler();
+
+			size_t concurrency() const EA_OVERRIDE;
+			void   run(task_function pFunction, void* pContext, size_t count) EA_OVERRIDE;
+
+		protected:
+			struct Impl;
+			Impl* mpImpl;
+
+		private:
+			default_task_scheduler(const default_task_scheduler&) = delete;
+			default_task_scheduler& operator=(const default_task_scheduler&) = delete;
+		};
+	#endif
+
+
+	/// GetDefaultTaskScheduler / SetDefaultTaskScheduler
+	///
+	/// The default scheduler is a default_task_scheduler that is created on first use,
+	/// or a serial_task_scheduler if EASTL_DEFAULT_TASK_SCHEDULER_ENABLED is 0.
+	/// SetDefaultTaskScheduler returns the previously set scheduler (NULL if the built-in one was
+	/// in use); passing NULL restores the built-in one.
+	///
+	EASTL_API task_scheduler& GetDefaultTaskScheduler();
+	EASTL_API task_scheduler* SetDefaultTaskScheduler(task_scheduler* pScheduler);
+
+} // namespace eastl
+
+
+#endif // Header include guard
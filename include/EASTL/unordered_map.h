@@ -29,8 +29,9 @@ namespace eastl
 				  typename Hash = eastl::hash<Key>,
 				  typename Predicate = eastl::equal_to<Key>,
 				  typename Allocator = EASTLAllocatorType,
-				  bool bCacheHashCode = false>
-		using unordered_map = hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode>;
+				  bool bCacheHashCode = false,
+				  typename RehashPolicy = prime_rehash_policy>
+		using unordered_map = hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>;
     #endif
 
     /// unordered_multimap
@@ -44,8 +45,9 @@ namespace eastl
 				  typename Hash = eastl::hash<Key>,
 				  typename Predicate = eastl::equal_to<Key>,
 				  typename Allocator = EASTLAllocatorType,
-				  bool bCacheHashCode = false>
-		using unordered_multimap = hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode>;
+				  bool bCacheHashCode = false,
+				  typename RehashPolicy = prime_rehash_policy>
+		using unordered_multimap = hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode, RehashPolicy>;
     #endif
 
 } // namespace eastl
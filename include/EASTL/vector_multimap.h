@@ -29,6 +29,7 @@
 
 
 #include <EASTL/internal/config.h>
+#include <EASTL/internal/sorted_vector_insert.h>
 #include <EASTL/allocator.h>
 #include <EASTL/functional.h>
 #include <EASTL/vector.h>
@@ -240,6 +241,11 @@ namespace eastl
 		template <typename InputIterator>
 		void insert(InputIterator first, InputIterator last);
 
+		/// insert
+		/// Inserts the values in [first, last), which must be sorted, and skips sorting them.
+		template <typename InputIterator>
+		void insert(assume_sorted_t, InputIterator first, InputIterator last);
+
 		iterator  erase(const_iterator position);
 		iterator  erase(const_iterator first, const_iterator last);
 		size_type erase(const key_type& k);
@@ -264,6 +270,71 @@ namespace eastl
 		iterator       upper_bound(const key_type& k);
 		const_iterator upper_bound(const key_type& k) const;
 
+		bool contains(const key_type& k) const
+			{ return find(k) != end(); }
+
+		/// Heterogeneous lookup
+		///
+		/// The following overloads accept a key of any type U which key_compare can be
+		/// called with (in both argument orders), and are available only if key_compare
+		/// defines the member type is_transparent, as less<void> does. For example, a
+		/// vector_multimap<string, ..., less<void>> can be searched via string_view or char
+		/// pointers without constructing a temporary string.
+		///
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type find(const U& u)
+			{ return find_as(u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type find(const U& u) const
+			{ return find_as(u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, bool>::type contains(const U& u) const
+			{ return find_as(u, key_comp()) != end(); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type lower_bound(const U& u)
+			{ return eastl::lower_bound(begin(), end(), u, multimap_value_compare<U, value_type, key_compare>(key_comp())); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type lower_bound(const U& u) const
+			{ return eastl::lower_bound(begin(), end(), u, multimap_value_compare<U, value_type, key_compare>(key_comp())); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type upper_bound(const U& u)
+			{ return eastl::upper_bound(begin(), end(), u, multimap_value_compare<U, value_type, key_compare>(key_comp())); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type upper_bound(const U& u) const
+			{ return eastl::upper_bound(begin(), end(), u, multimap_value_compare<U, value_type, key_compare>(key_comp())); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, eastl::pair<iterator, iterator> >::type equal_range(const U& u)
+			{ return eastl::equal_range(begin(), end(), u, multimap_value_compare<U, value_type, key_compare>(key_comp())); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, eastl::pair<const_iterator, const_iterator> >::type equal_range(const U& u) const
+			{ return eastl::equal_range(begin(), end(), u, multimap_value_compare<U, value_type, key_compare>(key_comp())); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, size_type>::type count(const U& u) const
+		{
+			const eastl::pair<const_iterator, const_iterator> pairIts(equal_range(u));
+			return (size_type)eastl::distance(pairIts.first, pairIts.second);
+		}
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent_erase<C2, U, this_type, size_type>::type erase(const U& u)
+		{
+			const eastl::pair<iterator, iterator> pairIts(equal_range(u));
+			const size_type n = (size_type)eastl::distance(pairIts.first, pairIts.second);
+
+			if(n)
+				base_type::erase(pairIts.first, pairIts.second);
+			return n;
+		}
+
 		eastl::pair<iterator, iterator>             equal_range(const key_type& k);
 		eastl::pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
 
@@ -508,8 +579,8 @@ namespace eastl
 	inline typename vector_multimap<K, T, C, A, RAC>::iterator
 	vector_multimap<K, T, C, A, RAC>::insert(const value_type& value)
 	{
-		const iterator itLB(lower_bound(value.first));
-		return base_type::insert(itLB, value);
+		const iterator itUB(upper_bound(value.first)); // Equivalent elements keep their insertion order, as with multimap and the range insert below.
+		return base_type::insert(itUB, value);
 	}
 
 
@@ -520,8 +591,8 @@ namespace eastl
 		vector_multimap<K, T, C, A, RAC>::insert(P&& otherValue)
 		{
 			value_type value(eastl::forward<P>(otherValue));
-			const iterator itLB(lower_bound(value.first));
-			return base_type::insert(itLB, eastl::move(value));
+			const iterator itUB(upper_bound(value.first));
+			return base_type::insert(itUB, eastl::move(value));
 		}
 	#endif
 
@@ -574,16 +645,17 @@ namespace eastl
 	template <typename InputIterator>
 	inline void vector_multimap<K, T, C, A, RAC>::insert(InputIterator first, InputIterator last)
 	{
-		// To consider: Improve the speed of this by getting the length of the 
-		//              input range and resizing our container to that size
-		//              before doing the insertions. We can't use reserve
-		//              because we don't know if we are using a vector or not.
-		//              Alternatively, force the user to do the reservation.
-		// To consider: When inserting values that come from a container
-		//              like this container, use the property that they are 
-		//              known to be sorted and speed up the inserts here.
-		for(; first != last; ++first)
-			base_type::insert(lower_bound((*first).first), *first);
+		// Inserting the values one at a time would cost a search and a shift of our tail
+		// per value. Instead we append them, sort them and merge them in in one pass.
+		Internal::SortedVectorInsertRange(static_cast<base_type&>(*this), first, last, mValueCompare, false, false);
+	}
+
+
+	template <typename K, typename T, typename C, typename A, typename RAC>
+	template <typename InputIterator>
+	inline void vector_multimap<K, T, C, A, RAC>::insert(assume_sorted_t, InputIterator first, InputIterator last)
+	{
+		Internal::SortedVectorInsertRange(static_cast<base_type&>(*this), first, last, mValueCompare, false, true);
 	}
 
 
@@ -28,6 +28,7 @@
 
 
 #include <EASTL/internal/config.h>
+#include <EASTL/internal/sorted_vector_insert.h>
 #include <EASTL/allocator.h>
 #include <EASTL/functional.h>
 #include <EASTL/vector.h>
@@ -209,6 +210,11 @@ namespace eastl
 		template <typename InputIterator>
 		void insert(InputIterator first, InputIterator last);
 
+		/// insert
+		/// Inserts the values in [first, last), which must be sorted, and skips sorting them.
+		template <typename InputIterator>
+		void insert(assume_sorted_t, InputIterator first, InputIterator last);
+
 		iterator  erase(const_iterator position);
 		iterator  erase(const_iterator first, const_iterator last);
 		size_type erase(const key_type& k);
@@ -233,6 +239,70 @@ namespace eastl
 		iterator       upper_bound(const key_type& k);
 		const_iterator upper_bound(const key_type& k) const;
 
+		bool contains(const key_type& k) const
+			{ return find(k) != end(); }
+
+		/// Heterogeneous lookup
+		///
+		/// The following overloads accept a key of any type U which key_compare can be
+		/// called with (in both argument orders), and are available only if key_compare
+		/// defines the member type is_transparent, as less<void> does. For example, a
+		/// vector_set<string, ..., less<void>> can be searched via string_view or char
+		/// pointers without constructing a temporary string.
+		///
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type find(const U& u)
+			{ return find_as(u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type find(const U& u) const
+			{ return find_as(u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, bool>::type contains(const U& u) const
+			{ return find_as(u, key_comp()) != end(); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type lower_bound(const U& u)
+			{ return eastl::lower_bound(begin(), end(), u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type lower_bound(const U& u) const
+			{ return eastl::lower_bound(begin(), end(), u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, iterator>::type upper_bound(const U& u)
+			{ return eastl::upper_bound(begin(), end(), u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, const_iterator>::type upper_bound(const U& u) const
+			{ return eastl::upper_bound(begin(), end(), u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, eastl::pair<iterator, iterator> >::type equal_range(const U& u)
+			{ return equal_range(u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, eastl::pair<const_iterator, const_iterator> >::type equal_range(const U& u) const
+			{ return equal_range(u, key_comp()); }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent<C2, size_type>::type count(const U& u) const
+			{ return (find(u) != end()) ? (size_type)1 : (size_type)0; }
+
+		template <typename U, typename C2 = Compare>
+		typename Internal::enable_if_transparent_erase<C2, U, this_type, size_type>::type erase(const U& u)
+		{
+			const iterator it(find(u));
+
+			if(it != end()) // If it exists...
+			{
+				erase(it);
+				return 1;
+			}
+			return 0;
+		}
+
 		eastl::pair<iterator, iterator>             equal_range(const key_type& k);
 		eastl::pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
 
@@ -551,16 +621,17 @@ namespace eastl
 	template <typename InputIterator>
 	inline void vector_set<K, C, A, RAC>::insert(InputIterator first, InputIterator last)
 	{
-		// To consider: Improve the speed of this by getting the length of the 
-		//              input range and resizing our container to that size
-		//              before doing the insertions. We can't use reserve
-		//              because we don't know if we are using a vector or not.
-		//              Alternatively, force the user to do the reservation.
-		// To consider: When inserting values that come from a container
-		//              like this container, use the property that they are 
-		//              known to be sorted and speed up the inserts here.
-		for(; first != last; ++first)
-			insert(*first);
+		// Inserting the values one at a time would cost a search and a shift of our tail
+		// per value. Instead we append them, sort them and merge them in in one pass.
+		Internal::SortedVectorInsertRange(static_cast<base_type&>(*this), first, last, mCompare, true, false);
+	}
+
+
+	template <typename K, typename C, typename A, typename RAC>
+	template <typename InputIterator>
+	inline void vector_set<K, C, A, RAC>::insert(assume_sorted_t, InputIterator first, InputIterator last)
+	{
+		Internal::SortedVectorInsertRange(static_cast<base_type&>(*this), first, last, mCompare, true, true);
 	}
 
 
@@ -4,9 +4,13 @@
 
 
 #include <EASTL/internal/hashtable.h>
+#include <EASTL/internal/flat_hashtable.h>
 #include <EASTL/utility.h>
+#include <EASTL/bit.h>
 #include <math.h>  // Not all compilers support <cmath> and std::ceilf(), which we need below.
 #include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
 
 
 #ifdef _MSC_VER
@@ -26,6 +30,20 @@ namespace eastl
 	EASTL_API void* gpEmptyBucketArray[2] = { NULL, (void*)uintptr_t(~0) };
 
 
+	/// gFlatHashtableEmptyGroup
+	///
+	/// The flat_hashtable equivalent of gpEmptyBucketArray. A lone sentinel control
+	/// byte followed by enough empty control bytes for a full group to be loaded.
+	/// 
+	EASTL_API const int8_t gFlatHashtableEmptyGroup[16] =
+	{
+		Internal::kFlatCtrlSentinel, Internal::kFlatCtrlEmpty, Internal::kFlatCtrlEmpty, Internal::kFlatCtrlEmpty,
+		Internal::kFlatCtrlEmpty,    Internal::kFlatCtrlEmpty, Internal::kFlatCtrlEmpty, Internal::kFlatCtrlEmpty,
+		Internal::kFlatCtrlEmpty,    Internal::kFlatCtrlEmpty, Internal::kFlatCtrlEmpty, Internal::kFlatCtrlEmpty,
+		Internal::kFlatCtrlEmpty,    Internal::kFlatCtrlEmpty, Internal::kFlatCtrlEmpty, Internal::kFlatCtrlEmpty
+	};
+
+
 
 	/// gPrimeNumberArray
 	///
@@ -174,6 +192,167 @@ namespace eastl
 	}
 
 
+
+	/// kMaxPowerOfTwoBucketCount
+	///
+	/// The largest bucket count power_of_two_rehash_policy will return. This 
+	/// plays the role of the trailing 4294967291u entry of gPrimeNumberArray.
+	///
+	const uint32_t kMaxPowerOfTwoBucketCount = UINT32_C(1) << 31;
+
+
+	/// GetNextPowerOfTwoBucketCount
+	/// Return a power of two no smaller than nBucketCountHint, with the same lower 
+	/// limit of 2 that gPrimeNumberArray has. A bucket count of 1 is reserved for 
+	/// tables which use gpEmptyBucketArray.
+	///
+	static uint32_t GetNextPowerOfTwoBucketCount(uint32_t nBucketCountHint)
+	{
+		if(nBucketCountHint <= 2)
+			return 2;
+		if(nBucketCountHint >= kMaxPowerOfTwoBucketCount)
+			return kMaxPowerOfTwoBucketCount;
+		return eastl::bit_ceil(nBucketCountHint);
+	}
+
+
+	/// GetPrevBucketCountOnly
+	/// Return a power of two no greater than nBucketCountHint.
+	///
+	uint32_t power_of_two_rehash_policy::GetPrevBucketCountOnly(uint32_t nBucketCountHint)
+	{
+		return (nBucketCountHint < 2) ? 1 : eastl::bit_floor(nBucketCountHint);
+	}
+
+
+	/// GetPrevBucketCount
+	/// Return a power of two no greater than nBucketCountHint.
+	/// This function has a side effect of updating mnNextResize.
+	///
+	uint32_t power_of_two_rehash_policy::GetPrevBucketCount(uint32_t nBucketCountHint) const
+	{
+		const uint32_t nBucketCount = GetPrevBucketCountOnly(nBucketCountHint);
+
+		mnNextResize = (uint32_t)ceilf(nBucketCount * mfMaxLoadFactor);
+		return nBucketCount;
+	}
+
+
+	/// GetNextBucketCount
+	/// Return a power of two no smaller than nBucketCountHint.
+	/// This function has a side effect of updating mnNextResize.
+	///
+	uint32_t power_of_two_rehash_policy::GetNextBucketCount(uint32_t nBucketCountHint) const
+	{
+		const uint32_t nBucketCount = GetNextPowerOfTwoBucketCount(nBucketCountHint);
+
+		mnNextResize = (uint32_t)ceilf(nBucketCount * mfMaxLoadFactor);
+		return nBucketCount;
+	}
+
+
+	/// GetBucketCount
+	/// Return the smallest power of two p such that alpha p >= nElementCount, where 
+	/// alpha is the load factor. This function has a side effect of updating mnNextResize.
+	///
+	uint32_t power_of_two_rehash_policy::GetBucketCount(uint32_t nElementCount) const
+	{
+		const uint32_t nMinBucketCount = (uint32_t)(nElementCount / mfMaxLoadFactor);
+
+		return GetNextBucketCount(nMinBucketCount);
+	}
+
+
+	/// GetRehashRequired
+	/// Finds the smallest power of two p such that alpha p > nElementCount + nElementAdd.
+	/// If p > nBucketCount, return pair<bool, uint32_t>(true, p); otherwise return
+	/// pair<bool, uint32_t>(false, 0). This function has a side effect of updating mnNextResize.
+	///
+	eastl::pair<bool, uint32_t>
+	power_of_two_rehash_policy::GetRehashRequired(uint32_t nBucketCount, uint32_t nElementCount, uint32_t nElementAdd) const
+	{
+		if((nElementCount + nElementAdd) > mnNextResize) // It is significant that we specify > next resize and not >= next resize.
+		{
+			if(nBucketCount == 1) // We force rehashing to occur if the bucket count is < 2.
+				nBucketCount = 0;
+
+			float fMinBucketCount = (nElementCount + nElementAdd) / mfMaxLoadFactor;
+
+			if(fMinBucketCount > (float)nBucketCount)
+			{
+				fMinBucketCount = eastl::max_alt(fMinBucketCount, mfGrowthFactor * nBucketCount);
+
+				const uint32_t nNewBucketCount = (fMinBucketCount >= (float)kMaxPowerOfTwoBucketCount) ? kMaxPowerOfTwoBucketCount : GetNextPowerOfTwoBucketCount((uint32_t)ceilf(fMinBucketCount));
+				mnNextResize = (uint32_t)ceilf(nNewBucketCount * mfMaxLoadFactor);
+
+				return eastl::pair<bool, uint32_t>(true, nNewBucketCount);
+			}
+			else
+			{
+				mnNextResize = (uint32_t)ceilf(nBucketCount * mfMaxLoadFactor);
+				return eastl::pair<bool, uint32_t>(false, (uint32_t)0);
+			}
+		}
+
+		return eastl::pair<bool, uint32_t>(false, (uint32_t)0);
+	}
+
+
+
+	/// StatsAppend
+	///
+	/// snprintf's to pBuffer + nPosition, keeping track of the full length so that the
+	/// caller can learn how much space the whole report needs.
+	///
+	static void StatsAppend(char* pBuffer, size_t nBufferCapacity, size_t& nPosition, const char* pFormat, ...)
+	{
+		va_list arguments;
+		va_start(arguments, pFormat);
+		const int nResult = vsnprintf(pBuffer + ((nPosition < nBufferCapacity) ? nPosition : nBufferCapacity),
+		                              (nPosition < nBufferCapacity) ? (nBufferCapacity - nPosition) : 0, pFormat, arguments);
+		va_end(arguments);
+
+		if(nResult > 0)
+			nPosition += (size_t)nResult;
+	}
+
+
+	EASTL_API size_t format_hashtable_stats(const hashtable_stats& stats, char* pBuffer, size_t nBufferCapacity)
+	{
+		size_t nPosition = 0;
+
+		if(nBufferCapacity)
+			pBuffer[0] = 0;
+
+		StatsAppend(pBuffer, nBufferCapacity, nPosition, "elements: %llu, buckets: %llu, used buckets: %llu, load factor: %.3f, max chain length: %llu\n",
+					(unsigned long long)stats.mnElementCount, (unsigned long long)stats.mnBucketCount, (unsigned long long)stats.mnUsedBucketCount,
+					(double)stats.load_factor(), (unsigned long long)stats.mnMaxChainLength);
+		StatsAppend(pBuffer, nBufferCapacity, nPosition, "lookups: %llu, probes/lookup: %.3f, key compares/lookup: %.3f, hash code rejects: %llu, rehashes: %llu\n",
+					(unsigned long long)stats.mnLookupCount, (double)stats.average_probe_count(), (double)stats.average_key_compare_count(),
+					(unsigned long long)stats.mnHashCodeRejectCount, (unsigned long long)stats.mnRehashCount);
+		StatsAppend(pBuffer, nBufferCapacity, nPosition, "chain length histogram:\n");
+
+		const size_t nLast = (stats.mnMaxChainLength < (size_t)hashtable_stats::kChainLengthHistogramSize) ? stats.mnMaxChainLength : (size_t)(hashtable_stats::kChainLengthHistogramSize - 1);
+
+		for(size_t i = 0; i <= nLast; i++)
+		{
+			const size_t nCount   = stats.mChainLengthHistogram[i];
+			const size_t nPercent = stats.mnBucketCount ? ((nCount * 100 + (stats.mnBucketCount / 2)) / stats.mnBucketCount) : 0;
+
+			StatsAppend(pBuffer, nBufferCapacity, nPosition, "%4llu%s %10llu %3llu%% ",
+						(unsigned long long)i, (i == (size_t)(hashtable_stats::kChainLengthHistogramSize - 1)) ? "+:" : ": ",
+						(unsigned long long)nCount, (unsigned long long)nPercent);
+
+			for(size_t j = 0; j < nPercent / 2; j++) // One '#' per 2%.
+				StatsAppend(pBuffer, nBufferCapacity, nPosition, "#");
+
+			StatsAppend(pBuffer, nBufferCapacity, nPosition, "\n");
+		}
+
+		return nPosition;
+	}
+
+
 } // namespace eastl
 
 
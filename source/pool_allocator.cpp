@@ -0,0 +1,481 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/pool_allocator.h>
+#include <EASTL/type_traits.h>
+#include <string.h>
+
+EA_DISABLE_ALL_VC_WARNINGS()
+#include <atomic>
+#include <mutex>
+#include <new>
+EA_RESTORE_ALL_VC_WARNINGS()
+
+
+namespace eastl
+{
+
+	// Size classes. The first eight cover the headers of the common node types (list and
+	// hash nodes are one or two pointers plus the value, tree nodes are four pointers plus
+	// the value) with 16 byte granularity; beyond that the classes are spaced a quarter of a
+	// power of two apart, which bounds the rounding waste to 25%.
+	static const size_t   kPoolSizeClassCount = 16;
+	static const uint16_t kPoolSizeClasses[kPoolSizeClassCount] = { 16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512 };
+
+	// Maps (n + 15) / 16 to the smallest size class that holds n bytes.
+	static const uint8_t  kPoolSizeClassIndex[33] = { 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15 };
+
+	static_assert(EASTL_POOL_ALLOCATOR_MAX_SIZE <= 512, "EASTL_POOL_ALLOCATOR_MAX_SIZE can't exceed the largest size class.");
+
+	// Pooled memory is carved out of chunks which are aligned to their size and which each
+	// serve a single size class. A block at offset k * size within a chunk is thus aligned
+	// to at least the largest power of two that divides its size class.
+	static const size_t kPoolChunkShift      = 16;
+	static const size_t kPoolChunkSize       = (size_t)1 << kPoolChunkShift;
+	static const size_t kPoolArenaChunkCount = 16;   // Number of chunks reserved from the system at a time.
+	static const size_t kPoolBatchBytes      = 4096; // Blocks move between the thread caches and the central pool in batches of about this many bytes.
+
+	static inline size_t PoolSizeClassOf(size_t n)
+		{ return kPoolSizeClassIndex[(n + 15) / 16]; }
+
+	static inline size_t PoolBatchCount(size_t sizeClass)
+		{ return kPoolBatchBytes / kPoolSizeClasses[sizeClass]; }
+
+	static inline size_t PoolSizeClassAlignment(size_t sizeClass)
+		{ return (size_t)(kPoolSizeClasses[sizeClass] & (0u - kPoolSizeClasses[sizeClass])); }
+
+
+	// A free block. mpNextBatch is used only by the first block of each batch held by the central pool.
+	struct PoolBlock
+	{
+		PoolBlock* mpNext;
+		PoolBlock* mpNextBatch;
+	};
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Page map
+	//
+	// Records, for each chunk, the size class that it serves plus one, or zero for memory
+	// that isn't ours. This is how deallocate finds the size class of a block without
+	// trusting its size argument, and how it recognizes blocks that were passed through
+	// to eastl::allocator. It's a two level radix table indexed by chunk number; leaves are
+	// created when a chunk in their range is first created and never go away. Entries
+	// are written only when a chunk is created, before any of its blocks is handed out,
+	// so reading the entry of a block that was allocated by us needs no synchronization.
+	///////////////////////////////////////////////////////////////////////
+
+	#if (EA_PLATFORM_PTR_SIZE >= 8)
+		static const size_t kPoolPageMapAddressBits = 48; // Addresses outside this range are never ours.
+	#else
+		static const size_t kPoolPageMapAddressBits = 32;
+	#endif
+	static const size_t kPoolPageMapLeafBits = 16;
+	static const size_t kPoolPageMapRootBits = kPoolPageMapAddressBits - kPoolChunkShift - kPoolPageMapLeafBits;
+
+	static std::atomic<uint8_t*> gPoolPageMap[(size_t)1 << kPoolPageMapRootBits]; // Zero-initialized static storage.
+
+	static inline size_t PoolPageMapLookup(const void* p)
+	{
+		const uint64_t chunkIndex = (uint64_t)(uintptr_t)p >> kPoolChunkShift;
+
+		if(chunkIndex >> (kPoolPageMapRootBits + kPoolPageMapLeafBits))
+			return 0;
+
+		const uint8_t* const pLeaf = gPoolPageMap[chunkIndex >> kPoolPageMapLeafBits].load(std::memory_order_acquire);
+		return pLeaf ? pLeaf[chunkIndex & (((size_t)1 << kPoolPageMapLeafBits) - 1)] : 0;
+	}
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Central pool
+	///////////////////////////////////////////////////////////////////////
+
+	struct EA_PREFIX_ALIGN(64) PoolSizeClass
+	{
+		std::mutex mMutex;
+		PoolBlock* mpBatches;    // Full batches returned by the thread caches, linked via mpNextBatch.
+		PoolBlock* mpLoose;      // Blocks returned in smaller numbers.
+		size_t     mnLooseCount;
+		char*      mpCarve;      // The part of the most recent chunk that hasn't been handed out yet.
+		char*      mpCarveEnd;
+
+		PoolSizeClass() : mpBatches(NULL), mpLoose(NULL), mnLooseCount(0), mpCarve(NULL), mpCarveEnd(NULL) {}
+	} EA_POSTFIX_ALIGN(64);
+
+
+	struct PoolCentral
+	{
+		PoolSizeClass mSizeClasses[kPoolSizeClassCount];
+		std::mutex    mChunkMutex;
+		char*         mpArena;       // Chunk-aligned memory reserved from the system which hasn't been made into chunks yet.
+		char*         mpArenaEnd;
+
+		PoolCentral() : mpArena(NULL), mpArenaEnd(NULL) {}
+
+		// Returns a new chunk serving the given size class, or NULL if the system is out of memory.
+		char* AllocateChunk(size_t sizeClass)
+		{
+			std::lock_guard<std::mutex> lock(mChunkMutex);
+
+			if(mpArena == mpArenaEnd)
+			{
+				// The arena memory is never freed, as blocks may be in use up until the process exits.
+				allocator systemAllocator(EASTL_POOL_ALLOCATOR_DEFAULT_NAME);
+				const size_t arenaSize = (kPoolArenaChunkCount + 1) * kPoolChunkSize;
+				char* const  pArena    = (char*)systemAllocator.allocate(arenaSize);
+
+				if(!pArena)
+					return NULL;
+
+				mpArena    = (char*)(((uintptr_t)pArena + kPoolChunkSize - 1) & ~(uintptr_t)(kPoolChunkSize - 1));
+				mpArenaEnd = mpArena + (kPoolArenaChunkCount * kPoolChunkSize);
+			}
+
+			const uint64_t chunkIndex = (uint64_t)(uintptr_t)mpArena >> kPoolChunkShift;
+			EASTL_ASSERT((chunkIndex >> (kPoolPageMapRootBits + kPoolPageMapLeafBits)) == 0);
+
+			std::atomic<uint8_t*>& leafRef = gPoolPageMap[chunkIndex >> kPoolPageMapLeafBits];
+			uint8_t* pLeaf = leafRef.load(std::memory_order_relaxed);
+
+			if(!pLeaf)
+			{
+				const size_t leafSize = (size_t)1 << kPoolPageMapLeafBits;
+				allocator systemAllocator(EASTL_POOL_ALLOCATOR_DEFAULT_NAME);
+
+				if((pLeaf = (uint8_t*)systemAllocator.allocate(leafSize)) == NULL)
+					return NULL;
+
+				memset(pLeaf, 0, leafSize);
+				leafRef.store(pLeaf, std::memory_order_release);
+			}
+
+			pLeaf[chunkIndex & (((size_t)1 << kPoolPageMapLeafBits) - 1)] = (uint8_t)(sizeClass + 1);
+
+			char* const pChunk = mpArena;
+			mpArena += kPoolChunkSize;
+			return pChunk;
+		}
+
+		// Returns a null-terminated list of up to one batch of free blocks, setting count to
+		// their number. Returns NULL if the system is out of memory.
+		PoolBlock* Fetch(size_t sizeClass, size_t& count)
+		{
+			PoolSizeClass& sc = mSizeClasses[sizeClass];
+			std::lock_guard<std::mutex> lock(sc.mMutex);
+
+			if(PoolBlock* const pBatch = sc.mpBatches)
+			{
+				sc.mpBatches = pBatch->mpNextBatch;
+				count = PoolBatchCount(sizeClass);
+				return pBatch;
+			}
+
+			if(PoolBlock* const pLoose = sc.mpLoose)
+			{
+				sc.mpLoose = NULL;
+				count = sc.mnLooseCount;
+				sc.mnLooseCount = 0;
+				return pLoose;
+			}
+
+			const size_t blockSize  = kPoolSizeClasses[sizeClass];
+			const size_t batchCount = PoolBatchCount(sizeClass);
+			PoolBlock*   pHead      = NULL;
+
+			for(count = 0; count < batchCount; ++count)
+			{
+				if((size_t)(sc.mpCarveEnd - sc.mpCarve) < blockSize)
+				{
+					char* const pChunk = AllocateChunk(sizeClass);
+
+					if(!pChunk)
+						break;
+
+					sc.mpCarve    = pChunk;
+					sc.mpCarveEnd = pChunk + ((kPoolChunkSize / blockSize) * blockSize);
+				}
+
+				// Hand out blocks in address order, which is friendlier to the cache for nodes that are allocated consecutively.
+				PoolBlock* const pBlock = (PoolBlock*)(sc.mpCarveEnd - blockSize);
+				sc.mpCarveEnd -= blockSize;
+				pBlock->mpNext = pHead;
+				pHead = pBlock;
+			}
+
+			return pHead;
+		}
+
+		// Takes back a null-terminated list of count free blocks.
+		void Return(size_t sizeClass, PoolBlock* pHead, PoolBlock* pTail, size_t count)
+		{
+			PoolSizeClass& sc = mSizeClasses[sizeClass];
+			std::lock_guard<std::mutex> lock(sc.mMutex);
+
+			const size_t batchCount = PoolBatchCount(sizeClass);
+
+			if(count == batchCount)
+			{
+				pHead->mpNextBatch = sc.mpBatches;
+				sc.mpBatches = pHead;
+				return;
+			}
+
+			pTail->mpNext = sc.mpLoose;
+			sc.mpLoose = pHead;
+
+			if((sc.mnLooseCount += count) >= batchCount)
+			{
+				// Turn the first batchCount loose blocks into a batch.
+				PoolBlock* pBatchTail = sc.mpLoose;
+				for(size_t i = 1; i < batchCount; ++i)
+					pBatchTail = pBatchTail->mpNext;
+
+				PoolBlock* const pBatch = sc.mpLoose;
+				sc.mpLoose = pBatchTail->mpNext;
+				sc.mnLooseCount -= batchCount;
+				pBatchTail->mpNext = NULL;
+				pBatch->mpNextBatch = sc.mpBatches;
+				sc.mpBatches = pBatch;
+			}
+		}
+	};
+
+
+	// The central pool is constructed on first use and deliberately never destroyed, as
+	// containers with static storage duration may free their memory after it would be.
+	static PoolCentral& GetPoolCentral()
+	{
+		static aligned_storage<sizeof(PoolCentral), EASTL_ALIGN_OF(PoolCentral)>::type sPoolCentralStorage;
+		static PoolCentral* const spPoolCentral = new(&sPoolCentralStorage) PoolCentral;
+		return *spPoolCentral;
+	}
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Thread cache
+	///////////////////////////////////////////////////////////////////////
+
+	#if EASTL_POOL_ALLOCATOR_THREAD_CACHE_ENABLED
+
+		// This is a trivial type so that it is constant-initialized and can be used at any
+		// point during the thread's lifetime, including after its thread_local objects have
+		// been destroyed.
+		struct PoolThreadCache
+		{
+			PoolBlock* mpFree[kPoolSizeClassCount];
+			uint32_t   mnFreeCount[kPoolSizeClassCount];
+			bool       mbRegistered; // The reaper below has been constructed.
+			bool       mbExited;     // The reaper below has been destroyed, so nothing may be kept in the cache anymore.
+		};
+
+		static thread_local PoolThreadCache tPoolThreadCache;
+
+
+		static void FlushPoolThreadCache(PoolThreadCache& cache)
+		{
+			for(size_t sizeClass = 0; sizeClass < kPoolSizeClassCount; ++sizeClass)
+			{
+				if(PoolBlock* const pHead = cache.mpFree[sizeClass])
+				{
+					PoolBlock* pTail = pHead;
+					while(pTail->mpNext)
+						pTail = pTail->mpNext;
+
+					GetPoolCentral().Return(sizeClass, pHead, pTail, cache.mnFreeCount[sizeClass]);
+					cache.mpFree[sizeClass] = NULL;
+					cache.mnFreeCount[sizeClass] = 0;
+				}
+			}
+		}
+
+
+		// Returns the thread's cached blocks to the central pool when the thread exits.
+		struct PoolThreadCacheReaper
+		{
+			PoolThreadCacheReaper()
+				{ tPoolThreadCache.mbRegistered = true; }
+
+		   ~PoolThreadCacheReaper()
+			{
+				FlushPoolThreadCache(tPoolThreadCache);
+				tPoolThreadCache.mbExited = true;
+			}
+		};
+
+		static thread_local PoolThreadCacheReaper tPoolThreadCacheReaper;
+
+
+		static EA_NO_INLINE void* PoolAllocateSlow(PoolThreadCache& cache, size_t sizeClass)
+		{
+			if(!cache.mbRegistered && !cache.mbExited)
+				(void)&tPoolThreadCacheReaper; // Constructs the reaper, which registers its destructor.
+
+			size_t count;
+			PoolBlock* const pBlock = GetPoolCentral().Fetch(sizeClass, count);
+
+			if(pBlock)
+			{
+				cache.mpFree[sizeClass]      = pBlock->mpNext;
+				cache.mnFreeCount[sizeClass] = (uint32_t)(count - 1);
+
+				if(cache.mbExited)
+					FlushPoolThreadCache(cache);
+			}
+
+			return pBlock;
+		}
+
+
+		static EA_NO_INLINE void PoolReturnBatch(PoolThreadCache& cache, size_t sizeClass)
+		{
+			if(cache.mbExited)
+			{
+				FlushPoolThreadCache(cache);
+				return;
+			}
+
+			const size_t batchCount = PoolBatchCount(sizeClass);
+			PoolBlock* const pHead = cache.mpFree[sizeClass];
+			PoolBlock* pTail = pHead;
+
+			for(size_t i = 1; i < batchCount; ++i)
+				pTail = pTail->mpNext;
+
+			cache.mpFree[sizeClass] = pTail->mpNext;
+			cache.mnFreeCount[sizeClass] -= (uint32_t)batchCount;
+			pTail->mpNext = NULL;
+
+			GetPoolCentral().Return(sizeClass, pHead, pTail, batchCount);
+		}
+
+
+		static inline void* PoolAllocate(size_t sizeClass)
+		{
+			PoolThreadCache& cache = tPoolThreadCache;
+			PoolBlock* const pBlock = cache.mpFree[sizeClass];
+
+			if(EASTL_LIKELY(pBlock != NULL))
+			{
+				cache.mpFree[sizeClass] = pBlock->mpNext;
+				cache.mnFreeCount[sizeClass]--;
+				return pBlock;
+			}
+
+			return PoolAllocateSlow(cache, sizeClass);
+		}
+
+
+		static inline void PoolDeallocate(void* p, size_t sizeClass)
+		{
+			PoolThreadCache& cache = tPoolThreadCache;
+			PoolBlock* const pBlock = (PoolBlock*)p;
+
+			pBlock->mpNext = cache.mpFree[sizeClass];
+			cache.mpFree[sizeClass] = pBlock;
+
+			// Keeping up to two batches means that a thread which alternates between allocating
+			// and freeing around a batch boundary doesn't go to the central pool every time.
+			if(EASTL_UNLIKELY(++cache.mnFreeCount[sizeClass] >= (2 * PoolBatchCount(sizeClass))) || EASTL_UNLIKELY(cache.mbExited))
+				PoolReturnBatch(cache, sizeClass);
+		}
+
+	#else
+
+		static inline void* PoolAllocate(size_t sizeClass)
+		{
+			PoolCentral& central = GetPoolCentral();
+			size_t count;
+			PoolBlock* const pBlock = central.Fetch(sizeClass, count);
+
+			if(pBlock && pBlock->mpNext)
+			{
+				PoolBlock* pTail = pBlock->mpNext;
+				while(pTail->mpNext)
+					pTail = pTail->mpNext;
+
+				central.Return(sizeClass, pBlock->mpNext, pTail, count - 1);
+			}
+
+			return pBlock;
+		}
+
+
+		static inline void PoolDeallocate(void* p, size_t sizeClass)
+		{
+			PoolBlock* const pBlock = (PoolBlock*)p;
+			pBlock->mpNext = NULL;
+			GetPoolCentral().Return(sizeClass, pBlock, pBlock, 1);
+		}
+
+	#endif // EASTL_POOL_ALLOCATOR_THREAD_CACHE_ENABLED
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// pool_allocator
+	///////////////////////////////////////////////////////////////////////
+
+	void* pool_allocator::allocate(size_t n, int flags)
+	{
+		if(n <= EASTL_POOL_ALLOCATOR_MAX_SIZE)
+			return PoolAllocate(PoolSizeClassOf(n));
+
+		return allocator(get_name()).allocate(n, flags);
+	}
+
+
+	void* pool_allocator::allocate(size_t n, size_t alignment, size_t offset, int flags)
+	{
+		if((n <= EASTL_POOL_ALLOCATOR_MAX_SIZE) && ((offset % alignment) == 0))
+		{
+			for(size_t sizeClass = PoolSizeClassOf(n); sizeClass < kPoolSizeClassCount; ++sizeClass)
+			{
+				if(PoolSizeClassAlignment(sizeClass) >= alignment)
+					return PoolAllocate(sizeClass);
+			}
+		}
+
+		return allocator(get_name()).allocate(n, alignment, offset, flags);
+	}
+
+
+	void pool_allocator::deallocate(void* p, size_t n)
+	{
+		if(p)
+		{
+			if(const size_t sizeClassPlusOne = PoolPageMapLookup(p))
+				PoolDeallocate(p, sizeClassPlusOne - 1);
+			else
+				allocator(get_name()).deallocate(p, n);
+		}
+	}
+
+
+	void pool_allocator::flush_thread_cache()
+	{
+		#if EASTL_POOL_ALLOCATOR_THREAD_CACHE_ENABLED
+			FlushPoolThreadCache(tPoolThreadCache);
+		#endif
+	}
+
+
+	size_t pool_allocator::pooled_size(size_t n)
+	{
+		return (n <= EASTL_POOL_ALLOCATOR_MAX_SIZE) ? kPoolSizeClasses[PoolSizeClassOf(n)] : 0;
+	}
+
+
+	EASTL_API pool_allocator* GetDefaultPoolAllocator()
+	{
+		static pool_allocator sDefaultPoolAllocator;
+		return &sDefaultPoolAllocator;
+	}
+
+} // namespace eastl
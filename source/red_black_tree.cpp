@@ -52,12 +52,12 @@ namespace eastl
 		}
 		else 
 		{
-			rbtree_node_base* pNodeTemp = pNode->mpNodeParent;
+			rbtree_node_base* pNodeTemp = pNode->parent();
 
 			while(pNode == pNodeTemp->mpNodeRight) 
 			{
 				pNode = pNodeTemp;
-				pNodeTemp = pNodeTemp->mpNodeParent;
+				pNodeTemp = pNodeTemp->parent();
 			}
 
 			if(pNode->mpNodeRight != pNodeTemp)
@@ -74,7 +74,7 @@ namespace eastl
 	///
 	EASTL_API rbtree_node_base* RBTreeDecrement(const rbtree_node_base* pNode)
 	{
-		if((pNode->mpNodeParent->mpNodeParent == pNode) && (pNode->mColor == kRBTreeColorRed))
+		if((pNode->parent()->parent() == pNode) && (pNode->color() == kRBTreeColorRed))
 			return pNode->mpNodeRight;
 		else if(pNode->mpNodeLeft)
 		{
@@ -86,12 +86,12 @@ namespace eastl
 			return pNodeTemp;
 		}
 
-		rbtree_node_base* pNodeTemp = pNode->mpNodeParent;
+		rbtree_node_base* pNodeTemp = pNode->parent();
 
 		while(pNode == pNodeTemp->mpNodeLeft) 
 		{
 			pNode     = pNodeTemp;
-			pNodeTemp = pNodeTemp->mpNodeParent;
+			pNodeTemp = pNodeTemp->parent();
 		}
 
 		return const_cast<rbtree_node_base*>(pNodeTemp);
@@ -109,9 +109,9 @@ namespace eastl
 	{
 		size_t nCount = 0;
 
-		for(; pNodeBottom; pNodeBottom = pNodeBottom->mpNodeParent)
+		for(; pNodeBottom; pNodeBottom = pNodeBottom->parent())
 		{
-			if(pNodeBottom->mColor == kRBTreeColorBlack) 
+			if(pNodeBottom->color() == kRBTreeColorBlack) 
 				++nCount;
 
 			if(pNodeBottom == pNodeTop) 
@@ -133,18 +133,24 @@ namespace eastl
 		pNode->mpNodeRight = pNodeTemp->mpNodeLeft;
 
 		if(pNodeTemp->mpNodeLeft)
-			pNodeTemp->mpNodeLeft->mpNodeParent = pNode;
-		pNodeTemp->mpNodeParent = pNode->mpNodeParent;
+			pNodeTemp->mpNodeLeft->set_parent(pNode);
+		pNodeTemp->set_parent(pNode->parent());
 		
 		if(pNode == pNodeRoot)
 			pNodeRoot = pNodeTemp;
-		else if(pNode == pNode->mpNodeParent->mpNodeLeft)
-			pNode->mpNodeParent->mpNodeLeft = pNodeTemp;
+		else if(pNode == pNode->parent()->mpNodeLeft)
+			pNode->parent()->mpNodeLeft = pNodeTemp;
 		else
-			pNode->mpNodeParent->mpNodeRight = pNodeTemp;
+			pNode->parent()->mpNodeRight = pNodeTemp;
 
 		pNodeTemp->mpNodeLeft = pNode;
-		pNode->mpNodeParent = pNodeTemp;
+		pNode->set_parent(pNodeTemp);
+
+		#if EASTL_RBTREE_ORDER_STATISTICS
+			// pNodeTemp takes over pNode's subtree, and pNode loses pNodeTemp and its right subtree.
+			pNodeTemp->mnSubtreeSize = pNode->mnSubtreeSize;
+			pNode->mnSubtreeSize     = RBTreeGetSubtreeSize(pNode->mpNodeLeft) + RBTreeGetSubtreeSize(pNode->mpNodeRight) + 1;
+		#endif
 
 		return pNodeRoot;
 	}
@@ -162,18 +168,23 @@ namespace eastl
 		pNode->mpNodeLeft = pNodeTemp->mpNodeRight;
 
 		if(pNodeTemp->mpNodeRight)
-			pNodeTemp->mpNodeRight->mpNodeParent = pNode;
-		pNodeTemp->mpNodeParent = pNode->mpNodeParent;
+			pNodeTemp->mpNodeRight->set_parent(pNode);
+		pNodeTemp->set_parent(pNode->parent());
 
 		if(pNode == pNodeRoot)
 			pNodeRoot = pNodeTemp;
-		else if(pNode == pNode->mpNodeParent->mpNodeRight)
-			pNode->mpNodeParent->mpNodeRight = pNodeTemp;
+		else if(pNode == pNode->parent()->mpNodeRight)
+			pNode->parent()->mpNodeRight = pNodeTemp;
 		else
-			pNode->mpNodeParent->mpNodeLeft = pNodeTemp;
+			pNode->parent()->mpNodeLeft = pNodeTemp;
 
 		pNodeTemp->mpNodeRight = pNode;
-		pNode->mpNodeParent = pNodeTemp;
+		pNode->set_parent(pNodeTemp);
+
+		#if EASTL_RBTREE_ORDER_STATISTICS
+			pNodeTemp->mnSubtreeSize = pNode->mnSubtreeSize;
+			pNode->mnSubtreeSize     = RBTreeGetSubtreeSize(pNode->mpNodeLeft) + RBTreeGetSubtreeSize(pNode->mpNodeRight) + 1;
+		#endif
 
 		return pNodeRoot;
 	}
@@ -181,105 +192,128 @@ namespace eastl
 
 
 
-	/// RBTreeInsert
-	/// Insert a node into the tree and rebalance the tree as a result of the 
-	/// disturbance the node introduced.
+	/// RBTreeRebalanceAfterInsert
+	/// Restores the red-black properties after the red node pNode has been linked 
+	/// into the tree with the given root, and returns the new root. The caller
+	/// colors the root black, as RBTreeJoinSubtrees needs to know if that changes it.
 	///
-	EASTL_API void RBTreeInsert(rbtree_node_base* pNode,
-								rbtree_node_base* pNodeParent, 
-								rbtree_node_base* pNodeAnchor,
-								RBTreeSide insertionSide)
+	static rbtree_node_base* RBTreeRebalanceAfterInsert(rbtree_node_base* pNode, rbtree_node_base* pNodeRoot)
 	{
-		rbtree_node_base*& pNodeRootRef = pNodeAnchor->mpNodeParent;
-
-		// Initialize fields in new node to insert.
-		pNode->mpNodeParent = pNodeParent;
-		pNode->mpNodeRight  = NULL;
-		pNode->mpNodeLeft   = NULL;
-		pNode->mColor       = kRBTreeColorRed;
-
-		// Insert the node.
-		if(insertionSide == kRBTreeSideLeft)
-		{
-			pNodeParent->mpNodeLeft = pNode; // Also makes (leftmost = pNode) when (pNodeParent == pNodeAnchor)
-
-			if(pNodeParent == pNodeAnchor)
-			{
-				pNodeAnchor->mpNodeParent = pNode;
-				pNodeAnchor->mpNodeRight = pNode;
-			}
-			else if(pNodeParent == pNodeAnchor->mpNodeLeft)
-				pNodeAnchor->mpNodeLeft = pNode; // Maintain leftmost pointing to min node
-		}
-		else
-		{
-			pNodeParent->mpNodeRight = pNode;
-
-			if(pNodeParent == pNodeAnchor->mpNodeRight)
-				pNodeAnchor->mpNodeRight = pNode; // Maintain rightmost pointing to max node
-		}
-
-		// Rebalance the tree.
-		while((pNode != pNodeRootRef) && (pNode->mpNodeParent->mColor == kRBTreeColorRed)) 
+		while((pNode != pNodeRoot) && (pNode->parent()->color() == kRBTreeColorRed)) 
 		{
-			EA_ANALYSIS_ASSUME(pNode->mpNodeParent != NULL);
-			rbtree_node_base* const pNodeParentParent = pNode->mpNodeParent->mpNodeParent;
+			EA_ANALYSIS_ASSUME(pNode->parent() != NULL);
+			rbtree_node_base* const pNodeParentParent = pNode->parent()->parent();
 
-			if(pNode->mpNodeParent == pNodeParentParent->mpNodeLeft) 
+			if(pNode->parent() == pNodeParentParent->mpNodeLeft) 
 			{
 				rbtree_node_base* const pNodeTemp = pNodeParentParent->mpNodeRight;
 
-				if(pNodeTemp && (pNodeTemp->mColor == kRBTreeColorRed)) 
+				if(pNodeTemp && (pNodeTemp->color() == kRBTreeColorRed)) 
 				{
-					pNode->mpNodeParent->mColor = kRBTreeColorBlack;
-					pNodeTemp->mColor = kRBTreeColorBlack;
-					pNodeParentParent->mColor = kRBTreeColorRed;
+					pNode->parent()->set_color(kRBTreeColorBlack);
+					pNodeTemp->set_color(kRBTreeColorBlack);
+					pNodeParentParent->set_color(kRBTreeColorRed);
 					pNode = pNodeParentParent;
 				}
 				else 
 				{
-					if(pNode->mpNodeParent && pNode == pNode->mpNodeParent->mpNodeRight) 
+					if(pNode->parent() && pNode == pNode->parent()->mpNodeRight) 
 					{
-						pNode = pNode->mpNodeParent;
-						pNodeRootRef = RBTreeRotateLeft(pNode, pNodeRootRef);
+						pNode = pNode->parent();
+						pNodeRoot = RBTreeRotateLeft(pNode, pNodeRoot);
 					}
 
-					EA_ANALYSIS_ASSUME(pNode->mpNodeParent != NULL);
-					pNode->mpNodeParent->mColor = kRBTreeColorBlack;
-					pNodeParentParent->mColor = kRBTreeColorRed;
-					pNodeRootRef = RBTreeRotateRight(pNodeParentParent, pNodeRootRef);
+					EA_ANALYSIS_ASSUME(pNode->parent() != NULL);
+					pNode->parent()->set_color(kRBTreeColorBlack);
+					pNodeParentParent->set_color(kRBTreeColorRed);
+					pNodeRoot = RBTreeRotateRight(pNodeParentParent, pNodeRoot);
 				}
 			}
 			else 
 			{
 				rbtree_node_base* const pNodeTemp = pNodeParentParent->mpNodeLeft;
 
-				if(pNodeTemp && (pNodeTemp->mColor == kRBTreeColorRed)) 
+				if(pNodeTemp && (pNodeTemp->color() == kRBTreeColorRed)) 
 				{
-					pNode->mpNodeParent->mColor = kRBTreeColorBlack;
-					pNodeTemp->mColor = kRBTreeColorBlack;
-					pNodeParentParent->mColor = kRBTreeColorRed;
+					pNode->parent()->set_color(kRBTreeColorBlack);
+					pNodeTemp->set_color(kRBTreeColorBlack);
+					pNodeParentParent->set_color(kRBTreeColorRed);
 					pNode = pNodeParentParent;
 				}
 				else 
 				{
-					EA_ANALYSIS_ASSUME(pNode != NULL && pNode->mpNodeParent != NULL);
+					EA_ANALYSIS_ASSUME(pNode != NULL && pNode->parent() != NULL);
 
-					if(pNode == pNode->mpNodeParent->mpNodeLeft) 
+					if(pNode == pNode->parent()->mpNodeLeft) 
 					{
-						pNode = pNode->mpNodeParent;
-						pNodeRootRef = RBTreeRotateRight(pNode, pNodeRootRef);
+						pNode = pNode->parent();
+						pNodeRoot = RBTreeRotateRight(pNode, pNodeRoot);
 					}
 
-					pNode->mpNodeParent->mColor = kRBTreeColorBlack;
-					pNodeParentParent->mColor = kRBTreeColorRed;
-					pNodeRootRef = RBTreeRotateLeft(pNodeParentParent, pNodeRootRef);
+					pNode->parent()->set_color(kRBTreeColorBlack);
+					pNodeParentParent->set_color(kRBTreeColorRed);
+					pNodeRoot = RBTreeRotateLeft(pNodeParentParent, pNodeRoot);
 				}
 			}
 		}
 
-		EA_ANALYSIS_ASSUME(pNodeRootRef != NULL);
-		pNodeRootRef->mColor = kRBTreeColorBlack;
+		return pNodeRoot;
+	}
+
+
+
+	/// RBTreeInsert
+	/// Insert a node into the tree and rebalance the tree as a result of the 
+	/// disturbance the node introduced.
+	///
+	EASTL_API void RBTreeInsert(rbtree_node_base* pNode,
+								rbtree_node_base* pNodeParent, 
+								rbtree_node_base* pNodeAnchor,
+								RBTreeSide insertionSide)
+	{
+		// The root is the anchor's parent. We work on a copy of it, as it may share storage with the anchor's color.
+		rbtree_node_base* pNodeRoot = pNodeAnchor->parent();
+
+		// Initialize fields in new node to insert.
+		pNode->set_parent_and_color(pNodeParent, kRBTreeColorRed);
+		pNode->mpNodeRight = NULL;
+		pNode->mpNodeLeft  = NULL;
+
+		#if EASTL_RBTREE_ORDER_STATISTICS
+			// The new node is a leaf, and each of its ancestors gains one node. The rotations below maintain this.
+			pNode->mnSubtreeSize = 1;
+
+			for(rbtree_node_base* pNodeAncestor = pNodeParent; pNodeAncestor != pNodeAnchor; pNodeAncestor = pNodeAncestor->parent())
+				++pNodeAncestor->mnSubtreeSize;
+		#endif
+
+		// Insert the node.
+		if(insertionSide == kRBTreeSideLeft)
+		{
+			pNodeParent->mpNodeLeft = pNode; // Also makes (leftmost = pNode) when (pNodeParent == pNodeAnchor)
+
+			if(pNodeParent == pNodeAnchor)
+			{
+				pNodeRoot = pNode;
+				pNodeAnchor->mpNodeRight = pNode;
+			}
+			else if(pNodeParent == pNodeAnchor->mpNodeLeft)
+				pNodeAnchor->mpNodeLeft = pNode; // Maintain leftmost pointing to min node
+		}
+		else
+		{
+			pNodeParent->mpNodeRight = pNode;
+
+			if(pNodeParent == pNodeAnchor->mpNodeRight)
+				pNodeAnchor->mpNodeRight = pNode; // Maintain rightmost pointing to max node
+		}
+
+		// Rebalance the tree.
+		pNodeRoot = RBTreeRebalanceAfterInsert(pNode, pNodeRoot);
+
+		EA_ANALYSIS_ASSUME(pNodeRoot != NULL);
+		pNodeRoot->set_color(kRBTreeColorBlack);
+		pNodeAnchor->set_parent(pNodeRoot);
 
 	} // RBTreeInsert
 
@@ -291,7 +325,7 @@ namespace eastl
 	///
 	EASTL_API void RBTreeErase(rbtree_node_base* pNode, rbtree_node_base* pNodeAnchor)
 	{
-		rbtree_node_base*& pNodeRootRef      = pNodeAnchor->mpNodeParent;
+		rbtree_node_base*  pNodeRoot         = pNodeAnchor->parent(); // A copy, as it may share storage with the anchor's color.
 		rbtree_node_base*& pNodeLeftmostRef  = pNodeAnchor->mpNodeLeft;
 		rbtree_node_base*& pNodeRightmostRef = pNodeAnchor->mpNodeRight;
 		rbtree_node_base*  pNodeSuccessor    = pNode;
@@ -313,22 +347,29 @@ namespace eastl
 			pNodeChild = pNodeSuccessor->mpNodeRight;
 		}
 
+		#if EASTL_RBTREE_ORDER_STATISTICS
+			// pNodeSuccessor's position is the one which is removed from the tree (when it is
+			// not pNode, it moves into pNode's place below), so each of its ancestors loses a node.
+			for(rbtree_node_base* pNodeAncestor = pNodeSuccessor->parent(); pNodeAncestor != pNodeAnchor; pNodeAncestor = pNodeAncestor->parent())
+				--pNodeAncestor->mnSubtreeSize;
+		#endif
+
 		// Here we remove pNode from the tree and fix up the node pointers appropriately around it.
 		if(pNodeSuccessor == pNode) // If pNode was a leaf node (had both NULL children)...
 		{
-			pNodeChildParent = pNodeSuccessor->mpNodeParent;  // Assign pNodeReplacement's parent.
+			pNodeChildParent = pNodeSuccessor->parent();  // Assign pNodeReplacement's parent.
 
 			if(pNodeChild) 
-				pNodeChild->mpNodeParent = pNodeSuccessor->mpNodeParent;
+				pNodeChild->set_parent(pNodeSuccessor->parent());
 
-			if(pNode == pNodeRootRef) // If the node being deleted is the root node...
-				pNodeRootRef = pNodeChild; // Set the new root node to be the pNodeReplacement.
+			if(pNode == pNodeRoot) // If the node being deleted is the root node...
+				pNodeRoot = pNodeChild; // Set the new root node to be the pNodeReplacement.
 			else 
 			{
-				if(pNode == pNode->mpNodeParent->mpNodeLeft) // If pNode is a left node...
-					pNode->mpNodeParent->mpNodeLeft  = pNodeChild;  // Make pNode's replacement node be on the same side.
+				if(pNode == pNode->parent()->mpNodeLeft) // If pNode is a left node...
+					pNode->parent()->mpNodeLeft  = pNodeChild;  // Make pNode's replacement node be on the same side.
 				else
-					pNode->mpNodeParent->mpNodeRight = pNodeChild;
+					pNode->parent()->mpNodeRight = pNodeChild;
 				// Now pNode is disconnected from the bottom of the tree (recall that in this pathway pNode was determined to be a leaf).
 			}
 
@@ -342,7 +383,7 @@ namespace eastl
 					pNodeLeftmostRef = RBTreeGetMinChild(pNodeChild); 
 				}
 				else
-					pNodeLeftmostRef = pNode->mpNodeParent; // This  makes (pNodeLeftmostRef == end()) if (pNode == root node)
+					pNodeLeftmostRef = pNode->parent(); // This  makes (pNodeLeftmostRef == end()) if (pNode == root node)
 			}
 
 			if(pNode == pNodeRightmostRef) // If pNode is the tree last (rbegin()) node...
@@ -355,85 +396,92 @@ namespace eastl
 					pNodeRightmostRef = RBTreeGetMaxChild(pNodeChild);
 				}
 				else // pNodeChild == pNode->mpNodeLeft
-					pNodeRightmostRef = pNode->mpNodeParent; // makes pNodeRightmostRef == &mAnchor if pNode == pNodeRootRef
+					pNodeRightmostRef = pNode->parent(); // makes pNodeRightmostRef == &mAnchor if pNode == pNodeRoot
 			}
 		}
 		else // else (pNodeSuccessor != pNode)
 		{
 			// Relink pNodeSuccessor in place of pNode. pNodeSuccessor is pNode's successor.
 			// We specifically set pNodeSuccessor to be on the right child side of pNode, so fix up the left child side.
-			pNode->mpNodeLeft->mpNodeParent = pNodeSuccessor; 
+			pNode->mpNodeLeft->set_parent(pNodeSuccessor); 
 			pNodeSuccessor->mpNodeLeft = pNode->mpNodeLeft;
 
 			if(pNodeSuccessor == pNode->mpNodeRight) // If pNode's successor was at the bottom of the tree... (yes that's effectively what this statement means)
 				pNodeChildParent = pNodeSuccessor; // Assign pNodeReplacement's parent.
 			else
 			{
-				pNodeChildParent = pNodeSuccessor->mpNodeParent;
+				pNodeChildParent = pNodeSuccessor->parent();
 
 				if(pNodeChild)
-					pNodeChild->mpNodeParent = pNodeChildParent;
+					pNodeChild->set_parent(pNodeChildParent);
 
 				pNodeChildParent->mpNodeLeft = pNodeChild;
 
 				pNodeSuccessor->mpNodeRight = pNode->mpNodeRight;
-				pNode->mpNodeRight->mpNodeParent = pNodeSuccessor;
+				pNode->mpNodeRight->set_parent(pNodeSuccessor);
 			}
 
-			if(pNode == pNodeRootRef)
-				pNodeRootRef = pNodeSuccessor;
-			else if(pNode == pNode->mpNodeParent->mpNodeLeft)
-				pNode->mpNodeParent->mpNodeLeft = pNodeSuccessor;
+			if(pNode == pNodeRoot)
+				pNodeRoot = pNodeSuccessor;
+			else if(pNode == pNode->parent()->mpNodeLeft)
+				pNode->parent()->mpNodeLeft = pNodeSuccessor;
 			else 
-				pNode->mpNodeParent->mpNodeRight = pNodeSuccessor;
+				pNode->parent()->mpNodeRight = pNodeSuccessor;
 
 			// Now pNode is disconnected from the tree.
 
-			pNodeSuccessor->mpNodeParent = pNode->mpNodeParent;
-			eastl::swap(pNodeSuccessor->mColor, pNode->mColor);
+			pNodeSuccessor->set_parent(pNode->parent());
+
+			const char color = pNodeSuccessor->color();
+			pNodeSuccessor->set_color(pNode->color());
+			pNode->set_color(color);
+
+			#if EASTL_RBTREE_ORDER_STATISTICS
+				pNodeSuccessor->mnSubtreeSize = pNode->mnSubtreeSize;
+			#endif
 		}
 
 		// Here we do tree balancing as per the conventional red-black tree algorithm.
-		if(pNode->mColor == kRBTreeColorBlack) 
+		if(pNode->color() == kRBTreeColorBlack) 
 		{ 
-			while((pNodeChild != pNodeRootRef) && ((pNodeChild == NULL) || (pNodeChild->mColor == kRBTreeColorBlack)))
+			while((pNodeChild != pNodeRoot) && ((pNodeChild == NULL) || (pNodeChild->color() == kRBTreeColorBlack)))
 			{
 				if(pNodeChild == pNodeChildParent->mpNodeLeft) 
 				{
 					rbtree_node_base* pNodeTemp = pNodeChildParent->mpNodeRight;
 
-					if(pNodeTemp->mColor == kRBTreeColorRed) 
+					if(pNodeTemp->color() == kRBTreeColorRed) 
 					{
-						pNodeTemp->mColor = kRBTreeColorBlack;
-						pNodeChildParent->mColor = kRBTreeColorRed;
-						pNodeRootRef = RBTreeRotateLeft(pNodeChildParent, pNodeRootRef);
+						pNodeTemp->set_color(kRBTreeColorBlack);
+						pNodeChildParent->set_color(kRBTreeColorRed);
+						pNodeRoot = RBTreeRotateLeft(pNodeChildParent, pNodeRoot);
 						pNodeTemp = pNodeChildParent->mpNodeRight;
 					}
 
-					if(((pNodeTemp->mpNodeLeft  == NULL) || (pNodeTemp->mpNodeLeft->mColor  == kRBTreeColorBlack)) &&
-						((pNodeTemp->mpNodeRight == NULL) || (pNodeTemp->mpNodeRight->mColor == kRBTreeColorBlack))) 
+					if(((pNodeTemp->mpNodeLeft  == NULL) || (pNodeTemp->mpNodeLeft->color()  == kRBTreeColorBlack)) &&
+						((pNodeTemp->mpNodeRight == NULL) || (pNodeTemp->mpNodeRight->color() == kRBTreeColorBlack))) 
 					{
-						pNodeTemp->mColor = kRBTreeColorRed;
+						pNodeTemp->set_color(kRBTreeColorRed);
 						pNodeChild = pNodeChildParent;
-						pNodeChildParent = pNodeChildParent->mpNodeParent;
+						pNodeChildParent = pNodeChildParent->parent();
 					} 
 					else 
 					{
-						if((pNodeTemp->mpNodeRight == NULL) || (pNodeTemp->mpNodeRight->mColor == kRBTreeColorBlack)) 
+						if((pNodeTemp->mpNodeRight == NULL) || (pNodeTemp->mpNodeRight->color() == kRBTreeColorBlack)) 
 						{
-							pNodeTemp->mpNodeLeft->mColor = kRBTreeColorBlack;
-							pNodeTemp->mColor = kRBTreeColorRed;
-							pNodeRootRef = RBTreeRotateRight(pNodeTemp, pNodeRootRef);
+							pNodeTemp->mpNodeLeft->set_color(kRBTreeColorBlack);
+							pNodeTemp->set_color(kRBTreeColorRed);
+							pNodeRoot = RBTreeRotateRight(pNodeTemp, pNodeRoot);
 							pNodeTemp = pNodeChildParent->mpNodeRight;
 						}
 
-						pNodeTemp->mColor = pNodeChildParent->mColor;
-						pNodeChildParent->mColor = kRBTreeColorBlack;
+						pNodeTemp->set_color(pNodeChildParent->color());
+						pNodeChildParent->set_color(kRBTreeColorBlack);
 
 						if(pNodeTemp->mpNodeRight) 
-							pNodeTemp->mpNodeRight->mColor = kRBTreeColorBlack;
+							pNodeTemp->mpNodeRight->set_color(kRBTreeColorBlack);
 
-						pNodeRootRef = RBTreeRotateLeft(pNodeChildParent, pNodeRootRef);
+						pNodeRoot = RBTreeRotateLeft(pNodeChildParent, pNodeRoot);
 						break;
 					}
 				} 
@@ -442,53 +490,363 @@ namespace eastl
 					// The following is the same as above, with mpNodeRight <-> mpNodeLeft.
 					rbtree_node_base* pNodeTemp = pNodeChildParent->mpNodeLeft;
 
-					if(pNodeTemp->mColor == kRBTreeColorRed) 
+					if(pNodeTemp->color() == kRBTreeColorRed) 
 					{
-						pNodeTemp->mColor        = kRBTreeColorBlack;
-						pNodeChildParent->mColor = kRBTreeColorRed;
+						pNodeTemp->set_color(kRBTreeColorBlack);
+						pNodeChildParent->set_color(kRBTreeColorRed);
 
-						pNodeRootRef = RBTreeRotateRight(pNodeChildParent, pNodeRootRef);
+						pNodeRoot = RBTreeRotateRight(pNodeChildParent, pNodeRoot);
 						pNodeTemp = pNodeChildParent->mpNodeLeft;
 					}
 
-					if(((pNodeTemp->mpNodeRight == NULL) || (pNodeTemp->mpNodeRight->mColor == kRBTreeColorBlack)) &&
-						((pNodeTemp->mpNodeLeft  == NULL) || (pNodeTemp->mpNodeLeft->mColor  == kRBTreeColorBlack))) 
+					if(((pNodeTemp->mpNodeRight == NULL) || (pNodeTemp->mpNodeRight->color() == kRBTreeColorBlack)) &&
+						((pNodeTemp->mpNodeLeft  == NULL) || (pNodeTemp->mpNodeLeft->color()  == kRBTreeColorBlack))) 
 					{
-						pNodeTemp->mColor = kRBTreeColorRed;
+						pNodeTemp->set_color(kRBTreeColorRed);
 						pNodeChild       = pNodeChildParent;
-						pNodeChildParent = pNodeChildParent->mpNodeParent;
+						pNodeChildParent = pNodeChildParent->parent();
 					} 
 					else 
 					{
-						if((pNodeTemp->mpNodeLeft == NULL) || (pNodeTemp->mpNodeLeft->mColor == kRBTreeColorBlack)) 
+						if((pNodeTemp->mpNodeLeft == NULL) || (pNodeTemp->mpNodeLeft->color() == kRBTreeColorBlack)) 
 						{
-							pNodeTemp->mpNodeRight->mColor = kRBTreeColorBlack;
-							pNodeTemp->mColor              = kRBTreeColorRed;
+							pNodeTemp->mpNodeRight->set_color(kRBTreeColorBlack);
+							pNodeTemp->set_color(kRBTreeColorRed);
 
-							pNodeRootRef = RBTreeRotateLeft(pNodeTemp, pNodeRootRef);
+							pNodeRoot = RBTreeRotateLeft(pNodeTemp, pNodeRoot);
 							pNodeTemp = pNodeChildParent->mpNodeLeft;
 						}
 
-						pNodeTemp->mColor = pNodeChildParent->mColor;
-						pNodeChildParent->mColor = kRBTreeColorBlack;
+						pNodeTemp->set_color(pNodeChildParent->color());
+						pNodeChildParent->set_color(kRBTreeColorBlack);
 
 						if(pNodeTemp->mpNodeLeft) 
-							pNodeTemp->mpNodeLeft->mColor = kRBTreeColorBlack;
+							pNodeTemp->mpNodeLeft->set_color(kRBTreeColorBlack);
 
-						pNodeRootRef = RBTreeRotateRight(pNodeChildParent, pNodeRootRef);
+						pNodeRoot = RBTreeRotateRight(pNodeChildParent, pNodeRoot);
 						break;
 					}
 				}
 			}
 
 			if(pNodeChild)
-				pNodeChild->mColor = kRBTreeColorBlack;
+				pNodeChild->set_color(kRBTreeColorBlack);
 		}
 
+		pNodeAnchor->set_parent(pNodeRoot);
+
 	} // RBTreeErase
 
 
 
+
+	/// RBTreeGetBlackHeight
+	/// Returns the number of black nodes on each path from pNode (inclusive) down to a NULL child.
+	///
+	static size_t RBTreeGetBlackHeight(const rbtree_node_base* pNode)
+	{
+		size_t nHeight = 0;
+
+		for(; pNode; pNode = pNode->mpNodeLeft)
+		{
+			if(pNode->color() == kRBTreeColorBlack)
+				++nHeight;
+		}
+
+		return nHeight;
+	}
+
+
+
+	/// RBTreeDetachSubtree
+	/// Makes pNode the root of a tree of its own for RBTreeJoinSubtrees, which needs the 
+	/// roots of the trees it joins to be black. Recoloring a red root adds one to nHeight.
+	///
+	static rbtree_node_base* RBTreeDetachSubtree(rbtree_node_base* pNode, size_t& nHeight)
+	{
+		if(pNode)
+		{
+			pNode->set_parent(NULL);
+
+			if(pNode->color() == kRBTreeColorRed)
+			{
+				pNode->set_color(kRBTreeColorBlack);
+				++nHeight;
+			}
+		}
+
+		return pNode;
+	}
+
+
+
+	/// RBTreeJoinSubtrees
+	/// Joins the trees with roots pNodeLeft and pNodeRight, with black heights nLeftHeight
+	/// and nRightHeight, and the node pNode which goes between them. Any of the trees may 
+	/// be empty, and the roots of those which aren't must be black and have no parent. 
+	/// Returns the root of the result, which is black, and sets nHeight to its black height.
+	///
+	/// If one tree is taller than the other, we go down the side of the taller tree which 
+	/// faces the other, to the first black node (or NULL child) of the other tree's black
+	/// height. pNode replaces that node, and has it and the other tree as its children. 
+	/// We make pNode red, which keeps the black counts the same, and then fix any red 
+	/// violation as an insertion does. This takes O(difference in heights) time.
+	///
+	static rbtree_node_base* RBTreeJoinSubtrees(rbtree_node_base* pNodeLeft,  size_t nLeftHeight,
+												rbtree_node_base* pNode,
+												rbtree_node_base* pNodeRight, size_t nRightHeight,
+												size_t& nHeight)
+	{
+		if(nLeftHeight == nRightHeight)
+		{
+			pNode->mpNodeLeft  = pNodeLeft;
+			pNode->mpNodeRight = pNodeRight;
+			pNode->set_parent_and_color(NULL, kRBTreeColorBlack);
+
+			if(pNodeLeft)
+				pNodeLeft->set_parent(pNode);
+			if(pNodeRight)
+				pNodeRight->set_parent(pNode);
+
+			#if EASTL_RBTREE_ORDER_STATISTICS
+				pNode->mnSubtreeSize = RBTreeGetSubtreeSize(pNodeLeft) + RBTreeGetSubtreeSize(pNodeRight) + 1;
+			#endif
+
+			nHeight = nLeftHeight + 1;
+			return pNode;
+		}
+
+		const bool        bLeftTaller    = (nLeftHeight > nRightHeight);
+		rbtree_node_base* pNodeRoot      = bLeftTaller ? pNodeLeft  : pNodeRight;
+		rbtree_node_base* pNodeOther     = bLeftTaller ? pNodeRight : pNodeLeft;
+		const size_t      nOtherHeight   = bLeftTaller ? nRightHeight : nLeftHeight;
+		size_t            nCurrentHeight = bLeftTaller ? nLeftHeight  : nRightHeight;
+		rbtree_node_base* pNodeParent    = NULL;
+		rbtree_node_base* pNodeChild     = pNodeRoot;
+
+		while(pNodeChild && ((pNodeChild->color() == kRBTreeColorRed) || (nCurrentHeight != nOtherHeight)))
+		{
+			if(pNodeChild->color() == kRBTreeColorBlack)
+				--nCurrentHeight;
+
+			pNodeParent = pNodeChild;
+			pNodeChild  = bLeftTaller ? pNodeChild->mpNodeRight : pNodeChild->mpNodeLeft;
+		}
+
+		EASTL_ASSERT(pNodeParent != NULL); // pNodeRoot is black and taller than the other tree, so we went down at least once.
+
+		if(bLeftTaller)
+		{
+			pNode->mpNodeLeft        = pNodeChild;
+			pNode->mpNodeRight       = pNodeOther;
+			pNodeParent->mpNodeRight = pNode;
+		}
+		else
+		{
+			pNode->mpNodeLeft        = pNodeOther;
+			pNode->mpNodeRight       = pNodeChild;
+			pNodeParent->mpNodeLeft  = pNode;
+		}
+
+		pNode->set_parent_and_color(pNodeParent, kRBTreeColorRed);
+
+		if(pNodeChild)
+			pNodeChild->set_parent(pNode);
+		if(pNodeOther)
+			pNodeOther->set_parent(pNode);
+
+		#if EASTL_RBTREE_ORDER_STATISTICS
+			pNode->mnSubtreeSize = RBTreeGetSubtreeSize(pNodeChild) + RBTreeGetSubtreeSize(pNodeOther) + 1;
+
+			const size_t nAddedCount = RBTreeGetSubtreeSize(pNodeOther) + 1;
+			for(rbtree_node_base* pNodeAncestor = pNodeParent; pNodeAncestor; pNodeAncestor = pNodeAncestor->parent())
+				pNodeAncestor->mnSubtreeSize += nAddedCount;
+		#endif
+
+		pNodeRoot = RBTreeRebalanceAfterInsert(pNode, pNodeRoot);
+		nHeight   = bLeftTaller ? nLeftHeight : nRightHeight;
+
+		if(pNodeRoot->color() == kRBTreeColorRed) // If rebalancing recolored the root...
+		{
+			pNodeRoot->set_color(kRBTreeColorBlack);
+			++nHeight;
+		}
+
+		return pNodeRoot;
+	}
+
+
+
+	/// RBTreeSetRoot
+	/// Makes pNodeRoot (which may be NULL) the root of the tree with the given anchor,
+	/// and updates the anchor's leftmost and rightmost nodes.
+	///
+	static void RBTreeSetRoot(rbtree_node_base* pNodeAnchor, rbtree_node_base* pNodeRoot)
+	{
+		pNodeAnchor->set_parent(pNodeRoot);
+
+		if(pNodeRoot)
+		{
+			pNodeRoot->set_parent(pNodeAnchor);
+			pNodeAnchor->mpNodeLeft  = RBTreeGetMinChild(pNodeRoot);
+			pNodeAnchor->mpNodeRight = RBTreeGetMaxChild(pNodeRoot);
+		}
+		else
+		{
+			pNodeAnchor->mpNodeLeft  = pNodeAnchor;
+			pNodeAnchor->mpNodeRight = pNodeAnchor;
+		}
+	}
+
+
+
+	/// RBTreeJoin
+	/// Moves all the nodes of the tree with anchor pNodeAnchorRight to the end of the tree 
+	/// with anchor pNodeAnchor, leaving the former empty. All the nodes of the right tree
+	/// must belong after those of the left tree. This takes O(log n) time.
+	///
+	EASTL_API void RBTreeJoin(rbtree_node_base* pNodeAnchor, rbtree_node_base* pNodeAnchorRight)
+	{
+		if(!pNodeAnchorRight->parent()) // If there is nothing to join...
+			return;
+
+		// We take the first node of the right tree out of it, to go between the two trees.
+		rbtree_node_base* const pNode = pNodeAnchorRight->mpNodeLeft;
+		RBTreeErase(pNode, pNodeAnchorRight);
+
+		size_t nLeftHeight  = RBTreeGetBlackHeight(pNodeAnchor->parent());
+		size_t nRightHeight = RBTreeGetBlackHeight(pNodeAnchorRight->parent());
+		size_t nHeight;
+
+		rbtree_node_base* const pNodeLeft  = RBTreeDetachSubtree(pNodeAnchor->parent(),      nLeftHeight);
+		rbtree_node_base* const pNodeRight = RBTreeDetachSubtree(pNodeAnchorRight->parent(), nRightHeight);
+
+		RBTreeSetRoot(pNodeAnchor, RBTreeJoinSubtrees(pNodeLeft, nLeftHeight, pNode, pNodeRight, nRightHeight, nHeight));
+		RBTreeSetRoot(pNodeAnchorRight, NULL);
+	}
+
+
+
+	/// RBTreeSplit
+	/// Moves pNode and all the nodes after it from the tree with anchor pNodeAnchor to the
+	/// empty tree with anchor pNodeAnchorRight. This takes O(log n) time.
+	///
+	/// We go up from pNode to the root. pNode's left subtree starts the left result, and 
+	/// it and its right subtree the right result. Each ancestor joins whichever result is
+	/// on the other side from it, along with its other subtree. Each join takes time in
+	/// proportion to the difference in the black heights of the trees it joins, and these
+	/// sum to the height of the tree.
+	///
+	EASTL_API void RBTreeSplit(rbtree_node_base* pNodeAnchor, rbtree_node_base* pNode, rbtree_node_base* pNodeAnchorRight)
+	{
+		// The subtrees of a node have the same black height, which we track as we go up.
+		size_t nChildHeight = RBTreeGetBlackHeight(pNode->mpNodeLeft);
+		size_t nLeftHeight  = nChildHeight;
+		size_t nRightHeight = nChildHeight;
+
+		rbtree_node_base* pNodeParent = pNode->parent();
+		bool              bFromLeft   = (pNodeParent != pNodeAnchor) && (pNode == pNodeParent->mpNodeLeft);
+		rbtree_node_base* pNodeLeft   = RBTreeDetachSubtree(pNode->mpNodeLeft,  nLeftHeight);
+		rbtree_node_base* pNodeRight  = RBTreeDetachSubtree(pNode->mpNodeRight, nRightHeight);
+
+		if(pNode->color() == kRBTreeColorBlack)
+			++nChildHeight; // nChildHeight is now the original black height of pNode's subtree.
+
+		pNodeRight = RBTreeJoinSubtrees(NULL, 0, pNode, pNodeRight, nRightHeight, nRightHeight);
+
+		while(pNodeParent != pNodeAnchor)
+		{
+			// We need the ancestor's original links and color before we relink it.
+			rbtree_node_base* const pNodeAncestor = pNodeParent;
+			const bool              bAncestorLeft = bFromLeft;
+
+			pNodeParent = pNodeAncestor->parent();
+			bFromLeft   = (pNodeParent != pNodeAnchor) && (pNodeAncestor == pNodeParent->mpNodeLeft);
+
+			const bool bBlack         = (pNodeAncestor->color() == kRBTreeColorBlack);
+			size_t     nSiblingHeight = nChildHeight;
+
+			if(bAncestorLeft) // If we came up from the ancestor's left, it and its right subtree belong after the split.
+			{
+				rbtree_node_base* const pNodeSibling = RBTreeDetachSubtree(pNodeAncestor->mpNodeRight, nSiblingHeight);
+				pNodeRight = RBTreeJoinSubtrees(pNodeRight, nRightHeight, pNodeAncestor, pNodeSibling, nSiblingHeight, nRightHeight);
+			}
+			else
+			{
+				rbtree_node_base* const pNodeSibling = RBTreeDetachSubtree(pNodeAncestor->mpNodeLeft, nSiblingHeight);
+				pNodeLeft = RBTreeJoinSubtrees(pNodeSibling, nSiblingHeight, pNodeAncestor, pNodeLeft, nLeftHeight, nLeftHeight);
+			}
+
+			if(bBlack)
+				++nChildHeight;
+		}
+
+		RBTreeSetRoot(pNodeAnchor,      pNodeLeft);
+		RBTreeSetRoot(pNodeAnchorRight, pNodeRight);
+	}
+
+
+
+	#if EASTL_RBTREE_ORDER_STATISTICS
+
+		/// RBTreeGetIndex
+		/// Returns the index of the given node in the sorted order of its tree, which
+		/// is the number of nodes which precede it. If pNode is the anchor (end()), 
+		/// this is the size of the tree.
+		///
+		EASTL_API size_t RBTreeGetIndex(const rbtree_node_base* pNode)
+		{
+			const rbtree_node_base* pNodeParent = pNode->parent();
+
+			// We detect the anchor the same way as RBTreeDecrement does.
+			if(!pNodeParent) // If pNode is the anchor of an empty tree...
+				return 0;
+
+			if((pNodeParent->parent() == pNode) && (pNode->color() == kRBTreeColorRed)) // If pNode is the anchor...
+				return pNodeParent->mnSubtreeSize;
+
+			size_t nIndex = RBTreeGetSubtreeSize(pNode->mpNodeLeft);
+
+			// Walk up to the root, which is the node whose parent (the anchor) has it as its parent.
+			for(; pNodeParent->parent() != pNode; pNode = pNodeParent, pNodeParent = pNodeParent->parent())
+			{
+				if(pNode == pNodeParent->mpNodeRight)
+					nIndex += RBTreeGetSubtreeSize(pNodeParent->mpNodeLeft) + 1;
+			}
+
+			return nIndex;
+		}
+
+
+
+		/// RBTreeSelect
+		/// Returns the node at the given index in the sorted order of the tree with the
+		/// given root, or NULL if nIndex is not less than the size of the tree.
+		///
+		EASTL_API rbtree_node_base* RBTreeSelect(const rbtree_node_base* pNodeRoot, size_t nIndex)
+		{
+			while(pNodeRoot)
+			{
+				const size_t nLeftSize = RBTreeGetSubtreeSize(pNodeRoot->mpNodeLeft);
+
+				if(nIndex < nLeftSize)
+					pNodeRoot = pNodeRoot->mpNodeLeft;
+				else if(nIndex == nLeftSize)
+					break;
+				else
+				{
+					nIndex   -= (nLeftSize + 1);
+					pNodeRoot = pNodeRoot->mpNodeRight;
+				}
+			}
+
+			return const_cast<rbtree_node_base*>(pNodeRoot);
+		}
+
+	#endif // EASTL_RBTREE_ORDER_STATISTICS
+
+
+
 } // namespace eastl
 
 
@@ -0,0 +1,237 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/task_scheduler.h>
+
+#if EASTL_DEFAULT_TASK_SCHEDULER_ENABLED
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <atomic>
+	#include <condition_variable>
+	#include <mutex>
+	#include <thread>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+
+namespace eastl
+{
+
+	#if EASTL_DEFAULT_TASK_SCHEDULER_ENABLED
+
+		// A batch is the set of tasks submitted by a single call to run. It lives on the stack of
+		// the submitting thread and is linked into the scheduler's list of pending batches until
+		// all of its task indices have been claimed. Any thread claims an index with a single
+		// atomic increment, which is what lets idle workers steal work from a busy thread without
+		// the batch having to be split up front.
+		struct TaskBatch
+		{
+			task_scheduler::task_function mpFunction;
+			void*                         mpContext;
+			size_t                        mnCount;
+			std::atomic<size_t>           mnNext;       // Next unclaimed task index.
+			std::atomic<size_t>           mnDone;       // Number of completed tasks.
+			size_t                        mnHelpers;    // Number of other threads currently executing tasks from this batch. Guarded by Impl::mMutex.
+			TaskBatch*                    mpPrev;
+			TaskBatch*                    mpNext;
+
+			TaskBatch(task_scheduler::task_function pFunction, void* pContext, size_t count)
+				: mpFunction(pFunction), mpContext(pContext), mnCount(count), mnNext(0), mnDone(0), mnHelpers(0), mpPrev(NULL), mpNext(NULL) {}
+
+			bool HasUnclaimedTasks() const
+				{ return mnNext.load(std::memory_order_relaxed) < mnCount; }
+
+			void Execute()
+			{
+				for(size_t i; (i = mnNext.fetch_add(1, std::memory_order_relaxed)) < mnCount; )
+				{
+					mpFunction(mpContext, i);
+					mnDone.fetch_add(1, std::memory_order_release);
+				}
+			}
+		};
+
+
+		struct default_task_scheduler::Impl
+		{
+			std::mutex              mMutex;
+			std::condition_variable mCondition;     // Signaled when a batch is published or when the last helper of a batch leaves it.
+			TaskBatch*              mpHead;         // Most recently published batch. Guarded by mMutex.
+			bool                    mbStop;         // Guarded by mMutex.
+			std::thread*            mpThreads;
+			size_t                  mnThreadCount;
+
+			Impl() : mpHead(NULL), mbStop(false), mpThreads(NULL), mnThreadCount(0) {}
+
+			// Newest batches are preferred, as they are the nested batches that older ones are waiting on.
+			TaskBatch* FindBatch() const
+			{
+				for(TaskBatch* pBatch = mpHead; pBatch; pBatch = pBatch->mpNext)
+				{
+					if(pBatch->HasUnclaimedTasks())
+						return pBatch;
+				}
+				return NULL;
+			}
+
+			void Link(TaskBatch* pBatch)
+			{
+				pBatch->mpNext = mpHead;
+				if(mpHead)
+					mpHead->mpPrev = pBatch;
+				mpHead = pBatch;
+			}
+
+			void Unlink(TaskBatch* pBatch)
+			{
+				if(pBatch->mpPrev)
+					pBatch->mpPrev->mpNext = pBatch->mpNext;
+				else
+					mpHead = pBatch->mpNext;
+				if(pBatch->mpNext)
+					pBatch->mpNext->mpPrev = pBatch->mpPrev;
+				pBatch->mpPrev = pBatch->mpNext = NULL;
+			}
+
+			// Executes tasks from a batch published by another thread. The helper count keeps the
+			// batch (and thus the submitter's stack frame) alive until we are done touching it.
+			void Help(TaskBatch* pBatch, std::unique_lock<std::mutex>& lock)
+			{
+				++pBatch->mnHelpers;
+				lock.unlock();
+				pBatch->Execute();
+				lock.lock();
+
+				if((--pBatch->mnHelpers == 0) && (pBatch->mnDone.load(std::memory_order_acquire) == pBatch->mnCount))
+					mCondition.notify_all();
+			}
+
+			void WorkerLoop()
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+
+				while(!mbStop)
+				{
+					if(TaskBatch* pBatch = FindBatch())
+						Help(pBatch, lock);
+					else
+						mCondition.wait(lock);
+				}
+			}
+		};
+
+
+		default_task_scheduler::default_task_scheduler(size_t threadCount)
+			: mpImpl(new Impl)
+		{
+			if(threadCount == 0)
+			{
+				const size_t hardwareThreadCount = (size_t)std::thread::hardware_concurrency();
+				threadCount = (hardwareThreadCount > 1) ? (hardwareThreadCount - 1) : 0;
+			}
+
+			if(threadCount)
+			{
+				mpImpl->mpThreads     = new std::thread[threadCount];
+				mpImpl->mnThreadCount = threadCount;
+
+				for(size_t i = 0; i < threadCount; ++i)
+					mpImpl->mpThreads[i] = std::thread(&Impl::WorkerLoop, mpImpl);
+			}
+		}
+
+
+		default_task_scheduler::~default_task_scheduler()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mpImpl->mMutex);
+				EASTL_ASSERT(mpImpl->mpHead == NULL); // The scheduler must not be destroyed while a call to run is in progress.
+				mpImpl->mbStop = true;
+			}
+			mpImpl->mCondition.notify_all();
+
+			for(size_t i = 0; i < mpImpl->mnThreadCount; ++i)
+				mpImpl->mpThreads[i].join();
+
+			delete[] mpImpl->mpThreads;
+			delete mpImpl;
+		}
+
+
+		size_t default_task_scheduler::concurrency() const
+		{
+			return mpImpl->mnThreadCount + 1;
+		}
+
+
+		void default_task_scheduler::run(task_function pFunction, void* pContext, size_t count)
+		{
+			if((count < 2) || (mpImpl->mnThreadCount == 0))
+			{
+				for(size_t i = 0; i < count; ++i)
+					pFunction(pContext, i);
+				return;
+			}
+
+			TaskBatch batch(pFunction, pContext, count);
+
+			std::unique_lock<std::mutex> lock(mpImpl->mMutex);
+			mpImpl->Link(&batch);
+			lock.unlock();
+
+			// The calling thread executes one task itself, so at most count - 1 workers are useful.
+			// A notification may also wake a thread that is waiting inside run, which is fine:
+			// such a thread helps with pending batches just like a worker does.
+			const size_t wakeCount = ((count - 1) < mpImpl->mnThreadCount) ? (count - 1) : mpImpl->mnThreadCount;
+			for(size_t i = 0; i < wakeCount; ++i)
+				mpImpl->mCondition.notify_one();
+
+			batch.Execute();
+
+			// All of our tasks are claimed. Unlinking the batch prevents any further helpers from
+			// attaching to it; those already attached may still be executing their last task.
+			// Rather than block, help with other pending batches (typically the nested batches
+			// created by our own tasks) until ours completes.
+			lock.lock();
+			mpImpl->Unlink(&batch);
+
+			while((batch.mnDone.load(std::memory_order_acquire) != count) || batch.mnHelpers)
+			{
+				if(TaskBatch* pBatch = mpImpl->FindBatch())
+					mpImpl->Help(pBatch, lock);
+				else
+					mpImpl->mCondition.wait(lock);
+			}
+		}
+
+	#endif // EASTL_DEFAULT_TASK_SCHEDULER_ENABLED
+
+
+	/// gpDefaultTaskScheduler
+	/// User-installed default scheduler, or NULL to use the built-in one.
+	static task_scheduler* gpDefaultTaskScheduler = NULL;
+
+	EASTL_API task_scheduler& GetDefaultTaskScheduler()
+	{
+		if(gpDefaultTaskScheduler)
+			return *gpDefaultTaskScheduler;
+
+		#if EASTL_DEFAULT_TASK_SCHEDULER_ENABLED
+			static default_task_scheduler sDefaultTaskScheduler;
+		#else
+			static serial_task_scheduler sDefaultTaskScheduler;
+		#endif
+
+		return sDefaultTaskScheduler;
+	}
+
+	EASTL_API task_scheduler* SetDefaultTaskScheduler(task_scheduler* pScheduler)
+	{
+		task_scheduler* const pPrevScheduler = gpDefaultTaskScheduler;
+		gpDefaultTaskScheduler = pScheduler;
+		return pPrevScheduler;
+	}
+
+} // namespace eastl
@@ -26,6 +26,7 @@ int TestAlgorithm();
 int TestAllocator();
 int TestAny();
 int TestArray();
+int TestBTree();
 int TestBitVector();
 int TestBitset();
 int TestCharTraits();
@@ -41,6 +42,8 @@ int TestFixedSList();
 int TestFixedSet();
 int TestFixedString();
 int TestFixedVector();
+int TestFlatHash();
+int TestFrozenVectorMap();
 int TestFunctional();
 int TestHash();
 int TestHeap();
@@ -57,8 +60,10 @@ int TestMeta();
 int TestNumericLimits();
 int TestOptional();
 int TestRandom();
+int TestRankSelect();
 int TestRatio();
 int TestRingBuffer();
+int TestRoaringBitmap();
 int TestSList();
 int TestSegmentedVector();
 int TestSet();
@@ -71,6 +76,7 @@ int TestStringHashMap();
 int TestStringMap();
 int TestStringView();
 int TestTuple();
+int TestTupleVector();
 int TestTypeTraits();
 int TestUtility();
 int TestVariant();
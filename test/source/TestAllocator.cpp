@@ -8,8 +8,16 @@
 #include <EASTL/allocator_malloc.h>
 #include <EASTL/fixed_allocator.h>
 #include <EASTL/core_allocator_adapter.h>
+#include <EASTL/pool_allocator.h>
+#include <EASTL/arena_allocator.h>
 #include <EASTL/list.h>
+#include <EASTL/map.h>
+#include <EASTL/hash_map.h>
+#include <EASTL/string_map.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
 #include <EAStdC/EAString.h>
+#include <eathread/eathread_thread.h>
 
 
 
@@ -234,6 +242,295 @@ static int TestAllocatorMalloc()
 
 
 
+#if EASTL_THREAD_SUPPORT_AVAILABLE
+	// Builds a list with pool_allocator, which the main thread later destroys, so that
+	// blocks are freed by a different thread than the one that allocated them.
+	struct PoolAllocatorTestThread : public EA::Thread::IRunnable
+	{
+		EA::Thread::ThreadParameters                 mThreadParams;
+		EA::Thread::Thread                           mThread;
+		eastl::list<int, eastl::pool_allocator>*     mpList;
+		int                                          mnErrorCount;
+
+		PoolAllocatorTestThread() : mThreadParams(), mThread(), mpList(NULL), mnErrorCount(0) {}
+		PoolAllocatorTestThread(const PoolAllocatorTestThread&){}
+		void operator=(const PoolAllocatorTestThread&){}
+
+		intptr_t Run(void*)
+		{
+			int& nErrorCount = mnErrorCount; // declare nErrorCount so that EATEST_VERIFY can work, as it depends on it being declared.
+
+			eastl::map<int, int, eastl::less<int>, eastl::pool_allocator> intMap;
+
+			for(int i = 0; i < 10000; i++)
+			{
+				intMap[i] = i;
+				mpList->push_back(i);
+			}
+
+			for(int i = 0; i < 10000; i += 2)
+				intMap.erase(i);
+
+			EATEST_VERIFY(intMap.size() == 5000);
+			EATEST_VERIFY(mpList->size() == 10000);
+
+			return nErrorCount;
+		}
+	};
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// TestPoolAllocator
+//
+static int TestPoolAllocator()
+{
+	int nErrorCount = 0;
+
+	{
+		// Size classes
+		EATEST_VERIFY(eastl::pool_allocator::pooled_size(0)  == 16);
+		EATEST_VERIFY(eastl::pool_allocator::pooled_size(1)  == 16);
+		EATEST_VERIFY(eastl::pool_allocator::pooled_size(16) == 16);
+		EATEST_VERIFY(eastl::pool_allocator::pooled_size(17) == 32);
+		EATEST_VERIFY(eastl::pool_allocator::pooled_size(40) == 48);
+		EATEST_VERIFY(eastl::pool_allocator::pooled_size(129) == 160);
+		EATEST_VERIFY(eastl::pool_allocator::pooled_size(EASTL_POOL_ALLOCATOR_MAX_SIZE) >= EASTL_POOL_ALLOCATOR_MAX_SIZE);
+		EATEST_VERIFY(eastl::pool_allocator::pooled_size(EASTL_POOL_ALLOCATOR_MAX_SIZE + 1) == 0);
+
+		for(size_t n = 0; n <= EASTL_POOL_ALLOCATOR_MAX_SIZE; n++)
+			EATEST_VERIFY(eastl::pool_allocator::pooled_size(n) >= n);
+	}
+
+	{
+		// Allocation, alignment and deallocation through a different instance.
+		eastl::pool_allocator a("pool a"), b("pool b");
+		EATEST_VERIFY(EA::StdC::Strcmp(a.get_name(), "pool a") == 0 || !EASTL_NAME_ENABLED);
+		EATEST_VERIFY(a == b);
+
+		void* pArray[64];
+
+		for(size_t n = 0; n < EAArrayCount(pArray); n++)
+		{
+			const size_t size = 1 + (n * 23) % 1000; // Both pooled and passed through sizes.
+			pArray[n] = a.allocate(size);
+			EATEST_VERIFY(pArray[n] != NULL);
+			EATEST_VERIFY(((uintptr_t)pArray[n] % EASTL_SYSTEM_ALLOCATOR_MIN_ALIGNMENT) == 0);
+			memset(pArray[n], (int)n, size);
+		}
+
+		for(size_t n = 0; n < EAArrayCount(pArray); n++)
+		{
+			const size_t size = 1 + (n * 23) % 1000;
+			EATEST_VERIFY(((uint8_t*)pArray[n])[size - 1] == (uint8_t)n);
+			b.deallocate(pArray[n], size);
+		}
+
+		for(size_t alignment = 1; alignment <= 256; alignment *= 2)
+		{
+			for(size_t n = alignment; n <= 1024; n += alignment)
+			{
+				void* p = a.allocate(n, alignment, 0);
+				EATEST_VERIFY(p && (((uintptr_t)p % alignment) == 0));
+				memset(p, 0, n);
+				a.deallocate(p, n);
+			}
+		}
+
+		a.deallocate(NULL, 0);
+	}
+
+	{
+		// Containers, including string_map, which frees its keys with a size of 0.
+		eastl::list<int, eastl::pool_allocator> intList;
+		eastl::map<int, int, eastl::less<int>, eastl::pool_allocator> intMap;
+		eastl::hash_map<int, int, eastl::hash<int>, eastl::equal_to<int>, eastl::pool_allocator> intHashMap;
+		eastl::string_map<int, eastl::str_less<const char*>, eastl::pool_allocator> stringMap;
+
+		for(int i = 0; i < 1000; i++)
+		{
+			intList.push_back(i);
+			intMap[i] = i;
+			intHashMap[i] = i;
+		}
+
+		stringMap.insert("apple");
+		stringMap.insert("banana");
+		stringMap["carrot"] = 3;
+
+		for(int i = 0; i < 1000; i += 2)
+		{
+			intMap.erase(i);
+			intHashMap.erase(i);
+		}
+
+		stringMap.erase("banana");
+
+		EATEST_VERIFY(intList.size() == 1000);
+		EATEST_VERIFY((intMap.size() == 500) && (intMap.find(1)->second == 1));
+		EATEST_VERIFY((intHashMap.size() == 500) && (intHashMap.find(999)->second == 999));
+		EATEST_VERIFY((stringMap.size() == 2) && (stringMap.find("carrot")->second == 3));
+
+		eastl::list<int, eastl::pool_allocator> intList2(intList);
+		intList.splice(intList.end(), intList2); // Allowed because all pool_allocators are equal.
+		EATEST_VERIFY((intList.size() == 2000) && intList2.empty());
+
+		eastl::pool_allocator::flush_thread_cache();
+	}
+
+	#if EASTL_THREAD_SUPPORT_AVAILABLE
+		{
+			PoolAllocatorTestThread thread[4];
+			eastl::list<int, eastl::pool_allocator> intList[EAArrayCount(thread)];
+
+			for(size_t i = 0; i < EAArrayCount(thread); i++)
+			{
+				thread[i].mpList = &intList[i];
+				thread[i].mThreadParams.mpName = "PoolAllocatorTestThread";
+				thread[i].mThread.Begin(&thread[i], NULL, &thread[i].mThreadParams);
+			}
+
+			for(size_t i = 0; i < EAArrayCount(thread); i++)
+			{
+				thread[i].mThread.WaitForEnd();
+				nErrorCount += thread[i].mnErrorCount;
+			}
+
+			for(size_t i = 0; i < EAArrayCount(thread); i++)
+			{
+				EATEST_VERIFY(intList[i].size() == 10000);
+				EATEST_VERIFY(intList[i].back() == 9999);
+				intList[i].clear(); // The nodes were allocated by another thread.
+			}
+		}
+	#endif
+
+	return nErrorCount;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// TestArenaAllocator
+//
+static int TestArenaAllocator()
+{
+	using namespace eastl;
+
+	int nErrorCount = 0;
+
+	{
+		// Bump allocation, alignment and growth.
+		monotonic_arena arena(256);
+		EATEST_VERIFY((arena.size() == 0) && (arena.capacity() == 0));
+
+		char* p1 = (char*)arena.allocate(10);
+		char* p2 = (char*)arena.allocate(10);
+		EATEST_VERIFY(p1 && p2 && (p2 > p1) && ((p2 - p1) < 32));
+		EATEST_VERIFY(((uintptr_t)p1 % EASTL_ALLOCATOR_MIN_ALIGNMENT) == 0);
+		EATEST_VERIFY(((uintptr_t)p2 % EASTL_ALLOCATOR_MIN_ALIGNMENT) == 0);
+
+		for(size_t alignment = 1; alignment <= 128; alignment *= 2)
+		{
+			void* p = arena.allocate(3, alignment);
+			EATEST_VERIFY(((uintptr_t)p % alignment) == 0);
+
+			p = arena.allocate(8, alignment, 4);
+			EATEST_VERIFY((((uintptr_t)p + 4) % alignment) == 0);
+		}
+
+		void* pLarge = arena.allocate(10000); // Larger than any block so far.
+		EATEST_VERIFY(pLarge != NULL);
+		memset(pLarge, 0, 10000);
+		EATEST_VERIFY(arena.capacity() >= 10000);
+		EATEST_VERIFY(arena.size() >= 10020);
+
+		// reset keeps the blocks and hands out the same memory again.
+		const size_t capacity = arena.capacity();
+		arena.reset();
+		EATEST_VERIFY(arena.size() == 0);
+		EATEST_VERIFY(arena.capacity() == capacity);
+
+		EATEST_VERIFY(arena.allocate(9000) != NULL); // Skips the small blocks and reuses the large one.
+		EATEST_VERIFY(arena.capacity() == capacity);
+		for(int i = 0; i < 10; i++)
+			arena.allocate(100); // Goes to the rest of the large block, then to the small blocks that were skipped.
+		EATEST_VERIFY(arena.capacity() == capacity);
+
+		arena.release();
+		EATEST_VERIFY((arena.size() == 0) && (arena.capacity() == 0));
+		EATEST_VERIFY(arena.allocate(1) != NULL);
+	}
+
+	{
+		// User-supplied initial buffer.
+		char buffer[1024];
+		monotonic_arena arena(buffer, sizeof(buffer));
+		EATEST_VERIFY(arena.capacity() >= 900);
+
+		void* p = arena.allocate(100);
+		EATEST_VERIFY((p >= buffer) && (p < buffer + sizeof(buffer)));
+
+		p = arena.allocate(2000); // Doesn't fit; a block is allocated.
+		EATEST_VERIFY(p && ((p < buffer) || (p >= buffer + sizeof(buffer))));
+
+		arena.release(); // Keeps the buffer, frees the block.
+		EATEST_VERIFY((arena.capacity() >= 900) && (arena.capacity() < sizeof(buffer)));
+
+		p = arena.allocate(100);
+		EATEST_VERIFY((p >= buffer) && (p < buffer + sizeof(buffer)));
+	}
+
+	{
+		// Containers
+		monotonic_arena arena;
+
+		for(int frame = 0; frame < 3; frame++)
+		{
+			{
+				arena_allocator allocator(&arena);
+
+				vector<int, arena_allocator> intVector(allocator);
+				list<int, arena_allocator> intList(allocator);
+				map<int, int, less<int>, arena_allocator> intMap(less<int>(), allocator);
+				hash_map<int, int, hash<int>, equal_to<int>, arena_allocator> intHashMap(allocator);
+				basic_string<char, arena_allocator> str(allocator);
+
+				for(int i = 0; i < 1000; i++)
+				{
+					intVector.push_back(i);
+					intList.push_back(i);
+					intMap[i] = i;
+					intHashMap[i] = i;
+					str += 'a';
+				}
+
+				for(int i = 0; i < 1000; i += 2)
+				{
+					intMap.erase(i);
+					intHashMap.erase(i);
+				}
+
+				EATEST_VERIFY((intVector.size() == 1000) && (intVector.back() == 999));
+				EATEST_VERIFY((intList.size() == 1000) && (intList.back() == 999));
+				EATEST_VERIFY((intMap.size() == 500) && (intMap.find(999)->second == 999));
+				EATEST_VERIFY((intHashMap.size() == 500) && (intHashMap.find(1)->second == 1));
+				EATEST_VERIFY(str.size() == 1000);
+				EATEST_VERIFY(intVector.get_allocator() == allocator);
+				EATEST_VERIFY(intVector.get_allocator().get_arena() == &arena);
+			}
+
+			const size_t capacity = arena.capacity();
+			arena.reset();
+			EATEST_VERIFY(arena.capacity() == capacity);
+		}
+
+		EATEST_VERIFY(arena_allocator(&arena) != arena_allocator());
+	}
+
+	return nErrorCount;
+}
+
+
 #if EASTL_DLL
 	void* operator new[](size_t size, const char* pName, int flags, unsigned debugFlags, const char* file, int line);
 	void* operator new[](size_t size, size_t alignment, size_t alignmentOffset, const char* pName, int flags, unsigned debugFlags, const char* file, int line);
@@ -348,6 +645,8 @@ int TestAllocator()
 	
 	nErrorCount += TestFixedAllocator();
 	nErrorCount += TestAllocatorMalloc();
+	nErrorCount += TestPoolAllocator();
+	nErrorCount += TestArenaAllocator();
 	nErrorCount += TestCoreAllocatorAdapter();
 	nErrorCount += TestSwapAllocator();
 
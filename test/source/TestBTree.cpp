@@ -0,0 +1,448 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+
+#include "TestMap.h"
+#include "TestSet.h"
+#include "EASTLTest.h"
+#include <EASTL/btree_map.h>
+#include <EASTL/btree_set.h>
+#include <EASTL/map.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+EA_DISABLE_ALL_VC_WARNINGS()
+#ifndef EA_COMPILER_NO_STANDARD_CPP_LIBRARY
+	#include <map>
+	#include <set>
+#endif
+EA_RESTORE_ALL_VC_WARNINGS()
+
+using namespace eastl;
+
+
+// Template instantations.
+// These tell the compiler to compile all the functions for the given class.
+template class eastl::btree_map<int, int>;
+template class eastl::btree_multimap<int, int>;
+template class eastl::btree_set<int>;
+template class eastl::btree_multiset<int>;
+template class eastl::btree_map<TestObject, TestObject>;
+template class eastl::btree_multiset<TestObject>;
+template class eastl::btree_map<int, int, eastl::less<int>, EASTLAllocatorType, 64>;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// typedefs
+//
+// The TestObject containers use small nodes, so that the generic tests below
+// exercise splitting and merging and not just a single leaf.
+//
+typedef eastl::btree_map<int, int> BM1;
+typedef eastl::btree_map<TestObject, TestObject, eastl::less<TestObject>, EASTLAllocatorType, 64> BM4;
+typedef eastl::btree_multimap<int, int> BMM1;
+typedef eastl::btree_multimap<TestObject, TestObject, eastl::less<TestObject>, EASTLAllocatorType, 64> BMM4;
+typedef eastl::btree_set<int> BS1;
+typedef eastl::btree_set<TestObject, eastl::less<TestObject>, EASTLAllocatorType, 64> BS4;
+typedef eastl::btree_multiset<int> BMS1;
+typedef eastl::btree_multiset<TestObject, eastl::less<TestObject>, EASTLAllocatorType, 64> BMS4;
+
+#ifndef EA_COMPILER_NO_STANDARD_CPP_LIBRARY
+	typedef std::map<int, int> VM3;
+	typedef std::map<TestObject, TestObject> VM6;
+	typedef std::multimap<int, int> VMM3;
+	typedef std::multimap<TestObject, TestObject> VMM6;
+	typedef std::set<int> VS3;
+	typedef std::set<TestObject> VS6;
+	typedef std::multiset<int> VMS3;
+	typedef std::multiset<TestObject> VMS6;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+
+template <typename Pair>
+static bool BTreeKeysEqual(const Pair& a, const Pair& b)
+{
+	return a.first == b.first;
+}
+
+
+// Runs a random mix of inserts, hinted inserts and erases against both a btree
+// container and the corresponding rbtree container, verifying that they agree.
+template <typename BTree, typename RBTree>
+static int TestBTreeRandomOperations(EA::UnitTest::Rand& rng, int nKeyRange, int nOperationCount)
+{
+	int nErrorCount = 0;
+
+	BTree  bt;
+	RBTree rb;
+
+	for(int i = 0; i < nOperationCount; ++i)
+	{
+		const int key = (int)rng.RandLimit((uint32_t)nKeyRange);
+
+		switch(rng.RandLimit(6))
+		{
+			case 0:
+			case 1:
+				bt.insert(typename BTree::value_type(key, i));
+				rb.insert(typename RBTree::value_type(key, i));
+				break;
+
+			case 2:
+			{
+				// Hinted insert, with a hint which is right about half of the time.
+				typename BTree::iterator itHint = bt.lower_bound(key);
+				if(rng.RandLimit(2) && (itHint != bt.end()))
+					++itHint;
+				bt.insert(itHint, typename BTree::value_type(key, i));
+				rb.insert(typename RBTree::value_type(key, i));
+				break;
+			}
+
+			case 3:
+			case 4:
+			{
+				const typename BTree::size_type n = bt.erase(key);
+				EATEST_VERIFY(n == rb.erase(key));
+				break;
+			}
+
+			default:
+			{
+				// Erase via iterator, and check the iterator returned.
+				const typename BTree::iterator it = bt.lower_bound(key);
+
+				if(it != bt.end())
+				{
+					const int erasedKey = it->first;
+					typename RBTree::iterator itRB = rb.lower_bound(key);
+					const typename BTree::iterator itNext = bt.erase(it);
+					itRB = rb.erase(itRB);
+
+					EATEST_VERIFY((itNext == bt.end()) == (itRB == rb.end()));
+					if(itNext != bt.end())
+						EATEST_VERIFY(!(itNext->first < erasedKey) && (itNext->first == itRB->first));
+				}
+				break;
+			}
+		}
+
+		if((i % 1024) == 0)
+			EATEST_VERIFY(bt.validate());
+	}
+
+	EATEST_VERIFY(bt.validate());
+	EATEST_VERIFY(bt.size() == rb.size());
+
+	// A hinted multimap insertion goes before the hint in a btree and after it in an rbtree,
+	// so values with equal keys may be ordered differently and we only compare their keys.
+	if(BTree::has_unique_keys_type::value)
+	{
+		EATEST_VERIFY(eastl::equal(bt.begin(), bt.end(), rb.begin()));
+		EATEST_VERIFY(eastl::equal(bt.rbegin(), bt.rend(), rb.rbegin()));
+	}
+	else
+	{
+		EATEST_VERIFY(eastl::equal(bt.begin(), bt.end(), rb.begin(), BTreeKeysEqual<typename BTree::value_type>));
+		EATEST_VERIFY(eastl::equal(bt.rbegin(), bt.rend(), rb.rbegin(), BTreeKeysEqual<typename BTree::value_type>));
+	}
+
+	for(int key = -1; key <= nKeyRange; ++key)
+	{
+		const typename BTree::iterator itLower = bt.lower_bound(key);
+		const typename BTree::iterator itUpper = bt.upper_bound(key);
+
+		EATEST_VERIFY((itLower == bt.end()) ? (rb.lower_bound(key) == rb.end()) : (itLower->first == rb.lower_bound(key)->first));
+		EATEST_VERIFY((itUpper == bt.end()) ? (rb.upper_bound(key) == rb.end()) : (itUpper->first == rb.upper_bound(key)->first));
+		EATEST_VERIFY(bt.count(key) == rb.count(key));
+		EATEST_VERIFY((bt.find(key) != bt.end()) == (rb.find(key) != rb.end()));
+		EATEST_VERIFY(eastl::distance(bt.equal_range(key).first, bt.equal_range(key).second) == (ptrdiff_t)rb.count(key));
+	}
+
+	// Erasing everything from the front exercises the rebalancing heuristics.
+	while(!bt.empty())
+	{
+		typename BTree::iterator it = bt.erase(bt.begin());
+		rb.erase(rb.begin());
+		EATEST_VERIFY((it == bt.begin()) && ((it == bt.end()) || (it->first == rb.begin()->first)));
+	}
+	EATEST_VERIFY(bt.validate());
+
+	return nErrorCount;
+}
+
+
+int TestBTree()
+{
+	int nErrorCount = 0;
+
+	#ifndef EA_COMPILER_NO_STANDARD_CPP_LIBRARY
+		{   // Test construction
+			nErrorCount += TestMapConstruction<BM1, VM3, false>();
+			nErrorCount += TestMapConstruction<BM4, VM6, false>();
+			nErrorCount += TestMapConstruction<BMM1, VMM3, true>();
+			nErrorCount += TestMapConstruction<BMM4, VMM6, true>();
+
+			nErrorCount += TestSetConstruction<BS1, VS3, false>();
+			nErrorCount += TestSetConstruction<BS4, VS6, false>();
+			nErrorCount += TestSetConstruction<BMS1, VMS3, true>();
+			nErrorCount += TestSetConstruction<BMS4, VMS6, true>();
+		}
+
+
+		{   // Test mutating functionality.
+			nErrorCount += TestMapMutation<BM1, VM3, false>();
+			nErrorCount += TestMapMutation<BM4, VM6, false>();
+			nErrorCount += TestMapMutation<BMM1, VMM3, true>();
+			nErrorCount += TestMapMutation<BMM4, VMM6, true>();
+
+			nErrorCount += TestSetMutation<BS1, VS3, false>();
+			nErrorCount += TestSetMutation<BS4, VS6, false>();
+			nErrorCount += TestSetMutation<BMS1, VMS3, true>();
+			nErrorCount += TestSetMutation<BMS4, VMS6, true>();
+		}
+	#endif // EA_COMPILER_NO_STANDARD_CPP_LIBRARY
+
+
+	{   // Test searching functionality.
+		nErrorCount += TestMapSearch<BM1, false>();
+		nErrorCount += TestMapSearch<BM4, false>();
+		nErrorCount += TestMapSearch<BMM1, true>();
+		nErrorCount += TestMapSearch<BMM4, true>();
+
+		nErrorCount += TestSetSearch<BS1, false>();
+		nErrorCount += TestSetSearch<BS4, false>();
+		nErrorCount += TestSetSearch<BMS1, true>();
+		nErrorCount += TestSetSearch<BMS4, true>();
+	}
+
+
+	{
+		// C++11 emplace and related functionality
+		nErrorCount += TestMapCpp11<eastl::btree_map<int, TestObject>>();
+		nErrorCount += TestMultimapCpp11<eastl::btree_multimap<int, TestObject>>();
+		nErrorCount += TestSetCpp11<eastl::btree_set<TestObject>>();
+		nErrorCount += TestMultisetCpp11<eastl::btree_multiset<TestObject>>();
+
+		// C++17 try_emplace and related functionality
+		nErrorCount += TestMapCpp17<eastl::btree_map<int, TestObject>>();
+	}
+
+
+	{
+		// Random operations against map and multimap, with several node sizes. 16 bytes
+		// gives the minimum of three values per node for pair<const int, int>.
+		EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+		nErrorCount += TestBTreeRandomOperations<btree_map<int, int, less<int>, EASTLAllocatorType, 16>, map<int, int> >(rng, 200, 20000);
+		nErrorCount += TestBTreeRandomOperations<btree_map<int, int, less<int>, EASTLAllocatorType, 64>, map<int, int> >(rng, 2000, 20000);
+		nErrorCount += TestBTreeRandomOperations<btree_map<int, int>, map<int, int> >(rng, 20000, 50000);
+		nErrorCount += TestBTreeRandomOperations<btree_map<int, int, less<int>, EASTLAllocatorType, 512>, map<int, int> >(rng, 100000, 50000);
+		nErrorCount += TestBTreeRandomOperations<btree_multimap<int, int, less<int>, EASTLAllocatorType, 16>, multimap<int, int> >(rng, 50, 20000);
+		nErrorCount += TestBTreeRandomOperations<btree_multimap<int, int>, multimap<int, int> >(rng, 500, 50000);
+	}
+
+
+	{
+		// Sorted insertion via the end() hint leaves all but the last node of each level full, but
+		// for the one value each split moves up into the parent. An even split would leave them half full.
+		typedef btree_set<int, less<int>, CountingAllocator> CountingSet;
+		const int kCount = 10000;
+
+		CountingAllocator::resetCount();
+		{
+			CountingSet s;
+
+			for(int i = 0; i < kCount; ++i)
+				s.insert(s.end(), i);
+
+			EATEST_VERIFY(s.validate() && (s.size() == (CountingSet::size_type)kCount));
+
+			const int nLeafCount = (kCount / (CountingSet::kNodeValueCount - 1)) + 1;
+			EATEST_VERIFY(CountingAllocator::activeAllocCount <= (uint64_t)(nLeafCount + (nLeafCount / CountingSet::kNodeValueCount) + 2));
+
+			int i = 0;
+			for(CountingSet::iterator it = s.begin(); it != s.end(); ++it, ++i)
+				EATEST_VERIFY(*it == i);
+			EATEST_VERIFY(i == kCount);
+
+			// The range insert takes the same path.
+			vector<int> sorted(s.begin(), s.end());
+			CountingSet s2(sorted.begin(), sorted.end());
+			EATEST_VERIFY(s2.validate() && (s2 == s));
+		}
+		EATEST_VERIFY(CountingAllocator::activeAllocCount == 0);
+
+		// Likewise for descending insertion via the begin() hint.
+		btree_set<int> s3;
+		for(int i = kCount; i > 0; --i)
+			s3.insert(s3.begin(), i);
+		EATEST_VERIFY(s3.validate() && (s3.size() == (btree_set<int>::size_type)kCount) && (*s3.begin() == 1));
+	}
+
+
+	{
+		// Hinted insertion with unique keys.
+		btree_map<int, int, less<int>, EASTLAllocatorType, 64> m;
+
+		for(int i = 0; i < 100; i += 2)
+			m.insert(m.end(), make_pair(i, i));
+
+		btree_map<int, int, less<int>, EASTLAllocatorType, 64>::iterator it = m.insert(m.find(10), make_pair(9, 9)); // Correct hint.
+		EATEST_VERIFY((it->first == 9) && (m.size() == 51));
+		it = m.insert(m.begin(), make_pair(51, 51)); // Wrong hint.
+		EATEST_VERIFY((it->first == 51) && (m.size() == 52));
+		it = m.insert(m.end(), make_pair(40, 0)); // Existing key.
+		EATEST_VERIFY((it->first == 40) && (it->second == 40) && (m.size() == 52));
+		it = m.emplace_hint(m.begin(), -1, -1);
+		EATEST_VERIFY((it == m.begin()) && (it->first == -1));
+		EATEST_VERIFY(m.validate());
+	}
+
+
+	{
+		// operator[], at, try_emplace, insert_or_assign.
+		btree_map<string, int> m;
+
+		m["b"] = 2;
+		m["a"] = 1;
+		m[string("c")] = 3;
+		EATEST_VERIFY((m.size() == 3) && (m.at("b") == 2) && (m.begin()->first == "a"));
+
+		EATEST_VERIFY(!m.try_emplace("a", 10).second && (m["a"] == 1));
+		EATEST_VERIFY(m.try_emplace("d", 4).second && (m["d"] == 4));
+		EATEST_VERIFY(!m.insert_or_assign("d", 40).second && (m["d"] == 40));
+		EATEST_VERIFY(m.insert_or_assign(string("e"), 5).second && (m["e"] == 5));
+		EATEST_VERIFY((m.insert_or_assign(m.end(), "e", 50)->second == 50) && (m.insert_or_assign(m.end(), string("f"), 6)->first == "f"));
+		m.erase("e");
+		m.erase("f");
+
+		#if EASTL_EXCEPTIONS_ENABLED
+			bool bThrew = false;
+			try { m.at("z"); }
+			catch(std::out_of_range&) { bThrew = true; }
+			EATEST_VERIFY(bThrew);
+		#endif
+
+		// Copy, assignment, comparison, swap.
+		btree_map<string, int> m2(m);
+		EATEST_VERIFY((m2 == m) && m2.validate());
+		m2["e"] = 5;
+		EATEST_VERIFY((m2 != m) && (m < m2));
+		m2.swap(m);
+		EATEST_VERIFY((m.size() == 5) && (m2.size() == 4));
+		m2 = m;
+		EATEST_VERIFY(m2 == m);
+		btree_map<string, int> m3(eastl::move(m2));
+		EATEST_VERIFY(m2.empty() && (m3 == m) && m2.validate());
+	}
+
+
+	#if EASTL_EXCEPTIONS_ENABLED
+	{
+		// A copy which throws part way through must tear down the partially built tree.
+		TestObject::Reset();
+		{
+			btree_map<int, TestObject> m;
+			for(int i = 0; i < 1000; ++i)
+				m[i] = TestObject(i);
+
+			for(int k = 0; k < 1000; k += 333)
+			{
+				m[k].mbThrowOnCopy = true;
+
+				bool bThrew = false;
+				try { btree_map<int, TestObject> m2(m); }
+				catch(...) { bThrew = true; }
+				EATEST_VERIFY(bThrew && (TestObject::sTOCount == 1000));
+
+				m[k].mbThrowOnCopy = false;
+			}
+		}
+		EATEST_VERIFY(TestObject::IsClear());
+		TestObject::Reset();
+	}
+	#endif
+
+
+	{
+		// Range erase, erase from reverse iterators, and reverse iteration.
+		btree_set<int, less<int>, EASTLAllocatorType, 32> s;
+		for(int i = 0; i < 1000; ++i)
+			s.insert(i);
+
+		btree_set<int, less<int>, EASTLAllocatorType, 32>::iterator it = s.erase(s.find(100), s.find(900));
+		EATEST_VERIFY((*it == 900) && (s.size() == 200) && s.validate());
+
+		btree_set<int, less<int>, EASTLAllocatorType, 32>::reverse_iterator itR = s.erase(s.rbegin());
+		EATEST_VERIFY((*itR == 998) && (s.size() == 199));
+
+		int expected = 998;
+		for(itR = s.rbegin(); itR != s.rend(); ++itR, --expected)
+		{
+			if(expected == 899)
+				expected = 99;
+			EATEST_VERIFY(*itR == expected);
+		}
+
+		const int keys[] = { 0, 5, 950, 12345 };
+		s.erase(keys, keys + 4);
+		EATEST_VERIFY((s.size() == 196) && !s.contains(950) && s.contains(951) && s.validate());
+
+		s.erase(s.begin(), s.end());
+		EATEST_VERIFY(s.empty() && (s.begin() == s.end()) && s.validate());
+	}
+
+
+	{
+		// Heterogeneous lookup and find_as.
+		btree_set<string, less<void>> s = { "a", "c", "e" };
+		EATEST_VERIFY(*s.find("c") == "c");
+		EATEST_VERIFY(*s.lower_bound("b") == "c");
+		EATEST_VERIFY(s.upper_bound("e") == s.end());
+		EATEST_VERIFY(s.contains("a") && !s.contains("b"));
+
+		btree_map<string, int> m = { { "x", 1 }, { "y", 2 } };
+		EATEST_VERIFY(m.find_as("y", less_2<string, const char*>())->second == 2);
+	}
+
+
+	{
+		// Large values get the minimum of three per node, regardless of the node size.
+		struct Big { int key; char data[200]; bool operator<(const Big& x) const { return key < x.key; } };
+		typedef btree_set<Big> BigSet;
+		static_assert(BigSet::kNodeValueCount == 3, "unexpected node capacity");
+
+		BigSet s;
+		for(int i = 0; i < 100; ++i)
+		{
+			Big b;
+			b.key = (i * 37) % 100;
+			s.insert(b);
+		}
+		EATEST_VERIFY((s.size() == 100) && s.validate() && (s.begin()->key == 0));
+	}
+
+
+	{
+		// Elements are moved around as the tree changes, so they are destroyed and constructed as the tree changes.
+		TestObject::Reset();
+		{
+			btree_multiset<TestObject, less<TestObject>, EASTLAllocatorType, 64> s;
+
+			for(int i = 0; i < 1000; ++i)
+				s.emplace((i * 7) % 100);
+			for(int i = 0; i < 500; ++i)
+				s.erase(s.find(TestObject((i * 13) % 100)));
+
+			EATEST_VERIFY(s.validate() && (s.size() == 500));
+		}
+		EATEST_VERIFY(TestObject::IsClear());
+		TestObject::Reset();
+	}
+
+	return nErrorCount;
+}
@@ -9,6 +9,7 @@
 #include <EASTL/vector.h>
 #include <EASTL/deque.h>
 #include <EASTL/string.h>
+#include <EASTL/algorithm.h>
 
 
 
@@ -28,6 +29,135 @@ template class eastl::bitvector<EASTLAllocatorType, int64_t, eastl::vector<int64
 
 
 
+// Checks the word at a time find, count and set operations against the bit at a 
+// time operator[], on bitvectors of several sizes and densities. The vectors are
+// built with push_back and then trimmed with pop_back, which leaves stale bits in 
+// the unused part of the last word that the word functions must ignore.
+template <typename Bitvector>
+static int TestBitvectorWordKernels(EA::UnitTest::Rand& rng)
+{
+	typedef typename Bitvector::size_type      size_type;
+	typedef typename Bitvector::const_iterator const_iterator;
+
+	int nErrorCount = 0;
+
+	const size_type sizes[]     = { 0, 1, 7, 63, 64, 65, 129, 1000, 4099, 100003 };
+	const uint32_t  densities[] = { 0, 1, 500, 1000 }; // Out of 1000.
+
+	for(size_t s = 0; s < EAArrayCount(sizes); s++)
+	{
+		for(size_t d = 0; d < EAArrayCount(densities); d++)
+		{
+			const size_type n = sizes[s];
+			Bitvector       a, b;
+
+			for(size_type i = 0; i < n + 5; i++)
+			{
+				a.push_back(rng.RandLimit(1000) < densities[d]);
+				b.push_back(rng.RandLimit(1000) < densities[(d + 1) % EAArrayCount(densities)]);
+			}
+
+			for(size_type i = 0; i < 5; i++) // Leave set bits past the end of each.
+			{
+				a.pop_back();
+				b.pop_back();
+			}
+
+			size_type expectedCount = 0;
+			for(size_type i = 0; i < n; i++)
+				expectedCount += a[i] ? 1 : 0;
+
+			EATEST_VERIFY(a.count() == expectedCount);
+			EATEST_VERIFY(a.any() == (expectedCount != 0));
+			EATEST_VERIFY(a.none() == (expectedCount == 0));
+			EATEST_VERIFY(a.all() == (expectedCount == n));
+
+			// find_first / find_next, for "on" and "off" bits.
+			size_type i = 0;
+			for(const_iterator it = a.template find_first<true>(); it != a.end(); it = a.template find_next<true>(it), ++i)
+			{
+				while((i < n) && !a[i])
+					++i;
+				EATEST_VERIFY((size_type)(it - a.begin()) == i);
+			}
+			while((i < n) && !a[i])
+				++i;
+			EATEST_VERIFY(i == n);
+
+			i = 0;
+			for(const_iterator it = a.template find_first<false>(); it != a.end(); it = a.template find_next<false>(it), ++i)
+			{
+				while((i < n) && a[i])
+					++i;
+				EATEST_VERIFY((size_type)(it - a.begin()) == i);
+			}
+			while((i < n) && a[i])
+				++i;
+			EATEST_VERIFY(i == n);
+
+			// find_last / find_prev
+			i = n;
+			for(const_iterator it = a.template find_last<true>(); it != a.end(); it = a.template find_prev<true>(it))
+			{
+				while(i && !a[i - 1])
+					--i;
+				EATEST_VERIFY((size_type)(it - a.begin()) == --i);
+			}
+			while(i && !a[i - 1])
+				--i;
+			EATEST_VERIFY(i == 0);
+
+			i = n;
+			for(const_iterator it = a.template find_last<false>(); it != a.end(); it = a.template find_prev<false>(it))
+			{
+				while(i && a[i - 1])
+					--i;
+				EATEST_VERIFY((size_type)(it - a.begin()) == --i);
+			}
+			while(i && a[i - 1])
+				--i;
+			EATEST_VERIFY(i == 0);
+
+			// operator&=, operator|=, operator^=, and_not
+			Bitvector aAnd(a), aOr(a), aXor(a), aAndNot(a);
+
+			aAnd &= b;
+			aOr |= b;
+			aXor ^= b;
+			aAndNot.and_not(b);
+
+			for(i = 0; i < n; i++)
+			{
+				EATEST_VERIFY(aAnd[i]    == (a[i] && b[i]));
+				EATEST_VERIFY(aOr[i]     == (a[i] || b[i]));
+				EATEST_VERIFY(aXor[i]    == (a[i] != b[i]));
+				EATEST_VERIFY(aAndNot[i] == (a[i] && !b[i]));
+			}
+
+			// operator==, operator<
+			EATEST_VERIFY((a == b) == eastl::equal(a.begin(), a.end(), b.begin()));
+			EATEST_VERIFY((a < b) == eastl::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+			EATEST_VERIFY(a == Bitvector(a.begin(), a.end()));
+
+			if(n)
+			{
+				Bitvector aShort(a.begin(), a.end() - 1);
+
+				EATEST_VERIFY(aShort < a);
+				EATEST_VERIFY(!(a < aShort));
+
+				aShort = a;
+				aShort[n / 2] = !aShort[n / 2];
+				EATEST_VERIFY(aShort != a);
+				EATEST_VERIFY((aShort < a) == a[n / 2]);
+			}
+		}
+	}
+
+	return nErrorCount;
+}
+
+
 int TestBitVector()
 {
 	using namespace eastl;
@@ -448,6 +578,33 @@ int TestBitVector()
 		MallocAllocator::mpLastAllocation = NULL;
 	}
 
+	{
+		// template <bool value> iterator find_first(), find_next(), find_last(), find_prev()
+		// size_type count() const;
+		// bool any() const, all() const, none() const;
+		// bitvector& operator&=(const bitvector& x), operator|=, operator^=, and_not
+		EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+		nErrorCount += TestBitvectorWordKernels< bitvector<> >(rng);
+		nErrorCount += TestBitvectorWordKernels< bitvector<EASTLAllocatorType, uint8_t> >(rng);
+		nErrorCount += TestBitvectorWordKernels< bitvector<EASTLAllocatorType, int16_t> >(rng);
+		nErrorCount += TestBitvectorWordKernels< bitvector<EASTLAllocatorType, uint64_t> >(rng);
+
+		bitvector<> bv(100);
+		EATEST_VERIFY(bv.none() && !bv.all() && (bv.count() == 0));
+		EATEST_VERIFY(bv.find_first() == bv.end());
+		EATEST_VERIFY(bv.find_first<false>() == bv.begin());
+
+		bv.resize(200, true);
+		EATEST_VERIFY(bv.count() == 100);
+		EATEST_VERIFY(bv.find_first() == bv.begin() + 100);
+		EATEST_VERIFY(bv.find_last<false>() == bv.begin() + 99);
+
+		bitvector<> bvEmpty;
+		EATEST_VERIFY(bvEmpty.all() && bvEmpty.none() && !bvEmpty.any());
+		EATEST_VERIFY(bvEmpty.find_first() == bvEmpty.end());
+	}
+
 	return nErrorCount;
 }
 
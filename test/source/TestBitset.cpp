@@ -5,6 +5,8 @@
 
 #include "EASTLTest.h"
 #include <EASTL/bitset.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
 #include <EABase/eabase.h>
 
 #ifdef _MSC_VER
@@ -64,6 +66,62 @@ using namespace eastl;
 #endif
 
 
+
+// Sets a sparse, clustered random pattern of bits in a large bitset and verifies
+// find_first, find_next, find_last, find_prev and for_each_set_bit against test().
+// Long runs of zero words exercise the block skipping in the scans.
+template <typename Bitset>
+static int TestBitsetSparseScan(EA::UnitTest::Rand& rng)
+{
+	int nErrorCount = 0;
+
+	for(int pass = 0; pass < 8; ++pass)
+	{
+		Bitset b;
+
+		const int nClusterCount = (int)rng.RandLimit(6);
+		for(int c = 0; c < nClusterCount; ++c)
+		{
+			const size_t nCenter = (size_t)rng.RandLimit((uint32_t)b.size());
+
+			for(int k = (int)rng.RandLimit(8); k > 0; --k)
+				b.set((nCenter + (size_t)rng.RandLimit(300)) % b.size());
+		}
+
+		if(pass == 1)
+			b.set(b.size() - 1);
+		if(pass == 2)
+			b.set(0);
+
+		eastl::vector<size_t> expected;
+		for(size_t i = 0; i < b.size(); ++i)
+		{
+			if(b.test(i))
+				expected.push_back(i);
+		}
+
+		eastl::vector<size_t> visited;
+		b.for_each_set_bit([&](size_t i) { visited.push_back(i); });
+		EATEST_VERIFY(visited == expected);
+
+		eastl::vector<size_t> found;
+		for(size_t i = b.find_first(); i != b.kSize; i = b.find_next(i))
+			found.push_back(i);
+		EATEST_VERIFY(found == expected);
+
+		found.clear();
+		for(size_t i = b.find_last(); i != b.kSize; i = b.find_prev(i))
+			found.push_back(i);
+		eastl::reverse(found.begin(), found.end());
+		EATEST_VERIFY(found == expected);
+
+		EATEST_VERIFY(b.count() == expected.size());
+	}
+
+	return nErrorCount;
+}
+
+
 int TestBitset()
 {
 	int nErrorCount = 0;
@@ -1276,6 +1334,27 @@ int TestBitset()
 		EATEST_VERIFY(i == 137);
 	}
 
+	{ // Test find_* and for_each_set_bit on large, sparse bitsets of each word type.
+		EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+		nErrorCount += TestBitsetSparseScan<bitset<4000, uint16_t> >(rng);
+		nErrorCount += TestBitsetSparseScan<bitset<4000, uint32_t> >(rng);
+		nErrorCount += TestBitsetSparseScan<bitset<65536, uint64_t> >(rng);
+		nErrorCount += TestBitsetSparseScan<bitset<1000> >(rng);
+		#if EASTL_INT128_SUPPORTED
+			nErrorCount += TestBitsetSparseScan<bitset<3000, eastl_uint128_t> >(rng);
+		#endif
+
+		bitset<200> b200;
+		int nCalls = 0;
+		b200.for_each_set_bit([&](size_t) { ++nCalls; });
+		EATEST_VERIFY(nCalls == 0);
+
+		b200.set();
+		b200.for_each_set_bit([&](size_t) { ++nCalls; });
+		EATEST_VERIFY(nCalls == 200);
+	}
+
 	// test BITSET_WORD_COUNT macro
 	{
 		{
@@ -27,8 +27,9 @@ namespace eastl
 	}
 
 
-	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode> class hash_set;
-	typedef hash_set<char, char, char, allocator, false> hash_set8;
+	struct prime_rehash_policy;
+	template <typename Value, typename Hash, typename Predicate, typename Allocator, bool bCacheHashCode, typename RehashPolicy> class hash_set;
+	typedef hash_set<char, char, char, allocator, false, prime_rehash_policy> hash_set8;
 
 	static void UseForwardDeclaredHashSet(hash_set8*)
 	{
@@ -10,6 +10,7 @@
 #include <EASTL/fixed_hash_set.h>
 #include <EASTL/fixed_hash_map.h>
 #include <EASTL/fixed_vector.h>
+#include <EASTL/bit.h>
 
 
 
@@ -136,6 +137,11 @@ template class eastl::fixed_hash_map<A, A, 1, 2, true, eastl::hash<A>, eastl::eq
 template class eastl::fixed_hash_multiset<A, 1, 2, true, eastl::hash<A>, eastl::equal_to<A>, false, MallocAllocator>;
 template class eastl::fixed_hash_multimap<A, A, 1, 2, true, eastl::hash<A>, eastl::equal_to<A>, false, MallocAllocator>;
 
+template class eastl::fixed_hash_set<int, 1, 2, true, eastl::hash<int>, eastl::equal_to<int>, false, EASTLAllocatorType, eastl::power_of_two_rehash_policy>;
+template class eastl::fixed_hash_map<int, int, 1, 2, true, eastl::hash<int>, eastl::equal_to<int>, false, EASTLAllocatorType, eastl::power_of_two_rehash_policy>;
+template class eastl::fixed_hash_multiset<int, 1, 2, true, eastl::hash<int>, eastl::equal_to<int>, false, EASTLAllocatorType, eastl::power_of_two_rehash_policy>;
+template class eastl::fixed_hash_multimap<int, int, 1, 2, true, eastl::hash<int>, eastl::equal_to<int>, false, EASTLAllocatorType, eastl::power_of_two_rehash_policy>;
+
 
 
 template<typename FixedHashMap, int ELEMENT_MAX, int ITERATION_MAX>
@@ -280,6 +286,40 @@ int TestFixedHash()
 			VERIFY(fixedHashMap.get_overflow_allocator().mAllocCountAll != 0);			
 		}
 
+		{
+			// Test fixed_hash_map with power_of_two_rehash_policy, with and without overflow.
+			typedef eastl::fixed_hash_map<int, int, 100, 100, false, eastl::hash<int>, eastl::equal_to<int>, false, EASTLAllocatorType, eastl::power_of_two_rehash_policy> FixedHashMapFalse;
+			typedef eastl::fixed_hash_map<int, int, 100, 100, true,  eastl::hash<int>, eastl::equal_to<int>, false, EASTLAllocatorType, eastl::power_of_two_rehash_policy> FixedHashMapTrue;
+
+			FixedHashMapFalse fixedHashMapFalse;
+			FixedHashMapTrue  fixedHashMapTrue;
+
+			VERIFY(fixedHashMapFalse.bucket_count() == 64); // The largest power of two that fits in the 100 bucket buffer.
+
+			for(int i = 0; i < 100; i++)
+			{
+				fixedHashMapFalse.insert(FixedHashMapFalse::value_type(i * 64, i));
+				fixedHashMapTrue.insert(FixedHashMapTrue::value_type(i * 64, i));
+			}
+			for(int i = 100; i < 300; i++)
+				fixedHashMapTrue.insert(FixedHashMapTrue::value_type(i * 64, i));
+
+			VERIFY(fixedHashMapFalse.validate() && (fixedHashMapFalse.size() == 100));
+			VERIFY(fixedHashMapTrue.validate() && (fixedHashMapTrue.size() == 300));
+			VERIFY(fixedHashMapTrue.bucket_count() > 64);
+			VERIFY(eastl::has_single_bit((uint32_t)fixedHashMapTrue.bucket_count()));
+
+			for(int i = 0; i < 100; i++)
+				VERIFY(fixedHashMapFalse.find(i * 64)->second == i);
+			for(int i = 0; i < 300; i++)
+				VERIFY(fixedHashMapTrue.find(i * 64)->second == i);
+
+			fixedHashMapFalse.clear(true);
+			VERIFY(fixedHashMapFalse.validate() && (fixedHashMapFalse.bucket_count() == 64));
+			fixedHashMapFalse[3] = 3;
+			VERIFY(fixedHashMapFalse.find(3)->second == 3);
+		}
+
 		{
 			// Test version with overflow and alignment requirements.
 			typedef fixed_hash_map<Align64, int, 1, 2, true> FixedHashMapWithAlignment;
@@ -730,6 +770,53 @@ int TestFixedHash()
 		}
 	}
 
+	{
+		// node_handle_type extract(const key_type& k);
+		// void             merge(Source&& source);
+		typedef eastl::fixed_hash_map<int, TestObject, 8, 9, false> FixedHashMap;
+
+		TestObject::Reset();
+		{
+			FixedHashMap fixedHashMap1, fixedHashMap2;
+
+			for(int i = 0; i < 8; i++)
+				fixedHashMap1.insert(FixedHashMap::value_type(i, TestObject(i)));
+			const int64_t nMoveCtorCount = TestObject::sTOMoveCtorCount;
+
+			FixedHashMap::node_handle_type nh = fixedHashMap1.extract(7);
+			nh.key() = 70;
+			VERIFY(fixedHashMap1.insert(eastl::move(nh)).inserted && (fixedHashMap1.find(70)->second.mX == 7));
+			VERIFY(TestObject::sTOMoveCtorCount == nMoveCtorCount); // The node was reused.
+
+			fixedHashMap2.insert(FixedHashMap::value_type(0, TestObject(100)));
+			fixedHashMap2.merge(fixedHashMap1); // Elements are moved to new nodes, as each fixed_hash_map has its own buffer.
+			VERIFY((fixedHashMap2.size() == 8) && (fixedHashMap1.size() == 1) && (fixedHashMap2.find(0)->second.mX == 100));
+			VERIFY(fixedHashMap1.validate() && fixedHashMap2.validate());
+		}
+		VERIFY(TestObject::IsClear());
+		TestObject::Reset();
+	}
+
+	#if EASTL_HASHTABLE_STATS
+	{
+		// hashtable_stats get_stats() const;
+		typedef eastl::fixed_hash_map<int, int, 100, 101, false> FixedHashMap;
+		FixedHashMap fixedHashMap;
+		const int nBucketCount = (int)fixedHashMap.bucket_count();
+
+		for(int i = 0; i < 100; i++)
+			fixedHashMap.insert(eastl::make_pair(i * nBucketCount, i)); // Every key lands in bucket 0.
+
+		fixedHashMap.reset_stats();
+		VERIFY(fixedHashMap.find(0) != fixedHashMap.end());
+
+		const eastl::hashtable_stats stats = fixedHashMap.get_stats();
+		VERIFY((stats.mnElementCount == 100) && (stats.mnBucketCount == (size_t)nBucketCount));
+		VERIFY((stats.mnUsedBucketCount == 1) && (stats.mnMaxChainLength == 100));
+		VERIFY((stats.mnLookupCount == 1) && (stats.mnProbeCount == 100) && (stats.mnRehashCount == 0));
+	}
+	#endif
+
 	return nErrorCount;
 }
 EA_RESTORE_VC_WARNING()
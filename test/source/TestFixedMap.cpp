@@ -167,6 +167,41 @@ int TestFixedMap()
 		}
 	}
 
+	{
+		// node_handle_type extract(const key_type& key);
+		// void             merge(Source&& source);
+		// Nodes can be moved within a fixed container, but not between two of them, as each
+		// allocates from its own buffer. In that case the element is moved to a new node.
+		typedef eastl::fixed_map<int, TestObject, 8, false>      FixedMap;
+		typedef eastl::fixed_multimap<int, TestObject, 8, false> FixedMultimap;
+
+		TestObject::Reset();
+		{
+			FixedMap      fixedMap1, fixedMap2;
+			FixedMultimap fixedMultimap;
+
+			for(int i = 0; i < 8; i++)
+				fixedMap1.insert(FixedMap::value_type(i, TestObject(i)));
+			const int64_t nMoveCtorCount = TestObject::sTOMoveCtorCount;
+
+			FixedMap::node_handle_type nh = fixedMap1.extract(7);
+			nh.key() = 70;
+			VERIFY(fixedMap1.insert(eastl::move(nh)).inserted && (fixedMap1.find(70)->second.mX == 7));
+			VERIFY(TestObject::sTOMoveCtorCount == nMoveCtorCount);
+
+			fixedMap2.insert(FixedMap::value_type(0, TestObject(100)));
+			fixedMap2.merge(fixedMap1);
+			VERIFY((fixedMap2.size() == 8) && (fixedMap1.size() == 1) && (fixedMap2.find(0)->second.mX == 100));
+			VERIFY(fixedMap1.get_allocator().can_allocate() && !fixedMap2.get_allocator().can_allocate());
+
+			fixedMultimap.merge(fixedMap2);
+			VERIFY(fixedMap2.empty() && (fixedMultimap.size() == 8) && fixedMultimap.validate());
+		}
+		VERIFY(TestObject::IsClear());
+		TestObject::Reset();
+	}
+
+
 
 	return nErrorCount;
 }
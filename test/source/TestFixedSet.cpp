@@ -190,6 +190,19 @@ int TestFixedSet()
 			EATEST_VERIFY((uint64_t)ptr % EASTL_ALIGN_OF(Align64) == 0);
 		}
 	}
+
+	{
+		// join and split move the values between fixed containers, as their nodes are in different pools.
+		typedef fixed_set<int, 64> FixedSet64;
+		FixedSet64 fs1, fs2;
+
+		for(int i = 0; i < 40; ++i)
+			fs1.insert(i);
+		fs1.split(30, fs2);
+		EATEST_VERIFY((fs1.size() == 30) && (fs2.size() == 10) && (*fs2.begin() == 30) && fs1.validate() && fs2.validate());
+		fs1.join(fs2);
+		EATEST_VERIFY((fs1.size() == 40) && fs2.empty() && (*fs1.rbegin() == 39) && fs1.validate());
+	}
 	return nErrorCount;
 }
 EA_RESTORE_VC_WARNING()
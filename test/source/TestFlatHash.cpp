@@ -0,0 +1,418 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+
+#include "EASTLTest.h"
+#include "TestMap.h"
+#include "TestSet.h"
+#include <EASTL/flat_hash_map.h>
+#include <EASTL/flat_hash_set.h>
+#include <EASTL/fixed_flat_hash_map.h>
+#include <EASTL/fixed_flat_hash_set.h>
+#include <EASTL/hash_map.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <EASTL/bit.h>
+
+
+using namespace eastl;
+
+
+// Template instantations.
+// These tell the compiler to compile all the functions for the given class.
+template class eastl::flat_hashtable<int, eastl::pair<const int, int>, EASTLAllocatorType, eastl::use_first<eastl::pair<const int, int> >,
+                                     eastl::equal_to<int>, eastl::hash<int>, true>;
+template class eastl::flat_hash_map<int, int>;
+template class eastl::flat_hash_set<int>;
+template class eastl::flat_hash_map<eastl::string, TestObject>;
+template class eastl::flat_hash_set<TestObject>;
+template class eastl::fixed_flat_hash_map<int, int, 16>;
+template class eastl::fixed_flat_hash_map<int, int, 16, false>;
+template class eastl::fixed_flat_hash_set<int, 16>;
+template class eastl::fixed_flat_hash_set<int, 16, false>;
+
+
+namespace
+{
+	// A hash which maps every key to only a few distinct values, in order to exercise collisions.
+	struct CollidingHash
+	{
+		size_t operator()(int x) const { return (size_t)(x & 3); }
+	};
+}
+
+
+int TestFlatHash()
+{
+	int nErrorCount = 0;
+
+	{
+		// bit.h
+		EATEST_VERIFY(eastl::countr_zero(uint32_t(0x00000008)) == 3);
+		EATEST_VERIFY(eastl::countr_zero(uint32_t(0)) == 32);
+		EATEST_VERIFY(eastl::countr_zero(uint64_t(0x8000000000000000)) == 63);
+		EATEST_VERIFY(eastl::countr_zero(uint8_t(0)) == 8);
+		EATEST_VERIFY(eastl::countl_zero(uint32_t(0x00F00000)) == 8);
+		EATEST_VERIFY(eastl::countl_zero(uint16_t(1)) == 15);
+		EATEST_VERIFY(eastl::countl_zero(uint64_t(1)) == 63);
+		EATEST_VERIFY(eastl::countl_zero(uint64_t(0)) == 64);
+		EATEST_VERIFY(eastl::countr_one(uint32_t(0x7)) == 3);
+		EATEST_VERIFY(eastl::countl_one(uint8_t(0xF0)) == 4);
+		EATEST_VERIFY(eastl::popcount(uint32_t(0xF0F0)) == 8);
+		EATEST_VERIFY(eastl::popcount(uint64_t(0xFFFFFFFFFFFFFFFF)) == 64);
+		EATEST_VERIFY(eastl::has_single_bit(uint32_t(64)));
+		EATEST_VERIFY(!eastl::has_single_bit(uint32_t(65)));
+		EATEST_VERIFY(!eastl::has_single_bit(uint32_t(0)));
+		EATEST_VERIFY(eastl::bit_width(uint32_t(0)) == 0);
+		EATEST_VERIFY(eastl::bit_width(uint32_t(5)) == 3);
+		EATEST_VERIFY(eastl::bit_ceil(uint32_t(0)) == 1);
+		EATEST_VERIFY(eastl::bit_ceil(uint32_t(5)) == 8);
+		EATEST_VERIFY(eastl::bit_ceil(uint32_t(8)) == 8);
+		EATEST_VERIFY(eastl::bit_floor(uint64_t(0)) == 0);
+		EATEST_VERIFY(eastl::bit_floor(uint64_t(1000)) == 512);
+	}
+
+
+	{
+		// Basic flat_hash_map functionality.
+		flat_hash_map<int, int> m;
+
+		EATEST_VERIFY(m.empty() && (m.size() == 0) && (m.bucket_count() == 0));
+		EATEST_VERIFY(m.begin() == m.end());
+		EATEST_VERIFY(m.find(3) == m.end());
+		EATEST_VERIFY(m.count(3) == 0);
+		EATEST_VERIFY(m.erase(3) == 0);
+		EATEST_VERIFY(m.validate());
+
+		for(int i = 0; i < 1000; i++)
+		{
+			eastl::pair<flat_hash_map<int, int>::iterator, bool> result = m.insert(eastl::make_pair(i, i * 2));
+			EATEST_VERIFY(result.second && (result.first->first == i) && (result.first->second == i * 2));
+		}
+
+		EATEST_VERIFY(m.size() == 1000);
+		EATEST_VERIFY(m.validate());
+		EATEST_VERIFY(m.load_factor() <= m.get_max_load_factor());
+		EATEST_VERIFY(eastl::has_single_bit((uint32_t)m.bucket_count() + 1));
+
+		for(int i = 0; i < 1000; i++)
+		{
+			flat_hash_map<int, int>::iterator it = m.find(i);
+			EATEST_VERIFY((it != m.end()) && (it->second == i * 2));
+			EATEST_VERIFY(m.validate_iterator(it) == (isf_valid | isf_current | isf_can_dereference));
+		}
+
+		EATEST_VERIFY(m.find(1000) == m.end());
+		EATEST_VERIFY(m.validate_iterator(m.end()) == (isf_valid | isf_current));
+
+		// Duplicate insert fails and doesn't modify the value.
+		eastl::pair<flat_hash_map<int, int>::iterator, bool> result = m.insert(eastl::make_pair(5, 37));
+		EATEST_VERIFY(!result.second && (result.first->second == 10));
+
+		// Iteration visits every element exactly once.
+		int nSum = 0, nCount = 0;
+		for(flat_hash_map<int, int>::const_iterator it = m.cbegin(); it != m.cend(); ++it, ++nCount)
+			nSum += it->first;
+		EATEST_VERIFY((nCount == 1000) && (nSum == (999 * 1000) / 2));
+
+		// Erase every other element, via key and via iterator.
+		for(int i = 0; i < 1000; i += 4)
+			EATEST_VERIFY(m.erase(i) == 1);
+		for(int i = 2; i < 1000; i += 4)
+		{
+			flat_hash_map<int, int>::iterator it = m.erase(m.find(i));
+			EATEST_VERIFY((it == m.end()) || (m.validate_iterator(it) & isf_can_dereference));
+		}
+
+		EATEST_VERIFY(m.size() == 500);
+		EATEST_VERIFY(m.validate());
+
+		for(int i = 0; i < 1000; i++)
+			EATEST_VERIFY((m.count(i) == 1) == ((i % 2) == 1));
+
+		// Erase a range.
+		flat_hash_map<int, int>::iterator it = m.erase(m.begin(), m.end());
+		EATEST_VERIFY((it == m.end()) && m.empty());
+		EATEST_VERIFY(m.validate());
+
+		m.clear(true);
+		EATEST_VERIFY(m.empty() && (m.bucket_count() == 0));
+		EATEST_VERIFY(m.validate());
+	}
+
+
+	{
+		// Insert/erase churn exercises tombstone handling (rehash in place vs growth).
+		flat_hash_map<int, int> m;
+		hash_map<int, int>      h;
+
+		EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+		for(int i = 0; i < 20000; i++)
+		{
+			const int key = (int)rng.RandRange(0, 600);
+
+			if(rng.RandLimit(3) == 0)
+				EATEST_VERIFY(m.erase(key) == h.erase(key));
+			else
+			{
+				m[key] = i;
+				h[key] = i;
+			}
+		}
+
+		EATEST_VERIFY(m.validate());
+		EATEST_VERIFY(m.size() == h.size());
+		EATEST_VERIFY(m.bucket_count() < 4096); // Churn alone shouldn't have caused unbounded growth.
+
+		for(hash_map<int, int>::iterator hi = h.begin(); hi != h.end(); ++hi)
+		{
+			flat_hash_map<int, int>::iterator mi = m.find(hi->first);
+			EATEST_VERIFY((mi != m.end()) && (mi->second == hi->second));
+		}
+
+		m.rehash(0);
+		EATEST_VERIFY(m.validate() && (m.size() == h.size()));
+	}
+
+
+	{
+		// Many colliding hash values.
+		flat_hash_map<int, int, CollidingHash> m;
+
+		for(int i = 0; i < 300; i++)
+			m.insert(eastl::make_pair(i, i));
+		for(int i = 0; i < 300; i += 3)
+			m.erase(i);
+
+		EATEST_VERIFY(m.size() == 200);
+		EATEST_VERIFY(m.validate());
+
+		for(int i = 0; i < 300; i++)
+			EATEST_VERIFY((m.find(i) != m.end()) == ((i % 3) != 0));
+	}
+
+
+	{
+		// try_emplace, insert_or_assign, operator[], at, insert(key), emplace, equal_range
+		flat_hash_map<eastl::string, TestObject> m;
+		TestObject::Reset();
+
+		{
+			eastl::pair<flat_hash_map<eastl::string, TestObject>::iterator, bool> result = m.try_emplace(eastl::string("a"), 1);
+			EATEST_VERIFY(result.second && (result.first->second.mX == 1));
+
+			result = m.try_emplace(eastl::string("a"), 2);
+			EATEST_VERIFY(!result.second && (result.first->second.mX == 1));
+
+			result = m.insert_or_assign(eastl::string("a"), TestObject(3));
+			EATEST_VERIFY(!result.second && (result.first->second.mX == 3));
+
+			result = m.insert_or_assign(eastl::string("b"), TestObject(4));
+			EATEST_VERIFY(result.second && (result.first->second.mX == 4));
+
+			m["c"].mX = 5;
+			EATEST_VERIFY(m.at("c").mX == 5);
+
+			result = m.insert(eastl::string("d"));
+			EATEST_VERIFY(result.second && (result.first->second.mX == 0));
+
+			result = m.emplace(eastl::string("e"), TestObject(6));
+			EATEST_VERIFY(result.second && (result.first->second.mX == 6));
+
+			flat_hash_map<eastl::string, TestObject>::iterator it = m.try_emplace(m.begin(), eastl::string("f"), 7);
+			EATEST_VERIFY(it->second.mX == 7);
+
+			EATEST_VERIFY(m.size() == 6);
+			EATEST_VERIFY(m.validate());
+
+			// find_as with const char*, which avoids the construction of a string.
+			flat_hash_map<eastl::string, TestObject>::iterator itAs = m.find_as("e");
+			EATEST_VERIFY((itAs != m.end()) && (itAs->second.mX == 6));
+			EATEST_VERIFY(m.find_as("z") == m.end());
+
+			itAs = m.find_as("b", eastl::hash<const char*>(), eastl::equal_to_2<eastl::string, const char*>());
+			EATEST_VERIFY((itAs != m.end()) && (itAs->second.mX == 4));
+
+			eastl::pair<flat_hash_map<eastl::string, TestObject>::iterator, flat_hash_map<eastl::string, TestObject>::iterator> er = m.equal_range("c");
+			EATEST_VERIFY((eastl::distance(er.first, er.second) == 1) && (er.first->second.mX == 5));
+
+			er = m.equal_range("x");
+			EATEST_VERIFY((er.first == m.end()) && (er.second == m.end()));
+
+			#if EASTL_EXCEPTIONS_ENABLED
+				bool bThrown = false;
+				try { m.at("x"); }
+				catch(std::out_of_range&) { bThrown = true; }
+				EATEST_VERIFY(bThrown);
+			#endif
+
+			// Grow the table with non-trivial keys and values, which relocates them.
+			for(int i = 0; i < 500; i++)
+			{
+				eastl::string key;
+				key.sprintf("key%d", i);
+				m.try_emplace(key, i);
+			}
+
+			EATEST_VERIFY(m.size() == 506);
+			EATEST_VERIFY(m.validate());
+			EATEST_VERIFY(m.find_as("key123")->second.mX == 123);
+		}
+
+		m.clear(true);
+		EATEST_VERIFY(TestObject::IsClear());
+		TestObject::Reset();
+	}
+
+
+	{
+		// Copy, move, swap, assignment and comparison.
+		TestObject::Reset();
+
+		{
+			flat_hash_set<TestObject> s1;
+			for(int i = 0; i < 100; i++)
+				s1.insert(TestObject(i));
+
+			flat_hash_set<TestObject> s2(s1);
+			EATEST_VERIFY((s2.size() == 100) && s2.validate());
+			EATEST_VERIFY(s1 == s2);
+
+			s2.erase(TestObject(50));
+			EATEST_VERIFY(s1 != s2);
+
+			flat_hash_set<TestObject> s3(eastl::move(s2));
+			EATEST_VERIFY((s3.size() == 99) && s2.empty() && s2.validate() && s3.validate());
+
+			s2 = s1;
+			EATEST_VERIFY(s2 == s1);
+
+			s3.swap(s2);
+			EATEST_VERIFY((s3.size() == 100) && (s2.size() == 99));
+
+			eastl::swap(s2, s3);
+			EATEST_VERIFY((s2.size() == 100) && (s3.size() == 99));
+
+			s3 = eastl::move(s2);
+			EATEST_VERIFY((s3.size() == 100) && s3.validate());
+
+			s1.reserve(1000);
+			EATEST_VERIFY((s1.capacity() >= 1000) && s1.validate());
+			const flat_hash_set<TestObject>::size_type nBucketCount = s1.bucket_count();
+			for(int i = 100; i < 1000; i++)
+				s1.emplace(i);
+			EATEST_VERIFY(s1.bucket_count() == nBucketCount); // reserve means no further growth.
+			EATEST_VERIFY((s1.size() == 1000) && s1.validate());
+		}
+
+		EATEST_VERIFY(TestObject::IsClear());
+		TestObject::Reset();
+	}
+
+
+	{
+		// initializer_list and iterator range support.
+		flat_hash_map<int, double> m = { {12,12.0}, {13,13.0}, {14,14.0} };
+		EATEST_VERIFY(m.size() == 3);
+		EATEST_VERIFY(m.find(13)->second == 13.0);
+
+		m = { {22,22.0}, {23,23.0} };
+		EATEST_VERIFY((m.size() == 2) && (m.find(12) == m.end()) && (m.find(22) != m.end()));
+
+		m.insert({ {24,24.0}, {25,25.0} });
+		EATEST_VERIFY(m.size() == 4);
+
+		flat_hash_set<int> s = { 1, 2, 3, 3, 2, 1 };
+		EATEST_VERIFY((s.size() == 3) && s.validate());
+
+		eastl::vector<int> v;
+		for(int i = 0; i < 100; i++)
+			v.push_back(i % 50);
+
+		flat_hash_set<int> s2(v.begin(), v.end());
+		EATEST_VERIFY((s2.size() == 50) && s2.validate());
+	}
+
+
+	{
+		// fixed_flat_hash_map / fixed_flat_hash_set
+		typedef fixed_flat_hash_map<int, int, 100, false> FixedMap;
+		typedef fixed_flat_hash_map<int, int, 8, true>    FixedOverflowMap;
+		typedef fixed_flat_hash_set<int, 50, false>       FixedSet;
+
+		{
+			FixedMap m;
+			EATEST_VERIFY(m.empty() && (m.capacity() >= 100) && (m.max_size() == 100));
+
+			for(int i = 0; i < 100; i++)
+				m[i] = i;
+			EATEST_VERIFY((m.size() == 100) && m.validate());
+
+			// Churn within the fixed capacity must never need to allocate.
+			for(int j = 0; j < 20; j++)
+			{
+				for(int i = 0; i < 100; i += 2)
+					m.erase(i + (j * 100));
+				for(int i = 0; i < 100; i += 2)
+					m[i + ((j + 1) * 100)] = i;
+				EATEST_VERIFY((m.size() == 100) && m.validate());
+			}
+
+			FixedMap m2(m);
+			EATEST_VERIFY((m2 == m) && m2.validate());
+
+			m2.clear(true);
+			EATEST_VERIFY(m2.empty() && (m2.capacity() >= 100));
+
+			m2 = m;
+			EATEST_VERIFY(m2 == m);
+
+			FixedMap m3;
+			m3[1] = 1;
+			m3.swap(m2);
+			EATEST_VERIFY((m3.size() == 100) && (m2.size() == 1) && m2.validate() && m3.validate());
+
+			m3.clear();
+			EATEST_VERIFY(m3.empty() && m3.validate());
+		}
+
+		{
+			FixedOverflowMap m;
+			const FixedOverflowMap::size_type nInitialBucketCount = m.bucket_count();
+
+			for(int i = 0; i < 1000; i++)
+				m.insert(eastl::make_pair(i, i));
+			EATEST_VERIFY((m.size() == 1000) && (m.bucket_count() > nInitialBucketCount) && m.validate());
+
+			m.clear(true); // Returns to using the internal buffer.
+			EATEST_VERIFY(m.empty() && (m.bucket_count() == nInitialBucketCount) && m.validate());
+
+			m.insert(eastl::make_pair(3, 3));
+			EATEST_VERIFY(m.find(3)->second == 3);
+		}
+
+		{
+			FixedSet s = { 1, 2, 3 };
+			EATEST_VERIFY((s.size() == 3) && s.validate());
+
+			for(int i = 0; i < 50; i++)
+				s.insert(i);
+			EATEST_VERIFY((s.size() == 50) && s.validate());
+			EATEST_VERIFY(s.find(49) != s.end());
+		}
+	}
+
+
+	{
+		// Heterogeneous lookup via a transparent hash and predicate.
+		typedef eastl::basic_string<char, MallocAllocator> MallocString;
+		typedef eastl::hash<eastl::string_view>            StringViewHash;
+
+		nErrorCount += TestMapHeterogeneousLookup<flat_hash_map<MallocString, int, StringViewHash, eastl::equal_to<void>>, false>();
+		nErrorCount += TestSetHeterogeneousLookup<flat_hash_set<MallocString, StringViewHash, eastl::equal_to<void>>, false>();
+	}
+
+	return nErrorCount;
+}
@@ -0,0 +1,231 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+
+#include "EASTLTest.h"
+#include <EASTL/frozen_vector_map.h>
+#include <EASTL/frozen_vector_set.h>
+#include <EASTL/vector_map.h>
+#include <EASTL/vector_set.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+using namespace eastl;
+
+
+// Template instantations.
+// These tell the compiler to compile all the functions for the given class.
+template class eastl::frozen_vector_map<int, int>;
+template class eastl::frozen_vector_map<TestObject, TestObject>;
+template class eastl::frozen_vector_set<int>;
+template class eastl::frozen_vector_set<TestObject>;
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+
+// frozen_vector_map's value_type is pair<const Key, T>, whereas vector_map's is pair<Key, T>.
+static bool FrozenVectorMapElementsEqual(const pair<const int, int>& a, const pair<int, int>& b)
+{
+	return (a.first == b.first) && (a.second == b.second);
+}
+
+
+// Builds frozen containers of random keys and verifies that lookups, iteration
+// and reverse iteration agree with vector_map and vector_set.
+static int TestFrozenVectorMapRandom(EA::UnitTest::Rand& rng, int nSize, int nKeyRange)
+{
+	int nErrorCount = 0;
+
+	vector<pair<int, int> > input;
+	vector_map<int, int>    vm;
+	vector_set<int>         vs;
+
+	for(int i = 0; i < nSize; ++i)
+	{
+		const int key = (int)rng.RandLimit((uint32_t)nKeyRange);
+
+		input.push_back(make_pair(key, i));
+		vm.insert(make_pair(key, i)); // The first of equivalent keys wins, as with insert.
+		vs.insert(key);
+	}
+
+	const frozen_vector_map<int, int> fm(input.begin(), input.end());
+
+	vector<int> keys;
+	for(eastl_size_t i = 0; i < input.size(); ++i)
+		keys.push_back(input[i].first);
+
+	const frozen_vector_set<int> fs(keys.begin(), keys.end());
+
+	EATEST_VERIFY(fm.validate());
+	EATEST_VERIFY(fs.validate());
+	EATEST_VERIFY(fm.size() == vm.size());
+	EATEST_VERIFY(fs.size() == vs.size());
+	EATEST_VERIFY(fm.empty() == vm.empty());
+	EATEST_VERIFY(eastl::distance(fm.begin(), fm.end()) == (ptrdiff_t)vm.size());
+	EATEST_VERIFY(eastl::equal(fm.begin(), fm.end(), vm.begin(), FrozenVectorMapElementsEqual));
+	EATEST_VERIFY(eastl::equal(fm.rbegin(), fm.rend(), vm.rbegin(), FrozenVectorMapElementsEqual));
+	EATEST_VERIFY(eastl::equal(fs.begin(), fs.end(), vs.begin()));
+	EATEST_VERIFY(eastl::equal(fs.rbegin(), fs.rend(), vs.rbegin()));
+
+	for(int key = -1; key <= nKeyRange; ++key)
+	{
+		const frozen_vector_map<int, int>::const_iterator itLower = fm.lower_bound(key);
+		const frozen_vector_map<int, int>::const_iterator itUpper = fm.upper_bound(key);
+		const vector_map<int, int>::const_iterator        itVMLower = vm.lower_bound(key);
+		const vector_map<int, int>::const_iterator        itVMUpper = vm.upper_bound(key);
+
+		EATEST_VERIFY((itLower == fm.end()) ? (itVMLower == vm.end()) : FrozenVectorMapElementsEqual(*itLower, *itVMLower));
+		EATEST_VERIFY((itUpper == fm.end()) ? (itVMUpper == vm.end()) : FrozenVectorMapElementsEqual(*itUpper, *itVMUpper));
+		EATEST_VERIFY(fm.count(key) == vm.count(key));
+		EATEST_VERIFY(fm.contains(key) == (vm.find(key) != vm.end()));
+		EATEST_VERIFY((fm.find(key) == fm.end()) ? (vm.find(key) == vm.end()) : (fm.find(key)->second == vm.find(key)->second));
+		EATEST_VERIFY(eastl::distance(fm.equal_range(key).first, fm.equal_range(key).second) == (ptrdiff_t)vm.count(key));
+		EATEST_VERIFY(fm.equal_range(key).first == itLower);
+
+		const frozen_vector_set<int>::const_iterator itSetLower = fs.lower_bound(key);
+		const frozen_vector_set<int>::const_iterator itSetUpper = fs.upper_bound(key);
+
+		EATEST_VERIFY((itSetLower == fs.end()) ? (vs.lower_bound(key) == vs.end()) : (*itSetLower == *vs.lower_bound(key)));
+		EATEST_VERIFY((itSetUpper == fs.end()) ? (vs.upper_bound(key) == vs.end()) : (*itSetUpper == *vs.upper_bound(key)));
+		EATEST_VERIFY(fs.count(key) == vs.count(key));
+		EATEST_VERIFY(eastl::distance(fs.equal_range(key).first, fs.equal_range(key).second) == (ptrdiff_t)vs.count(key));
+	}
+
+	return nErrorCount;
+}
+
+
+int TestFrozenVectorMap()
+{
+	int nErrorCount = 0;
+
+	{
+		// Every size up to a few complete trees and then some, each with distinct and with repeated keys.
+		EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+		for(int nSize = 0; nSize <= 70; ++nSize)
+		{
+			nErrorCount += TestFrozenVectorMapRandom(rng, nSize, nSize * 4 + 1);
+			nErrorCount += TestFrozenVectorMapRandom(rng, nSize, nSize / 2 + 1);
+		}
+
+		nErrorCount += TestFrozenVectorMapRandom(rng, 5000, 20000);
+	}
+
+
+	{
+		// Empty containers.
+		frozen_vector_map<int, int> fm;
+		frozen_vector_set<int>      fs;
+
+		EATEST_VERIFY(fm.validate() && fs.validate());
+		EATEST_VERIFY(fm.empty() && fs.empty());
+		EATEST_VERIFY((fm.begin() == fm.end()) && (fs.begin() == fs.end()));
+		EATEST_VERIFY((fm.rbegin() == fm.rend()) && (fs.rbegin() == fs.rend()));
+		EATEST_VERIFY((fm.find(1) == fm.end()) && (fs.find(1) == fs.end()));
+		EATEST_VERIFY((fm.lower_bound(1) == fm.end()) && (fs.upper_bound(1) == fs.end()));
+	}
+
+
+	{
+		// Construction from initializer lists, with the first of equivalent keys kept.
+		frozen_vector_map<int, string> fm = { {3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"} };
+
+		EATEST_VERIFY(fm.validate());
+		EATEST_VERIFY(fm.size() == 3);
+		EATEST_VERIFY(fm.at(1) == "one");
+		EATEST_VERIFY(fm.at(2) == "two");
+		EATEST_VERIFY(fm.at(3) == "three");
+
+		fm.find(2)->second = "deux"; // Mapped values are mutable.
+		EATEST_VERIFY(fm.at(2) == "deux");
+
+		const int expected[] = { 1, 2, 3 };
+		int i = 0;
+		for(frozen_vector_map<int, string>::iterator it = fm.begin(); it != fm.end(); ++it, ++i)
+			EATEST_VERIFY(it->first == expected[i]);
+
+		frozen_vector_set<int, greater<int> > fs = { 5, 1, 4, 1, 5, 9, 2, 6 };
+
+		EATEST_VERIFY(fs.validate());
+		EATEST_VERIFY(fs.size() == 6);
+
+		const int expectedSet[] = { 9, 6, 5, 4, 2, 1 };
+		EATEST_VERIFY(eastl::equal(fs.begin(), fs.end(), expectedSet));
+		EATEST_VERIFY(*fs.lower_bound(3) == 2);
+		EATEST_VERIFY(*fs.upper_bound(5) == 4);
+
+		fs.assign({ 7, 8 });
+		EATEST_VERIFY((fs.size() == 2) && (*fs.begin() == 8));
+
+		fs.clear();
+		EATEST_VERIFY(fs.empty() && fs.validate());
+	}
+
+
+	{
+		// Copy, move, swap and comparison.
+		frozen_vector_map<int, int> fm1 = { {1, 10}, {2, 20}, {3, 30} };
+		frozen_vector_map<int, int> fm2(fm1);
+
+		EATEST_VERIFY(fm1 == fm2);
+
+		fm2.find(3)->second = 31;
+		EATEST_VERIFY(fm1 != fm2);
+
+		frozen_vector_map<int, int> fm3(eastl::move(fm2));
+		EATEST_VERIFY((fm3.at(3) == 31) && fm3.validate());
+
+		fm3 = fm1;
+		EATEST_VERIFY(fm3 == fm1);
+
+		frozen_vector_map<int, int> fm4 = { {4, 40} };
+		fm4.swap(fm3);
+		EATEST_VERIFY((fm4 == fm1) && (fm3.size() == 1) && (fm3.at(4) == 40));
+
+		fm4 = frozen_vector_map<int, int>();
+		EATEST_VERIFY(fm4.empty() && fm4.validate());
+
+		frozen_vector_set<TestObject> fs1 = { TestObject(3), TestObject(1), TestObject(2) };
+		frozen_vector_set<TestObject> fs2 = { TestObject(2), TestObject(3), TestObject(1) };
+		EATEST_VERIFY(fs1 == fs2);
+
+		fs2 = frozen_vector_set<TestObject>({ TestObject(2) });
+		EATEST_VERIFY(fs1 != fs2);
+	}
+
+
+	#if EASTL_EXCEPTIONS_ENABLED
+	{
+		// at() throws for keys which aren't present.
+		const frozen_vector_map<int, int> fm = { {1, 10}, {3, 30} };
+		bool bThrown = false;
+
+		try
+		{
+			fm.at(2);
+		}
+		catch(std::out_of_range&)
+		{
+			bThrown = true;
+		}
+
+		EATEST_VERIFY(bThrown);
+	}
+	#endif
+
+
+	{
+		// The keys stored for searching are in Eytzinger order: the root is the median.
+		const int values[] = { 1, 2, 3, 4, 5, 6, 7 };
+		frozen_vector_set<int> fs(values, values + 7);
+
+		const int expected[] = { 4, 2, 6, 1, 3, 5, 7 };
+		EATEST_VERIFY(eastl::equal(fs.keys().begin(), fs.keys().end(), expected));
+	}
+
+	return nErrorCount;
+}
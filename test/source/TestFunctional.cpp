@@ -9,6 +9,8 @@
 #include <EASTL/memory.h>
 #include <EASTL/functional.h>
 #include <EASTL/hash_set.h>
+#include <EASTL/string.h>
+#include <EASTL/fixed_string.h>
 #include <EASTL/set.h>
 #include <EASTL/list.h>
 #include <EAStdC/EAString.h>
@@ -351,6 +353,64 @@ int TestFunctional()
 		EATEST_VERIFY(hs16.empty());
 	}
 
+	{
+		// String hashes
+		// All string-like types hash the same characters to the same value.
+		typedef eastl::fixed_string<char, 64> FixedString64;
+
+		const char*     p8  = "abcdefghijklmnopqrstuvwxyz0123456789";
+		const char16_t* p16 = EA_CHAR16("abcdefghijklmnopqrstuvwxyz0123456789");
+
+		for(eastl_size_t i = 0, iEnd = eastl::CharStrlen(p8); i <= iEnd; i++)
+		{
+			const eastl::string         s8(p8 + i);
+			const eastl::u16string      s16(p16 + i);
+			const eastl::string_view    sv8(p8 + i);
+			const eastl::u16string_view sv16(p16 + i);
+			const size_t                h8  = eastl::hash<const char*>()(p8 + i);
+			const size_t                h16 = eastl::hash<const char16_t*>()(p16 + i);
+
+			EATEST_VERIFY(eastl::hash<eastl::string>()(s8) == h8);
+			EATEST_VERIFY(eastl::hash<eastl::string_view>()(sv8) == h8);
+			EATEST_VERIFY(eastl::string_hash<eastl::string>()(s8) == h8);
+			EATEST_VERIFY(eastl::hash<FixedString64>()(FixedString64(p8 + i)) == h8);
+			EATEST_VERIFY(eastl::hash<eastl::u16string>()(s16) == h16);
+			EATEST_VERIFY(eastl::hash<eastl::u16string_view>()(sv16) == h16);
+		}
+
+		#if EASTL_STRING_HASH_LEGACY
+			uint32_t fnv = 2166136261U;
+			for(const char* p = p8; *p; ++p)
+				fnv = (fnv * 16777619) ^ (uint8_t)*p;
+			EATEST_VERIFY(eastl::hash<eastl::string>()(eastl::string(p8)) == (size_t)fnv);
+		#else
+			// Every length from 0 to 256, including the 4, 8, 16 and 48 byte step boundaries, and every
+			// byte position affects the hash. The hash doesn't depend on the alignment of the string.
+			char buffer[300];
+			memset(buffer, 'x', sizeof(buffer));
+			eastl::hash_set<size_t> hashes;
+
+			for(size_t n = 0; n <= 256; n++)
+			{
+				const size_t h = eastl::Internal::HashBytes(buffer, n);
+				EATEST_VERIFY(hashes.insert(h).second);
+				EATEST_VERIFY(eastl::Internal::HashBytes(buffer + 3, n) == h);
+
+				for(size_t i = 0; i < n; i++)
+				{
+					buffer[i] = 'y';
+					EATEST_VERIFY(eastl::Internal::HashBytes(buffer, n) != h);
+					buffer[i] = 'x';
+				}
+			}
+
+			// Embedded NUL characters are hashed like any other character.
+			const eastl::string a("a\0b", 3), b("a\0c", 3);
+			EATEST_VERIFY(eastl::hash<eastl::string>()(a) != eastl::hash<eastl::string>()(b));
+			EATEST_VERIFY(eastl::hash<eastl::string>()(a) != eastl::hash<const char*>()(a.c_str()));
+		#endif
+	}
+
 	{
 		// unary_compose
 		/*
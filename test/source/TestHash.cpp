@@ -15,6 +15,7 @@
 #include <EASTL/algorithm.h>
 #include <EASTL/vector.h>
 #include <EASTL/unique_ptr.h>
+#include <EASTL/bit.h>
 
 EA_DISABLE_ALL_VC_WARNINGS()
 #include <string.h>
@@ -81,6 +82,24 @@ struct HashtableValueHash
 
 
 
+// A user-defined rehash policy derived from power_of_two_rehash_policy, which
+// selects mask_range_hashing by specializing rehash_policy_traits.
+struct DerivedPowerOfTwoRehashPolicy : public eastl::power_of_two_rehash_policy
+{
+	DerivedPowerOfTwoRehashPolicy(float fMaxLoadFactor = 1.f)
+		: eastl::power_of_two_rehash_policy(fMaxLoadFactor) { }
+};
+
+namespace eastl
+{
+	template <>
+	struct rehash_policy_traits<DerivedPowerOfTwoRehashPolicy>
+	{
+		typedef mask_range_hashing range_hashing_type;
+	};
+}
+
+
 // Explicit Template instantiations.
 // These tell the compiler to compile all the functions for the given class.
 template class eastl::hashtable<int,
@@ -135,6 +154,10 @@ template class eastl::hash_set<Align32>;
 template class eastl::hash_multiset<Align32>;
 template class eastl::hash_map<Align32, Align32>;
 template class eastl::hash_multimap<Align32, Align32>;
+template class eastl::hash_set<int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, false, eastl::power_of_two_rehash_policy>;
+template class eastl::hash_map<int, int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, true, eastl::power_of_two_rehash_policy>;
+template class eastl::hash_map<int, int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, false, eastl::incremental_rehash_policy>;
+template class eastl::hash_multiset<int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, true, eastl::incremental_rehash_policy>;
 
 // validate static assumptions about hashtable core types
 typedef eastl::hash_node<int, false> HashNode1;
@@ -688,6 +711,22 @@ int TestHash()
 	}
 
 
+	{
+		// Heterogeneous lookup via a transparent hash and predicate.
+		typedef eastl::basic_string<char, MallocAllocator> MallocString;
+		typedef eastl::hash<eastl::string_view>            StringViewHash;
+
+		nErrorCount += TestMapHeterogeneousLookup<eastl::hash_map<MallocString, int, StringViewHash, eastl::equal_to<void>>, false>();
+		nErrorCount += TestMapHeterogeneousLookup<eastl::hash_multimap<MallocString, int, StringViewHash, eastl::equal_to<void>>, true>();
+		nErrorCount += TestMapHeterogeneousLookup<eastl::hash_map<MallocString, int, StringViewHash, eastl::equal_to<void>, EASTLAllocatorType, true>, false>();
+		nErrorCount += TestSetHeterogeneousLookup<eastl::hash_set<MallocString, StringViewHash, eastl::equal_to<void>>, false>();
+		nErrorCount += TestSetHeterogeneousLookup<eastl::hash_multiset<MallocString, StringViewHash, eastl::equal_to<void>>, true>();
+
+		eastl::hash_set<int> hs = { 1, 2, 3 }; // The non-template contains.
+		EATEST_VERIFY(hs.contains(1) && !hs.contains(4));
+	}
+
+
 	{
 		// initializer_list support.
 		// hash_set(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
@@ -1400,6 +1439,431 @@ int TestHash()
 		}
 	}
 
+	{   // power_of_two_rehash_policy
+		{
+			EATEST_VERIFY(eastl::power_of_two_rehash_policy::GetPrevBucketCountOnly(1)   == 1);
+			EATEST_VERIFY(eastl::power_of_two_rehash_policy::GetPrevBucketCountOnly(2)   == 2);
+			EATEST_VERIFY(eastl::power_of_two_rehash_policy::GetPrevBucketCountOnly(100) == 64);
+
+			eastl::power_of_two_rehash_policy policy(0.5f);
+			EATEST_VERIFY(policy.GetNextBucketCount(0)   == 2);
+			EATEST_VERIFY(policy.GetNextBucketCount(100) == 128);
+			EATEST_VERIFY(policy.mnNextResize == 64);
+			EATEST_VERIFY(policy.GetBucketCount(100)     == 256);
+
+			eastl::pair<bool, uint32_t> rehash = policy.GetRehashRequired(256, 128, 1);
+			EATEST_VERIFY(rehash.first && (rehash.second == 512));
+		}
+
+		{
+			typedef eastl::hash_map<int, int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, false, eastl::power_of_two_rehash_policy> IntIntHashMap;
+			typedef eastl::hash_map<int, int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, true,  eastl::power_of_two_rehash_policy> IntIntHashMapCached;
+			typedef eastl::unordered_set<uint64_t, eastl::hash<uint64_t>, eastl::equal_to<uint64_t>, EASTLAllocatorType, false, eastl::power_of_two_rehash_policy> UInt64HashSet;
+
+			IntIntHashMap       hashMap;
+			IntIntHashMapCached hashMapCached;
+			UInt64HashSet       hashSet;
+
+			for(int i = 0; i < 10000; i++)
+			{
+				hashMap.insert(eastl::make_pair(i * 16, i));        // Keys which are a multiple of the bucket count would all collide without mixing.
+				hashMapCached.insert(eastl::make_pair(i * 16, i));
+				hashSet.insert((uint64_t)i << 32);                  // Keys which differ only in their high bits.
+			}
+
+			EATEST_VERIFY(hashMap.validate() && hashMapCached.validate() && hashSet.validate());
+			EATEST_VERIFY(eastl::has_single_bit((uint32_t)hashMap.bucket_count()));
+			EATEST_VERIFY(eastl::has_single_bit((uint32_t)hashSet.bucket_count()));
+			EATEST_VERIFY(hashMap.load_factor() <= hashMap.get_max_load_factor());
+
+			size_t nMaxBucketSize = 0;
+			for(size_t i = 0; i < hashSet.bucket_count(); i++)
+				nMaxBucketSize = eastl::max_alt(nMaxBucketSize, (size_t)hashSet.bucket_size(i));
+			EATEST_VERIFY(nMaxBucketSize < 16);
+
+			for(int i = 0; i < 10000; i++)
+			{
+				EATEST_VERIFY(hashMap.find(i * 16) != hashMap.end() && (hashMap.find(i * 16)->second == i));
+				EATEST_VERIFY(hashMapCached.find_as(i * 16, eastl::hash<int>(), eastl::equal_to<int>()) != hashMapCached.end());
+				EATEST_VERIFY(hashSet.count((uint64_t)i << 32) == 1);
+			}
+			EATEST_VERIFY(hashMap.find(8) == hashMap.end());
+
+			for(int i = 0; i < 10000; i += 2)
+				hashMap.erase(i * 16);
+			EATEST_VERIFY(hashMap.size() == 5000);
+
+			hashMap.rehash(4096);
+			EATEST_VERIFY(hashMap.validate() && (hashMap.bucket_count() == 4096));
+
+			hashMap.rehash(5000); // Rounded up to a power of two, as mask_range_hashing requires.
+			EATEST_VERIFY(hashMap.validate() && (hashMap.bucket_count() == 8192));
+			EATEST_VERIFY(hashMap.find(16)->second == 1);
+
+			hashMap.reserve(10000);
+			EATEST_VERIFY(hashMap.validate() && eastl::has_single_bit((uint32_t)hashMap.bucket_count()) && (hashMap.bucket_count() >= 10000));
+
+			hashMap.set_max_load_factor(4.f);
+			EATEST_VERIFY(hashMap.get_max_load_factor() == 4.f);
+			EATEST_VERIFY(hashMap.find(16)->second == 1);
+		}
+
+		{
+			// rehash rounds up to a power of two for any rehash policy which is paired with mask_range_hashing.
+			typedef eastl::hash_map<int, int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, false, DerivedPowerOfTwoRehashPolicy> DerivedPolicyHashMap;
+			typedef eastl::hashtable<int, eastl::pair<const int, int>, EASTLAllocatorType, eastl::use_first<eastl::pair<const int, int> >, eastl::equal_to<int>, eastl::hash<int>,
+			                         eastl::mask_range_hashing, eastl::default_ranged_hash, eastl::prime_rehash_policy, false, true, true> PrimeMaskHashtable;
+
+			DerivedPolicyHashMap derivedMap;
+			for(int i = 0; i < 100; i++)
+				derivedMap[i] = i;
+
+			derivedMap.rehash(100);
+			EATEST_VERIFY(derivedMap.validate() && (derivedMap.bucket_count() == 128));
+			EATEST_VERIFY((derivedMap.size() == 100) && (derivedMap.find(50)->second == 50));
+
+			PrimeMaskHashtable primeMask(0, eastl::hash<int>(), eastl::mask_range_hashing(), eastl::default_ranged_hash(),
+			                             eastl::equal_to<int>(), eastl::use_first<eastl::pair<const int, int> >());
+			for(int i = 0; i < 100; i++)
+				primeMask.insert(eastl::pair<const int, int>(i, i));
+
+			primeMask.rehash(100);
+			EATEST_VERIFY(primeMask.validate() && (primeMask.bucket_count() == 128));
+			EATEST_VERIFY((primeMask.size() == 100) && (primeMask.find(50)->second == 50));
+
+			primeMask.rehash(0);
+			EATEST_VERIFY(primeMask.validate() && (primeMask.bucket_count() == 2) && (primeMask.find(50)->second == 50));
+		}
+	}
+
+	{   // incremental_rehash_policy
+		typedef eastl::hash_map<int, int, eastl::hash<int>, eastl::equal_to<int>, CountingAllocator, false, eastl::incremental_rehash_policy> IntIntHashMap;
+		typedef eastl::hash_multiset<int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, true, eastl::incremental_rehash_policy> IntHashMultiset;
+
+		CountingAllocator::resetCount();
+		{
+			IntIntHashMap hashMap;
+			int n = 0;
+
+			for(; hashMap.bucket_count() < 100; n++)
+				hashMap.insert(eastl::make_pair(n, n));
+
+			const int* const pValue2 = &hashMap.find(2)->second;
+			const size_t nBucketCount = hashMap.bucket_count();
+
+			for(; hashMap.bucket_count() == nBucketCount; n++)
+				hashMap.insert(eastl::make_pair(n, n));
+
+			// The table has grown, but its nodes have yet to be moved out of the old bucket array, which is still allocated.
+			EATEST_VERIFY(CountingAllocator::activeAllocCount == hashMap.size() + 2);
+			EATEST_VERIFY(hashMap.validate() && (hashMap.size() == (size_t)n));
+
+			// Lookups, iteration and erasure see the elements in both bucket arrays.
+			int nSum = 0;
+			for(IntIntHashMap::const_iterator it = hashMap.begin(); it != hashMap.end(); ++it)
+				nSum += it->second;
+			EATEST_VERIFY(nSum == (n * (n - 1)) / 2);
+			EATEST_VERIFY(eastl::distance(hashMap.begin(), hashMap.end()) == n);
+
+			for(int i = 0; i < n; i++)
+				EATEST_VERIFY((hashMap.find(i) != hashMap.end()) && (hashMap.count(i) == 1) && (hashMap.find(i)->second == i));
+			EATEST_VERIFY((hashMap.find(n) == hashMap.end()) && (hashMap.count(n) == 0));
+
+			for(int i = 0; i < n; i += 3)
+				EATEST_VERIFY(hashMap.erase(i) == 1);
+			for(IntIntHashMap::iterator it = hashMap.begin(); it != hashMap.end(); )
+				it = ((it->first % 3) == 1) ? hashMap.erase(it) : eastl::next(it);
+			EATEST_VERIFY(hashMap.validate() && (hashMap.size() == (size_t)(n / 3)));
+			EATEST_VERIFY(CountingAllocator::activeAllocCount == hashMap.size() + 2);
+
+			for(int i = 0; i < n; i++)
+				EATEST_VERIFY((hashMap.count(i) == 1) == ((i % 3) == 2));
+
+			// A copy has every element, in a single bucket array.
+			IntIntHashMap hashMapCopy(hashMap);
+			EATEST_VERIFY(hashMapCopy.validate() && (hashMapCopy.size() == hashMap.size()));
+			EATEST_VERIFY(CountingAllocator::activeAllocCount == (hashMap.size() + 2) + (hashMapCopy.size() + 1));
+			for(int i = 2; i < n; i += 3)
+				EATEST_VERIFY(hashMapCopy.find(i)->second == i);
+
+			// Insertions (including those of keys which are present) move the remaining buckets, after
+			// which the old bucket array is freed. The elements themselves never move.
+			const size_t nNewBucketCount = hashMap.bucket_count();
+			EATEST_VERIFY(!hashMap.insert(eastl::make_pair(2, 0)).second && (hashMap.find(2)->second == 2));
+
+			for(int i = 0; i < n; i += 3)
+				EATEST_VERIFY(hashMap.insert(eastl::make_pair(i, i)).second && hashMap.validate());
+			EATEST_VERIFY((hashMap.bucket_count() == nNewBucketCount) && (hashMap.size() == hashMapCopy.size() + (n + 2) / 3));
+			EATEST_VERIFY(CountingAllocator::activeAllocCount == (hashMap.size() + 1) + (hashMapCopy.size() + 1));
+			EATEST_VERIFY(&hashMap.find(2)->second == pValue2);
+
+			// swap carries a migration in progress along, rehash completes it and clear frees it.
+			for(; hashMap.bucket_count() == nNewBucketCount; n++)
+				hashMap.insert(eastl::make_pair(n, n));
+			EATEST_VERIFY(CountingAllocator::activeAllocCount == (hashMap.size() + 2) + (hashMapCopy.size() + 1));
+
+			hashMap.swap(hashMapCopy);
+			EATEST_VERIFY(hashMap.validate() && hashMapCopy.validate() && (hashMapCopy.count(n - 1) == 1));
+
+			hashMapCopy.rehash(hashMapCopy.bucket_count());
+			EATEST_VERIFY(hashMapCopy.validate() && (hashMapCopy.count(n - 1) == 1));
+			EATEST_VERIFY(CountingAllocator::activeAllocCount == (hashMap.size() + 1) + (hashMapCopy.size() + 1));
+
+			for(const size_t nCount = hashMapCopy.bucket_count(); hashMapCopy.bucket_count() == nCount; n++)
+				hashMapCopy.insert(eastl::make_pair(n, n));
+			EATEST_VERIFY(CountingAllocator::activeAllocCount == (hashMap.size() + 1) + (hashMapCopy.size() + 2));
+
+			hashMapCopy.clear();
+			EATEST_VERIFY(hashMapCopy.validate() && hashMapCopy.empty() && (hashMapCopy.begin() == hashMapCopy.end()));
+			EATEST_VERIFY(CountingAllocator::activeAllocCount == (hashMap.size() + 1) + 1);
+		}
+		EATEST_VERIFY(CountingAllocator::activeAllocCount == 0);
+
+		{
+			IntHashMultiset hashMultiset;
+
+			for(int i = 0; i < 1000; i++)
+			{
+				hashMultiset.insert(i % 250);
+				EATEST_VERIFY((i % 97) || hashMultiset.validate());
+			}
+
+			EATEST_VERIFY(hashMultiset.validate() && (hashMultiset.size() == 1000));
+
+			for(int i = 0; i < 250; i++)
+			{
+				const eastl::pair<IntHashMultiset::iterator, IntHashMultiset::iterator> range = hashMultiset.equal_range(i);
+				EATEST_VERIFY((hashMultiset.count(i) == 4) && (eastl::distance(range.first, range.second) == 4)); // Equal keys are kept contiguous.
+			}
+
+			EATEST_VERIFY(hashMultiset.erase(7) == 4);
+			EATEST_VERIFY((hashMultiset.count(7) == 0) && (hashMultiset.size() == 996) && hashMultiset.validate());
+
+			hashMultiset.set_max_load_factor(0.25f); // Rehashes at once.
+			EATEST_VERIFY((hashMultiset.get_max_load_factor() == 0.25f) && (hashMultiset.rehash_policy().mnMigrateBucketCount == 4));
+			EATEST_VERIFY(hashMultiset.validate() && (hashMultiset.load_factor() <= 0.25f) && (hashMultiset.count(8) == 4));
+		}
+	}
+
+
+	{   // find_batch / contains_batch
+		typedef eastl::hash_map<int, int> IntIntHashMap;
+		typedef eastl::hash_set<eastl::string, eastl::hash<eastl::string>, eastl::equal_to<eastl::string>, EASTLAllocatorType, true> StringHashSet;
+		typedef eastl::hash_map<int, int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, false, eastl::incremental_rehash_policy> IncrementalHashMap;
+
+		IntIntHashMap hashMap;
+		for(int i = 0; i < 1000; i += 2)
+			hashMap.insert(eastl::make_pair(i, i * 3));
+
+		// More keys than kFindBatchGroupSize, and not a multiple of it.
+		eastl::vector<int> keys;
+		for(int i = 0; i < 101; i++)
+			keys.push_back((i * 37) % 1100);
+
+		eastl::vector<IntIntHashMap::iterator>       results(keys.size());
+		eastl::vector<IntIntHashMap::const_iterator> constResults(keys.size());
+		bool found[101];
+
+		hashMap.find_batch(eastl::span<const int>(keys.data(), keys.size()), eastl::span<IntIntHashMap::iterator>(results.data(), results.size()));
+		eastl::as_const(hashMap).find_batch(eastl::span<const int>(keys.data(), keys.size()), eastl::span<IntIntHashMap::const_iterator>(constResults.data(), constResults.size()));
+		const eastl_size_t nFoundCount = hashMap.contains_batch(eastl::span<const int>(keys.data(), keys.size()), found);
+
+		eastl_size_t nExpectedFoundCount = 0;
+		for(eastl_size_t i = 0; i < keys.size(); i++)
+		{
+			EATEST_VERIFY(results[i] == hashMap.find(keys[i]));
+			EATEST_VERIFY(constResults[i] == results[i]);
+			EATEST_VERIFY(found[i] == hashMap.contains(keys[i]));
+			if(found[i])
+			{
+				EATEST_VERIFY(results[i]->second == keys[i] * 3);
+				nExpectedFoundCount++;
+			}
+		}
+		EATEST_VERIFY((nFoundCount == nExpectedFoundCount) && (nFoundCount > 0) && (nFoundCount < keys.size()));
+
+		// An empty key span, and an empty table.
+		EATEST_VERIFY(hashMap.contains_batch(eastl::span<const int>(), eastl::span<bool>()) == 0);
+		IntIntHashMap emptyMap;
+		emptyMap.find_batch(eastl::span<const int>(keys.data(), keys.size()), eastl::span<IntIntHashMap::iterator>(results.data(), results.size()));
+		EATEST_VERIFY(eastl::count(results.begin(), results.end(), emptyMap.end()) == (ptrdiff_t)keys.size());
+
+		// Cached hash codes and a non-trivial key type.
+		StringHashSet stringSet;
+		stringSet.insert("apple");
+		stringSet.insert("banana");
+		stringSet.insert("cherry");
+		const eastl::string stringKeys[4] = { "banana", "durian", "apple", "" };
+		StringHashSet::iterator stringResults[4];
+		stringSet.find_batch(stringKeys, stringResults);
+		EATEST_VERIFY((*stringResults[0] == "banana") && (stringResults[1] == stringSet.end()) && (*stringResults[2] == "apple") && (stringResults[3] == stringSet.end()));
+
+		// Lookups in the middle of an incremental rehash find elements in both bucket arrays.
+		IncrementalHashMap incrementalMap;
+		incrementalMap.rehash_policy(eastl::incremental_rehash_policy(1.f, 1));
+		int n = 0;
+		for(eastl_size_t nBucketCount = 0; (n < 100) || (incrementalMap.bucket_count() == nBucketCount); n++) // Stop right after a growth.
+		{
+			nBucketCount = incrementalMap.bucket_count();
+			incrementalMap.insert(eastl::make_pair(n, n));
+		}
+
+		keys.clear();
+		for(int i = 0; i < n + 20; i++)
+			keys.push_back(i);
+		bool incrementalFound[512];
+		EATEST_VERIFY(keys.size() <= 512);
+		EATEST_VERIFY(incrementalMap.contains_batch(eastl::span<const int>(keys.data(), keys.size()), eastl::span<bool>(incrementalFound, keys.size())) == (eastl_size_t)n);
+		for(eastl_size_t i = 0; i < keys.size(); i++)
+			EATEST_VERIFY(incrementalFound[i] == ((int)i < n));
+		EATEST_VERIFY(incrementalMap.validate());
+	}
+
+	{
+		// node_handle_type        extract(const_iterator position);
+		// node_handle_type        extract(const key_type& k);
+		// node_insert_return_type insert(node_handle_type&& nh);
+		// iterator                insert(const_iterator hint, node_handle_type&& nh);
+		// void                    merge(Source&& source);
+		typedef hash_map<int, eastl::string, eastl::hash<int>, eastl::equal_to<int>, CountingAllocator, true>      IntStringHashMap;
+		typedef hash_multimap<int, eastl::string, eastl::hash<int>, eastl::equal_to<int>, CountingAllocator, true> IntStringHashMultimap;
+
+		IntStringHashMap hashMap1, hashMap2;
+		for(int i = 0; i < 10; i++)
+			hashMap1.emplace(i, eastl::string(eastl::string::CtorSprintf(), "%d", i));
+		hashMap2.reserve(16);
+		CountingAllocator::resetCount();
+
+		IntStringHashMap::node_handle_type nh = hashMap1.extract(3);
+		EATEST_VERIFY(nh && (nh.key() == 3) && (nh.mapped() == "3"));
+		EATEST_VERIFY((hashMap1.size() == 9) && (hashMap1.find(3) == hashMap1.end()) && hashMap1.validate());
+
+		nh.key() = 30; // Re-key the element. Its cached hash code is recalculated on insertion.
+		IntStringHashMap::node_insert_return_type result = hashMap1.insert(eastl::move(nh));
+		EATEST_VERIFY(result.inserted && !nh && (result.position->first == 30) && (result.position->second == "3"));
+		EATEST_VERIFY((hashMap1.find(30) == result.position) && hashMap1.validate());
+
+		nh = hashMap1.extract(hashMap1.find(0));
+		nh.key() = 5;
+		IntStringHashMap::iterator it = hashMap1.insert(hashMap1.end(), eastl::move(nh)); // Fails, as 5 is already present.
+		EATEST_VERIFY((it->first == 5) && (it->second == "5") && nh && (nh.mapped() == "0"));
+
+		hashMap2.insert(eastl::move(nh));
+		EATEST_VERIFY((hashMap2.size() == 1) && (hashMap2.find(5)->second == "0"));
+		EATEST_VERIFY(hashMap1.extract(1000).empty());
+
+		// hashMap1 is {1, 2, 4, 5, 6, 7, 8, 9, 30} and hashMap2 is {5}.
+		hashMap2.merge(hashMap1);
+		EATEST_VERIFY((hashMap2.size() == 9) && (hashMap1.size() == 1) && (hashMap1.begin()->second == "5"));
+		EATEST_VERIFY((hashMap2.find(5)->second == "0") && hashMap1.validate() && hashMap2.validate());
+		EATEST_VERIFY((CountingAllocator::getAllocationCount() == 0) && (CountingAllocator::activeAllocCount == 0)); // No node was allocated or freed.
+
+		IntStringHashMultimap hashMultimap;
+		hashMultimap.merge(hashMap1);
+		hashMultimap.merge(eastl::move(hashMap2));
+		EATEST_VERIFY(hashMap1.empty() && hashMap2.empty() && (hashMultimap.size() == 10) && (hashMultimap.count(5) == 2));
+
+		IntStringHashMultimap::node_handle_type mnh = hashMultimap.extract(30);
+		mnh.key() = 5;
+		hashMultimap.insert(eastl::move(mnh));
+		EATEST_VERIFY((hashMultimap.count(5) == 3) && hashMultimap.validate());
+
+		const eastl::pair<IntStringHashMultimap::iterator, IntStringHashMultimap::iterator> range = hashMultimap.equal_range(5);
+		EATEST_VERIFY(eastl::distance(range.first, range.second) == 3); // Equal keys are kept contiguous.
+	}
+
+	{
+		// merge between unordered_set and unordered_multiset
+		eastl::unordered_set<int>      set1 = { 1, 2, 3 };
+		eastl::unordered_set<int>      set2 = { 3, 4 };
+		eastl::unordered_multiset<int> multiset1;
+
+		set1.merge(set2);
+		EATEST_VERIFY((set1.size() == 4) && (set2.size() == 1) && (*set2.begin() == 3));
+
+		multiset1.merge(set1);
+		multiset1.merge(set2);
+		EATEST_VERIFY(set1.empty() && set2.empty() && (multiset1.size() == 5) && (multiset1.count(3) == 2) && multiset1.validate());
+	}
+
+	#if EASTL_HASHTABLE_STATS
+	{
+		// hashtable_stats get_stats() const;
+		// void            reset_stats();
+		// size_t          format_hashtable_stats(const hashtable_stats& stats, char* pBuffer, size_t nBufferCapacity);
+		struct ConstantHash { size_t operator()(int) const { return 7; } }; // Puts every element into the same bucket.
+
+		typedef hash_map<int, int, ConstantHash, eastl::equal_to<int>, EASTLAllocatorType, false> BadHashMap;
+		typedef hash_map<int, int, ConstantHash, eastl::equal_to<int>, EASTLAllocatorType, true>  BadHashMapCached;
+		typedef hash_map<int, int, eastl::hash<int>, eastl::equal_to<int>, EASTLAllocatorType, true> GoodHashMapCached;
+
+		BadHashMap        badMap;
+		BadHashMapCached  badMapCached;
+		GoodHashMapCached goodMap;
+
+		for(int i = 0; i < 100; i++)
+		{
+			badMap.insert(eastl::make_pair(i, i));
+			badMapCached.insert(eastl::make_pair(i, i));
+			goodMap.insert(eastl::make_pair(i, i));
+		}
+
+		hashtable_stats stats = badMap.get_stats();
+		EATEST_VERIFY(stats.mnElementCount == 100);
+		EATEST_VERIFY(stats.mnBucketCount == badMap.bucket_count());
+		EATEST_VERIFY((stats.mnUsedBucketCount == 1) && (stats.mnMaxChainLength == 100));
+		EATEST_VERIFY(stats.mChainLengthHistogram[0] == (stats.mnBucketCount - 1));
+		EATEST_VERIFY(stats.mChainLengthHistogram[hashtable_stats::kChainLengthHistogramSize - 1] == 1);
+		EATEST_VERIFY(stats.mnRehashCount > 0);
+		EATEST_VERIFY(stats.mnLookupCount >= 100);
+		EATEST_VERIFY(stats.mnProbeCount == stats.mnKeyCompareCount); // Without cached hash codes every probe compares keys.
+
+		badMap.reset_stats();
+		badMapCached.reset_stats();
+		goodMap.reset_stats();
+		stats = badMap.get_stats();
+		EATEST_VERIFY((stats.mnLookupCount == 0) && (stats.mnProbeCount == 0) && (stats.mnRehashCount == 0));
+		EATEST_VERIFY(stats.mnElementCount == 100); // The histogram describes the current contents and isn't reset.
+
+		for(int i = 0; i < 100; i++)
+		{
+			EATEST_VERIFY(badMap.find(i) != badMap.end());
+			EATEST_VERIFY(badMapCached.find(i) != badMapCached.end());
+			EATEST_VERIFY(goodMap.find(i) != goodMap.end());
+		}
+
+		// Elements are pushed to the front of the chain, so key i is found after 100 - i probes.
+		stats = badMap.get_stats();
+		EATEST_VERIFY((stats.mnLookupCount == 100) && (stats.mnProbeCount == 5050) && (stats.mnKeyCompareCount == 5050));
+		EATEST_VERIFY(stats.average_probe_count() == 50.5f);
+		EATEST_VERIFY(stats.mnHashCodeRejectCount == 0);
+
+		// Identical hash codes mean the cached codes can't reject anything.
+		stats = badMapCached.get_stats();
+		EATEST_VERIFY((stats.mnProbeCount == 5050) && (stats.mnKeyCompareCount == 5050) && (stats.mnHashCodeRejectCount == 0));
+
+		// With a good hash and cached hash codes, nearly every lookup makes a single key comparison.
+		stats = goodMap.get_stats();
+		EATEST_VERIFY(stats.mnLookupCount == 100);
+		EATEST_VERIFY(stats.mnKeyCompareCount == 100);
+		EATEST_VERIFY(stats.mnProbeCount == (stats.mnKeyCompareCount + stats.mnHashCodeRejectCount));
+		EATEST_VERIFY(stats.mnMaxChainLength < 8);
+
+		goodMap.rehash(goodMap.bucket_count() * 2 + 1);
+		EATEST_VERIFY(goodMap.get_stats().mnRehashCount == 1);
+
+		char buffer[2048];
+		const size_t nLength = format_hashtable_stats(badMap.get_stats(), buffer, sizeof(buffer));
+		EATEST_VERIFY((nLength > 0) && (nLength == strlen(buffer)));
+		EATEST_VERIFY(strstr(buffer, "lookups: 100,") != NULL);
+		EATEST_VERIFY(strstr(buffer, "  15+:          1") != NULL);
+
+		char smallBuffer[16];
+		EATEST_VERIFY(format_hashtable_stats(badMap.get_stats(), smallBuffer, sizeof(smallBuffer)) == nLength);
+		EATEST_VERIFY(strlen(smallBuffer) == (sizeof(smallBuffer) - 1));
+	}
+	#endif
+
 	return nErrorCount;
 }
 
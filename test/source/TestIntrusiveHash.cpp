@@ -751,6 +751,72 @@ int TestIntrusiveHash()
 		VERIFY(hs.validate());
 	}
 
+	{
+		// void      find_batch(span<const key_type> keys, span<iterator> results);
+		// void      find_batch(span<const key_type> keys, span<const_iterator> results) const;
+		// size_type contains_batch(span<const key_type> keys, span<bool> results) const;
+		eastl::intrusive_hash_set<SetWidget, 37, SWHash> hs;
+		SetWidget nodes[100];
+
+		for(int i = 0; i < 100; i += 2)
+		{
+			nodes[i].mX = i;
+			hs.insert(nodes[i]);
+		}
+
+		SetWidget keys[40];
+		for(int i = 0; i < 40; i++)
+			keys[i].mX = (i * 7) % 120;
+
+		eastl::intrusive_hash_set<SetWidget, 37, SWHash>::iterator       results[40];
+		eastl::intrusive_hash_set<SetWidget, 37, SWHash>::const_iterator constResults[40];
+		bool found[40];
+
+		hs.find_batch(keys, results);
+		eastl::as_const(hs).find_batch(keys, constResults);
+		const eastl_size_t nFoundCount = hs.contains_batch(keys, found);
+
+		eastl_size_t nExpectedFoundCount = 0;
+		for(int i = 0; i < 40; i++)
+		{
+			VERIFY(results[i] == hs.find(keys[i]));
+			VERIFY(constResults[i] == results[i]);
+			VERIFY(found[i] == (hs.find(keys[i]) != hs.end()));
+			if(found[i])
+			{
+				VERIFY(&*results[i] == &nodes[keys[i].mX]);
+				nExpectedFoundCount++;
+			}
+		}
+		VERIFY((nFoundCount == nExpectedFoundCount) && (nFoundCount > 0) && (nFoundCount < 40));
+	}
+
+	#if EASTL_HASHTABLE_STATS
+	{
+		// hashtable_stats get_stats() const;
+		// void            reset_stats();
+		eastl::intrusive_hash_set<SetWidget, 37, SWHash> hs;
+		SetWidget nodes[74];
+
+		for(int i = 0; i < 74; i++)
+		{
+			nodes[i].mX = i;
+			hs.insert(nodes[i]);
+		}
+
+		hs.reset_stats();
+
+		for(int i = 0; i < 74; i++)
+			VERIFY(hs.find(nodes[i]) != hs.end());
+
+		const eastl::hashtable_stats stats = hs.get_stats();
+		VERIFY((stats.mnElementCount == 74) && (stats.mnBucketCount == 37));
+		VERIFY((stats.mnUsedBucketCount == 37) && (stats.mnMaxChainLength == 2) && (stats.mChainLengthHistogram[2] == 37));
+		VERIFY((stats.mnLookupCount == 74) && (stats.mnProbeCount == 111) && (stats.mnKeyCompareCount == 111));
+		VERIFY((stats.mnHashCodeRejectCount == 0) && (stats.mnRehashCount == 0));
+	}
+	#endif
+
 	return nErrorCount;
 }
 
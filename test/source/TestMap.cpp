@@ -91,6 +91,25 @@ int TestMap()
 	}
 
 
+	{
+		// Heterogeneous lookup via a transparent comparison.
+		typedef eastl::basic_string<char, MallocAllocator> MallocString;
+
+		nErrorCount += TestMapHeterogeneousLookup<eastl::map<MallocString, int, eastl::less<void>>, false>();
+		nErrorCount += TestMapHeterogeneousLookup<eastl::multimap<MallocString, int, eastl::less<void>>, true>();
+
+		eastl::map<eastl::string, int, eastl::less<void>> m = { {"a", 0}, {"c", 1}, {"e", 2} };
+		EATEST_VERIFY(m.lower_bound(eastl::string_view("b"))->first == "c");
+		EATEST_VERIFY(m.lower_bound("c")->first == "c");
+		EATEST_VERIFY(m.upper_bound(eastl::string_view("c"))->first == "e");
+		EATEST_VERIFY(m.upper_bound("e") == m.end());
+		EATEST_VERIFY(m.contains(eastl::string("a")) && !m.contains(eastl::string("b")));
+
+		eastl::map<int, int> mi = { {1, 1}, {2, 2} }; // The non-template contains.
+		EATEST_VERIFY(mi.contains(1) && !mi.contains(3));
+	}
+
+
 	{ // Misc tests
 
 		// const key_compare& key_comp() const;
@@ -177,6 +196,107 @@ int TestMap()
 //        EATEST_VERIFY(p1 == p2); 
 //    }
 
+	{
+		// node_handle_type        extract(const_iterator position);
+		// node_handle_type        extract(const key_type& key);
+		// node_insert_return_type insert(node_handle_type&& nh);
+		// iterator                insert(const_iterator hint, node_handle_type&& nh);
+		// void                    merge(Source&& source);
+		typedef eastl::map<int, eastl::string, eastl::less<int>, CountingAllocator>      IntStringMap;
+		typedef eastl::multimap<int, eastl::string, eastl::less<int>, CountingAllocator> IntStringMultimap;
+
+		IntStringMap map1, map2;
+		for(int i = 0; i < 10; i++)
+			map1.emplace(i, eastl::string(eastl::string::CtorSprintf(), "%d", i));
+		CountingAllocator::resetCount();
+
+		IntStringMap::node_handle_type nh = map1.extract(3);
+		EATEST_VERIFY(!nh.empty() && (nh.key() == 3) && (nh.mapped() == "3"));
+		EATEST_VERIFY((map1.size() == 9) && (map1.find(3) == map1.end()) && map1.validate());
+
+		nh.key() = 30; // Re-key the element.
+		IntStringMap::node_insert_return_type result = map1.insert(eastl::move(nh));
+		EATEST_VERIFY(result.inserted && nh.empty() && result.node.empty());
+		EATEST_VERIFY((result.position->first == 30) && (result.position->second == "3") && map1.validate());
+
+		nh = map1.extract(map1.begin());
+		nh.key() = 5;
+		result = map1.insert(eastl::move(nh)); // Fails, as 5 is already present.
+		EATEST_VERIFY(!result.inserted && (result.position->first == 5) && (result.position->second == "5"));
+		EATEST_VERIFY(result.node && (result.node.key() == 5) && (result.node.mapped() == "0"));
+
+		IntStringMap::iterator it = map2.insert(map2.end(), eastl::move(result.node));
+		EATEST_VERIFY((it->first == 5) && (it->second == "0") && (map2.size() == 1));
+
+		EATEST_VERIFY(map1.extract(1000).empty());
+		EATEST_VERIFY(map1.insert(IntStringMap::node_handle_type()).position == map1.end());
+
+		// map1 is {1, 2, 4, 5, 6, 7, 8, 9, 30} and map2 is {5}.
+		map2.merge(map1);
+		EATEST_VERIFY((map2.size() == 9) && (map1.size() == 1) && (map1.begin()->first == 5) && (map1.begin()->second == "5"));
+		EATEST_VERIFY((map2.find(5)->second == "0") && map1.validate() && map2.validate());
+
+		IntStringMultimap multimap1;
+		multimap1.merge(map1);
+		multimap1.merge(eastl::move(map2));
+		EATEST_VERIFY(map1.empty() && map2.empty() && (multimap1.size() == 10) && (multimap1.count(5) == 2) && multimap1.validate());
+
+		IntStringMultimap::node_handle_type mnh = multimap1.extract(multimap1.find(30));
+		mnh.key() = 5;
+		IntStringMultimap::iterator itm = multimap1.insert(eastl::move(mnh));
+		EATEST_VERIFY((itm->first == 5) && (multimap1.count(5) == 3) && multimap1.validate());
+
+		map1.merge(multimap1); // Only one of the three elements with key 5 can move.
+		EATEST_VERIFY((map1.size() == 8) && (multimap1.size() == 2) && (multimap1.count(5) == 2));
+
+		EATEST_VERIFY((CountingAllocator::getAllocationCount() == 0) && (CountingAllocator::activeAllocCount == 0)); // No node was allocated or freed.
+
+		{
+			IntStringMap::node_handle_type nhDiscarded = map1.extract(map1.begin());
+		}
+		EATEST_VERIFY((map1.size() == 7) && (CountingAllocator::activeAllocCount == (uint64_t)-1)); // A handle frees its node when destroyed.
+	}
+
+	{
+		// map(assume_sorted_t, Iterator itBegin, Iterator itEnd, ...);
+		// void join(this_type& x);
+		// void split(const key_type& key, this_type& x);
+		typedef eastl::map<int, eastl::string, eastl::less<int>, CountingAllocator> IntStringMap;
+
+		eastl::vector<eastl::pair<int, eastl::string> > snapshot;
+		for(int i = 0; i < 100; ++i)
+			snapshot.push_back(eastl::make_pair(i * 10, eastl::string(eastl::string::CtorSprintf(), "%d", i)));
+
+		IntStringMap map1(eastl::assume_sorted, snapshot.begin(), snapshot.end());
+		EATEST_VERIFY(map1.validate() && (map1.size() == 100) && (map1[500] == "50") && (map1.rbegin()->first == 990));
+
+		IntStringMap map2;
+		CountingAllocator::resetCount();
+
+		map1.split(495, map2);
+		EATEST_VERIFY(map1.validate() && map2.validate() && (map1.size() == 50) && (map2.size() == 50));
+		EATEST_VERIFY((map1.rbegin()->first == 490) && (map2.begin()->first == 500) && (map2.rbegin()->second == "99"));
+
+		map1.split(1000, map2); // Nothing is at or after 1000, so map2 becomes empty.
+		EATEST_VERIFY(map2.empty() && (map1.size() == 50));
+		map1.split(300, map2);
+		map1.join(map2);
+		EATEST_VERIFY(map1.validate() && map2.empty() && (map1.size() == 50) && (map1.rbegin()->first == 490));
+
+		EATEST_VERIFY(CountingAllocator::getAllocationCount() == 0); // The nodes are relinked, not copied.
+
+		// A multimap split puts all the elements with the key in the second container.
+		eastl::multimap<int, int> mm1, mm2;
+		for(int i = 0; i < 30; ++i)
+			mm1.insert(eastl::make_pair(i / 3, i));
+		mm1.split(4, mm2);
+		EATEST_VERIFY((mm1.size() == 12) && (mm2.size() == 18) && (mm2.count(4) == 3) && mm1.validate() && mm2.validate());
+		mm2.insert(eastl::make_pair(3, 100));
+		mm1.join(mm2); // Equal keys may meet at the join.
+		EATEST_VERIFY(mm2.empty() && (mm1.size() == 31) && (mm1.count(3) == 4) && (mm1.count(4) == 3) && mm1.validate());
+	}
+
+
 
 	return nErrorCount;
 }
@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+
+#include "EASTLTest.h"
+#include <EASTL/rank_select.h>
+#include <EASTL/bitvector.h>
+#include <EASTL/vector.h>
+
+using namespace eastl;
+
+
+// Template instantations.
+// These tell the compiler to compile all the functions for the given class.
+template class eastl::rank_select< eastl::bitvector<> >;
+template class eastl::rank_select< eastl::bitvector<EASTLAllocatorType, uint8_t>, MallocAllocator >;
+template class eastl::rank_select< eastl::bitvector<EASTLAllocatorType, int32_t> >;
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+
+// Checks rank and select against a scan of the bitvector, for bitvectors of several sizes
+// and densities. As in TestBitVector, pop_back leaves stale bits past the end of each.
+template <typename Bitvector>
+static int TestRankSelectScan(EA::UnitTest::Rand& rng)
+{
+	typedef rank_select<Bitvector> RankSelect;
+
+	int nErrorCount = 0;
+
+	const eastl_size_t sizes[]     = { 0, 1, 63, 64, 511, 512, 2048, 2049, 10000, 300007 };
+	const uint32_t     densities[] = { 0, 2, 100, 500, 1000 }; // Out of 1000.
+
+	for(size_t s = 0; s < EAArrayCount(sizes); s++)
+	{
+		for(size_t d = 0; d < EAArrayCount(densities); d++)
+		{
+			const eastl_size_t n = sizes[s];
+			Bitvector          bv;
+
+			for(eastl_size_t i = 0; i < n + 3; i++)
+				bv.push_back(rng.RandLimit(1000) < densities[d]);
+			for(eastl_size_t i = 0; i < 3; i++)
+				bv.pop_back();
+
+			RankSelect rs(bv);
+			EATEST_VERIFY(rs.validate());
+			EATEST_VERIFY(rs.size() == n);
+
+			eastl::vector<eastl_size_t> positions; // The position of each on bit.
+			for(eastl_size_t i = 0; i < n; i++)
+			{
+				if(bv[i])
+					positions.push_back(i);
+			}
+
+			EATEST_VERIFY(rs.count() == positions.size());
+
+			eastl_size_t expectedRank = 0;
+			for(eastl_size_t i = 0; i <= n; i++)
+			{
+				EATEST_VERIFY(rs.rank(i) == expectedRank);
+				if((i < n) && bv[i])
+					++expectedRank;
+			}
+
+			for(eastl_size_t k = 0; k < positions.size(); k++)
+				EATEST_VERIFY(rs.select(k) == positions[k]);
+
+			EATEST_VERIFY(rs.select(positions.size()) == n);
+		}
+	}
+
+	return nErrorCount;
+}
+
+
+int TestRankSelect()
+{
+	int nErrorCount = 0;
+
+	EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+	nErrorCount += TestRankSelectScan< bitvector<> >(rng);
+	nErrorCount += TestRankSelectScan< bitvector<EASTLAllocatorType, uint8_t> >(rng);
+	nErrorCount += TestRankSelectScan< bitvector<EASTLAllocatorType, int32_t> >(rng);
+
+	{
+		// rank_select();
+		// void build(const bitvector_type& bv);
+		// void clear();
+
+		rank_select< bitvector<> > rs;
+		EATEST_VERIFY(rs.validate());
+		EATEST_VERIFY((rs.size() == 0) && (rs.count() == 0));
+
+		bitvector<> bv(5000);
+		bv[10] = true;
+		bv[4000] = true;
+		rs.build(bv);
+		EATEST_VERIFY(rs.validate());
+		EATEST_VERIFY((rs.count() == 2) && (rs.rank(4000) == 1) && (rs.rank(4001) == 2));
+		EATEST_VERIFY((rs.select(0) == 10) && (rs.select(1) == 4000));
+
+		// The index must be rebuilt after the bitvector changes.
+		bv[2000] = true;
+		rs.build(bv);
+		EATEST_VERIFY((rs.count() == 3) && (rs.rank(4000) == 2) && (rs.select(1) == 2000));
+
+		rs.clear();
+		EATEST_VERIFY(rs.validate());
+		EATEST_VERIFY((rs.size() == 0) && (rs.count() == 0));
+	}
+
+	{
+		// Sparse ID remapping: every 997th ID of 8M is in use, so the select samples are
+		// far apart. Also checks that the index is a small fraction of the bitvector.
+		const eastl_size_t kIdCount = 8 * 1024 * 1024;
+		bitvector<>        bv(kIdCount);
+
+		for(eastl_size_t id = 5; id < kIdCount; id += 997)
+			bv[id] = true;
+
+		rank_select< bitvector<> > rs(bv);
+		EATEST_VERIFY(rs.validate());
+
+		for(eastl_size_t k = 0; k < rs.count(); k += 101)
+		{
+			const eastl_size_t id = 5 + (k * 997);
+			EATEST_VERIFY((rs.rank(id) == k) && (rs.select(k) == id));
+		}
+
+		EATEST_VERIFY(rs.memory_size() <= ((kIdCount / 8) * 6 / 100));
+	}
+
+	return nErrorCount;
+}
@@ -0,0 +1,284 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+
+#include "EASTLTest.h"
+#include <EASTL/roaring_bitmap.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/iterator.h>
+#include <EASTL/sort.h>
+#include <EASTL/vector.h>
+
+using namespace eastl;
+
+
+// Template instantations.
+// These tell the compiler to compile all the functions for the given class.
+template class eastl::roaring_bitmap<>;
+template class eastl::roaring_bitmap<MallocAllocator>;
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+
+typedef eastl::vector<uint32_t> ValueVector;
+
+
+// Returns values sorted and without duplicates.
+static ValueVector SortUnique(ValueVector values)
+{
+	eastl::sort(values.begin(), values.end());
+	values.erase(eastl::unique(values.begin(), values.end()), values.end());
+	return values;
+}
+
+
+// Returns a random mix of the value patterns which give each kind of chunk: values spread
+// over the whole range (array chunks), dense values within a few chunks (bitmap chunks),
+// and long runs of consecutive values (run chunks, after run_optimize).
+static ValueVector MakeValues(EA::UnitTest::Rand& rng)
+{
+	ValueVector values;
+
+	for(int i = 0; i < 2000; i++)
+		values.push_back(rng.RandValue());
+
+	const uint32_t denseBase = rng.RandLimit(8) << 16;
+	for(int i = 0; i < 30000; i++)
+		values.push_back(denseBase + rng.RandLimit(65536 * 2));
+
+	for(int i = 0; i < 20; i++)
+	{
+		const uint32_t start = rng.RandValue() & 0xfffff000;
+		for(uint32_t j = 0, jEnd = rng.RandLimit(3000); j < jEnd; j++)
+			values.push_back(start + j);
+	}
+
+	values.push_back(0);
+	values.push_back(0xffffffff);
+
+	return values;
+}
+
+
+template <typename Bitmap>
+static bool BitmapMatches(const Bitmap& bitmap, const ValueVector& sortedValues)
+{
+	return bitmap.validate() && (bitmap.size() == sortedValues.size()) && eastl::equal(bitmap.begin(), bitmap.end(), sortedValues.begin());
+}
+
+
+int TestRoaringBitmap()
+{
+	int nErrorCount = 0;
+
+	EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+	{
+		// roaring_bitmap();
+		// bool add(value_type value);
+		// bool remove(value_type value);
+		// bool contains(value_type value) const;
+
+		roaring_bitmap<> rb;
+		EATEST_VERIFY(rb.validate() && rb.empty() && (rb.size() == 0) && (rb.begin() == rb.end()));
+
+		EATEST_VERIFY(rb.add(5));
+		EATEST_VERIFY(!rb.add(5));
+		EATEST_VERIFY(rb.add(0x12345678));
+		EATEST_VERIFY(rb.add(0xffffffff));
+		EATEST_VERIFY(rb.validate() && (rb.size() == 3) && (rb.cardinality() == 3));
+		EATEST_VERIFY(rb.contains(5) && rb.contains(0x12345678) && rb.contains(0xffffffff) && !rb.contains(6));
+
+		EATEST_VERIFY(rb.remove(0x12345678));
+		EATEST_VERIFY(!rb.remove(0x12345678));
+		EATEST_VERIFY(rb.validate() && (rb.size() == 2) && !rb.contains(0x12345678));
+
+		rb.clear();
+		EATEST_VERIFY(rb.validate() && rb.empty());
+
+		roaring_bitmap<> rbList = { 3, 1, 2, 0x10000 };
+		const uint32_t   expected[] = { 1, 2, 3, 0x10000 };
+		EATEST_VERIFY(rbList.validate() && eastl::equal(rbList.begin(), rbList.end(), expected));
+	}
+
+	{
+		// Adding and removing values across the array / bitmap boundary.
+		roaring_bitmap<MallocAllocator> rb;
+		ValueVector                     values;
+
+		for(uint32_t i = 0; i < 10000; i++)
+		{
+			const uint32_t value = 0x30000 + (i * 5);
+			rb.add(value);
+			values.push_back(value);
+		}
+		EATEST_VERIFY(BitmapMatches(rb, values));
+
+		for(uint32_t i = 0; i < 9000; i++)
+		{
+			const size_t index = rng.RandLimit((uint32_t)values.size());
+			EATEST_VERIFY(rb.remove(values[index]));
+			values.erase(values.begin() + index);
+		}
+		EATEST_VERIFY(BitmapMatches(rb, values));
+
+		for(size_t i = 0; i < values.size(); i++)
+			EATEST_VERIFY(rb.contains(values[i]) && !rb.contains(values[i] + 1));
+	}
+
+	{
+		// template <typename InputIterator> roaring_bitmap(InputIterator first, InputIterator last);
+		// bool run_optimize();
+		// Compare against a sorted vector of the same values, before and after run_optimize.
+
+		const ValueVector values = MakeValues(rng);
+		const ValueVector sorted = SortUnique(values);
+
+		roaring_bitmap<> rb(values.begin(), values.end());
+		EATEST_VERIFY(BitmapMatches(rb, sorted));
+
+		const roaring_bitmap<> rbCopy(rb);
+		EATEST_VERIFY(rb.run_optimize());
+		EATEST_VERIFY(BitmapMatches(rb, sorted));
+		EATEST_VERIFY((rb == rbCopy) && (rbCopy == rb));
+
+		for(int i = 0; i < 10000; i++)
+		{
+			const uint32_t value = (i & 1) ? sorted[rng.RandLimit((uint32_t)sorted.size())] : rng.RandValue();
+			EATEST_VERIFY(rb.contains(value) == eastl::binary_search(sorted.begin(), sorted.end(), value));
+		}
+
+		// Adding to and removing from run chunks.
+		roaring_bitmap<> rbEdit(rb);
+		ValueVector      edited(sorted);
+		for(int i = 0; i < 1000; i++)
+		{
+			const uint32_t value = sorted[rng.RandLimit((uint32_t)sorted.size())] + 1;
+			if(rbEdit.contains(value))
+			{
+				EATEST_VERIFY(rbEdit.remove(value));
+				edited.erase(eastl::lower_bound(edited.begin(), edited.end(), value));
+			}
+			else
+			{
+				EATEST_VERIFY(rbEdit.add(value));
+				edited.insert(eastl::lower_bound(edited.begin(), edited.end(), value), value);
+			}
+		}
+		EATEST_VERIFY(BitmapMatches(rbEdit, edited));
+
+		// The iterator works with algorithm.h.
+		EATEST_VERIFY((size_t)eastl::distance(rb.begin(), rb.end()) == sorted.size());
+		EATEST_VERIFY(*eastl::find(rb.begin(), rb.end(), sorted[sorted.size() / 2]) == sorted[sorted.size() / 2]);
+		EATEST_VERIFY((size_t)eastl::count_if(rb.begin(), rb.end(), [](uint32_t value) { return (value & 1) != 0; }) ==
+		              (size_t)eastl::count_if(sorted.begin(), sorted.end(), [](uint32_t value) { return (value & 1) != 0; }));
+	}
+
+	{
+		// this_type& operator|=(const this_type& x);
+		// this_type& operator&=(const this_type& x);
+		// this_type& operator-=(const this_type& x);
+
+		for(int i = 0; i < 4; i++)
+		{
+			const ValueVector a = SortUnique(MakeValues(rng));
+			ValueVector       bValues = MakeValues(rng);
+
+			// Make the operands overlap substantially.
+			for(size_t j = 0; j < a.size(); j += 3)
+				bValues.push_back(a[j]);
+			const ValueVector b = SortUnique(bValues);
+
+			roaring_bitmap<> rbA(a.begin(), a.end());
+			roaring_bitmap<> rbB(b.begin(), b.end());
+
+			if(i & 1)
+				rbA.run_optimize();
+			if(i & 2)
+				rbB.run_optimize();
+
+			ValueVector expected;
+
+			expected.clear();
+			eastl::set_union(a.begin(), a.end(), b.begin(), b.end(), eastl::back_inserter(expected));
+			EATEST_VERIFY(BitmapMatches(rbA | rbB, expected));
+
+			expected.clear();
+			eastl::set_intersection(a.begin(), a.end(), b.begin(), b.end(), eastl::back_inserter(expected));
+			EATEST_VERIFY(BitmapMatches(rbA & rbB, expected));
+
+			expected.clear();
+			eastl::set_difference(a.begin(), a.end(), b.begin(), b.end(), eastl::back_inserter(expected));
+			EATEST_VERIFY(BitmapMatches(rbA - rbB, expected));
+
+			expected.clear();
+			eastl::set_difference(b.begin(), b.end(), a.begin(), a.end(), eastl::back_inserter(expected));
+			EATEST_VERIFY(BitmapMatches(rbB - rbA, expected));
+		}
+
+		// Galloping intersection and difference of a small array chunk with a large one.
+		roaring_bitmap<> rbSmall, rbLarge;
+		ValueVector      small, large;
+
+		for(uint32_t i = 0; i < 4000; i++)
+			large.push_back(i * 16);
+		for(uint32_t i = 0; i < 50; i++)
+			small.push_back(i * 1000);
+
+		rbSmall.add(small.begin(), small.end());
+		rbLarge.add(large.begin(), large.end());
+
+		ValueVector expected;
+		eastl::set_intersection(small.begin(), small.end(), large.begin(), large.end(), eastl::back_inserter(expected));
+		EATEST_VERIFY(BitmapMatches(rbSmall & rbLarge, expected));
+		EATEST_VERIFY(BitmapMatches(rbLarge & rbSmall, expected));
+
+		expected.clear();
+		eastl::set_difference(small.begin(), small.end(), large.begin(), large.end(), eastl::back_inserter(expected));
+		EATEST_VERIFY(BitmapMatches(rbSmall - rbLarge, expected));
+
+		// Operations with self.
+		roaring_bitmap<> rbSelf(large.begin(), large.end());
+		rbSelf |= rbSelf;
+		rbSelf &= rbSelf;
+		EATEST_VERIFY(BitmapMatches(rbSelf, large));
+		rbSelf -= rbSelf;
+		EATEST_VERIFY(rbSelf.validate() && rbSelf.empty());
+	}
+
+	{
+		// size_type serialized_size() const;
+		// size_type serialize(void* pBuffer, size_type bufferSize) const;
+		// bool      deserialize(const void* pBuffer, size_type bufferSize);
+
+		const ValueVector values = MakeValues(rng);
+		roaring_bitmap<>  rb(values.begin(), values.end());
+		rb.run_optimize();
+
+		eastl::vector<uint8_t> buffer(rb.serialized_size());
+		EATEST_VERIFY(rb.serialize(buffer.data(), buffer.size() - 1) == 0);
+		EATEST_VERIFY(rb.serialize(buffer.data(), buffer.size()) == buffer.size());
+
+		roaring_bitmap<> rbRead;
+		EATEST_VERIFY(rbRead.deserialize(buffer.data(), buffer.size()));
+		EATEST_VERIFY(rbRead.validate() && (rbRead == rb));
+		EATEST_VERIFY(BitmapMatches(rbRead, SortUnique(values)));
+
+		// Malformed input is rejected and leaves the bitmap empty.
+		EATEST_VERIFY(!rbRead.deserialize(buffer.data(), buffer.size() - 2));
+		EATEST_VERIFY(rbRead.validate() && rbRead.empty());
+
+		buffer[0] ^= 1;
+		EATEST_VERIFY(!rbRead.deserialize(buffer.data(), buffer.size()));
+		EATEST_VERIFY(rbRead.empty());
+
+		const roaring_bitmap<> rbEmpty;
+		buffer.resize(rbEmpty.serialized_size());
+		EATEST_VERIFY(rbEmpty.serialize(buffer.data(), buffer.size()) == 8);
+		EATEST_VERIFY(rbRead.deserialize(buffer.data(), buffer.size()) && rbRead.empty());
+	}
+
+	return nErrorCount;
+}
@@ -8,6 +8,8 @@
 #include <EASTL/map.h>
 #include <EASTL/set.h>
 #include <EASTL/functional.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
 #include <EASTL/internal/config.h>
 #include <EABase/eabase.h>
 
@@ -92,6 +94,25 @@ int TestSet()
 	}
 
 
+	{
+		// Heterogeneous lookup via a transparent comparison.
+		typedef eastl::basic_string<char, MallocAllocator> MallocString;
+
+		nErrorCount += TestSetHeterogeneousLookup<eastl::set<MallocString, eastl::less<void>>, false>();
+		nErrorCount += TestSetHeterogeneousLookup<eastl::multiset<MallocString, eastl::less<void>>, true>();
+
+		eastl::set<eastl::string, eastl::less<void>> s = { "a", "c", "e" };
+		EATEST_VERIFY(*s.lower_bound(eastl::string_view("b")) == "c");
+		EATEST_VERIFY(*s.upper_bound("c") == "e");
+		EATEST_VERIFY(s.contains(eastl::string("a")) && !s.contains(eastl::string("b")));
+
+		eastl::set<int, eastl::less<void>> si = { 1, 2, 3 }; // erase(iterator) and erase(reverse_iterator) must not be taken as keys.
+		si.erase(si.begin());
+		si.erase(si.rbegin());
+		EATEST_VERIFY((si.size() == 1) && si.contains(2) && (si.count(2L) == 1));
+	}
+
+
 	{ // Misc tests
 
 		// const key_compare& key_comp() const;
@@ -103,6 +124,203 @@ int TestSet()
 		vs.key_comp() = kc;
 	}
 
+	{
+		// node_handle_type        extract(const key_type& key);
+		// node_insert_return_type insert(node_handle_type&& nh);
+		// void                    merge(Source&& source);
+		eastl::set<int>      set1 = { 1, 2, 3 };
+		eastl::set<int>      set2 = { 3, 4 };
+		eastl::multiset<int> multiset1;
+
+		eastl::set<int>::node_handle_type nh = set1.extract(2);
+		EATEST_VERIFY((nh.value() == 2) && (set1.size() == 2));
+		nh.value() = 20;
+		EATEST_VERIFY(set1.insert(eastl::move(nh)).inserted && (set1.count(20) == 1) && set1.validate());
+
+		set1.merge(set2);
+		EATEST_VERIFY((set1.size() == 4) && (set2.size() == 1) && (*set2.begin() == 3));
+
+		multiset1.merge(set1);
+		multiset1.merge(set2);
+		EATEST_VERIFY(set1.empty() && set2.empty() && (multiset1.size() == 5) && (multiset1.count(3) == 2) && multiset1.validate());
+	}
+
+	{
+		// EASTL_RBTREE_COMPACT_NODES
+		#if EASTL_RBTREE_COMPACT_NODES
+			static_assert(sizeof(eastl::rbtree_node_base) == ((3 * sizeof(void*)) + (EASTL_RBTREE_ORDER_STATISTICS ? sizeof(size_t) : 0)), "The color is expected to be stored in the parent pointer.");
+		#endif
+
+		// The parent and color of a node must be independent of each other, whichever way they are stored.
+		eastl::rbtree_node_base node;
+		node.set_parent_and_color(&node, kRBTreeColorRed);
+		node.set_color(kRBTreeColorBlack);
+		EATEST_VERIFY((node.parent() == &node) && (node.color() == kRBTreeColorBlack));
+		node.set_parent(NULL);
+		EATEST_VERIFY((node.parent() == NULL) && (node.color() == kRBTreeColorBlack));
+		node.set_color(kRBTreeColorRed);
+		EATEST_VERIFY((node.parent() == NULL) && (node.color() == kRBTreeColorRed));
+
+		// Exercise rebalancing on insertion and erasure, and swapping of roots, and validate the tree.
+		eastl::set<int> s1, s2;
+		for(int i = 0; i < 1000; ++i)
+			s1.insert((i * 7919) % 1000);
+		for(int i = 0; i < 1000; i += 3)
+			s1.erase(i);
+		s1.swap(s2);
+		EATEST_VERIFY(s1.empty() && s1.validate() && (s2.size() == 666) && s2.validate());
+		EATEST_VERIFY((*s2.begin() == 1) && (*s2.rbegin() == 998) && (*--s2.end() == 998));
+	}
+
+	{
+		// set(assume_sorted_t, Iterator itBegin, Iterator itEnd, ...);
+		// set(Iterator itBegin, Iterator itEnd);
+		// void insert(InputIterator first, InputIterator last);
+		eastl::vector<int> v;
+
+		for(int n = 0; n < 70; ++n) // Every tree shape up to a few levels deep.
+		{
+			eastl::set<int> s1(eastl::assume_sorted, v.begin(), v.end());
+			EATEST_VERIFY(s1.validate() && (s1.size() == v.size()) && eastl::equal(s1.begin(), s1.end(), v.begin()));
+
+			eastl::set<int> s2(v.begin(), v.end()); // v is sorted, so this takes the same path.
+			EATEST_VERIFY(s2.validate() && (s2 == s1));
+
+			eastl::set<int> s3;
+			s3.insert(v.begin(), v.end());
+			EATEST_VERIFY(s3.validate() && (s3 == s1));
+
+			v.push_back(n * 2);
+		}
+
+		// Ranges which aren't sorted, or have equivalent keys, are inserted as usual.
+		const int unsorted[] = { 3, 1, 2, 2, 5 };
+		const int duplicates[] = { 1, 2, 2, 3 };
+		eastl::set<int> s4(unsorted, unsorted + 5);
+		eastl::set<int> s5(duplicates, duplicates + 4);
+		eastl::multiset<int> ms1(duplicates, duplicates + 4);
+		eastl::multiset<int> ms2(eastl::assume_sorted, duplicates, duplicates + 4);
+		EATEST_VERIFY(s4.validate() && (s4.size() == 4) && s5.validate() && (s5.size() == 3));
+		EATEST_VERIFY(ms1.validate() && (ms1.size() == 4) && (ms2 == ms1) && (ms2.count(2) == 2));
+	}
+
+	{
+		// void join(this_type& x);
+		// void split(const key_type& key, this_type& x);
+		eastl::vector<int> v;
+		for(int i = 0; i < 70; ++i)
+			v.push_back(i * 2);
+
+		eastl::set<int> s1(eastl::assume_sorted, v.begin(), v.end());
+
+		for(int key = -1; key <= 140; ++key)
+		{
+			eastl::set<int> s2;
+			s1.split(key, s2);
+			EATEST_VERIFY(s1.validate() && s2.validate() && ((s1.size() + s2.size()) == 70));
+			EATEST_VERIFY((s1.empty() || (*s1.rbegin() < key)) && (s2.empty() || (*s2.begin() >= key)));
+
+			s1.join(s2);
+			EATEST_VERIFY(s2.empty() && s1.validate() && eastl::equal(s1.begin(), s1.end(), v.begin()));
+		}
+
+		// Trees built by random insertions and erasures, of differing heights.
+		EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+		for(int i = 0; i < 200; ++i)
+		{
+			eastl::set<int> sLeft, sRight;
+			const int nLeftCount  = (int)rng.RandLimit(300);
+			const int nRightCount = (int)rng.RandLimit(300);
+
+			for(int j = 0; j < nLeftCount; ++j)
+				sLeft.insert((int)rng.RandLimit(1000));
+			for(int j = 0; j < nRightCount; ++j)
+				sRight.insert(1000 + (int)rng.RandLimit(1000));
+			for(int j = 0; j < nLeftCount / 4; ++j)
+				sLeft.erase((int)rng.RandLimit(1000));
+
+			const eastl::set<int>::size_type nSize = sLeft.size() + sRight.size();
+			const int nSplitKey = (int)rng.RandLimit(2000);
+
+			sLeft.join(sRight);
+			EATEST_VERIFY(sLeft.validate() && sRight.empty() && (sLeft.size() == nSize));
+
+			sLeft.split(nSplitKey, sRight);
+			EATEST_VERIFY(sLeft.validate() && sRight.validate() && ((sLeft.size() + sRight.size()) == nSize));
+			EATEST_VERIFY((sLeft.empty() || (*sLeft.rbegin() < nSplitKey)) && (sRight.empty() || (*sRight.begin() >= nSplitKey)));
+			EATEST_VERIFY((eastl::set<int>::size_type)eastl::distance(sLeft.begin(), sLeft.end()) == sLeft.size());
+			EATEST_VERIFY((eastl::set<int>::size_type)eastl::distance(sRight.begin(), sRight.end()) == sRight.size());
+		}
+	}
+
+	#if EASTL_RBTREE_ORDER_STATISTICS
+	{
+		// iterator       select(size_type n);
+		// const_iterator select(size_type n) const;
+		// size_type      rank(const key_type& key) const;
+		// distance(rbtree_iterator first, rbtree_iterator last);
+		EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+		eastl::set<int> s;
+
+		EATEST_VERIFY((s.select(0) == s.end()) && (s.rank(5) == 0) && (eastl::distance(s.begin(), s.end()) == 0));
+
+		for(int i = 0; i < 2000; ++i)
+		{
+			const int key = (int)rng.RandLimit(1000);
+
+			if(rng.RandLimit(3))
+				s.insert(key);
+			else
+				s.erase(key);
+
+			if((i % 256) == 0)
+				EATEST_VERIFY(s.validate());
+		}
+		EATEST_VERIFY(s.validate());
+
+		eastl::set<int>::size_type n = 0;
+		for(eastl::set<int>::iterator it = s.begin(); it != s.end(); ++it, ++n)
+		{
+			EATEST_VERIFY(s.select(n) == it);
+			EATEST_VERIFY(s.rank(*it) == n);
+			EATEST_VERIFY((eastl::set<int>::size_type)eastl::distance(s.begin(), it) == n);
+			EATEST_VERIFY((eastl::set<int>::size_type)eastl::distance(it, s.end()) == (s.size() - n));
+		}
+		EATEST_VERIFY((s.select(s.size()) == s.end()) && (s.rank(1000) == s.size()));
+
+		// The rank of an absent key is the number of elements less than it.
+		const eastl::set<int>& sc = s;
+		for(int key = -1; key <= 1000; ++key)
+			EATEST_VERIFY(sc.rank(key) == (eastl::set<int>::size_type)eastl::distance(sc.begin(), sc.lower_bound(key)));
+
+		// Copies carry the subtree sizes with them.
+		eastl::set<int> s2(s);
+		EATEST_VERIFY(s2.validate() && ((s2.size() < 2) || (*s2.select(s2.size() / 2) == *s.select(s.size() / 2))));
+
+		// split and join keep the subtree sizes of both trees up to date.
+		eastl::set<int> s3;
+		s2.split(500, s3);
+		EATEST_VERIFY(s2.validate() && s3.validate() && (s3.rank(500) == 0) && (s2.rank(500) == s2.size()));
+		EATEST_VERIFY(s3.empty() || (*s3.select(0) >= 500));
+		s2.join(s3);
+		EATEST_VERIFY(s2.validate() && (s2.size() == s.size()) && (s2.rank(500) == s.rank(500)));
+
+		// With equivalent keys, rank is the index of the first of them.
+		eastl::multiset<int> ms;
+		for(int i = 0; i < 100; ++i)
+			ms.insert(i / 10);
+		ms.erase(ms.find(0));
+		EATEST_VERIFY(ms.validate() && (ms.rank(0) == 0) && (ms.rank(1) == 9) && (ms.rank(5) == 49) && (*ms.select(49) == 5) && (*ms.select(48) == 4));
+
+		eastl::map<int, int> m;
+		for(int i = 0; i < 100; ++i)
+			m[i * 2] = i;
+		EATEST_VERIFY((m.select(10)->first == 20) && (m.rank(21) == 11) && (eastl::distance(m.find(10), m.find(40)) == 15));
+	}
+	#endif
+
+
 
 	return nErrorCount;
 }
@@ -9,6 +9,7 @@
 #include <EASTL/type_traits.h>
 #include <EASTL/scoped_ptr.h>
 #include <EASTL/random.h>
+#include <EASTL/string_view.h>
 
 EA_DISABLE_ALL_VC_WARNINGS()
 #ifndef EA_COMPILER_NO_STANDARD_CPP_LIBRARY
@@ -934,7 +935,76 @@ int TestMultisetCpp11()
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// TestSetHeterogeneousLookup
+//
+// The set equivalent of TestMapHeterogeneousLookup. Tests the find, count,
+// equal_range, contains and erase overloads which take a key of a type other
+// than key_type, for a container of MallocAllocator strings with a transparent
+// comparison (and hash), and verifies that such lookups construct no temporaries.
+//
+template <typename T1, bool bMultiset>
+int TestSetHeterogeneousLookup()
+{
+	typedef typename T1::key_type   key_type;
+	typedef typename T1::iterator   iterator;
+
+	int nErrorCount = 0;
+	const typename T1::size_type nCount = bMultiset ? 2 : 1;
 
+	eastl::vector<key_type> keys;
+	for(char c = 'a'; c <= 'p'; c++)
+	{
+		keys.push_back(key_type("a key long enough to not fit in the string's local buffer: "));
+		keys.back().push_back(c);
+	}
+	const key_type missing("a key long enough to not fit in the string's local buffer: z");
 
+	T1 t1;
+	for(eastl_size_t i = 0; i < keys.size(); i++)
+	{
+		for(typename T1::size_type j = 0; j < nCount; j++)
+			t1.insert(keys[i]);
+	}
+	const T1& t1Const = t1;
 
+	const int nAllocCountSaved = MallocAllocator::mAllocCountAll;
 
+	for(eastl_size_t i = 0; i < keys.size(); i++)
+	{
+		const eastl::string_view sv(keys[i].data(), keys[i].size());
+		const char* const pKey = keys[i].c_str();
+
+		iterator it = t1.find(sv);
+		EATEST_VERIFY((it != t1.end()) && (*it == keys[i]));
+		EATEST_VERIFY(t1.find(pKey) == it);
+		EATEST_VERIFY(t1Const.find(sv) == it);
+		EATEST_VERIFY(t1.contains(sv) && t1.contains(pKey));
+		EATEST_VERIFY(t1.count(sv) == nCount);
+		EATEST_VERIFY(t1Const.count(pKey) == nCount);
+
+		const eastl::pair<iterator, iterator> range = t1.equal_range(sv);
+		EATEST_VERIFY((range.first == it) && ((typename T1::size_type)eastl::distance(range.first, range.second) == nCount));
+		EATEST_VERIFY(t1Const.equal_range(pKey).first == it);
+	}
+
+	const eastl::string_view svMissing(missing.data(), missing.size());
+	EATEST_VERIFY(t1.find(svMissing) == t1.end());
+	EATEST_VERIFY(!t1.contains(missing.c_str()));
+	EATEST_VERIFY(t1.count(svMissing) == 0);
+	EATEST_VERIFY(t1.equal_range(svMissing).first == t1.equal_range(svMissing).second);
+
+	EATEST_VERIFY(MallocAllocator::mAllocCountAll == nAllocCountSaved);
+
+	EATEST_VERIFY(t1.erase(svMissing) == 0);
+	EATEST_VERIFY(t1.erase(keys[0].c_str()) == nCount);
+	EATEST_VERIFY(t1.erase(eastl::string_view(keys[1].data(), keys[1].size())) == nCount);
+	EATEST_VERIFY(!t1.contains(keys[0].c_str()) && !t1.contains(keys[1].c_str()));
+	EATEST_VERIFY(t1.size() == (keys.size() - 2) * nCount);
+	EATEST_VERIFY(t1.validate());
+
+	t1.erase(t1.begin()); // Make sure that erase(iterator) is still chosen over erase(const U&).
+	EATEST_VERIFY(t1.size() == (keys.size() - 2) * nCount - 1);
+
+	return nErrorCount;
+}
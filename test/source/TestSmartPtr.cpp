@@ -25,6 +25,10 @@
 EA_DISABLE_ALL_VC_WARNINGS()
 #include <stdio.h>
 #include <string.h>
+#if EASTL_ATOMIC_SHARED_PTR_LOCK_FREE && defined(EA_HAVE_CPP11_THREAD)
+	#include <atomic>
+	#include <thread>
+#endif
 #ifdef EA_PLATFORM_WINDOWS
 	#ifndef WIN32_LEAN_AND_MEAN
 		#define WIN32_LEAN_AND_MEAN
@@ -396,6 +400,21 @@ namespace SmartPtrTest
 		int mX;
 	};
 
+	#if EASTL_ATOMIC_SHARED_PTR_LOCK_FREE
+		// Exposes the local reference counting of atomic_shared_ptr, so that an interleaving
+		// of concurrent loads and stores can be replayed step by step on one thread.
+		struct AtomicSharedPtrProbe : public eastl::atomic_shared_ptr<int>
+		{
+			typedef eastl::Internal::atomic_smart_ptr_base< eastl::shared_ptr<int> > probe_base_type;
+
+			using probe_base_type::AcquireLocalRef;
+			using probe_base_type::ReleaseLocalRef;
+			using probe_base_type::GetNode;
+			using probe_base_type::GetLocalCount;
+			using probe_base_type::mValue;
+		};
+	#endif
+
 } // namespace SmartPtrTest
 
 
@@ -1311,6 +1330,53 @@ static int Test_shared_ptr()
 			return nErrorCount;
 		}
 	};
+
+	// Readers repeatedly load the atomic_shared_ptr and check what they get, while incrementers
+	// replace its value with an incremented copy via compare_exchange, mnIncrementCount times.
+	struct AtomicSharedPtrTestThread : public EA::Thread::IRunnable
+	{
+		EA::Thread::ThreadParameters                   mThreadParams;
+		EA::Thread::Thread                             mThread;
+		volatile bool*                                 mpbShouldContinue;
+		int                                            mnErrorCount;
+		int                                            mnIncrementCount;
+		eastl::atomic_shared_ptr<const TestObject>*    mpASP;
+		eastl::atomic_weak_ptr<const TestObject>*      mpAWP;
+
+		AtomicSharedPtrTestThread() : mThreadParams(), mThread(), mpbShouldContinue(NULL), mnErrorCount(0), mnIncrementCount(0), mpASP(NULL), mpAWP(NULL) {}
+		AtomicSharedPtrTestThread(const AtomicSharedPtrTestThread&){}
+		void operator=(const AtomicSharedPtrTestThread&){}
+
+		intptr_t Run(void*)
+		{
+			int& nErrorCount = mnErrorCount; // declare nErrorCount so that EATEST_VERIFY can work, as it depends on it being declared.
+
+			if(mnIncrementCount)
+			{
+				for(int i = 0; i < mnIncrementCount; i++)
+				{
+					eastl::shared_ptr<const TestObject> expected = mpASP->load();
+
+					while(!mpASP->compare_exchange_weak(expected, eastl::make_shared<const TestObject>(expected->mX + 1)))
+						{ }
+				}
+			}
+			else
+			{
+				while(*mpbShouldContinue)
+				{
+					eastl::shared_ptr<const TestObject> spTO = mpASP->load();
+					EATEST_VERIFY(spTO && (spTO->mX >= 100));
+					EATEST_VERIFY(spTO.use_count() >= 1);
+
+					eastl::shared_ptr<const TestObject> spTO2 = mpAWP->load().lock();
+					EATEST_VERIFY(spTO2 && (spTO2->mX == 99));
+				}
+			}
+
+			return nErrorCount;
+		}
+	};
 #endif
 
 
@@ -1408,6 +1474,211 @@ static int Test_shared_ptr_thread()
 }
 
 
+static int Test_atomic_shared_ptr()
+{
+	using namespace SmartPtrTest;
+	using namespace eastl;
+	using namespace EA::Thread;
+
+	int nErrorCount(0);
+
+	{
+		atomic_shared_ptr<TestObject> aspTO;
+		EATEST_VERIFY(aspTO.is_lock_free() == (EASTL_ATOMIC_SHARED_PTR_LOCK_FREE != 0));
+		EATEST_VERIFY(!aspTO.load());
+
+		shared_ptr<TestObject> spTO(new TestObject(55));
+		aspTO.store(spTO);
+		EATEST_VERIFY(aspTO.load() == spTO);
+		EATEST_VERIFY(spTO.use_count() == 2);
+
+		shared_ptr<TestObject> spTO2 = aspTO;
+		EATEST_VERIFY(spTO2->mX == 55);
+		EATEST_VERIFY(spTO.use_count() == 3);
+		spTO2.reset();
+
+		spTO2 = aspTO.exchange(make_shared<TestObject>(77));
+		EATEST_VERIFY(spTO2 == spTO);
+		EATEST_VERIFY(spTO.use_count() == 2); // spTO and spTO2
+		EATEST_VERIFY(aspTO.load()->mX == 77);
+		spTO2.reset();
+
+		// compare_exchange fails if expected isn't what's stored, and then loads the stored value into expected.
+		shared_ptr<TestObject> expected(spTO);
+		EATEST_VERIFY(!aspTO.compare_exchange_strong(expected, make_shared<TestObject>(88)));
+		EATEST_VERIFY(expected->mX == 77);
+		EATEST_VERIFY(aspTO.load()->mX == 77);
+
+		EATEST_VERIFY(aspTO.compare_exchange_strong(expected, make_shared<TestObject>(88)));
+		EATEST_VERIFY(expected->mX == 77);
+		EATEST_VERIFY(aspTO.load()->mX == 88);
+
+		// A shared_ptr that aliases the stored one is not equivalent to it.
+		shared_ptr<TestObject> spStored = aspTO.load();
+		shared_ptr<TestObject> spAlias(spStored, spTO.get());
+		spStored.reset();
+		EATEST_VERIFY(!aspTO.compare_exchange_strong(spAlias, shared_ptr<TestObject>()));
+		EATEST_VERIFY(aspTO.compare_exchange_strong(spAlias, shared_ptr<TestObject>()));
+		EATEST_VERIFY(!aspTO.load());
+
+		// An empty value compares equal to an empty expected.
+		shared_ptr<TestObject> spEmpty;
+		EATEST_VERIFY(aspTO.compare_exchange_strong(spEmpty, spTO));
+		EATEST_VERIFY(aspTO.load() == spTO);
+
+		aspTO = shared_ptr<TestObject>();
+		EATEST_VERIFY(spTO.use_count() == 1);
+	}
+
+	{
+		shared_ptr<TestObject> spTO(new TestObject(99));
+		atomic_weak_ptr<TestObject> awpTO(spTO);
+
+		EATEST_VERIFY(awpTO.load().lock() == spTO);
+		EATEST_VERIFY(spTO.use_count() == 1);
+
+		weak_ptr<TestObject> expected;
+		EATEST_VERIFY(!awpTO.compare_exchange_strong(expected, weak_ptr<TestObject>()));
+		EATEST_VERIFY(expected.lock() == spTO);
+		EATEST_VERIFY(awpTO.compare_exchange_strong(expected, weak_ptr<TestObject>()));
+		EATEST_VERIFY(awpTO.load().expired());
+
+		awpTO = spTO;
+		spTO.reset();
+		EATEST_VERIFY(awpTO.load().expired());
+	}
+
+	#if EASTL_THREAD_SUPPORT_AVAILABLE
+		{
+			const int                                 kIncrementCount = 2000;
+			AtomicSharedPtrTestThread                 thread[6];
+			volatile bool                             bShouldContinue = true;
+			shared_ptr<const TestObject>              spTO(new TestObject(99));
+			atomic_shared_ptr<const TestObject>       aspTO(make_shared<const TestObject>(100));
+			atomic_weak_ptr<const TestObject>         awpTO(spTO);
+
+			for(size_t i = 0; i < EAArrayCount(thread); i++)
+			{
+				thread[i].mpbShouldContinue = &bShouldContinue;
+				thread[i].mnIncrementCount = (i < 2) ? kIncrementCount : 0;
+				thread[i].mpASP = &aspTO;
+				thread[i].mpAWP = &awpTO;
+				thread[i].mThreadParams.mpName = "AtomicSharedPtrTestThread";
+			}
+
+			for(size_t i = 0; i < EAArrayCount(thread); i++)
+				thread[i].mThread.Begin(&thread[i], NULL, &thread[i].mThreadParams);
+
+			for(size_t i = 0; i < 2; i++)
+				thread[i].mThread.WaitForEnd();
+
+			bShouldContinue = false;
+
+			for(size_t i = 0; i < EAArrayCount(thread); i++)
+			{
+				thread[i].mThread.WaitForEnd();
+				nErrorCount += thread[i].mnErrorCount;
+			}
+
+			// Every increment must have been applied exactly once, and nothing but aspTO may own the final value.
+			shared_ptr<const TestObject> spFinal = aspTO.load();
+			EATEST_VERIFY(spFinal->mX == 100 + (2 * kIncrementCount));
+			EATEST_VERIFY(spFinal.use_count() == 2);
+		}
+	#endif
+
+	#if EASTL_ATOMIC_SHARED_PTR_LOCK_FREE
+		{
+			// A load which pins a null slot, while other threads store a value and then null again,
+			// must not take the local count of the null slot below zero when it releases its pin.
+			AtomicSharedPtrProbe asp;
+
+			const uintptr_t value = asp.AcquireLocalRef();  // The load pins the null slot...
+			asp.store(make_shared<int>(1));                  // ...another thread stores a value, which drops the pin...
+			asp.store(shared_ptr<int>());                    // ...and then null again...
+			asp.ReleaseLocalRef(asp.GetNode(value));         // ...before the load releases its pin.
+			EATEST_VERIFY(asp.GetLocalCount(asp.mValue.load()) == 0);
+			EATEST_VERIFY(!asp.load() && (asp.GetLocalCount(asp.mValue.load()) == 0));
+
+			asp.store(make_shared<int>(2));
+			EATEST_VERIFY((*asp.load() == 2) && (asp.GetLocalCount(asp.mValue.load()) == 0));
+		}
+	#endif
+
+	#if EASTL_ATOMIC_SHARED_PTR_LOCK_FREE && defined(EA_HAVE_CPP11_THREAD)
+		{
+			// The same contention on std::thread, so that the lock-free implementation is exercised where
+			// EAThread isn't available. The values are ints, as TestObject's counters aren't thread-safe.
+			// Besides loading, the readers run compare_exchanges which fail, racing with those that succeed.
+			const int                   kIncrementCount = 2000;
+			std::thread                 thread[6];
+			std::atomic<bool>           bShouldContinue(true);
+			std::atomic<int>            nThreadErrorCount(0);
+			shared_ptr<const int>       spInt(new int(-1));
+			atomic_shared_ptr<const int> aspInt(make_shared<const int>(0));
+			atomic_weak_ptr<const int>  awpInt(spInt);
+
+			for(size_t i = 0; i < EAArrayCount(thread); i++)
+			{
+				thread[i] = std::thread([&, i]()
+				{
+					if(i < 2)
+					{
+						for(int j = 0; j < kIncrementCount; j++)
+						{
+							shared_ptr<const int> expected = aspInt.load();
+
+							while(!aspInt.compare_exchange_weak(expected, make_shared<const int>(*expected + 1)))
+								{ }
+						}
+					}
+					else
+					{
+						int nLast = 0;
+
+						do
+						{
+							shared_ptr<const int> sp = aspInt.load();
+							if(!sp || (*sp < nLast)) // The value only ever increases.
+								nThreadErrorCount++;
+							else
+								nLast = *sp;
+
+							shared_ptr<const int> expected(new int(nLast));
+							if(aspInt.compare_exchange_strong(expected, shared_ptr<const int>()) || !expected || (*expected < nLast))
+								nThreadErrorCount++;
+
+							shared_ptr<const int> spLocked = awpInt.load().lock();
+							if(!spLocked || (*spLocked != -1))
+								nThreadErrorCount++;
+						} while(bShouldContinue.load());
+					}
+				});
+			}
+
+			for(size_t i = 0; i < 2; i++)
+				thread[i].join();
+
+			bShouldContinue = false;
+
+			for(size_t i = 2; i < EAArrayCount(thread); i++)
+				thread[i].join();
+
+			EATEST_VERIFY(nThreadErrorCount.load() == 0);
+
+			shared_ptr<const int> spFinal = aspInt.load();
+			EATEST_VERIFY(*spFinal == (2 * kIncrementCount));
+			EATEST_VERIFY(spFinal.use_count() == 2);
+		}
+	#endif
+
+	EATEST_VERIFY(TestObject::IsClear());
+	TestObject::Reset();
+
+	return nErrorCount;
+}
+
+
 static int Test_weak_ptr()
 {
 	using namespace SmartPtrTest;
@@ -2070,6 +2341,7 @@ int TestSmartPtr()
 	nErrorCount += Test_scoped_array();
 	nErrorCount += Test_shared_ptr();
 	nErrorCount += Test_shared_ptr_thread();
+	nErrorCount += Test_atomic_shared_ptr();
 	nErrorCount += Test_weak_ptr();
 	nErrorCount += Test_shared_array();
 	nErrorCount += Test_linked_ptr();
@@ -176,6 +176,100 @@ namespace eastl
 				return x;
 			}
 		};
+
+		// Used to verify the results and the stability of the parallel sorts.
+		struct ParallelSortElement
+		{
+			typedef uint32_t radix_type;
+			uint32_t mKey;
+			uint32_t mIndex;
+		};
+
+		struct ParallelSortElementKeyCompare
+		{
+			bool operator()(const ParallelSortElement& a, const ParallelSortElement& b) const
+				{ return a.mKey < b.mKey; }
+		};
+
+		struct ParallelSortElementCompare
+		{
+			bool operator()(const ParallelSortElement& a, const ParallelSortElement& b) const
+				{ return (a.mKey < b.mKey) || ((a.mKey == b.mKey) && (a.mIndex < b.mIndex)); }
+		};
+
+		// Fills the array with one of several key distributions, with mIndex set to the element's original position.
+		inline void FillParallelSortArray(vector<ParallelSortElement>& array, int distribution, EASTLTest_Rand& rng)
+		{
+			for(uint32_t i = 0; i < (uint32_t)array.size(); i++)
+			{
+				switch(distribution)
+				{
+					case 0:  array[i].mKey = rng.Rand();                           break; // Random
+					case 1:  array[i].mKey = rng.RandLimit(4);                     break; // Few distinct values
+					case 2:  array[i].mKey = i;                                    break; // Sorted
+					case 3:  array[i].mKey = (uint32_t)array.size() - i;           break; // Reverse sorted
+					default: array[i].mKey = 7;                                    break; // All equal
+				}
+				array[i].mIndex = i;
+			}
+		}
+
+		// Counts the compares done by a sort.
+		struct CountingCompare
+		{
+			eastl_size_t* mpCount;
+
+			CountingCompare(eastl_size_t* pCount) : mpCount(pCount) { }
+
+			bool operator()(int a, int b) const
+				{ ++*mpCount; return a < b; }
+		};
+
+		// Fills the array with one of the patterns that quick sorts are typically weak against.
+		inline void FillQuickSortArray(vector<int>& array, int pattern, EASTLTest_Rand& rng)
+		{
+			const int n = (int)array.size();
+
+			for(int i = 0; i < n; i++)
+			{
+				switch(pattern)
+				{
+					case 0:  array[i] = (int)rng.Rand();                          break; // Random
+					case 1:  array[i] = (int)rng.RandLimit(8);                    break; // Few distinct values
+					case 2:  array[i] = i;                                        break; // Sorted
+					case 3:  array[i] = n - i;                                    break; // Reverse sorted
+					case 4:  array[i] = (i < (n / 2)) ? i : (n - i);              break; // Organ pipe
+					case 5:  array[i] = i % 32;                                   break; // Sawtooth
+					case 6:  array[i] = (i < (n - 8)) ? i : (int)rng.RandLimit((uint32_t)n + 1); break; // Sorted with a random tail
+					case 7:  array[i] = (i & 1) ? (n / 2) + i : i;                break; // Interleaved ascending runs
+					default: array[i] = 7;                                        break; // All equal
+				}
+			}
+		}
+
+		// Checks that run calls the task function exactly once for each index, including from within nested calls.
+		struct TaskSchedulerTestContext
+		{
+			task_scheduler*  mpScheduler;
+			vector<int>*     mpCounts;
+			size_t           mnNestedCount;
+		};
+
+		inline void TaskSchedulerTestNested(void* pContext, size_t index)
+		{
+			TaskSchedulerTestContext* pTestContext = (TaskSchedulerTestContext*)pContext;
+			++(*pTestContext->mpCounts)[index];
+		}
+
+		inline void TaskSchedulerTestOuter(void* pContext, size_t index)
+		{
+			TaskSchedulerTestContext* pTestContext = (TaskSchedulerTestContext*)pContext;
+			vector<int>               counts(pTestContext->mnNestedCount, 0);
+			TaskSchedulerTestContext  nestedContext = { pTestContext->mpScheduler, &counts, 0 };
+
+			pTestContext->mpScheduler->run(&TaskSchedulerTestNested, &nestedContext, counts.size());
+			(*pTestContext->mpCounts)[index] = (eastl::count(counts.begin(), counts.end(), 1) == (ptrdiff_t)counts.size()) ? 1 : -1;
+		}
 	} // namespace Internal
 
 } // namespace eastl
@@ -822,6 +916,63 @@ int TestSort()
 	}
 
 
+	{
+		// Test quick_sort on patterned input, for sizes around its insertion sort and ninther limits, with both
+		// the default compare (which uses block partitioning for arithmetic types) and a user compare.
+		const eastl_size_t kSizes[] = { 0, 1, 2, 3, 23, 24, 25, 127, 128, 129, 200, 1000, 10000 };
+
+		for(eastl_size_t s = 0; s < EAArrayCount(kSizes); s++)
+		{
+			for(int pattern = 0; pattern < 9; pattern++)
+			{
+				vector<int> intArraySaved(kSizes[s]);
+				FillQuickSortArray(intArraySaved, pattern, rng);
+
+				vector<int> intArrayExpected(intArraySaved);
+				heap_sort(intArrayExpected.begin(), intArrayExpected.end());
+
+				vector<int> intArray(intArraySaved);
+				quick_sort(intArray.begin(), intArray.end());
+				EATEST_VERIFY(intArray == intArrayExpected);
+
+				intArray = intArraySaved;
+				quick_sort(intArray.begin(), intArray.end(), greater<int>());
+				EATEST_VERIFY(eastl::equal(intArray.begin(), intArray.end(), intArrayExpected.rbegin()));
+
+				eastl_size_t nCompareCount = 0;
+				intArray = intArraySaved;
+				quick_sort(intArray.begin(), intArray.end(), CountingCompare(&nCompareCount));
+				EATEST_VERIFY(intArray == intArrayExpected);
+
+				#if !EASTL_QUICK_SORT_LEGACY
+					// Sorted and reverse sorted input are detected with a single pass.
+					if((pattern == 2) || (pattern == 3) || (pattern == 8))
+						EATEST_VERIFY(nCompareCount < eastl::max_alt(intArray.size(), (eastl_size_t)1));
+				#endif
+
+				deque<int> intDeque(intArraySaved.begin(), intArraySaved.end());
+				quick_sort(intDeque.begin(), intDeque.end());
+				EATEST_VERIFY(eastl::equal(intDeque.begin(), intDeque.end(), intArrayExpected.begin()));
+			}
+		}
+
+		// Input built to give median-of-three pivot selection its worst case still sorts in n log n compares.
+		const int   kKillerSize = 10000;
+		vector<int> intArray(kKillerSize);
+
+		for(int i = 0; i < kKillerSize / 2; i++)
+		{
+			intArray[i] = (i & 1) ? (kKillerSize / 2) + i : i + 1;
+			intArray[(kKillerSize / 2) + i] = 2 * (i + 1);
+		}
+
+		eastl_size_t nCompareCount = 0;
+		quick_sort(intArray.begin(), intArray.end(), CountingCompare(&nCompareCount));
+		EATEST_VERIFY(is_sorted(intArray.begin(), intArray.end()));
+		EATEST_VERIFY(nCompareCount < (eastl_size_t)(4 * kKillerSize * 14)); // 14 ~= log2(10000)
+	}
+
+
 	#if 0 // Disabled because it takes a long time and thus far seems to show no bug in quick_sort.
 	{
 		// Regression of Coverity report for Madden 2014 that quick_sort is reading beyond an array bounds within insertion_sort_simple.
@@ -841,6 +992,118 @@ int TestSort()
 	}
 	#endif
 
+	{
+		// task_scheduler overloads of sort, stable_sort, radix_sort, nth_element and partial_sort.
+		// The results must match those of the serial functions, and stable_sort and radix_sort must be stable.
+
+		#if EASTL_DEFAULT_TASK_SCHEDULER_ENABLED
+			default_task_scheduler threadedScheduler(3);
+		#endif
+		serial_task_scheduler serialScheduler;
+
+		task_scheduler* schedulers[] =
+		{
+			#if EASTL_DEFAULT_TASK_SCHEDULER_ENABLED
+				&threadedScheduler,
+			#endif
+			&serialScheduler
+		};
+
+		for(eastl_size_t s = 0; s < EAArrayCount(schedulers); s++)
+		{
+			task_scheduler& scheduler = *schedulers[s];
+
+			{
+				// run
+				vector<int>              counts(1000, 0);
+				TaskSchedulerTestContext context = { &scheduler, &counts, 100 };
+
+				scheduler.run(&TaskSchedulerTestOuter, &context, counts.size());
+				EATEST_VERIFY(eastl::count(counts.begin(), counts.end(), 1) == (ptrdiff_t)counts.size());
+			}
+
+			const eastl_size_t kSizes[] = { 0, 1, 1000, EASTL_PARALLEL_SORT_MIN_SIZE + 1, 200000 };
+
+			for(eastl_size_t k = 0; k < EAArrayCount(kSizes); k++)
+			{
+				for(int distribution = 0; distribution < 5; distribution++)
+				{
+					vector<ParallelSortElement> array(kSizes[k]);
+					vector<ParallelSortElement> buffer(kSizes[k]);
+					FillParallelSortArray(array, distribution, rng);
+
+					vector<ParallelSortElement> arraySorted(array);
+					eastl::sort(arraySorted.begin(), arraySorted.end(), ParallelSortElementCompare()); // Unique keys, so this is also the stable order.
+
+					{
+						vector<ParallelSortElement> a(array);
+						eastl::sort(scheduler, a.begin(), a.end(), ParallelSortElementKeyCompare());
+						EATEST_VERIFY(is_sorted(a.begin(), a.end(), ParallelSortElementKeyCompare()));
+						eastl::sort(a.begin(), a.end(), ParallelSortElementCompare());
+						EATEST_VERIFY(eastl::equal(a.begin(), a.end(), arraySorted.begin(), [](const ParallelSortElement& x, const ParallelSortElement& y) { return x.mIndex == y.mIndex; }));
+					}
+
+					{
+						vector<ParallelSortElement> a(array);
+						eastl::stable_sort(scheduler, a.begin(), a.end(), buffer.data(), ParallelSortElementKeyCompare());
+						EATEST_VERIFY(eastl::equal(a.begin(), a.end(), arraySorted.begin(), [](const ParallelSortElement& x, const ParallelSortElement& y) { return x.mIndex == y.mIndex; }));
+					}
+
+					{
+						vector<ParallelSortElement> a(array);
+						eastl::radix_sort<ParallelSortElement*, extract_radix_key<ParallelSortElement> >(scheduler, a.begin(), a.end(), buffer.begin());
+						EATEST_VERIFY(eastl::equal(a.begin(), a.end(), arraySorted.begin(), [](const ParallelSortElement& x, const ParallelSortElement& y) { return x.mIndex == y.mIndex; }));
+					}
+
+					if(!array.empty())
+					{
+						const eastl_size_t nth = (eastl_size_t)rng.RandLimit((uint32_t)array.size());
+
+						vector<ParallelSortElement> a(array);
+						eastl::nth_element(scheduler, a.begin(), a.begin() + nth, a.end(), ParallelSortElementCompare());
+						EATEST_VERIFY(a[nth].mIndex == arraySorted[nth].mIndex);
+						EATEST_VERIFY(eastl::find_if(a.begin(), a.begin() + nth, [&](const ParallelSortElement& x) { return ParallelSortElementCompare()(a[nth], x); }) == a.begin() + nth);
+						EATEST_VERIFY(eastl::find_if(a.begin() + nth, a.end(), [&](const ParallelSortElement& x) { return ParallelSortElementCompare()(x, a[nth]); }) == a.end());
+
+						a = array;
+						eastl::partial_sort(scheduler, a.begin(), a.begin() + nth, a.end(), ParallelSortElementCompare());
+						EATEST_VERIFY(eastl::equal(a.begin(), a.begin() + nth, arraySorted.begin(), [](const ParallelSortElement& x, const ParallelSortElement& y) { return x.mIndex == y.mIndex; }));
+					}
+				}
+			}
+
+			{
+				// Default comparison versions.
+				vector<int> intArray(100000);
+				for(eastl_size_t i = 0; i < intArray.size(); i++)
+					intArray[i] = (int)rng.RandLimit(50000);
+				vector<int> intArraySorted(intArray);
+				eastl::sort(intArraySorted.begin(), intArraySorted.end());
+				vector<int> intBuffer(intArray.size());
+
+				vector<int> a(intArray);
+				eastl::sort(scheduler, a.begin(), a.end());
+				EATEST_VERIFY(a == intArraySorted);
+
+				a = intArray;
+				eastl::stable_sort(scheduler, a.begin(), a.end(), intBuffer.data());
+				EATEST_VERIFY(a == intArraySorted);
+
+				a = intArray;
+				eastl::nth_element(scheduler, a.begin(), a.begin() + 500, a.end());
+				EATEST_VERIFY(a[500] == intArraySorted[500]);
+
+				a = intArray;
+				eastl::partial_sort(scheduler, a.begin(), a.begin() + 500, a.end());
+				EATEST_VERIFY(eastl::equal(a.begin(), a.begin() + 500, intArraySorted.begin()));
+			}
+		}
+
+		task_scheduler* pPrevScheduler = SetDefaultTaskScheduler(&serialScheduler);
+		EATEST_VERIFY(&GetDefaultTaskScheduler() == &serialScheduler);
+		SetDefaultTaskScheduler(pPrevScheduler);
+	}
+
 	EATEST_VERIFY(TestObject::IsClear());
 	TestObject::Reset();
 
@@ -1739,6 +1739,78 @@ int TEST_STRING_NAME()
 		VERIFY(str.find_last_not_of(LITERAL('a')) == 28);
 	}
 
+	// Searches over strings long enough to use the vectorized search kernels, with the
+	// match at every position so that the vector tails are covered.
+	{
+		typedef typename StringType::size_type SizeType;
+		const SizeType kLength = 100;
+
+		for(SizeType i = 0; i < kLength; ++i)
+		{
+			StringType str(kLength, LITERAL('a'));
+			str[i] = LITERAL('b');
+
+			VERIFY(str.find(LITERAL('b')) == i);
+			VERIFY(str.find(LITERAL('b'), i + 1) == StringType::npos);
+			VERIFY(str.rfind(LITERAL('b')) == i);
+			VERIFY(str.find(LITERAL("ab")) == (i ? (i - 1) : StringType::npos));
+			VERIFY(str.rfind(LITERAL("ab")) == (i ? (i - 1) : StringType::npos));
+			VERIFY(str.find(LITERAL("aab")) == ((i > 1) ? (i - 2) : StringType::npos));
+			VERIFY(str.find_first_of(LITERAL("xyzb")) == i);
+			VERIFY(str.find_last_of(LITERAL("xyzb")) == i);
+			VERIFY(str.find_first_of(LITERAL("bcdefghijk")) == i);
+			VERIFY(str.find_last_of(LITERAL("bcdefghijk")) == i);
+			VERIFY(str.find_first_not_of(LITERAL('a')) == i);
+			VERIFY(str.find_last_not_of(LITERAL('a')) == i);
+			VERIFY(str.find_first_not_of(LITERAL("acdef")) == i);
+			VERIFY(str.find_last_not_of(LITERAL("acdef")) == i);
+
+			StringType str2(str);
+			str2[i] = LITERAL('c');
+			VERIFY(str.compare(str2) < 0);
+			VERIFY(str2.compare(str) > 0);
+		}
+	}
+
+	// Substring searches whose first and last characters match everywhere, which
+	// must fall back to a linear time algorithm.
+	{
+		StringType str(4096, LITERAL('a'));
+		StringType pattern(64, LITERAL('a'));
+		pattern[32] = LITERAL('b');
+
+		VERIFY(str.find(pattern) == StringType::npos);
+		VERIFY(str.rfind(pattern) == StringType::npos);
+
+		str[4000] = LITERAL('b');
+		VERIFY(str.find(pattern) == 3968);
+		VERIFY(str.rfind(pattern) == 3968);
+
+		str[100] = LITERAL('b');
+		VERIFY(str.find(pattern) == 68);
+		VERIFY(str.rfind(pattern) == 3968);
+		VERIFY(str.find(pattern, 69) == 3968);
+		VERIFY(str.rfind(pattern, 3967) == 68);
+	}
+
+	// Character sets with characters beyond the range of the set bitmap.
+	{
+		typedef typename StringType::value_type CharType;
+
+		if(sizeof(CharType) > 1)
+		{
+			StringType str(40, LITERAL('a'));
+			str[30] = (CharType)0x1234;
+
+			const CharType set[] = { LITERAL('x'), LITERAL('y'), LITERAL('z'), (CharType)0x1134, (CharType)0x0834, (CharType)0x1234 };
+
+			VERIFY(str.find_first_of(set, 0, 5) == StringType::npos);
+			VERIFY(str.find_first_of(set, 0, 6) == 30);
+			VERIFY(str.find_last_of(set, StringType::npos, 6) == 30);
+			VERIFY(str.find_first_not_of(StringType(LITERAL("abcde"))) == 30);
+		}
+	}
+
 	// this_type substr(size_type position = 0, size_type n = npos) const;
 	{
 		StringType str(LITERAL("abcdefghijklmnopqrstuvwxyz"));
@@ -6,6 +6,7 @@
 #include <EABase/eabase.h>
 #include <EASTL/numeric_limits.h>
 #include <EASTL/string_view.h>
+#include <EASTL/string.h>
 
 
 // this mess is required inorder to inject string literal string conversion macros into the unit tests
@@ -85,6 +86,19 @@ int TestStringView()
 		VERIFY(sw.size() == wcslen(pStr));
 	}
 
+	// comparisons with types that are implicitly convertible to string_view
+	{
+		const string_view sv("abc");
+		const string      s("abd");
+		const char*       p = "abc";
+
+		VERIFY(sv == p && p == sv && !(sv != p));
+		VERIFY(sv != s && s != sv && !(sv == s));
+		VERIFY(sv < s && s > sv && sv <= s && s >= sv);
+		VERIFY(!(s < sv) && !(sv > s));
+		VERIFY(sv <= p && p >= sv && !(sv < p) && !(p > sv));
+	}
+
 
 	return nErrorCount;
 }
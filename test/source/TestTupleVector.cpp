@@ -0,0 +1,285 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+
+#include "EASTLTest.h"
+#include <EASTL/bonus/tuple_vector.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/numeric.h>
+#include <EASTL/sort.h>
+#include <EASTL/vector.h>
+
+using namespace eastl;
+
+
+// Template instantations.
+// These tell the compiler to compile all the functions for the given class.
+template class eastl::tuple_vector_alloc<EASTLAllocatorType, int>;
+template class eastl::tuple_vector_alloc<EASTLAllocatorType, int, float, bool>;
+template class eastl::tuple_vector_alloc<EASTLAllocatorType, bool, TestObject, double>;
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+
+// Verifies that each column of tv holds the values of the corresponding member of v.
+static bool TupleVectorMatches(const tuple_vector<int, TestObject, bool>& tv, const vector<tuple<int, TestObject, bool> >& v)
+{
+	if(tv.size() != v.size())
+		return false;
+
+	for(eastl_size_t i = 0; i < v.size(); ++i)
+	{
+		if(!(tv.get<0>()[(ptrdiff_t)i] == get<0>(v[i])) || !(tv.get<1>()[(ptrdiff_t)i] == get<1>(v[i])) || !(tv.get<2>()[(ptrdiff_t)i] == get<2>(v[i])))
+			return false;
+	}
+
+	return true;
+}
+
+
+int TestTupleVector()
+{
+	int nErrorCount = 0;
+
+	TestObject::Reset();
+
+	{   // Layout: each column is its own aligned array.
+		tuple_vector<bool, double, char, int> tv;
+
+		EATEST_VERIFY(tv.empty());
+		EATEST_VERIFY(tv.validate());
+
+		for(int i = 0; i < 37; ++i)
+			tv.push_back((i & 1) != 0, (double)i, (char)i, i * 2);
+
+		EATEST_VERIFY(tv.size() == 37);
+		EATEST_VERIFY(tv.capacity() >= 37);
+		EATEST_VERIFY(tv.validate());
+		EATEST_VERIFY(((uintptr_t)tv.get<1>().data() % EASTL_ALIGN_OF(double)) == 0);
+		EATEST_VERIFY(((uintptr_t)tv.get<3>().data() % EASTL_ALIGN_OF(int)) == 0);
+		EATEST_VERIFY((void*)tv.get<double>().data() == (void*)tv.get<1>().data());
+		EATEST_VERIFY((eastl_size_t)tv.get<int>().size() == tv.size());
+
+		// Each column is contiguous, and the columns don't overlap.
+		EATEST_VERIFY((char*)tv.get<1>().data() >= (char*)(tv.get<0>().data() + tv.capacity()));
+		EATEST_VERIFY((char*)tv.get<2>().data() >= (char*)(tv.get<1>().data() + tv.capacity()));
+		EATEST_VERIFY((char*)tv.get<3>().data() >= (char*)(tv.get<2>().data() + tv.capacity()));
+
+		EATEST_VERIFY(eastl::accumulate(tv.get<3>().begin(), tv.get<3>().end(), 0) == 36 * 37);
+
+		for(int i = 0; i < 37; ++i)
+		{
+			EATEST_VERIFY(get<0>(tv[(eastl_size_t)i]) == ((i & 1) != 0));
+			EATEST_VERIFY(get<1>(tv[(eastl_size_t)i]) == (double)i);
+			EATEST_VERIFY(get<2>(tv[(eastl_size_t)i]) == (char)i);
+			EATEST_VERIFY(get<3>(tv[(eastl_size_t)i]) == i * 2);
+		}
+
+		// References write through to the columns.
+		get<3>(tv.front()) = -1;
+		get<3>(tv.back())  = -2;
+		EATEST_VERIFY(tv.get<3>()[0] == -1);
+		EATEST_VERIFY(tv.get<3>()[36] == -2);
+
+		tv.shrink_to_fit();
+		EATEST_VERIFY(tv.capacity() == 37);
+		EATEST_VERIFY(tv.get<3>()[36] == -2);
+	}
+
+	{   // push_back, emplace_back, pop_back, reserve, resize, clear
+		tuple_vector<int, float> tv;
+
+		tv.reserve(10);
+		EATEST_VERIFY(tv.capacity() == 10);
+		EATEST_VERIFY(tv.empty());
+
+		tv.push_back(1, 1.f);
+		tv.push_back(make_tuple(2, 2.f));
+		tuple<int&, float&> r = tv.emplace_back(3, 3.f);
+		get<0>(r) = 4;
+		tuple<int&, float&> d = tv.push_back(); // Value-initialized.
+		EATEST_VERIFY((get<0>(d) == 0) && (get<1>(d) == 0.f));
+
+		EATEST_VERIFY(tv.size() == 4);
+		EATEST_VERIFY(tv.get<0>()[2] == 4);
+		EATEST_VERIFY(tv[1] == make_tuple(2, 2.f));
+
+		tv.pop_back();
+		EATEST_VERIFY(tv.size() == 3);
+		EATEST_VERIFY(tv.back() == make_tuple(4, 3.f));
+
+		tv.resize(6, 7, 7.f);
+		EATEST_VERIFY(tv.size() == 6);
+		EATEST_VERIFY(tv[5] == make_tuple(7, 7.f));
+
+		tv.resize(12);
+		EATEST_VERIFY(tv.size() == 12);
+		EATEST_VERIFY(tv[11] == make_tuple(0, 0.f));
+
+		tv.resize(2);
+		EATEST_VERIFY(tv.size() == 2);
+		EATEST_VERIFY(tv.validate());
+
+		// push_back of one of our own elements while reallocating.
+		tv.shrink_to_fit();
+		tv.push_back(get<0>(tv[0]), get<1>(tv[0]));
+		tv.push_back(tv[1]);
+		EATEST_VERIFY(tv.size() == 4);
+		EATEST_VERIFY(tv[2] == make_tuple(1, 1.f));
+		EATEST_VERIFY(tv[3] == make_tuple(2, 2.f));
+
+		tv.clear();
+		EATEST_VERIFY(tv.empty());
+		EATEST_VERIFY(tv.capacity() >= 4);
+	}
+
+	{   // insert, erase and erase_unsorted match vector. TestObject verifies that nothing leaks.
+		EA::UnitTest::Rand                  rng(EA::UnitTest::GetRandSeed());
+		tuple_vector<int, TestObject, bool> tv;
+		vector<tuple<int, TestObject, bool> > v;
+
+		for(int i = 0; i < 1000; ++i)
+		{
+			const int                                 value = (int)rng.RandLimit(1000);
+			const eastl_size_t                        pos   = rng.RandLimit((uint32_t)tv.size() + 1);
+			const tuple<int, TestObject, bool>        t(value, TestObject(value), (value & 1) != 0);
+
+			switch(rng.RandLimit(6))
+			{
+				case 0:
+				case 1:
+					tv.push_back(get<0>(t), get<1>(t), get<2>(t));
+					v.push_back(t);
+					break;
+
+				case 2:
+					tv.insert(tv.begin() + (ptrdiff_t)pos, get<0>(t), get<1>(t), get<2>(t));
+					v.insert(v.begin() + pos, t);
+					break;
+
+				case 3:
+				{
+					const eastl_size_t n = rng.RandLimit(8);
+					tv.insert(tv.begin() + (ptrdiff_t)pos, n, get<0>(t), get<1>(t), get<2>(t));
+					v.insert(v.begin() + pos, n, t);
+					break;
+				}
+
+				case 4:
+					if(pos < tv.size())
+					{
+						const eastl_size_t last = pos + rng.RandLimit((uint32_t)(tv.size() - pos) + 1);
+						tv.erase(tv.begin() + (ptrdiff_t)pos, tv.begin() + (ptrdiff_t)last);
+						v.erase(v.begin() + pos, v.begin() + last);
+					}
+					break;
+
+				case 5:
+					if(pos < tv.size())
+					{
+						tv.erase_unsorted(tv.begin() + (ptrdiff_t)pos);
+						v.erase_unsorted(v.begin() + pos);
+					}
+					break;
+			}
+
+			EATEST_VERIFY(tv.validate());
+		}
+
+		EATEST_VERIFY(TupleVectorMatches(tv, v));
+
+		// insert of one of our own elements without reallocating.
+		if(!tv.empty())
+		{
+			tv.reserve(tv.size() + 4);
+			v.reserve(v.size() + 4);
+
+			tv.insert(tv.begin(), 3, get<0>(tv.back()), get<1>(tv.back()), get<2>(tv.back()));
+			v.insert(v.begin(), 3, tuple<int, TestObject, bool>(v.back()));
+			EATEST_VERIFY(TupleVectorMatches(tv, v));
+		}
+
+		// Copy, move, swap and comparison.
+		tuple_vector<int, TestObject, bool> tvCopy(tv);
+		EATEST_VERIFY(tvCopy == tv);
+		EATEST_VERIFY(TupleVectorMatches(tvCopy, v));
+
+		tuple_vector<int, TestObject, bool> tvMoved(eastl::move(tvCopy));
+		EATEST_VERIFY(tvCopy.empty());
+		EATEST_VERIFY(tvMoved == tv);
+
+		tvCopy = tvMoved;
+		EATEST_VERIFY(tvCopy == tv);
+		tvCopy.push_back(1, TestObject(1), true);
+		EATEST_VERIFY(tvCopy != tv);
+
+		tvMoved.clear();
+		swap(tvMoved, tvCopy);
+		EATEST_VERIFY(tvCopy.empty());
+		EATEST_VERIFY(tvMoved.size() == tv.size() + 1);
+
+		tvCopy = eastl::move(tvMoved);
+		EATEST_VERIFY(tvMoved.empty());
+		EATEST_VERIFY(tvCopy.size() == tv.size() + 1);
+	}
+
+	EATEST_VERIFY(TestObject::IsClear());
+	TestObject::Reset();
+
+	{   // Iterators and algorithms.
+		EA::UnitTest::Rand      rng(EA::UnitTest::GetRandSeed());
+		tuple_vector<int, int>  tv;
+
+		for(int i = 0; i < 500; ++i)
+		{
+			const int key = (int)rng.RandLimit(100);
+			tv.push_back(key, i);
+		}
+
+		EATEST_VERIFY(tv.end() - tv.begin() == 500);
+		EATEST_VERIFY(eastl::distance(tv.cbegin(), tv.cend()) == 500);
+		EATEST_VERIFY(eastl::distance(tv.rbegin(), tv.rend()) == 500);
+		EATEST_VERIFY(*tv.rbegin() == tv.back());
+		EATEST_VERIFY(tv.validate_iterator(tv.begin()) == (isf_valid | isf_current | isf_can_dereference));
+		EATEST_VERIFY(tv.validate_iterator(tv.end()) == (isf_valid | isf_current));
+
+		tuple_vector<int, int>::const_iterator itC = tv.begin();
+		EATEST_VERIFY(itC == tv.begin());
+		EATEST_VERIFY((itC + 3)[2] == tv[5]);
+		EATEST_VERIFY((3 + itC) - itC == 3);
+
+		// stable_sort on the first column keeps the second in order within equal keys.
+		eastl::stable_sort(tv.begin(), tv.end(), [](const tuple<const int&, const int&>& a, const tuple<const int&, const int&>& b) { return get<0>(a) < get<0>(b); });
+		EATEST_VERIFY(eastl::is_sorted(tv.begin(), tv.end()));
+
+		// sort by the second column, which restores the original order.
+		eastl::sort(tv.begin(), tv.end(), [](const tuple<const int&, const int&>& a, const tuple<const int&, const int&>& b) { return get<1>(a) < get<1>(b); });
+		for(int i = 0; i < 500; ++i)
+			EATEST_VERIFY(tv.get<1>()[i] == i);
+
+		// sort with tuple's operator<.
+		eastl::sort(tv.begin(), tv.end());
+		EATEST_VERIFY(eastl::is_sorted(tv.begin(), tv.end()));
+		EATEST_VERIFY(eastl::is_sorted(tv.get<0>().begin(), tv.get<0>().end()));
+
+		eastl::reverse(tv.begin(), tv.end());
+		EATEST_VERIFY(eastl::is_sorted(tv.rbegin(), tv.rend()));
+
+		tuple_vector<int, int>::iterator it = eastl::find_if(tv.begin(), tv.end(), [](const tuple<int&, int&>& t) { return get<1>(t) == 250; });
+		EATEST_VERIFY((it != tv.end()) && (get<1>(*it) == 250));
+
+		for(tuple<int&, int&> t : tv)
+			get<0>(t) = 7;
+		EATEST_VERIFY(eastl::count(tv.get<0>().begin(), tv.get<0>().end(), 7) == 500);
+	}
+
+	{   // initializer_list
+		tuple_vector<int, bool> tv = { make_tuple(1, true), make_tuple(2, false) };
+		EATEST_VERIFY(tv.size() == 2);
+		EATEST_VERIFY(tv[1] == make_tuple(2, false));
+	}
+
+	return nErrorCount;
+}
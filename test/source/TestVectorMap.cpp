@@ -13,6 +13,8 @@
 #include <EASTL/fixed_string.h>
 #include <EASTL/fixed_vector.h>
 #include <EASTL/utility.h>
+#include <EASTL/map.h>
+#include <EASTL/sort.h>
 
 EA_DISABLE_ALL_VC_WARNINGS()
 #ifndef EA_COMPILER_NO_STANDARD_CPP_LIBRARY
@@ -55,6 +57,48 @@ typedef eastl::vector_multimap<TestObject, TestObject, eastl::less<TestObject>,
 ///////////////////////////////////////////////////////////////////////////////
 
 
+// Inserts random batches, some of them sorted beforehand, and verifies that the
+// result matches that of inserting the values one at a time into map or multimap,
+// including which of equivalent values is kept and the order of equivalent values.
+template <typename VectorMap, typename RBTreeMap>
+static int TestVectorMapRangeInsert(EA::UnitTest::Rand& rng, int nKeyRange)
+{
+	int nErrorCount = 0;
+
+	VectorMap vm;
+	RBTreeMap rb;
+
+	for(int nBatch = 0; nBatch < 30; ++nBatch)
+	{
+		eastl::vector<eastl::pair<int, int> > batch;
+		const int nBatchSize = (int)rng.RandLimit((uint32_t)(nBatch * 10 + 1));
+
+		for(int i = 0; i < nBatchSize; ++i)
+			batch.push_back(eastl::pair<int, int>((int)rng.RandLimit((uint32_t)nKeyRange), nBatch * 1000 + i));
+
+		for(eastl_size_t i = 0; i < batch.size(); ++i)
+			rb.insert(typename RBTreeMap::value_type(batch[i].first, batch[i].second));
+
+		if(nBatch % 3 == 0)
+		{
+			eastl::stable_sort(batch.begin(), batch.end(), vm.value_comp());
+			vm.insert(eastl::assume_sorted, batch.begin(), batch.end());
+		}
+		else
+			vm.insert(batch.begin(), batch.end());
+
+		EATEST_VERIFY(vm.validate());
+		EATEST_VERIFY(vm.size() == rb.size());
+
+		typename RBTreeMap::iterator itRB = rb.begin();
+		for(typename VectorMap::iterator it = vm.begin(); (it != vm.end()) && (itRB != rb.end()); ++it, ++itRB)
+			EATEST_VERIFY((it->first == itRB->first) && (it->second == itRB->second));
+	}
+
+	return nErrorCount;
+}
+
+
 
 int TestVectorMap()
 {
@@ -111,6 +155,21 @@ int TestVectorMap()
 	}
 
 
+	{
+		// Heterogeneous lookup via a transparent comparison.
+		typedef eastl::basic_string<char, MallocAllocator> MallocString;
+
+		nErrorCount += TestMapHeterogeneousLookup<eastl::vector_map<MallocString, int, eastl::less<void>>, false>();
+		nErrorCount += TestMapHeterogeneousLookup<eastl::vector_multimap<MallocString, int, eastl::less<void>>, true>();
+
+		eastl::vector_map<eastl::string, int, eastl::less<void>> m = { {"a", 0}, {"c", 1}, {"e", 2} };
+		EATEST_VERIFY(m.lower_bound(eastl::string_view("b"))->first == "c");
+		EATEST_VERIFY(m.upper_bound(eastl::string_view("c"))->first == "e");
+		EATEST_VERIFY(m.upper_bound("e") == m.end());
+		EATEST_VERIFY(m.contains(eastl::string("a")) && !m.contains(eastl::string("b")));
+	}
+
+
 	{ // Misc tests
 
 		// const key_compare& key_comp() const;
@@ -146,6 +205,23 @@ int TestVectorMap()
 		EATEST_VERIFY(it != fvm.end());
 	}
 
+	{
+		// A range insert which has to merge must not use the container's allocator for its scratch buffer,
+		// as a fixed_vector without overflow can't provide any memory beyond its own.
+		typedef eastl::fixed_vector<eastl::pair<int, float>, 16, false> FV;
+		typedef eastl::vector_map<int, float, eastl::less<int>, FV::allocator_type, FV> FixedVectorMap;
+
+		FixedVectorMap fvm;
+		for(int i = 0; i < 8; i++)
+			fvm.insert(eastl::pair<int, float>(i * 2, (float)i));
+
+		const eastl::pair<int, float> values[] = { {7, 7.f}, {1, 1.f}, {4, -1.f}, {13, 13.f}, {3, 3.f} };
+		fvm.insert(values, values + EAArrayCount(values));
+
+		EATEST_VERIFY((fvm.size() == 12) && eastl::is_sorted(fvm.begin(), fvm.end()) && !fvm.has_overflowed());
+		EATEST_VERIFY((fvm.find(4)->second == 2.f) && (fvm.find(13)->second == 13.f));
+	}
+
 	{
 		// Misc testing
 		typedef eastl::fixed_string<char8_t, 16>   KeyStringType;
@@ -212,6 +288,67 @@ int TestVectorMap()
 		}
 	}
 
+	{
+		// Range insertion sorts the range and merges it in.
+		EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+		nErrorCount += TestVectorMapRangeInsert<VM1, eastl::map<int, int> >(rng, 50);
+		nErrorCount += TestVectorMapRangeInsert<VM1, eastl::map<int, int> >(rng, 100000);
+		nErrorCount += TestVectorMapRangeInsert<VM2, eastl::map<int, int> >(rng, 500);
+		nErrorCount += TestVectorMapRangeInsert<VMM1, eastl::multimap<int, int> >(rng, 50);
+		nErrorCount += TestVectorMapRangeInsert<VMM1, eastl::multimap<int, int> >(rng, 100000);
+		nErrorCount += TestVectorMapRangeInsert<VMM2, eastl::multimap<int, int> >(rng, 500);
+	}
+
+	{
+		// Inserting equivalent keys one at a time places them in the same order as the range insert does,
+		// which is after the equivalent keys already in the container.
+		const eastl::pair<int, int> values[] = { {1, 10}, {2, 20}, {1, 11}, {1, 12}, {2, 21}, {1, 13} };
+
+		VMM1 vmmRange;
+		vmmRange.insert(values, values + 3);
+		vmmRange.insert(values + 3, values + 6);
+
+		VMM1 vmmSingle;
+		for(int i = 0; i < 6; ++i)
+		{
+			if(i % 3 == 0)
+				vmmSingle.insert(values[i]);
+			else if(i % 3 == 1)
+				vmmSingle.insert(eastl::pair<int, int>(values[i]));
+			else
+				vmmSingle.emplace(values[i].first, values[i].second);
+		}
+
+		EATEST_VERIFY(vmmRange.validate() && vmmSingle.validate());
+		EATEST_VERIFY((vmmSingle.size() == 6) && (vmmSingle == vmmRange));
+		EATEST_VERIFY((vmmSingle[0].second == 10) && (vmmSingle[1].second == 11) && (vmmSingle[2].second == 12) && (vmmSingle[3].second == 13));
+	}
+
+	{
+		// Range insertion of TestObject, which counts constructions and destructions.
+		TestObject::Reset();
+		{
+			VM4 vm;
+			vm.insert(eastl::pair<TestObject, TestObject>(TestObject(5), TestObject(50)));
+			vm.insert(eastl::pair<TestObject, TestObject>(TestObject(1), TestObject(10)));
+
+			const eastl::pair<TestObject, TestObject> batch[] = { eastl::pair<TestObject, TestObject>(TestObject(3), TestObject(30)),
+																  eastl::pair<TestObject, TestObject>(TestObject(5), TestObject(51)),
+																  eastl::pair<TestObject, TestObject>(TestObject(0), TestObject(0)),
+																  eastl::pair<TestObject, TestObject>(TestObject(3), TestObject(31)) };
+			vm.insert(batch, batch + 4);
+
+			EATEST_VERIFY(vm.validate());
+			EATEST_VERIFY(vm.size() == 4);
+			EATEST_VERIFY(vm.find(TestObject(3))->second == TestObject(30));
+			EATEST_VERIFY(vm.find(TestObject(5))->second == TestObject(50));
+			EATEST_VERIFY(vm.begin()->first == TestObject(0));
+		}
+		EATEST_VERIFY(TestObject::IsClear());
+		TestObject::Reset();
+	}
+
 	return nErrorCount;
 }
 
@@ -10,6 +10,9 @@
 #include <EASTL/vector_multiset.h>
 #include <EASTL/vector.h>
 #include <EASTL/deque.h>
+#include <EASTL/string.h>
+#include <EASTL/set.h>
+#include <EASTL/sort.h>
 #include <EABase/eabase.h>
 
 EA_DISABLE_ALL_VC_WARNINGS()
@@ -50,6 +53,52 @@ typedef eastl::vector_multiset<TestObject, eastl::less<TestObject>, EASTLAllocat
 ///////////////////////////////////////////////////////////////////////////////
 
 
+// Orders pairs by their first member only, so that we can tell equivalent values apart.
+struct VectorSetPairFirstLess
+{
+	bool operator()(const eastl::pair<int, int>& a, const eastl::pair<int, int>& b) const
+		{ return a.first < b.first; }
+};
+
+
+// Inserts random batches, some of them sorted beforehand, and verifies that the
+// result matches that of inserting the values one at a time into set or multiset,
+// including which of equivalent values is kept and the order of equivalent values.
+template <typename VectorSet, typename RBTreeSet>
+static int TestVectorSetRangeInsert(EA::UnitTest::Rand& rng, int nKeyRange)
+{
+	int nErrorCount = 0;
+
+	VectorSet vs;
+	RBTreeSet rb;
+
+	for(int nBatch = 0; nBatch < 30; ++nBatch)
+	{
+		eastl::vector<eastl::pair<int, int> > batch;
+		const int nBatchSize = (int)rng.RandLimit((uint32_t)(nBatch * 10 + 1));
+
+		for(int i = 0; i < nBatchSize; ++i)
+			batch.push_back(eastl::pair<int, int>((int)rng.RandLimit((uint32_t)nKeyRange), nBatch * 1000 + i));
+
+		rb.insert(batch.begin(), batch.end());
+
+		if(nBatch % 3 == 0)
+		{
+			eastl::stable_sort(batch.begin(), batch.end(), vs.value_comp());
+			vs.insert(eastl::assume_sorted, batch.begin(), batch.end());
+		}
+		else
+			vs.insert(batch.begin(), batch.end());
+
+		EATEST_VERIFY(vs.validate());
+		EATEST_VERIFY(vs.size() == rb.size());
+		EATEST_VERIFY((vs.size() == rb.size()) && eastl::equal(vs.begin(), vs.end(), rb.begin()));
+	}
+
+	return nErrorCount;
+}
+
+
 int TestVectorSet()
 {
 	int nErrorCount = 0;
@@ -105,6 +154,20 @@ int TestVectorSet()
 	}
 
 
+	{
+		// Heterogeneous lookup via a transparent comparison.
+		typedef eastl::basic_string<char, MallocAllocator> MallocString;
+
+		nErrorCount += TestSetHeterogeneousLookup<eastl::vector_set<MallocString, eastl::less<void>>, false>();
+		nErrorCount += TestSetHeterogeneousLookup<eastl::vector_multiset<MallocString, eastl::less<void>>, true>();
+
+		eastl::vector_set<eastl::string, eastl::less<void>> s = { "a", "c", "e" };
+		EATEST_VERIFY(*s.lower_bound(eastl::string_view("b")) == "c");
+		EATEST_VERIFY(*s.upper_bound("c") == "e");
+		EATEST_VERIFY(s.contains(eastl::string("a")) && !s.contains(eastl::string("b")));
+	}
+
+
 	{ // Misc tests
 		{
 			// const key_compare& key_comp() const;
@@ -147,6 +210,64 @@ int TestVectorSet()
 		}
 	}
 
+	{
+		// Range insertion sorts the range and merges it in.
+		typedef eastl::pair<int, int> IntPair;
+		EA::UnitTest::Rand rng(EA::UnitTest::GetRandSeed());
+
+		nErrorCount += TestVectorSetRangeInsert<vector_set<IntPair, VectorSetPairFirstLess>, set<IntPair, VectorSetPairFirstLess> >(rng, 50);
+		nErrorCount += TestVectorSetRangeInsert<vector_set<IntPair, VectorSetPairFirstLess>, set<IntPair, VectorSetPairFirstLess> >(rng, 100000);
+		nErrorCount += TestVectorSetRangeInsert<vector_set<IntPair, VectorSetPairFirstLess, EASTLAllocatorType, deque<IntPair> >, set<IntPair, VectorSetPairFirstLess> >(rng, 500);
+		nErrorCount += TestVectorSetRangeInsert<vector_multiset<IntPair, VectorSetPairFirstLess>, multiset<IntPair, VectorSetPairFirstLess> >(rng, 50);
+		nErrorCount += TestVectorSetRangeInsert<vector_multiset<IntPair, VectorSetPairFirstLess>, multiset<IntPair, VectorSetPairFirstLess> >(rng, 100000);
+		nErrorCount += TestVectorSetRangeInsert<vector_multiset<IntPair, VectorSetPairFirstLess, EASTLAllocatorType, deque<IntPair> >, multiset<IntPair, VectorSetPairFirstLess> >(rng, 500);
+	}
+
+	{
+		// Inserting equivalent values one at a time places them in the same order as the range insert does,
+		// which is after the equivalent values already in the container.
+		typedef eastl::pair<int, int> IntPair;
+		const IntPair values[] = { {1, 10}, {2, 20}, {1, 11}, {1, 12}, {2, 21}, {1, 13} };
+
+		vector_multiset<IntPair, VectorSetPairFirstLess> vmsRange;
+		vmsRange.insert(values, values + 3);
+		vmsRange.insert(values + 3, values + 6);
+
+		vector_multiset<IntPair, VectorSetPairFirstLess> vmsSingle;
+		for(int i = 0; i < 6; ++i)
+		{
+			if(i % 3 == 0)
+				vmsSingle.insert(values[i]);
+			else if(i % 3 == 1)
+				vmsSingle.insert(IntPair(values[i]));
+			else
+				vmsSingle.emplace(values[i].first, values[i].second);
+		}
+
+		EATEST_VERIFY(vmsRange.validate() && vmsSingle.validate());
+		EATEST_VERIFY((vmsSingle.size() == 6) && eastl::equal(vmsSingle.begin(), vmsSingle.end(), vmsRange.begin()));
+		EATEST_VERIFY((vmsSingle[0].second == 10) && (vmsSingle[1].second == 11) && (vmsSingle[2].second == 12) && (vmsSingle[3].second == 13));
+	}
+
+	{
+		// Range insertion of TestObject, which counts constructions and destructions.
+		TestObject::Reset();
+		{
+			VMS4 vms;
+			const TestObject batch1[] = { TestObject(4), TestObject(2), TestObject(4) };
+			const TestObject batch2[] = { TestObject(3), TestObject(4), TestObject(1) };
+
+			vms.insert(batch1, batch1 + 3);
+			vms.insert(batch2, batch2 + 3);
+
+			const TestObject expected[] = { TestObject(1), TestObject(2), TestObject(3), TestObject(4), TestObject(4), TestObject(4) };
+			EATEST_VERIFY(vms.validate());
+			EATEST_VERIFY((vms.size() == 6) && eastl::equal(vms.begin(), vms.end(), expected));
+		}
+		EATEST_VERIFY(TestObject::IsClear());
+		TestObject::Reset();
+	}
+
 	return nErrorCount;
 }
 
@@ -86,6 +86,7 @@ int EAMain(int argc, char* argv[])
 	testSuite.AddTest("Allocator",				TestAllocator);
 	testSuite.AddTest("Any",				    TestAny);
 	testSuite.AddTest("Array",					TestArray);
+	testSuite.AddTest("BTree",					TestBTree);
 	testSuite.AddTest("BitVector",				TestBitVector);
 	testSuite.AddTest("Bitset",					TestBitset);
 	testSuite.AddTest("CharTraits",			    TestCharTraits);
@@ -101,6 +102,8 @@ int EAMain(int argc, char* argv[])
 	testSuite.AddTest("FixedSet",				TestFixedSet);
 	testSuite.AddTest("FixedString",			TestFixedString);
 	testSuite.AddTest("FixedVector",			TestFixedVector);
+	testSuite.AddTest("FlatHash",				TestFlatHash);
+	testSuite.AddTest("FrozenVectorMap",		TestFrozenVectorMap);
 	testSuite.AddTest("Functional",				TestFunctional);
 	testSuite.AddTest("Hash",					TestHash);
 	testSuite.AddTest("Heap",					TestHeap);
@@ -117,8 +120,10 @@ int EAMain(int argc, char* argv[])
 	testSuite.AddTest("NumericLimits",			TestNumericLimits);
 	testSuite.AddTest("Optional",				TestOptional);
 	testSuite.AddTest("Random",					TestRandom);
+	testSuite.AddTest("RankSelect",				TestRankSelect);
 	testSuite.AddTest("Ratio",					TestRatio);
 	testSuite.AddTest("RingBuffer",				TestRingBuffer);
+	testSuite.AddTest("RoaringBitmap",			TestRoaringBitmap);
 	testSuite.AddTest("SList",					TestSList);
 	testSuite.AddTest("SegmentedVector",		TestSegmentedVector);
 	testSuite.AddTest("Set",					TestSet);
@@ -131,6 +136,7 @@ int EAMain(int argc, char* argv[])
 	testSuite.AddTest("StringView",			    TestStringView);
 	testSuite.AddTest("TestCppCXTypeTraits",	TestCppCXTypeTraits);
 	testSuite.AddTest("Tuple",					TestTuple);
+	testSuite.AddTest("TupleVector",			TestTupleVector);
 	testSuite.AddTest("TypeTraits",				TestTypeTraits);
 	testSuite.AddTest("Utility",				TestUtility);
 	testSuite.AddTest("Variant",				TestVariant);